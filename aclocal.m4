@@ -1177,6 +1177,7 @@ m4_include([m4/ax_prog_cxx_mpi.m4])
 m4_include([m4/boost.m4])
 m4_include([m4/check_builtins.m4])
 m4_include([m4/configure_boost.m4])
+m4_include([m4/configure_compiled_expressions.m4])
 m4_include([m4/configure_eigen.m4])
 m4_include([m4/configure_gsl.m4])
 m4_include([m4/configure_hdf5.m4])
@@ -1184,6 +1185,7 @@ m4_include([m4/configure_hypre.m4])
 m4_include([m4/configure_libmesh.m4])
 m4_include([m4/configure_muparser.m4])
 m4_include([m4/configure_petsc.m4])
+m4_include([m4/configure_profiler_annotations.m4])
 m4_include([m4/configure_samrai.m4])
 m4_include([m4/configure_silo.m4])
 m4_include([m4/lib-ld.m4])
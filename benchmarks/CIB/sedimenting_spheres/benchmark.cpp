@@ -0,0 +1,283 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/CIBMethod.h>
+#include <ibamr/CIBStaggeredStokesSolver.h>
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/muParserCartGridFunction.h>
+#include <ibtk/muParserRobinBcCoefs.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+#include "../../benchmark_utilities.h"
+
+#include <cmath>
+
+// Geometry of the suspension: NUM_SPHERES_1D^3 rigid spheres of radius R on a
+// uniform lattice in the unit box. The surface of each sphere is discretized by
+// a Fibonacci lattice of nodes with a spacing of approximately MFAC times the
+// finest grid spacing.
+namespace SphereData
+{
+static int finest_ln = 0;
+static double R = 0.1;
+static int num_spheres_1d = 2;
+static int num_sphere_nodes = 0;
+
+struct SphereCtx
+{
+    IBTK::Vector F;
+}; // SphereCtx
+
+void
+init_structure_data(Pointer<Database> input_db)
+{
+    finest_ln = input_db->getInteger("MAX_LEVELS") - 1;
+    R = input_db->getDouble("R");
+    num_spheres_1d = input_db->getInteger("NUM_SPHERES_1D");
+    const double ds = input_db->getDouble("MFAC") * input_db->getDouble("DX");
+    num_sphere_nodes = std::max(12, static_cast<int>(std::ceil(4.0 * M_PI * R * R / (ds * ds))));
+    return;
+} // init_structure_data
+
+void
+generate_structure(const unsigned int& strct_num,
+                   const int& ln,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn)
+{
+    if (ln != finest_ln)
+    {
+        num_vertices = 0;
+        vertex_posn.resize(num_vertices);
+        return;
+    }
+    IBTK::Point X0;
+    int idx = static_cast<int>(strct_num);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        X0(d) = (static_cast<double>(idx % num_spheres_1d) + 0.5) / static_cast<double>(num_spheres_1d);
+        idx /= num_spheres_1d;
+    }
+    num_vertices = num_sphere_nodes;
+    vertex_posn.resize(num_vertices);
+    const double golden_angle = M_PI * (3.0 - std::sqrt(5.0));
+    for (int k = 0; k < num_vertices; ++k)
+    {
+        const double z = 1.0 - 2.0 * (static_cast<double>(k) + 0.5) / static_cast<double>(num_vertices);
+        const double r = std::sqrt(1.0 - z * z);
+        const double phi = golden_angle * static_cast<double>(k);
+        vertex_posn[k](0) = X0(0) + R * r * std::cos(phi);
+        vertex_posn[k](1) = X0(1) + R * r * std::sin(phi);
+        vertex_posn[k](2) = X0(2) + R * z;
+    }
+    return;
+} // generate_structure
+
+void
+NetExternalForceTorque(double /*data_time*/, Eigen::Vector3d& F_ext, Eigen::Vector3d& T_ext, void* ctx)
+{
+    SphereCtx& sphere_ctx = *static_cast<SphereCtx*>(ctx);
+    F_ext << sphere_ctx.F(0), sphere_ctx.F(1), sphere_ctx.F(2);
+    T_ext << 0.0, 0.0, 0.0;
+    return;
+} // NetExternalForceTorque
+
+void
+ConstrainedCOMVel(double /*data_time*/, Eigen::Vector3d& U_com, Eigen::Vector3d& W_com, void* /*ctx*/)
+{
+    U_com.setZero();
+    W_com.setZero();
+    return;
+} // ConstrainedCOMVel
+} // namespace SphereData
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line:         *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+    SAMRAIManager::setMaxNumberPatchDataEntries(2054);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "CIB_sedimenting_spheres.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const benchmark_utilities::BenchmarkParameters params =
+            benchmark_utilities::get_benchmark_parameters("CIB_sedimenting_spheres", argv[1], input_db);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        SphereData::init_structure_data(input_db);
+        const unsigned int num_structures =
+            static_cast<unsigned int>(std::pow(SphereData::num_spheres_1d, static_cast<int>(NDIM)));
+        Pointer<INSStaggeredHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<CIBMethod> ib_method_ops =
+            new CIBMethod("CIBMethod", app_initializer->getComponentDatabase("CIBMethod"), num_structures);
+        Pointer<CIBStaggeredStokesSolver> CIBSolver =
+            new CIBStaggeredStokesSolver("CIBStaggeredStokesSolver",
+                                         input_db->getDatabase("CIBStaggeredStokesSolver"),
+                                         navier_stokes_integrator,
+                                         ib_method_ops,
+                                         "SP_");
+        navier_stokes_integrator->setStokesSolver(CIBSolver);
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+            "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+        std::vector<std::string> structure_names(num_structures);
+        for (unsigned int part = 0; part < num_structures; ++part)
+        {
+            structure_names[part] = "sphere_" + std::to_string(part);
+        }
+        ib_initializer->setStructureNamesOnLevel(SphereData::finest_ln, structure_names);
+        ib_initializer->registerInitStructureFunction(SphereData::generate_structure);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+
+        // Each sphere is free to translate and rotate and is driven by its
+        // excess weight.
+        const double sphere_weight = input_db->getDouble("RHO_EXCESS") * (4.0 / 3.0) * M_PI *
+                                     std::pow(SphereData::R, 3) * input_db->getDouble("G");
+        FreeRigidDOFVector free_dofs;
+        free_dofs << 1, 1, 1, 1, 1, 1;
+        std::vector<SphereData::SphereCtx> sphere_ctxs(num_structures);
+        for (unsigned int part = 0; part < num_structures; ++part)
+        {
+            sphere_ctxs[part].F.setZero();
+            ib_method_ops->setSolveRigidBodyVelocity(part, free_dofs);
+            ib_method_ops->registerExternalForceTorqueFunction(
+                &SphereData::NetExternalForceTorque, &sphere_ctxs[part], part);
+            ib_method_ops->registerConstrainedVelocityFunction(
+                NULL, &SphereData::ConstrainedCOMVel, &sphere_ctxs[part], part);
+        }
+
+        // Create initial condition specification objects.
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+        Pointer<CartGridFunction> p_init = new muParserCartGridFunction(
+            "p_init", app_initializer->getComponentDatabase("PressureInitialConditions"), grid_geometry);
+        navier_stokes_integrator->registerPressureInitialConditions(p_init);
+
+        // Create boundary condition specification objects.
+        vector<RobinBcCoefStrategy<NDIM>*> u_bc_coefs(NDIM);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const std::string bc_coefs_name = "u_bc_coefs_" + std::to_string(d);
+            const std::string bc_coefs_db_name = "VelocityBcCoefs_" + std::to_string(d);
+            u_bc_coefs[d] = new muParserRobinBcCoefs(
+                bc_coefs_name, app_initializer->getComponentDatabase(bc_coefs_db_name), grid_geometry);
+        }
+        navier_stokes_integrator->registerPhysicalBoundaryConditions(u_bc_coefs);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+        ib_method_ops->setVelocityPhysBdryOp(time_integrator->getVelocityPhysBdryOp());
+        navier_stokes_integrator->setStokesSolverNeedsInit();
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+        app_initializer.setNull();
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        // Run the benchmark. Before each time step, the hierarchy is regridded
+        // if the structures have moved too far and the gravitational force on
+        // each sphere is set.
+        std::map<std::string, std::string> metadata;
+        benchmark_utilities::add_hierarchy_metadata(metadata, patch_hierarchy);
+        metadata["num_structures"] = std::to_string(num_structures);
+        metadata["num_lagrangian_nodes"] = std::to_string(num_structures * SphereData::num_sphere_nodes);
+        metadata["mobility_solver_type"] =
+            input_db->getDatabase("CIBStaggeredStokesSolver")->getString("mobility_solver_type");
+        benchmark_utilities::run_benchmark(
+            params, time_integrator, metadata, [&](double /*time*/, double /*dt*/) {
+                if (time_integrator->atRegridPoint()) navier_stokes_integrator->setStokesSolverNeedsInit();
+                if (ib_method_ops->flagRegrid())
+                {
+                    time_integrator->regridHierarchy();
+                    navier_stokes_integrator->setStokesSolverNeedsInit();
+                }
+                for (auto& sphere_ctx : sphere_ctxs)
+                {
+                    sphere_ctx.F.setZero();
+                    sphere_ctx.F(NDIM - 1) = -sphere_weight;
+                }
+            });
+
+        // Cleanup boundary condition specification objects.
+        for (unsigned int d = 0; d < NDIM; ++d) delete u_bc_coefs[d];
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,323 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#include <IBTK_config.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/app_namespaces.h>
+
+#include <petscsys.h>
+
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <NodeData.h>
+#include <NodeVariable.h>
+#include <SAMRAI_config.h>
+#include <SideData.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+// Benchmark for the throughput of LEInteractor::spread() and
+// LEInteractor::interpolate().
+//
+// For each combination of kernel function, centering, and marker density
+// listed in the input file, markers are placed uniformly at random in the
+// interior of every patch of the finest level, and the time required to
+// spread to and interpolate from the Eulerian grid is measured.  Patch sizes
+// are set by the GriddingAlgorithm database and rank counts by mpirun.  The
+// results (in markers per second, counted over all ranks) are written to
+// json_file_name on rank 0.
+
+namespace
+{
+struct BenchmarkResult
+{
+    std::string kernel_fcn;
+    std::string centering;
+    double markers_per_cell;
+    long n_markers;
+    double spread_time;
+    double interp_time;
+};
+
+std::vector<std::string>
+get_string_array(Pointer<Database> db, const std::string& key, const std::vector<std::string>& default_values)
+{
+    if (!db->keyExists(key)) return default_values;
+    const Array<std::string> values = db->getStringArray(key);
+    std::vector<std::string> result(values.size());
+    for (int k = 0; k < values.size(); ++k) result[k] = values[k];
+    return result;
+}
+
+std::vector<double>
+get_double_array(Pointer<Database> db, const std::string& key, const std::vector<double>& default_values)
+{
+    if (!db->keyExists(key)) return default_values;
+    const Array<double> values = db->getDoubleArray(key);
+    std::vector<double> result(values.size());
+    for (int k = 0; k < values.size(); ++k) result[k] = values[k];
+    return result;
+}
+
+// Place (a deterministic set of) markers uniformly at random in the interior of
+// the patch.
+void
+generate_markers(std::vector<double>& X, const Patch<NDIM>& patch, const double markers_per_cell)
+{
+    const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch.getPatchGeometry();
+    const double* const x_lower = patch_geom->getXLower();
+    const double* const x_upper = patch_geom->getXUpper();
+    const long n_markers = std::lround(markers_per_cell * patch.getBox().size());
+    std::mt19937 rng(static_cast<unsigned int>(patch.getPatchNumber()));
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    X.resize(NDIM * n_markers);
+    for (long k = 0; k < n_markers; ++k)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X[NDIM * k + d] = x_lower[d] + distribution(rng) * (x_upper[d] - x_lower[d]);
+        }
+    }
+}
+
+template <class DataType>
+void
+run_benchmark(BenchmarkResult& result, const int q_idx, Pointer<PatchLevel<NDIM> > level, const int n_repetitions)
+{
+    const int Q_depth = NDIM;
+
+    // Set up the markers and the data to spread.
+    std::vector<std::vector<double> > X(level->getNumberOfPatches());
+    std::vector<std::vector<double> > F(level->getNumberOfPatches());
+    long n_local_markers = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        generate_markers(X[p()], *patch, result.markers_per_cell);
+        F[p()].resize(X[p()].size());
+        for (unsigned int k = 0; k < F[p()].size(); ++k) F[p()][k] = 1.0 + static_cast<double>(k % 7);
+        n_local_markers += X[p()].size() / NDIM;
+    }
+    result.n_markers = SAMRAI_MPI::sumReduction(static_cast<int>(n_local_markers));
+
+    // Time spreading.
+    SAMRAI_MPI::barrier();
+    double start_time = MPI_Wtime();
+    for (int rep = 0; rep < n_repetitions; ++rep)
+    {
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<DataType> q_data = patch->getPatchData(q_idx);
+            LEInteractor::spread(q_data, F[p()], Q_depth, X[p()], NDIM, patch, patch->getBox(), result.kernel_fcn);
+        }
+    }
+    result.spread_time = SAMRAI_MPI::maxReduction(MPI_Wtime() - start_time);
+
+    // Time interpolation.
+    SAMRAI_MPI::barrier();
+    start_time = MPI_Wtime();
+    for (int rep = 0; rep < n_repetitions; ++rep)
+    {
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<DataType> q_data = patch->getPatchData(q_idx);
+            LEInteractor::interpolate(F[p()], Q_depth, X[p()], NDIM, q_data, patch, patch->getBox(), result.kernel_fcn);
+        }
+    }
+    result.interp_time = SAMRAI_MPI::maxReduction(MPI_Wtime() - start_time);
+}
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "le_interactor.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        if (input_db->keyExists("LEInteractor")) LEInteractor::setFromDatabase(input_db->getDatabase("LEInteractor"));
+
+        const std::vector<std::string> kernel_fcns = get_string_array(input_db,
+                                                                      "kernel_fcns",
+                                                                      { "PIECEWISE_LINEAR",
+                                                                        "IB_3",
+                                                                        "IB_4",
+                                                                        "IB_6",
+                                                                        "BSPLINE_3",
+                                                                        "BSPLINE_4",
+                                                                        "BSPLINE_5",
+                                                                        "BSPLINE_6" });
+        const std::vector<std::string> centerings =
+            get_string_array(input_db, "centerings", { "CELL", "SIDE", "NODE" });
+        const std::vector<double> marker_densities = get_double_array(input_db, "markers_per_cell", { 1.0 });
+        const int n_repetitions = input_db->getIntegerWithDefault("n_repetitions", 10);
+        const std::string json_file_name =
+            input_db->getStringWithDefault("json_file_name", "le_interactor_benchmark.json");
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables with enough ghost cells for every kernel.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        int ghost_width = 0;
+        for (const std::string& kernel_fcn : kernel_fcns)
+        {
+            ghost_width = std::max(ghost_width, LEInteractor::getMinimumGhostWidth(kernel_fcn));
+        }
+        const IntVector<NDIM> gcw(ghost_width);
+        Pointer<CellVariable<NDIM, double> > q_cc_var = new CellVariable<NDIM, double>("q_cc", NDIM);
+        Pointer<SideVariable<NDIM, double> > q_sc_var = new SideVariable<NDIM, double>("q_sc");
+        Pointer<NodeVariable<NDIM, double> > q_nc_var = new NodeVariable<NDIM, double>("q_nc", NDIM);
+        const int q_cc_idx = var_db->registerVariableAndContext(q_cc_var, ctx, gcw);
+        const int q_sc_idx = var_db->registerVariableAndContext(q_sc_var, ctx, gcw);
+        const int q_nc_idx = var_db->registerVariableAndContext(q_nc_var, ctx, gcw);
+
+        // set up grid
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        const int tag_buffer = std::numeric_limits<int>::max();
+        int level_number = 0;
+        while ((gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(finest_ln);
+        level->allocatePatchData(q_cc_idx, 0.0);
+        level->allocatePatchData(q_sc_idx, 0.0);
+        level->allocatePatchData(q_nc_idx, 0.0);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > q_cc_data = patch->getPatchData(q_cc_idx);
+            Pointer<SideData<NDIM, double> > q_sc_data = patch->getPatchData(q_sc_idx);
+            Pointer<NodeData<NDIM, double> > q_nc_data = patch->getPatchData(q_nc_idx);
+            q_cc_data->fillAll(1.0);
+            q_sc_data->fillAll(1.0);
+            q_nc_data->fillAll(1.0);
+        }
+
+        long n_local_cells = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++) n_local_cells += level->getPatch(p())->getBox().size();
+        const long n_cells = SAMRAI_MPI::sumReduction(static_cast<int>(n_local_cells));
+
+        std::vector<BenchmarkResult> results;
+        for (const std::string& kernel_fcn : kernel_fcns)
+        {
+            for (const std::string& centering : centerings)
+            {
+                for (const double markers_per_cell : marker_densities)
+                {
+                    BenchmarkResult result;
+                    result.kernel_fcn = kernel_fcn;
+                    result.centering = centering;
+                    result.markers_per_cell = markers_per_cell;
+                    if (centering == "CELL")
+                    {
+                        run_benchmark<CellData<NDIM, double> >(result, q_cc_idx, level, n_repetitions);
+                    }
+                    else if (centering == "SIDE")
+                    {
+                        run_benchmark<SideData<NDIM, double> >(result, q_sc_idx, level, n_repetitions);
+                    }
+                    else if (centering == "NODE")
+                    {
+                        run_benchmark<NodeData<NDIM, double> >(result, q_nc_idx, level, n_repetitions);
+                    }
+                    else
+                    {
+                        TBOX_ERROR("Unsupported centering: " << centering << "\n"
+                                                             << "Valid options are: CELL, SIDE, NODE");
+                    }
+                    pout << kernel_fcn << " " << centering << " markers_per_cell = " << markers_per_cell
+                         << ": spread " << result.n_markers * n_repetitions / result.spread_time
+                         << " markers/s, interpolate " << result.n_markers * n_repetitions / result.interp_time
+                         << " markers/s\n";
+                    results.push_back(result);
+                }
+            }
+        }
+
+        // Write the results in a machine-readable format.
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream json(json_file_name);
+            json.precision(16);
+            json << "{\n"
+                 << "  \"dimension\": " << NDIM << ",\n"
+                 << "  \"n_ranks\": " << SAMRAI_MPI::getNodes() << ",\n"
+                 << "  \"n_patches\": " << level->getNumberOfPatches() << ",\n"
+                 << "  \"n_cells\": " << n_cells << ",\n"
+                 << "  \"n_repetitions\": " << n_repetitions << ",\n"
+                 << "  \"results\": [\n";
+            for (unsigned int k = 0; k < results.size(); ++k)
+            {
+                const BenchmarkResult& result = results[k];
+                json << "    {\"kernel_fcn\": \"" << result.kernel_fcn << "\", "
+                     << "\"centering\": \"" << result.centering << "\", "
+                     << "\"markers_per_cell\": " << result.markers_per_cell << ", "
+                     << "\"n_markers\": " << result.n_markers << ", "
+                     << "\"spread_time\": " << result.spread_time << ", "
+                     << "\"interp_time\": " << result.interp_time << ", "
+                     << "\"spread_markers_per_second\": " << result.n_markers * n_repetitions / result.spread_time
+                     << ", "
+                     << "\"interp_markers_per_second\": " << result.n_markers * n_repetitions / result.interp_time
+                     << "}" << (k + 1 < results.size() ? "," : "") << "\n";
+            }
+            json << "  ]\n"
+                 << "}\n";
+        }
+    }
+
+    // At this point all SAMRAI, PETSc, and IBAMR objects have been cleaned
+    // up, so we shut things down in the opposite order of initialization:
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
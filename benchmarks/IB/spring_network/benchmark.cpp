@@ -0,0 +1,250 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+#include "../../benchmark_utilities.h"
+
+#include <cmath>
+
+// Geometry of the spring network: a jellyfish-like bell, i.e., a spherical cap
+// of radius R centered at X0 that opens in the -z direction. The cap is
+// discretized by NUM_RINGS rings of NUM_RING_NODES nodes each plus a node at the
+// apex. Springs connect the nodes along the rings and along the meridians, and
+// the resting lengths of the springs are a fraction of their initial lengths so
+// that the bell contracts and drives the fluid.
+namespace BellData
+{
+static int finest_ln = 0;
+static double R = 0.25;
+static double theta_max = 0.45 * M_PI;
+static double X0[3] = { 0.5, 0.5, 0.5 };
+static double ds = 0.0;
+static double K = 1.0;
+static double resting_length_factor = 0.9;
+static int num_rings = 0;
+static int num_ring_nodes = 0;
+
+inline int
+node_index(const int ring, const int k)
+{
+    return 1 + ring * num_ring_nodes + (k % num_ring_nodes);
+} // node_index
+
+void
+init_structure_data(Pointer<Database> input_db)
+{
+    finest_ln = input_db->getInteger("MAX_LEVELS") - 1;
+    R = input_db->getDoubleWithDefault("BELL_RADIUS", R);
+    theta_max = input_db->getDoubleWithDefault("BELL_OPENING_ANGLE", theta_max);
+    K = input_db->getDoubleWithDefault("K_SPRING", K);
+    resting_length_factor = input_db->getDoubleWithDefault("RESTING_LENGTH_FACTOR", resting_length_factor);
+    ds = input_db->getDouble("MFAC") * input_db->getDouble("DX_FINEST");
+    num_rings = std::max(2, static_cast<int>(std::ceil(R * theta_max / ds)));
+    num_ring_nodes = std::max(8, static_cast<int>(std::ceil(2.0 * M_PI * R * std::sin(theta_max) / ds)));
+    return;
+} // init_structure_data
+
+IBTK::Point
+node_position(const int idx)
+{
+    IBTK::Point X;
+    double theta = 0.0, phi = 0.0;
+    if (idx > 0)
+    {
+        const int ring = (idx - 1) / num_ring_nodes;
+        const int k = (idx - 1) % num_ring_nodes;
+        theta = theta_max * static_cast<double>(ring + 1) / static_cast<double>(num_rings);
+        phi = 2.0 * M_PI * static_cast<double>(k) / static_cast<double>(num_ring_nodes);
+    }
+    X(0) = X0[0] + R * std::sin(theta) * std::cos(phi);
+    X(1) = X0[1] + R * std::sin(theta) * std::sin(phi);
+    X(2) = X0[2] + R * std::cos(theta) - 0.5 * R;
+    return X;
+} // node_position
+
+void
+generate_structure(const unsigned int& /*strct_num*/,
+                   const int& ln,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn)
+{
+    if (ln != finest_ln)
+    {
+        num_vertices = 0;
+        vertex_posn.resize(num_vertices);
+        return;
+    }
+    num_vertices = 1 + num_rings * num_ring_nodes;
+    vertex_posn.resize(num_vertices);
+    for (int idx = 0; idx < num_vertices; ++idx) vertex_posn[idx] = node_position(idx);
+    return;
+} // generate_structure
+
+void
+add_spring(int idx0,
+           int idx1,
+           std::multimap<int, IBRedundantInitializer::Edge>& spring_map,
+           std::map<IBRedundantInitializer::Edge, IBRedundantInitializer::SpringSpec, IBRedundantInitializer::EdgeComp>&
+               spring_spec)
+{
+    if (idx0 > idx1) std::swap(idx0, idx1);
+    const IBRedundantInitializer::Edge e(idx0, idx1);
+    const double length = (node_position(idx1) - node_position(idx0)).norm();
+    IBRedundantInitializer::SpringSpec spec_data;
+    spec_data.parameters = { K / ds, resting_length_factor * length };
+    spec_data.force_fcn_idx = 0;
+    spring_map.insert(std::make_pair(e.first, e));
+    spring_spec.insert(std::make_pair(e, spec_data));
+    return;
+} // add_spring
+
+void
+generate_springs(
+    const unsigned int& /*strct_num*/,
+    const int& ln,
+    std::multimap<int, IBRedundantInitializer::Edge>& spring_map,
+    std::map<IBRedundantInitializer::Edge, IBRedundantInitializer::SpringSpec, IBRedundantInitializer::EdgeComp>&
+        spring_spec)
+{
+    if (ln != finest_ln) return;
+    for (int k = 0; k < num_ring_nodes; ++k)
+    {
+        add_spring(0, node_index(0, k), spring_map, spring_spec);
+        for (int ring = 0; ring < num_rings; ++ring)
+        {
+            add_spring(node_index(ring, k), node_index(ring, k + 1), spring_map, spring_spec);
+            if (ring + 1 < num_rings) add_spring(node_index(ring, k), node_index(ring + 1, k), spring_map, spring_spec);
+        }
+    }
+    return;
+} // generate_springs
+} // namespace BellData
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line:         *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB_spring_network.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const benchmark_utilities::BenchmarkParameters params =
+            benchmark_utilities::get_benchmark_parameters("IB_spring_network", argv[1], input_db);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        BellData::init_structure_data(input_db);
+        Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+            "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+        ib_initializer->setStructureNamesOnLevel(BellData::finest_ln, std::vector<std::string>(1, "bell"));
+        ib_initializer->registerInitStructureFunction(BellData::generate_structure);
+        ib_initializer->registerInitSpringDataFunction(BellData::generate_springs);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+        Pointer<IBStandardForceGen> ib_force_fcn = new IBStandardForceGen();
+        ib_method_ops->registerIBLagrangianForceFunction(ib_force_fcn);
+
+        // Create Eulerian initial condition specification objects.
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+        app_initializer.setNull();
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        // Run the benchmark.
+        std::map<std::string, std::string> metadata;
+        benchmark_utilities::add_hierarchy_metadata(metadata, patch_hierarchy);
+        metadata["num_lagrangian_nodes"] = std::to_string(1 + BellData::num_rings * BellData::num_ring_nodes);
+        benchmark_utilities::run_benchmark(params, time_integrator, metadata);
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,260 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/mesh_generation.h>
+#include <libmesh/replicated_mesh.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/libmesh_utilities.h>
+#include <ibtk/muParserCartGridFunction.h>
+#include <ibtk/muParserRobinBcCoefs.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+#include "../../benchmark_utilities.h"
+
+#include <cmath>
+
+// Elasticity model data: a neo-Hookean block that is tethered to its initial
+// position by a penalty body force.
+namespace ModelData
+{
+static double block_center[3] = { 0.5, 0.5, 0.5 };
+
+// Coordinate mapping function.
+void
+coordinate_mapping_function(libMesh::Point& X, const libMesh::Point& s, void* /*ctx*/)
+{
+    for (unsigned int d = 0; d < NDIM; ++d) X(d) = s(d) + block_center[d];
+    return;
+} // coordinate_mapping_function
+
+// Stress tensor functions.
+static double c1_s = 0.05;
+static double p0_s = 0.0;
+static double beta_s = 0.0;
+void
+PK1_dev_stress_function(TensorValue<double>& PP,
+                        const TensorValue<double>& FF,
+                        const libMesh::Point& /*X*/,
+                        const libMesh::Point& /*s*/,
+                        Elem* const /*elem*/,
+                        const vector<const vector<double>*>& /*var_data*/,
+                        const vector<const vector<VectorValue<double> >*>& /*grad_var_data*/,
+                        double /*time*/,
+                        void* /*ctx*/)
+{
+    PP = 2.0 * c1_s * FF;
+    return;
+} // PK1_dev_stress_function
+
+void
+PK1_dil_stress_function(TensorValue<double>& PP,
+                        const TensorValue<double>& FF,
+                        const libMesh::Point& /*X*/,
+                        const libMesh::Point& /*s*/,
+                        Elem* const /*elem*/,
+                        const vector<const vector<double>*>& /*var_data*/,
+                        const vector<const vector<VectorValue<double> >*>& /*grad_var_data*/,
+                        double /*time*/,
+                        void* /*ctx*/)
+{
+    PP = 2.0 * (-p0_s + beta_s * log(FF.det())) * tensor_inverse_transpose(FF, NDIM);
+    return;
+} // PK1_dil_stress_function
+
+// Tether (penalty) force function.
+static double kappa_s = 1.0e6;
+void
+tether_force_function(VectorValue<double>& F,
+                      const TensorValue<double>& /*FF*/,
+                      const libMesh::Point& x,
+                      const libMesh::Point& X,
+                      Elem* const /*elem*/,
+                      const vector<const vector<double>*>& /*var_data*/,
+                      const vector<const vector<VectorValue<double> >*>& /*grad_var_data*/,
+                      double /*time*/,
+                      void* /*ctx*/)
+{
+    for (unsigned int d = 0; d < NDIM; ++d) F(d) = kappa_s * (X(d) - x(d));
+    return;
+} // tether_force_function
+} // namespace ModelData
+using namespace ModelData;
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line:         *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize libMesh, PETSc, MPI, and SAMRAI.
+    LibMeshInit init(argc, argv);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IBFE_block_in_channel.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const benchmark_utilities::BenchmarkParameters params =
+            benchmark_utilities::get_benchmark_parameters("IBFE_block_in_channel", argv[1], input_db);
+
+        // Create a simple FE mesh of the block.
+        ReplicatedMesh mesh(init.comm(), NDIM);
+        const double dx = input_db->getDouble("DX");
+        const double ds = input_db->getDouble("MFAC") * dx;
+        const string elem_type = input_db->getString("ELEM_TYPE");
+        const double W = input_db->getDouble("BLOCK_WIDTH");
+        const int num_elems = std::max(1, static_cast<int>(std::ceil(W / ds)));
+        MeshTools::Generation::build_cube(mesh,
+                                          num_elems,
+                                          num_elems,
+                                          NDIM == 3 ? num_elems : 0,
+                                          -0.5 * W,
+                                          0.5 * W,
+                                          -0.5 * W,
+                                          0.5 * W,
+                                          -0.5 * W,
+                                          0.5 * W,
+                                          Utility::string_to_enum<ElemType>(elem_type));
+        mesh.prepare_for_use();
+
+        const Array<double> center = input_db->getDoubleArray("BLOCK_CENTER");
+        for (unsigned int d = 0; d < NDIM; ++d) block_center[d] = center[d];
+        c1_s = input_db->getDouble("C1_S");
+        p0_s = input_db->getDouble("P0_S");
+        beta_s = input_db->getDouble("BETA_S");
+        kappa_s = input_db->getDouble("KAPPA_S");
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBFEMethod> ib_method_ops =
+            new IBFEMethod("IBFEMethod",
+                           app_initializer->getComponentDatabase("IBFEMethod"),
+                           &mesh,
+                           app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"),
+                           /*register_for_restart*/ false);
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        time_integrator->registerLoadBalancer(load_balancer);
+
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IBFE solver.
+        ib_method_ops->registerInitialCoordinateMappingFunction(coordinate_mapping_function);
+        IBFEMethod::PK1StressFcnData PK1_dev_stress_data(PK1_dev_stress_function);
+        IBFEMethod::PK1StressFcnData PK1_dil_stress_data(PK1_dil_stress_function);
+        PK1_dev_stress_data.quad_order =
+            Utility::string_to_enum<libMesh::Order>(input_db->getStringWithDefault("PK1_DEV_QUAD_ORDER", "THIRD"));
+        PK1_dil_stress_data.quad_order =
+            Utility::string_to_enum<libMesh::Order>(input_db->getStringWithDefault("PK1_DIL_QUAD_ORDER", "FIRST"));
+        ib_method_ops->registerPK1StressFunction(PK1_dev_stress_data);
+        ib_method_ops->registerPK1StressFunction(PK1_dil_stress_data);
+        ib_method_ops->registerLagBodyForceFunction(IBFEMethod::LagBodyForceFcnData(tether_force_function));
+        ib_method_ops->initializeFEEquationSystems();
+
+        // Create Eulerian initial condition specification objects.
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+        // Create Eulerian boundary condition specification objects.
+        vector<RobinBcCoefStrategy<NDIM>*> u_bc_coefs(NDIM);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const std::string bc_coefs_name = "u_bc_coefs_" + std::to_string(d);
+            const std::string bc_coefs_db_name = "VelocityBcCoefs_" + std::to_string(d);
+            u_bc_coefs[d] = new muParserRobinBcCoefs(
+                bc_coefs_name, app_initializer->getComponentDatabase(bc_coefs_db_name), grid_geometry);
+        }
+        navier_stokes_integrator->registerPhysicalBoundaryConditions(u_bc_coefs);
+
+        // Initialize hierarchy configuration and data on all patches.
+        ib_method_ops->initializeFEData();
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        app_initializer.setNull();
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        // Run the benchmark.
+        std::map<std::string, std::string> metadata;
+        benchmark_utilities::add_hierarchy_metadata(metadata, patch_hierarchy);
+        metadata["num_elements"] = std::to_string(mesh.n_elem());
+        metadata["num_nodes"] = std::to_string(mesh.n_nodes());
+        metadata["elem_type"] = elem_type;
+        benchmark_utilities::run_benchmark(params, time_integrator, metadata);
+
+        // Cleanup Eulerian boundary condition specification objects.
+        for (unsigned int d = 0; d < NDIM; ++d) delete u_bc_coefs[d];
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    return 0;
+} // main
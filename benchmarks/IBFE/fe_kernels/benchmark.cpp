@@ -0,0 +1,347 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <HierarchySideDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/mesh_generation.h>
+#include <libmesh/replicated_mesh.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/FEDataManager.h>
+#include <ibtk/HierarchyGhostCellInterpolation.h>
+#include <ibtk/LibMeshSystemIBVectors.h>
+#include <ibtk/libmesh_utilities.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+#include "../../benchmark_utilities.h"
+
+// Microbenchmarks of the finite element kernels of IBFEMethod, each of which is
+// recorded as its own PerformanceMonitor region:
+//
+//   assemble_force_rhs       FEMechanicsBase::assembleInteriorForceDensityRHS()
+//   compute_l2_projection    FEDataManager::computeL2Projection() of the force
+//   spread                   FEDataManager::spread() of the force
+//   interp_weighted          FEDataManager::interpWeighted() of the velocity
+//
+// The element type and the quadrature orders are set by the input deck so that
+// the kernels can be compared across discretizations.
+
+// Elasticity model data: a sheared neo-Hookean block, so that the deformation
+// gradient and hence the interior force density are nonzero.
+namespace ModelData
+{
+static double block_center[3] = { 0.5, 0.5, 0.5 };
+static double shear = 0.1;
+
+// Coordinate mapping function.
+void
+coordinate_mapping_function(libMesh::Point& X, const libMesh::Point& s, void* /*ctx*/)
+{
+    for (unsigned int d = 0; d < NDIM; ++d) X(d) = s(d) + block_center[d];
+    X(0) += shear * s(1);
+    return;
+} // coordinate_mapping_function
+
+// Stress tensor function.
+static double c1_s = 0.05;
+void
+PK1_stress_function(TensorValue<double>& PP,
+                    const TensorValue<double>& FF,
+                    const libMesh::Point& /*X*/,
+                    const libMesh::Point& /*s*/,
+                    Elem* const /*elem*/,
+                    const vector<const vector<double>*>& /*var_data*/,
+                    const vector<const vector<VectorValue<double> >*>& /*grad_var_data*/,
+                    double /*time*/,
+                    void* /*ctx*/)
+{
+    PP = 2.0 * c1_s * (FF - tensor_inverse_transpose(FF, NDIM));
+    return;
+} // PK1_stress_function
+} // namespace ModelData
+using namespace ModelData;
+
+namespace
+{
+// IBFEMethod with public access to the individual finite element kernels that
+// are otherwise only called as part of a time step. All kernels act on the
+// data at the current time.
+class KernelIBFEMethod : public IBFEMethod
+{
+public:
+    using IBFEMethod::IBFEMethod;
+
+    // Assemble the right-hand side of the L2 projection of the interior force
+    // density.
+    void assembleForceRHS(const double data_time)
+    {
+        d_F_vecs->zero("RHS Vector");
+        for (unsigned int part = 0; part < d_meshes.size(); ++part)
+        {
+            assembleInteriorForceDensityRHS(
+                d_F_vecs->get("RHS Vector", part), d_X_vecs->get("current", part), nullptr, data_time, part);
+        }
+        batch_vec_ghost_update(d_F_vecs->get("RHS Vector"), ADD_VALUES, SCATTER_REVERSE);
+    }
+
+    // Solve for the interior force density from the right-hand side computed
+    // by assembleForceRHS().
+    void projectForce()
+    {
+        for (unsigned int part = 0; part < d_meshes.size(); ++part)
+        {
+            d_active_fe_data_managers[part]->computeL2Projection(d_F_vecs->get("solution", part),
+                                                                 d_F_vecs->get("RHS Vector", part),
+                                                                 FORCE_SYSTEM_NAME,
+                                                                 d_use_consistent_mass_matrix,
+                                                                 /*close_U*/ false,
+                                                                 /*close_F*/ false);
+        }
+    }
+
+    // Copy the current positions and the projected force into the IB-ghosted
+    // vectors used by spreadForce() and interpVelocity().
+    void updateIBGhostedVectors()
+    {
+        batch_vec_ghost_update(d_X_vecs->get("current"), INSERT_VALUES, SCATTER_FORWARD);
+        std::vector<PetscVector<double>*> X_IB_ghost_vecs = d_X_IB_vecs->getIBGhosted("tmp");
+        std::vector<PetscVector<double>*> F_IB_ghost_vecs = d_F_IB_vecs->getIBGhosted("tmp");
+        batch_vec_copy({ d_X_vecs->get("current"), d_F_vecs->get("solution") }, { X_IB_ghost_vecs, F_IB_ghost_vecs });
+        batch_vec_ghost_update({ X_IB_ghost_vecs, F_IB_ghost_vecs }, INSERT_VALUES, SCATTER_FORWARD);
+    }
+
+    // Spread the projected force density to the Eulerian grid.
+    void spreadForce(const int f_data_idx)
+    {
+        for (unsigned int part = 0; part < d_meshes.size(); ++part)
+        {
+            d_active_fe_data_managers[part]->spread(f_data_idx,
+                                                    d_F_IB_vecs->getIBGhosted("tmp", part),
+                                                    d_X_IB_vecs->getIBGhosted("tmp", part),
+                                                    FORCE_SYSTEM_NAME);
+        }
+    }
+
+    // Assemble the right-hand side of the L2 projection of the Eulerian
+    // velocity, whose ghost values must already be filled.
+    void interpVelocity(const int u_data_idx)
+    {
+        const std::vector<Pointer<RefineSchedule<NDIM> > > no_fill;
+        for (PetscVector<double>* U_vec : d_U_IB_vecs->getIBGhosted("tmp")) U_vec->zero();
+        for (unsigned int part = 0; part < d_meshes.size(); ++part)
+        {
+            d_active_fe_data_managers[part]->interpWeighted(u_data_idx,
+                                                            d_U_IB_vecs->getIBGhosted("tmp", part),
+                                                            d_X_IB_vecs->getIBGhosted("tmp", part),
+                                                            VELOCITY_SYSTEM_NAME,
+                                                            no_fill,
+                                                            d_current_time,
+                                                            /*close_F*/ false,
+                                                            /*close_X*/ false);
+        }
+        batch_vec_ghost_update(d_U_IB_vecs->getIBGhosted("tmp"), ADD_VALUES, SCATTER_REVERSE);
+    }
+};
+} // namespace
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line:         *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize libMesh, PETSc, MPI, and SAMRAI.
+    LibMeshInit init(argc, argv);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IBFE_fe_kernels.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const benchmark_utilities::BenchmarkParameters params =
+            benchmark_utilities::get_benchmark_parameters("IBFE_fe_kernels", argv[1], input_db);
+
+        // Create a simple FE mesh of the block.
+        ReplicatedMesh mesh(init.comm(), NDIM);
+        const double dx = input_db->getDouble("DX");
+        const double ds = input_db->getDouble("MFAC") * dx;
+        const string elem_type = input_db->getString("ELEM_TYPE");
+        const double W = input_db->getDouble("BLOCK_WIDTH");
+        const int num_elems = std::max(1, static_cast<int>(std::ceil(W / ds)));
+        MeshTools::Generation::build_cube(mesh,
+                                          num_elems,
+                                          num_elems,
+                                          NDIM == 3 ? num_elems : 0,
+                                          -0.5 * W,
+                                          0.5 * W,
+                                          -0.5 * W,
+                                          0.5 * W,
+                                          -0.5 * W,
+                                          0.5 * W,
+                                          Utility::string_to_enum<ElemType>(elem_type));
+        mesh.prepare_for_use();
+
+        const Array<double> center = input_db->getDoubleArray("BLOCK_CENTER");
+        for (unsigned int d = 0; d < NDIM; ++d) block_center[d] = center[d];
+        shear = input_db->getDouble("SHEAR");
+        c1_s = input_db->getDouble("C1_S");
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        // The time integrators are only used to set up the patch hierarchy and
+        // the finite element data; the benchmark does not take any time steps.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<KernelIBFEMethod> ib_method_ops =
+            new KernelIBFEMethod("IBFEMethod",
+                                 app_initializer->getComponentDatabase("IBFEMethod"),
+                                 &mesh,
+                                 app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"),
+                                 /*register_for_restart*/ false);
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        time_integrator->registerLoadBalancer(load_balancer);
+
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IBFE solver.
+        ib_method_ops->registerInitialCoordinateMappingFunction(coordinate_mapping_function);
+        IBFEMethod::PK1StressFcnData PK1_stress_data(PK1_stress_function);
+        PK1_stress_data.quad_order = Utility::string_to_enum<libMesh::Order>(input_db->getString("PK1_QUAD_ORDER"));
+        ib_method_ops->registerPK1StressFunction(PK1_stress_data);
+        ib_method_ops->initializeFEEquationSystems();
+
+        // Create Eulerian initial condition specification objects.
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+        // Initialize hierarchy configuration and data on all patches.
+        ib_method_ops->initializeFEData();
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Create the Eulerian force and velocity data on the finest level,
+        // which is the level that the FE data manager interacts with.
+        FEDataManager* fe_data_manager = ib_method_ops->getFEDataManager();
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("fe_kernels");
+        Pointer<SideVariable<NDIM, double> > f_var = new SideVariable<NDIM, double>("f_fe_kernels");
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u_fe_kernels");
+        const int f_idx = var_db->registerVariableAndContext(f_var, ctx, fe_data_manager->getGhostCellWidth());
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, fe_data_manager->getGhostCellWidth());
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        Pointer<PatchLevel<NDIM> > finest_level = patch_hierarchy->getPatchLevel(finest_ln);
+        finest_level->allocatePatchData(f_idx, 0.0);
+        finest_level->allocatePatchData(u_idx, 0.0);
+        Pointer<CartGridFunction> u_fcn = new muParserCartGridFunction(
+            "u_fcn", app_initializer->getComponentDatabase("EulerianVelocity"), grid_geometry);
+        u_fcn->setDataOnPatchLevel(u_idx, u_var, finest_level, 0.0);
+        using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
+        {
+            InterpolationTransactionComponent u_component(u_idx, "NONE", false, "NONE", "NONE", false, nullptr);
+            HierarchyGhostCellInterpolation u_fill_op;
+            u_fill_op.initializeOperatorState(u_component, patch_hierarchy, finest_ln, finest_ln);
+            u_fill_op.fillData(0.0);
+        }
+        HierarchySideDataOpsReal<NDIM, double> f_data_ops(patch_hierarchy, finest_ln, finest_ln);
+
+        // Deallocate initialization objects.
+        app_initializer.setNull();
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        // Run the benchmark.
+        const double t = time_integrator->getIntegratorTime();
+        benchmark_utilities::time_region(params, "assemble_force_rhs", [&]() { ib_method_ops->assembleForceRHS(t); });
+        benchmark_utilities::time_region(params,
+                                         "compute_l2_projection",
+                                         [&]() { ib_method_ops->projectForce(); },
+                                         [&]() { ib_method_ops->assembleForceRHS(t); });
+        ib_method_ops->updateIBGhostedVectors();
+        benchmark_utilities::time_region(params,
+                                         "spread",
+                                         [&]() { ib_method_ops->spreadForce(f_idx); },
+                                         [&]() { f_data_ops.setToScalar(f_idx, 0.0, /*interior_only*/ false); });
+        benchmark_utilities::time_region(params, "interp_weighted", [&]() { ib_method_ops->interpVelocity(u_idx); });
+
+        std::map<std::string, std::string> metadata;
+        benchmark_utilities::add_hierarchy_metadata(metadata, patch_hierarchy);
+        metadata["num_elements"] = std::to_string(mesh.n_elem());
+        metadata["num_nodes"] = std::to_string(mesh.n_nodes());
+        metadata["elem_type"] = elem_type;
+        metadata["pk1_quad_order"] = input_db->getString("PK1_QUAD_ORDER");
+        metadata["ib_quad_order"] = input_db->getString("IB_QUAD_ORDER");
+        metadata["ib_use_adaptive_quadrature"] = input_db->getBool("IB_USE_ADAPTIVE_QUADRATURE") ? "true" : "false";
+        benchmark_utilities::write_summary(params, metadata);
+
+        finest_level->deallocatePatchData(f_idx);
+        finest_level->deallocatePatchData(u_idx);
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    return 0;
+} // main
@@ -0,0 +1,216 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBAMR_benchmarks_benchmark_utilities
+#define included_IBAMR_benchmarks_benchmark_utilities
+
+// Utilities shared by the benchmark drivers. Each driver sets up its problem,
+// runs a number of untimed warm-up time steps, and then runs a number of timed
+// time steps with the PerformanceMonitor enabled. The per-phase timings of the
+// timed steps are written to a JSON file together with a description of the
+// problem.
+
+#include <ibtk/HierarchyIntegrator.h>
+#include <ibtk/PerformanceMonitor.h>
+
+#include <BoxArray.h>
+#include <PatchHierarchy.h>
+#include <PatchLevel.h>
+#include <tbox/Database.h>
+#include <tbox/PIO.h>
+#include <tbox/Pointer.h>
+#include <tbox/SAMRAI_MPI.h>
+#include <tbox/Utilities.h>
+
+#include <mpi.h>
+
+#include <map>
+#include <string>
+
+namespace benchmark_utilities
+{
+/*!
+ * Parameters of a benchmark run, read from the <TT>Benchmark</TT> database of
+ * the input file:
+ *
+ * - <TT>num_warmup_steps</TT>: number of untimed time steps (default 2)
+ * - <TT>num_timed_steps</TT>: number of timed time steps (default 10)
+ * - <TT>summary_file_name</TT>: name of the JSON file (default
+ *   <TT>[benchmark name]_[number of processes].json</TT>)
+ * - <TT>scaling_study</TT>: label of the input deck, e.g. "strong" or
+ *   "weak" (default "none")
+ */
+struct BenchmarkParameters
+{
+    std::string name;
+    std::string input_file_name;
+    std::string scaling_study = "none";
+    std::string summary_file_name;
+    int num_warmup_steps = 2;
+    int num_timed_steps = 10;
+};
+
+inline BenchmarkParameters
+get_benchmark_parameters(const std::string& name,
+                         const std::string& input_file_name,
+                         SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db)
+{
+    BenchmarkParameters params;
+    params.name = name;
+    params.input_file_name = input_file_name;
+    params.summary_file_name = name + "_" + std::to_string(SAMRAI::tbox::SAMRAI_MPI::getNodes()) + ".json";
+    if (input_db->keyExists("Benchmark"))
+    {
+        SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db = input_db->getDatabase("Benchmark");
+        params.num_warmup_steps = db->getIntegerWithDefault("num_warmup_steps", params.num_warmup_steps);
+        params.num_timed_steps = db->getIntegerWithDefault("num_timed_steps", params.num_timed_steps);
+        params.summary_file_name = db->getStringWithDefault("summary_file_name", params.summary_file_name);
+        params.scaling_study = db->getStringWithDefault("scaling_study", params.scaling_study);
+    }
+    if (params.num_warmup_steps < 0 || params.num_timed_steps <= 0)
+    {
+        TBOX_ERROR(name << ": invalid number of warm-up or timed time steps\n");
+    }
+    return params;
+} // get_benchmark_parameters
+
+/*!
+ * Add the number of cells on each level of the hierarchy to the metadata.
+ */
+inline void
+add_hierarchy_metadata(std::map<std::string, std::string>& metadata,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > patch_hierarchy)
+{
+    long total_num_cells = 0;
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        const SAMRAI::hier::BoxArray<NDIM>& boxes = patch_hierarchy->getPatchLevel(ln)->getBoxes();
+        long num_cells = 0;
+        for (int k = 0; k < boxes.getNumberOfBoxes(); ++k) num_cells += boxes[k].size();
+        metadata["num_cells_level_" + std::to_string(ln)] = std::to_string(num_cells);
+        total_num_cells += num_cells;
+    }
+    metadata["num_levels"] = std::to_string(patch_hierarchy->getFinestLevelNumber() + 1);
+    metadata["num_cells"] = std::to_string(total_num_cells);
+} // add_hierarchy_metadata
+
+/*!
+ * Add the parameters of the run to the metadata, print the timings recorded by
+ * the PerformanceMonitor, and write them along with the metadata to the summary
+ * file.
+ */
+inline void
+write_summary(const BenchmarkParameters& params, std::map<std::string, std::string> metadata)
+{
+    metadata["benchmark"] = params.name;
+    metadata["input_file"] = params.input_file_name;
+    metadata["scaling_study"] = params.scaling_study;
+    metadata["num_warmup_steps"] = std::to_string(params.num_warmup_steps);
+    metadata["num_timed_steps"] = std::to_string(params.num_timed_steps);
+
+    IBTK::PerformanceMonitor::printSummary(SAMRAI::tbox::pout);
+    IBTK::PerformanceMonitor::writeSummary(params.summary_file_name, metadata);
+    SAMRAI::tbox::pout << "\n" << params.name << ": timings written to " << params.summary_file_name << "\n";
+} // write_summary
+
+/*!
+ * Advance the integrator by the warm-up and timed time steps and write the
+ * timings of the timed steps, along with the given metadata, to the summary
+ * file.
+ *
+ * The optional callback is called before each time step, e.g., to update
+ * body forces that are computed by the driver.
+ */
+template <class PreStepCallback>
+inline void
+run_benchmark(const BenchmarkParameters& params,
+              SAMRAI::tbox::Pointer<IBTK::HierarchyIntegrator> time_integrator,
+              std::map<std::string, std::string> metadata,
+              PreStepCallback pre_step_callback)
+{
+    const int num_steps = params.num_warmup_steps + params.num_timed_steps;
+    double timed_wall_time = 0.0;
+    for (int step = 0; step < num_steps; ++step)
+    {
+        if (step == params.num_warmup_steps)
+        {
+            SAMRAI::tbox::SAMRAI_MPI::barrier();
+            IBTK::PerformanceMonitor::reset();
+            IBTK::PerformanceMonitor::setEnabled(true);
+            timed_wall_time = -MPI_Wtime();
+        }
+        const double dt = time_integrator->getMaximumTimeStepSize();
+        pre_step_callback(time_integrator->getIntegratorTime(), dt);
+        SAMRAI::tbox::pout << params.name << ": step " << step + 1 << " of " << num_steps
+                           << (step < params.num_warmup_steps ? " (warm-up)" : "") << ", dt = " << dt << "\n";
+        time_integrator->advanceHierarchy(dt);
+    }
+    SAMRAI::tbox::SAMRAI_MPI::barrier();
+    timed_wall_time += MPI_Wtime();
+    IBTK::PerformanceMonitor::setEnabled(false);
+
+    SAMRAI::tbox::pout << "\n" << params.name << ": " << params.num_timed_steps << " timed steps took "
+                       << timed_wall_time << " s\n";
+    metadata["wall_time"] = std::to_string(timed_wall_time);
+    metadata["wall_time_per_step"] = std::to_string(timed_wall_time / params.num_timed_steps);
+    write_summary(params, metadata);
+} // run_benchmark
+
+inline void
+run_benchmark(const BenchmarkParameters& params,
+              SAMRAI::tbox::Pointer<IBTK::HierarchyIntegrator> time_integrator,
+              const std::map<std::string, std::string>& metadata)
+{
+    run_benchmark(params, time_integrator, metadata, [](double /*time*/, double /*dt*/) {});
+} // run_benchmark
+
+/*!
+ * Call a function for each of the warm-up and timed repetitions of an
+ * operation. The timed calls are recorded as the named PerformanceMonitor
+ * region. The optional setup function is called before each call but is not
+ * timed, e.g., to reset the state that is modified by the operation.
+ *
+ * \note The name must remain valid until the summary is written.
+ */
+template <class Function, class SetupFunction>
+inline void
+time_region(const BenchmarkParameters& params, const char* name, Function function, SetupFunction setup_function)
+{
+    for (int k = 0; k < params.num_warmup_steps; ++k)
+    {
+        setup_function();
+        function();
+    }
+    for (int k = 0; k < params.num_timed_steps; ++k)
+    {
+        setup_function();
+        SAMRAI::tbox::SAMRAI_MPI::barrier();
+        IBTK::PerformanceMonitor::setEnabled(true);
+        {
+            IBTK::PerformanceMonitor::ScopedRegion region(name);
+            function();
+        }
+        IBTK::PerformanceMonitor::setEnabled(false);
+    }
+} // time_region
+
+template <class Function>
+inline void
+time_region(const BenchmarkParameters& params, const char* name, Function function)
+{
+    time_region(params, name, function, []() {});
+} // time_region
+
+} // namespace benchmark_utilities
+
+#endif //#ifndef included_IBAMR_benchmarks_benchmark_utilities
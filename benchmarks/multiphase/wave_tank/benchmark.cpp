@@ -0,0 +1,235 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/AdvDiffSemiImplicitHierarchyIntegrator.h>
+#include <ibamr/INSVCStaggeredConservativeHierarchyIntegrator.h>
+#include <ibamr/LSRefinementTagger.h>
+#include <ibamr/RelaxationLSMethod.h>
+#include <ibamr/StokesFirstOrderWaveBcCoef.h>
+#include <ibamr/SurfaceTensionForceFunction.h>
+#include <ibamr/WaveDampingFunctions.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CartGridFunctionSet.h>
+#include <ibtk/muParserCartGridFunction.h>
+#include <ibtk/muParserRobinBcCoefs.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Application (shared with examples/wave_tank/ex0)
+#include "GravityForcing.h"
+#include "LSLocateColumnInterface.h"
+#include "SetFluidProperties.h"
+#include "SetLSProperties.h"
+
+#include "../../benchmark_utilities.h"
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line:         *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    // Increase maximum patch data component indices
+    SAMRAIManager::setMaxNumberPatchDataEntries(2500);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "multiphase_wave_tank.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const benchmark_utilities::BenchmarkParameters params =
+            benchmark_utilities::get_benchmark_parameters("multiphase_wave_tank", argv[1], input_db);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSVCStaggeredHierarchyIntegrator> time_integrator =
+            new INSVCStaggeredConservativeHierarchyIntegrator(
+                "INSVCStaggeredConservativeHierarchyIntegrator",
+                app_initializer->getComponentDatabase("INSVCStaggeredConservativeHierarchyIntegrator"));
+        Pointer<AdvDiffHierarchyIntegrator> adv_diff_integrator = new AdvDiffSemiImplicitHierarchyIntegrator(
+            "AdvDiffSemiImplicitHierarchyIntegrator",
+            app_initializer->getComponentDatabase("AdvDiffSemiImplicitHierarchyIntegrator"));
+        time_integrator->registerAdvDiffHierarchyIntegrator(adv_diff_integrator);
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Setup level set information.
+        ColumnInterface column;
+        column.DEPTH = input_db->getDouble("DEPTH");
+
+        Pointer<CellVariable<NDIM, double> > phi_var = new CellVariable<NDIM, double>("level_set");
+        adv_diff_integrator->registerTransportedQuantity(phi_var);
+        adv_diff_integrator->setDiffusionCoefficient(phi_var, 0.0);
+        adv_diff_integrator->setAdvectionVelocity(phi_var, time_integrator->getAdvectionVelocityVariable());
+
+        Pointer<RelaxationLSMethod> level_set_ops =
+            new RelaxationLSMethod("RelaxationLSMethod", app_initializer->getComponentDatabase("RelaxationLSMethod"));
+        LSLocateColumnInterface ls_locate_column_interface(
+            "LSLocateColumnInterface", adv_diff_integrator, phi_var, column);
+        level_set_ops->registerInterfaceNeighborhoodLocatingFcn(&callLSLocateColumnInterfaceCallbackFunction,
+                                                                static_cast<void*>(&ls_locate_column_interface));
+        SetLSProperties set_ls_properties("SetLSProperties", level_set_ops);
+        adv_diff_integrator->registerResetFunction(
+            phi_var, &callSetLSCallbackFunction, static_cast<void*>(&set_ls_properties));
+
+        // Setup the INS maintained material properties.
+        Pointer<Variable<NDIM> > rho_var = new SideVariable<NDIM, double>("rho");
+        time_integrator->registerMassDensityVariable(rho_var);
+        Pointer<CellVariable<NDIM, double> > mu_var = new CellVariable<NDIM, double>("mu");
+        time_integrator->registerViscosityVariable(mu_var);
+
+        SetFluidProperties set_fluid_properties("SetFluidProperties",
+                                                adv_diff_integrator,
+                                                phi_var,
+                                                input_db->getDouble("RHO_O"),
+                                                input_db->getDouble("RHO_I"),
+                                                input_db->getDouble("MU_O"),
+                                                input_db->getDouble("MU_I"),
+                                                input_db->getInteger("LS_REINIT_INTERVAL"),
+                                                input_db->getDouble("NUM_INTERFACE_CELLS"));
+        time_integrator->registerResetFluidDensityFcn(&callSetFluidDensityCallbackFunction,
+                                                      static_cast<void*>(&set_fluid_properties));
+        time_integrator->registerResetFluidViscosityFcn(&callSetFluidViscosityCallbackFunction,
+                                                        static_cast<void*>(&set_fluid_properties));
+
+        // Tag cells near the air-water interface for refinement.
+        LSRefinementTagger ls_tagger("LSRefinementTagger");
+        ls_tagger.setLevelSetVariable(phi_var, adv_diff_integrator);
+        ls_tagger.setLSInitStrategy(level_set_ops);
+        ls_tagger.setTagValue(input_db->getDouble("LS_TAG_VALUE"));
+        ls_tagger.setTagAbsThreshold(input_db->getDouble("LS_TAG_ABS_THRESH"));
+        ls_tagger.registerWithHierarchyIntegrator(time_integrator);
+
+        // Create Eulerian initial condition specification objects.
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        time_integrator->registerVelocityInitialConditions(u_init);
+
+        // Create Eulerian boundary condition specification objects: first
+        // order Stokes waves are generated at the channel inlet.
+        vector<RobinBcCoefStrategy<NDIM>*> u_bc_coefs(NDIM);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const std::string bc_coefs_name = "u_bc_coefs_" + std::to_string(d);
+            const std::string bc_coefs_db_name = "VelocityBcCoefs_" + std::to_string(d);
+            u_bc_coefs[d] = new StokesFirstOrderWaveBcCoef(
+                bc_coefs_name, d, app_initializer->getComponentDatabase(bc_coefs_db_name), grid_geometry);
+        }
+        time_integrator->registerPhysicalBoundaryConditions(u_bc_coefs);
+
+        RobinBcCoefStrategy<NDIM>* phi_bc_coef = new muParserRobinBcCoefs(
+            "phi_bc_coef", app_initializer->getComponentDatabase("PhiBcCoefs"), grid_geometry);
+        adv_diff_integrator->setPhysicalBcCoef(phi_var, phi_bc_coef);
+        level_set_ops->registerPhysicalBoundaryCondition(phi_bc_coef);
+        RobinBcCoefStrategy<NDIM>* rho_bc_coef = new muParserRobinBcCoefs(
+            "rho_bc_coef", app_initializer->getComponentDatabase("RhoBcCoefs"), grid_geometry);
+        time_integrator->registerMassDensityBoundaryConditions(rho_bc_coef);
+        RobinBcCoefStrategy<NDIM>* mu_bc_coef = new muParserRobinBcCoefs(
+            "mu_bc_coef", app_initializer->getComponentDatabase("MuBcCoefs"), grid_geometry);
+        time_integrator->registerViscosityBoundaryConditions(mu_bc_coef);
+
+        // Absorb the waves in a relaxation zone near the channel outlet.
+        WaveDampingData wave_damper;
+        wave_damper.d_x_zone_start = input_db->getDouble("X_ZONE_START");
+        wave_damper.d_x_zone_end = input_db->getDouble("X_ZONE_END");
+        wave_damper.d_depth = input_db->getDouble("DEPTH");
+        wave_damper.d_alpha = input_db->getDouble("ALPHA");
+        wave_damper.d_ins_hier_integrator = time_integrator;
+        wave_damper.d_adv_diff_hier_integrator = adv_diff_integrator;
+        wave_damper.d_phi_var = phi_var;
+        time_integrator->registerPostprocessIntegrateHierarchyCallback(
+            &WaveDampingFunctions::callRelaxationZoneCallbackFunction, static_cast<void*>(&wave_damper));
+
+        // Forcing terms.
+        std::vector<double> grav_const(NDIM);
+        input_db->getDoubleArray("GRAV_CONST", &grav_const[0], NDIM);
+        Pointer<CartGridFunction> grav_force = new GravityForcing("GravityForcing", time_integrator, grav_const);
+        Pointer<SurfaceTensionForceFunction> surface_tension_force =
+            new SurfaceTensionForceFunction("SurfaceTensionForceFunction",
+                                            app_initializer->getComponentDatabase("SurfaceTensionForceFunction"),
+                                            adv_diff_integrator,
+                                            phi_var);
+        Pointer<CartGridFunctionSet> eul_forces = new CartGridFunctionSet("eulerian_forces");
+        eul_forces->addFunction(surface_tension_force);
+        eul_forces->addFunction(grav_force);
+        time_integrator->registerBodyForceFunction(eul_forces);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        app_initializer.setNull();
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        // Run the benchmark.
+        std::map<std::string, std::string> metadata;
+        benchmark_utilities::add_hierarchy_metadata(metadata, patch_hierarchy);
+        benchmark_utilities::run_benchmark(params, time_integrator, metadata);
+
+        // Cleanup boundary condition specification objects.
+        for (unsigned int d = 0; d < NDIM; ++d) delete u_bc_coefs[d];
+        delete phi_bc_coef;
+        delete rho_bc_coef;
+        delete mu_bc_coef;
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,427 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/mesh_generation.h>
+#include <libmesh/replicated_mesh.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/FEDataManager.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/PerformanceMonitor.h>
+#include <ibtk/libmesh_utilities.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+#include "../../benchmark_utilities.h"
+
+#include <cmath>
+
+// Benchmark of regridding a patch hierarchy around a moving structure. Before
+// each regrid, the structure is translated by SHIFT in the x direction, with
+// the direction reversed after each regrid, so that the finest level has to
+// follow the structure. Each regrid is recorded in the "regrid" region, which
+// is split into the following regions by the decorators defined below and by
+// the regions of the IBTK data managers:
+//
+//   tagging                                 tagging cells for refinement
+//   box_generation                          generating the boxes of the new levels
+//   load_balancing                          distributing the new boxes over the processes
+//   data_transfer                           initializing the data on the new levels
+//   reset_hierarchy_configuration           resetting the solvers and transfer schedules
+//   LDataManager::beginDataRedistribution   (LDATA) moving Lagrangian data between patches
+//   LDataManager::endDataRedistribution
+//   FEDataManager::reinitElementMappings    (FE) recomputing the element to patch mappings
+//
+// The structure is either a spherical shell of Lagrangian nodes managed by
+// IBMethod (STRUCTURE_TYPE = "LDATA") or a hexahedral block managed by
+// IBFEMethod (STRUCTURE_TYPE = "FE").
+namespace StructureData
+{
+static int finest_ln = 0;
+static double R = 0.2;
+static double X0[3] = { 0.5, 0.5, 0.5 };
+static double ds = 0.0;
+
+void
+init_structure_data(Pointer<Database> input_db)
+{
+    finest_ln = input_db->getInteger("MAX_LEVELS") - 1;
+    R = input_db->getDouble("STRUCTURE_RADIUS");
+    const Array<double> center = input_db->getDoubleArray("STRUCTURE_CENTER");
+    for (unsigned int d = 0; d < NDIM; ++d) X0[d] = center[d];
+    ds = input_db->getDouble("MFAC") * input_db->getDouble("DX_FINEST");
+    return;
+} // init_structure_data
+
+// Spherical shell of radius R centered at X0 discretized by a Fibonacci
+// lattice of nodes on the finest level.
+void
+generate_structure(const unsigned int& /*strct_num*/,
+                   const int& ln,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn)
+{
+    if (ln != finest_ln)
+    {
+        num_vertices = 0;
+        vertex_posn.resize(num_vertices);
+        return;
+    }
+    num_vertices = std::max(12, static_cast<int>(std::ceil(4.0 * M_PI * R * R / (ds * ds))));
+    vertex_posn.resize(num_vertices);
+    const double golden_angle = M_PI * (3.0 - std::sqrt(5.0));
+    for (int k = 0; k < num_vertices; ++k)
+    {
+        const double z = 1.0 - 2.0 * (static_cast<double>(k) + 0.5) / static_cast<double>(num_vertices);
+        const double r = std::sqrt(1.0 - z * z);
+        const double phi = golden_angle * static_cast<double>(k);
+        vertex_posn[k](0) = X0[0] + R * r * std::cos(phi);
+        vertex_posn[k](1) = X0[1] + R * r * std::sin(phi);
+        vertex_posn[k](2) = X0[2] + R * z;
+    }
+    return;
+} // generate_structure
+
+// Coordinate mapping function of the block.
+void
+coordinate_mapping_function(libMesh::Point& X, const libMesh::Point& s, void* /*ctx*/)
+{
+    for (unsigned int d = 0; d < NDIM; ++d) X(d) = s(d) + X0[d];
+    return;
+} // coordinate_mapping_function
+} // namespace StructureData
+using namespace StructureData;
+
+namespace
+{
+// StandardTagAndInitialize that records cell tagging, the initialization of
+// the data on new levels, and the reset of the hierarchy configuration as
+// separate regions.
+class TimedTagAndInitialize : public StandardTagAndInitialize<NDIM>
+{
+public:
+    using StandardTagAndInitialize<NDIM>::StandardTagAndInitialize;
+
+    void tagCellsForRefinement(const Pointer<BasePatchHierarchy<NDIM> > hierarchy,
+                               const int level_number,
+                               const double regrid_time,
+                               const int tag_index,
+                               const bool initial_time,
+                               const bool coarsest_sync_level,
+                               const bool can_be_refined,
+                               const double regrid_start_time) override
+    {
+        PerformanceMonitor::ScopedRegion region("tagging");
+        StandardTagAndInitialize<NDIM>::tagCellsForRefinement(hierarchy,
+                                                              level_number,
+                                                              regrid_time,
+                                                              tag_index,
+                                                              initial_time,
+                                                              coarsest_sync_level,
+                                                              can_be_refined,
+                                                              regrid_start_time);
+    }
+
+    void initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hierarchy,
+                             const int level_number,
+                             const double init_data_time,
+                             const bool can_be_refined,
+                             const bool initial_time,
+                             const Pointer<BasePatchLevel<NDIM> > old_level,
+                             const bool allocate_data) override
+    {
+        PerformanceMonitor::ScopedRegion region("data_transfer");
+        StandardTagAndInitialize<NDIM>::initializeLevelData(
+            hierarchy, level_number, init_data_time, can_be_refined, initial_time, old_level, allocate_data);
+    }
+
+    void resetHierarchyConfiguration(const Pointer<BasePatchHierarchy<NDIM> > hierarchy,
+                                     const int coarsest_level,
+                                     const int finest_level) override
+    {
+        PerformanceMonitor::ScopedRegion region("reset_hierarchy_configuration");
+        StandardTagAndInitialize<NDIM>::resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+    }
+};
+
+// BergerRigoutsos that records box generation as a separate region.
+class TimedBergerRigoutsos : public BergerRigoutsos<NDIM>
+{
+public:
+    void findBoxesContainingTags(BoxList<NDIM>& boxes,
+                                 const Pointer<PatchLevel<NDIM> > level,
+                                 const int index,
+                                 const int tag_val,
+                                 const Box<NDIM>& bound_box,
+                                 const IntVector<NDIM>& min_box,
+                                 const double efficiency_tol,
+                                 const double combine_tol) const override
+    {
+        PerformanceMonitor::ScopedRegion region("box_generation");
+        BergerRigoutsos<NDIM>::findBoxesContainingTags(
+            boxes, level, index, tag_val, bound_box, min_box, efficiency_tol, combine_tol);
+    }
+};
+
+// LoadBalancer that records load balancing as a separate region.
+class TimedLoadBalancer : public LoadBalancer<NDIM>
+{
+public:
+    using LoadBalancer<NDIM>::LoadBalancer;
+
+    void loadBalanceBoxes(BoxArray<NDIM>& out_boxes,
+                          ProcessorMapping& mapping,
+                          const BoxList<NDIM>& in_boxes,
+                          const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                          int level_number,
+                          const BoxArray<NDIM>& physical_domain,
+                          const IntVector<NDIM>& ratio_to_hierarchy_level_zero,
+                          const IntVector<NDIM>& min_size,
+                          const IntVector<NDIM>& max_size,
+                          const IntVector<NDIM>& cut_factor,
+                          const IntVector<NDIM>& bad_interval) const override
+    {
+        PerformanceMonitor::ScopedRegion region("load_balancing");
+        LoadBalancer<NDIM>::loadBalanceBoxes(out_boxes,
+                                             mapping,
+                                             in_boxes,
+                                             hierarchy,
+                                             level_number,
+                                             physical_domain,
+                                             ratio_to_hierarchy_level_zero,
+                                             min_size,
+                                             max_size,
+                                             cut_factor,
+                                             bad_interval);
+    }
+};
+
+// IBFEMethod that can rigidly translate its meshes between regrids.
+class MovingIBFEMethod : public IBFEMethod
+{
+public:
+    using IBFEMethod::IBFEMethod;
+
+    void translate(const IBTK::Vector& dX)
+    {
+        for (unsigned int part = 0; part < d_meshes.size(); ++part)
+        {
+            System& X_system = d_active_fe_data_managers[part]->getEquationSystems()->get_system(COORDS_SYSTEM_NAME);
+            const unsigned int X_sys_num = X_system.number();
+            PetscVector<double>& X_vec = d_X_vecs->get("solution", part);
+            const MeshBase& mesh = *d_meshes[part];
+            for (auto it = mesh.local_nodes_begin(); it != mesh.local_nodes_end(); ++it)
+            {
+                const Node* const node = *it;
+                for (unsigned int d = 0; d < NDIM; ++d) X_vec.add(node->dof_number(X_sys_num, d, 0), dX[d]);
+            }
+            X_vec.close();
+            X_system.update();
+        }
+        d_X_vecs->copy("solution", { "current" });
+    }
+};
+
+// Rigidly translate the Lagrangian nodes on the finest level.
+void
+translate(LDataManager* l_data_manager, const IBTK::Vector& dX)
+{
+    Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, finest_ln);
+    boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+    for (unsigned int i = 0; i < X_data->getLocalNodeCount(); ++i)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d) X_array[i][d] += dX[d];
+    }
+    X_data->restoreArrays();
+    return;
+} // translate
+} // namespace
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line:         *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize libMesh, PETSc, MPI, and SAMRAI.
+    LibMeshInit init(argc, argv);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "regrid_moving_structures.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const benchmark_utilities::BenchmarkParameters params =
+            benchmark_utilities::get_benchmark_parameters("regrid_moving_structures", argv[1], input_db);
+        init_structure_data(input_db);
+        const std::string structure_type = input_db->getString("STRUCTURE_TYPE");
+        const int max_levels = app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels");
+
+        // Create the structure and the IB method that manages it. The time
+        // integrators are only used to set up and regrid the patch hierarchy;
+        // the benchmark does not take any time steps.
+        ReplicatedMesh mesh(init.comm(), NDIM);
+        Pointer<IBMethod> ib_ldata_ops;
+        Pointer<MovingIBFEMethod> ib_fe_ops;
+        Pointer<IBStrategy> ib_method_ops;
+        if (structure_type == "LDATA")
+        {
+            ib_ldata_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+            ib_method_ops = ib_ldata_ops;
+        }
+        else if (structure_type == "FE")
+        {
+            const int num_elems = std::max(1, static_cast<int>(std::ceil(2.0 * R / ds)));
+            MeshTools::Generation::build_cube(mesh, num_elems, num_elems, num_elems, -R, R, -R, R, -R, R, HEX8);
+            mesh.prepare_for_use();
+            ib_fe_ops = new MovingIBFEMethod("IBFEMethod",
+                                             app_initializer->getComponentDatabase("IBFEMethod"),
+                                             &mesh,
+                                             max_levels,
+                                             /*register_for_restart*/ false);
+            ib_method_ops = ib_fe_ops;
+        }
+        else
+        {
+            TBOX_ERROR("main(): unknown STRUCTURE_TYPE " << structure_type << "; valid values are LDATA and FE.\n");
+        }
+
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new TimedLoadBalancer("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        time_integrator->registerLoadBalancer(load_balancer);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new TimedTagAndInitialize("StandardTagAndInitialize",
+                                      time_integrator,
+                                      app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new TimedBergerRigoutsos();
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBRedundantInitializer> ib_initializer;
+        if (ib_ldata_ops)
+        {
+            ib_initializer = new IBRedundantInitializer(
+                "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+            ib_initializer->setStructureNamesOnLevel(finest_ln, { "shell" });
+            ib_initializer->registerInitStructureFunction(generate_structure);
+            ib_ldata_ops->registerLInitStrategy(ib_initializer);
+        }
+        if (ib_fe_ops)
+        {
+            ib_fe_ops->registerInitialCoordinateMappingFunction(coordinate_mapping_function);
+            ib_fe_ops->initializeFEEquationSystems();
+        }
+
+        // Create Eulerian initial condition specification objects.
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+        // Initialize hierarchy configuration and data on all patches.
+        if (ib_fe_ops) ib_fe_ops->initializeFEData();
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        if (ib_ldata_ops) ib_ldata_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+        app_initializer.setNull();
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        // Run the benchmark. The structure is moved back and forth so that it
+        // stays in the same region of the domain over the whole run.
+        IBTK::Vector dX = IBTK::Vector::Zero();
+        dX[0] = input_db->getDouble("SHIFT");
+        const auto move_structure = [&]() {
+            if (ib_ldata_ops) translate(ib_ldata_ops->getLDataManager(), dX);
+            if (ib_fe_ops) ib_fe_ops->translate(dX);
+            dX = -dX;
+        };
+        benchmark_utilities::time_region(params,
+                                         "regrid",
+                                         [&]() { time_integrator->regridHierarchy(); },
+                                         move_structure);
+
+        std::map<std::string, std::string> metadata;
+        benchmark_utilities::add_hierarchy_metadata(metadata, patch_hierarchy);
+        metadata["structure_type"] = structure_type;
+        metadata["shift"] = std::to_string(input_db->getDouble("SHIFT"));
+        if (ib_ldata_ops)
+        {
+            metadata["num_lagrangian_nodes"] =
+                std::to_string(ib_ldata_ops->getLDataManager()->getNumberOfNodes(finest_ln));
+        }
+        if (ib_fe_ops)
+        {
+            metadata["num_elements"] = std::to_string(mesh.n_elem());
+            metadata["num_nodes"] = std::to_string(mesh.n_nodes());
+        }
+        benchmark_utilities::write_summary(params, metadata);
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    return 0;
+} // main
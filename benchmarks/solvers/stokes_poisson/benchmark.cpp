@@ -0,0 +1,379 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <LocationIndexRobinBcCoefs.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/StaggeredStokesOperator.h>
+#include <ibamr/StaggeredStokesPhysicalBoundaryHelper.h>
+#include <ibamr/StaggeredStokesSolverManager.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCPoissonSolverManager.h>
+#include <ibtk/HierarchyGhostCellInterpolation.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+#include "../../benchmark_utilities.h"
+
+// Microbenchmarks of the building blocks of the Poisson and Stokes solvers on a
+// fixed locally refined patch hierarchy. Each operation is repeated a number of
+// times and is recorded as its own PerformanceMonitor region:
+//
+//   ghost_fill_cc, ghost_fill_sc         ghost cell filling of cell- and side-centered data
+//   stokes_operator_apply                one application of the staggered Stokes operator
+//   <solver>_setup, <solver>_vcycle      setup and one V-cycle of the FAC preconditioners
+//   hypre_level_solver_setup, _solve     setup and solve of the hypre solver on the coarsest level
+//   <solver>_krylov_solve                Krylov solves preconditioned by the FAC preconditioners
+//
+// All solvers use Helmholtz-type problems (C = RHO/DT, D = -MU) so that the
+// velocity and Poisson operators are nonsingular on both periodic and wall
+// bounded domains, and homogeneous Dirichlet boundary conditions for the
+// velocity and the Poisson unknown on non-periodic boundaries.
+
+namespace
+{
+// Names of the timed regions. These must remain valid until the summary is
+// written.
+const char* const POISSON_FAC_SOLVER_NAMES[] = { "cc_point_fac", "cc_box_fac" };
+const char* const POISSON_FAC_SETUP_REGIONS[] = { "cc_point_fac_setup", "cc_box_fac_setup" };
+const char* const POISSON_FAC_VCYCLE_REGIONS[] = { "cc_point_fac_vcycle", "cc_box_fac_vcycle" };
+const char* const POISSON_KRYLOV_REGIONS[] = { "cc_point_fac_krylov_solve", "cc_box_fac_krylov_solve" };
+} // namespace
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line:         *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "solvers_stokes_poisson.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const benchmark_utilities::BenchmarkParameters params =
+            benchmark_utilities::get_benchmark_parameters("solvers_stokes_poisson", argv[1], input_db);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_cc");
+        Pointer<CellVariable<NDIM, double> > f_cc_var = new CellVariable<NDIM, double>("f_cc");
+        Pointer<SideVariable<NDIM, double> > u_sc_var = new SideVariable<NDIM, double>("u_sc");
+        Pointer<SideVariable<NDIM, double> > f_sc_var = new SideVariable<NDIM, double>("f_sc");
+        Pointer<CellVariable<NDIM, double> > p_cc_var = new CellVariable<NDIM, double>("p_cc");
+        Pointer<CellVariable<NDIM, double> > g_cc_var = new CellVariable<NDIM, double>("g_cc");
+
+        const IntVector<NDIM> ghosts = 1;
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, ctx, ghosts);
+        const int f_cc_idx = var_db->registerVariableAndContext(f_cc_var, ctx, ghosts);
+        const int u_sc_idx = var_db->registerVariableAndContext(u_sc_var, ctx, ghosts);
+        const int f_sc_idx = var_db->registerVariableAndContext(f_sc_var, ctx, ghosts);
+        const int p_cc_idx = var_db->registerVariableAndContext(p_cc_var, ctx, ghosts);
+        const int g_cc_idx = var_db->registerVariableAndContext(g_cc_var, ctx, ghosts);
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+        // Allocate data on each level of the patch hierarchy.
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_cc_idx, 0.0);
+            level->allocatePatchData(f_cc_idx, 0.0);
+            level->allocatePatchData(u_sc_idx, 0.0);
+            level->allocatePatchData(f_sc_idx, 0.0);
+            level->allocatePatchData(p_cc_idx, 0.0);
+            level->allocatePatchData(g_cc_idx, 0.0);
+        }
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        const int h_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, finest_ln);
+        u_vec.addComponent(u_cc_var, u_cc_idx, h_cc_idx);
+        f_vec.addComponent(f_cc_var, f_cc_idx, h_cc_idx);
+
+        SAMRAIVectorReal<NDIM, double> u_coarsest_vec("u_coarsest", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> f_coarsest_vec("f_coarsest", patch_hierarchy, 0, 0);
+        u_coarsest_vec.addComponent(u_cc_var, u_cc_idx, h_cc_idx);
+        f_coarsest_vec.addComponent(f_cc_var, f_cc_idx, h_cc_idx);
+
+        SAMRAIVectorReal<NDIM, double> x_vec("x", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> b_vec("b", patch_hierarchy, 0, finest_ln);
+        x_vec.addComponent(u_sc_var, u_sc_idx, h_sc_idx);
+        x_vec.addComponent(p_cc_var, p_cc_idx, h_cc_idx);
+        b_vec.addComponent(f_sc_var, f_sc_idx, h_sc_idx);
+        b_vec.addComponent(g_cc_var, g_cc_idx, h_cc_idx);
+
+        // Setup the right-hand sides. The right-hand side of the divergence
+        // constraint is zero so that it is consistent with the pressure
+        // nullspace.
+        muParserCartGridFunction f_cc_fcn(
+            "f_cc_fcn", app_initializer->getComponentDatabase("PoissonRhs"), grid_geometry);
+        muParserCartGridFunction f_sc_fcn(
+            "f_sc_fcn", app_initializer->getComponentDatabase("StokesRhs"), grid_geometry);
+        f_cc_fcn.setDataOnPatchHierarchy(f_cc_idx, f_cc_var, patch_hierarchy, 0.0);
+        f_sc_fcn.setDataOnPatchHierarchy(f_sc_idx, f_sc_var, patch_hierarchy, 0.0);
+        u_vec.setToScalar(0.0);
+        x_vec.setToScalar(0.0);
+        b_vec.getComponentVector(1)->setToScalar(0.0);
+
+        // Setup the problem specifications and the boundary conditions.
+        const double rho = input_db->getDouble("RHO");
+        const double mu = input_db->getDouble("MU");
+        const double dt = input_db->getDouble("DT");
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCConstant(rho / dt);
+        poisson_spec.setDConstant(-mu);
+
+        LocationIndexRobinBcCoefs<NDIM> bc_coef("bc_coef", Pointer<Database>(nullptr));
+        for (int d = 0; d < NDIM; ++d)
+        {
+            bc_coef.setBoundaryValue(2 * d, 0.0);
+            bc_coef.setBoundaryValue(2 * d + 1, 0.0);
+        }
+        const std::vector<RobinBcCoefStrategy<NDIM>*> u_bc_coefs(NDIM, &bc_coef);
+        Pointer<StaggeredStokesPhysicalBoundaryHelper> bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
+        bc_helper->cacheBcCoefData(u_bc_coefs, 0.0, patch_hierarchy);
+
+        // Deallocate initialization objects.
+        app_initializer.setNull();
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        std::map<std::string, std::string> metadata;
+        benchmark_utilities::add_hierarchy_metadata(metadata, patch_hierarchy);
+
+        // Time ghost cell filling.
+        using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
+        {
+            InterpolationTransactionComponent cc_component(
+                u_cc_idx, "NONE", true, "CUBIC_COARSEN", "LINEAR", false, &bc_coef);
+            HierarchyGhostCellInterpolation cc_fill_op;
+            cc_fill_op.initializeOperatorState(cc_component, patch_hierarchy);
+            benchmark_utilities::time_region(params, "ghost_fill_cc", [&]() { cc_fill_op.fillData(0.0); });
+
+            InterpolationTransactionComponent sc_component(
+                u_sc_idx, "NONE", true, "CUBIC_COARSEN", "LINEAR", false, u_bc_coefs);
+            HierarchyGhostCellInterpolation sc_fill_op;
+            sc_fill_op.initializeOperatorState(sc_component, patch_hierarchy);
+            benchmark_utilities::time_region(params, "ghost_fill_sc", [&]() { sc_fill_op.fillData(0.0); });
+        }
+
+        // Time the application of the Stokes operator.
+        {
+            StaggeredStokesOperator stokes_op("stokes_op");
+            stokes_op.setVelocityPoissonSpecifications(poisson_spec);
+            stokes_op.setPhysicalBcCoefs(u_bc_coefs, &bc_coef);
+            stokes_op.setPhysicalBoundaryHelper(bc_helper);
+            stokes_op.initializeOperatorState(b_vec, x_vec);
+            benchmark_utilities::time_region(
+                params, "stokes_operator_apply", [&]() { stokes_op.apply(b_vec, x_vec); });
+            x_vec.setToScalar(0.0);
+        }
+
+        // Time the setup and a single V-cycle of the cell-centered Poisson FAC
+        // preconditioners and the Krylov solves that use them.
+        CCPoissonSolverManager* poisson_manager = CCPoissonSolverManager::getManager();
+        const std::string poisson_fac_types[] = { CCPoissonSolverManager::POINT_RELAXATION_FAC_PRECONDITIONER,
+                                                  CCPoissonSolverManager::BOX_RELAXATION_FAC_PRECONDITIONER };
+        const std::string poisson_fac_db_names[] = { "PointFACPreconditioner", "BoxFACPreconditioner" };
+        for (int k = 0; k < 2; ++k)
+        {
+            Pointer<Database> fac_db = input_db->getDatabase(poisson_fac_db_names[k]);
+            Pointer<PoissonSolver> fac_solver =
+                poisson_manager->allocateSolver(poisson_fac_types[k], POISSON_FAC_SOLVER_NAMES[k], fac_db, "");
+            fac_solver->setPoissonSpecifications(poisson_spec);
+            fac_solver->setPhysicalBcCoef(&bc_coef);
+            benchmark_utilities::time_region(
+                params,
+                POISSON_FAC_SETUP_REGIONS[k],
+                [&]() { fac_solver->initializeSolverState(u_vec, f_vec); },
+                [&]() { fac_solver->deallocateSolverState(); });
+            benchmark_utilities::time_region(params,
+                                             POISSON_FAC_VCYCLE_REGIONS[k],
+                                             [&]() { fac_solver->solveSystem(u_vec, f_vec); },
+                                             [&]() { u_vec.setToScalar(0.0); });
+            fac_solver->deallocateSolverState();
+
+            Pointer<PoissonSolver> krylov_solver =
+                poisson_manager->allocateSolver(CCPoissonSolverManager::PETSC_KRYLOV_SOLVER,
+                                                std::string(POISSON_FAC_SOLVER_NAMES[k]) + "_krylov",
+                                                input_db->getDatabase("PoissonKrylovSolver"),
+                                                "",
+                                                poisson_fac_types[k],
+                                                POISSON_FAC_SOLVER_NAMES[k],
+                                                fac_db,
+                                                "");
+            krylov_solver->setPoissonSpecifications(poisson_spec);
+            krylov_solver->setPhysicalBcCoef(&bc_coef);
+            krylov_solver->initializeSolverState(u_vec, f_vec);
+            benchmark_utilities::time_region(params,
+                                             POISSON_KRYLOV_REGIONS[k],
+                                             [&]() { krylov_solver->solveSystem(u_vec, f_vec); },
+                                             [&]() { u_vec.setToScalar(0.0); });
+            metadata[std::string(POISSON_KRYLOV_REGIONS[k]) + "_iterations"] =
+                std::to_string(krylov_solver->getNumIterations());
+            krylov_solver->deallocateSolverState();
+            u_vec.setToScalar(0.0);
+        }
+
+        // Time the setup and solve of the hypre solver on the coarsest level.
+        {
+            Pointer<PoissonSolver> hypre_solver =
+                poisson_manager->allocateSolver(CCPoissonSolverManager::HYPRE_LEVEL_SOLVER,
+                                                "hypre_level_solver",
+                                                input_db->getDatabase("HypreLevelSolver"),
+                                                "");
+            hypre_solver->setPoissonSpecifications(poisson_spec);
+            hypre_solver->setPhysicalBcCoef(&bc_coef);
+            benchmark_utilities::time_region(
+                params,
+                "hypre_level_solver_setup",
+                [&]() { hypre_solver->initializeSolverState(u_coarsest_vec, f_coarsest_vec); },
+                [&]() { hypre_solver->deallocateSolverState(); });
+            benchmark_utilities::time_region(params,
+                                             "hypre_level_solver_solve",
+                                             [&]() { hypre_solver->solveSystem(u_coarsest_vec, f_coarsest_vec); },
+                                             [&]() { u_coarsest_vec.setToScalar(0.0); });
+            metadata["hypre_level_solver_solve_iterations"] = std::to_string(hypre_solver->getNumIterations());
+            hypre_solver->deallocateSolverState();
+        }
+
+        // Time the setup and a single V-cycle of the staggered Stokes FAC
+        // preconditioner and the Krylov solve that uses it.
+        {
+            StaggeredStokesSolverManager* stokes_manager = StaggeredStokesSolverManager::getManager();
+            Pointer<Database> fac_db = input_db->getDatabase("StokesFACPreconditioner");
+            Pointer<StaggeredStokesSolver> fac_solver = stokes_manager->allocateSolver(
+                StaggeredStokesSolverManager::BOX_RELAXATION_FAC_PRECONDITIONER, "sc_box_fac", fac_db, "");
+            fac_solver->setVelocityPoissonSpecifications(poisson_spec);
+            fac_solver->setPhysicalBcCoefs(u_bc_coefs, &bc_coef);
+            fac_solver->setPhysicalBoundaryHelper(bc_helper);
+            fac_solver->setComponentsHaveNullspace(false, true);
+            benchmark_utilities::time_region(
+                params,
+                "sc_box_fac_setup",
+                [&]() { fac_solver->initializeSolverState(x_vec, b_vec); },
+                [&]() { fac_solver->deallocateSolverState(); });
+            benchmark_utilities::time_region(params,
+                                             "sc_box_fac_vcycle",
+                                             [&]() { fac_solver->solveSystem(x_vec, b_vec); },
+                                             [&]() { x_vec.setToScalar(0.0); });
+            fac_solver->deallocateSolverState();
+
+            Pointer<StaggeredStokesSolver> krylov_solver =
+                stokes_manager->allocateSolver(StaggeredStokesSolverManager::PETSC_KRYLOV_SOLVER,
+                                               "sc_box_fac_krylov",
+                                               input_db->getDatabase("StokesKrylovSolver"),
+                                               "",
+                                               StaggeredStokesSolverManager::BOX_RELAXATION_FAC_PRECONDITIONER,
+                                               "sc_box_fac",
+                                               fac_db,
+                                               "");
+            krylov_solver->setVelocityPoissonSpecifications(poisson_spec);
+            krylov_solver->setPhysicalBcCoefs(u_bc_coefs, &bc_coef);
+            krylov_solver->setPhysicalBoundaryHelper(bc_helper);
+            krylov_solver->setComponentsHaveNullspace(false, true);
+            krylov_solver->initializeSolverState(x_vec, b_vec);
+            benchmark_utilities::time_region(params,
+                                             "sc_box_fac_krylov_solve",
+                                             [&]() { krylov_solver->solveSystem(x_vec, b_vec); },
+                                             [&]() { x_vec.setToScalar(0.0); });
+            metadata["sc_box_fac_krylov_solve_iterations"] = std::to_string(krylov_solver->getNumIterations());
+            krylov_solver->deallocateSolverState();
+        }
+
+        // Write the timings.
+        benchmark_utilities::write_summary(params, metadata);
+
+        // Deallocate data on each level of the patch hierarchy.
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->deallocatePatchData(u_cc_idx);
+            level->deallocatePatchData(f_cc_idx);
+            level->deallocatePatchData(u_sc_idx);
+            level->deallocatePatchData(f_sc_idx);
+            level->deallocatePatchData(p_cc_idx);
+            level->deallocatePatchData(g_cc_idx);
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -1178,6 +1178,7 @@ m4_include([m4/boost.m4])
 m4_include([m4/check_builtins.m4])
 m4_include([m4/check_pragma.m4])
 m4_include([m4/configure_boost.m4])
+m4_include([m4/configure_compiled_expressions.m4])
 m4_include([m4/configure_doxygen.m4])
 m4_include([m4/configure_eigen.m4])
 m4_include([m4/configure_gsl.m4])
@@ -1186,6 +1187,7 @@ m4_include([m4/configure_hypre.m4])
 m4_include([m4/configure_libmesh.m4])
 m4_include([m4/configure_muparser.m4])
 m4_include([m4/configure_petsc.m4])
+m4_include([m4/configure_profiler_annotations.m4])
 m4_include([m4/configure_samrai.m4])
 m4_include([m4/configure_silo.m4])
 m4_include([m4/lib-ld.m4])
@@ -33,6 +33,23 @@ namespace IBTK
 /*!
  * \brief Class AppInitializer provides functionality to simplify the
  * initialization code in an application code.
+ *
+ * In ensemble runs (see IBTKInit::splitEnsembleCommunicator()), the entries of
+ * the database \p group_n of the \p Ensemble section of the input file, if
+ * present, override the corresponding entries of the input database in group
+ * \p n, e.g.,
+ *
+ * \verbatim
+ * Ensemble {
+ *    group_0 { Main { ... } IBHierarchyIntegrator { ... } }
+ *    group_1 { ... }
+ * }
+ * \endverbatim
+ *
+ * Additionally, the names of the log file and of the visualization, restart,
+ * and post-processing directories (including the restart directory given on
+ * the command line) are suffixed with \p _group_n in group \p n, so that the
+ * results of all groups are kept separately.
  */
 class AppInitializer : public SAMRAI::tbox::DescribedClass
 {
@@ -18,6 +18,8 @@
 
 #include <ibtk/PartitioningBox.h>
 
+#include <libmesh/enum_order.h>
+#include <libmesh/enum_quadrature_type.h>
 #include <libmesh/mesh_base.h>
 #include <libmesh/partitioner.h>
 #include <libmesh/system.h>
@@ -104,6 +106,63 @@ protected:
     /// Pointer, if relevant, to the libMesh mesh position system.
     const libMesh::System* const d_position_system = nullptr;
 };
+
+/*!
+ * @brief A libMesh partitioner that orders the active elements of a mesh
+ * along a Hilbert space-filling curve and cuts the curve into one contiguous
+ * piece per processor.
+ *
+ * Like BoxPartitioner, the position of each element is determined by the
+ * centroid of its nodes (optionally displaced by a position system). Unlike
+ * BoxPartitioner, each processor receives (up to the granularity of single
+ * elements) the same amount of work, where the work of an element is either
+ * one or, if setQuadratureWeights() has been called, the number of points in
+ * the corresponding quadrature rule. Each piece of the curve is assigned to
+ * the processor whose PartitioningBoxes contain the largest share of that
+ * piece so that the resulting partitioning stays as close as possible to the
+ * distribution of the Eulerian patches.
+ *
+ * @note Like BoxPartitioner, this class requires a replicated mesh.
+ */
+class SpaceFillingCurvePartitioner : public libMesh::Partitioner
+{
+public:
+    /*!
+     * Constructor.
+     *
+     * @param partitioning_boxes the boxes describing the Eulerian partitioning
+     * with which the libMesh partitioning should be aligned.
+     *
+     * @param position_system the libMesh::System object whose current
+     * solution is the position of the Mesh which will subsequently be
+     * partitioned.
+     */
+    SpaceFillingCurvePartitioner(const PartitioningBoxes& partitioning_boxes, const libMesh::System& position_system);
+
+    /*!
+     * Weight each element by the number of points of the quadrature rule of
+     * the given type and order instead of weighting all elements equally.
+     */
+    void setQuadratureWeights(libMesh::QuadratureType quad_type, libMesh::Order quad_order);
+
+    virtual std::unique_ptr<libMesh::Partitioner> clone() const override;
+
+protected:
+    /// The function used to actually do the partitioning.
+    virtual void _do_partition(libMesh::MeshBase& mesh, const unsigned int n) override;
+
+    /// The PartitioningBoxes object describing the Eulerian partitioning.
+    PartitioningBoxes d_partitioning_boxes;
+
+    /// Pointer to the libMesh mesh position system.
+    const libMesh::System* const d_position_system;
+
+    /// Whether or not elements are weighted by their number of quadrature
+    /// points, and the quadrature rule to use if so.
+    bool d_use_quadrature_weights = false;
+    libMesh::QuadratureType d_quad_type = libMesh::QGAUSS;
+    libMesh::Order d_quad_order = libMesh::FIRST;
+};
 } // namespace IBTK
 //////////////////////////////////////////////////////////////////////////////
 #endif //#ifndef included_IBTK_ibtk_boxpartitioner
@@ -88,6 +88,24 @@ public:
     void apply(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
                SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& y) override;
 
+    /*!
+     * \brief Compute z=Ax+y.
+     *
+     * The vector y is added to Ax in the same sweep over the patch data that
+     * computes Ax, so that, e.g., residuals may be computed without a separate
+     * pass over the hierarchy.
+     *
+     * \note The vectors y and z may be the same, but x and z \em cannot be the
+     * same.
+     *
+     * \param x input
+     * \param y input
+     * \param z output: z=Ax+y
+     */
+    void applyAdd(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                  SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& y,
+                  SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& z) override;
+
     /*!
      * \brief Compute hierarchy-dependent data required for computing y=Ax (and
      * y=A'x).
@@ -143,6 +161,13 @@ private:
      */
     CCLaplaceOperator& operator=(const CCLaplaceOperator& that) = delete;
 
+    /*!
+     * \brief Compute z=Ax, or z=Ax+y if y is non-null.
+     */
+    void computeAction(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                       SAMRAI::solv::SAMRAIVectorReal<NDIM, double>* y,
+                       SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& z);
+
     // Operator parameters.
     int d_ncomp = 0;
 
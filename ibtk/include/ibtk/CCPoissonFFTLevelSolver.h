@@ -0,0 +1,202 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_CCPoissonFFTLevelSolver
+#define included_IBTK_CCPoissonFFTLevelSolver
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <IBTK_config.h>
+
+#include "ibtk/LinearSolver.h"
+#include "ibtk/PeriodicHelmholtzFFT.h"
+#include "ibtk/PoissonSolver.h"
+#include "ibtk/ibtk_utilities.h"
+
+#include "Box.h"
+#include "IntVector.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace SAMRAI
+{
+namespace solv
+{
+template <int DIM, class TYPE>
+class SAMRAIVectorReal;
+} // namespace solv
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class CCPoissonFFTLevelSolver is a concrete LinearSolver for solving
+ * elliptic equations of the form \f$ \mbox{$L u$} = \mbox{$(C I + \nabla \cdot
+ * D \nabla) u$} = f \f$ on a \em single, uniform, and fully periodic
+ * SAMRAI::hier::PatchLevel using fast Fourier transforms.
+ *
+ * This solver class solves linear equations of the form \f$ (C I + \nabla \cdot
+ * D \nabla ) u = f \f$, where \f$C\f$ and \f$D\f$ are constants, and \f$u\f$
+ * and \f$f\f$ are cell-centered arrays, with the same second-order accurate
+ * discretization as the other cell-centered Poisson solvers. Because the
+ * discrete operator is diagonalized by the discrete Fourier transform, each
+ * solve is direct and costs a forward and an inverse distributed transform
+ * (see PeriodicHelmholtzFFT); there are no iterations, and the tolerance
+ * and iteration settings of the solver are ignored. If \f$C = 0\f$, the
+ * solution has zero mean. The transforms are fastest when the number of cells
+ * in each direction has only small prime factors; a prime number of cells
+ * makes the cost of the transforms in that direction quadratic.
+ *
+ * The solver requires that the patch level covers the entire physical domain,
+ * that the domain is a single box, that all directions are periodic, and that
+ * \f$C\f$ and \f$D\f$ are constant. Boundary conditions set via
+ * setPhysicalBcCoef() are ignored.
+ *
+ * When it is used as the velocity and pressure subdomain solver of the
+ * projection preconditioner of the staggered-grid Stokes solver on such a
+ * patch level, the preconditioner is an exact solver for the constant
+ * coefficient Stokes equations.
+ *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+
+ enable_logging = FALSE         // see setLoggingEnabled()
+ \endverbatim
+ */
+class CCPoissonFFTLevelSolver : public LinearSolver, public PoissonSolver
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    CCPoissonFFTLevelSolver(const std::string& object_name,
+                            SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                            const std::string& default_options_prefix);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~CCPoissonFFTLevelSolver();
+
+    /*!
+     * \brief Static function to construct a CCPoissonFFTLevelSolver.
+     */
+    static SAMRAI::tbox::Pointer<PoissonSolver> allocate_solver(const std::string& object_name,
+                                                                SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                                                                const std::string& default_options_prefix)
+    {
+        return new CCPoissonFFTLevelSolver(object_name, input_db, default_options_prefix);
+    } // allocate_solver
+
+    /*!
+     * \name Linear solver functionality.
+     */
+    //\{
+
+    /*!
+     * \brief Solve the linear system of equations \f$Ax=b\f$ for \f$x\f$.
+     *
+     * \see LinearSolver::solveSystem
+     *
+     * \return \p true
+     */
+    bool solveSystem(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                     SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b) override;
+
+    /*!
+     * \brief Compute hierarchy dependent data required for solving \f$Ax=b\f$.
+     *
+     * The communication patterns of the transforms are retained when the
+     * solver state is deallocated and are reused when the solver is next
+     * initialized on a patch level with the same patch boxes.
+     *
+     * \see LinearSolver::initializeSolverState
+     */
+    void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                               const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b) override;
+
+    /*!
+     * \brief Remove all hierarchy dependent data allocated by
+     * initializeSolverState().
+     *
+     * \see LinearSolver::deallocateSolverState
+     */
+    void deallocateSolverState() override;
+
+    //\}
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    CCPoissonFFTLevelSolver() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    CCPoissonFFTLevelSolver(const CCPoissonFFTLevelSolver& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    CCPoissonFFTLevelSolver& operator=(const CCPoissonFFTLevelSolver& that) = delete;
+
+    /*!
+     * \brief Get the constant coefficients of the problem.
+     */
+    void getCoefficients(double& C, double& D) const;
+
+    /*!
+     * \name Hierarchy configuration.
+     */
+    //\{
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
+    int d_level_num = IBTK::invalid_level_number;
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > d_level;
+    //\}
+
+    /*!
+     * \name Transforms and the level layout for which they were set up.
+     */
+    //\{
+    std::unique_ptr<PeriodicHelmholtzFFT> d_fft;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_grid_boxes;
+    std::vector<int> d_grid_owners;
+    SAMRAI::hier::IntVector<NDIM> d_grid_ratio = 0;
+    //\}
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_CCPoissonFFTLevelSolver
@@ -98,6 +98,7 @@ namespace IBTK
  rel_residual_tol = 1.0e-5      // see setRelativeTolerance()
  initial_guess_nonzero = FALSE  // see setInitialGuessNonzero()
  rel_change = 0                 // see hypre User's Manual
+ reuse_hypre_setup = FALSE      // see below
  num_pre_relax_steps = 1        // number of pre-sweeps (only used by SMG or PFMG solver or
  preconditioner)
  num_post_relax_steps = 1       // number of post-sweeps (only used by SMG or PFMG solver or
@@ -113,6 +114,13 @@ namespace IBTK
  two_norm = 1                   // see hypre User's Manual (only used by PCG solver)
  \endverbatim
  *
+ * If reuse_hypre_setup is enabled, the hypre data structures are retained when
+ * the solver state is deallocated.  When the solver is next initialized on a
+ * patch level with the same patch boxes, the hypre grid and matrices are
+ * reused.  If the matrix coefficients are also unchanged, the hypre solver
+ * setup is reused as well; otherwise, the matrix coefficients are updated in
+ * place and only the hypre solver is set up again.
+ *
  * \em hypre is developed in the Center for Applied Scientific Computing (CASC)
  * at Lawrence Livermore National Laboratory (LLNL).  For more information about
  * \em hypre, see <A
@@ -277,6 +285,7 @@ private:
     void allocateHypreData();
     void setMatrixCoefficients_aligned();
     void setMatrixCoefficients_nonaligned();
+    void copyMatrixCoefficientsToHypre();
     void setupHypreSolver();
     bool solveSystem(int x_idx, int b_idx);
     void copyToHypre(const std::vector<HYPRE_StructVector>& vectors,
@@ -317,6 +326,16 @@ private:
     std::vector<HYPRE_StructSolver> d_solvers, d_preconds;
     std::vector<SAMRAI::hier::Index<NDIM> > d_stencil_offsets;
 
+    /*
+     * Data used to determine whether the hypre setup may be reused: the patch
+     * boxes and refinement ratio of the level on which the hypre grid was
+     * built, and the matrix coefficients for each data depth.
+     */
+    bool d_reuse_hypre_setup = false;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_grid_boxes;
+    SAMRAI::hier::IntVector<NDIM> d_grid_ratio = 0;
+    std::vector<std::vector<double> > d_matrix_vals;
+
     std::string d_solver_type = "PFMG", d_precond_type = "none";
     int d_rel_change = 0;
     int d_num_pre_relax_steps = 1, d_num_post_relax_steps = 1;
@@ -85,6 +85,8 @@ namespace IBTK
  * values): \verbatim
 
  smoother_type = "PATCH_GAUSS_SEIDEL"         // see setSmootherType()
+ chebyshev_lower_bound = 0.5                  // see setSmootherType()
+ chebyshev_upper_bound = 2.0                  // see setSmootherType()
  prolongation_method = "LINEAR_REFINE"        // see setProlongationMethod()
  restriction_method = "CONSERVATIVE_COARSEN"  // see setRestrictionMethod()
  coarse_solver_type = "HYPRE_LEVEL_SOLVER"    // see setCoarseSolverType()
@@ -139,6 +141,14 @@ public:
      * - \c "PATCH_GAUSS_SEIDEL"
      * - \c "PROCESSOR_GAUSS_SEIDEL"
      * - \c "RED_BLACK_GAUSS_SEIDEL"
+     * - \c "CHEBYSHEV"
+     *
+     * The \c "CHEBYSHEV" smoother applies a Chebyshev polynomial in the
+     * Jacobi-preconditioned operator that damps the error components whose
+     * eigenvalues lie in the interval [chebyshev_lower_bound,
+     * chebyshev_upper_bound].  It requires no coloring of the grid and only
+     * one ghost cell fill per sweep.  By Gershgorin's theorem, the eigenvalues
+     * of the preconditioned operator are bounded above by 2.
      */
     void setSmootherType(const std::string& smoother_type) override;
 
@@ -252,6 +262,12 @@ private:
     SAMRAI::tbox::Pointer<PoissonSolver> d_coarse_solver;
     SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> d_coarse_solver_db;
 
+    /*
+     * Bounds of the interval of eigenvalues of the Jacobi-preconditioned
+     * operator that are damped by the Chebyshev smoother.
+     */
+    double d_chebyshev_lower_bound = 0.5, d_chebyshev_upper_bound = 2.0;
+
     /*
      * Patch overlap data.
      */
@@ -27,6 +27,7 @@
 #include "tbox/Pointer.h"
 
 #include <set>
+#include <utility>
 #include <vector>
 
 namespace SAMRAI
@@ -260,6 +261,13 @@ private:
     std::vector<SAMRAI::hier::CoarseFineBoundary<NDIM> > d_cf_boundary;
     std::vector<SAMRAI::hier::BoxArray<NDIM> > d_domain_boxes;
     std::vector<SAMRAI::hier::IntVector<NDIM> > d_periodic_shift;
+
+    /*!
+     * Cached co-dimension 1 coarse-fine boundary fill boxes and the location
+     * indices of the corresponding boundary boxes, indexed by level number and
+     * patch number.  These are recomputed whenever the patch hierarchy is reset.
+     */
+    std::vector<std::vector<std::vector<std::pair<SAMRAI::hier::Box<NDIM>, unsigned int> > > > d_cf_bdry_fill_boxes;
 };
 } // namespace IBTK
 
@@ -106,6 +106,34 @@ public:
                                 SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level =
                                     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> >(NULL)) = 0;
 
+    /*!
+     * \brief Indicates whether the concrete CartGridFunction object implements
+     * addDataOnPatch().
+     *
+     * Functions that return true must be evaluable one patch at a time, i.e.,
+     * setDataOnPatchHierarchy() and setDataOnPatchLevel() must be equivalent to
+     * calling setDataOnPatch() on each patch. This allows CartGridFunctionSet
+     * to sum such functions in a single traversal of the patches without
+     * scratch data.
+     *
+     * The default implementation returns false.
+     */
+    virtual bool supportsAddDataOnPatch() const;
+
+    /*!
+     * \brief Add the values of the function to the data on the patch interior.
+     *
+     * The default implementation reports an error; it must be overridden by
+     * functions for which supportsAddDataOnPatch() returns true.
+     */
+    virtual void addDataOnPatch(int data_idx,
+                                SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > var,
+                                SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                double data_time,
+                                bool initial_time = false,
+                                SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level =
+                                    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> >(NULL));
+
     //\}
 
 protected:
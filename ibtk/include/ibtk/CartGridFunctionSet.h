@@ -45,6 +45,11 @@ namespace IBTK
 /*!
  * \brief Class CartGridFunctionSet is a concrete CartGridFunction that is used
  * to allow multiple CartGridFunction objects to act as a single function.
+ *
+ * Component functions that implement CartGridFunction::addDataOnPatch() are
+ * evaluated together in a single traversal of the patches, writing directly
+ * into the destination data. Each of the other component functions is
+ * evaluated separately and summed by way of scratch data.
  */
 class CartGridFunctionSet : public CartGridFunction
 {
@@ -114,6 +119,24 @@ public:
                         SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level =
                             SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> >(NULL)) override;
 
+    /*!
+     * \brief Indicates whether all of the component function objects implement
+     * addDataOnPatch().
+     */
+    bool supportsAddDataOnPatch() const override;
+
+    /*!
+     * \brief Add the values of all of the component functions to the data on
+     * the patch interior.
+     */
+    void addDataOnPatch(int data_idx,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > var,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                        double data_time,
+                        bool initial_time = false,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level =
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> >(NULL)) override;
+
     //\}
 
 protected:
@@ -142,6 +165,27 @@ private:
      * \return A reference to this object.
      */
     CartGridFunctionSet& operator=(const CartGridFunctionSet& that) = delete;
+
+    /*!
+     * \brief Split the component functions into those that must be evaluated
+     * with the setDataOnPatch*() methods and those that implement
+     * addDataOnPatch().
+     */
+    void splitFunctions(std::vector<SAMRAI::tbox::Pointer<CartGridFunction> >& set_fcns,
+                        std::vector<SAMRAI::tbox::Pointer<CartGridFunction> >& add_fcns) const;
+
+    /*!
+     * \brief Add the values of the given functions to the data on the given
+     * level in a single traversal of its patches. If overwrite is true, the
+     * first function sets the data instead.
+     */
+    void addDataOnPatchLevel(int data_idx,
+                             SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > var,
+                             SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+                             double data_time,
+                             bool initial_time,
+                             const std::vector<SAMRAI::tbox::Pointer<CartGridFunction> >& add_fcns,
+                             bool overwrite);
 };
 } // namespace IBTK
 
@@ -29,6 +29,7 @@
 #include "tbox/Pointer.h"
 
 #include <set>
+#include <utility>
 #include <vector>
 
 namespace SAMRAI
@@ -241,6 +242,13 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, int> > d_sc_indicator_var =
         new SAMRAI::pdat::SideVariable<NDIM, int>("CartSideDoubleQuadraticCFInterpolation::sc_indicator_var");
     int d_sc_indicator_idx = IBTK::invalid_index;
+
+    /*!
+     * Cached co-dimension 1 coarse-fine boundary fill boxes and the location
+     * indices of the corresponding boundary boxes, indexed by level number and
+     * patch number.  These are recomputed whenever the patch hierarchy is reset.
+     */
+    std::vector<std::vector<std::vector<std::pair<SAMRAI::hier::Box<NDIM>, unsigned int> > > > d_cf_bdry_fill_boxes;
 };
 } // namespace IBTK
 
@@ -16,6 +16,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "Box.h"
 #include "IntVector.h"
 #include "PatchData.h"
 #include "PatchLevel.h"
@@ -42,6 +43,14 @@ namespace IBTK
  * \brief Class CopyToRootSchedule is used to communicate distributed patch data
  * to a unified patch data object on a root MPI process.
  *
+ * By default the data on the entire (single-box) physical domain are copied.
+ * Diagnostics that require only part of the data, e.g., a slice or a line
+ * probe through the domain, should instead specify the region of index space
+ * to copy.  In that case the root patch data are allocated only on that region
+ * and only the processes that own patches that touch the region send data, so
+ * that the cost of the copy scales with the size of the region rather than
+ * with the size of the grid.
+ *
  * \note This class is designed to be used with uniform grid data only.
  */
 class CopyToRootSchedule
@@ -61,6 +70,17 @@ public:
                        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
                        std::vector<int> src_patch_data_idxs);
 
+    /*!
+     * \brief Constructor that copies only the data in the specified region of
+     * index space to the root process.
+     *
+     * \note \a root_box must be the same on all processes.
+     */
+    CopyToRootSchedule(int root_proc,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
+                       std::vector<int> src_patch_data_idxs,
+                       const SAMRAI::hier::Box<NDIM>& root_box);
+
     /*!
      * \brief Destructor
      */
@@ -111,6 +131,8 @@ private:
     const int d_root_proc;
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > d_patch_level;
     const std::vector<int> d_src_patch_data_idxs;
+    const bool d_use_root_box;
+    const SAMRAI::hier::Box<NDIM> d_root_box;
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> > > d_root_patch_data;
     SAMRAI::tbox::Schedule d_schedule;
 };
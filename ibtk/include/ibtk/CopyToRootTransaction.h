@@ -16,6 +16,9 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "Box.h"
+#include "BoxGeometry.h"
+#include "BoxOverlap.h"
 #include "IntVector.h"
 #include "PatchData.h"
 #include "PatchLevel.h"
@@ -56,6 +59,19 @@ public:
                           int src_patch_data_idx,
                           SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> > dst_patch_data);
 
+    /*!
+     * \brief Constructor that copies only the data in the specified region of
+     * index space (e.g., a slice or a line of cells through the domain).
+     *
+     * \note \a dst_box must be the same on the source and destination processes.
+     */
+    CopyToRootTransaction(int src_proc,
+                          int dst_proc,
+                          SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
+                          int src_patch_data_idx,
+                          SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> > dst_patch_data,
+                          const SAMRAI::hier::Box<NDIM>& dst_box);
+
     /*!
      * \brief Destructor
      */
@@ -142,10 +158,18 @@ private:
      */
     CopyToRootTransaction& operator=(const CopyToRootTransaction& that) = delete;
 
+    /*!
+     * \brief Compute the overlap between the destination box and the data on
+     * the source patch with the given box.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::BoxOverlap<NDIM> > computeOverlap(const SAMRAI::hier::Box<NDIM>& src_box) const;
+
     const int d_src_proc, d_dst_proc;
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > d_patch_level;
     const int d_src_patch_data_idx;
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> > d_dst_patch_data;
+    const SAMRAI::hier::Box<NDIM> d_dst_box;
+    SAMRAI::tbox::Pointer<SAMRAI::hier::BoxGeometry<NDIM> > d_dst_box_geometry;
 };
 } // namespace IBTK
 
@@ -0,0 +1,351 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_DiagnosticsCollector
+#define included_IBTK_DiagnosticsCollector
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/IBTK_MPI.h"
+
+#include "tbox/Utilities.h"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class DiagnosticsCollector accumulates named scalar quantities (e.g.,
+ * norms, CFL numbers, or volumes) that are computed from local contributions
+ * on each process and determines their global values with a single global
+ * reduction.
+ *
+ * Contributions are queued via addContribution().  Multiple contributions with
+ * the same name are combined locally.  The global values of all queued
+ * quantities are then computed by one non-blocking reduction that is started
+ * by startReduction() and completed by finishReduction(), so that other work
+ * may be performed while the reduction is in progress.  Once the reduction
+ * has completed, the callback functions that were provided along with the
+ * contributions are called with the reduced values, and the values remain
+ * available via getValue() until the next reduction completes.
+ *
+ * Sums, maxima, and minima may be mixed freely: each quantity is reduced with
+ * its own reduction type by a single user-defined MPI reduction operation.
+ *
+ * Callers that do not explicitly reduce the queued contributions (e.g.,
+ * integrators that are not driven by HierarchyIntegrator::advanceHierarchy())
+ * may call flush() before reading any value that is set by a callback
+ * function.  hasValue() and getValue() flush automatically.
+ *
+ * \note All processes must queue contributions to the same quantities in the
+ * same order between reductions.
+ */
+class DiagnosticsCollector
+{
+public:
+    /*!
+     * \brief The operation used to combine contributions to a quantity.
+     */
+    enum ReductionType
+    {
+        SUM = 0,
+        MAX = 1,
+        MIN = 2
+    };
+
+    /*!
+     * \brief Type of the functions that are called with the reduced values.
+     */
+    using CallbackFcn = std::function<void(double)>;
+
+    /*!
+     * \brief Default constructor.
+     */
+    DiagnosticsCollector() = default;
+
+    /*!
+     * \brief Destructor.
+     */
+    inline ~DiagnosticsCollector()
+    {
+        if (d_request != MPI_REQUEST_NULL) MPI_Wait(&d_request, MPI_STATUS_IGNORE);
+        return;
+    } // ~DiagnosticsCollector
+
+    /*!
+     * \brief Queue the local contribution to the named quantity.
+     *
+     * \param name      The name of the quantity.
+     * \param value     The local contribution.
+     * \param type      The operation used to combine contributions.
+     * \param callback  An optional function that is called with the reduced
+     *                  value once the reduction has completed.
+     */
+    inline void addContribution(const std::string& name,
+                                const double value,
+                                const ReductionType type,
+                                const CallbackFcn& callback = CallbackFcn())
+    {
+        auto it = d_entry_map.find(name);
+        if (it == d_entry_map.end())
+        {
+            it = d_entry_map.insert(std::make_pair(name, d_entries.size())).first;
+            d_entries.push_back(Entry{ name, type, value, {} });
+        }
+        else
+        {
+            Entry& entry = d_entries[it->second];
+            if (entry.type != type)
+            {
+                TBOX_ERROR("DiagnosticsCollector::addContribution():\n"
+                           << "  contributions to quantity " << name << " use different reduction types\n");
+            }
+            entry.value = combine(type, entry.value, value);
+        }
+        if (callback) d_entries[it->second].callbacks.push_back(callback);
+        return;
+    } // addContribution
+
+    /*!
+     * \brief Start the global reduction of all queued contributions.
+     *
+     * Contributions that are queued after this call are included in the next
+     * reduction.
+     */
+    inline void startReduction()
+    {
+        if (d_request != MPI_REQUEST_NULL)
+        {
+            TBOX_ERROR("DiagnosticsCollector::startReduction():\n"
+                       << "  a reduction is already in progress\n");
+        }
+        d_reduction_entries.swap(d_entries);
+        d_entries.clear();
+        d_entry_map.clear();
+        if (d_reduction_entries.empty()) return;
+        d_buffer.resize(2 * d_reduction_entries.size());
+        for (unsigned int k = 0; k < d_reduction_entries.size(); ++k)
+        {
+            d_buffer[2 * k] = static_cast<double>(d_reduction_entries[k].type);
+            d_buffer[2 * k + 1] = d_reduction_entries[k].value;
+        }
+        const MPIReduction& reduction = getMPIReduction();
+        MPI_Iallreduce(MPI_IN_PLACE,
+                       d_buffer.data(),
+                       static_cast<int>(d_reduction_entries.size()),
+                       reduction.type,
+                       reduction.op,
+                       IBTK_MPI::getCommunicator(),
+                       &d_request);
+        return;
+    } // startReduction
+
+    /*!
+     * \brief Complete the global reduction, record the reduced values, and
+     * call the callback functions in the order in which the contributions were
+     * queued.
+     *
+     * This method does nothing if no reduction has been started.
+     */
+    inline void finishReduction()
+    {
+        if (d_reduction_entries.empty()) return;
+        if (d_request != MPI_REQUEST_NULL) MPI_Wait(&d_request, MPI_STATUS_IGNORE);
+        d_values.clear();
+        std::vector<Entry> entries;
+        entries.swap(d_reduction_entries);
+        for (unsigned int k = 0; k < entries.size(); ++k)
+        {
+            d_values[entries[k].name] = d_buffer[2 * k + 1];
+        }
+        for (unsigned int k = 0; k < entries.size(); ++k)
+        {
+            for (const auto& callback : entries[k].callbacks) callback(d_buffer[2 * k + 1]);
+        }
+        return;
+    } // finishReduction
+
+    /*!
+     * \brief Start and complete the global reduction of all queued
+     * contributions.
+     */
+    inline void reduce()
+    {
+        startReduction();
+        finishReduction();
+        return;
+    } // reduce
+
+    /*!
+     * \brief Complete the reduction that is in progress, if any, and then
+     * reduce all contributions that are still queued.
+     *
+     * This is a collective operation.
+     */
+    inline void flush()
+    {
+        finishReduction();
+        if (!d_entries.empty()) reduce();
+        return;
+    } // flush
+
+    /*!
+     * \brief Return whether the most recent reduction included the named
+     * quantity.
+     *
+     * Pending contributions are reduced first (see flush()).
+     */
+    inline bool hasValue(const std::string& name)
+    {
+        flush();
+        return d_values.find(name) != d_values.end();
+    } // hasValue
+
+    /*!
+     * \brief Return the value of the named quantity determined by the most
+     * recent reduction.
+     *
+     * Pending contributions are reduced first (see flush()).
+     */
+    inline double getValue(const std::string& name)
+    {
+        flush();
+        const auto it = d_values.find(name);
+        if (it == d_values.end())
+        {
+            TBOX_ERROR("DiagnosticsCollector::getValue():\n"
+                       << "  quantity " << name << " was not included in the most recent reduction\n");
+        }
+        return it->second;
+    } // getValue
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    DiagnosticsCollector(const DiagnosticsCollector& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    DiagnosticsCollector& operator=(const DiagnosticsCollector& that) = delete;
+
+    /*!
+     * \brief A queued quantity.
+     */
+    struct Entry
+    {
+        std::string name;
+        ReductionType type;
+        double value;
+        std::vector<CallbackFcn> callbacks;
+    };
+
+    /*!
+     * \brief The MPI datatype and reduction operation used to reduce the
+     * (reduction type, value) pairs that represent the queued quantities.
+     */
+    struct MPIReduction
+    {
+        MPIReduction()
+        {
+            MPI_Type_contiguous(2, MPI_DOUBLE, &type);
+            MPI_Type_commit(&type);
+            MPI_Op_create(&DiagnosticsCollector::reduce_entries, /*commute*/ 1, &op);
+        }
+
+        ~MPIReduction()
+        {
+            int finalized = 0;
+            MPI_Finalized(&finalized);
+            if (finalized) return;
+            MPI_Op_free(&op);
+            MPI_Type_free(&type);
+        }
+
+        MPI_Datatype type;
+        MPI_Op op;
+    };
+
+    /*!
+     * \brief Return the MPI datatype and reduction operation, which are
+     * created when they are first needed.
+     */
+    static inline const MPIReduction& getMPIReduction()
+    {
+        static const MPIReduction reduction;
+        return reduction;
+    } // getMPIReduction
+
+    /*!
+     * \brief Combine two values with the specified reduction type.
+     */
+    static inline double combine(const ReductionType type, const double a, const double b)
+    {
+        switch (type)
+        {
+        case SUM:
+            return a + b;
+        case MAX:
+            return std::max(a, b);
+        case MIN:
+            return std::min(a, b);
+        }
+        return a;
+    } // combine
+
+    /*!
+     * \brief The user-defined MPI reduction operation.
+     */
+    static void reduce_entries(void* in, void* inout, int* len, MPI_Datatype* /*datatype*/)
+    {
+        const double* const in_data = static_cast<const double*>(in);
+        double* const inout_data = static_cast<double*>(inout);
+        for (int k = 0; k < *len; ++k)
+        {
+            const auto type = static_cast<ReductionType>(static_cast<int>(in_data[2 * k]));
+            inout_data[2 * k + 1] = combine(type, in_data[2 * k + 1], inout_data[2 * k + 1]);
+        }
+        return;
+    } // reduce_entries
+
+    std::vector<Entry> d_entries, d_reduction_entries;
+    std::map<std::string, std::size_t> d_entry_map;
+    std::vector<double> d_buffer;
+    std::map<std::string, double> d_values;
+    MPI_Request d_request = MPI_REQUEST_NULL;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_DiagnosticsCollector
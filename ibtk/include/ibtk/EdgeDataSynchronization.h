@@ -26,7 +26,6 @@
 #include "tbox/DescribedClass.h"
 #include "tbox/Pointer.h"
 
-#include <array>
 #include <string>
 #include <vector>
 
@@ -198,8 +197,10 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenAlgorithm<NDIM> > d_coarsen_alg;
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > > d_coarsen_scheds;
 
-    std::array<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> >, NDIM> d_refine_alg;
-    std::array<std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >, NDIM> d_refine_scheds;
+    // The refine algorithms depend on the boxes of each level, so there is one
+    // algorithm and one schedule per level that synchronizes all axes.
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > > d_refine_algs;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_refine_scheds;
 };
 } // namespace IBTK
 
@@ -65,6 +65,18 @@ public:
      */
     virtual void setHomogeneousBc(bool homogeneous_bc);
 
+    /*!
+     * \brief Return whether the boundary condition coefficients may depend on
+     * time or on the values of any patch data.
+     *
+     * Subclasses whose coefficients depend only on the geometry of the patch,
+     * the target data index, and whether homogeneous boundary conditions are
+     * set may return false, which allows the coefficients to be cached.
+     *
+     * \note A default implementation is provided that returns true.
+     */
+    virtual bool isTimeDependent() const;
+
     //\}
 
 protected:
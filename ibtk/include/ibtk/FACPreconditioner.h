@@ -65,7 +65,19 @@ namespace IBTK
  num_post_sweeps = 2     // see setNumPostSmoothingSweeps()
  enable_logging = FALSE  // see setLoggingEnabled()
  \endverbatim
-*/
+ *
+ * In addition to the multiplicative cycles (V, W, F, and FMG), the cycle type
+ * ADDITIVE_CYCLE selects an additive multilevel (BPX-style) preconditioner: the
+ * right-hand side is first restricted to all coarser levels, the corrections
+ * on all levels are then computed independently from these residuals (by
+ * num_pre_sweeps + num_post_sweeps smoothing sweeps on each level except the
+ * coarsest, and by the coarse-level solver on the coarsest level), and the
+ * corrections are finally prolonged and summed from the coarsest to the finest
+ * level.  Because no level waits for the correction of another level, the
+ * work on the coarse levels does not serialize the cycle.  Additive
+ * preconditioners are generally not convergent as stationary iterations and
+ * should only be used as preconditioners for Krylov methods.
+ */
 class FACPreconditioner : public LinearSolver
 {
 public:
@@ -277,6 +289,9 @@ protected:
                   int level_num,
                   int mu);
 
+    void additiveCycle(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& u,
+                       SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& f);
+
     SAMRAI::tbox::Pointer<FACPreconditionerStrategy> d_fac_strategy;
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
     int d_coarsest_ln = 0;
@@ -284,6 +299,7 @@ protected:
     MGCycleType d_cycle_type = V_CYCLE;
     int d_num_pre_sweeps = 0, d_num_post_sweeps = 2;
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_f, d_r;
+    bool d_reinitializing_solver = false;
 
 private:
     /*!
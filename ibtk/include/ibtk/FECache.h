@@ -194,6 +194,13 @@ public:
      */
     libMesh::FEType getFEType() const;
 
+    /**
+     * Return whether or not operator() reinitializes the cached FE objects for
+     * every element. In that case operator() modifies shared FE objects and
+     * must not be called concurrently from multiple threads.
+     */
+    bool reinitializesOnEveryElement() const;
+
 protected:
     /**
      * Dimension of the FE mesh.
@@ -239,6 +246,19 @@ FECache::getFEType() const
     return d_fe_type;
 }
 
+inline bool
+FECache::reinitializesOnEveryElement() const
+{
+    // TODO: we need better reinitialization logic than hardcoding in
+    // libMesh element types.
+    //
+    // Subdivision elements have a variable number of degrees of freedom
+    // per cell (and the values at quadrature points depend on both the
+    // current and neighbor element geometries) so these values must
+    // always be recomputed.
+    return (d_update_flags & FEUpdateFlags::update_dphi) || d_fe_type.family == libMesh::FEFamily::SUBDIVISION;
+}
+
 inline FECache::value_type&
 FECache::operator()(const FECache::key_type& quad_key, const libMesh::Elem* elem)
 {
@@ -262,15 +282,7 @@ FECache::operator()(const FECache::key_type& quad_key, const libMesh::Elem* elem
     else
     {
         libMesh::FEBase& fe = *(it->second);
-        // TODO: we need better reinitialization logic than hardcoding in
-        // libMesh element types.
-        //
-        // Subdivision elements have a variable number of degrees of freedom
-        // per cell (and the values at quadrature points depend on both the
-        // current and neighbor element geometries) so these values must
-        // always be recomputed.
-        if (d_update_flags & FEUpdateFlags::update_dphi || d_fe_type.family == libMesh::FEFamily::SUBDIVISION)
-            fe.reinit(elem);
+        if (reinitializesOnEveryElement()) fe.reinit(elem);
         return fe;
     }
 }
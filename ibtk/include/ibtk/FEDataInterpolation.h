@@ -19,6 +19,7 @@
 #include <IBTK_config.h>
 
 #include "ibtk/FEDataManager.h"
+#include "ibtk/FEValues.h"
 #include "ibtk/ibtk_macros.h"
 #include "ibtk/libmesh_utilities.h"
 
@@ -72,6 +73,8 @@ public:
 
     inline void attachQuadratureRule(libMesh::QBase* qrule)
     {
+        // The IBTK::FEValues objects are set up in init() with the quadrature rule that is attached at that time.
+        TBOX_ASSERT(!d_initialized || qrule == d_qrule);
         d_qrule = qrule;
         for (auto& fe : d_fe)
         {
@@ -283,6 +286,15 @@ public:
     /*!
      * \brief Reinitialize the FE shape functions, quadrature rules, etc. for the specified element.
      *
+     * When a quadrature rule has been attached, the element data for isoparametric Lagrange FETypes on TRI3, TRI6,
+     * QUAD4, QUAD9, TET4, TET10, HEX8, and HEX27 elements are computed by IBTK::FEValues rather than by
+     * libMesh::FEBase.  In that case, the element data cannot be evaluated at arbitrary \a points, and fields on
+     * QUAD and HEX elements with tensor-product quadrature rules are interpolated by sum factorization.
+     *
+     * If the associated FEData object stores reference configuration quadrature data (see
+     * FEData::setUseReferenceQuadratureCache()) and no points are provided, then the element data are computed only
+     * the first time this function is called for a given element and are copied from the cache afterwards.
+     *
      * NOTE: Nodal values are set by calling collectDataForInterpolation().
      */
     void reinit(const libMesh::Elem* elem,
@@ -331,11 +343,18 @@ private:
 
     size_t getFETypeIndex(const libMesh::FEType& fe_type) const;
 
+    void reinitInterior(const libMesh::Elem* elem);
+
+    void collectReferenceElemData(FEData::ReferenceElemQuadratureData& elem_data) const;
+
+    void setReferenceElemDataPointers(const FEData::ReferenceElemQuadratureData& elem_data);
+
     void
     interpolateCommon(std::vector<std::vector<std::vector<double> > >& system_var_data,
                       std::vector<std::vector<std::vector<libMesh::VectorValue<double> > > >& system_grad_var_data,
                       const std::vector<const std::vector<std::vector<double> >*>& phi_data,
-                      const std::vector<const std::vector<std::vector<libMesh::VectorValue<double> > >*>& dphi_data);
+                      const std::vector<const std::vector<std::vector<libMesh::VectorValue<double> > >*>& dphi_data,
+                      bool use_tensor_product);
 
     const unsigned int d_dim;
     std::shared_ptr<FEData> d_fe_data;
@@ -363,10 +382,22 @@ private:
     // Data associated with FETypes.
     std::vector<libMesh::FEType> d_fe_types;
     std::vector<std::unique_ptr<libMesh::FEBase> > d_fe, d_fe_face;
+    std::vector<std::unique_ptr<FEValuesBase> > d_ibtk_fe;
+    bool d_ibtk_fe_reinitialized = false;
+    std::vector<double> d_tensor_product_values;
+    std::vector<libMesh::VectorValue<double> > d_tensor_product_gradients;
     std::vector<bool> d_eval_phi, d_eval_dphi;
     std::vector<const std::vector<std::vector<double> >*> d_phi, d_phi_face;
     std::vector<const std::vector<std::vector<libMesh::VectorValue<double> > >*> d_dphi, d_dphi_face;
 
+    // Data associated with the reference configuration quadrature cache.
+    FEData::ReferenceQuadratureCache* d_reference_quadrature_cache = nullptr;
+    const std::vector<libMesh::Point>* d_fe_q_point = nullptr;
+    const std::vector<double>* d_fe_JxW = nullptr;
+    std::vector<const std::vector<std::vector<double> >*> d_fe_phi;
+    std::vector<const std::vector<std::vector<libMesh::VectorValue<double> > >*> d_fe_dphi;
+    FEData::ReferenceElemQuadratureData d_reference_elem_data; // only used when the cache is bypassed
+
     // Data associated with the current element.
     const libMesh::Elem* d_current_elem = nullptr;
     unsigned int d_current_side = std::numeric_limits<unsigned int>::max();
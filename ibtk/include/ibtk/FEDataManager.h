@@ -20,8 +20,10 @@
 #include "ibtk/SAMRAIDataCache.h"
 #include "ibtk/ibtk_macros.h"
 #include "ibtk/ibtk_utilities.h"
+#include "ibtk/libmesh_utilities.h"
 
 #include "BasePatchLevel.h"
+#include "Box.h"
 #include "CellVariable.h"
 #include "IntVector.h"
 #include "LoadBalancer.h"
@@ -38,20 +40,24 @@
 #include "libmesh/enum_order.h"
 #include "libmesh/enum_quadrature_type.h"
 #include "libmesh/equation_systems.h"
+#include "libmesh/fe_type.h"
 #include "libmesh/linear_solver.h"
 #include "libmesh/numeric_vector.h"
 #include "libmesh/petsc_vector.h"
 #include "libmesh/quadrature.h"
 #include "libmesh/sparse_matrix.h"
 #include "libmesh/system.h"
+#include "libmesh/vector_value.h"
 
 IBTK_DISABLE_EXTRA_WARNINGS
 #include <boost/multi_array.hpp>
 IBTK_ENABLE_EXTRA_WARNINGS
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -141,11 +147,51 @@ public:
             return elem_dof_indices;
         }
 
+        /*!
+         * Return the number of bytes used to store the cached dof indices.
+         */
+        inline std::size_t getMemoryUsage() const
+        {
+            std::size_t bytes = 0;
+            for (const auto& elem_dof_indices : d_dof_cache)
+            {
+                for (const auto& var_dof_indices : elem_dof_indices.second)
+                {
+                    bytes += var_dof_indices.size() * sizeof(unsigned int);
+                }
+            }
+            return bytes;
+        }
+
     private:
         libMesh::DofMap& d_dof_map;
         std::unordered_map<libMesh::dof_id_type, std::vector<std::vector<unsigned int> > > d_dof_cache;
     };
 
+    /*!
+     * Quadrature points, JxW values, and shape function values and gradients
+     * computed on a single element of the (fixed) reference configuration.
+     * The shape function data are indexed by the position of the FEType in
+     * the vector of FETypes used to look up the cache.
+     */
+    struct ReferenceElemQuadratureData
+    {
+        std::vector<libMesh::Point> q_point;
+        std::vector<double> JxW;
+        std::vector<std::vector<std::vector<double> > > phi;
+        std::vector<std::vector<std::vector<libMesh::VectorValue<double> > > > dphi;
+    };
+
+    /*!
+     * Mapping between element ids and the reference configuration quadrature
+     * data computed on those elements.
+     *
+     * @note Unlike SystemDofMapCache, the contents of this cache depend only
+     * on the reference configuration of the mesh and are therefore not
+     * invalidated when we regrid.
+     */
+    using ReferenceQuadratureCache = std::unordered_map<libMesh::dof_id_type, ReferenceElemQuadratureData>;
+
     /*!
      * Constructor. Registers the object with the restart database: i.e.,
      * inheriting classes should not also register themselves.
@@ -200,6 +246,40 @@ public:
      */
     void clearPatchHierarchyDependentData();
 
+    /*!
+     * \brief Set whether or not the reference configuration quadrature data
+     * (quadrature points, JxW values, and shape functions and their
+     * gradients) should be stored and reused by FEDataInterpolation objects
+     * that use this FEData object.
+     *
+     * This trades memory (proportional to the number of local elements times
+     * the number of quadrature points times the number of basis functions)
+     * for not having to recompute the element mappings at every time step.
+     * The cache is disabled by default.
+     */
+    void setUseReferenceQuadratureCache(bool use_cache);
+
+    /*!
+     * \return Whether or not the reference configuration quadrature data
+     * should be stored and reused.
+     */
+    bool getUseReferenceQuadratureCache() const;
+
+    /*!
+     * \return The cache of reference configuration quadrature data computed
+     * with the given quadrature rule and collection of FETypes, or nullptr if
+     * caching is disabled.
+     */
+    ReferenceQuadratureCache* getReferenceQuadratureCache(libMesh::QuadratureType quad_type,
+                                                          libMesh::Order quad_order,
+                                                          const std::vector<libMesh::FEType>& fe_types);
+
+    /*!
+     * Clear all stored reference configuration quadrature data. This should
+     * be called if the reference configuration of the mesh is modified.
+     */
+    void clearReferenceQuadratureCache();
+
 protected:
     /*!
      * The object name is used as a handle to databases stored in restart files
@@ -239,6 +319,25 @@ protected:
      */
     std::map<unsigned int, std::unique_ptr<SystemDofMapCache> > d_system_dof_map_cache;
 
+    /*!
+     * Whether or not to store reference configuration quadrature data.
+     */
+    bool d_use_reference_quadrature_cache = false;
+
+    /*!
+     * Mapping between quadrature rules and FETypes and the corresponding
+     * ReferenceQuadratureCache objects.
+     */
+    std::map<std::tuple<libMesh::QuadratureType, libMesh::Order, std::vector<libMesh::FEType> >,
+             ReferenceQuadratureCache>
+        d_reference_quadrature_caches;
+
+    /*!
+     * Identifiers of the reporters registered with MemoryMonitor for the
+     * libMesh system vectors and the cached data.
+     */
+    int d_system_vectors_memory_reporter_id = -1, d_caches_memory_reporter_id = -1;
+
     /**
      * Permit FEDataManager to directly examine the internals of this class.
      */
@@ -307,6 +406,10 @@ public:
         double point_density;
         bool use_consistent_mass_matrix;
         bool use_nodal_quadrature;
+
+        /// Whether to use OpenMP threads (if available) to evaluate values at
+        /// the quadrature points of the elements on each patch.
+        bool use_threaded_quadrature = false;
     };
 
     /*!
@@ -339,6 +442,10 @@ public:
         bool use_adaptive_quadrature;
         double point_density;
         bool use_nodal_quadrature;
+
+        /// Whether to use OpenMP threads (if available) to evaluate values at
+        /// the quadrature points of the elements on each patch.
+        bool use_threaded_quadrature = false;
     };
 
     /*!
@@ -350,6 +457,21 @@ public:
     {
         /// The multiplier applied to each quadrature point.
         double q_point_weight = 1.0;
+
+        /// Additional multipliers applied to each quadrature point which
+        /// account separately for the cost of force spreading, velocity
+        /// interpolation, and stress assembly. These are relative to the work
+        /// on a single Eulerian cell, which is given a weight of one by
+        /// IBTK::HierarchyIntegrator, and are added to q_point_weight.
+        double spread_q_point_weight = 0.0;
+        double interp_q_point_weight = 0.0;
+        double stress_q_point_weight = 0.0;
+
+        /// The total multiplier applied to each quadrature point.
+        double getTotalQuadPointWeight() const
+        {
+            return q_point_weight + spread_q_point_weight + interp_q_point_weight + stress_q_point_weight;
+        }
     };
 
 protected:
@@ -492,6 +614,34 @@ public:
      */
     bool getLoggingEnabled() const;
 
+    /*!
+     * \brief Set the parameters used during workload calculations, e.g., to
+     * replace the values provided at construction with calibrated ones.
+     */
+    void setWorkloadSpec(const WorkloadSpec& workload_spec);
+
+    /*!
+     * \brief Get the parameters used during workload calculations.
+     */
+    const WorkloadSpec& getWorkloadSpec() const;
+
+    /*!
+     * \brief Compute the total number of quadrature points, over all
+     * processors, used to evaluate IB terms on the level in which the FE mesh
+     * is embedded.
+     */
+    double computeGlobalQuadPointCount();
+
+    /*!
+     * \brief Compute the fraction, over all processors, of the elements
+     * associated with the local patches (see getActivePatchElementMap()) that
+     * are owned by a different processor than the patch. This measures how
+     * well the libMesh partitioning matches the distribution of the patches:
+     * a value close to zero means that nearly all IB calculations only use
+     * locally owned elements.
+     */
+    double computeNonLocalPatchElementFraction() const;
+
     /*!
      * \brief Register a load balancer for non-uniform load balancing.
      *
@@ -577,6 +727,52 @@ public:
      */
     void reinitElementMappings();
 
+    /*!
+     * \brief Set whether or not reinitElementMappings() should use the
+     * previous mapping between elements and patches as a starting point.
+     *
+     * In this mode, patches whose boxes are unchanged since the previous
+     * mapping keep their previously associated elements and only elements
+     * whose bounding boxes cover a different range of grid cells than they
+     * did at the time of the previous mapping are re-bucketed. This is
+     * typically much cheaper than rebuilding the mapping from scratch for
+     * structures that move slowly relative to the grid between regrids. The
+     * resulting mapping is the same in either mode. Defaults to false.
+     */
+    void setUseIncrementalElementMappings(bool use_incremental = true);
+
+    /*!
+     * \brief Set whether or not the mapping between elements and patches
+     * should be written to restart files and, when restarting, restored from
+     * the restart file instead of being recomputed.
+     *
+     * The restored mapping is only used by the first call to
+     * reinitElementMappings() after restarting, and only if the mesh and the
+     * local patches of the relevant patch level are the same as when the
+     * restart file was written; otherwise the mapping is recomputed as usual.
+     * Since the element-patch association is only updated when regridding,
+     * the restored mapping is the one the original run would have continued
+     * to use. Defaults to false.
+     */
+    void setRestoreElementMappingsFromRestart(bool restore = true);
+
+    /*!
+     * \brief Set whether or not applyGradientDetector() should tag cells using
+     * the bounding boxes of the active elements instead of the locations of
+     * their quadrature points.
+     *
+     * In this mode, all cells covered by the bounding box of each element that
+     * intersects a patch (grown by the same buffer that is used when tagging
+     * quadrature points) are tagged in bulk, which avoids evaluating the
+     * positions of the quadrature points of every element and, away from the
+     * initial time, computing and coarsening the quadrature point count data.
+     * For structures whose elements are small relative to the grid spacing, the
+     * tagged region is essentially the same as in the default mode; otherwise,
+     * additional cells covered by the bounding boxes of large or curved
+     * elements may be tagged. Defaults to false.
+     */
+    void setUseBoundingBoxTagging(bool use_bounding_box_tagging = true);
+
     /*!
      * \return A pointer to the unghosted solution vector associated with the
      * specified system.
@@ -856,6 +1052,15 @@ public:
                              double tol = 1.0e-6,
                              unsigned int max_its = 100);
 
+    /*!
+     * \brief Set whether or not L2 projections computed with the consistent
+     * mass matrix should use a matrix-free mass operator instead of an
+     * assembled sparse matrix.
+     *
+     * @see FEProjector::setUseMatrixFreeMassOperator()
+     */
+    void setUseMatrixFreeMassOperator(bool use_matrix_free = true);
+
     /*!
      * Update the quarature rule for the current element.  If the provided
      * qrule is already configured appropriately, it is not modified.
@@ -1032,6 +1237,53 @@ private:
      */
     FEDataManager& operator=(const FEDataManager& that) = delete;
 
+    /*!
+     * Adaptive quadrature keys of the local elements for one combination of
+     * quadrature type, quadrature order, and point density.  For each
+     * element, we store its key, bounds on its maximum edge length when the
+     * nodes are at the reference positions X_ref, and the range of maximum
+     * edge lengths for which the key does not change.
+     */
+    struct AdaptiveQuadratureKeyCache
+    {
+        struct Entry
+        {
+            std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order> key;
+            double hmax_lower, hmax_upper;
+            double valid_lower, valid_upper;
+        };
+        double dx_min = 0.0;
+        std::vector<double> X_ref;
+        std::unordered_map<libMesh::dof_id_type, Entry> entries;
+    };
+
+    /*!
+     * Prepare the cache for use with the positions stored in the local form
+     * @p X_local_soln of @p X_petsc_vec and return a bound on the distance
+     * that any node has moved from its reference position.  The cache is
+     * reset, and the current positions become the reference positions, when
+     * this distance exceeds a fraction of the quadrature point spacing.
+     */
+    double prepareAdaptiveQuadratureKeyCache(AdaptiveQuadratureKeyCache& cache,
+                                             libMesh::PetscVector<double>& X_petsc_vec,
+                                             const double* X_local_soln,
+                                             double point_density,
+                                             double dx_min);
+
+    /*!
+     * Return the adaptive quadrature key of @p elem.  The cached key is used
+     * if a nodal displacement of at most @p X_displacement from the reference
+     * positions cannot have changed it; otherwise, the key is recomputed.
+     */
+    std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>
+    getCachedAdaptiveQuadratureKey(AdaptiveQuadratureKeyCache& cache,
+                                   libMesh::QuadratureType quad_type,
+                                   double point_density,
+                                   const libMesh::Elem* elem,
+                                   const boost::multi_array<double, 2>& X_node,
+                                   double dx_min,
+                                   double X_displacement);
+
     /*!
      * Compute the quadrature point counts in each cell of the level in which
      * the FE mesh is embedded.  Also zeros out node count data for other levels
@@ -1062,6 +1314,41 @@ private:
      */
     void collectActivePatchElements(std::vector<std::vector<libMesh::Elem*> >& active_patch_elems, int level_number);
 
+    /*!
+     * Same as collectActivePatchElements(), but uses the mapping computed by
+     * the previous call to this function (provided in @p
+     * prev_active_patch_elems) as a starting point.
+     */
+    void
+    collectActivePatchElementsIncremental(std::vector<std::vector<libMesh::Elem*> >& active_patch_elems,
+                                          const std::vector<std::vector<libMesh::Elem*> >& prev_active_patch_elems,
+                                          int level_number);
+
+    /*!
+     * Compute the bounding boxes of all active elements (in the ordering of
+     * the active element iterators of the mesh) used to associate elements
+     * with patches on the given level.
+     */
+    std::vector<libMeshWrappers::BoundingBox> collectGlobalActiveElementBoundingBoxes(int level_number);
+
+    /*!
+     * Tag the cells of the specified level that are covered by the bounding
+     * boxes of the active elements (computed by
+     * collectGlobalActiveElementBoundingBoxes()) grown by @p buffer cells. See
+     * setUseBoundingBoxTagging().
+     */
+    void tagCellsInActiveElementBoundingBoxes(int level_number, int tag_index, int buffer);
+
+    /*!
+     * Reconstruct the mapping between elements and local patches on the given
+     * level from the data read from the restart file.
+     *
+     * \return Whether or not the restart data was consistent with the present
+     * mesh and patch level on all processes. If not, @p active_patch_elems is
+     * left unchanged.
+     */
+    bool restoreActivePatchElements(std::vector<std::vector<libMesh::Elem*> >& active_patch_elems, int level_number);
+
     /*!
      * Collect all of the nodes of the active elements that are located within a
      * local Cartesian grid patch grown by the specified ghost cell width.
@@ -1173,9 +1460,9 @@ private:
     int d_workload_idx = IBTK::invalid_index;
 
     /*!
-     * The default parameters used during workload calculations.
+     * The parameters used during workload calculations.
      */
-    const WorkloadSpec d_default_workload_spec;
+    WorkloadSpec d_default_workload_spec;
 
     /*!
      * The default kernel functions and quadrature rule used to mediate
@@ -1211,6 +1498,40 @@ private:
     std::vector<std::pair<Point, Point> > d_active_elem_bboxes;
     std::vector<libMesh::Elem*> d_active_elems;
 
+    /*!
+     * Cached adaptive quadrature keys, indexed by quadrature type, quadrature
+     * order, and point density.  See getCachedAdaptiveQuadratureKey().
+     */
+    std::map<std::tuple<libMesh::QuadratureType, libMesh::Order, double>, AdaptiveQuadratureKeyCache>
+        d_adaptive_quad_key_caches;
+
+    /*!
+     * Data describing the previous mapping between mesh elements and grid
+     * patches, used when incremental element mappings are enabled.
+     */
+    bool d_use_incremental_element_mappings = false;
+    int d_prev_mapping_level_number = IBTK::invalid_level_number;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_prev_mapping_patch_boxes;
+    std::vector<libMesh::dof_id_type> d_prev_mapping_elem_ids;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_prev_mapping_elem_boxes;
+
+    /*!
+     * Whether or not to tag cells using the bounding boxes of the active
+     * elements. See setUseBoundingBoxTagging().
+     */
+    bool d_use_bounding_box_tagging = false;
+
+    /*!
+     * Mapping between mesh elements and local grid patches read from the
+     * restart file, used when restoring element mappings from restart files
+     * is enabled. This data is discarded after its first use.
+     */
+    bool d_restore_element_mappings_from_restart = false;
+    int d_restart_mapping_level_number = IBTK::invalid_level_number;
+    libMesh::dof_id_type d_restart_mapping_n_active_elem = 0;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_restart_mapping_patch_boxes;
+    std::vector<std::vector<libMesh::dof_id_type> > d_restart_mapping_elem_ids;
+
     /*!
      * Ghost vectors for the various equation systems.
      */
@@ -1222,6 +1543,12 @@ private:
      * buildIBGhostedVector.
      */
     std::map<std::string, std::unique_ptr<libMesh::PetscVector<double> > > d_system_ib_ghost_vec;
+
+    /*!
+     * Identifiers of the reporters registered with MemoryMonitor for the
+     * ghosted vectors and the element mappings.
+     */
+    int d_ghost_vectors_memory_reporter_id = -1, d_element_mappings_memory_reporter_id = -1;
 };
 } // namespace IBTK
 
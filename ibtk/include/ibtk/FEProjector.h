@@ -21,13 +21,24 @@
 #include <libmesh/petsc_matrix.h>
 #include <libmesh/petsc_vector.h>
 
+#include <petscksp.h>
+#include <petscmat.h>
+
+#include <cstddef>
 #include <map>
+#include <memory>
 #include <string>
 
 namespace IBTK
 {
 class FEData;
+class FEDataInterpolation;
+class FEValuesBase;
 } // namespace IBTK
+namespace libMesh
+{
+class QBase;
+} // namespace libMesh
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
 
@@ -36,6 +47,19 @@ namespace IBTK
 /*!
  * \brief Class FEProjector coordinates data structures for projecting
  * fields in FE models.
+ *
+ * L2 projections using the consistent mass matrix are solved either with an
+ * assembled sparse mass matrix (the default) or, if
+ * FEProjector::setUseMatrixFreeMassOperator() is called, with a
+ * Jacobi-preconditioned conjugate gradient solver that applies the mass
+ * operator element-by-element at the quadrature points without ever storing
+ * the mass matrix. The matrix-free solver may be configured at runtime via
+ * PETSc options with the prefix <code>mf_l2_proj_</code>.
+ *
+ * Mass matrices and projection solvers are shared by all systems that have the
+ * same finite element types, DOF numbering, and constraints (e.g., the
+ * velocity and force systems of a structure), so that they are assembled and
+ * stored only once. See FEProjector::getMassMatrixSystemName().
  */
 class FEProjector
 {
@@ -55,8 +79,8 @@ public:
     /// Deleted assignment operator.
     FEProjector& operator=(const FEProjector& that) = delete;
 
-    /// Defaulted destructor.
-    ~FEProjector() = default;
+    /// Destructor.
+    ~FEProjector();
 
     /*!
      * \return Pointers to a linear solver and sparse matrix corresponding to a
@@ -70,6 +94,24 @@ public:
      */
     libMesh::PetscVector<double>* buildDiagonalL2MassMatrix(const std::string& system_name);
 
+    /*!
+     * \return PETSc KSP object that solves the L2 projection problem with a
+     * matrix-free mass operator.
+     */
+    KSP buildMatrixFreeL2ProjectionSolver(const std::string& system_name);
+
+    /*!
+     * \return The name of the system whose mass matrices and projection
+     * solvers are used for the specified system. This is the first system for
+     * which these were requested that has the same finite element types, DOF
+     * numbering, and constraints as the specified system, or the specified
+     * system itself if there is no such system.
+     *
+     * \note This function is collective the first time it is called for each
+     * system.
+     */
+    const std::string& getMassMatrixSystemName(const std::string& system_name);
+
     /*!
      * \brief Set U to be the L2 projection of F.
      */
@@ -92,6 +134,19 @@ public:
      */
     bool getLoggingEnabled() const;
 
+    /*!
+     * \brief Set whether or not to use a matrix-free mass operator (instead of
+     * an assembled mass matrix) when computing L2 projections with the
+     * consistent mass matrix.
+     */
+    void setUseMatrixFreeMassOperator(bool use_matrix_free = true);
+
+    /*!
+     * \brief Determine whether or not a matrix-free mass operator is used
+     * when computing L2 projections with the consistent mass matrix.
+     */
+    bool getUseMatrixFreeMassOperator() const;
+
 protected:
     /*!
      * FEData object that contains the libMesh data structures.
@@ -108,13 +163,83 @@ protected:
     /// Data structures for lumped (diagonal) mass matrices and related solvers.
     std::map<std::string, std::unique_ptr<libMesh::PetscVector<double> > > d_L2_proj_matrix_diag;
 
+    /// Data structures for matrix-free mass operators and related solvers.
+    /// The quadrature rule and the FE objects are built once, when the
+    /// operator is built, and are reused by every application of the operator.
+    struct MatrixFreeMassOperator
+    {
+        FEProjector* projector = nullptr;
+        std::string system_name;
+        Mat M_mat = nullptr;
+        KSP solver = nullptr;
+        bool rtol_set_from_options = false;
+        bool max_it_set_from_options = false;
+        std::unique_ptr<libMesh::PetscVector<double> > M_diag_vec;
+        std::unique_ptr<libMesh::PetscVector<double> > x_ghost_vec;
+        std::unique_ptr<libMesh::QBase> qrule;
+        std::unique_ptr<FEDataInterpolation> fe;
+        std::unique_ptr<FEValuesBase> fe_values;
+    };
+    std::map<std::string, std::unique_ptr<MatrixFreeMassOperator> > d_L2_proj_mf_operator;
+
+    /// Map from system names to the names of the systems whose mass matrices
+    /// and solvers they use (see getMassMatrixSystemName()).
+    std::map<std::string, std::string> d_mass_matrix_system_name;
+
 private:
+    /*!
+     * Determine whether or not two systems have the same finite element
+     * types, DOF numbering, and constraints on all processes, in which case
+     * they have the same mass matrices.
+     *
+     * \note This function is collective.
+     */
+    bool haveSameMassMatrix(const std::string& system_name_1, const std::string& system_name_2);
+
+    /*!
+     * Compute y = M x, in which M is the (constrained) consistent mass matrix
+     * of the specified system.
+     */
+    void applyMatrixFreeMassOperator(MatrixFreeMassOperator& op,
+                                     libMesh::PetscVector<double>& x_vec,
+                                     libMesh::PetscVector<double>& y_vec);
+
+    /*!
+     * Compute the diagonal of the consistent mass matrix of the specified
+     * system for use by the Jacobi preconditioner. Constrained DOFs are given
+     * unit diagonal entries.
+     */
+    void computeMatrixFreeMassOperatorDiagonal(MatrixFreeMassOperator& op);
+
+    /*!
+     * Static functions for use by the PETSc MatShell object.
+     */
+    static PetscErrorCode MatVecMult_MassOperator(Mat A, Vec x, Vec y);
+    static PetscErrorCode MatGetDiagonal_MassOperator(Mat A, Vec d);
+
+    /*!
+     * Return the number of bytes used by the mass matrices and the vectors of
+     * the matrix-free mass operators.
+     */
+    std::size_t getMemoryUsage() const;
+
+    /*!
+     * Whether or not to use a matrix-free mass operator when computing L2
+     * projections with the consistent mass matrix.
+     */
+    bool d_use_matrix_free_mass_operator = false;
+
     /*!
      * Whether or not to log data to the screen: see
      * FEProjector::setLoggingEnabled() and
      * FEProjector::getLoggingEnabled().
      */
     bool d_enable_logging = false;
+
+    /*!
+     * Identifier of the reporter registered with MemoryMonitor.
+     */
+    int d_memory_reporter_id = -1;
 };
 } // namespace IBTK
 
@@ -27,6 +27,7 @@
 #include "libmesh/type_vector.h"
 #include <libmesh/enum_elem_type.h>
 #include <libmesh/fe.h>
+#include <libmesh/fe_type.h>
 #include <libmesh/point.h>
 #include <libmesh/quadrature.h>
 
@@ -46,6 +47,44 @@ public:
 
     virtual void reinit(const libMesh::Elem* elem) = 0;
 
+    /**
+     * Number of elements that are processed together by reinitBatch().
+     */
+    static constexpr unsigned int batch_size = 8;
+
+    /**
+     * Reinitialize the values on a batch of up to batch_size elements of the
+     * same type at once.  Element-dependent values are stored with the element
+     * index varying fastest so that loops over the elements of a batch
+     * vectorize:
+     *
+     * - getBatchJxW()[q * batch_size + e],
+     * - getBatchQuadraturePoints()[(q * dim + d) * batch_size + e], and
+     * - getBatchShapeGradients()[((i * n_qp + q) * dim + d) * batch_size + e].
+     *
+     * Shape function values do not depend on the element and are returned by
+     * getShapeValues().  Lanes beyond @p n_elems contain copies of the values
+     * of the last element.
+     *
+     * @note This is only implemented for dim == spacedim.
+     */
+    virtual void reinitBatch(const libMesh::Elem* const* elems, unsigned int n_elems) = 0;
+
+    inline const std::vector<double>& getBatchJxW() const
+    {
+        return d_batch_JxW;
+    }
+
+    inline const std::vector<double>& getBatchQuadraturePoints() const
+    {
+        return d_batch_quadrature_points;
+    }
+
+    inline const std::vector<double>& getBatchShapeGradients() const
+    {
+        return d_batch_shape_gradients;
+    }
+
     inline const std::vector<double>& getJxW() const
     {
         return d_JxW;
@@ -66,10 +105,44 @@ public:
         return d_shape_gradients;
     }
 
+    /**
+     * Whether the current element is a QUAD or HEX element with a
+     * tensor-product quadrature rule, so that interpolateTensorProduct() may
+     * be used.
+     */
+    inline bool hasTensorProductStructure() const
+    {
+        return d_tensor_product;
+    }
+
+    /**
+     * Evaluate the field whose nodal values are stored in column @p var of
+     * @p elem_data (indexed by node and then by variable) and, optionally,
+     * its gradient at the quadrature points of the current element by sum
+     * factorization.  This requires O(p^(dim + 1)) instead of O(p^(2 dim))
+     * operations per element.
+     *
+     * @note Gradients may only be computed if shape function gradients are
+     * updated.
+     */
+    virtual void interpolateTensorProduct(const boost::multi_array<double, 2>& elem_data,
+                                          unsigned int var,
+                                          std::vector<double>* values,
+                                          std::vector<libMesh::VectorValue<double> >* gradients) = 0;
+
     static std::unique_ptr<FEValuesBase>
     build(const int dim, const int spacedim, libMesh::QBase* qrule, const FEUpdateFlags update_flags);
 
+    /**
+     * Whether @p fe_type is the isoparametric Lagrange family on elements of
+     * type @p elem_type and IBTK provides a mapping with a compile-time number
+     * of nodes for that element type.
+     */
+    static bool isIsoparametricLagrange(const libMesh::FEType& fe_type, libMesh::ElemType elem_type);
+
 protected:
+    bool d_tensor_product = false;
+
     std::vector<double> d_JxW;
 
     std::vector<libMesh::Point> d_quadrature_points;
@@ -77,6 +150,8 @@ protected:
     std::vector<std::vector<double> > d_shape_values;
 
     std::vector<std::vector<libMesh::VectorValue<double> > > d_shape_gradients;
+
+    std::vector<double> d_batch_nodes, d_batch_JxW, d_batch_quadrature_points, d_batch_shape_gradients;
 };
 
 /**
@@ -91,6 +166,13 @@ public:
 
     virtual void reinit(const libMesh::Elem* elem) override;
 
+    virtual void reinitBatch(const libMesh::Elem* const* elems, unsigned int n_elems) override;
+
+    virtual void interpolateTensorProduct(const boost::multi_array<double, 2>& elem_data,
+                                          unsigned int var,
+                                          std::vector<double>* values,
+                                          std::vector<libMesh::VectorValue<double> >* gradients) override;
+
 protected:
     libMesh::QBase* d_qrule;
 
@@ -101,6 +183,12 @@ protected:
     {
         ReferenceValues(const libMesh::QBase& quadrature);
 
+        /**
+         * Set up the one-dimensional data used for sum factorization if the
+         * quadrature rule is a tensor product of one-dimensional rules.
+         */
+        void setupTensorProduct(const libMesh::QBase& quadrature, libMesh::Order order);
+
         const libMesh::ElemType d_elem_type;
 
         /**
@@ -114,8 +202,24 @@ protected:
          * index.
          */
         boost::multi_array<libMesh::VectorValue<double>, 2> d_reference_shape_gradients;
+
+        /**
+         * Data for sum factorization: the node numbers in lexicographic order
+         * and the one-dimensional shape values and derivatives, indexed by
+         * one-dimensional node and then by one-dimensional quadrature point.
+         */
+        bool d_tensor_product = false;
+        unsigned int d_n_nodes_1d = 0, d_n_qp_1d = 0;
+        std::vector<unsigned int> d_lexicographic_nodes;
+        std::vector<double> d_shape_values_1d, d_shape_derivatives_1d;
     };
 
+    /**
+     * Look up (computing, if necessary) the reference values for the given
+     * element type and make them current.
+     */
+    const ReferenceValues& updateReferenceValues(libMesh::ElemType elem_type);
+
     /*
      * Mappings, indexed by element type.
      */
@@ -136,6 +240,17 @@ protected:
      * matches the current element type.
      */
     libMesh::ElemType d_last_elem_type = libMesh::ElemType::INVALID_ELEM;
+
+    /**
+     * Mapping and reference values of the current element.
+     */
+    const Mapping<dim, spacedim>* d_current_mapping = nullptr;
+    const ReferenceValues* d_current_reference_values = nullptr;
+
+    /**
+     * Work arrays for sum factorization.
+     */
+    std::vector<double> d_tp_work_a, d_tp_work_b, d_tp_ref_gradients;
 };
 } // namespace IBTK
 
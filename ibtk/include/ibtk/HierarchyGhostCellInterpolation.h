@@ -73,6 +73,13 @@ namespace IBTK
  * \note In cases where physical boundary conditions are set via extrapolation
  * from interior values, setting ghost cell values may require both coarsening
  * and refining.
+ *
+ * \note The refine and coarsen schedules are created by
+ * initializeOperatorState() and are reused by each call to fillData() until
+ * the operator state is reinitialized or deallocated.  All of the transaction
+ * components registered with a single operator are communicated together, so
+ * related quantities that are filled at the same time should be registered
+ * with the same operator.
  */
 class HierarchyGhostCellInterpolation : public SAMRAI::tbox::DescribedClass
 {
@@ -17,7 +17,9 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibtk/CartGridFunction.h"
+#include "ibtk/DiagnosticsCollector.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/InSituAnalysisStrategy.h"
 #include "ibtk/ibtk_enums.h"
 
 #include "BasePatchHierarchy.h"
@@ -48,6 +50,7 @@
 #include <ostream>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace SAMRAI
@@ -138,6 +141,23 @@ public:
     /*!
      * Integrate data on all patches on all levels of the patch hierarchy over
      * the specified time increment.
+     *
+     * The scalar diagnostics queued with the DiagnosticsCollector of this
+     * integrator (see getDiagnosticsCollector()) during the time step are
+     * reduced after the postprocessing methods have been executed.
+     *
+     * If the input database provides <code>dt_error_tolerance</code> (a
+     * relative tolerance) or <code>dt_error_abs_tolerance</code> and the time
+     * step takes multiple cycles, the error of the time step is estimated by
+     * the maximum difference between the Eulerian state variables of this
+     * integrator and its child integrators after the first and the last cycle.
+     * The time step size predicted from the error estimate bounds the value
+     * returned by getMaximumTimeStepSize() for the next time step.  Time steps
+     * are never repeated: this function always advances the hierarchy by \a dt
+     * (or to the end time), and a time step whose estimated error exceeds the
+     * tolerance only reduces the size of the next time step.  Data that are
+     * not registered as state variables with an integrator, such as the
+     * Lagrangian data of an IB method, are not included in the estimate.
      */
     virtual void advanceHierarchy(double dt);
 
@@ -358,6 +378,16 @@ public:
      */
     SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > getVisItDataWriter() const;
 
+    /*!
+     * Register an object that analyzes or visualizes the data in situ.  The
+     * analysis is executed at the end of every time step whose number is a
+     * multiple of \p interval, after setupPlotData() has been called.
+     *
+     * \note In situ analysis objects should be registered only with the
+     * top-level integrator.
+     */
+    void registerInSituAnalysis(SAMRAI::tbox::Pointer<InSituAnalysisStrategy> analysis, int interval = 1);
+
     /*!
      * Prepare variables for plotting.
      *
@@ -619,6 +649,17 @@ public:
      */
     void allocatePatchData(int data_idx, double data_time, int coarsest_ln = -1, int finest_ln = -1) const;
 
+    /*!
+     * Allocate the patch data components selected by a
+     * SAMRAI::hier::ComponentSelector over the specified range of patch level
+     * numbers. Components that are already allocated are not reallocated;
+     * only their time is set to data_time.
+     */
+    void allocatePatchData(const SAMRAI::hier::ComponentSelector& data,
+                           double data_time,
+                           int coarsest_ln = -1,
+                           int finest_ln = -1) const;
+
     /*!
      * Deallocate a patch data index over the specified range of patch level
      * numbers.
@@ -631,6 +672,16 @@ public:
 
     SAMRAI::tbox::Pointer<HierarchyMathOps> getHierarchyMathOps() const;
 
+    /*!
+     * Return the DiagnosticsCollector used to reduce scalar diagnostics (e.g.,
+     * CFL numbers) computed during each time step.
+     *
+     * Child integrators share the collector of their parent integrator, so
+     * that the diagnostics of all of the integrators are combined in a single
+     * global reduction at the end of each time step.
+     */
+    DiagnosticsCollector& getDiagnosticsCollector() const;
+
     ///
     ///  Routines to register new variables with the integrator.
     ///
@@ -754,9 +805,36 @@ protected:
      * integrator has been registered with this integrator,
      * atRegridPointSpecialized() returns false, in order to allow the parent
      * integrator to control the timing of regridding.
+     *
+     * If the input key <code>adaptive_regrid_interval</code> is set to
+     * <code>TRUE</code>, the fixed interval is replaced by the criterion
+     * implemented in atAdaptiveRegridPoint().
      */
     virtual bool atRegridPointSpecialized() const;
 
+    /*!
+     * Determine whether regridding should occur at the current time step based
+     * on the measured cost of the last regrid operation and the measured
+     * increase in the cost of the time steps taken since then.
+     *
+     * Let \f$ C \f$ be the wall clock time of the last regrid operation and let
+     * \f$ e_k \f$ be the amount by which the wall clock time of the \f$ k \f$-th
+     * time step after that regrid exceeds the fastest time step taken since
+     * then.  The wall clock times are maximized over all processes, so that
+     * they include the effect of load imbalance.  Regridding after \f$ n \f$
+     * steps costs \f$ (C + \sum_{k=1}^{n} e_k)/n \f$ per step on average,
+     * which is minimized by regridding as soon as \f$ n e_n \geq C +
+     * \sum_{k=1}^{n} e_k \f$; for a step time that degrades linearly at the rate
+     * \f$ a \f$ per step, this yields \f$ n = \sqrt{2 C / a} \f$.
+     *
+     * The number of steps between regrids is bounded from below by the input
+     * key <code>min_regrid_interval</code> and, if it is positive, from above
+     * by the input key <code>max_regrid_interval</code>.  Until the cost of a
+     * regrid operation has been measured (e.g., after restarting), the fixed
+     * interval given by <code>regrid_interval</code> is used.
+     */
+    bool atAdaptiveRegridPoint() const;
+
     /*!
      * Virtual method to perform implementation-specific visualization setup.
      *
@@ -1032,6 +1110,12 @@ protected:
      */
     SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > d_visit_writer;
 
+    /*
+     * Objects used to analyze the data in situ and the time step intervals at
+     * which they are executed.
+     */
+    std::vector<std::pair<SAMRAI::tbox::Pointer<InSituAnalysisStrategy>, int> > d_in_situ_analyses;
+
     /*
      * Time and time step size data read from input or set at initialization.
      */
@@ -1042,6 +1126,16 @@ protected:
     int d_integrator_step = 0, d_max_integrator_steps = std::numeric_limits<int>::max();
     std::deque<double> d_dt_previous;
 
+    /*
+     * Parameters of the error-controlled time step size selection (see
+     * advanceHierarchy()): the relative and absolute error tolerances, the
+     * safety factor applied to the time step size predicted from the error
+     * estimate, and the time step size predicted from the error of the most
+     * recent time step.
+     */
+    double d_dt_error_tolerance = 0.0, d_dt_error_abs_tolerance = 0.0, d_dt_error_safety_factor = 0.9;
+    double d_dt_error_control = std::numeric_limits<double>::max();
+
     /*
      * The number of cycles of fixed-point iteration to use per timestep.
      */
@@ -1060,6 +1154,27 @@ protected:
      */
     int d_regrid_interval = 1;
 
+    /*
+     * Parameters of the adaptive regrid interval (see atAdaptiveRegridPoint()).
+     * A maximum interval of zero indicates that the interval is not bounded
+     * from above.
+     */
+    bool d_adaptive_regrid_interval = false;
+    int d_min_regrid_interval = 1, d_max_regrid_interval = 0;
+
+    /*
+     * Measurements used to determine the adaptive regrid interval: the step
+     * number of the last regrid operation, its wall clock time (negative if it
+     * has not been measured), the wall clock time of the fastest time step
+     * taken since then, and the excess of the wall clock time of the most
+     * recent time step and of the sum of the excesses of all time steps taken
+     * since then over that of the fastest time step.
+     */
+    int d_last_regrid_step = 0, d_num_timed_steps = 0;
+    double d_last_regrid_cost = -1.0;
+    double d_min_step_time = std::numeric_limits<double>::max();
+    double d_last_step_excess = 0.0, d_cumulative_step_excess = 0.0;
+
     /*
      * The regrid mode.  "Standard" regridding involves only one call to
      * SAMRAI::mesh::GriddingAlgorithm::regridAllFinerLevels().  This limits the
@@ -1089,6 +1204,31 @@ protected:
      */
     bool d_enable_logging_solver_iterations = false;
 
+    /*
+     * Indicates whether the scratch and new data should remain allocated
+     * between time steps instead of being deallocated at the end of each time
+     * step. In this case, these data are only allocated when the patch levels
+     * are (re)generated, at the expense of keeping them in memory. Set by the
+     * input key <code>keep_scratch_data_allocated</code>.
+     */
+    bool d_keep_scratch_data_allocated = false;
+
+    /*
+     * Indicates whether the integrator should log the number of patch data
+     * arrays allocated by allocatePatchData() by this integrator and its child
+     * integrators during each time step, excluding those allocated while
+     * regridding. Set by the input key
+     * <code>audit_patch_data_allocations</code>.
+     */
+    bool d_audit_patch_data_allocations = false;
+    mutable int d_num_patch_data_allocations = 0;
+
+    /*
+     * Identifier of the reporter registered with MemoryMonitor for the patch
+     * data allocated on the hierarchy.
+     */
+    int d_memory_reporter_id = -1;
+
     /*
      * The type of extrapolation to use at physical boundaries when prolonging
      * data during regridding.
@@ -1107,6 +1247,11 @@ protected:
      * Hierarchy operations objects.
      */
     SAMRAI::tbox::Pointer<HierarchyMathOps> d_hier_math_ops;
+
+    /*
+     * Collector for the scalar diagnostics computed during each time step.
+     */
+    mutable DiagnosticsCollector d_diagnostics_collector;
     bool d_manage_hier_math_ops = true;
 
     /*
@@ -1193,6 +1338,28 @@ private:
      */
     void getFromRestart();
 
+    /*!
+     * Copy the new data of the state variables of this integrator and,
+     * recursively, of its child integrators to the storage of the predicted
+     * state.
+     */
+    void storePredictedStateData();
+
+    /*!
+     * Return the maximum over the state variables of this integrator and,
+     * recursively, of its child integrators of the max norm of the difference
+     * between the new and the predicted state, divided by abs_tol + rel_tol
+     * times the max norm of the new state, and deallocate the storage of the
+     * predicted state.
+     */
+    double computeStateErrorEstimate(double rel_tol, double abs_tol);
+
+    /*
+     * Patch data indices of the predicted state of each double-valued state
+     * variable.
+     */
+    std::map<SAMRAI::hier::Variable<NDIM>*, int> d_predicted_state_idxs;
+
     /*
      * Indicates whether we are currently regridding the hierarchy, or whether
      * the time step began by regridding the hierarchy.
@@ -18,6 +18,7 @@
 
 #include "ibtk/PatchMathOps.h"
 #include "ibtk/SAMRAIDataCache.h"
+#include "ibtk/ThreadPool.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
 
@@ -42,6 +43,8 @@
 #include "tbox/DescribedClass.h"
 #include "tbox/Pointer.h"
 
+#include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -79,6 +82,14 @@ namespace IBTK
  * \note All specified variable descriptor indices must refer to
  * SAMRAI::hier::Variable / SAMRAI::hier::VariableContext pairs that have been
  * registered with the SAMRAI::hier::VariableDatabase.
+ *
+ * \note Once ghost cell values have been filled, the patch computations
+ * performed by the curl, div, grad, interp, harmonic_interp, laplace, and
+ * vc_laplace methods are independent, and they may be executed concurrently by
+ * a pool of threads (see class ThreadPool).  This allows hybrid MPI+threads
+ * runs to use fewer MPI processes, and hence fewer ghost cell exchanges.  By
+ * default, ThreadPool::getDefaultNumberOfThreads() threads are used, which is
+ * one unless it has been changed.
  */
 class HierarchyMathOps : public SAMRAI::tbox::DescribedClass
 {
@@ -87,12 +98,17 @@ public:
      * \brief Constructor.
      *
      * Does nothing interesting.
+     *
+     * \param num_threads  The number of threads used to execute patch
+     * computations.  A value of zero indicates that
+     * ThreadPool::getDefaultNumberOfThreads() threads are to be used.
      */
     HierarchyMathOps(std::string name,
                      SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                      int coarsest_ln = -1,
                      int finest_ln = -1,
-                     std::string coarsen_op_name = "CONSERVATIVE_COARSEN");
+                     std::string coarsen_op_name = "CONSERVATIVE_COARSEN",
+                     unsigned int num_threads = 0);
 
     /*!
      * \brief Destructor.
@@ -1404,6 +1420,13 @@ private:
      */
     void xeqScheduleOutersideRestriction(int dst_idx, int src_idx, int dst_ln);
 
+    /*!
+     * \brief Execute the specified computation on each local patch of the
+     * specified level, concurrently if more than one thread is used.
+     */
+    void forEachPatch(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+                      const std::function<void(const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> >&)>& task);
+
     /*!
      * \brief Reset cell-centered weights, allocating patch data if needed.
      */
@@ -1453,6 +1476,10 @@ private:
     // Patch math operations.
     PatchMathOps d_patch_math_ops;
 
+    // Threads used to execute patch computations.
+    std::unique_ptr<ThreadPool> d_thread_pool;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > > d_patches;
+
     // The cell weights are used to compute norms of data defined on the patch
     // hierarchy.
     SAMRAI::tbox::Pointer<SAMRAI::hier::VariableContext> d_context;
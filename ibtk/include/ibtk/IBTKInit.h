@@ -37,6 +37,10 @@ namespace IBTK
  * created using the initialize() function at the start of the main() function. The destruction of the object correctly
  * closes the libraries.
  *
+ * To run an ensemble of independent simulations (e.g., a parameter sweep) in a single job, the world communicator can
+ * be split into groups of processes with splitEnsembleCommunicator() before creating this object with the returned
+ * communicator. Each group then runs its own simulation, and AppInitializer gives each group its own input overrides
+ * and output files and directories.
  */
 
 class IBTKInit
@@ -71,6 +75,30 @@ public:
      */
     ~IBTKInit();
 
+    /*!
+     * \brief Split the world communicator into num_groups groups of consecutive ranks and return the communicator of
+     * the group of this process, which should then be passed to the constructor. MPI is initialized if it has not been
+     * initialized yet, and is then finalized at program exit.
+     *
+     * \note Consecutive ranks are usually placed on the same node, so that each group spans as few nodes as possible.
+     */
+    static MPI_Comm splitEnsembleCommunicator(int num_groups, MPI_Comm world_communicator = MPI_COMM_WORLD);
+
+    /*!
+     * \brief Get the number of the ensemble group of this process, or 0 if the world communicator was not split.
+     */
+    static int getEnsembleGroupNumber();
+
+    /*!
+     * \brief Get the number of ensemble groups, or 1 if the world communicator was not split.
+     */
+    static int getNumberOfEnsembleGroups();
+
+    /*!
+     * \brief Get the communicator that was split into ensemble groups, e.g., to collect the results of all groups.
+     */
+    static MPI_Comm getEnsembleWorldCommunicator();
+
 #ifdef IBTK_HAVE_LIBMESH
     /**
      * Get libMesh initialization object.
@@ -101,6 +129,8 @@ private:
     libMesh::LibMeshInit d_libmesh_init;
 #endif
     static bool s_initialized;
+    static int s_ensemble_group_num, s_num_ensemble_groups;
+    static MPI_Comm s_ensemble_world_communicator;
 };
 
 } // namespace IBTK
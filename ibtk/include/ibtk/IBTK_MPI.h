@@ -21,6 +21,7 @@
 
 #include <mpi.h>
 
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -301,6 +302,113 @@ struct IBTK_MPI
 
     //@}
 
+    //@{
+    /**
+     * Start a non-blocking min, max, or sum reduction on an array of values.
+     * The reduced values are stored in the same array once the returned
+     * request is complete; the array must not be accessed before then.  The
+     * returned request is MPI_REQUEST_NULL if there is nothing to communicate.
+     */
+    template <typename T>
+    static IBTK_MPI::request
+    iminReduction(T* x, const int n = 1, IBTK_MPI::comm communicator = getCommunicator());
+    template <typename T>
+    static IBTK_MPI::request
+    imaxReduction(T* x, const int n = 1, IBTK_MPI::comm communicator = getCommunicator());
+    template <typename T>
+    static IBTK_MPI::request
+    isumReduction(T* x, const int n = 1, IBTK_MPI::comm communicator = getCommunicator());
+    //@}
+
+    /**
+     * Start a non-blocking gather in which each processor contributes n values.
+     * The x_out array must have room for n times the number of processors
+     * values, and neither array may be accessed before the returned request is
+     * complete.
+     */
+    template <typename T>
+    static IBTK_MPI::request
+    iallGather(const T* x_in, const int n, T* x_out, IBTK_MPI::comm communicator = getCommunicator());
+
+    /**
+     * Create a distributed graph communicator in which each processor is
+     * connected to the given processors, e.g., to the owners of the patches
+     * that neighbor the local patches.  The neighbor relation must be
+     * symmetric.
+     *
+     * Creating the communicator is itself a collective operation, so the
+     * communicator should be cached by the caller for as long as the neighbor
+     * relation is valid (e.g., until the next regrid) and freed with
+     * MPI_Comm_free.
+     */
+    static IBTK_MPI::comm createNeighborCommunicator(const std::vector<int>& neighbors,
+                                                     IBTK_MPI::comm communicator = getCommunicator());
+
+    //@{
+    /**
+     * Gather n values from each neighbor of this processor in a communicator
+     * created by createNeighborCommunicator().  The values from the neighbors
+     * are stored in x_out in the order in which the neighbors were specified.
+     * The non-blocking variant returns a request that must be completed before
+     * either array is accessed.
+     */
+    template <typename T>
+    static void neighborAllGather(const T* x_in, const int n, T* x_out, IBTK_MPI::comm neighbor_communicator);
+    template <typename T>
+    static IBTK_MPI::request
+    ineighborAllGather(const T* x_in, const int n, T* x_out, IBTK_MPI::comm neighbor_communicator);
+    //@}
+
+    /**
+     * A set of pending non-blocking requests that are completed together, so
+     * that callers can start several operations, do unrelated work, and then
+     * wait for all of them at once.
+     *
+     * The destructor waits for any requests that have not been completed, so
+     * the buffers used by the requests may be freed once the set is destroyed.
+     */
+    class RequestSet
+    {
+    public:
+        /**
+         * Default constructor.
+         */
+        RequestSet() = default;
+
+        /**
+         * Destructor.  Waits for all pending requests.
+         */
+        ~RequestSet();
+
+        /**
+         * Add a request to the set.  Null requests are ignored.
+         */
+        void add(IBTK_MPI::request request);
+
+        /**
+         * Return whether all requests in the set are complete without
+         * blocking.  The set is emptied if they are.
+         */
+        bool testAll();
+
+        /**
+         * Wait for all requests in the set to complete and empty the set.
+         */
+        void waitAll();
+
+        /**
+         * Return the number of pending requests.
+         */
+        std::size_t size() const;
+
+    private:
+        RequestSet(const RequestSet& from) = delete;
+
+        RequestSet& operator=(const RequestSet& that) = delete;
+
+        std::vector<IBTK_MPI::request> d_requests;
+    };
+
 private:
     /**
      * Performs common functions needed by some of the allToAll methods.
@@ -314,6 +422,9 @@ private:
     template <typename T>
     static void minMaxReduction(T* x, const int n, int* rank, MPI_Op op, IBTK_MPI::comm communicator);
 
+    template <typename T>
+    static IBTK_MPI::request ireduction(T* x, const int n, MPI_Op op, IBTK_MPI::comm communicator);
+
     static IBTK_MPI::comm s_communicator;
 };
 
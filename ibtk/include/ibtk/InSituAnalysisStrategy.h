@@ -0,0 +1,136 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_InSituAnalysisStrategy
+#define included_IBTK_InSituAnalysisStrategy
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "PatchHierarchy.h"
+#include "tbox/Pointer.h"
+
+#include <string>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class InSituAnalysisStrategy is an abstract base class for objects
+ * that analyze or visualize the simulation data while the simulation is running
+ * (e.g., adapters to in situ libraries such as ParaView Catalyst or Ascent)
+ * instead of writing the data to disk.
+ *
+ * Plot quantities are registered in the same way as with
+ * SAMRAI::appu::VisItDataWriter.  Objects of this type are registered with the
+ * top-level HierarchyIntegrator (see
+ * HierarchyIntegrator::registerInSituAnalysis()), which calls setupPlotData()
+ * and then execute() at the end of every time step at which the analysis is
+ * due.  Implementations should pass the patch data arrays of the registered
+ * quantities directly to the in situ library rather than copying them.
+ * Implementations that also publish Lagrangian or finite element meshes
+ * should obtain them from the corresponding data managers.
+ */
+class InSituAnalysisStrategy
+{
+public:
+    /*!
+     * \brief A quantity registered for analysis.
+     */
+    struct PlotQuantity
+    {
+        std::string name;
+        std::string type;
+        int data_idx;
+        int depth_start;
+    };
+
+    /*!
+     * \brief Constructor.
+     */
+    InSituAnalysisStrategy(std::string object_name);
+
+    /*!
+     * \brief Destructor.
+     */
+    virtual ~InSituAnalysisStrategy() = default;
+
+    /*!
+     * \brief Register a quantity for analysis.
+     *
+     * \param name         Name of the quantity.
+     * \param type         Type of the quantity ("SCALAR", "VECTOR", or "TENSOR").
+     * \param data_idx     Patch data index of the quantity.
+     * \param depth_start  First depth of the patch data that is used.
+     */
+    virtual void
+    registerPlotQuantity(const std::string& name, const std::string& type, int data_idx, int depth_start = 0);
+
+    /*!
+     * \brief Return the registered quantities.
+     */
+    const std::vector<PlotQuantity>& getPlotQuantities() const;
+
+    /*!
+     * \brief Analyze the data on the patch hierarchy at the given time.
+     *
+     * \note This function is called on all processes.
+     */
+    virtual void
+    execute(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy, double time, int time_step) = 0;
+
+protected:
+    /*!
+     * The object name is used for error reporting purposes.
+     */
+    std::string d_object_name;
+
+    /*!
+     * The registered quantities.
+     */
+    std::vector<PlotQuantity> d_plot_quantities;
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    InSituAnalysisStrategy() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    InSituAnalysisStrategy(const InSituAnalysisStrategy& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    InSituAnalysisStrategy& operator=(const InSituAnalysisStrategy& that) = delete;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_InSituAnalysisStrategy
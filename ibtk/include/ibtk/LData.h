@@ -28,6 +28,7 @@ IBTK_DISABLE_EXTRA_WARNINGS
 IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace SAMRAI
@@ -274,6 +275,20 @@ public:
      */
     void endGhostUpdate();
 
+    /*!
+     * \brief Set whether ghost values of nodes that are owned by processes on
+     * the same shared-memory node should be copied directly from the values of
+     * those processes through an MPI-3 shared-memory window.  Ghost values of
+     * nodes owned by processes on other nodes are still communicated by
+     * messages.
+     *
+     * \note The shared-memory window is allocated the first time that ghost
+     * values are updated and is freed when the data are reset or destroyed,
+     * both of which then become collective operations over the processes on
+     * each shared-memory node.
+     */
+    void setUseSharedMemoryGhostUpdate(bool use_shared_memory_ghost_update);
+
     /*!
      * \brief Write out object state to the given database.
      */
@@ -308,6 +323,15 @@ private:
     void getArrayCommon();
     void getGhostedLocalFormArrayCommon();
 
+    /*
+     * Set up, use, and free the data structures used to update ghost values
+     * through a shared-memory window.
+     */
+    void setupSharedMemoryGhostUpdate();
+    void beginSharedMemoryGhostUpdate();
+    void endSharedMemoryGhostUpdate();
+    void clearSharedMemoryGhostUpdate();
+
     /*
      * The name of the LData object.
      */
@@ -363,6 +387,19 @@ private:
     double* d_ghosted_local_array = nullptr;
     boost::multi_array_ref<double, 1> d_boost_ghosted_local_array{ nullptr, std::vector<int>{ 0 } };
     boost::multi_array_ref<double, 2> d_boost_vec_ghosted_local_array{ nullptr, std::vector<int>{ 0, 0 } };
+
+    /*
+     * Data used to update ghost values through a shared-memory window: the
+     * window and the segment of this process, which holds a copy of its local
+     * values; the position in the ghosted local form and the source address in
+     * the window of each ghost node that is owned by a process on this node;
+     * and the scatter for the remaining ghost nodes.
+     */
+    bool d_use_shared_memory_ghost_update = false;
+    MPI_Win d_shared_memory_win = MPI_WIN_NULL;
+    double* d_shared_memory_array = nullptr;
+    std::vector<std::pair<int, const double*> > d_on_node_ghost_srcs;
+    VecScatter d_off_node_ghost_scatter = nullptr;
 };
 } // namespace IBTK
 
@@ -16,6 +16,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/LHDF5DataWriter.h"
 #include "ibtk/LInitStrategy.h"
 #include "ibtk/LNodeSet.h"
 #include "ibtk/LNodeSetVariable.h"
@@ -168,6 +169,46 @@ public:
      */
     std::pair<int, int> getPatchLevels() const;
 
+    /*!
+     * \brief Set whether the local PETSc indices of the nodes owned by each
+     * processor should follow a Hilbert curve through the Cartesian grid
+     * cells containing them instead of the order in which the patches and
+     * cells are traversed.
+     *
+     * Nodes which are close in space are then also close in memory, which
+     * improves the locality of force evaluations that access nearby nodes.
+     * The new ordering takes effect the next time the nodes are
+     * redistributed.
+     */
+    void setUseSpaceFillingCurveNodeOrdering(bool use_sfc_ordering);
+
+    /*!
+     * \brief Set whether applyGradientDetector() should tag cells using the
+     * bounding boxes of the Lagrangian nodes on each patch of the next finer
+     * level instead of the number of nodes in each cell.
+     *
+     * In this mode, each process computes the bounding box of the cells that
+     * contain nodes in each of its patches on the next finer level, the boxes
+     * are shared among all processes, and all cells covered by the coarsened
+     * boxes are tagged in bulk.  This avoids computing and coarsening the node
+     * count data and examining every cell of the level to be tagged.  For
+     * structures that densely fill the patches that contain them, the tagged
+     * region is the same as in the default mode; otherwise, additional cells
+     * between the nodes of a patch may be tagged.  The tagging done at the
+     * initial time is not affected.
+     */
+    void setUseBoundingBoxTagging(bool use_bounding_box_tagging = true);
+
+    /*!
+     * \brief Set whether the ghost values of the Lagrangian data maintained by
+     * this object, and of the data created by createLData(), should be copied
+     * directly from the processes on the same shared-memory node through MPI-3
+     * shared-memory windows instead of being communicated by messages.
+     *
+     * See LData::setUseSharedMemoryGhostUpdate().
+     */
+    void setUseSharedMemoryGhostUpdates(bool use_shared_memory_ghost_updates = true);
+
     //\}
 
     /*!
@@ -483,6 +524,11 @@ public:
      */
     void registerLSiloDataWriter(SAMRAI::tbox::Pointer<LSiloDataWriter> silo_writer);
 
+    /*!
+     * \brief Register an HDF5 data writer with the manager.
+     */
+    void registerLHDF5DataWriter(SAMRAI::tbox::Pointer<LHDF5DataWriter> hdf5_writer);
+
     /*!
      * \brief Register a load balancer for non-uniform load balancing.
      *
@@ -558,6 +604,33 @@ public:
     SAMRAI::tbox::Pointer<LData>
     createLData(const std::string& quantity_name, int level_number, unsigned int depth = 1, bool maintain_data = false);
 
+    /*!
+     * \brief Borrow temporary Lagrangian level data with the specified depth
+     * from a pool of reusable data.  New data are allocated only if the pool is
+     * empty.
+     *
+     * \note The data should be returned to the pool via restoreScratchLData()
+     * when they are no longer needed.  The values of the data are not
+     * initialized.
+     */
+    SAMRAI::tbox::Pointer<LData> getScratchLData(int level_number, unsigned int depth = 1);
+
+    /*!
+     * \brief Return temporary Lagrangian level data obtained from
+     * getScratchLData() to the pool.
+     *
+     * \note The pool is emptied whenever the Lagrangian nodes are
+     * redistributed.
+     */
+    void restoreScratchLData(SAMRAI::tbox::Pointer<LData> data, int level_number);
+
+    /*!
+     * \brief Update the ghost values of several Lagrangian quantities (e.g.,
+     * positions and velocities) on the given level with a single ghost value
+     * update by packing the quantities into one temporary vector.
+     */
+    void updateGhostValues(const std::vector<SAMRAI::tbox::Pointer<LData> >& data, int level_number);
+
     /*!
      * \brief Get the patch data descriptor index for the Lagrangian index data.
      */
@@ -700,6 +773,15 @@ public:
      */
     bool getLagrangianStructureIsActivated(int structure_id, int level_number) const;
 
+    /*!
+     * \brief Get the ranges [first, second) of the Lagrangian indices of the
+     * inactivated structures on the specified level, sorted by their first
+     * indices.
+     *
+     * \note The ranges are the same for all MPI processes.
+     */
+    std::vector<std::pair<int, int> > getInactivatedLagrangianIndexRanges(int level_number) const;
+
     /*!
      * \brief Set the components of the supplied LData object to zero
      * for those entries that correspond to inactivated structures.
@@ -722,7 +804,8 @@ public:
      * \brief Scatter data from the Lagrangian ordering to the global PETSc
      * ordering.
      *
-     * \todo Optimize the implementation of this method.
+     * \note The VecScatter used by this method is cached and reused until the
+     * Lagrangian nodes are redistributed.
      */
     void scatterLagrangianToPETSc(Vec& lagrangian_vec, Vec& petsc_vec, int level_number) const;
 
@@ -730,21 +813,24 @@ public:
      * \brief Scatter data from the global PETSc ordering to the Lagrangian
      * ordering.
      *
-     * \todo Optimize the implementation of this method.
+     * \note The VecScatter used by this method is cached and reused until the
+     * Lagrangian nodes are redistributed.
      */
     void scatterPETScToLagrangian(Vec& petsc_vec, Vec& lagrangian_vec, int level_number) const;
 
     /*!
      * \brief Scatter data from a distributed PETSc vector to all processors.
      *
-     * \todo Optimize the implementation of this method.
+     * \note The VecScatter used by this method is cached and reused until the
+     * Lagrangian nodes are redistributed.
      */
     void scatterToAll(Vec& parallel_vec, Vec& sequential_vec) const;
 
     /*!
      * \brief Scatter data from a distributed PETSc vector to processor zero.
      *
-     * \todo Optimize the implementation of this method.
+     * \note The VecScatter used by this method is cached and reused until the
+     * Lagrangian nodes are redistributed.
      */
     void scatterToZero(Vec& parallel_vec, Vec& sequential_vec) const;
 
@@ -950,6 +1036,21 @@ private:
      */
     void scatterData(Vec& lagrangian_vec, Vec& petsc_vec, int level_number, ScatterMode mode) const;
 
+    /*!
+     * \brief Destroy the cached VecScatter objects used by scatterData(),
+     * scatterToAll(), and scatterToZero() and the pooled scratch data, all of
+     * which depend on the distribution of the Lagrangian nodes.
+     */
+    void clearLayoutDependentCaches();
+
+    /*!
+     * \brief Update the indexing data cached by the LNodeSetData objects on the
+     * specified level after a change in the set of inactivated structures, so
+     * that the nodes of inactivated structures are skipped when spreading and
+     * interpolating.
+     */
+    void updateInactivatedIndexCaches(int level_number);
+
     /*!
      * \brief Begin the process of refilling nonlocal Lagrangian quantities over
      * the specified range of levels in the patch hierarchy.
@@ -968,6 +1069,13 @@ private:
      */
     void endNonlocalDataFill(int coarsest_ln = -1, int finest_ln = -1);
 
+    /*!
+     * Tag the cells of the specified level that are covered by the bounding
+     * boxes of the cells that contain nodes on each patch of the next finer
+     * level.  See setUseBoundingBoxTagging().
+     */
+    void tagCellsInNodeBoundingBoxes(int level_number, int tag_index);
+
     /*!
      * Determines the global Lagrangian and PETSc indices of the local and
      * nonlocal nodes associated with the processor as well as the local PETSc
@@ -1054,6 +1162,7 @@ private:
      */
     SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > d_visit_writer;
     SAMRAI::tbox::Pointer<LSiloDataWriter> d_silo_writer;
+    SAMRAI::tbox::Pointer<LHDF5DataWriter> d_hdf5_writer;
 
     /*
      * We cache a pointer to the load balancer.
@@ -1112,6 +1221,24 @@ private:
      */
     bool d_error_if_points_leave_domain;
 
+    /*
+     * Whether to order the local nodes along a Hilbert curve. See
+     * setUseSpaceFillingCurveNodeOrdering().
+     */
+    bool d_use_sfc_node_ordering = false;
+
+    /*
+     * Whether to tag cells using the bounding boxes of the nodes on each patch.
+     * See setUseBoundingBoxTagging().
+     */
+    bool d_use_bounding_box_tagging = false;
+
+    /*
+     * Whether to update ghost values through shared-memory windows. See
+     * setUseSharedMemoryGhostUpdates().
+     */
+    bool d_use_shared_memory_ghost_updates = false;
+
     /*
      * SAMRAI::hier::IntVector object that determines the ghost cell width of
      * the LNodeData SAMRAI::hier::PatchData objects.
@@ -1227,12 +1354,31 @@ private:
      */
     std::vector<std::vector<int> > d_nonlocal_petsc_indices;
 
+    /*!
+     * Cached VecScatter objects used by scatterData() (indexed by level number)
+     * and by scatterToAll() and scatterToZero().  The scatters are indexed by
+     * the parallel layouts of the vectors and are destroyed whenever the
+     * distribution of the Lagrangian nodes changes.
+     */
+    mutable std::vector<std::map<std::vector<int>, VecScatter> > d_lag_petsc_scatters;
+    mutable std::map<std::vector<int>, VecScatter> d_scatters_to_all, d_scatters_to_zero;
+
+    /*!
+     * Pools of temporary Lagrangian data, indexed by level number and depth.
+     */
+    std::vector<std::map<unsigned int, std::vector<SAMRAI::tbox::Pointer<LData> > > > d_scratch_lag_data;
+
     /*!
      * Container for additional user defined Lagrangian data
      */
     std::map<std::string, int> d_user_defined_ldata;
 
     //\}
+
+    /*!
+     * Identifier of the reporter registered with MemoryMonitor.
+     */
+    int d_memory_reporter_id = -1;
 };
 } // namespace IBTK
 
@@ -84,6 +84,46 @@ public:
 
     /*!
      * \brief Set configuration options from a user-supplied database.
+     *
+     * The following options are supported:
+     *
+     * - <code>use_fortran_kernels</code>: by default, the PIECEWISE_LINEAR,
+     *   IB_3, IB_4, IB_6, and BSPLINE_3 through BSPLINE_6 kernels are evaluated
+     *   by compiled C++ implementations in which the kernel width is a template
+     *   parameter.  Setting this option to TRUE reverts to the Fortran
+     *   implementations of these kernels.  Default value: FALSE.
+     *
+     * - <code>marker_ordering</code>: the order in which the markers on each
+     *   patch are processed during interpolation and spreading.  With the
+     *   default value NONE, markers are processed in the order in which they
+     *   are provided.  Choosing ROW_MAJOR or MORTON sorts the markers by the
+     *   Cartesian index of the grid cell that contains them (in the storage
+     *   order of the patch data or in Morton Z-order, respectively) to improve
+     *   the locality of the patch data accesses.  Interpolated values are
+     *   unaffected by the ordering; spread values are affected only by changes
+     *   in the order of floating-point summation.  Default value: NONE.
+     *
+     * - <code>use_threaded_spreading</code>: whether to use OpenMP threads to
+     *   spread the markers on each patch when using one of the compiled
+     *   kernels listed above.  Markers are grouped into slabs of grid cells so
+     *   that threads never update the same grid cell concurrently, and the
+     *   results do not depend on the number of threads.  This option requires
+     *   IBTK to be compiled with OpenMP enabled (e.g., by adding -fopenmp to
+     *   CXXFLAGS) and is otherwise ignored.  Default value: FALSE.
+     *
+     * - <code>cache_interaction_plans</code>: whether to cache the kernel
+     *   stencils and weights computed for the markers on each patch when using
+     *   one of the compiled kernels listed above.  A cached plan is reused
+     *   whenever the same markers are at exactly the same positions on the
+     *   same patch, so that repeated interpolation and spreading with fixed
+     *   structure positions (e.g., within the Krylov iterations of implicit
+     *   and constraint-based IB solvers) only needs to gather and scatter the
+     *   patch data.  Threaded spreading does not use cached plans.  Default
+     *   value: FALSE.
+     *
+     * - <code>max_cached_interaction_plans</code>: the maximum number of
+     *   cached plans.  When this number is exceeded, the least recently used
+     *   plan is discarded.  Default value: 1024.
      */
     static void setFromDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
@@ -92,6 +132,13 @@ public:
      */
     static void printClassData(std::ostream& os);
 
+    /*!
+     * \brief Free all interaction plans cached by interpolate() and spread().
+     *
+     * \see setFromDatabase()
+     */
+    static void clearInteractionPlans();
+
     /*!
      * \brief Returns the interpolation/spreading stencil corresponding to the
      * specified kernel function.
@@ -110,6 +157,28 @@ public:
      */
     static int getMinimumGhostWidth(const std::string& kernel_fcn);
 
+    /*!
+     * \brief Compute the one-dimensional stencil and weights of the specified
+     * kernel function, using the same conventions as interpolate() and
+     * spread().
+     *
+     * \param X_o_dx The position of the point, in units of the grid spacing,
+     * relative to the lower side of grid cell 0.  The weight of grid cell i
+     * is determined by the distance from the point to the center of cell i,
+     * i.e., to position i + 1/2.
+     *
+     * \param lower Set to the index of the first grid cell in the stencil.
+     *
+     * \param w Set to the weights of the grid cells in the stencil.  Must have
+     * room for at least getStencilSize(kernel_fcn) values.
+     *
+     * \return The number of grid cells in the stencil.
+     *
+     * \note This function is only available for the kernels that have compiled
+     * C++ implementations (see setFromDatabase()).
+     */
+    static int computeKernelWeights(const std::string& kernel_fcn, double X_o_dx, int& lower, double* w);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
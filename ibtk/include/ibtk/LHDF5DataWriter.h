@@ -0,0 +1,366 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_LHDF5DataWriter
+#define included_IBTK_LHDF5DataWriter
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "IntVector.h"
+#include "PatchHierarchy.h"
+#include "tbox/Pointer.h"
+#include "tbox/Serializable.h"
+
+#include "petscao.h"
+#include "petscvec.h"
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace IBTK
+{
+class LData;
+} // namespace IBTK
+namespace SAMRAI
+{
+namespace tbox
+{
+class Database;
+} // namespace tbox
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class LHDF5DataWriter provides functionality to output Lagrangian
+ * data for visualization in the HDF5 data format, along with XDMF files that
+ * describe the layout of the data to visualization tools such as <A
+ * HREF="http://www.paraview.org">ParaView</A> and <A
+ * HREF="http://www.llnl.gov/visit">VisIt</A>.
+ *
+ * Unlike LSiloDataWriter, which writes one Silo file per MPI process, this
+ * class writes all of the data for each plot dump to a single HDF5 file.  The
+ * coordinates and variables on each patch level are stored in Lagrangian
+ * index order as two-dimensional datasets, and the marker clouds, logically
+ * Cartesian blocks, and unstructured meshes are described in the XDMF file as
+ * hyperslabs of those datasets.  When HDF5 is built with parallel support, the
+ * datasets are written with collective MPI-IO; otherwise, the data are
+ * gathered to and written by the root MPI process.
+ *
+ * Each plot dump produces the files lag_data.cycle_NNNNNN.h5 and
+ * lag_data.cycle_NNNNNN.xmf in the dump directory, and the XDMF file
+ * lag_data.xmf collects all of the dumps into a single time series.  If
+ * setUseTimeSeriesFile() is used to enable time-series output, the data for
+ * all dumps are instead appended to the HDF5 file lag_data.h5.
+ *
+ * The registration interface mirrors that of LSiloDataWriter.
+ */
+class LHDF5DataWriter : public SAMRAI::tbox::Serializable
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param object_name           String used for error reporting.
+     * \param dump_directory_name   String indicating the directory where visualization data is
+     *to
+     *be written.
+     * \param register_for_restart  Boolean indicating whether to register this object with the
+     *restart manager.
+     */
+    LHDF5DataWriter(std::string object_name, std::string dump_directory_name, bool register_for_restart = true);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~LHDF5DataWriter();
+
+    /*!
+     * \name Methods to set the hierarchy and range of levels.
+     */
+    //\{
+
+    /*!
+     * \brief Reset the patch hierarchy over which operations occur.
+     */
+    void setPatchHierarchy(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
+
+    /*!
+     * \brief Reset range of patch levels over which operations occur.
+     */
+    void resetLevels(int coarsest_ln, int finest_ln);
+
+    //\}
+
+    /*!
+     * \brief Register or update a range of Lagrangian indices that are to be
+     * visualized as a cloud of marker particles.
+     *
+     * \note This method is not collective over all MPI processes.  A particular
+     * cloud of markers must be registered on only \em one MPI process.
+     */
+    void registerMarkerCloud(const std::string& name, int nmarks, int first_lag_idx, int level_number);
+
+    /*!
+     * \brief Register or update a range of Lagrangian indices that are to be
+     * treated as a logically Cartesian block.
+     *
+     * \note This method is not collective over all MPI processes.  A particular
+     * block of indices must be registered on only \em one MPI process.
+     *
+     * \note XDMF structured meshes cannot represent periodic connectivity, so
+     * the periodic flags are accepted only for compatibility with
+     * LSiloDataWriter.
+     */
+    void registerLogicallyCartesianBlock(const std::string& name,
+                                         const SAMRAI::hier::IntVector<NDIM>& nelem,
+                                         const SAMRAI::hier::IntVector<NDIM>& periodic,
+                                         int first_lag_idx,
+                                         int level_number);
+
+    /*!
+     * \brief Register or update an unstructured mesh.
+     *
+     * \note This method is not collective over all MPI processes.  A particular
+     * collection of indices must be registered on only \em one MPI process.
+     */
+    void registerUnstructuredMesh(const std::string& name,
+                                  const std::multimap<int, std::pair<int, int> >& edge_map,
+                                  int level_number);
+
+    /*!
+     * \brief Register the coordinates of the curvilinear mesh with the HDF5
+     * data writer.
+     */
+    void registerCoordsData(SAMRAI::tbox::Pointer<LData> coords_data, int level_number);
+
+    /*!
+     * \brief Register a variable for plotting with the HDF5 data writer.
+     */
+    void registerVariableData(const std::string& var_name, SAMRAI::tbox::Pointer<LData> var_data, int level_number);
+
+    /*!
+     * \brief Register a variable for plotting with the HDF5 data writer with a
+     * specified starting depth and data depth.
+     */
+    void registerVariableData(const std::string& var_name,
+                              SAMRAI::tbox::Pointer<LData> var_data,
+                              int start_depth,
+                              int var_depth,
+                              int level_number);
+
+    /*!
+     * \brief Register or update a single Lagrangian AO (application ordering)
+     * objects with the HDF5 data writer.
+     *
+     * These AO objects are used to map between (fixed) Lagrangian indices and
+     * (time-dependent) PETSc indices.  Each time that the AO objects are reset
+     * (e.g., during adaptive regridding), the new AO objects must be supplied
+     * to the HDF5 data writer.
+     */
+    void registerLagrangianAO(AO& ao, int level_number);
+
+    /*!
+     * \brief Register or update a collection of Lagrangian AO (application
+     * ordering) objects with the HDF5 data writer.
+     *
+     * These AO objects are used to map between (fixed) Lagrangian indices and
+     * (time-dependent) PETSc indices.  Each time that the AO objects are reset
+     * (e.g., during adaptive regridding), the new AO objects must be supplied
+     * to the HDF5 data writer.
+     */
+    void registerLagrangianAO(std::vector<AO>& ao, int coarsest_ln, int finest_ln);
+
+    /*!
+     * \brief Write the data for all plot dumps to a single HDF5 file.
+     *
+     * By default, each plot dump is written to its own HDF5 file.
+     */
+    void setUseTimeSeriesFile(bool use_time_series_file);
+
+    /*!
+     * \brief Set the deflate compression level used for the HDF5 datasets.
+     *
+     * Compressed datasets are stored in chunks.  A value of zero, which is the
+     * default, disables compression.
+     *
+     * \note Parallel HDF5 supports compressed datasets only in versions 1.10.2
+     * and later.  Compression is disabled when an earlier version is used.
+     */
+    void setCompressionLevel(int compression_level);
+
+    /*!
+     * \brief Write the plot data to disk.
+     */
+    void writePlotData(int time_step_number, double simulation_time);
+
+    /*!
+     * Write out object state to the given database.
+     *
+     * When assertion checking is active, database pointer must be non-null.
+     */
+    void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db) override;
+
+protected:
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    LHDF5DataWriter() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    LHDF5DataWriter(const LHDF5DataWriter& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    LHDF5DataWriter& operator=(const LHDF5DataWriter& that) = delete;
+
+    /*!
+     * \brief Check that no other mesh on the specified level has already been
+     * registered with the given name.
+     */
+    void checkMeshName(const std::string& name, int level_number, const std::string& caller) const;
+
+    /*!
+     * \brief Destroy the PETSc objects used to communicate the plot data on
+     * the specified level.
+     */
+    void destroyVecScatters(int level_number);
+
+    /*!
+     * \brief Build the VecScatter objects required to communicate the plot
+     * data on the specified level into Lagrangian index order.
+     */
+    void buildVecScatters(AO& ao, int level_number);
+
+    /*!
+     * \brief Copy the locally owned portion of a Vec, in Lagrangian index
+     * order, into a buffer.
+     */
+    void copyToLocalBuffer(std::vector<double>& buffer, Vec global_vec, int depth, int level_number);
+
+    /*!
+     * Read object state from the restart file and initialize class data
+     * members.  The database from which the restart data is read is determined
+     * by the object_name specified in the constructor.
+     *
+     * Unrecoverable Errors:
+     *
+     *    -   The database corresponding to object_name is not found in the
+     *        restart file.
+     *
+     *    -   The class version number and restart version number do not match.
+     *
+     */
+    void getFromRestart();
+
+    /*
+     * The object name is used as a handle to databases stored in restart files
+     * and for error reporting purposes.  The boolean is used to control restart
+     * file writing operations.
+     */
+    std::string d_object_name;
+    bool d_registered_for_restart;
+
+    /*
+     * The directory where data is to be dumped and the most recent time step
+     * number at which data was dumped.
+     */
+    std::string d_dump_directory_name;
+    int d_time_step_number = -1;
+
+    /*
+     * Output settings.
+     */
+    bool d_use_time_series_file = false;
+    int d_compression_level = 0;
+
+    /*
+     * The names of the XDMF files written for each plot dump, which are
+     * collected into the time-series XDMF file, and whether the time-series
+     * HDF5 file has been created.
+     */
+    std::vector<std::string> d_xdmf_file_names;
+    bool d_time_series_file_created = false;
+
+    /*
+     * Grid hierarchy information.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
+    int d_coarsest_ln = 0, d_finest_ln = 0;
+
+    /*
+     * Information about the indices in the local marker clouds.
+     */
+    std::vector<int> d_nclouds;
+    std::vector<std::vector<std::string> > d_cloud_names;
+    std::vector<std::vector<int> > d_cloud_nmarks, d_cloud_first_lag_idx;
+
+    /*
+     * Information about the indices in the logically Cartesian subgrids.
+     */
+    std::vector<int> d_nblocks;
+    std::vector<std::vector<std::string> > d_block_names;
+    std::vector<std::vector<SAMRAI::hier::IntVector<NDIM> > > d_block_nelems;
+    std::vector<std::vector<int> > d_block_first_lag_idx;
+
+    /*
+     * Information about the edges in the unstructured meshes.
+     */
+    std::vector<int> d_nucd_meshes;
+    std::vector<std::vector<std::string> > d_ucd_mesh_names;
+    std::vector<std::vector<std::vector<std::pair<int, int> > > > d_ucd_mesh_edges;
+
+    /*
+     * Coordinates and variable data for plotting.
+     */
+    std::vector<SAMRAI::tbox::Pointer<LData> > d_coords_data;
+
+    std::vector<int> d_nvars;
+    std::vector<std::vector<std::string> > d_var_names;
+    std::vector<std::vector<int> > d_var_start_depths, d_var_plot_depths, d_var_depths;
+    std::vector<std::vector<SAMRAI::tbox::Pointer<LData> > > d_var_data;
+
+    /*
+     * Data for obtaining the locally owned range of Lagrangian indices.
+     */
+    std::vector<AO> d_ao;
+    std::vector<bool> d_build_vec_scatters;
+    std::vector<int> d_num_nodes, d_num_local_nodes, d_first_local_node;
+    std::vector<std::map<int, Vec> > d_dst_vec;
+    std::vector<std::map<int, VecScatter> > d_vec_scatter;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_LHDF5DataWriter
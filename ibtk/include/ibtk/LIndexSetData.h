@@ -22,6 +22,7 @@
 #include "IntVector.h"
 #include "tbox/Pointer.h"
 
+#include <utility>
 #include <vector>
 
 namespace SAMRAI
@@ -63,9 +64,23 @@ public:
 
     /*!
      * \brief Update the cached indexing data.
+     *
+     * Nodes whose Lagrangian indices lie in one of the half-open ranges
+     * [first, second) of \p inactive_lag_idx_ranges, which must be sorted and
+     * disjoint, are omitted from the cached indexing data, so that they are
+     * skipped when spreading and interpolating. The nodes themselves are
+     * retained by the patch data.
      */
     void cacheLocalIndices(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift);
+                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                           const std::vector<std::pair<int, int> >& inactive_lag_idx_ranges = {});
+
+    /*!
+     * \return Whether the node with the given Lagrangian index is included in
+     * the cached indexing data, i.e., whether it does not belong to one of the
+     * inactive index ranges provided to cacheLocalIndices().
+     */
+    bool isActiveLagrangianIndex(int lag_idx) const;
 
     /*!
      * \return A constant reference to the set of Lagrangian data indices that
@@ -171,6 +186,7 @@ private:
     std::vector<int> d_global_petsc_indices, d_interior_global_petsc_indices, d_ghost_global_petsc_indices;
     std::vector<int> d_local_petsc_indices, d_interior_local_petsc_indices, d_ghost_local_petsc_indices;
     std::vector<double> d_periodic_shifts, d_interior_periodic_shifts, d_ghost_periodic_shifts;
+    std::vector<std::pair<int, int> > d_inactive_lag_idx_ranges;
 };
 } // namespace IBTK
 
@@ -112,6 +112,24 @@ public:
     static void collectMarkersOnPatchHierarchy(int mark_idx,
                                                SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
 
+    /*!
+     * Move markers that have crossed patch boundaries to the patches that now
+     * contain them, without changing the patch hierarchy.
+     *
+     * This is an incremental alternative to collecting all markers on the
+     * coarsest level with collectMarkersOnPatchHierarchy() and refining them
+     * again, which is intended to be used after marker positions have been
+     * updated between regridding operations (e.g., by eulerStep(),
+     * midpointStep(), or trapezoidalStep()).  Markers are only exchanged among
+     * neighboring patches of the same level through the ghost cells of the
+     * marker data, and only the markers that leave or enter the region covered
+     * by a level are transferred to the next coarser or finer level.
+     *
+     * \note Markers must not move farther than the ghost cell width of the
+     * marker data since the last time that they were assigned to patches.
+     */
+    static void migrateMarkers(int mark_idx, SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
+
     /*!
      * Initialize marker data on the specified level of the patch hierarchy by
      * refining markers from coarser levels in the patch hierarchy or by copying
@@ -23,6 +23,7 @@
 #include "IntVector.h"
 #include "tbox/Pointer.h"
 
+#include <cstddef>
 #include <vector>
 
 namespace SAMRAI
@@ -52,6 +53,25 @@ namespace IBTK
 class LNode : public LNodeIndex
 {
 public:
+    /*!
+     * \brief Allocate the storage for an LNode object from a pool of
+     * fixed-size blocks.
+     *
+     * Simulations may create millions of nodes.  Allocating each one
+     * separately from the heap is slow and fragments memory, so nodes are
+     * carved out of large chunks.  Freed blocks are kept for reuse by later
+     * nodes.
+     *
+     * \note The pool is not thread-safe: nodes must not be created or
+     * destroyed concurrently by multiple threads.
+     */
+    static void* operator new(std::size_t size);
+
+    /*!
+     * \brief Return the storage of an LNode object to the pool.
+     */
+    static void operator delete(void* ptr, std::size_t size);
+
     /*!
      * \brief Default constructor.
      *
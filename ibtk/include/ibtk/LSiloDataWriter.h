@@ -27,6 +27,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -179,6 +180,78 @@ public:
      */
     void registerLagrangianAO(std::vector<AO>& ao, int coarsest_ln, int finest_ln);
 
+    /*!
+     * \brief Set the number of Silo files written for each plot dump.
+     *
+     * By default, each MPI process writes its own file.  If the number of files
+     * is smaller than the number of MPI processes, the processes are divided
+     * into contiguous groups, and the processes in each group take turns
+     * writing their data to the file of the group.  A nonpositive value
+     * restores the default behavior.
+     */
+    void setNumberOfOutputFiles(int num_files);
+
+    /*!
+     * \brief Set the compression of the local plot data.
+     *
+     * The string is passed to DBSetCompression() and has the form used by the
+     * Silo library, e.g., "METHOD=GZIP LEVEL=1" for lossless compression or
+     * "METHOD=FPZIP LOSS=16" for lossy compression.  An empty string disables
+     * compression.  Since the Silo library compresses data only in HDF5 files,
+     * the local files are written with the HDF5 driver whenever compression is
+     * enabled for any data, which requires a Silo library built with HDF5.
+     *
+     * By default, the data are not compressed.
+     */
+    void setCompression(const std::string& compression);
+
+    /*!
+     * \brief Set the compression of a registered variable, overriding the
+     * compression set by setCompression().  The value "NONE" disables
+     * compression of the variable and an empty string restores the default.
+     */
+    void setVariableCompression(const std::string& var_name, const std::string& compression, int level_number);
+
+    /*!
+     * \brief Enable or disable asynchronous writing of the local plot data.
+     *
+     * When asynchronous writes are enabled, writePlotData() copies the local
+     * data into staging buffers and writes the local Silo file from a
+     * background thread, so that the simulation may continue while the data
+     * are written to disk.  Only one write is in flight at a time in the
+     * process, and all LSiloDataWriter and IBInstrumentPanel objects, which
+     * are the only users of the Silo library in IBAMR, wait for it to complete
+     * before they call the Silo library.  The pending write is also completed
+     * before the writer's state is written to a restart file.
+     *
+     * Asynchronous writes use only the Silo PDB driver, which does not call
+     * HDF5, so that HDF5 output on the main thread (e.g., by
+     * SAMRAI::appu::VisItDataWriter or the restart manager) cannot run
+     * concurrently with HDF5 calls on the background thread.  Consequently,
+     * this setting is ignored when compression is enabled (which requires the
+     * HDF5 driver) and when grouped output files are used.
+     *
+     * By default, asynchronous writes are disabled.
+     */
+    void setUseAsynchronousWrites(bool use_async_writes);
+
+    /*!
+     * \brief Block until any pending asynchronous write has completed.
+     *
+     * \note Because only one asynchronous write is in flight at a time in the
+     * process, this function is equivalent to waitForAllPendingWrites().
+     */
+    void waitForPendingWrites();
+
+    /*!
+     * \brief Block until any pending asynchronous write by any LSiloDataWriter
+     * object has completed.
+     *
+     * This function must be called before the Silo library is used by code
+     * other than this class.
+     */
+    static void waitForAllPendingWrites();
+
     /*!
      * \brief Write the plot data to disk.
      */
@@ -226,6 +299,31 @@ private:
      */
     void buildVecScatters(AO& ao, int level_number);
 
+    /*!
+     * \brief Copy the locally plotted portion of a Vec into a staging buffer.
+     */
+    void copyToLocalBuffer(std::vector<double>& buffer, Vec global_vec, int depth, int level_number);
+
+    /*!
+     * \brief Determine whether the local Silo files are written with the HDF5
+     * driver, which is the case whenever any data are compressed.
+     */
+    bool useHDF5Driver() const;
+
+    /*!
+     * \brief Write the staged local data to the specified Silo file.
+     *
+     * \note This function does not perform any MPI communication, so that it
+     * may be called from a background thread.
+     */
+    void writeLocalPlotData(const std::string& file_name,
+                            bool create_file,
+                            const std::string& proc_dirname,
+                            const std::vector<std::vector<double> >& X_data,
+                            const std::vector<std::vector<std::vector<double> > >& var_data,
+                            int time_step_number,
+                            double simulation_time);
+
     /*!
      * Read object state from the restart file and initialize class data
      * members.  The database from which the restart data is read is determined
@@ -259,6 +357,31 @@ private:
      */
     int d_time_step_number = -1;
 
+    /*
+     * The number of Silo files written for each plot dump.  A nonpositive
+     * value indicates that each MPI process writes its own file.
+     */
+    int d_num_output_files = -1;
+
+    /*
+     * Asynchronous write settings.
+     */
+    bool d_use_async_writes = false;
+
+    /*
+     * The thread used to write the local data asynchronously.  The Silo
+     * library is not thread safe, so there is one such thread per process,
+     * which is shared by all LSiloDataWriter objects and which is joined
+     * before the Silo library is used by the main thread.  The thread never
+     * uses the HDF5 driver.
+     */
+    static std::thread s_write_thread;
+
+    /*
+     * The default compression of the plot data.
+     */
+    std::string d_compression;
+
     /*
      * Grid hierarchy information.
      */
@@ -308,6 +431,7 @@ private:
     std::vector<int> d_nvars;
     std::vector<std::vector<std::string> > d_var_names;
     std::vector<std::vector<int> > d_var_start_depths, d_var_plot_depths, d_var_depths;
+    std::vector<std::vector<std::string> > d_var_compressions;
     std::vector<std::vector<SAMRAI::tbox::Pointer<LData> > > d_var_data;
 
     /*
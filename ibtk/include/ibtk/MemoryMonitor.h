@@ -0,0 +1,185 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_MemoryMonitor
+#define included_IBTK_MemoryMonitor
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "PatchHierarchy.h"
+#include "tbox/Pointer.h"
+
+#include "petscmat.h"
+#include "petscvec.h"
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class MemoryMonitor records the number of bytes used on each process
+ * by the major data structures of a simulation, grouped into named categories
+ * (e.g., Eulerian patch data, libMesh system vectors, or PETSc matrices), and
+ * summarizes the usage across all processes.
+ *
+ * Objects that own large data structures register a reporter, i.e., a function
+ * that returns the number of bytes currently used by the object, under a
+ * category name.  The reporters of a category are summed.  Each call to
+ * sample() evaluates all reporters and updates the high-water mark of each
+ * category.  The top-level HierarchyIntegrator samples the usage at the end of
+ * each time step and after each regrid, and prints the current usage to the
+ * log file after each regrid if logging is enabled.
+ *
+ * Monitoring is disabled by default, in which case sample() does nothing.  A
+ * typical application enables monitoring after initialization and prints the
+ * summary at the end of the run:
+ *
+ * \code
+ * MemoryMonitor::setEnabled(true);
+ * // ... time step loop ...
+ * MemoryMonitor::printSummary(pout);
+ * \endcode
+ *
+ * The summary is also printed by PerformanceMonitor::printSummary() if memory
+ * monitoring is enabled.
+ *
+ * In addition to the registered categories, the summary reports the memory
+ * allocated by PETSc (which is nonzero only if PETSc is tracking its
+ * allocations, e.g., when running with <TT>-malloc_debug</TT>) and the
+ * resident set size of each process.
+ *
+ * \note The reported numbers of bytes are estimates of the sizes of the
+ * underlying arrays and do not include the overhead of the containers that
+ * hold them.  Categories may overlap: e.g., the patch data cloned by
+ * SAMRAIDataCache objects are also included in the Eulerian patch data.
+ */
+class MemoryMonitor
+{
+public:
+    /*!
+     * \brief Function type used to report the number of bytes used by an
+     * object.
+     */
+    using Reporter = std::function<std::size_t()>;
+
+    /*!
+     * \brief Enable or disable monitoring.
+     */
+    static void setEnabled(bool enabled);
+
+    /*!
+     * \brief Return whether monitoring is enabled.
+     */
+    static inline bool isEnabled()
+    {
+        return s_enabled;
+    } // isEnabled
+
+    /*!
+     * \brief Register a reporter under the named category and return an
+     * identifier that may be used to unregister the reporter.
+     *
+     * If \p key is not null, only one of the reporters of the category that
+     * were registered with the same key is evaluated.  This permits objects
+     * that share data (e.g., several FEData objects that use the same
+     * EquationSystems object) to register reporters independently.
+     *
+     * \note Objects that register reporters that refer to the object itself
+     * must unregister them before they are destroyed.
+     */
+    static int registerReporter(const std::string& category, Reporter reporter, const void* key = nullptr);
+
+    /*!
+     * \brief Unregister the reporter with the given identifier.
+     *
+     * \note Invalid identifiers (e.g., -1) are ignored.
+     */
+    static void unregisterReporter(int reporter_id);
+
+    /*!
+     * \brief Evaluate all reporters and update the high-water mark of each
+     * category if monitoring is enabled.
+     *
+     * \note This function is not collective.
+     */
+    static void sample();
+
+    /*!
+     * \brief Discard all recorded high-water marks.
+     */
+    static void reset();
+
+    /*!
+     * \brief Print a table that summarizes the most recently sampled usage of
+     * each category across all processes.
+     *
+     * \note This function is collective and must be called by all processes.
+     */
+    static void printUsage(std::ostream& os);
+
+    /*!
+     * \brief Print a table that summarizes the high-water mark of each category
+     * across all processes.
+     *
+     * \note This function is collective and must be called by all processes.
+     */
+    static void printSummary(std::ostream& os);
+
+    /*!
+     * \brief Return the number of bytes used by all patch data allocated on the
+     * local patches of the hierarchy.
+     */
+    static std::size_t getPatchDataMemory(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
+
+    /*!
+     * \brief Return the number of bytes used by the patch data with the given
+     * index allocated on the local patches of the hierarchy.
+     */
+    static std::size_t getPatchDataMemory(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                          int data_idx);
+
+    /*!
+     * \brief Return the number of bytes used by the local part of a PETSc
+     * vector, including its ghost entries if it is a ghosted vector.
+     */
+    static std::size_t getVecMemory(Vec vec);
+
+    /*!
+     * \brief Return the number of bytes used by the local part of a PETSc
+     * matrix.
+     */
+    static std::size_t getMatMemory(Mat mat);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    MemoryMonitor() = delete;
+
+    /*!
+     * Whether monitoring is enabled.
+     */
+    static bool s_enabled;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_MemoryMonitor
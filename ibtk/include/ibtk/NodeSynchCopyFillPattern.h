@@ -17,11 +17,13 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "Box.h"
+#include "BoxArray.h"
 #include "IntVector.h"
 #include "VariableFillPattern.h"
 #include "tbox/Pointer.h"
 
 #include <string>
+#include <vector>
 
 namespace SAMRAI
 {
@@ -50,6 +52,14 @@ namespace IBTK
  * be shared by more than two patches.  For instance, to synchronize nodal
  * values in three spatial dimensions, we first synchronize values in the x
  * direction, then in the y direction, and finally in the z direction.
+ *
+ * Alternatively, the pattern can be constructed from the boxes of a patch level
+ * to synchronize the values along all axes with a single communication
+ * schedule.
+ *
+ * Alternatively, the pattern can be constructed from the boxes of a patch level
+ * to synchronize the values along all axes with a single communication
+ * schedule.
  */
 class NodeSynchCopyFillPattern : public SAMRAI::xfer::VariableFillPattern<NDIM>
 {
@@ -59,6 +69,25 @@ public:
      */
     NodeSynchCopyFillPattern(unsigned int axis);
 
+    /*!
+     * \brief Constructor for a pattern that synchronizes the values along all
+     * axes at once on a patch level with the specified boxes.
+     *
+     * Each value that is shared by several patches is copied from the patch
+     * that "owns" it.  For each patch that contains the value, consider the set
+     * of directions in which the value lies on an upper boundary of the patch
+     * as a binary number in which direction d has weight 2^d.  The owner is the
+     * patch with the smallest such number.  These are the values obtained by
+     * synchronizing one axis at a time, but they are communicated by a single
+     * schedule.
+     *
+     * \param level_boxes     the boxes of the patch level
+     * \param periodic_shift  the periodic shift of the patch level, which is
+     *                        zero in directions that are not periodic
+     */
+    NodeSynchCopyFillPattern(const SAMRAI::hier::BoxArray<NDIM>& level_boxes,
+                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift);
+
     /*!
      * \brief Destructor
      */
@@ -132,6 +161,10 @@ private:
 
     SAMRAI::hier::IntVector<NDIM> d_stencil_width = 1;
     const unsigned int d_axis;
+
+    // The boxes of the patch level and their periodic images, which are used
+    // only when synchronizing all axes at once (i.e., when d_axis == NDIM).
+    std::vector<SAMRAI::hier::Box<NDIM> > d_level_boxes;
 };
 } // namespace IBTK
 
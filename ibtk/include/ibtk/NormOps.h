@@ -24,6 +24,8 @@ class SAMRAIVectorReal;
 } // namespace SAMRAI
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <vector>
+
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
 
 namespace IBTK
@@ -35,6 +37,17 @@ namespace IBTK
 class NormOps
 {
 public:
+    /*!
+     * \brief Struct Norms holds the quantities computed by norms().
+     */
+    struct Norms
+    {
+        double L1_norm = 0.0;
+        double L2_norm = 0.0;
+        double max_norm = 0.0;
+        double dot = 0.0;
+    };
+
     /*!
      * \brief Compute the discrete L1 norm of the SAMRAI vector.
      */
@@ -50,6 +63,23 @@ public:
      */
     static double maxNorm(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>* samrai_vector, bool local_only = false);
 
+    /*!
+     * \brief Compute the discrete L1, L2, and max-norms of the SAMRAI vector x
+     * and, if y is not null, the discrete inner product of x and y.
+     *
+     * All quantities are computed in a single traversal of the data and, unless
+     * local_only is true, combined with a single collective operation. This is
+     * cheaper than calling L1Norm(), L2Norm(), maxNorm(), and dot products
+     * separately when several of them are needed for the same vectors, e.g., in
+     * convergence checks.
+     *
+     * \note The vectors must have the same structure. The control volumes of x
+     * are used to weight all quantities.
+     */
+    static Norms norms(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>* x,
+                       const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>* y = nullptr,
+                       bool local_only = false);
+
 protected:
 private:
     /*!
@@ -88,6 +118,19 @@ private:
      * \brief Compute the local L2 norm.
      */
     static double L2Norm_local(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>* samrai_vector);
+
+    /*!
+     * \brief Compute the contributions of each local patch to the sums of the
+     * absolute values and the squares of the entries of x and of the products
+     * of the entries of x and y (if y is not null), and the local max-norm of
+     * x.
+     */
+    static void computeLocalSums(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>* x,
+                                 const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>* y,
+                                 std::vector<double>& L1_sum_patch,
+                                 std::vector<double>& L2_sum_patch,
+                                 std::vector<double>& dot_sum_patch,
+                                 double& max_norm);
 };
 } // namespace IBTK
 
@@ -82,7 +82,16 @@ namespace IBTK
  *   is provided to the class constructor, memory management of that object is
  *   \em NOT handled by the PETScKrylovLinearSolver.  In particular, it is the
  *   caller's responsibility to ensure that the supplied KSP object is properly
- *   destroyed via KSPDestroy().
+ *   destroyed via KSPDestroy().  \par
+ * - The vector wrapper used by this class, PETScSAMRAIVectorReal, provides
+ *   the local (process-wise) inner product and norm kernels required by the
+ *   split-phase reductions VecDotBegin()/VecDotEnd(),
+ *   VecMDotBegin()/VecMDotEnd(), and VecNormBegin()/VecNormEnd().
+ *   Consequently, the pipelined Krylov methods provided by PETSc (e.g.,
+ *   <code>ksp_type = "pgmres"</code>, <code>"pipefgmres"</code>, or
+ *   <code>"pipecg"</code>) may be used to overlap global reductions with the
+ *   application of the operator and preconditioner.  Like FGMRES,
+ *   <code>"pipefgmres"</code> supports only right preconditioning.
  *
  * Sample parameters for initialization from database (and their default
  * values): \verbatim
@@ -19,6 +19,7 @@
 #include "ibtk/LinearSolver.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "Box.h"
 #include "CoarseFineBoundary.h"
 #include "IntVector.h"
 #include "PatchHierarchy.h"
@@ -64,8 +65,24 @@ namespace IBTK
  abs_residual_tol = 1.0e-50    // see setAbsoluteTolerance()
  max_iterations = 10000        // see setMaxIterations()
  enable_logging = FALSE        // see setLoggingEnabled()
+ agglomeration_factor = 1      // see below
+ reuse_subdomain_factorizations = FALSE  // see below
  \endverbatim
  *
+ * If agglomeration_factor is larger than one, the preconditioner is applied
+ * through a PETSc PCTELESCOPE, which gathers the patch level system onto a
+ * subcommunicator with agglomeration_factor times fewer processes.  This
+ * reduces the communication costs of solves on coarse levels that have only a
+ * few cells per process.  The inner solver may be configured at runtime using
+ * the options prefix of this solver followed by "telescope_".
+ *
+ * If reuse_subdomain_factorizations is TRUE, the subdomain matrices and solvers
+ * of the shell (additive or multiplicative Schwarz) preconditioner are kept
+ * when the solver state is deallocated.  When the solver is reinitialized on a
+ * patch level with the same local patch boxes and the same subdomains, the
+ * subdomain matrices are updated in place and are only refactored (numerically,
+ * reusing the symbolic factorization) if their values have changed.
+ *
  * PETSc is developed at the Argonne National Laboratory Mathematics and
  * Computer Science Division.  For more information about \em PETSc, see <A
  * HREF="http://www.mcs.anl.gov/petsc">http://www.mcs.anl.gov/petsc</A>.
@@ -294,6 +311,7 @@ protected:
      */
     //\{
     std::string d_ksp_type = KSPGMRES, d_pc_type = PCILU, d_shell_pc_type;
+    int d_agglomeration_factor = 1;
     std::string d_options_prefix;
     KSP d_petsc_ksp = nullptr;
     Mat d_petsc_mat = nullptr, d_petsc_pc = nullptr;
@@ -315,6 +333,16 @@ protected:
     std::vector<Vec> d_sub_x, d_sub_y;
     //\}
 
+    /*!
+     * \name Cached subdomain factorizations of the shell preconditioner.
+     */
+    //\{
+    bool d_reuse_subdomain_factorizations = false;
+    bool d_have_cached_subdomain_factorizations = false;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_cached_patch_boxes;
+    std::vector<std::vector<PetscInt> > d_cached_overlap_idxs;
+    //\}
+
     /*!
      * \name Field split preconditioner.
      */
@@ -344,6 +372,25 @@ private:
      */
     PETScLevelSolver& operator=(const PETScLevelSolver& that) = delete;
 
+    /*!
+     * \brief Determine whether the cached subdomain factorizations may be
+     * reused with the current patch level and subdomains.
+     *
+     * \note This function is collective.
+     */
+    bool canReuseSubdomainFactorizations() const;
+
+    /*!
+     * \brief Record the patch level and subdomains for which the subdomain
+     * factorizations were computed.
+     */
+    void cacheSubdomainLayout();
+
+    /*!
+     * \brief Destroy the cached subdomain matrices and solvers.
+     */
+    void destroySubdomainFactorizations();
+
     /*!
      * \brief Apply the preconditioner to \a x and store the result in \a y.
      */
@@ -26,6 +26,7 @@
 #include "petscvec.h"
 
 #include <cmath>
+#include <string>
 #include <vector>
 
 namespace SAMRAI
@@ -137,6 +138,27 @@ public:
                                               const std::vector<int>& num_dofs_per_proc,
                                               int dof_index_idx,
                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+
+    /*!
+     * \brief Construct a parallel PETSc Mat object corresponding to the
+     * side-centered IB interpolation operator for the named LEInteractor
+     * kernel function.
+     *
+     * The kernel weights are computed by LEInteractor::computeKernelWeights(),
+     * so the assembled operator uses exactly the same stencils as
+     * LEInteractor::interpolate().  The corresponding spreading operator is
+     * J^T / (cell volume).
+     *
+     * \warning This routine does not properly handle periodic or physical
+     * boundary conditions.
+     */
+    static void constructPatchLevelSCInterpOp(Mat& mat,
+                                              const std::string& kernel_fcn,
+                                              Vec& X_vec,
+                                              const std::vector<int>& num_dofs_per_proc,
+                                              int dof_index_idx,
+                                              SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+
     /*!
      * \brief Standard one-dimensional Peskin 4-pt delta function.
      *
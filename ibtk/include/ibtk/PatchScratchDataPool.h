@@ -0,0 +1,357 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_PatchScratchDataPool
+#define included_IBTK_PatchScratchDataPool
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "Box.h"
+#include "CellData.h"
+#include "CellDataFactory.h"
+#include "FaceData.h"
+#include "FaceDataFactory.h"
+#include "IntVector.h"
+#include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "SideData.h"
+#include "SideDataFactory.h"
+#include "tbox/Arena.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+#include <cstddef>
+#include <map>
+#include <new>
+#include <tuple>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PatchScratchDataPool is a utility class for reusing temporary
+ * patch data objects that are allocated within loops over patches.
+ *
+ * Whereas SAMRAIDataCache provides cloned patch data indices that are
+ * allocated over an entire patch hierarchy, this class provides individual
+ * patch data objects (SAMRAI::pdat::CellData, SAMRAI::pdat::FaceData, or
+ * SAMRAI::pdat::SideData objects) with a specified box, depth, and ghost cell
+ * width.  Objects obtained from the pool remain in use until
+ * restorePatchData() is called.
+ *
+ * The pool retains the memory of the patch data objects, not the objects
+ * themselves.  The memory is keyed by the patch data type, the shape of the
+ * box (i.e., the number of cells in each direction), the depth, and the ghost
+ * cell width, so that it is reused by all patches with boxes of the same
+ * shape, irrespective of their location in index space.  Each call to
+ * getPatchData() constructs a new patch data object on the requested box in
+ * previously allocated memory when such memory is available.
+ *
+ * Memory is retained across calls to restorePatchData(), so that patches of
+ * different shapes that are visited in turn (e.g., all of the patches of a
+ * level, each followed by a call to restorePatchData()) all reuse their own
+ * memory.  The amount of memory retained by the pool is limited by the value
+ * passed to the constructor: when restorePatchData() finds that the limit is
+ * exceeded, the memory that has gone unused for the largest number of calls
+ * to restorePatchData() is released first.
+ *
+ * A typical usage pattern is:
+ * \code
+ * for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+ * {
+ *     Pointer<SideData<NDIM, double> > scratch_data =
+ *         d_scratch_data_pool.getPatchData<SideData<NDIM, double> >(patch_box, depth, ghosts);
+ *     // ...
+ *     d_scratch_data_pool.restorePatchData();
+ * }
+ * \endcode
+ *
+ * \note The values stored in patch data objects obtained from the pool are not
+ * initialized.
+ *
+ * \note The pool is not thread safe.  Objects that use a pool from within
+ * threaded loops over patches must use a separate pool in each thread.
+ */
+class PatchScratchDataPool
+{
+public:
+    /*!
+     * \brief The default limit on the number of bytes retained by the pool.
+     */
+    static constexpr std::size_t DEFAULT_MAX_RETAINED_BYTES = 64 * 1024 * 1024;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param max_retained_bytes The maximum number of bytes of patch data
+     * memory that are retained by the pool after restorePatchData() is called.
+     */
+    PatchScratchDataPool(std::size_t max_retained_bytes = DEFAULT_MAX_RETAINED_BYTES)
+        : d_max_retained_bytes(max_retained_bytes)
+    {
+        // intentionally blank
+        return;
+    } // PatchScratchDataPool
+
+    /*!
+     * \brief Destructor.
+     */
+    ~PatchScratchDataPool() = default;
+
+    /*!
+     * \brief Get a patch data object of type PatchDataType that is not
+     * currently in use.
+     *
+     * PatchDataType must be SAMRAI::pdat::CellData,
+     * SAMRAI::pdat::FaceData, or SAMRAI::pdat::SideData.
+     */
+    template <class PatchDataType>
+    inline SAMRAI::tbox::Pointer<PatchDataType>
+    getPatchData(const SAMRAI::hier::Box<NDIM>& box, const int depth, const SAMRAI::hier::IntVector<NDIM>& ghosts)
+    {
+        const key_type key = construct_key(std::type_index(typeid(PatchDataType)), box, depth, ghosts);
+        Entry& entry = d_pool[key];
+        if (!entry.factory)
+        {
+            entry.factory = build_factory(static_cast<PatchDataType*>(nullptr), depth, ghosts);
+            entry.bytes = entry.factory->getSizeOfMemory(box);
+        }
+        if (entry.num_in_use == 0) d_entries_in_use.push_back(&entry);
+        entry.last_use = d_num_restores;
+        if (entry.num_in_use == entry.arenas.size())
+        {
+            entry.arenas.push_back(SAMRAI::tbox::Pointer<ScratchArena>());
+            d_retained_bytes += entry.bytes;
+        }
+        SAMRAI::tbox::Pointer<ScratchArena>& arena = entry.arenas[entry.num_in_use];
+        // Memory that is still used by a patch data object that was obtained
+        // previously (e.g., because the caller retains a pointer to it) is not
+        // reused.
+        if (!arena || arena->inUse()) arena = new ScratchArena(entry.bytes);
+        ++entry.num_in_use;
+        SAMRAI::tbox::Pointer<PatchDataType> data =
+            entry.factory->allocate(box, SAMRAI::tbox::Pointer<SAMRAI::tbox::Arena>(arena));
+        return data;
+    } // getPatchData
+
+    /*!
+     * \brief Indicate that none of the patch data objects obtained from the
+     * pool are in use, so that their memory may be reused by subsequent calls
+     * to getPatchData().
+     *
+     * If the memory retained by the pool exceeds the limit, the memory that
+     * has gone unused for the largest number of calls to this function is
+     * released until the limit is satisfied.
+     *
+     * \note Callers must not continue to use patch data objects after they have
+     * been restored to the pool.
+     */
+    inline void restorePatchData()
+    {
+        for (Entry* entry : d_entries_in_use) entry->num_in_use = 0;
+        d_entries_in_use.clear();
+        ++d_num_restores;
+        while (d_retained_bytes > d_max_retained_bytes)
+        {
+            auto lru_it = d_pool.begin();
+            for (auto it = d_pool.begin(); it != d_pool.end(); ++it)
+            {
+                if (it->second.last_use < lru_it->second.last_use) lru_it = it;
+            }
+            d_retained_bytes -= lru_it->second.arenas.size() * lru_it->second.bytes;
+            d_pool.erase(lru_it);
+        }
+        return;
+    } // restorePatchData
+
+    /*!
+     * \brief Deallocate all of the patch data memory managed by the pool.
+     */
+    inline void clear()
+    {
+        d_pool.clear();
+        d_entries_in_use.clear();
+        d_retained_bytes = 0;
+        return;
+    } // clear
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PatchScratchDataPool(const PatchScratchDataPool& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PatchScratchDataPool& operator=(const PatchScratchDataPool& that) = delete;
+
+    /*!
+     * \brief Memory arena that provides the memory of a single patch data
+     * object.
+     *
+     * Memory is allocated sequentially from a fixed buffer, and the buffer is
+     * reused once all of the memory allocated from it has been freed, i.e.,
+     * once the patch data object allocated from it has been destroyed.
+     * Requests that do not fit in the buffer are satisfied by the heap.
+     */
+    class ScratchArena : public SAMRAI::tbox::Arena
+    {
+    public:
+        explicit ScratchArena(const std::size_t bytes) : d_buffer(bytes)
+        {
+            // intentionally blank
+            return;
+        } // ScratchArena
+
+        void* alloc(const size_t bytes) override
+        {
+            ++d_num_allocations;
+            const std::size_t aligned_bytes = SAMRAI::tbox::Arena::align(bytes);
+            if (d_offset + aligned_bytes > d_buffer.size()) return ::operator new(bytes);
+            void* const p = d_buffer.data() + d_offset;
+            d_offset += aligned_bytes;
+            return p;
+        } // alloc
+
+        void free(void* p) override
+        {
+            const char* const c = static_cast<const char*>(p);
+            if (c < d_buffer.data() || c >= d_buffer.data() + d_buffer.size()) ::operator delete(p);
+            if (--d_num_allocations == 0) d_offset = 0;
+            return;
+        } // free
+
+        bool inUse() const
+        {
+            return d_num_allocations > 0;
+        } // inUse
+
+    private:
+        std::vector<char> d_buffer;
+        std::size_t d_offset = 0;
+        int d_num_allocations = 0;
+    };
+
+    /*!
+     * \brief Factories for the supported patch data types.
+     */
+    template <class TYPE>
+    static inline SAMRAI::tbox::Pointer<SAMRAI::hier::PatchDataFactory<NDIM> >
+    build_factory(const SAMRAI::pdat::CellData<NDIM, TYPE>* /*type_tag*/,
+                  const int depth,
+                  const SAMRAI::hier::IntVector<NDIM>& ghosts)
+    {
+        return new SAMRAI::pdat::CellDataFactory<NDIM, TYPE>(depth, ghosts);
+    } // build_factory
+
+    template <class TYPE>
+    static inline SAMRAI::tbox::Pointer<SAMRAI::hier::PatchDataFactory<NDIM> >
+    build_factory(const SAMRAI::pdat::FaceData<NDIM, TYPE>* /*type_tag*/,
+                  const int depth,
+                  const SAMRAI::hier::IntVector<NDIM>& ghosts)
+    {
+        return new SAMRAI::pdat::FaceDataFactory<NDIM, TYPE>(depth, ghosts, /*fine_boundary_represents_var*/ false);
+    } // build_factory
+
+    template <class TYPE>
+    static inline SAMRAI::tbox::Pointer<SAMRAI::hier::PatchDataFactory<NDIM> >
+    build_factory(const SAMRAI::pdat::SideData<NDIM, TYPE>* /*type_tag*/,
+                  const int depth,
+                  const SAMRAI::hier::IntVector<NDIM>& ghosts)
+    {
+        return new SAMRAI::pdat::SideDataFactory<NDIM, TYPE>(depth, ghosts, /*fine_boundary_represents_var*/ false);
+    } // build_factory
+
+    /*!
+     * \brief Key type for looking up pooled memory: the patch data type, the
+     * depth, and the number of cells of the box in each direction followed by
+     * the ghost cell width.
+     */
+    using key_type = std::tuple<std::type_index, int, std::vector<int> >;
+
+    /*!
+     * \brief Construct the key for looking up pooled memory.  The key does not
+     * depend on the location of the box in index space.
+     */
+    static inline key_type construct_key(const std::type_index& type,
+                                         const SAMRAI::hier::Box<NDIM>& box,
+                                         const int depth,
+                                         const SAMRAI::hier::IntVector<NDIM>& ghosts)
+    {
+        std::vector<int> layout(2 * NDIM);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            layout[d] = box.numberCells(d);
+            layout[NDIM + d] = ghosts(d);
+        }
+        return std::make_tuple(type, depth, layout);
+    } // construct_key
+
+    /*!
+     * \brief Pooled memory for patch data objects with a common key: the
+     * factory used to allocate the objects, the number of bytes required by
+     * each object, the number of arenas in use, the number of calls to
+     * restorePatchData() that preceded the most recent use of the entry, and
+     * the arenas.
+     */
+    struct Entry
+    {
+        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchDataFactory<NDIM> > factory;
+        std::size_t bytes = 0;
+        std::size_t num_in_use = 0;
+        std::size_t last_use = 0;
+        std::vector<SAMRAI::tbox::Pointer<ScratchArena> > arenas;
+    };
+
+    /*!
+     * \brief The maximum number of bytes retained by the pool after
+     * restorePatchData() is called, and the number of bytes currently
+     * retained.
+     */
+    std::size_t d_max_retained_bytes, d_retained_bytes = 0;
+
+    /*!
+     * \brief The number of calls to restorePatchData().
+     */
+    std::size_t d_num_restores = 0;
+
+    /*!
+     * \brief Mapping from the key to the pooled memory.
+     */
+    std::map<key_type, Entry> d_pool;
+
+    /*!
+     * \brief The entries with arenas that are in use.
+     */
+    std::vector<Entry*> d_entries_in_use;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_PatchScratchDataPool
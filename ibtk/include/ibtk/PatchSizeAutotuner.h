@@ -0,0 +1,149 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_PatchSizeAutotuner
+#define included_IBTK_PatchSizeAutotuner
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <IBTK_config.h>
+
+#include <tbox/Database.h>
+#include <tbox/Pointer.h>
+
+#include <BoxGeneratorStrategy.h>
+#include <CartesianGridGeometry.h>
+#include <IntVector.h>
+#include <LoadBalanceStrategy.h>
+
+#include <string>
+#include <vector>
+
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class PatchHierarchy;
+} // namespace hier
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PatchSizeAutotuner selects the largest patch size of a patch
+ * hierarchy at startup by timing representative operations on the coarsest
+ * level generated with each of a list of candidate patch sizes.
+ *
+ * For each candidate, a temporary single-level patch hierarchy is generated
+ * with the given box generator and load balancer, and the following
+ * operations are timed on it:
+ * - a ghost cell fill of side-centered and cell-centered data with one ghost
+ *   cell, as done by the Stokes solvers;
+ * - an application of a staggered-grid Stokes operator (a side-centered
+ *   Laplacian plus a pressure gradient and a velocity divergence);
+ * - a ghost cell fill of side-centered data with the ghost cell width of an
+ *   IB kernel, which is the Eulerian part of spreading and interpolation.
+ *
+ * The candidate for which the sum of the (maximum over all processes)
+ * average times is smallest is selected, reported to pout and plog, and set
+ * as the largest patch size of every level in the input database of the
+ * GriddingAlgorithm, which must therefore be constructed after calling
+ * tunePatchSize(). The smallest patch size is reduced to the selected largest
+ * patch size if necessary.
+ *
+ * The following input database keys are recognized:
+ * - \p candidate_patch_sizes (default 16, 32, 64): the candidate largest patch
+ *   sizes, in cells per direction.
+ * - \p num_trials (default 3): the number of timed repetitions of each
+ *   operation. Each operation is also run once untimed.
+ * - \p ib_kernel_fcn (default "IB_4"): the IB kernel that determines the ghost
+ *   cell width of the third operation.
+ */
+class PatchSizeAutotuner
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    PatchSizeAutotuner(std::string object_name,
+                       SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db = nullptr);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~PatchSizeAutotuner() = default;
+
+    /*!
+     * \brief Time the candidate patch sizes, select the fastest one, and set it
+     * in the input database of the GriddingAlgorithm.
+     *
+     * \return The selected largest patch size.
+     */
+    int tunePatchSize(SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > grid_geometry,
+                      SAMRAI::tbox::Pointer<SAMRAI::mesh::BoxGeneratorStrategy<NDIM> > box_generator,
+                      SAMRAI::tbox::Pointer<SAMRAI::mesh::LoadBalanceStrategy<NDIM> > load_balancer,
+                      SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> gridding_alg_db);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    PatchSizeAutotuner() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PatchSizeAutotuner(const PatchSizeAutotuner& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PatchSizeAutotuner& operator=(const PatchSizeAutotuner& that) = delete;
+
+    /*!
+     * \brief Apply the staggered-grid Stokes operator on the coarsest level of
+     * the given hierarchy.
+     */
+    static void applyStokesOperator(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                    int u_idx,
+                                    int p_idx,
+                                    int f_idx,
+                                    int g_idx);
+
+    std::string d_object_name;
+
+    // Tuning parameters.
+    std::vector<int> d_candidate_patch_sizes = { 16, 32, 64 };
+    int d_num_trials = 3;
+    std::string d_ib_kernel_fcn = "IB_4";
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_PatchSizeAutotuner
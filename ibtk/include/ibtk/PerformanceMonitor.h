@@ -0,0 +1,210 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_PerformanceMonitor
+#define included_IBTK_PerformanceMonitor
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <map>
+#include <ostream>
+#include <string>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PerformanceMonitor records the wall clock time spent in nested,
+ * named regions of code (e.g., the phases of a time step) and summarizes the
+ * times across all processes.
+ *
+ * Regions are most easily delimited by PerformanceMonitor::ScopedRegion
+ * objects.  Regions that are started while another region is active are
+ * recorded as children of the active region, so that the same region name may
+ * appear in several places in the resulting hierarchy.  The full name of a
+ * region consists of the names of its ancestors and its own name, separated by
+ * '/', e.g., <TT>HierarchyIntegrator::integrateHierarchy/IBMethod::spreadForce</TT>.
+ *
+ * Monitoring is disabled by default, in which case a ScopedRegion costs only a
+ * test of a flag.  A typical application enables monitoring after
+ * initialization and prints or writes the summary at the end of the run:
+ *
+ * \code
+ * PerformanceMonitor::setEnabled(true);
+ * // ... time step loop ...
+ * PerformanceMonitor::printSummary(pout);
+ * PerformanceMonitor::writeSummary("performance_summary.json");
+ * \endcode
+ *
+ * The summary reports, for each region, the maximum number of calls on any
+ * process, the minimum, average, and maximum time spent in the region over all
+ * processes, and the load imbalance ratio (the ratio of the maximum to the
+ * average time).  If MemoryMonitor is enabled, the printed summary is
+ * followed by the memory high-water marks recorded by MemoryMonitor.
+ *
+ * If IBTK is configured with <TT>--with-profiler-annotations=BACKEND</TT>,
+ * each ScopedRegion is also forwarded to the selected external profiler
+ * (Caliper regions, NVTX ranges, Score-P user regions, or ITT tasks for VTune).
+ * These annotations are emitted independently of whether monitoring is
+ * enabled, and may be disabled by setAnnotationsEnabled().
+ *
+ * \note Regions are recorded per process and must not be started or stopped
+ * concurrently by several threads.
+ */
+class PerformanceMonitor
+{
+public:
+    /*!
+     * \brief Class ScopedRegion starts a region when it is constructed and
+     * stops the region when it is destroyed.
+     */
+    class ScopedRegion
+    {
+    public:
+        /*!
+         * \brief Start the named region if monitoring is enabled.
+         *
+         * \note The name must not contain the character '/'.
+         */
+        explicit ScopedRegion(const char* name)
+            : d_name(name),
+              d_active(PerformanceMonitor::isEnabled()),
+              d_annotated(PerformanceMonitor::annotationsEnabled())
+        {
+            if (d_annotated) PerformanceMonitor::beginAnnotation(d_name);
+            if (d_active) PerformanceMonitor::startRegion(d_name);
+            return;
+        } // ScopedRegion
+
+        /*!
+         * \brief Stop the region if it was started.
+         */
+        ~ScopedRegion()
+        {
+            if (d_active) PerformanceMonitor::stopRegion();
+            if (d_annotated) PerformanceMonitor::endAnnotation(d_name);
+            return;
+        } // ~ScopedRegion
+
+    private:
+        ScopedRegion(const ScopedRegion& from) = delete;
+
+        ScopedRegion& operator=(const ScopedRegion& that) = delete;
+
+        const char* const d_name;
+        const bool d_active, d_annotated;
+    };
+
+    /*!
+     * \brief Enable or disable monitoring.
+     */
+    static void setEnabled(bool enabled);
+
+    /*!
+     * \brief Return whether monitoring is enabled.
+     */
+    static inline bool isEnabled()
+    {
+        return s_enabled;
+    } // isEnabled
+
+    /*!
+     * \brief Enable or disable forwarding regions to the external profiler
+     * selected at configure time.
+     *
+     * \note This function has no effect if no profiler was selected.
+     */
+    static void setAnnotationsEnabled(bool enabled);
+
+    /*!
+     * \brief Return whether regions are forwarded to an external profiler.
+     */
+    static inline bool annotationsEnabled()
+    {
+        return s_annotations_enabled;
+    } // annotationsEnabled
+
+    /*!
+     * \brief Start the named region as a child of the currently active region.
+     */
+    static void startRegion(const char* name);
+
+    /*!
+     * \brief Stop the currently active region.
+     */
+    static void stopRegion();
+
+    /*!
+     * \brief Discard all recorded times.
+     *
+     * \note This function must not be called while a region is active.
+     */
+    static void reset();
+
+    /*!
+     * \brief Print a table that summarizes the recorded times across all
+     * processes.
+     *
+     * \note This function is collective and must be called by all processes.
+     */
+    static void printSummary(std::ostream& os);
+
+    /*!
+     * \brief Write the summary of the recorded times across all processes to
+     * the named file in JSON format.
+     *
+     * \note This function is collective and must be called by all processes.
+     * The file is written by the root process.
+     *
+     * \param file_name  Name of the file.
+     * \param metadata   Optional key-value pairs describing the run (e.g., the
+     *                   name and size of the problem) that are written to the
+     *                   <TT>metadata</TT> object of the file.
+     */
+    static void writeSummary(const std::string& file_name,
+                             const std::map<std::string, std::string>& metadata = {});
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    PerformanceMonitor() = delete;
+
+    /*!
+     * \brief Begin the named annotation in the external profiler.
+     */
+    static void beginAnnotation(const char* name);
+
+    /*!
+     * \brief End the named annotation in the external profiler.
+     */
+    static void endAnnotation(const char* name);
+
+    /*!
+     * Whether monitoring is enabled.
+     */
+    static bool s_enabled;
+
+    /*!
+     * Whether regions are forwarded to an external profiler.
+     */
+    static bool s_annotations_enabled;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_PerformanceMonitor
@@ -0,0 +1,192 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_PeriodicHelmholtzFFT
+#define included_IBTK_PeriodicHelmholtzFFT
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <IBTK_config.h>
+
+#include <ibtk/ibtk_utilities.h>
+
+#include <ArrayData.h>
+#include <Box.h>
+#include <IntVector.h>
+
+#include <complex>
+#include <functional>
+#include <vector>
+
+namespace IBTK
+{
+/*!
+ * \brief Class PeriodicHelmholtzFFT solves \f$ (C I + D L_h) u = f \f$, in
+ * which \f$ L_h \f$ is the standard (2 NDIM + 1)-point discrete Laplacian and
+ * \f$ C \f$ and \f$ D \f$ are constants, on a uniform and fully periodic
+ * lattice of values by diagonalizing \f$ L_h \f$ with the discrete Fourier
+ * transform.
+ *
+ * The lattice is described by an index box (the periodic domain) and is
+ * distributed over the processes as a list of (possibly overlapping) boxes,
+ * e.g., the boxes of the cell-centered or of one component of the
+ * side-centered data on a single patch level. The values in each \em source
+ * box are read from the right-hand side and the values in each \em destination
+ * box, which may extend past the domain and whose indices are then mapped
+ * back into the domain periodically, are set in the solution. The source boxes
+ * must partition the domain.
+ *
+ * The transforms are distributed by a slab decomposition: the lattice is
+ * redistributed so that each process owns a slab of complete planes normal to
+ * the last coordinate direction, transformed in the other directions,
+ * transposed to slabs normal to the first coordinate direction, and transformed
+ * in the last direction. The one-dimensional transforms use a mixed-radix
+ * Cooley-Tukey algorithm and therefore work for any number of cells. All
+ * communication patterns are computed by the constructor.
+ *
+ * \note A transform of length \f$ n = p_1 p_2 \cdots p_k \f$ costs
+ * \f$ O(n (p_1 + p_2 + \cdots + p_k)) \f$ operations because each radix-p
+ * stage uses direct p-point butterflies. Lengths with only small prime factors
+ * therefore cost \f$ O(n \log n) \f$, but a prime length falls back to the
+ * \f$ O(n^2) \f$ cost of a direct discrete Fourier transform. Grids whose
+ * number of cells in each direction has a large prime factor should be avoided.
+ *
+ * If \f$ C = 0 \f$, the constant mode is in the nullspace of the operator; it
+ * is removed from the right-hand side and the solution has zero mean.
+ */
+class PeriodicHelmholtzFFT
+{
+public:
+    /*!
+     * Constructor.
+     *
+     * \param domain_box Index box of the periodic lattice.
+     * \param dx Lattice spacing in each coordinate direction.
+     * \param src_boxes Boxes from which the right-hand side is read.
+     * \param dst_boxes Boxes in which the solution is set.
+     * \param owners The rank of the process that owns each pair of source and
+     * destination boxes.
+     */
+    PeriodicHelmholtzFFT(const SAMRAI::hier::Box<NDIM>& domain_box,
+                         const double* dx,
+                         const std::vector<SAMRAI::hier::Box<NDIM> >& src_boxes,
+                         const std::vector<SAMRAI::hier::Box<NDIM> >& dst_boxes,
+                         const std::vector<int>& owners);
+
+    /*!
+     * Solve \f$ (C I + D L_h) u = f \f$ for component \p u_depth of the
+     * solution given component \p f_depth of the right-hand side.
+     *
+     * The vectors of data are indexed by box number; only the entries of boxes
+     * that are owned by this process are accessed.
+     */
+    void solve(const std::vector<SAMRAI::pdat::ArrayData<NDIM, double>*>& u_data,
+               int u_depth,
+               const std::vector<const SAMRAI::pdat::ArrayData<NDIM, double>*>& f_data,
+               int f_depth,
+               double C,
+               double D);
+
+private:
+    /*!
+     * A rectangular block of values that is sent to or received from another
+     * process. The values of the block are located at the indices in region
+     * (in the domain) and, when they belong to a box, at the indices in region
+     * shifted by shift in that box.
+     */
+    struct TransferBlock
+    {
+        int peer;
+        int box_num;
+        SAMRAI::hier::Box<NDIM> region;
+        SAMRAI::hier::IntVector<NDIM> shift;
+    };
+
+    /*!
+     * One-dimensional complex discrete Fourier transform of a fixed length.
+     * The length is factored into primes, preferring radices four and two,
+     * and each prime factor p contributes a stage of O(n p) operations.
+     */
+    class Transform1D
+    {
+    public:
+        Transform1D(int n = 1);
+
+        /*!
+         * Transform in place the n values starting at data with the given
+         * stride, using exp(-2 pi i jk/n) if forward is true and exp(+2 pi i
+         * jk/n) otherwise. The inverse transform is not normalized.
+         */
+        void apply(std::complex<double>* data, int stride, bool forward);
+
+    private:
+        void transform(std::complex<double>* out,
+                       const std::complex<double>* in,
+                       int fstride,
+                       unsigned int factor_idx,
+                       const std::vector<std::complex<double> >& twiddles);
+
+        int d_n;
+        std::vector<int> d_factors;
+        std::vector<std::complex<double> > d_fwd_twiddles, d_bwd_twiddles, d_line, d_work, d_scratch;
+    };
+
+    /*!
+     * Send and receive the values of the given blocks with a single
+     * all-to-all exchange. pack writes the values of a send block to the
+     * buffer and unpack reads the values of a receive block from the buffer.
+     */
+    void communicate(const std::vector<TransferBlock>& send_blocks,
+                     const std::vector<TransferBlock>& recv_blocks,
+                     int values_per_index,
+                     const std::function<void(const TransferBlock&, double*)>& pack,
+                     const std::function<void(const TransferBlock&, const double*)>& unpack);
+
+    /*!
+     * Apply one-dimensional transforms along all lines in the given direction
+     * of a slab.
+     */
+    void transformSlab(std::vector<std::complex<double> >& slab_data,
+                       const SAMRAI::hier::Box<NDIM>& slab_box,
+                       int axis,
+                       bool forward);
+
+    /*!
+     * Compute the position of an index in the storage of a slab.
+     */
+    static int slabOffset(const SAMRAI::hier::Box<NDIM>& slab_box, const SAMRAI::hier::Index<NDIM>& i);
+
+    SAMRAI::hier::Box<NDIM> d_domain_box;
+    IBTK::VectorNd d_dx;
+    int d_rank = 0;
+
+    /*!
+     * The slab of the domain owned by each process in the first (normal to
+     * the last direction) and second (normal to the first direction) slab
+     * decomposition.
+     */
+    std::vector<SAMRAI::hier::Box<NDIM> > d_slab_a_boxes, d_slab_b_boxes;
+
+    /*!
+     * Communication patterns of the redistributions.
+     */
+    std::vector<TransferBlock> d_src_to_a_send, d_src_to_a_recv;
+    std::vector<TransferBlock> d_a_to_b_send, d_a_to_b_recv;
+    std::vector<TransferBlock> d_a_to_dst_send, d_a_to_dst_recv;
+
+    std::vector<std::complex<double> > d_slab_a_data, d_slab_b_data;
+    std::vector<Transform1D> d_transforms;
+};
+} // namespace IBTK
+
+#endif
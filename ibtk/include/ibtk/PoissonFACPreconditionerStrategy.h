@@ -339,6 +339,18 @@ protected:
 
     //\}
 
+    /*!
+     * \brief Set minus_poisson_spec to specify the negation of the operator
+     * specified by d_poisson_spec.
+     *
+     * This allows residuals r = f - A u to be computed in a single pass as
+     * r = (-A) u + f.
+     *
+     * \return Whether the negated operator can be specified, which requires the
+     * problem coefficients to be constant.
+     */
+    bool getMinusPoissonSpecifications(SAMRAI::solv::PoissonSpecifications& minus_poisson_spec) const;
+
     /*
      * Problem specification.
      */
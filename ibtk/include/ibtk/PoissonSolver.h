@@ -40,6 +40,17 @@ namespace IBTK
 {
 /*!
  * \brief Class PoissonSolver is an abstract base class for Poisson solvers.
+ *
+ * Several Poisson problems that share the same operator may be solved
+ * simultaneously by storing their right-hand sides and solutions as the
+ * components of patch data with depth greater than one, using one physical
+ * boundary condition object per component (see setPhysicalBcCoefs()).  The
+ * cell-centered Krylov, FAC, and PETSc level solvers treat the components in
+ * lockstep: each ghost cell fill, restriction, and prolongation transfers all
+ * components at once, and the Krylov methods use a single inner product over
+ * all components, so that the communication cost is paid once per iteration
+ * for all right-hand sides.  This is how INSCollocatedHierarchyIntegrator
+ * solves for all velocity components with a single solver.
  */
 class PoissonSolver : public virtual GeneralSolver
 {
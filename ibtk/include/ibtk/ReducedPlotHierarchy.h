@@ -0,0 +1,162 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_ReducedPlotHierarchy
+#define included_IBTK_ReducedPlotHierarchy
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "BoxList.h"
+#include "PatchHierarchy.h"
+#include "tbox/Pointer.h"
+
+#include <limits>
+#include <set>
+#include <string>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class ReducedPlotHierarchy maintains a copy of a subset of a patch
+ * hierarchy that may be passed to SAMRAI::appu::VisItDataWriter in place of the
+ * full hierarchy to reduce the amount of plot data that is written.
+ *
+ * The copy contains only the levels of the hierarchy up to a specified finest
+ * level and, optionally, only the parts of those levels that lie within a
+ * region of interest.  Since the data on coarser levels are synchronized with
+ * the data on finer levels, the coarsest levels provide a coarsened
+ * representation of the full solution.  The patches of the copy are subsets of
+ * the patches of the hierarchy and are assigned to the same processes, so that
+ * the copy is made without communication.
+ *
+ * A typical use is:
+ * \code
+ * ReducedPlotHierarchy reduced_hierarchy("ReducedPlotHierarchy", 1);
+ * reduced_hierarchy.registerPlotDataIndex(u_idx);
+ * // ...
+ * time_integrator->setupPlotData();
+ * visit_data_writer->writePlotData(reduced_hierarchy.update(patch_hierarchy), iteration_num, loop_time);
+ * \endcode
+ *
+ * \note All patch data indices registered as plot quantities with the VisIt
+ * data writer must also be registered with this object.
+ */
+class ReducedPlotHierarchy
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param object_name     Name of the object.
+     * \param finest_plot_ln  Finest level of the hierarchy that is copied.
+     * \param region          Region of interest in the index space of the
+     *                        coarsest level.  An empty list indicates the
+     *                        entire domain.
+     */
+    ReducedPlotHierarchy(std::string object_name,
+                         int finest_plot_ln = std::numeric_limits<int>::max(),
+                         const SAMRAI::hier::BoxList<NDIM>& region = SAMRAI::hier::BoxList<NDIM>());
+
+    /*!
+     * \brief Destructor.
+     */
+    ~ReducedPlotHierarchy() = default;
+
+    /*!
+     * \brief Register a patch data index that is copied to the reduced
+     * hierarchy.
+     */
+    void registerPlotDataIndex(int data_idx);
+
+    /*!
+     * \brief Set the finest level of the hierarchy that is copied.
+     */
+    void setFinestPlotLevelNumber(int finest_plot_ln);
+
+    /*!
+     * \brief Set the region of interest in the index space of the coarsest
+     * level.  An empty list indicates the entire domain.
+     */
+    void setRegionOfInterest(const SAMRAI::hier::BoxList<NDIM>& region);
+
+    /*!
+     * \brief Rebuild the reduced hierarchy from the current configuration of
+     * the given hierarchy, copy the registered data, and return the reduced
+     * hierarchy.
+     *
+     * \note This function is collective.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> >
+    update(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
+
+    /*!
+     * \brief Free the reduced hierarchy and its data.
+     */
+    void clear();
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    ReducedPlotHierarchy() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    ReducedPlotHierarchy(const ReducedPlotHierarchy& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    ReducedPlotHierarchy& operator=(const ReducedPlotHierarchy& that) = delete;
+
+    /*!
+     * The object name is used for error reporting purposes.
+     */
+    std::string d_object_name;
+
+    /*!
+     * The finest level that is copied and the region of interest.
+     */
+    int d_finest_plot_ln;
+    SAMRAI::hier::BoxList<NDIM> d_region;
+
+    /*!
+     * The patch data indices that are copied.
+     */
+    std::set<int> d_plot_data_idxs;
+
+    /*!
+     * The reduced hierarchy.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_reduced_hierarchy;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_ReducedPlotHierarchy
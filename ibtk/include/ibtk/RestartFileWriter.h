@@ -0,0 +1,174 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_RestartFileWriter
+#define included_IBTK_RestartFileWriter
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class RestartFileWriter writes the restart files of the objects
+ * registered with SAMRAI's RestartManager together with any additional restart
+ * files (e.g., the libMesh data written by
+ * IBAMR::FEMechanicsBase::writeFEDataToRestartFile()).
+ *
+ * By default, the restart files are written directly to the restart dump
+ * directory.  When asynchronous writes are enabled, the restart files are
+ * instead written to a fast staging directory (e.g., a node-local RAM disk),
+ * and each process copies the files that it wrote to the restart dump
+ * directory from a background thread, so that the simulation may continue
+ * while the data are written to the (typically much slower) parallel file
+ * system.  Only one restart dump is in flight at a time: the next call to
+ * writeRestartFile() and the destructor wait for the pending copy.  The
+ * background thread performs no MPI communication.
+ *
+ * A typical use in an application is
+ *
+ * \code
+ * if (dump_restart_data && (iteration_num % restart_dump_interval == 0 || last_step))
+ * {
+ *     restart_file_writer.writeRestartFile(restart_dump_dirname,
+ *                                          iteration_num,
+ *                                          { [&](const std::string& dirname) {
+ *                                              ib_method_ops->writeFEDataToRestartFile(dirname, iteration_num);
+ *                                          } });
+ * }
+ * \endcode
+ *
+ * The following input database keys are used:
+ *
+ * - <TT>use_asynchronous_writes</TT>: whether to stage the restart files and
+ *   copy them from a background thread (default <TT>FALSE</TT>)
+ * - <TT>staging_directory</TT>: the directory in which each process stages its
+ *   restart files (default <TT>"/dev/shm"</TT>)
+ *
+ * \note The staged files occupy space in the staging directory until they
+ * have been copied.  A restart dump is complete once waitForPendingWrites()
+ * has returned on all processes.
+ */
+class RestartFileWriter
+{
+public:
+    /*!
+     * \brief Type of the functions that write additional restart files to the
+     * directory that is passed as their argument.  These functions are called
+     * collectively by all processes.
+     */
+    using WriterFcn = std::function<void(const std::string& dirname)>;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param object_name  String used for error reporting.
+     * \param input_db     The input database, which may be null.
+     */
+    RestartFileWriter(std::string object_name, SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db = nullptr);
+
+    /*!
+     * \brief Destructor.  Waits for any pending asynchronous write.
+     */
+    ~RestartFileWriter();
+
+    /*!
+     * \brief Enable or disable asynchronous writes.
+     */
+    void setUseAsynchronousWrites(bool use_async_writes);
+
+    /*!
+     * \brief Set the directory in which the restart files are staged when
+     * asynchronous writes are enabled.
+     */
+    void setStagingDirectory(const std::string& staging_dirname);
+
+    /*!
+     * \brief Write the restart files of the objects registered with the
+     * RestartManager and all additional restart files for the specified
+     * restore number.
+     *
+     * \note This function is collective and must be called by all processes.
+     */
+    void writeRestartFile(const std::string& restart_dump_dirname,
+                          int restore_num,
+                          const std::vector<WriterFcn>& additional_writers = std::vector<WriterFcn>());
+
+    /*!
+     * \brief Block until any pending asynchronous write has completed.
+     */
+    void waitForPendingWrites();
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    RestartFileWriter() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    RestartFileWriter(const RestartFileWriter& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    RestartFileWriter& operator=(const RestartFileWriter& that) = delete;
+
+    /*!
+     * \brief Copy the staged files to the restart dump directory and remove
+     * them from the staging directory.  This function may be called from a
+     * background thread.
+     */
+    void copyStagedFiles(std::string staged_dirname, std::string restart_dump_dirname, std::vector<std::string> files);
+
+    /*!
+     * The name of the object.
+     */
+    std::string d_object_name;
+
+    /*!
+     * Asynchronous write settings, the thread used to copy the staged files,
+     * and the description of any error that occurred in that thread.
+     */
+    bool d_use_async_writes = false;
+    std::string d_staging_dirname = "/dev/shm";
+    std::thread d_write_thread;
+    std::string d_write_error;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_RestartFileWriter
@@ -16,12 +16,19 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ArrayData.h"
+#include "BoundaryBox.h"
 #include "Box.h"
 #include "ComponentSelector.h"
 #include "IntVector.h"
 #include "RefinePatchStrategy.h"
+#include "Variable.h"
+#include "tbox/Pointer.h"
 
+#include <array>
+#include <map>
 #include <set>
+#include <tuple>
 #include <vector>
 
 namespace SAMRAI
@@ -200,6 +207,33 @@ protected:
     std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> d_bc_coefs;
     bool d_homogeneous_bc = false;
 
+    /*!
+     * \brief Set the Robin boundary condition coefficients specified by \p
+     * bc_coef along the boundary box \p bdry_box of the patch for filling the
+     * patch data with index \p patch_data_idx, accounting for whether
+     * homogeneous boundary conditions are to be used.
+     *
+     * The coefficients are stored in scratch arrays that are reused by
+     * subsequent calls, so that the coefficient data are only valid until the
+     * next call to this function.  The coefficients of strategies that do not
+     * depend on time (see ExtendedRobinBcCoefStrategy::isTimeDependent() and
+     * muParserRobinBcCoefs::isTimeDependent()) are computed only once for each
+     * patch and boundary box and are reused until the patch changes, e.g.,
+     * because the patch hierarchy is regridded.
+     *
+     * \note The coefficient data must not be modified.
+     */
+    void setBcCoefData(SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> >& acoef_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> >& bcoef_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> >& gcoef_data,
+                       SAMRAI::solv::RobinBcCoefStrategy<NDIM>* bc_coef,
+                       int patch_data_idx,
+                       const SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> >& var,
+                       const SAMRAI::hier::Patch<NDIM>& patch,
+                       const SAMRAI::hier::BoundaryBox<NDIM>& bdry_box,
+                       const SAMRAI::hier::Box<NDIM>& bc_coef_box,
+                       double fill_time);
+
 private:
     /*!
      * \brief Copy constructor.
@@ -220,6 +254,34 @@ private:
      * \return A reference to this object.
      */
     RobinPhysBdryPatchStrategy& operator=(const RobinPhysBdryPatchStrategy& that) = delete;
+
+    /*!
+     * Scratch arrays for the (a, b, g) coefficients of time-dependent
+     * strategies.
+     */
+    std::array<SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> >, 3> d_scratch_bc_coef_data;
+
+    /*!
+     * Cached (a, b, g) coefficients of a time-independent strategy along a
+     * boundary box, along with the patch box, patch geometry, and coefficient
+     * box for which they were computed.
+     */
+    struct CachedBcCoefData
+    {
+        SAMRAI::hier::Box<NDIM> patch_box, bc_coef_box;
+        std::array<double, NDIM> x_lower, dx;
+        std::array<SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> >, 3> data;
+    };
+
+    /*!
+     * Cached coefficients of time-independent strategies, indexed by the
+     * strategy, the patch level number, the patch number, the boundary location
+     * index, the target patch data index, and whether homogeneous boundary
+     * conditions are used.
+     */
+    std::map<std::tuple<const SAMRAI::solv::RobinBcCoefStrategy<NDIM>*, int, int, int, int, bool>,
+             std::vector<CachedBcCoefData> >
+        d_cached_bc_coef_data;
 };
 } // namespace IBTK
 
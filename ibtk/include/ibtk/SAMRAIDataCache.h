@@ -40,7 +40,7 @@ class SAMRAIDataCache : public SAMRAI::tbox::DescribedClass
 {
 public:
     /// \brief Default constructor.
-    SAMRAIDataCache() = default;
+    SAMRAIDataCache();
 
     /// \brief Destructor.
     ~SAMRAIDataCache();
@@ -173,6 +173,9 @@ private:
 
     /// \brief Construct the data descriptor for a given variable and patch data index.
     static key_type construct_data_descriptor(int idx);
+
+    /// \brief Identifier of the reporter registered with MemoryMonitor.
+    int d_memory_reporter_id = -1;
 };
 } // namespace IBTK
 
@@ -98,6 +98,7 @@ namespace IBTK
  rel_residual_tol = 1.0e-5      // see setRelativeTolerance()
  initial_guess_nonzero = FALSE  // see setInitialGuessNonzero()
  rel_change = 0                 // see hypre User's Manual (only used by SysPFMG or PCG solver)
+ reuse_hypre_setup = FALSE      // see below
  num_pre_relax_steps = 1        // number of pre-sweeps (only used by SysPFMG solver)
  num_post_relax_steps = 1       // number of post-sweeps (only used by SysPFMG solver)
  relax_type = 1                 // see hypre User's Manual (only used by SysPFMG solver or
@@ -107,6 +108,12 @@ namespace IBTK
  two_norm = 1                   // see hypre User's Manual (only used by PCG solver)
  \endverbatim
  *
+ * If reuse_hypre_setup is enabled, the hypre data structures are retained when
+ * the solver state is deallocated.  When the solver is next initialized on a
+ * patch level with the same patch boxes, the hypre grid, graph, and vectors are
+ * reused.  If the matrix coefficients are also unchanged, the hypre matrix and
+ * solver setup are reused as well.
+ *
  * \em hypre is developed in the Center for Applied Scientific Computing (CASC)
  * at Lawrence Livermore National Laboratory (LLNL).  For more information about
  * \em hypre, see <A
@@ -270,6 +277,7 @@ private:
      */
     void allocateHypreData();
     void setMatrixCoefficients();
+    void copyMatrixCoefficientsToHypre();
     void setupHypreSolver();
     bool solveSystem(int x_idx, int b_idx);
     void copyToHypre(HYPRE_SStructVector vector,
@@ -312,6 +320,16 @@ private:
     HYPRE_SStructSolver d_solver = nullptr, d_precond = nullptr;
     std::vector<SAMRAI::hier::Index<NDIM> > d_stencil_offsets;
 
+    /*
+     * Data used to determine whether the hypre setup may be reused: the patch
+     * boxes and refinement ratio of the level on which the hypre grid was
+     * built, and the matrix coefficients.
+     */
+    bool d_reuse_hypre_setup = false;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_grid_boxes;
+    SAMRAI::hier::IntVector<NDIM> d_grid_ratio = 0;
+    std::vector<double> d_matrix_vals;
+
     std::string d_solver_type = "Split", d_precond_type = "none", d_split_solver_type = "PFMG";
     int d_rel_change = 0;
     int d_num_pre_relax_steps = 1, d_num_post_relax_steps = 1;
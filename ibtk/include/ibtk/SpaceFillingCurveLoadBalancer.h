@@ -0,0 +1,158 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_SpaceFillingCurveLoadBalancer
+#define included_IBTK_SpaceFillingCurveLoadBalancer
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "Box.h"
+#include "BoxArray.h"
+#include "BoxList.h"
+#include "IntVector.h"
+#include "LoadBalancer.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace SAMRAI
+{
+namespace hier
+{
+class ProcessorMapping;
+template <int DIM>
+class PatchHierarchy;
+} // namespace hier
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class SpaceFillingCurveLoadBalancer assigns the boxes generated by
+ * its parent class to processes by partitioning them along a space-filling
+ * curve, using the workload stored in the workload patch data (if any).
+ *
+ * The workload estimates computed by IBAMR combine a per-cell weight with the
+ * number of Lagrangian points or quadrature points in each cell (see, e.g.,
+ * LDataManager::addWorkloadEstimate() and
+ * FEDataManager::addWorkloadEstimate()), so that partitioning by this workload
+ * balances the Eulerian and the Lagrangian work at the same time.  The boxes
+ * are first chopped by the parent class, then ordered by the Morton
+ * (Z-order) index of their centers and split into contiguous ranges of
+ * (approximately) equal workload.  Since boxes that are close in space are
+ * close along the curve, each process receives a compact region of the
+ * domain and patches that interact with the same structure are assigned to
+ * the same or to consecutive processes.
+ *
+ * Each split point may be moved away from the ideal split point by up to a
+ * fraction <code>cut_tolerance</code> of the average workload per process to
+ * a position at which the total area of the faces shared by boxes on the two
+ * sides of the split (i.e., the amount of ghost data exchanged between the
+ * two processes) is smaller.
+ *
+ * In addition to the input keys of SAMRAI::mesh::LoadBalancer, this class
+ * reads the following optional keys from the input database:
+ * <ul>
+ *   <li><code>cut_tolerance</code>: the maximum allowed deviation of each
+ *   split point from the ideal split point relative to the average workload
+ *   per process (default 0.05).</li>
+ *   <li><code>merge_boxes</code>: whether to merge the boxes assigned to each
+ *   process, as done by MergingLoadBalancer (default <code>FALSE</code>).</li>
+ *   <li><code>enable_logging</code>: whether to log the workload imbalance
+ *   and the total cut area after each partitioning (default
+ *   <code>FALSE</code>).</li>
+ * </ul>
+ *
+ * @note If no workload data is available on the level that is being load
+ * balanced (e.g., when a new level is created), the number of cells in each
+ * box is used as its workload.
+ */
+class SpaceFillingCurveLoadBalancer : public SAMRAI::mesh::LoadBalancer<NDIM>
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    SpaceFillingCurveLoadBalancer(const std::string& object_name,
+                                  SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db = nullptr);
+
+    /*!
+     * \brief Constructor that uses a default object name.
+     */
+    SpaceFillingCurveLoadBalancer(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Set the patch data index of the workload estimate used on the
+     * given level (or on all levels if level_number is -1).
+     */
+    void setWorkloadPatchDataIndex(int data_id, int level_number = -1) override;
+
+    /*!
+     * \brief Chop the boxes with the parent class and assign them to processes
+     * along a space-filling curve.
+     */
+    void loadBalanceBoxes(SAMRAI::hier::BoxArray<NDIM>& out_boxes,
+                          SAMRAI::hier::ProcessorMapping& mapping,
+                          const SAMRAI::hier::BoxList<NDIM>& in_boxes,
+                          const SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                          int level_number,
+                          const SAMRAI::hier::BoxArray<NDIM>& physical_domain,
+                          const SAMRAI::hier::IntVector<NDIM>& ratio_to_hierarchy_level_zero,
+                          const SAMRAI::hier::IntVector<NDIM>& min_size,
+                          const SAMRAI::hier::IntVector<NDIM>& max_size,
+                          const SAMRAI::hier::IntVector<NDIM>& cut_factor,
+                          const SAMRAI::hier::IntVector<NDIM>& bad_interval) const override;
+
+private:
+    /*!
+     * \brief Read the input keys specific to this class.
+     */
+    void getFromInput(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Compute the workload of each box from the workload data on the
+     * given level of the hierarchy.
+     */
+    std::vector<double>
+    computeBoxWorkloads(const SAMRAI::hier::BoxArray<NDIM>& boxes,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                        int level_number) const;
+
+    /*!
+     * The object name is used for error reporting and logging purposes.
+     */
+    std::string d_object_name;
+
+    /*!
+     * Workload patch data indices, indexed by level number.  The entry with key
+     * -1 is used for levels without an entry of their own.
+     */
+    std::map<int, int> d_workload_idx;
+
+    /*!
+     * Input parameters.
+     */
+    double d_cut_tolerance = 0.05;
+    bool d_merge_boxes = false;
+    bool d_enable_logging = false;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_SpaceFillingCurveLoadBalancer
@@ -204,6 +204,13 @@ private:
      * Map from Streamable ID to registered StreamableFactory objects.
      */
     StreamableFactoryMap d_factory_map;
+
+    /*!
+     * Registered StreamableFactory objects indexed by Streamable ID, which
+     * avoids a map lookup for each data item that is unpacked.  The objects
+     * are owned by d_factory_map.
+     */
+    std::vector<StreamableFactory*> d_factory_table;
 };
 } // namespace IBTK
 
@@ -0,0 +1,221 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_ThreadPool
+#define included_IBTK_ThreadPool
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "tbox/Utilities.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class ThreadPool manages a fixed collection of worker threads that
+ * execute independent work items (e.g., the computations on the patches of a
+ * patch level) concurrently.
+ *
+ * The worker threads are created when the pool is constructed and persist
+ * until the pool is destroyed, so that the cost of creating threads is not
+ * incurred each time that work is submitted.  The thread that calls
+ * parallelFor() also executes work items, so a pool with \em n threads creates
+ * \em n-1 worker threads, and a pool with one thread executes all work items
+ * serially.
+ *
+ * The work items must be independent of each other and must not make MPI calls
+ * or modify shared SAMRAI objects (e.g., schedules, timers, or reference
+ * counted pointers shared between work items).
+ *
+ * The default number of threads, which is used by classes that create thread
+ * pools but are not given a number of threads, is one and may be changed via
+ * setDefaultNumberOfThreads().
+ */
+class ThreadPool
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param num_threads  The number of threads, including the calling thread,
+     * used to execute work items.
+     */
+    inline explicit ThreadPool(const unsigned int num_threads)
+    {
+#if !defined(NDEBUG)
+        TBOX_ASSERT(num_threads > 0);
+#endif
+        for (unsigned int k = 1; k < num_threads; ++k)
+        {
+            d_workers.emplace_back(&ThreadPool::runWorker, this);
+        }
+        return;
+    } // ThreadPool
+
+    /*!
+     * \brief Destructor.
+     */
+    inline ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(d_mutex);
+            d_shutdown = true;
+        }
+        d_work_cv.notify_all();
+        for (auto& worker : d_workers) worker.join();
+        return;
+    } // ~ThreadPool
+
+    /*!
+     * \brief Return the number of threads, including the calling thread, used
+     * to execute work items.
+     */
+    inline unsigned int getNumberOfThreads() const
+    {
+        return static_cast<unsigned int>(d_workers.size()) + 1;
+    } // getNumberOfThreads
+
+    /*!
+     * \brief Execute task(i) for i = 0, ..., n-1 and return once all of the
+     * work items have completed.
+     *
+     * \note This method must not be called concurrently from multiple threads.
+     */
+    inline void parallelFor(const int n, const std::function<void(int)>& task)
+    {
+        if (n <= 0) return;
+        if (d_workers.empty() || n == 1)
+        {
+            for (int i = 0; i < n; ++i) task(i);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(d_mutex);
+            d_task = &task;
+            d_num_items = n;
+            d_next_item = 0;
+            d_num_active_workers = static_cast<int>(d_workers.size());
+            ++d_generation;
+        }
+        d_work_cv.notify_all();
+        executeWorkItems();
+        std::unique_lock<std::mutex> lock(d_mutex);
+        d_done_cv.wait(lock, [this] { return d_num_active_workers == 0; });
+        d_task = nullptr;
+        return;
+    } // parallelFor
+
+    /*!
+     * \brief Set the default number of threads.
+     */
+    static inline void setDefaultNumberOfThreads(const unsigned int num_threads)
+    {
+#if !defined(NDEBUG)
+        TBOX_ASSERT(num_threads > 0);
+#endif
+        defaultNumberOfThreads() = num_threads;
+        return;
+    } // setDefaultNumberOfThreads
+
+    /*!
+     * \brief Get the default number of threads.
+     */
+    static inline unsigned int getDefaultNumberOfThreads()
+    {
+        return defaultNumberOfThreads();
+    } // getDefaultNumberOfThreads
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    ThreadPool(const ThreadPool& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    ThreadPool& operator=(const ThreadPool& that) = delete;
+
+    /*!
+     * \brief Storage for the default number of threads.
+     */
+    static inline unsigned int& defaultNumberOfThreads()
+    {
+        static unsigned int num_threads = 1;
+        return num_threads;
+    } // defaultNumberOfThreads
+
+    /*!
+     * \brief Claim and execute work items until none remain.
+     */
+    inline void executeWorkItems()
+    {
+        for (int i = d_next_item++; i < d_num_items; i = d_next_item++) (*d_task)(i);
+        return;
+    } // executeWorkItems
+
+    /*!
+     * \brief Main loop of the worker threads.
+     */
+    inline void runWorker()
+    {
+        unsigned int generation = 0;
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(d_mutex);
+                d_work_cv.wait(lock, [this, generation] { return d_shutdown || d_generation != generation; });
+                if (d_shutdown) return;
+                generation = d_generation;
+            }
+            executeWorkItems();
+            {
+                std::lock_guard<std::mutex> lock(d_mutex);
+                if (--d_num_active_workers == 0) d_done_cv.notify_one();
+            }
+        }
+    } // runWorker
+
+    std::vector<std::thread> d_workers;
+    std::mutex d_mutex;
+    std::condition_variable d_work_cv, d_done_cv;
+    bool d_shutdown = false;
+    unsigned int d_generation = 0;
+    const std::function<void(int)>* d_task = nullptr;
+    int d_num_items = 0;
+    std::atomic<int> d_next_item{ 0 };
+    int d_num_active_workers = 0;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_ThreadPool
@@ -55,6 +55,14 @@ namespace IBTK
  coarse_solver_db = { ... }                   // SAMRAI::tbox::Database for initializing coarse
  level solver
  \endverbatim
+ *
+ * The smoothers evaluate the variable-coefficient operator directly from the
+ * viscosity data on each level, so no matrix is assembled on the finer levels.
+ * If coarse_solver_type is set to one of the smoother types (e.g.,
+ * "RED_BLACK_GAUSS_SEIDEL"), the coarsest level is also solved by
+ * coarse_solver_max_iterations sweeps of that smoother, and the preconditioner
+ * is then entirely matrix-free.  This avoids reassembling the coarse level
+ * matrix each time the viscosity changes.
 */
 class VCSCViscousOpPointRelaxationFACOperator : public SCPoissonPointRelaxationFACOperator
 {
@@ -50,6 +50,7 @@ inline std::string enum_to_string(T /*val*/)
  */
 enum MGCycleType
 {
+    ADDITIVE_CYCLE,
     F_CYCLE,
     FMG_CYCLE,
     V_CYCLE,
@@ -61,6 +62,9 @@ template <>
 inline MGCycleType
 string_to_enum<MGCycleType>(const std::string& val)
 {
+    if (strcasecmp(val.c_str(), "ADDITIVE") == 0) return ADDITIVE_CYCLE;
+    if (strcasecmp(val.c_str(), "ADDITIVE_CYCLE") == 0) return ADDITIVE_CYCLE;
+    if (strcasecmp(val.c_str(), "ADDITIVE-CYCLE") == 0) return ADDITIVE_CYCLE;
     if (strcasecmp(val.c_str(), "F") == 0) return F_CYCLE;
     if (strcasecmp(val.c_str(), "F_CYCLE") == 0) return F_CYCLE;
     if (strcasecmp(val.c_str(), "F-CYCLE") == 0) return F_CYCLE;
@@ -80,6 +84,7 @@ template <>
 inline std::string
 enum_to_string<MGCycleType>(MGCycleType val)
 {
+    if (val == ADDITIVE_CYCLE) return "ADDITIVE_CYCLE";
     if (val == F_CYCLE) return "F_CYCLE";
     if (val == FMG_CYCLE) return "FMG_CYCLE";
     if (val == V_CYCLE) return "V_CYCLE";
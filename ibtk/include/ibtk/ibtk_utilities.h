@@ -29,6 +29,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <utility>
 
 /////////////////////////////// MACRO DEFINITIONS ////////////////////////////
@@ -199,6 +200,64 @@ tensor_idx_to_voigt(const std::pair<int, int>& idx)
         return 3 * NDIM - 3 - idx.first - idx.second;
 }
 
+/*!
+ * The number of bits per coordinate used by hilbert_curve_index().
+ */
+static const unsigned int s_hilbert_curve_bits = 64 / NDIM;
+
+/*!
+ * Compute the index along a Hilbert curve of a point whose coordinates are
+ * integers in [0, 2^s_hilbert_curve_bits). Points which are close together on
+ * the curve are also close together in space, so sorting objects by this
+ * index improves data locality. This uses the algorithm described in
+ * J. Skilling, "Programming the Hilbert curve", AIP Conference Proceedings
+ * 707 (2004).
+ */
+inline std::uint64_t
+hilbert_curve_index(std::array<std::uint64_t, NDIM> x)
+{
+    const std::uint64_t m = std::uint64_t(1) << (s_hilbert_curve_bits - 1);
+
+    // Inverse undo excess work.
+    for (std::uint64_t q = m; q > 1; q >>= 1)
+    {
+        const std::uint64_t p = q - 1;
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            if (x[i] & q)
+            {
+                x[0] ^= p;
+            }
+            else
+            {
+                const std::uint64_t t = (x[0] ^ x[i]) & p;
+                x[0] ^= t;
+                x[i] ^= t;
+            }
+        }
+    }
+
+    // Gray encode.
+    for (unsigned int i = 1; i < NDIM; ++i) x[i] ^= x[i - 1];
+    std::uint64_t t = 0;
+    for (std::uint64_t q = m; q > 1; q >>= 1)
+    {
+        if (x[NDIM - 1] & q) t ^= q - 1;
+    }
+    for (unsigned int i = 0; i < NDIM; ++i) x[i] ^= t;
+
+    // Interleave the bits of the transposed index.
+    std::uint64_t index = 0;
+    for (int b = s_hilbert_curve_bits - 1; b >= 0; --b)
+    {
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            index = (index << 1) | ((x[i] >> b) & 1);
+        }
+    }
+    return index;
+} // hilbert_curve_index
+
 /*!
  * Eigen types have special alignment requirements and require a specific
  * memory allocator. This is a convenience type alias for a
@@ -46,7 +46,10 @@ IBTK_DISABLE_EXTRA_WARNINGS
 #include <boost/multi_array.hpp>
 IBTK_ENABLE_EXTRA_WARNINGS
 
+#include <array>
+#include <cstddef>
 #include <tuple>
+#include <vector>
 
 /////////////////////////////// FUNCTION DEFINITIONS /////////////////////////
 
@@ -224,6 +227,21 @@ using TensorMeshFcnPtr =
              double data_time,
              void* ctx);
 
+// Batched version of TensorMeshFcnPtr that evaluates the function at all of
+// the points in FF, x, and X at once.  The system data are indexed first by
+// point and then by system.  F has already been resized to the number of
+// points.
+using TensorMeshBatchFcnPtr =
+    void (*)(std::vector<libMesh::TensorValue<double> >& F,
+             const std::vector<libMesh::TensorValue<double> >& FF,
+             const std::vector<libMesh::Point>& x,
+             const std::vector<libMesh::Point>& X,
+             libMesh::Elem* elem,
+             const std::vector<std::vector<const std::vector<double>*> >& system_var_data,
+             const std::vector<std::vector<const std::vector<libMesh::VectorValue<double> >*> >& system_grad_var_data,
+             double data_time,
+             void* ctx);
+
 using ScalarSurfaceFcnPtr =
     void (*)(double& F,
              const libMesh::VectorValue<double>& n,
@@ -355,10 +373,16 @@ batch_vec_assembly(const std::vector<std::vector<libMesh::PetscVector<double>*>
     }
 }
 
+/*!
+ * Start updating the ghost values of each vector in @p vecs. The update must
+ * be completed with batch_vec_ghost_update_end() (called with the same
+ * arguments) before the ghost values are used, but any work that does not
+ * depend on them may be done in between to hide the communication latency.
+ */
 inline void
-batch_vec_ghost_update(const std::vector<libMesh::PetscVector<double>*>& vecs,
-                       const InsertMode insert_mode,
-                       const ScatterMode scatter_mode)
+batch_vec_ghost_update_begin(const std::vector<libMesh::PetscVector<double>*>& vecs,
+                             const InsertMode insert_mode,
+                             const ScatterMode scatter_mode)
 {
     for (const auto& v : vecs)
     {
@@ -366,6 +390,28 @@ batch_vec_ghost_update(const std::vector<libMesh::PetscVector<double>*>& vecs,
         int ierr = VecGhostUpdateBegin(v->vec(), insert_mode, scatter_mode);
         IBTK_CHKERRQ(ierr);
     }
+}
+
+inline void
+batch_vec_ghost_update_begin(const std::vector<std::vector<libMesh::PetscVector<double>*> >& vecs,
+                             const InsertMode insert_mode,
+                             const ScatterMode scatter_mode)
+{
+    for (unsigned int n = 0; n < vecs.size(); ++n)
+    {
+        batch_vec_ghost_update_begin(vecs[n], insert_mode, scatter_mode);
+    }
+}
+
+/*!
+ * Finish updating the ghost values of each vector in @p vecs started by
+ * batch_vec_ghost_update_begin().
+ */
+inline void
+batch_vec_ghost_update_end(const std::vector<libMesh::PetscVector<double>*>& vecs,
+                           const InsertMode insert_mode,
+                           const ScatterMode scatter_mode)
+{
     for (const auto& v : vecs)
     {
         if (!v) continue;
@@ -375,30 +421,34 @@ batch_vec_ghost_update(const std::vector<libMesh::PetscVector<double>*>& vecs,
 }
 
 inline void
-batch_vec_ghost_update(const std::vector<std::vector<libMesh::PetscVector<double>*> >& vecs,
-                       const InsertMode insert_mode,
-                       const ScatterMode scatter_mode)
+batch_vec_ghost_update_end(const std::vector<std::vector<libMesh::PetscVector<double>*> >& vecs,
+                           const InsertMode insert_mode,
+                           const ScatterMode scatter_mode)
 {
     for (unsigned int n = 0; n < vecs.size(); ++n)
     {
-        for (const auto& v : vecs[n])
-        {
-            if (!v) continue;
-            int ierr = VecGhostUpdateBegin(v->vec(), insert_mode, scatter_mode);
-            IBTK_CHKERRQ(ierr);
-        }
-    }
-    for (unsigned int n = 0; n < vecs.size(); ++n)
-    {
-        for (const auto& v : vecs[n])
-        {
-            if (!v) continue;
-            int ierr = VecGhostUpdateEnd(v->vec(), insert_mode, scatter_mode);
-            IBTK_CHKERRQ(ierr);
-        }
+        batch_vec_ghost_update_end(vecs[n], insert_mode, scatter_mode);
     }
 }
 
+inline void
+batch_vec_ghost_update(const std::vector<libMesh::PetscVector<double>*>& vecs,
+                       const InsertMode insert_mode,
+                       const ScatterMode scatter_mode)
+{
+    batch_vec_ghost_update_begin(vecs, insert_mode, scatter_mode);
+    batch_vec_ghost_update_end(vecs, insert_mode, scatter_mode);
+}
+
+inline void
+batch_vec_ghost_update(const std::vector<std::vector<libMesh::PetscVector<double>*> >& vecs,
+                       const InsertMode insert_mode,
+                       const ScatterMode scatter_mode)
+{
+    batch_vec_ghost_update_begin(vecs, insert_mode, scatter_mode);
+    batch_vec_ghost_update_end(vecs, insert_mode, scatter_mode);
+}
+
 /**
  * Return the quadrature key description (see QuadratureCache, FECache, and
  * FEMapCache) of a quadrature rule.
@@ -442,6 +492,17 @@ getQuadratureKey(const libMesh::QuadratureType quad_type,
                  const boost::multi_array<double, 2>& X_node,
                  const double dx_min);
 
+/**
+ * Return the adaptive quadrature key (see getQuadratureKey()) of an element
+ * whose maximum edge length @p hmax has already been computed.
+ */
+std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>
+getAdaptiveQuadratureKey(const libMesh::QuadratureType quad_type,
+                         const double point_density,
+                         const libMesh::Elem* const elem,
+                         const double hmax,
+                         const double dx_min);
+
 /**
  * Populate @p U_node with the finite element solution coefficients on the
  * current element. This particular overload is for scalar finite elements.
@@ -874,6 +935,32 @@ tensor_inverse_transpose(const libMesh::TensorValue<double>& A, const int dim =
     return A_inv_trans;
 } // tensor_inverse_transpose
 
+inline void
+tensor_inverse(std::vector<libMesh::TensorValue<double> >& A_inv,
+               const std::vector<libMesh::TensorValue<double> >& A,
+               const int dim = NDIM)
+{
+    A_inv.resize(A.size());
+    for (unsigned int k = 0; k < A.size(); ++k)
+    {
+        tensor_inverse(A_inv[k], A[k], dim);
+    }
+    return;
+} // tensor_inverse
+
+inline void
+tensor_inverse_transpose(std::vector<libMesh::TensorValue<double> >& A_inv_trans,
+                         const std::vector<libMesh::TensorValue<double> >& A,
+                         const int dim = NDIM)
+{
+    A_inv_trans.resize(A.size());
+    for (unsigned int k = 0; k < A.size(); ++k)
+    {
+        tensor_inverse_transpose(A_inv_trans[k], A[k], dim);
+    }
+    return;
+} // tensor_inverse_transpose
+
 inline void
 outer_product(libMesh::TensorValue<double>& u_prod_v,
               const libMesh::TypeVector<double>& u,
@@ -1491,6 +1578,132 @@ get_global_active_element_bounding_boxes(const libMesh::MeshBase& mesh,
  */
 std::vector<libMeshWrappers::BoundingBox> get_global_active_element_bounding_boxes(const libMesh::MeshBase& mesh,
                                                                                    const libMesh::System& X_system);
+
+/**
+ * Uniform grid acceleration structure for determining which of a collection
+ * of bounding boxes (typically the bounding boxes of mesh elements, as
+ * computed by get_global_active_element_bounding_boxes()) intersect a given
+ * bounding box (typically that of a Cartesian grid patch).
+ *
+ * Each bounding box is stored in every bin of a uniform grid that it
+ * overlaps, so building the grid costs O(N) operations for N boxes of
+ * roughly the bin width and each query only examines the boxes stored in the
+ * bins overlapped by the query box, instead of all N boxes.
+ */
+class BoundingBoxGrid
+{
+public:
+    /**
+     * Constructor. If @p bin_width is not positive then a bin width is
+     * chosen so that there are roughly as many bins as bounding boxes, but
+     * bins are no smaller than the average bounding box.
+     */
+    BoundingBoxGrid(std::vector<libMeshWrappers::BoundingBox> bboxes, double bin_width = 0.0);
+
+    /**
+     * Set @p indices to the (sorted) indices of the stored bounding boxes
+     * that intersect @p query_bbox.
+     */
+    void findIntersectingBoxes(const libMeshWrappers::BoundingBox& query_bbox, std::vector<std::size_t>& indices) const;
+
+    /**
+     * Return the stored bounding boxes.
+     */
+    const std::vector<libMeshWrappers::BoundingBox>& getBoxes() const
+    {
+        return d_bboxes;
+    }
+
+private:
+    /**
+     * Compute the range of bins overlapped by the given bounding box.
+     */
+    void getBinRange(const libMeshWrappers::BoundingBox& bbox,
+                     std::array<std::size_t, LIBMESH_DIM>& lower,
+                     std::array<std::size_t, LIBMESH_DIM>& upper) const;
+
+    std::vector<libMeshWrappers::BoundingBox> d_bboxes;
+    libMesh::Point d_x_lower;
+    double d_bin_width = 0.0;
+    std::array<std::size_t, LIBMESH_DIM> d_n_bins;
+
+    /// Offsets into d_bin_boxes for each bin, stored in compressed row format.
+    std::vector<std::size_t> d_bin_offsets;
+    std::vector<std::size_t> d_bin_boxes;
+};
+
+/**
+ * Bounding volume hierarchy (a binary tree of axis-aligned bounding boxes)
+ * for determining which of a collection of bounding boxes (typically the
+ * bounding boxes of the elements of a surface mesh near a Cartesian grid
+ * patch) intersect a given bounding box (typically that of a grid cell).
+ *
+ * Unlike BoundingBoxGrid, the cost of a query does not depend on how evenly
+ * the boxes are distributed in space, which makes the tree better suited to
+ * codimension-one meshes. The tree is built in O(N log N) operations by
+ * recursively splitting the boxes at the median of their centers along the
+ * longest axis. If the boxes only move slightly (e.g., because the mesh has
+ * been advanced by one time step), refit() updates the bounding volumes of
+ * the existing tree in O(N) operations instead of rebuilding it; queries
+ * remain correct, and only become less efficient, as the boxes move.
+ */
+class BoundingBoxTree
+{
+public:
+    /**
+     * Constructor.
+     */
+    explicit BoundingBoxTree(std::vector<libMeshWrappers::BoundingBox> bboxes);
+
+    /**
+     * Replace the stored bounding boxes by @p bboxes, which must contain the
+     * same number of boxes and be in the same order as the boxes from which
+     * the tree was built, and update the bounding volumes of the tree without
+     * changing its structure.
+     */
+    void refit(std::vector<libMeshWrappers::BoundingBox> bboxes);
+
+    /**
+     * Set @p indices to the (sorted) indices of the stored bounding boxes
+     * that intersect @p query_bbox.
+     */
+    void findIntersectingBoxes(const libMeshWrappers::BoundingBox& query_bbox, std::vector<std::size_t>& indices) const;
+
+    /**
+     * Return the stored bounding boxes.
+     */
+    const std::vector<libMeshWrappers::BoundingBox>& getBoxes() const
+    {
+        return d_bboxes;
+    }
+
+private:
+    /**
+     * A node of the tree. Leaves store the range [begin, end) of
+     * d_box_order and have right_child == 0; the left child of an interior
+     * node immediately follows it in d_nodes.
+     */
+    struct Node
+    {
+        libMeshWrappers::BoundingBox bbox;
+        std::size_t begin, end, right_child;
+    };
+
+    /**
+     * Build the subtree for the boxes d_box_order[begin], ...,
+     * d_box_order[end - 1] and return the index of its root.
+     */
+    std::size_t buildNode(std::size_t begin, std::size_t end);
+
+    /**
+     * Update the bounding volumes of all nodes from the stored boxes.
+     */
+    void computeNodeBoxes();
+
+    std::vector<libMeshWrappers::BoundingBox> d_bboxes;
+    std::vector<std::size_t> d_box_order;
+    std::vector<Node> d_nodes;
+};
 } // namespace IBTK
 
 //////////////////////////////////////////////////////////////////////////////
@@ -18,15 +18,22 @@
 
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/ibtk_utilities.h"
+#include "ibtk/muParserExpressionCompiler.h"
 
+#include "Box.h"
 #include "CartesianGridGeometry.h"
 #include "PatchLevel.h"
 #include "tbox/Pointer.h"
 
 #include "muParser.h"
 
+#include <array>
+#include <functional>
 #include <map>
+#include <memory>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 namespace SAMRAI
@@ -53,6 +60,19 @@ namespace IBTK
  * class CartGridFunction that allows for the run-time specification of
  * (possibly spatially- and temporally-varying) functions which are used to set
  * double precision values on standard SAMRAI SAMRAI::hier::PatchData objects.
+ *
+ * Functions that do not depend on time (i.e., that do not use the variables
+ * <TT>t</TT> or <TT>T</TT>) are evaluated only once on each patch: their values
+ * are cached and reused until the patch changes, e.g., because the patch
+ * hierarchy is regridded.  Caching may be disabled by setting the input
+ * database key <TT>cache_time_independent_values</TT> to <TT>FALSE</TT>.
+ *
+ * If the input database key <TT>use_compiled_expressions</TT> is set to
+ * <TT>TRUE</TT>, the functions are compiled into native code at run time by
+ * class muParserExpressionCompiler, which also reads its settings from the
+ * input database.  This option requires that IBTK be configured with
+ * <TT>--enable-compiled-expressions</TT>.  Functions that cannot be compiled
+ * are evaluated by mu::Parser.
  */
 class muParserCartGridFunction : public CartGridFunction
 {
@@ -91,6 +111,23 @@ public:
                         SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level =
                             SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> >(NULL)) override;
 
+    /*!
+     * \note This concrete IBTK::CartGridFunction is evaluated one patch at a
+     * time and can be accumulated.
+     */
+    bool supportsAddDataOnPatch() const override;
+
+    /*!
+     * \brief Add the values of the function to the data on the patch interior.
+     */
+    void addDataOnPatch(int data_idx,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > var,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                        double data_time,
+                        bool initial_time = false,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level =
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> >(NULL)) override;
+
     //\}
 
 private:
@@ -122,6 +159,31 @@ private:
      */
     muParserCartGridFunction& operator=(const muParserCartGridFunction& that) = delete;
 
+    /*!
+     * Return the index of the function that sets the specified depth and
+     * axis component of patch data with the specified depth.
+     */
+    int getFunctionDepth(int data_depth, int axis, int depth) const;
+
+    /*!
+     * Evaluate the function on the patch interior and either set the data to
+     * or add to the data the computed values.
+     */
+    void evaluateOnPatch(int data_idx, SAMRAI::hier::Patch<NDIM>& patch, double data_time, bool add);
+
+    /*!
+     * Evaluate the specified function at the positions that are computed by
+     * the provided function object.  The values of time-independent functions
+     * are cached, so that the positions are only computed and the function is
+     * only evaluated the first time the values are requested on a patch.
+     */
+    const std::vector<double>&
+    evaluateFunction(int function_depth,
+                     int centering,
+                     int axis,
+                     const SAMRAI::hier::Patch<NDIM>& patch,
+                     const std::function<void(std::vector<std::array<double, NDIM> >&)>& compute_positions);
+
     /*!
      * The Cartesian grid geometry object provides the extents of the
      * computational domain.
@@ -149,6 +211,46 @@ private:
      */
     double d_parser_time = 0.0;
     Point d_parser_posn;
+
+    /*!
+     * Whether each function depends on time.
+     */
+    std::vector<bool> d_time_dependent;
+
+    /*!
+     * Whether the values of time-independent functions are cached.
+     */
+    bool d_cache_time_independent_values = true;
+
+    /*!
+     * The compiled functions, if enabled.
+     */
+    std::unique_ptr<muParserExpressionCompiler> d_compiler;
+
+    /*!
+     * Cached values of the time-independent functions on a patch, indexed by
+     * the data centering, the function index, and the axis, along with the
+     * patch box and grid spacing for which they were computed.
+     */
+    struct PatchValues
+    {
+        SAMRAI::hier::Box<NDIM> box;
+        std::array<double, NDIM> dx;
+        std::map<std::tuple<int, int, int>, std::vector<double> > values;
+    };
+
+    /*!
+     * Cached values of the time-independent functions on the local patches,
+     * indexed by the patch level number and the patch number.
+     */
+    std::map<std::pair<int, int>, PatchValues> d_cached_values;
+
+    /*!
+     * Scratch storage for the evaluation positions and the values of
+     * time-dependent functions.
+     */
+    std::vector<std::array<double, NDIM> > d_positions;
+    std::vector<double> d_values;
 };
 } // namespace IBTK
 
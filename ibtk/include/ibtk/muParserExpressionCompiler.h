@@ -0,0 +1,149 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_muParserExpressionCompiler
+#define included_IBTK_muParserExpressionCompiler
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+#include "muParser.h"
+
+#include <string>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class muParserExpressionCompiler translates the expressions evaluated
+ * by a collection of mu::Parser objects into C++, compiles them into a shared
+ * library at run time, and loads the compiled functions, so that the
+ * expressions may be evaluated at the cost of native code.
+ *
+ * The expressions may use the time variable and the components of the position
+ * variable that are provided to the constructor, the constants that are
+ * defined by the parsers, and the built-in functions and operators of
+ * mu::Parser.  Expressions that use other features (e.g., user-defined
+ * functions or assignment), or whose compiled functions do not reproduce the
+ * values computed by mu::Parser at a collection of sample points, are not
+ * compiled: getFunction() returns nullptr for these expressions, which should
+ * continue to be evaluated by mu::Parser.  If the shared library cannot be
+ * compiled or loaded, a warning is printed and no expressions are compiled.
+ *
+ * Run-time compilation is only available if IBTK is configured with
+ * <TT>--enable-compiled-expressions</TT>; otherwise, a warning is printed and
+ * no expressions are compiled.  The compiler command is fixed at configure time
+ * by the <TT>EXPRESSION_CXX</TT> variable (default: the C++ compiler used to
+ * build IBTK) and cannot be set from the input database.
+ *
+ * The shared library is compiled by the root process in a directory that must
+ * be accessible by all processes.  Libraries are named by a hash of the
+ * generated code, so that they are reused by subsequent runs.
+ *
+ * The following input database keys are used:
+ *
+ * - <TT>compiled_expression_directory</TT>: the directory in which the
+ *   generated code and the shared library are stored (default <TT>"."</TT>).
+ *   The name may only contain letters, digits, and the characters '_', '-',
+ *   '.', and '/'.
+ */
+class muParserExpressionCompiler
+{
+public:
+    /*!
+     * \brief Type of the compiled functions, which are evaluated at position
+     * X and time t.
+     */
+    using FunctionPtr = double (*)(const double* X, double t);
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param object_name  The name of the object, which is used in warnings.
+     * \param parsers      The parsers whose expressions are compiled.
+     * \param time_var     The time variable used by the parsers.
+     * \param posn_vars    The NDIM components of the position variable used by
+     *                     the parsers.
+     * \param input_db     The input database, which may be null.
+     *
+     * \note This constructor must be called by all processes.
+     */
+    muParserExpressionCompiler(std::string object_name,
+                               const std::vector<const mu::Parser*>& parsers,
+                               double* time_var,
+                               double* posn_vars,
+                               SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~muParserExpressionCompiler();
+
+    /*!
+     * \brief Return the compiled function for the expression of the specified
+     * parser, or nullptr if the expression was not compiled.
+     */
+    FunctionPtr getFunction(unsigned int k) const;
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    muParserExpressionCompiler() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    muParserExpressionCompiler(const muParserExpressionCompiler& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    muParserExpressionCompiler& operator=(const muParserExpressionCompiler& that) = delete;
+
+    /*!
+     * The name of the object.
+     */
+    std::string d_object_name;
+
+    /*!
+     * The handle of the loaded shared library.
+     */
+    void* d_library_handle = nullptr;
+
+    /*!
+     * The compiled functions.
+     */
+    std::vector<FunctionPtr> d_functions;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_muParserExpressionCompiler
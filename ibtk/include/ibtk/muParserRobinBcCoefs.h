@@ -17,7 +17,9 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibtk/ibtk_utilities.h"
+#include "ibtk/muParserExpressionCompiler.h"
 
+#include "Box.h"
 #include "CartesianGridGeometry.h"
 #include "IntVector.h"
 #include "RobinBcCoefStrategy.h"
@@ -25,8 +27,11 @@
 
 #include "muParser.h"
 
+#include <array>
 #include <map>
+#include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace SAMRAI
@@ -64,6 +69,19 @@ namespace IBTK
  * homogeneous Robin boundary condition coefficients.  Note, however, that all
  * linear solvers in IBTK are presently designed to support spatially and
  * temporally varying \em inhomogeneous boundary coefficients.
+ *
+ * Coefficient functions that do not depend on time (i.e., that do not use the
+ * variables <TT>t</TT> or <TT>T</TT>) are evaluated only once on each boundary
+ * box: their values are cached and reused until the patch changes, e.g.,
+ * because the patch hierarchy is regridded.  Caching may be disabled by setting
+ * the input database key <TT>cache_time_independent_values</TT> to
+ * <TT>FALSE</TT>.
+ *
+ * If the input database key <TT>use_compiled_expressions</TT> is set to
+ * <TT>TRUE</TT>, the coefficient functions are compiled into native code at run
+ * time by class muParserExpressionCompiler.  This option requires that IBTK be
+ * configured with <TT>--enable-compiled-expressions</TT>.  Functions that cannot
+ * be compiled are evaluated by mu::Parser.
  */
 class muParserRobinBcCoefs : public SAMRAI::solv::RobinBcCoefStrategy<NDIM>
 {
@@ -75,6 +93,11 @@ public:
                          SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
                          SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > grid_geom);
 
+    /*!
+     * \brief Return whether any of the coefficient functions depend on time.
+     */
+    bool isTimeDependent() const;
+
     /*!
      * \name Implementation of SAMRAI::solv::RobinBcCoefStrategy interface.
      */
@@ -209,6 +232,44 @@ private:
     std::array<mu::Parser, 2 * NDIM> d_acoef_parsers;
     std::array<mu::Parser, 2 * NDIM> d_bcoef_parsers;
     std::array<mu::Parser, 2 * NDIM> d_gcoef_parsers;
+
+    /*!
+     * Whether each of the acoef, bcoef, and gcoef functions (stored in that
+     * order for each side) depends on time.
+     */
+    std::array<bool, 3 * 2 * NDIM> d_time_dependent;
+
+    /*!
+     * Whether the values of time-independent coefficient functions are cached.
+     */
+    bool d_cache_time_independent_values = true;
+
+    /*!
+     * The compiled coefficient functions, if enabled.
+     */
+    std::unique_ptr<muParserExpressionCompiler> d_compiler;
+
+    /*!
+     * Cached values of a time-independent coefficient function on a boundary
+     * box, along with the coefficient box, patch box, and grid spacing for
+     * which they were computed.
+     */
+    struct BoundaryValues
+    {
+        SAMRAI::hier::Box<NDIM> coef_box, patch_box;
+        std::array<double, NDIM> dx;
+        std::vector<double> values;
+    };
+
+    /*!
+     * Cached values of the time-independent coefficient functions, indexed by
+     * the patch level number, the patch number, the boundary location index,
+     * and the coefficient (0, 1, or 2 for acoef, bcoef, or gcoef).
+     *
+     * This value is mutable since it is updated by
+     * muParserRobinBcCoefs::setBcCoefs.
+     */
+    mutable std::map<std::tuple<int, int, int, int>, BoundaryValues> d_cached_values;
 };
 } // namespace IBTK
 
@@ -154,6 +154,56 @@ IBTK_MPI::allGather(T x_in, T* x_out, IBTK_MPI::comm communicator)
     MPI_Allgather(&x_in, 1, mpi_type_id(x_in), x_out, 1, mpi_type_id(x_in), communicator);
 } // allGather
 
+template <typename T>
+inline IBTK_MPI::request
+IBTK_MPI::iminReduction(T* x, const int n, IBTK_MPI::comm communicator)
+{
+    return ireduction(x, n, MPI_MIN, communicator);
+} // iminReduction
+
+template <typename T>
+inline IBTK_MPI::request
+IBTK_MPI::imaxReduction(T* x, const int n, IBTK_MPI::comm communicator)
+{
+    return ireduction(x, n, MPI_MAX, communicator);
+} // imaxReduction
+
+template <typename T>
+inline IBTK_MPI::request
+IBTK_MPI::isumReduction(T* x, const int n, IBTK_MPI::comm communicator)
+{
+    return ireduction(x, n, MPI_SUM, communicator);
+} // isumReduction
+
+template <typename T>
+inline IBTK_MPI::request
+IBTK_MPI::iallGather(const T* x_in, const int n, T* x_out, IBTK_MPI::comm communicator)
+{
+    IBTK_MPI::request request = MPI_REQUEST_NULL;
+    if (n == 0) return request;
+    MPI_Iallgather(x_in, n, mpi_type_id(x_in[0]), x_out, n, mpi_type_id(x_in[0]), communicator, &request);
+    return request;
+} // iallGather
+
+template <typename T>
+inline void
+IBTK_MPI::neighborAllGather(const T* x_in, const int n, T* x_out, IBTK_MPI::comm neighbor_communicator)
+{
+    if (n == 0) return;
+    MPI_Neighbor_allgather(x_in, n, mpi_type_id(x_in[0]), x_out, n, mpi_type_id(x_in[0]), neighbor_communicator);
+} // neighborAllGather
+
+template <typename T>
+inline IBTK_MPI::request
+IBTK_MPI::ineighborAllGather(const T* x_in, const int n, T* x_out, IBTK_MPI::comm neighbor_communicator)
+{
+    IBTK_MPI::request request = MPI_REQUEST_NULL;
+    if (n == 0) return request;
+    MPI_Ineighbor_allgather(
+        x_in, n, mpi_type_id(x_in[0]), x_out, n, mpi_type_id(x_in[0]), neighbor_communicator, &request);
+    return request;
+} // ineighborAllGather
+
 //////////////////////////////////////  PRIVATE  ///////////////////////////////////////////////////
 template <typename T>
 inline void
@@ -173,6 +223,16 @@ IBTK_MPI::minMaxReduction(T* x, const int n, int* rank, MPI_Op op, IBTK_MPI::com
         rank[i] = send[i].second;
     }
 } // minMaxReduction
+
+template <typename T>
+inline IBTK_MPI::request
+IBTK_MPI::ireduction(T* x, const int n, MPI_Op op, IBTK_MPI::comm communicator)
+{
+    IBTK_MPI::request request = MPI_REQUEST_NULL;
+    if (n == 0 || getNodes(communicator) < 2) return request;
+    MPI_Iallreduce(MPI_IN_PLACE, x, n, mpi_type_id(x[0]), op, communicator, &request);
+    return request;
+} // ireduction
 } // namespace IBTK
 
 #endif
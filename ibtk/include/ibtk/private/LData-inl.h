@@ -146,6 +146,11 @@ LData::restoreArrays()
 inline void
 LData::beginGhostUpdate()
 {
+    if (d_use_shared_memory_ghost_update)
+    {
+        beginSharedMemoryGhostUpdate();
+        return;
+    }
     const int ierr = VecGhostUpdateBegin(getVec(), INSERT_VALUES, SCATTER_FORWARD);
     IBTK_CHKERRQ(ierr);
     return;
@@ -154,6 +159,11 @@ LData::beginGhostUpdate()
 inline void
 LData::endGhostUpdate()
 {
+    if (d_use_shared_memory_ghost_update)
+    {
+        endSharedMemoryGhostUpdate();
+        return;
+    }
     const int ierr = VecGhostUpdateEnd(getVec(), INSERT_VALUES, SCATTER_FORWARD);
     IBTK_CHKERRQ(ierr);
     return;
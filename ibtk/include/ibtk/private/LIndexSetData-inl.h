@@ -18,6 +18,9 @@
 
 #include "ibtk/LIndexSetData.h"
 
+#include <algorithm>
+#include <iterator>
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBTK
@@ -108,6 +111,18 @@ LIndexSetData<T>::getGhostPeriodicShifts() const
     return d_ghost_periodic_shifts;
 } // getGhostPeriodicShifts
 
+template <class T>
+inline bool
+LIndexSetData<T>::isActiveLagrangianIndex(const int lag_idx) const
+{
+    if (d_inactive_lag_idx_ranges.empty()) return true;
+    auto it = std::upper_bound(d_inactive_lag_idx_ranges.begin(),
+                               d_inactive_lag_idx_ranges.end(),
+                               lag_idx,
+                               [](const int idx, const std::pair<int, int>& range) { return idx < range.first; });
+    return it == d_inactive_lag_idx_ranges.begin() || lag_idx >= std::prev(it)->second;
+} // isActiveLagrangianIndex
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
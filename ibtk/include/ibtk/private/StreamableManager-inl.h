@@ -22,6 +22,9 @@
 #include "tbox/AbstractStream.h"
 #include "tbox/Utilities.h"
 
+#include <cstddef>
+#include <vector>
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBTK
@@ -77,8 +80,9 @@ StreamableManager::unpackStream(SAMRAI::tbox::AbstractStream& stream, const SAMR
     stream.unpack(&streamable_id, 1);
 #if !defined(NDEBUG)
     TBOX_ASSERT(d_factory_map.count(streamable_id) == 1);
+    TBOX_ASSERT(streamable_id >= 0 && streamable_id < static_cast<int>(d_factory_table.size()));
 #endif
-    return d_factory_map[streamable_id]->unpackStream(stream, offset);
+    return d_factory_table[streamable_id]->unpackStream(stream, offset);
 } // unpackStream
 
 inline void
@@ -88,12 +92,20 @@ StreamableManager::unpackStream(SAMRAI::tbox::AbstractStream& stream,
 {
     int num_data;
     stream.unpack(&num_data, 1);
-    data_items.resize(num_data);
-    for (auto& data_item : data_items)
+
+    // Release any excess storage before reserving exactly the required
+    // capacity, rather than trimming (and thereby copying) the vector after
+    // the items have been unpacked.
+    data_items.clear();
+    if (data_items.capacity() > static_cast<std::size_t>(num_data))
+    {
+        std::vector<SAMRAI::tbox::Pointer<Streamable> >().swap(data_items);
+    }
+    data_items.reserve(num_data);
+    for (int k = 0; k < num_data; ++k)
     {
-        data_item = unpackStream(stream, offset);
+        data_items.push_back(unpackStream(stream, offset));
     }
-    std::vector<SAMRAI::tbox::Pointer<Streamable> >(data_items).swap(data_items); // trim-to-fit
     return;
 } // unpackStream
 
@@ -0,0 +1,44 @@
+## ---------------------------------------------------------------------
+##
+## Copyright (c) 2020 - 2020 by the IBAMR developers
+## All rights reserved.
+##
+## This file is part of IBAMR.
+##
+## IBAMR is free software and is distributed under the 3-clause BSD
+## license. The full text of the license can be found in the file
+## COPYRIGHT at the top level directory of IBAMR.
+##
+## ---------------------------------------------------------------------
+
+AC_DEFUN([CONFIGURE_COMPILED_EXPRESSIONS],[
+echo
+echo "===================================================="
+echo "Configuring optional run-time compiled expressions"
+echo "===================================================="
+
+AC_ARG_ENABLE([compiled-expressions],
+  AS_HELP_STRING(--enable-compiled-expressions,enable compiling muParser expressions into shared libraries at run time @<:@default=no@:>@),
+                 [case "$enableval" in
+                    yes)  COMPILED_EXPRESSIONS_ENABLED=yes ;;
+                    no)   COMPILED_EXPRESSIONS_ENABLED=no ;;
+                    *)    AC_MSG_ERROR(--enable-compiled-expressions=$enableval is invalid; choices are "yes" and "no") ;;
+                  esac],[COMPILED_EXPRESSIONS_ENABLED=no])
+
+AC_ARG_VAR([EXPRESSION_CXX],[the compiler command used to compile muParser expressions at run time @<:@default=CXX@:>@])
+
+if test "$COMPILED_EXPRESSIONS_ENABLED" = yes; then
+  AC_CHECK_HEADER([dlfcn.h],,AC_MSG_ERROR([compiled expressions enabled but could not find dlfcn.h]))
+  AC_SEARCH_LIBS([dlopen], [dl], [],
+                 [AC_MSG_ERROR([compiled expressions enabled but could not find a library providing dlopen])])
+  if test x"$EXPRESSION_CXX" = x ; then
+    EXPRESSION_CXX="$CXX"
+  fi
+  AC_DEFINE([HAVE_COMPILED_EXPRESSIONS],1,[Define if muParser expressions may be compiled at run time.])
+  AC_DEFINE_UNQUOTED([EXPRESSION_CXX],["$EXPRESSION_CXX"],[The compiler command used to compile muParser expressions at run time.])
+  AC_MSG_NOTICE([muParser expressions may be compiled at run time by $EXPRESSION_CXX])
+else
+  AC_MSG_NOTICE([Optional run-time compiled expressions are DISABLED])
+fi
+
+])
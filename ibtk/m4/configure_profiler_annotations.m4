@@ -0,0 +1,97 @@
+## ---------------------------------------------------------------------
+##
+## Copyright (c) 2020 - 2020 by the IBAMR developers
+## All rights reserved.
+##
+## This file is part of IBAMR.
+##
+## IBAMR is free software and is distributed under the 3-clause BSD
+## license. The full text of the license can be found in the file
+## COPYRIGHT at the top level directory of IBAMR.
+##
+## ---------------------------------------------------------------------
+
+AC_DEFUN([CONFIGURE_PROFILER_ANNOTATIONS],[
+echo
+echo "===================================================="
+echo "Configuring optional profiler annotation backend"
+echo "===================================================="
+
+AC_ARG_WITH([profiler-annotations],
+  AS_HELP_STRING([--with-profiler-annotations=BACKEND],[forward the regions recorded by IBTK::PerformanceMonitor to an external profiler; choices are "none", "caliper", "nvtx", "scorep", and "itt" @<:@default=none@:>@]),
+                 [case "$withval" in
+                    no|none)  PROFILER_ANNOTATIONS=none ;;
+                    caliper)  PROFILER_ANNOTATIONS=caliper ;;
+                    nvtx)     PROFILER_ANNOTATIONS=nvtx ;;
+                    scorep)   PROFILER_ANNOTATIONS=scorep ;;
+                    itt)      PROFILER_ANNOTATIONS=itt ;;
+                    *)        AC_MSG_ERROR([--with-profiler-annotations=$withval is invalid; choices are "none", "caliper", "nvtx", "scorep", and "itt"]) ;;
+                  esac],[PROFILER_ANNOTATIONS=none])
+
+AC_ARG_WITH([profiler-annotations-dir],
+  AS_HELP_STRING(--with-profiler-annotations-dir=PATH,location of the installation of the profiler selected by --with-profiler-annotations),
+  [if test "$PROFILER_ANNOTATIONS" = none ; then
+     AC_MSG_WARN([--with-profiler-annotations-dir is specified, but no profiler annotation backend is selected])
+   else
+     if test ! -d "$withval" ; then
+       AC_MSG_ERROR([it is necessary to specify an existing directory when using --with-profiler-annotations-dir=PATH])
+     fi
+     PROFILER_ANNOTATIONS_DIR=$withval
+   fi])
+
+if test "$PROFILER_ANNOTATIONS" != none; then
+  if test x$PROFILER_ANNOTATIONS_DIR != x ; then
+    if test -d "${PROFILER_ANNOTATIONS_DIR}/include" ; then
+      PROFILER_ANNOTATIONS_CPPFLAGS="-I${PROFILER_ANNOTATIONS_DIR}/include"
+    fi
+    if test -d "${PROFILER_ANNOTATIONS_DIR}/lib64" ; then
+      PROFILER_ANNOTATIONS_LIBDIR="${PROFILER_ANNOTATIONS_DIR}/lib64"
+    elif test -d "${PROFILER_ANNOTATIONS_DIR}/lib" ; then
+      PROFILER_ANNOTATIONS_LIBDIR="${PROFILER_ANNOTATIONS_DIR}/lib"
+    else
+      AC_MSG_ERROR([Unable to find lib directory for the profiler: neither ${PROFILER_ANNOTATIONS_DIR}/lib64 nor ${PROFILER_ANNOTATIONS_DIR}/lib exists.])
+    fi
+    PROFILER_ANNOTATIONS_LDFLAGS="-L${PROFILER_ANNOTATIONS_LIBDIR}"
+  fi
+
+  CPPFLAGS_PREPEND($PROFILER_ANNOTATIONS_CPPFLAGS)
+  LDFLAGS_PREPEND($PROFILER_ANNOTATIONS_LDFLAGS)
+  case "$PROFILER_ANNOTATIONS" in
+    caliper)
+      AC_CHECK_HEADER([caliper/cali.h],,AC_MSG_ERROR([Caliper annotations enabled but could not find working caliper/cali.h]))
+      AC_SEARCH_LIBS([cali_begin_region], [caliper], [],
+                     [AC_MSG_ERROR([Caliper annotations enabled but could not find working libcaliper])])
+      AC_DEFINE([HAVE_CALIPER],1,[Define if PerformanceMonitor regions are forwarded to Caliper.])
+      ;;
+    nvtx)
+      AC_CHECK_HEADER([nvToolsExt.h],,AC_MSG_ERROR([NVTX annotations enabled but could not find working nvToolsExt.h]))
+      AC_SEARCH_LIBS([nvtxRangePushA], [nvToolsExt], [],
+                     [AC_MSG_ERROR([NVTX annotations enabled but could not find working libnvToolsExt])])
+      AC_DEFINE([HAVE_NVTX],1,[Define if PerformanceMonitor regions are forwarded to NVTX ranges.])
+      ;;
+    scorep)
+      # Score-P user regions are only active when SCOREP_USER_ENABLE is defined
+      # and the library is linked with the scorep compiler wrapper, e.g.,
+      # CXX="scorep --user mpicxx".
+      CPPFLAGS_PREPEND(-DSCOREP_USER_ENABLE)
+      AC_CHECK_HEADER([scorep/SCOREP_User.h],,AC_MSG_ERROR([Score-P annotations enabled but could not find working scorep/SCOREP_User.h]))
+      AC_DEFINE([HAVE_SCOREP],1,[Define if PerformanceMonitor regions are forwarded to Score-P user regions.])
+      ;;
+    itt)
+      AC_CHECK_HEADER([ittnotify.h],,AC_MSG_ERROR([ITT annotations enabled but could not find working ittnotify.h]))
+      AC_SEARCH_LIBS([__itt_domain_create_ptr__3_0], [ittnotify], [],
+                     [AC_MSG_ERROR([ITT annotations enabled but could not find working libittnotify])])
+      AC_DEFINE([HAVE_ITTNOTIFY],1,[Define if PerformanceMonitor regions are forwarded to ITT tasks.])
+      ;;
+  esac
+
+  # set up rpath
+  if test x$PROFILER_ANNOTATIONS_LIBDIR != x ; then
+    ADD_RPATH_LDFLAG(${PROFILER_ANNOTATIONS_LIBDIR})
+  fi
+  AC_MSG_NOTICE([PerformanceMonitor regions are forwarded to $PROFILER_ANNOTATIONS])
+else
+  AC_MSG_NOTICE([Optional profiler annotation backend is DISABLED])
+fi
+
+])
@@ -316,6 +316,32 @@ CartCellDoubleQuadraticCFInterpolation::setPatchHierarchy(Pointer<PatchHierarchy
         d_cf_boundary[ln] = CoarseFineBoundary<NDIM>(*d_hierarchy, ln, max_ghost_width);
     }
 
+    // Cache the co-dimension 1 coarse-fine boundary fill boxes of the local
+    // patches so that they need not be recomputed each time data are filled.
+    d_cf_bdry_fill_boxes.resize(finest_level_number + 1);
+    const IntVector<NDIM> ghost_width_to_fill = GHOST_WIDTH_TO_FILL;
+    for (int ln = 0; ln <= finest_level_number; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        d_cf_bdry_fill_boxes[ln].resize(level->getNumberOfPatches());
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const int patch_num = p();
+            Pointer<Patch<NDIM> > patch = level->getPatch(patch_num);
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Array<BoundaryBox<NDIM> >& cf_bdry_codim1_boxes = d_cf_boundary[ln].getBoundaries(patch_num, 1);
+            auto& fill_boxes = d_cf_bdry_fill_boxes[ln][patch_num];
+            fill_boxes.reserve(cf_bdry_codim1_boxes.size());
+            for (int k = 0; k < cf_bdry_codim1_boxes.size(); ++k)
+            {
+                const BoundaryBox<NDIM>& bdry_box = cf_bdry_codim1_boxes[k];
+                fill_boxes.emplace_back(pgeom->getBoundaryFillBox(bdry_box, patch_box, ghost_width_to_fill),
+                                        bdry_box.getLocationIndex());
+            }
+        }
+    }
+
     Pointer<GridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
     const BoxArray<NDIM>& domain_boxes = grid_geom->getPhysicalDomain();
 
@@ -340,6 +366,7 @@ CartCellDoubleQuadraticCFInterpolation::clearPatchHierarchy()
 {
     d_hierarchy.setNull();
     d_cf_boundary.clear();
+    d_cf_bdry_fill_boxes.clear();
     d_domain_boxes.clear();
     d_periodic_shift.clear();
     return;
@@ -576,12 +603,11 @@ CartCellDoubleQuadraticCFInterpolation::postprocessRefine_optimized(Patch<NDIM>&
                                                                     const Patch<NDIM>& coarse,
                                                                     const IntVector<NDIM>& ratio)
 {
-    // Get the co-dimension 1 cf boundary boxes.
+    // Get the cached co-dimension 1 cf boundary fill boxes.
     const int patch_num = fine.getPatchNumber();
     const int fine_patch_level_num = fine.getPatchLevelNumber();
-    const Array<BoundaryBox<NDIM> >& cf_bdry_codim1_boxes =
-        d_cf_boundary[fine_patch_level_num].getBoundaries(patch_num, 1);
-    if (cf_bdry_codim1_boxes.size() == 0) return;
+    const auto& cf_bdry_fill_boxes = d_cf_bdry_fill_boxes[fine_patch_level_num][patch_num];
+    if (cf_bdry_fill_boxes.empty()) return;
 
     // Get the patch data.
     for (const auto& patch_data_index : d_patch_data_indices)
@@ -608,15 +634,12 @@ CartCellDoubleQuadraticCFInterpolation::postprocessRefine_optimized(Patch<NDIM>&
         }
 #endif
         const int data_depth = fdata->getDepth();
-        const IntVector<NDIM> ghost_width_to_fill = GHOST_WIDTH_TO_FILL;
-        Pointer<CartesianPatchGeometry<NDIM> > pgeom_fine = fine.getPatchGeometry();
         const Box<NDIM>& patch_box_fine = fine.getBox();
         const Box<NDIM>& patch_box_crse = coarse.getBox();
-        for (int k = 0; k < cf_bdry_codim1_boxes.size(); ++k)
+        for (const auto& cf_bdry_fill_box : cf_bdry_fill_boxes)
         {
-            const BoundaryBox<NDIM>& bdry_box = cf_bdry_codim1_boxes[k];
-            const Box<NDIM> bc_fill_box = pgeom_fine->getBoundaryFillBox(bdry_box, patch_box_fine, ghost_width_to_fill);
-            const unsigned int location_index = bdry_box.getLocationIndex();
+            const Box<NDIM>& bc_fill_box = cf_bdry_fill_box.first;
+            const unsigned int location_index = cf_bdry_fill_box.second;
             for (int depth = 0; depth < data_depth; ++depth)
             {
                 double* const U_fine = fdata->getPointer(depth);
@@ -777,15 +800,14 @@ void
 CartCellDoubleQuadraticCFInterpolation::computeNormalExtension_optimized(Patch<NDIM>& patch,
                                                                          const IntVector<NDIM>& ratio)
 {
-    // Get the co-dimension 1 cf boundary boxes.
+    // Get the cached co-dimension 1 cf boundary fill boxes.
     const int patch_num = patch.getPatchNumber();
     const int patch_level_num = patch.getPatchLevelNumber();
-    const Array<BoundaryBox<NDIM> >& cf_bdry_codim1_boxes = d_cf_boundary[patch_level_num].getBoundaries(patch_num, 1);
-    const int n_cf_bdry_codim1_boxes = cf_bdry_codim1_boxes.size();
+    const auto& cf_bdry_fill_boxes = d_cf_bdry_fill_boxes[patch_level_num][patch_num];
 
     // Check to see if there are any co-dimension 1 coarse-fine boundary boxes
     // associated with the patch; if not, there is nothing to do.
-    if (n_cf_bdry_codim1_boxes == 0) return;
+    if (cf_bdry_fill_boxes.empty()) return;
 
     // Get the patch data.
     for (int patch_data_index : d_patch_data_indices)
@@ -803,14 +825,11 @@ CartCellDoubleQuadraticCFInterpolation::computeNormalExtension_optimized(Patch<N
         }
 #endif
         const int data_depth = data->getDepth();
-        const IntVector<NDIM> ghost_width_to_fill = GHOST_WIDTH_TO_FILL;
-        Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
         const Box<NDIM>& patch_box = patch.getBox();
-        for (int k = 0; k < n_cf_bdry_codim1_boxes; ++k)
+        for (const auto& cf_bdry_fill_box : cf_bdry_fill_boxes)
         {
-            const BoundaryBox<NDIM>& bdry_box = cf_bdry_codim1_boxes[k];
-            const Box<NDIM> bc_fill_box = pgeom->getBoundaryFillBox(bdry_box, patch_box, ghost_width_to_fill);
-            const unsigned int location_index = bdry_box.getLocationIndex();
+            const Box<NDIM>& bc_fill_box = cf_bdry_fill_box.first;
+            const unsigned int location_index = cf_bdry_fill_box.second;
             for (int depth = 0; depth < data_depth; ++depth)
             {
                 double* const U = data->getPointer(depth);
@@ -48,6 +48,12 @@ ExtendedRobinBcCoefStrategy::setHomogeneousBc(bool homogeneous_bc)
     return;
 } // setHomogeneousBc
 
+bool
+ExtendedRobinBcCoefStrategy::isTimeDependent() const
+{
+    return true;
+} // isTimeDependent
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
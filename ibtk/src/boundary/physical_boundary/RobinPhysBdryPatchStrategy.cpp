@@ -13,13 +13,26 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/ExtendedRobinBcCoefStrategy.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/app_namespaces.h" // IWYU pragma: keep
+#include "ibtk/muParserRobinBcCoefs.h"
 
+#include "ArrayData.h"
+#include "BoundaryBox.h"
 #include "Box.h"
+#include "CartesianPatchGeometry.h"
 #include "ComponentSelector.h"
-
+#include "Patch.h"
+#include "RobinBcCoefStrategy.h"
+#include "Variable.h"
+#include "tbox/Pointer.h"
+
+#include <algorithm>
+#include <array>
+#include <map>
 #include <set>
+#include <tuple>
 #include <vector>
 
 namespace SAMRAI
@@ -43,6 +56,21 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Determine whether the coefficients specified by a strategy are known not to
+// depend on time.
+inline bool
+is_time_independent(const RobinBcCoefStrategy<NDIM>* const bc_coef)
+{
+    const auto extended_bc_coef = dynamic_cast<const ExtendedRobinBcCoefStrategy*>(bc_coef);
+    if (extended_bc_coef) return !extended_bc_coef->isTimeDependent();
+    const auto muparser_bc_coef = dynamic_cast<const muParserRobinBcCoefs*>(bc_coef);
+    if (muparser_bc_coef) return !muparser_bc_coef->isTimeDependent();
+    return false;
+} // is_time_independent
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 void
@@ -95,6 +123,7 @@ RobinPhysBdryPatchStrategy::setPhysicalBcCoefs(const std::vector<RobinBcCoefStra
     }
 #endif
     d_bc_coefs = bc_coefs;
+    d_cached_bc_coef_data.clear();
     return;
 } // setPhysicalBcCoefs
 
@@ -142,6 +171,71 @@ RobinPhysBdryPatchStrategy::accumulateFromPhysicalBoundaryData(Patch<NDIM>& /*pa
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+void
+RobinPhysBdryPatchStrategy::setBcCoefData(Pointer<ArrayData<NDIM, double> >& acoef_data,
+                                          Pointer<ArrayData<NDIM, double> >& bcoef_data,
+                                          Pointer<ArrayData<NDIM, double> >& gcoef_data,
+                                          RobinBcCoefStrategy<NDIM>* const bc_coef,
+                                          const int patch_data_idx,
+                                          const Pointer<Variable<NDIM> >& var,
+                                          const Patch<NDIM>& patch,
+                                          const BoundaryBox<NDIM>& bdry_box,
+                                          const Box<NDIM>& bc_coef_box,
+                                          const double fill_time)
+{
+    std::array<Pointer<ArrayData<NDIM, double> >, 3>* coef_data = &d_scratch_bc_coef_data;
+    bool compute_coefs = true;
+    if (is_time_independent(bc_coef))
+    {
+        // Look up the cached coefficients, discarding any that were computed
+        // for a different patch box.
+        const Box<NDIM>& patch_box = patch.getBox();
+        Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
+        std::array<double, NDIM> x_lower, dx;
+        std::copy(pgeom->getXLower(), pgeom->getXLower() + NDIM, x_lower.begin());
+        std::copy(pgeom->getDx(), pgeom->getDx() + NDIM, dx.begin());
+        std::vector<CachedBcCoefData>& cached_data = d_cached_bc_coef_data[std::make_tuple(
+            bc_coef, patch.getPatchLevelNumber(), patch.getPatchNumber(), bdry_box.getLocationIndex(), patch_data_idx,
+            d_homogeneous_bc)];
+        cached_data.erase(
+            std::remove_if(cached_data.begin(),
+                           cached_data.end(),
+                           [&patch_box](const CachedBcCoefData& data) { return !(data.patch_box == patch_box); }),
+            cached_data.end());
+        auto it = std::find_if(cached_data.begin(), cached_data.end(), [&](const CachedBcCoefData& data) {
+            return data.bc_coef_box == bc_coef_box && data.x_lower == x_lower && data.dx == dx;
+        });
+        compute_coefs = it == cached_data.end();
+        if (compute_coefs)
+        {
+            cached_data.push_back(CachedBcCoefData{ patch_box, bc_coef_box, x_lower, dx, {} });
+            it = cached_data.end() - 1;
+        }
+        coef_data = &it->data;
+    }
+
+    if (compute_coefs)
+    {
+        for (auto& data : *coef_data)
+        {
+            if (!data || !(data->getBox() == bc_coef_box)) data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+        }
+        auto const extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
+        if (extended_bc_coef)
+        {
+            extended_bc_coef->setTargetPatchDataIndex(patch_data_idx);
+            extended_bc_coef->setHomogeneousBc(d_homogeneous_bc);
+        }
+        bc_coef->setBcCoefs((*coef_data)[0], (*coef_data)[1], (*coef_data)[2], var, patch, bdry_box, fill_time);
+        if (d_homogeneous_bc && !extended_bc_coef) (*coef_data)[2]->fillAll(0.0);
+        if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+    }
+    acoef_data = (*coef_data)[0];
+    bcoef_data = (*coef_data)[1];
+    gcoef_data = (*coef_data)[2];
+    return;
+} // setBcCoefData
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -14,6 +14,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibtk/ibtk_utilities.h"
+#include "ibtk/muParserExpressionCompiler.h"
 #include "ibtk/muParserRobinBcCoefs.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
@@ -38,6 +39,7 @@
 #include <map>
 #include <ostream>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -278,9 +280,46 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
             parser->DefineVar("x_" + postfix, d_parser_posn.data() + d);
         }
     }
+
+    // Determine which functions depend on time.  If this cannot be determined
+    // (e.g., because the function is not valid), the function is assumed to be
+    // time-dependent so that errors are reported when it is evaluated.
+    if (input_db->keyExists("cache_time_independent_values"))
+        d_cache_time_independent_values = input_db->getBool("cache_time_independent_values");
+    for (unsigned int k = 0; k < all_parsers.size(); ++k)
+    {
+        bool time_dependent = true;
+        try
+        {
+            const mu::varmap_type& used_vars = all_parsers[k]->GetUsedVar();
+            time_dependent = used_vars.count("t") > 0 || used_vars.count("T") > 0;
+        }
+        catch (...)
+        {
+            time_dependent = true;
+        }
+        d_time_dependent[k] = time_dependent;
+    }
+
+    // Optionally compile the coefficient functions into native code.
+    if (input_db->keyExists("use_compiled_expressions") && input_db->getBool("use_compiled_expressions"))
+    {
+        d_compiler.reset(new muParserExpressionCompiler(
+            object_name,
+            std::vector<const mu::Parser*>(all_parsers.begin(), all_parsers.end()),
+            &d_parser_time,
+            d_parser_posn.data(),
+            input_db));
+    }
     return;
 } // muParserRobinBcCoefs
 
+bool
+muParserRobinBcCoefs::isTimeDependent() const
+{
+    return std::find(d_time_dependent.begin(), d_time_dependent.end(), true) != d_time_dependent.end();
+} // isTimeDependent
+
 void
 muParserRobinBcCoefs::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
                                  Pointer<ArrayData<NDIM, double> >& bcoef_data,
@@ -309,40 +348,79 @@ muParserRobinBcCoefs::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
     TBOX_ASSERT(!gcoef_data || bc_coef_box == gcoef_data->getBox());
 #endif
 
-    const mu::Parser& acoef_parser = d_acoef_parsers[location_index];
-    const mu::Parser& bcoef_parser = d_bcoef_parsers[location_index];
-    const mu::Parser& gcoef_parser = d_gcoef_parsers[location_index];
+    const std::array<ArrayData<NDIM, double>*, 3> coef_data = {
+        { acoef_data.getPointer(), bcoef_data.getPointer(), gcoef_data.getPointer() }
+    };
+    const std::array<const mu::Parser*, 3> coef_parsers = {
+        { &d_acoef_parsers[location_index], &d_bcoef_parsers[location_index], &d_gcoef_parsers[location_index] }
+    };
+    std::array<double, NDIM> patch_dx;
+    std::copy(dx, dx + NDIM, patch_dx.begin());
     d_parser_time = fill_time;
-    for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
+    std::vector<double> scratch_values;
+    for (int c = 0; c < 3; ++c)
     {
-        const hier::Index<NDIM>& i = b();
-        for (unsigned int d = 0; d < NDIM; ++d)
+        if (!coef_data[c]) continue;
+
+        // Values of time-independent functions are computed only the first
+        // time that they are requested on each boundary box.
+        std::vector<double>* values = &scratch_values;
+        bool compute_values = true;
+        if (d_cache_time_independent_values && !d_time_dependent[3 * location_index + c])
+        {
+            BoundaryValues& bdry_values = d_cached_values[std::make_tuple(
+                patch.getPatchLevelNumber(), patch.getPatchNumber(), static_cast<int>(location_index), c)];
+            compute_values = !(bdry_values.coef_box == bc_coef_box) || !(bdry_values.patch_box == patch_box) ||
+                             bdry_values.dx != patch_dx;
+            bdry_values.coef_box = bc_coef_box;
+            bdry_values.patch_box = patch_box;
+            bdry_values.dx = patch_dx;
+            values = &bdry_values.values;
+        }
+
+        if (compute_values)
         {
-            if (d != bdry_normal_axis)
+            values->resize(bc_coef_box.size());
+            const mu::Parser& parser = *coef_parsers[c];
+            const muParserExpressionCompiler::FunctionPtr fcn =
+                d_compiler ? d_compiler->getFunction(3 * location_index + c) : nullptr;
+            try
             {
-                d_parser_posn[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                std::size_t k = 0;
+                for (Box<NDIM>::Iterator b(bc_coef_box); b; b++, ++k)
+                {
+                    const hier::Index<NDIM>& i = b();
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        if (d != bdry_normal_axis)
+                        {
+                            d_parser_posn[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                        }
+                        else
+                        {
+                            d_parser_posn[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                        }
+                    }
+                    (*values)[k] = fcn ? fcn(d_parser_posn.data(), d_parser_time) : parser.Eval();
+                }
             }
-            else
+            catch (mu::ParserError& e)
             {
-                d_parser_posn[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
+                           << "  error: " << e.GetMsg() << "\n"
+                           << "  in:    " << e.GetExpr() << "\n");
+            }
+            catch (...)
+            {
+                TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
+                           << "  unrecognized exception generated by muParser library.\n");
             }
         }
-        try
-        {
-            if (acoef_data) (*acoef_data)(i, 0) = acoef_parser.Eval();
-            if (bcoef_data) (*bcoef_data)(i, 0) = bcoef_parser.Eval();
-            if (gcoef_data) (*gcoef_data)(i, 0) = gcoef_parser.Eval();
-        }
-        catch (mu::ParserError& e)
-        {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
-                       << "  error: " << e.GetMsg() << "\n"
-                       << "  in:    " << e.GetExpr() << "\n");
-        }
-        catch (...)
+
+        std::size_t k = 0;
+        for (Box<NDIM>::Iterator b(bc_coef_box); b; b++, ++k)
         {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
-                       << "  unrecognized exception generated by muParser library.\n");
+            (*coef_data[c])(b(), 0) = (*values)[k];
         }
     }
     return;
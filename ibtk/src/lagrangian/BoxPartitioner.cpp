@@ -21,6 +21,7 @@
 #include <tbox/PIO.h>
 #include <tbox/SAMRAI_MPI.h>
 
+#include "libmesh/enum_elem_type.h"
 #include "libmesh/id_types.h"
 #include "libmesh/libmesh_config.h"
 #include "libmesh/partitioner.h"
@@ -32,12 +33,21 @@
 #include <libmesh/node.h>
 #include <libmesh/numeric_vector.h>
 #include <libmesh/point.h>
+#include <libmesh/quadrature.h>
 
 #include <mpi.h>
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <cstdio>
+#include <limits>
+#include <map>
+#include <numeric>
 #include <sstream>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -45,6 +55,71 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+MPI_Datatype
+get_processor_id_mpi_type()
+{
+    switch (sizeof(processor_id_type))
+    {
+    case 1:
+        return MPI_UNSIGNED_CHAR;
+    case 2:
+        return MPI_UNSIGNED_SHORT;
+    case 4:
+        return MPI_UNSIGNED;
+    case 8:
+        return MPI_UNSIGNED_LONG;
+    }
+    return 0;
+}
+
+// Determine the current location of the nodes of @p mesh, which are either
+// the nodes themselves or, if @p position_system is provided, the values of
+// that system at the nodes.
+std::vector<libMesh::Point>
+get_node_positions(const MeshBase& mesh, const System* const position_system)
+{
+    const bool use_position_vector = position_system != nullptr;
+    const unsigned int position_system_n = use_position_vector ? position_system->number() : 0;
+    std::vector<double> position;
+    if (use_position_vector)
+    {
+        TBOX_ASSERT(&position_system->get_mesh() == &mesh);
+        NumericVector<double>* position_solution = position_system->solution.get();
+        position.resize(position_solution->size());
+        position_solution->localize(position);
+    }
+    std::vector<libMesh::Point> node_positions(mesh.parallel_n_nodes());
+    std::size_t node_n = 0;
+    for (auto node_it = mesh.nodes_begin(); node_it != mesh.nodes_end(); ++node_it)
+    {
+        const Node* const node = *node_it;
+        TBOX_ASSERT(node->id() == node_n);
+        libMesh::Point node_position;
+        if (use_position_vector)
+        {
+            if (node->n_vars(position_system_n))
+            {
+                TBOX_ASSERT(node->n_vars(position_system_n) == NDIM);
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    node_position(d) = position[node->dof_number(position_system_n, d, 0)];
+                }
+            }
+        }
+        else
+        {
+            node_position = *node;
+        }
+        node_positions[node_n] = node_position;
+        ++node_n;
+    }
+    TBOX_ASSERT(node_n == node_positions.size());
+    return node_positions;
+}
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 BoxPartitioner::BoxPartitioner(const PartitioningBoxes& bounding_boxes) : d_partitioning_boxes(bounding_boxes)
@@ -146,22 +221,7 @@ BoxPartitioner::_do_partition(MeshBase& mesh, const unsigned int n)
     TBOX_ASSERT(n == static_cast<unsigned int>(SAMRAI_MPI::getNodes()));
 
     // convert the libMesh type to an MPI type
-    MPI_Datatype pid_integral_type = 0;
-    switch (sizeof(processor_id_type))
-    {
-    case 1:
-        pid_integral_type = MPI_UNSIGNED_CHAR;
-        break;
-    case 2:
-        pid_integral_type = MPI_UNSIGNED_SHORT;
-        break;
-    case 4:
-        pid_integral_type = MPI_UNSIGNED;
-        break;
-    case 8:
-        pid_integral_type = MPI_UNSIGNED_LONG;
-        break;
-    }
+    const MPI_Datatype pid_integral_type = get_processor_id_mpi_type();
 
     const int current_rank = SAMRAI_MPI::getRank();
     auto to_ibtk_point = [](const libMesh::Point& p) -> IBTK::Point {
@@ -176,42 +236,8 @@ BoxPartitioner::_do_partition(MeshBase& mesh, const unsigned int n)
     // particle-like fashion.
     //
     // Step 0: determine the current location of the Mesh nodes.
-    const bool use_position_vector = d_position_system != nullptr;
-    const unsigned int position_system_n = use_position_vector ? d_position_system->number() : 0;
-    std::vector<double> position;
-    if (use_position_vector)
-    {
-        TBOX_ASSERT(&d_position_system->get_mesh() == &mesh);
-        NumericVector<double>* position_solution = d_position_system->solution.get();
-        position.resize(position_solution->size());
-        position_solution->localize(position);
-    }
-    std::vector<libMesh::Point> node_positions(mesh.parallel_n_nodes());
+    const std::vector<libMesh::Point> node_positions = get_node_positions(mesh, d_position_system);
     std::size_t node_n = 0;
-    for (auto node_it = mesh.nodes_begin(); node_it != mesh.nodes_end(); ++node_it)
-    {
-        const Node* const node = *node_it;
-        TBOX_ASSERT(node->id() == node_n);
-        libMesh::Point node_position;
-        if (use_position_vector)
-        {
-            if (node->n_vars(position_system_n))
-            {
-                TBOX_ASSERT(node->n_vars(position_system_n) == NDIM);
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    node_position(d) = position[node->dof_number(position_system_n, d, 0)];
-                }
-            }
-        }
-        else
-        {
-            node_position = *node;
-        }
-        node_positions[node_n] = node_position;
-        ++node_n;
-    }
-    TBOX_ASSERT(node_n == node_positions.size());
 
     // Step 1: determine which elements belong to which processor and
     // communicate the partitioning information across the network.
@@ -321,6 +347,209 @@ BoxPartitioner::_do_partition(MeshBase& mesh, const unsigned int n)
     }
 } // _do_partition
 
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+SpaceFillingCurvePartitioner::SpaceFillingCurvePartitioner(const PartitioningBoxes& partitioning_boxes,
+                                                           const System& position_system)
+    : d_partitioning_boxes(partitioning_boxes), d_position_system(&position_system)
+{
+} // SpaceFillingCurvePartitioner
+
+void
+SpaceFillingCurvePartitioner::setQuadratureWeights(const QuadratureType quad_type, const Order quad_order)
+{
+    d_use_quadrature_weights = true;
+    d_quad_type = quad_type;
+    d_quad_order = quad_order;
+    return;
+} // setQuadratureWeights
+
+std::unique_ptr<Partitioner>
+SpaceFillingCurvePartitioner::clone() const
+{
+    auto partitioner = new SpaceFillingCurvePartitioner(d_partitioning_boxes, *d_position_system);
+    partitioner->d_use_quadrature_weights = d_use_quadrature_weights;
+    partitioner->d_quad_type = d_quad_type;
+    partitioner->d_quad_order = d_quad_order;
+    return std::unique_ptr<Partitioner>(partitioner);
+} // clone
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+void
+SpaceFillingCurvePartitioner::_do_partition(MeshBase& mesh, const unsigned int n)
+{
+    // We assume every cell is on every processor: this function is only in
+    // libMesh 1.2.0 and newer
+#if 1 < LIBMESH_MINOR_VERSION
+    TBOX_ASSERT(mesh.is_replicated());
+#endif
+    // only implemented when we use SAMRAI's partitioning
+    TBOX_ASSERT(n == static_cast<unsigned int>(SAMRAI_MPI::getNodes()));
+    const int current_rank = SAMRAI_MPI::getRank();
+    auto to_ibtk_point = [](const libMesh::Point& p) -> IBTK::Point {
+        IBTK::Point point;
+        for (unsigned int d = 0; d < NDIM; ++d) point[d] = p(d);
+        return point;
+    };
+
+    // Step 1: compute the centroids and the weights of the active elements.
+    // Every processor does this for every element so no communication is
+    // necessary to sort them.
+    const std::vector<libMesh::Point> node_positions = get_node_positions(mesh, d_position_system);
+    std::vector<Elem*> elems;
+    std::vector<IBTK::Point> centroids;
+    std::vector<double> weights;
+    std::map<std::pair<ElemType, unsigned int>, unsigned int> n_q_points;
+    IBTK::Point x_lower = IBTK::Point::Constant(std::numeric_limits<double>::max());
+    IBTK::Point x_upper = IBTK::Point::Constant(std::numeric_limits<double>::lowest());
+    const auto end_elem = mesh.active_elements_end();
+    for (auto elem_it = mesh.active_elements_begin(); elem_it != end_elem; ++elem_it)
+    {
+        Elem* const elem = *elem_it;
+        libMesh::Point centroid;
+        const unsigned int n_nodes = elem->n_nodes();
+        for (unsigned int node_n = 0; node_n < n_nodes; ++node_n)
+        {
+            centroid += node_positions[elem->node_id(node_n)];
+        }
+        centroid *= 1.0 / n_nodes;
+        const IBTK::Point X = to_ibtk_point(centroid);
+        x_lower = x_lower.cwiseMin(X);
+        x_upper = x_upper.cwiseMax(X);
+
+        double weight = 1.0;
+        if (d_use_quadrature_weights)
+        {
+            const auto key = std::make_pair(elem->type(), elem->p_level());
+            if (n_q_points.count(key) == 0)
+            {
+                std::unique_ptr<QBase> qrule = QBase::build(d_quad_type, elem->dim(), d_quad_order);
+                qrule->init(elem->type(), elem->p_level());
+                n_q_points[key] = qrule->n_points();
+            }
+            weight = n_q_points[key];
+        }
+
+        elems.push_back(elem);
+        centroids.push_back(X);
+        weights.push_back(weight);
+    }
+    const std::size_t n_elems = elems.size();
+    if (n_elems == 0) return;
+
+    // Step 2: sort the elements along a Hilbert curve which covers the
+    // bounding box of the centroids.
+    const double max_coord = static_cast<double>((std::uint64_t(1) << s_hilbert_curve_bits) - 1);
+    std::vector<std::pair<std::uint64_t, std::size_t> > curve_indices(n_elems);
+    for (std::size_t e = 0; e < n_elems; ++e)
+    {
+        std::array<std::uint64_t, NDIM> x;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const double width = x_upper[d] - x_lower[d];
+            const double s = width > 0.0 ? (centroids[e][d] - x_lower[d]) / width : 0.0;
+            x[d] = static_cast<std::uint64_t>(std::max(0.0, std::min(s, 1.0)) * max_coord);
+        }
+        curve_indices[e] = std::make_pair(hilbert_curve_index(x), e);
+    }
+    std::sort(curve_indices.begin(), curve_indices.end());
+
+    // Step 3: cut the curve into n pieces of (approximately) equal weight.
+    const double total_weight = std::accumulate(weights.begin(), weights.end(), 0.0);
+    std::vector<unsigned int> elem_pieces(n_elems);
+    double cumulative_weight = 0.0;
+    for (const auto& curve_index : curve_indices)
+    {
+        const std::size_t e = curve_index.second;
+        const double midpoint = (cumulative_weight + 0.5 * weights[e]) / total_weight;
+        elem_pieces[e] = std::min(n - 1, static_cast<unsigned int>(midpoint * n));
+        cumulative_weight += weights[e];
+    }
+
+    // Step 4: assign pieces to processors. Each processor computes the weight
+    // of each piece that lies inside its partitioning boxes and, after
+    // exchanging that information, the pieces are greedily matched with the
+    // processors with which they overlap the most. A processor's boxes
+    // typically overlap only a few pieces, so only the nonzero overlaps are
+    // exchanged, as (piece, weight) pairs.
+    std::map<unsigned int, double> local_overlap;
+    for (std::size_t e = 0; e < n_elems; ++e)
+    {
+        if (d_partitioning_boxes.contains(centroids[e]))
+        {
+            local_overlap[elem_pieces[e]] += weights[e];
+        }
+    }
+    std::vector<double> local_data;
+    local_data.reserve(2 * local_overlap.size());
+    for (const auto& piece_overlap : local_overlap)
+    {
+        local_data.push_back(static_cast<double>(piece_overlap.first));
+        local_data.push_back(piece_overlap.second);
+    }
+    std::vector<int> data_sizes(n), data_offsets(n + 1, 0);
+    int local_data_size = static_cast<int>(local_data.size());
+    int ierr = MPI_Allgather(&local_data_size, 1, MPI_INT, data_sizes.data(), 1, MPI_INT, SAMRAI_MPI::commWorld);
+    TBOX_ASSERT(ierr == 0);
+    std::partial_sum(data_sizes.begin(), data_sizes.end(), data_offsets.begin() + 1);
+    std::vector<double> data(data_offsets[n]);
+    ierr = MPI_Allgatherv(local_data.data(),
+                          local_data_size,
+                          MPI_DOUBLE,
+                          data.data(),
+                          data_sizes.data(),
+                          data_offsets.data(),
+                          MPI_DOUBLE,
+                          SAMRAI_MPI::commWorld);
+    TBOX_ASSERT(ierr == 0);
+
+    std::vector<std::tuple<double, unsigned int, unsigned int> > candidates;
+    candidates.reserve(data.size() / 2);
+    for (unsigned int rank = 0; rank < n; ++rank)
+    {
+        for (int k = data_offsets[rank]; k < data_offsets[rank + 1]; k += 2)
+        {
+            const auto piece = static_cast<unsigned int>(data[k]);
+            const double overlap = data[k + 1];
+            if (overlap > 0.0)
+            {
+                // Negate the overlap so that the largest one comes first.
+                candidates.emplace_back(-overlap, rank, piece);
+            }
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    const processor_id_type invalid_pid = std::numeric_limits<processor_id_type>::max();
+    std::vector<processor_id_type> piece_ranks(n, invalid_pid);
+    std::vector<bool> rank_assigned(n, false);
+    for (const auto& candidate : candidates)
+    {
+        const unsigned int rank = std::get<1>(candidate);
+        const unsigned int piece = std::get<2>(candidate);
+        if (rank_assigned[rank] || piece_ranks[piece] != invalid_pid) continue;
+        piece_ranks[piece] = rank;
+        rank_assigned[rank] = true;
+    }
+    // Pieces which do not overlap any remaining processor are assigned in
+    // order to the remaining processors.
+    unsigned int next_rank = 0;
+    for (unsigned int piece = 0; piece < n; ++piece)
+    {
+        if (piece_ranks[piece] != invalid_pid) continue;
+        while (rank_assigned[next_rank]) ++next_rank;
+        piece_ranks[piece] = next_rank;
+        rank_assigned[next_rank] = true;
+    }
+
+    // Step 5: label all elements with the correct processor id. Node
+    // processor ids are subsequently set by libMesh.
+    for (std::size_t e = 0; e < n_elems; ++e)
+    {
+        elems[e]->processor_id() = piece_ranks[elem_pieces[e]];
+    }
+} // _do_partition
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -14,12 +14,16 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibtk/FEDataInterpolation.h"
+#include "ibtk/FEValues.h"
 #include "ibtk/libmesh_utilities.h"
 #include "ibtk/namespaces.h"
 
 #include "libmesh/compare_types.h"
 #include "libmesh/dof_map.h"
+#include "libmesh/elem.h"
+#include "libmesh/enum_elem_type.h"
 #include "libmesh/equation_systems.h"
+#include "libmesh/mesh_base.h"
 #include "libmesh/quadrature.h"
 #include "libmesh/system.h"
 #include "libmesh/type_vector.h"
@@ -46,6 +50,22 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Determine whether IBTK::FEValues may be used in place of libMesh::FEBase to compute the interior element data of
+// the given FEType on all of the given element types.
+bool
+use_ibtk_fe_values(const FEType& fe_type, const std::set<ElemType>& elem_types)
+{
+    if (elem_types.empty()) return false;
+    for (const ElemType elem_type : elem_types)
+    {
+        if (!FEValuesBase::isIsoparametricLagrange(fe_type, elem_type)) return false;
+    }
+    return true;
+} // use_ibtk_fe_values
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 FEDataInterpolation::FEDataInterpolation(const unsigned int dim, std::shared_ptr<FEData> fe_data)
@@ -288,6 +308,47 @@ FEDataInterpolation::init()
         }
     }
 
+    // If the FEData object stores reference configuration quadrature data, then all element data are computed once
+    // per element and are subsequently read directly from the cache.
+    if (d_qrule && num_fe_types > 0)
+    {
+        d_reference_quadrature_cache =
+            d_fe_data->getReferenceQuadratureCache(d_qrule->type(), d_qrule->get_order(), d_fe_types);
+    }
+
+    // Collect the types of the local elements to determine which FETypes can use IBTK::FEValues, which avoids the
+    // virtual dispatch and dynamic allocation of libMesh::FEBase::reinit(), for the interior element data.  We only
+    // do this for isoparametric Lagrange FETypes on meshes whose dimension equals the spatial dimension.
+    std::set<ElemType> elem_types;
+    const EquationSystems* const equation_systems = d_fe_data->getEquationSystems();
+    if (d_qrule && d_dim == NDIM && equation_systems)
+    {
+        const MeshBase& mesh = equation_systems->get_mesh();
+        const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
+        const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
+        for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+        {
+            const Elem* const elem = *el_it;
+            if (elem->p_level() != 0)
+            {
+                elem_types.clear();
+                break;
+            }
+            elem_types.insert(elem->type());
+        }
+    }
+    d_ibtk_fe.resize(num_fe_types);
+    for (unsigned int fe_type_idx = 0; fe_type_idx < num_fe_types; ++fe_type_idx)
+    {
+        if (!use_ibtk_fe_values(d_fe_types[fe_type_idx], elem_types)) continue;
+        FEUpdateFlags update_flags = update_default;
+        if (d_eval_phi[fe_type_idx] || d_reference_quadrature_cache) update_flags |= update_phi;
+        if (d_eval_dphi[fe_type_idx] || d_reference_quadrature_cache) update_flags |= update_dphi;
+        if (d_eval_JxW || d_reference_quadrature_cache) update_flags |= update_JxW;
+        if (d_eval_q_point || d_reference_quadrature_cache) update_flags |= update_quadrature_points;
+        d_ibtk_fe[fe_type_idx] = FEValuesBase::build(d_dim, NDIM, d_qrule, update_flags);
+    }
+
     // Set up FE objects and request access to shape functions / gradients, as needed.
     d_fe.resize(num_fe_types);
     d_fe_face.resize(num_fe_types);
@@ -303,10 +364,20 @@ FEDataInterpolation::init()
             const FEType& fe_type = d_fe_types[fe_type_idx];
             fe = FEBase::build(d_dim, fe_type);
             if (d_qrule) fe->attach_quadrature_rule(d_qrule);
-            if (d_eval_q_point && !d_q_point) d_q_point = &fe->get_xyz();
-            if (d_eval_JxW && !d_JxW) d_JxW = &fe->get_JxW();
-            if (d_eval_phi[fe_type_idx]) d_phi[fe_type_idx] = &fe->get_phi();
-            if (d_eval_dphi[fe_type_idx]) d_dphi[fe_type_idx] = &fe->get_dphi();
+            if (const FEValuesBase* const ibtk_fe = d_ibtk_fe[fe_type_idx].get())
+            {
+                if (d_eval_q_point && !d_q_point) d_q_point = &ibtk_fe->getQuadraturePoints();
+                if (d_eval_JxW && !d_JxW) d_JxW = &ibtk_fe->getJxW();
+                if (d_eval_phi[fe_type_idx]) d_phi[fe_type_idx] = &ibtk_fe->getShapeValues();
+                if (d_eval_dphi[fe_type_idx]) d_dphi[fe_type_idx] = &ibtk_fe->getShapeGradients();
+            }
+            else
+            {
+                if (d_eval_q_point && !d_q_point) d_q_point = &fe->get_xyz();
+                if (d_eval_JxW && !d_JxW) d_JxW = &fe->get_JxW();
+                if (d_eval_phi[fe_type_idx]) d_phi[fe_type_idx] = &fe->get_phi();
+                if (d_eval_dphi[fe_type_idx]) d_dphi[fe_type_idx] = &fe->get_dphi();
+            }
         }
 
         std::unique_ptr<FEBase>& fe_face = d_fe_face[fe_type_idx];
@@ -323,6 +394,32 @@ FEDataInterpolation::init()
         }
     }
 
+    // Set up access to the element data that are stored in the reference configuration quadrature cache.
+    if (d_reference_quadrature_cache)
+    {
+        const FEValuesBase* const ibtk_fe = d_ibtk_fe[0].get();
+        d_fe_q_point = ibtk_fe ? &ibtk_fe->getQuadraturePoints() : &d_fe[0]->get_xyz();
+        d_fe_JxW = ibtk_fe ? &ibtk_fe->getJxW() : &d_fe[0]->get_JxW();
+        d_fe_phi.resize(num_fe_types, nullptr);
+        d_fe_dphi.resize(num_fe_types, nullptr);
+        d_reference_elem_data.phi.resize(num_fe_types);
+        d_reference_elem_data.dphi.resize(num_fe_types);
+        for (unsigned int fe_type_idx = 0; fe_type_idx < num_fe_types; ++fe_type_idx)
+        {
+            if (d_ibtk_fe[fe_type_idx])
+            {
+                d_fe_phi[fe_type_idx] = &d_ibtk_fe[fe_type_idx]->getShapeValues();
+                d_fe_dphi[fe_type_idx] = &d_ibtk_fe[fe_type_idx]->getShapeGradients();
+            }
+            else
+            {
+                d_fe_phi[fe_type_idx] = &d_fe[fe_type_idx]->get_phi();
+                d_fe_dphi[fe_type_idx] = &d_fe[fe_type_idx]->get_dphi();
+            }
+        }
+        setReferenceElemDataPointers(d_reference_elem_data);
+    }
+
     // Indicate that we have initialized the class.
     d_initialized = true;
     return;
@@ -335,12 +432,53 @@ FEDataInterpolation::reinit(const Elem* elem,
 {
     TBOX_ASSERT(d_initialized);
     d_current_elem = elem;
-    if (d_qrule || points)
+    d_ibtk_fe_reinitialized = false;
+    if (d_reference_quadrature_cache && !points && !weights)
     {
+        auto elem_data_it = d_reference_quadrature_cache->find(elem->id());
+        if (elem_data_it == d_reference_quadrature_cache->end())
+        {
+            reinitInterior(elem);
+            elem_data_it =
+                d_reference_quadrature_cache->emplace(elem->id(), FEData::ReferenceElemQuadratureData()).first;
+            collectReferenceElemData(elem_data_it->second);
+        }
+        setReferenceElemDataPointers(elem_data_it->second);
+
+        // Keep the quadrature rule consistent with the element even though we did not reinitialize the FE objects.
+        if (d_qrule->get_elem_type() != elem->type() || d_qrule->get_p_level() != elem->p_level())
+        {
+            d_qrule->init(elem->type(), elem->p_level());
+        }
+    }
+    else if (points)
+    {
+        if (std::any_of(d_ibtk_fe.begin(), d_ibtk_fe.end(), [](const std::unique_ptr<FEValuesBase>& ibtk_fe) {
+                return static_cast<bool>(ibtk_fe);
+            }))
+        {
+            TBOX_ERROR("FEDataInterpolation::reinit():\n"
+                       << "  element data cannot be evaluated at arbitrary points when a quadrature rule has been\n"
+                       << "  attached and the IBTK::FEValues objects are used for the interior element data\n");
+        }
         for (const auto& fe : d_fe)
         {
             fe->reinit(elem, points, weights);
         }
+        if (d_reference_quadrature_cache)
+        {
+            collectReferenceElemData(d_reference_elem_data);
+            setReferenceElemDataPointers(d_reference_elem_data);
+        }
+    }
+    else if (d_qrule)
+    {
+        reinitInterior(elem);
+        if (d_reference_quadrature_cache)
+        {
+            collectReferenceElemData(d_reference_elem_data);
+            setReferenceElemDataPointers(d_reference_elem_data);
+        }
     }
     d_n_qp = static_cast<unsigned int>(points ? points->size() : d_qrule ? d_qrule->n_points() : 0);
     return;
@@ -356,6 +494,7 @@ FEDataInterpolation::reinit(const Elem* const elem,
     TBOX_ASSERT(d_initialized);
     d_current_elem = elem;
     d_current_side = side;
+    d_ibtk_fe_reinitialized = false;
     if (d_qrule_face || points)
     {
         for (const auto& fe_face : d_fe_face)
@@ -402,7 +541,7 @@ FEDataInterpolation::interpolate(const Elem* const elem)
 {
     TBOX_ASSERT(d_initialized);
     TBOX_ASSERT(elem == d_current_elem);
-    interpolateCommon(d_system_var_data, d_system_grad_var_data, d_phi, d_dphi);
+    interpolateCommon(d_system_var_data, d_system_grad_var_data, d_phi, d_dphi, d_ibtk_fe_reinitialized);
     return;
 }
 
@@ -412,7 +551,7 @@ FEDataInterpolation::interpolate(const Elem* const elem, const unsigned int side
     TBOX_ASSERT(d_initialized);
     TBOX_ASSERT(elem == d_current_elem);
     TBOX_ASSERT(side == d_current_side);
-    interpolateCommon(d_system_var_data, d_system_grad_var_data, d_phi_face, d_dphi_face);
+    interpolateCommon(d_system_var_data, d_system_grad_var_data, d_phi_face, d_dphi_face, false);
     return;
 }
 
@@ -424,12 +563,65 @@ FEDataInterpolation::getFETypeIndex(const FEType& fe_type) const
     return std::distance(d_fe_types.begin(), std::find(d_fe_types.begin(), d_fe_types.end(), fe_type));
 }
 
+void
+FEDataInterpolation::reinitInterior(const Elem* const elem)
+{
+    const size_t num_fe_types = d_fe_types.size();
+    for (size_t fe_type_idx = 0; fe_type_idx < num_fe_types; ++fe_type_idx)
+    {
+        if (d_ibtk_fe[fe_type_idx])
+        {
+            d_ibtk_fe[fe_type_idx]->reinit(elem);
+        }
+        else
+        {
+            d_fe[fe_type_idx]->reinit(elem);
+        }
+    }
+    d_ibtk_fe_reinitialized = true;
+    return;
+}
+
+void
+FEDataInterpolation::collectReferenceElemData(FEData::ReferenceElemQuadratureData& elem_data) const
+{
+    const size_t num_fe_types = d_fe_types.size();
+    elem_data.q_point = *d_fe_q_point;
+    elem_data.JxW = *d_fe_JxW;
+    elem_data.phi.resize(num_fe_types);
+    elem_data.dphi.resize(num_fe_types);
+    for (size_t fe_type_idx = 0; fe_type_idx < num_fe_types; ++fe_type_idx)
+    {
+        // Always store both the shape functions and their gradients since the same cache may be shared by objects
+        // that evaluate different quantities.
+        elem_data.phi[fe_type_idx] = *d_fe_phi[fe_type_idx];
+        elem_data.dphi[fe_type_idx] = *d_fe_dphi[fe_type_idx];
+    }
+    return;
+}
+
+void
+FEDataInterpolation::setReferenceElemDataPointers(const FEData::ReferenceElemQuadratureData& elem_data)
+{
+    // The cache does not invalidate references to its entries, so it is safe to point directly into them.
+    const size_t num_fe_types = d_fe_types.size();
+    for (size_t fe_type_idx = 0; fe_type_idx < num_fe_types; ++fe_type_idx)
+    {
+        if (d_eval_phi[fe_type_idx]) d_phi[fe_type_idx] = &elem_data.phi[fe_type_idx];
+        if (d_eval_dphi[fe_type_idx]) d_dphi[fe_type_idx] = &elem_data.dphi[fe_type_idx];
+    }
+    if (d_eval_q_point) d_q_point = &elem_data.q_point;
+    if (d_eval_JxW) d_JxW = &elem_data.JxW;
+    return;
+}
+
 void
 FEDataInterpolation::interpolateCommon(
     std::vector<std::vector<std::vector<double> > >& system_var_data,
     std::vector<std::vector<std::vector<VectorValue<double> > > >& system_grad_var_data,
     const std::vector<const std::vector<std::vector<double> >*>& phi_data,
-    const std::vector<const std::vector<std::vector<VectorValue<double> > >*>& dphi_data)
+    const std::vector<const std::vector<std::vector<VectorValue<double> > >*>& dphi_data,
+    const bool use_tensor_product)
 {
     // Determine the number of quadrature points where the interpolation will be evaluated.
     const unsigned int n_qp = d_n_qp;
@@ -455,6 +647,17 @@ FEDataInterpolation::interpolateCommon(
             {
                 const size_t var_idx = var_idxs[k];
                 const size_t fe_type_idx = var_fe_type_idxs[k];
+                FEValuesBase* const ibtk_fe = use_tensor_product ? d_ibtk_fe[fe_type_idx].get() : nullptr;
+                if (ibtk_fe && ibtk_fe->hasTensorProductStructure())
+                {
+                    ibtk_fe->interpolateTensorProduct(
+                        elem_data, static_cast<unsigned int>(var_idx), &d_tensor_product_values, nullptr);
+                    for (unsigned int qp = 0; qp < n_qp; ++qp)
+                    {
+                        system_var_data[qp][system_idx][k] = d_tensor_product_values[qp];
+                    }
+                    continue;
+                }
                 const std::vector<std::vector<double> >& phi = *phi_data[fe_type_idx];
                 for (unsigned int qp = 0; qp < n_qp; ++qp)
                 {
@@ -480,6 +683,17 @@ FEDataInterpolation::interpolateCommon(
             {
                 const size_t var_idx = grad_var_idxs[k];
                 const size_t fe_type_idx = grad_var_fe_type_idxs[k];
+                FEValuesBase* const ibtk_fe = use_tensor_product ? d_ibtk_fe[fe_type_idx].get() : nullptr;
+                if (ibtk_fe && ibtk_fe->hasTensorProductStructure())
+                {
+                    ibtk_fe->interpolateTensorProduct(
+                        elem_data, static_cast<unsigned int>(var_idx), nullptr, &d_tensor_product_gradients);
+                    for (unsigned int qp = 0; qp < n_qp; ++qp)
+                    {
+                        system_grad_var_data[qp][system_idx][k] = d_tensor_product_gradients[qp];
+                    }
+                    continue;
+                }
                 const std::vector<std::vector<VectorValue<double> > >& dphi = *dphi_data[fe_type_idx];
                 for (unsigned int qp = 0; qp < n_qp; ++qp)
                 {
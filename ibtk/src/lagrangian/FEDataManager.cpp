@@ -23,6 +23,8 @@
 #include "ibtk/JacobianCalculator.h"
 #include "ibtk/JacobianCalculatorCache.h"
 #include "ibtk/LEInteractor.h"
+#include "ibtk/MemoryMonitor.h"
+#include "ibtk/PerformanceMonitor.h"
 #include "ibtk/QuadratureCache.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/SAMRAIDataCache.h"
@@ -111,16 +113,24 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <iomanip>
 #include <limits>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <set>
 #include <string>
 #include <tuple>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 namespace libMesh
 {
 namespace Parallel
@@ -182,6 +192,87 @@ collect_unique_elems(std::vector<Elem*>& elems, const ContainerOfContainers& ele
     elems.assign(elem_set.begin(), elem_set.end());
     return;
 } // collect_unique_elems
+
+// The number of threads that will execute a (possibly) threaded element loop.
+inline int
+get_num_elem_loop_threads(const bool use_threads)
+{
+#if defined(_OPENMP)
+    return use_threads ? omp_get_max_threads() : 1;
+#else
+    (void)use_threads;
+    return 1;
+#endif
+} // get_num_elem_loop_threads
+
+// The index of the calling thread within a (possibly) threaded element loop.
+inline int
+get_elem_loop_thread_num()
+{
+#if defined(_OPENMP)
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+} // get_elem_loop_thread_num
+
+// The bounding box of a patch grown by the given number of cells.
+inline libMeshWrappers::BoundingBox
+get_patch_bounding_box(const Patch<NDIM>& patch, const IntVector<NDIM>& ghost_width)
+{
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    libMeshWrappers::BoundingBox patch_bbox;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        patch_bbox.first(d) = pgeom->getXLower()[d] - dx[d] * ghost_width(d);
+        patch_bbox.second(d) = pgeom->getXUpper()[d] + dx[d] * ghost_width(d);
+    }
+    for (unsigned int d = NDIM; d < LIBMESH_DIM; ++d)
+    {
+        patch_bbox.first(d) = 0.0;
+        patch_bbox.second(d) = 0.0;
+    }
+    return patch_bbox;
+} // get_patch_bounding_box
+
+inline bool
+bounding_boxes_intersect(const libMeshWrappers::BoundingBox& a, const libMeshWrappers::BoundingBox& b)
+{
+#if LIBMESH_VERSION_LESS_THAN(1, 2, 0)
+    return a.intersect(b);
+#else
+    return a.intersects(b);
+#endif
+} // bounding_boxes_intersect
+
+// The number of bytes used by the local (and, if present, ghost) entries of a
+// vector.
+inline std::size_t
+get_vector_memory(const NumericVector<double>& vec)
+{
+    if (!vec.initialized()) return 0;
+    const auto petsc_vec = dynamic_cast<const PetscVector<double>*>(&vec);
+    if (petsc_vec) return MemoryMonitor::getVecMemory(const_cast<PetscVector<double>*>(petsc_vec)->vec());
+    return vec.local_size() * sizeof(double);
+} // get_vector_memory
+
+// The number of bytes used by the reference configuration quadrature data
+// computed on a single element.
+inline std::size_t
+get_reference_quadrature_data_memory(const FEData::ReferenceElemQuadratureData& data)
+{
+    std::size_t bytes = data.q_point.size() * sizeof(libMesh::Point) + data.JxW.size() * sizeof(double);
+    for (const auto& fe_phi : data.phi)
+    {
+        for (const auto& phi : fe_phi) bytes += phi.size() * sizeof(double);
+    }
+    for (const auto& fe_dphi : data.dphi)
+    {
+        for (const auto& dphi : fe_dphi) bytes += dphi.size() * sizeof(VectorValue<double>);
+    }
+    return bytes;
+} // get_reference_quadrature_data_memory
 } // namespace
 
 FEData::FEData(std::string object_name, const bool register_for_restart)
@@ -199,6 +290,23 @@ FEData::FEData(std::string object_name, const bool register_for_restart)
     {
         FEData::getFromRestart();
     }
+
+    // Report the memory used by the cached data.
+    d_caches_memory_reporter_id = MemoryMonitor::registerReporter("FE caches", [this]() {
+        std::size_t bytes = 0;
+        for (const auto& system_dof_map_cache : d_system_dof_map_cache)
+        {
+            bytes += system_dof_map_cache.second->getMemoryUsage();
+        }
+        for (const auto& reference_quadrature_cache : d_reference_quadrature_caches)
+        {
+            for (const auto& elem_data : reference_quadrature_cache.second)
+            {
+                bytes += get_reference_quadrature_data_memory(elem_data.second);
+            }
+        }
+        return bytes;
+    });
 } // FEData
 
 FEData::~FEData()
@@ -207,6 +315,8 @@ FEData::~FEData()
     {
         RestartManager::getManager()->unregisterRestartItem(d_object_name);
     }
+    MemoryMonitor::unregisterReporter(d_system_vectors_memory_reporter_id);
+    MemoryMonitor::unregisterReporter(d_caches_memory_reporter_id);
 } // ~FEData
 
 void
@@ -243,6 +353,27 @@ FEData::setEquationSystems(EquationSystems* const equation_systems, const int le
     // Now that we have the EquationSystems object we know the dimensionality
     // of the mesh.
     d_quadrature_cache = QuadratureCache(d_es->get_mesh().mesh_dimension());
+
+    // Report the memory used by the system vectors.  Several FEData objects
+    // may share the same equation systems, so the reporter is keyed by them.
+    MemoryMonitor::unregisterReporter(d_system_vectors_memory_reporter_id);
+    d_system_vectors_memory_reporter_id = MemoryMonitor::registerReporter(
+        "libMesh system vectors",
+        [equation_systems]() {
+            std::size_t bytes = 0;
+            for (unsigned int system_num = 0; system_num < equation_systems->n_systems(); ++system_num)
+            {
+                const System& system = equation_systems->get_system(system_num);
+                bytes += get_vector_memory(*system.solution);
+                bytes += get_vector_memory(*system.current_local_solution);
+                for (auto it = system.vectors_begin(); it != system.vectors_end(); ++it)
+                {
+                    bytes += get_vector_memory(*it->second);
+                }
+            }
+            return bytes;
+        },
+        equation_systems);
     return;
 } // setEquationSystems
 
@@ -277,6 +408,36 @@ FEData::clearPatchHierarchyDependentData()
     d_quadrature_cache.clear();
 }
 
+void
+FEData::setUseReferenceQuadratureCache(const bool use_cache)
+{
+    d_use_reference_quadrature_cache = use_cache;
+    if (!d_use_reference_quadrature_cache) clearReferenceQuadratureCache();
+    return;
+} // setUseReferenceQuadratureCache
+
+bool
+FEData::getUseReferenceQuadratureCache() const
+{
+    return d_use_reference_quadrature_cache;
+} // getUseReferenceQuadratureCache
+
+FEData::ReferenceQuadratureCache*
+FEData::getReferenceQuadratureCache(const QuadratureType quad_type,
+                                    const Order quad_order,
+                                    const std::vector<FEType>& fe_types)
+{
+    if (!d_use_reference_quadrature_cache) return nullptr;
+    return &d_reference_quadrature_caches[std::make_tuple(quad_type, quad_order, fe_types)];
+} // getReferenceQuadratureCache
+
+void
+FEData::clearReferenceQuadratureCache()
+{
+    d_reference_quadrature_caches.clear();
+    return;
+} // clearReferenceQuadratureCache
+
 const boundary_id_type FEDataManager::ZERO_DISPLACEMENT_X_BDRY_ID = 0x100;
 const boundary_id_type FEDataManager::ZERO_DISPLACEMENT_Y_BDRY_ID = 0x200;
 const boundary_id_type FEDataManager::ZERO_DISPLACEMENT_Z_BDRY_ID = 0x400;
@@ -404,6 +565,51 @@ FEDataManager::getDofMapCache(unsigned int system_num)
     return d_fe_data->getDofMapCache(system_num);
 } // getDofMapCache
 
+void
+FEDataManager::setWorkloadSpec(const WorkloadSpec& workload_spec)
+{
+    d_default_workload_spec = workload_spec;
+    return;
+} // setWorkloadSpec
+
+const FEDataManager::WorkloadSpec&
+FEDataManager::getWorkloadSpec() const
+{
+    return d_default_workload_spec;
+} // getWorkloadSpec
+
+double
+FEDataManager::computeGlobalQuadPointCount()
+{
+    const int ln = d_fe_data->d_level_number;
+    updateQuadPointCountData(ln, ln);
+    HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(d_hierarchy, ln, ln);
+    return hier_cc_data_ops.L1Norm(d_qp_count_idx, IBTK::invalid_index, /*local_only*/ false);
+} // computeGlobalQuadPointCount
+
+double
+FEDataManager::computeNonLocalPatchElementFraction() const
+{
+    const processor_id_type current_rank = d_fe_data->d_es->get_mesh().processor_id();
+    std::array<unsigned long, 2> n_elems = { { 0, 0 } };
+    for (const std::vector<Elem*>& patch_elems : d_active_patch_elem_map)
+    {
+        for (const Elem* const elem : patch_elems)
+        {
+            if (elem->processor_id() != current_rank) ++n_elems[0];
+        }
+        n_elems[1] += patch_elems.size();
+    }
+    const int ierr = MPI_Allreduce(MPI_IN_PLACE,
+                                   n_elems.data(),
+                                   n_elems.size(),
+                                   MPI_UNSIGNED_LONG,
+                                   MPI_SUM,
+                                   SAMRAI::tbox::SAMRAI_MPI::commWorld);
+    TBOX_ASSERT(ierr == 0);
+    return n_elems[1] == 0 ? 0.0 : static_cast<double>(n_elems[0]) / static_cast<double>(n_elems[1]);
+} // computeNonLocalPatchElementFraction
+
 void
 FEDataManager::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > load_balancer, int workload_data_idx)
 {
@@ -489,6 +695,7 @@ FEDataManager::getActivePatchNodeMap() const
 void
 FEDataManager::reinitElementMappings()
 {
+    PerformanceMonitor::ScopedRegion region("FEDataManager::reinitElementMappings");
     IBTK_TIMER_START(t_reinit_element_mappings);
 
     // We reinitialize mappings after repartitioning, so clear the cache since
@@ -498,19 +705,50 @@ FEDataManager::reinitElementMappings()
     // The ghosted diagonal mass matrix needs to be rebuilt after repartitioning.
     d_L2_proj_matrix_diag_ghost.clear();
 
-    // Delete cached hierarchy-dependent data.
+    // Delete cached hierarchy-dependent data. The previous element mapping
+    // is kept if it will be used as the starting point for the new one.
+    std::vector<std::vector<Elem*> > prev_active_patch_elem_map;
+    if (d_use_incremental_element_mappings) prev_active_patch_elem_map.swap(d_active_patch_elem_map);
     d_active_patch_elem_map.clear();
     d_active_patch_node_map.clear();
     d_active_patch_ghost_dofs.clear();
     d_active_elem_bboxes.clear();
     d_active_elems.clear();
+    d_adaptive_quad_key_caches.clear();
     d_system_ghost_vec.clear();
     d_system_ib_ghost_vec.clear();
 
     // Reset the mappings between grid patches and active mesh
     // elements. collectActivePatchElements will populate d_active_elem_bboxes
-    // and use it.
-    collectActivePatchElements(d_active_patch_elem_map, d_fe_data->d_level_number);
+    // and use it. When restarting, the mapping may instead be restored from
+    // the restart file, which is only valid for the patch level that was
+    // read from that file.
+    bool restored_mapping = false;
+    if (d_restore_element_mappings_from_restart && d_restart_mapping_level_number != IBTK::invalid_level_number)
+    {
+        restored_mapping = restoreActivePatchElements(d_active_patch_elem_map, d_fe_data->d_level_number);
+        d_restart_mapping_level_number = IBTK::invalid_level_number;
+        d_restart_mapping_patch_boxes.clear();
+        d_restart_mapping_elem_ids.clear();
+    }
+    if (restored_mapping)
+    {
+        // There are no element bounding boxes to reuse, so the next
+        // incremental update has to start from scratch.
+        d_prev_mapping_level_number = IBTK::invalid_level_number;
+        d_prev_mapping_patch_boxes.clear();
+        d_prev_mapping_elem_ids.clear();
+        d_prev_mapping_elem_boxes.clear();
+    }
+    else if (d_use_incremental_element_mappings)
+    {
+        collectActivePatchElementsIncremental(
+            d_active_patch_elem_map, prev_active_patch_elem_map, d_fe_data->d_level_number);
+    }
+    else
+    {
+        collectActivePatchElements(d_active_patch_elem_map, d_fe_data->d_level_number);
+    }
     collectActivePatchNodes(d_active_patch_node_map, d_active_patch_elem_map);
     collect_unique_elems(d_active_elems, d_active_patch_elem_map);
 
@@ -518,6 +756,31 @@ FEDataManager::reinitElementMappings()
     return;
 } // reinitElementMappings
 
+void
+FEDataManager::setUseIncrementalElementMappings(const bool use_incremental)
+{
+    d_use_incremental_element_mappings = use_incremental;
+    d_prev_mapping_level_number = IBTK::invalid_level_number;
+    d_prev_mapping_patch_boxes.clear();
+    d_prev_mapping_elem_ids.clear();
+    d_prev_mapping_elem_boxes.clear();
+    return;
+} // setUseIncrementalElementMappings
+
+void
+FEDataManager::setRestoreElementMappingsFromRestart(const bool restore)
+{
+    d_restore_element_mappings_from_restart = restore;
+    return;
+} // setRestoreElementMappingsFromRestart
+
+void
+FEDataManager::setUseBoundingBoxTagging(const bool use_bounding_box_tagging)
+{
+    d_use_bounding_box_tagging = use_bounding_box_tagging;
+    return;
+} // setUseBoundingBoxTagging
+
 NumericVector<double>*
 FEDataManager::getSolutionVector(const std::string& system_name) const
 {
@@ -747,6 +1010,7 @@ FEDataManager::spread(const int f_data_idx,
                       const std::string& system_name,
                       const FEDataManager::SpreadSpec& spread_spec)
 {
+    PerformanceMonitor::ScopedRegion region("FEDataManager::spread");
     IBTK_TIMER_START(t_spread);
 
     // Determine the type of data centering.
@@ -793,7 +1057,6 @@ FEDataManager::spread(const int f_data_idx,
     using quad_key_type = std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>;
     FECache F_fe_cache(dim, F_fe_type, FEUpdateFlags::update_phi);
     FECache X_fe_cache(dim, X_fe_type, FEUpdateFlags::update_phi);
-    JacobianCalculatorCache jacobian_calculator_cache(mesh.spatial_dimension());
 
     // Check to see if we are using nodal quadrature.
     const bool use_nodal_quadrature = spread_spec.use_nodal_quadrature;
@@ -909,11 +1172,25 @@ FEDataManager::spread(const int f_data_idx,
         auto X_petsc_vec = static_cast<PetscVector<double>*>(&X_vec);
         const double* const X_local_soln = X_petsc_vec->get_array_read();
 
+        // When threading the element loops, each thread requires its own
+        // Jacobian calculators. The FE caches are shared, so the loops are not
+        // threaded if the caches reinitialize their FE objects on every element
+        // (e.g., for subdivision elements).
+        const bool use_threads = spread_spec.use_threaded_quadrature && !X_fe_cache.reinitializesOnEveryElement() &&
+                                 !F_fe_cache.reinitializesOnEveryElement();
+        std::vector<std::unique_ptr<JacobianCalculatorCache> > thread_jacobian_calculator_caches(
+            get_num_elem_loop_threads(use_threads));
+        for (auto& thread_jacobian_calculator_cache : thread_jacobian_calculator_caches)
+        {
+            thread_jacobian_calculator_cache.reset(new JacobianCalculatorCache(mesh.spatial_dimension()));
+        }
+
         // Loop over the patches to interpolate nodal values on the FE mesh to
         // the element quadrature points, then spread those values onto the
         // Eulerian grid.
-        boost::multi_array<double, 2> F_node;
         std::vector<double> F_JxW_qp, X_qp;
+        AdaptiveQuadratureKeyCache* quad_key_cache = nullptr;
+        double X_displacement = 0.0;
         int local_patch_num = 0;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
         {
@@ -927,6 +1204,16 @@ FEDataManager::spread(const int f_data_idx,
             const double* const patch_dx = patch_geom->getDx();
             const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
 
+            // Reuse the adaptive quadrature keys computed during previous
+            // calls unless the mesh has moved too far.
+            if (spread_spec.use_adaptive_quadrature && !quad_key_cache)
+            {
+                quad_key_cache = &d_adaptive_quad_key_caches[std::make_tuple(
+                    spread_spec.quad_type, spread_spec.quad_order, spread_spec.point_density)];
+                X_displacement = prepareAdaptiveQuadratureKeyCache(
+                    *quad_key_cache, *X_petsc_vec, X_local_soln, spread_spec.point_density, patch_dx_min);
+            }
+
             // Determining which quadrature rule should be used on which
             // processor is surprisingly expensive, so cache the keys:
             std::vector<quad_key_type> quad_keys(num_active_patch_elems);
@@ -934,6 +1221,15 @@ FEDataManager::spread(const int f_data_idx,
             // Cache interpolated positions too:
             std::vector<boost::multi_array<double, 2> > X_nodes(num_active_patch_elems);
 
+            // Also cache the offsets of the quadrature points of each element
+            // and the DoF indices of F. Together with the FE caches (which are
+            // populated here), this ensures that the element loop below only
+            // reads from shared data structures, unless the FE caches
+            // reinitialize their FE objects on every element, in which case the
+            // loop is not threaded.
+            std::vector<int> qp_offsets(num_active_patch_elems);
+            std::vector<const std::vector<std::vector<dof_id_type> >*> F_dof_indices_ptrs(num_active_patch_elems);
+
             // Setup vectors to store the values of F_JxW and X at the
             // quadrature points.
             unsigned int n_qp_patch = 0;
@@ -942,15 +1238,27 @@ FEDataManager::spread(const int f_data_idx,
                 Elem* const elem = patch_elems[e_idx];
                 const auto& X_dof_indices = X_dof_map_cache.dof_indices(elem);
                 get_values_for_interpolation(X_nodes[e_idx], *X_petsc_vec, X_local_soln, X_dof_indices);
-                const quad_key_type key = getQuadratureKey(spread_spec.quad_type,
-                                                           spread_spec.quad_order,
-                                                           spread_spec.use_adaptive_quadrature,
-                                                           spread_spec.point_density,
-                                                           elem,
-                                                           X_nodes[e_idx],
-                                                           patch_dx_min);
+                const quad_key_type key =
+                    quad_key_cache ? getCachedAdaptiveQuadratureKey(*quad_key_cache,
+                                                                    spread_spec.quad_type,
+                                                                    spread_spec.point_density,
+                                                                    elem,
+                                                                    X_nodes[e_idx],
+                                                                    patch_dx_min,
+                                                                    X_displacement) :
+                                     getQuadratureKey(spread_spec.quad_type,
+                                                      spread_spec.quad_order,
+                                                      spread_spec.use_adaptive_quadrature,
+                                                      spread_spec.point_density,
+                                                      elem,
+                                                      X_nodes[e_idx],
+                                                      patch_dx_min);
                 quad_keys[e_idx] = key;
                 QBase& qrule = d_fe_data->d_quadrature_cache[key];
+                X_fe_cache(key, elem);
+                F_fe_cache(key, elem);
+                F_dof_indices_ptrs[e_idx] = &F_dof_map_cache.dof_indices(elem);
+                qp_offsets[e_idx] = n_qp_patch;
                 n_qp_patch += qrule.n_points();
             }
             if (!n_qp_patch) continue;
@@ -958,38 +1266,49 @@ FEDataManager::spread(const int f_data_idx,
             X_qp.resize(NDIM * n_qp_patch);
 
             // Loop over the elements and compute the values to be spread and
-            // the positions of the quadrature points.
-            int qp_offset = 0;
-            for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+            // the positions of the quadrature points. Each element writes to
+            // a distinct range of F_JxW_qp and X_qp.
+#if defined(_OPENMP)
+#pragma omp parallel if (use_threads)
+#endif
             {
-                Elem* const elem = patch_elems[e_idx];
-                const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
-                get_values_for_interpolation(F_node, *F_petsc_vec, F_local_soln, F_dof_indices);
-                const quad_key_type& key = quad_keys[e_idx];
-                const FEBase& X_fe = X_fe_cache(key, elem);
-                const FEBase& F_fe = F_fe_cache(key, elem);
-                JacobianCalculator& jacobian_calculator = jacobian_calculator_cache[key];
-                const QBase& qrule = d_fe_data->d_quadrature_cache[key];
-
-                // JxW depends on the element
-                const std::vector<double>& JxW_F = jacobian_calculator.get_JxW(elem);
-                const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
-                const std::vector<std::vector<double> >& phi_X = X_fe.get_phi();
-
-                const unsigned int n_qp = qrule.n_points();
-                TBOX_ASSERT(n_qp == phi_F[0].size());
-                TBOX_ASSERT(n_qp == phi_X[0].size());
-                TBOX_ASSERT(n_qp == JxW_F.size());
-                double* F_begin = &F_JxW_qp[n_vars * qp_offset];
-                double* X_begin = &X_qp[NDIM * qp_offset];
-                std::fill(F_begin, F_begin + n_vars * n_qp, 0.0);
-                std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
+                boost::multi_array<double, 2> F_node;
+                JacobianCalculatorCache& elem_jacobian_calculator_cache =
+                    *thread_jacobian_calculator_caches[get_elem_loop_thread_num()];
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+                for (int e_idx = 0; e_idx < static_cast<int>(num_active_patch_elems); ++e_idx)
+                {
+                    Elem* const elem = patch_elems[e_idx];
+                    const auto& F_dof_indices = *F_dof_indices_ptrs[e_idx];
+                    get_values_for_interpolation(F_node, *F_petsc_vec, F_local_soln, F_dof_indices);
+                    const quad_key_type& key = quad_keys[e_idx];
+                    const FEBase& X_fe = X_fe_cache(key, elem);
+                    const FEBase& F_fe = F_fe_cache(key, elem);
+                    JacobianCalculator& jacobian_calculator = elem_jacobian_calculator_cache[key];
+                    const QBase& qrule = d_fe_data->d_quadrature_cache[key];
 
-                sum_weighted_elem_solution</*weights_are_unity*/ false>(
-                    n_vars, F_dof_indices[0].size(), qp_offset, phi_F, JxW_F, F_node, F_JxW_qp);
-                sum_weighted_elem_solution</*weights_are_unity*/ true>(
-                    NDIM, phi_X.size(), qp_offset, phi_X, {}, X_nodes[e_idx], X_qp);
-                qp_offset += n_qp;
+                    // JxW depends on the element
+                    const std::vector<double>& JxW_F = jacobian_calculator.get_JxW(elem);
+                    const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
+                    const std::vector<std::vector<double> >& phi_X = X_fe.get_phi();
+
+                    const unsigned int n_qp = qrule.n_points();
+                    TBOX_ASSERT(n_qp == phi_F[0].size());
+                    TBOX_ASSERT(n_qp == phi_X[0].size());
+                    TBOX_ASSERT(n_qp == JxW_F.size());
+                    const int qp_offset = qp_offsets[e_idx];
+                    double* F_begin = &F_JxW_qp[n_vars * qp_offset];
+                    double* X_begin = &X_qp[NDIM * qp_offset];
+                    std::fill(F_begin, F_begin + n_vars * n_qp, 0.0);
+                    std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
+
+                    sum_weighted_elem_solution</*weights_are_unity*/ false>(
+                        n_vars, F_dof_indices[0].size(), qp_offset, phi_F, JxW_F, F_node, F_JxW_qp);
+                    sum_weighted_elem_solution</*weights_are_unity*/ true>(
+                        NDIM, phi_X.size(), qp_offset, phi_X, {}, X_nodes[e_idx], X_qp);
+                }
             }
 
             zeroExteriorValues(*patch_geom, X_qp, F_JxW_qp, n_vars);
@@ -1471,6 +1790,7 @@ FEDataManager::interpWeighted(const int f_data_idx,
                               const bool close_F,
                               const bool close_X)
 {
+    PerformanceMonitor::ScopedRegion region("FEDataManager::interpWeighted");
     IBTK_TIMER_START(t_interp_weighted);
 
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -1518,7 +1838,6 @@ FEDataManager::interpWeighted(const int f_data_idx,
     using quad_key_type = std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>;
     FECache F_fe_cache(dim, F_fe_type, FEUpdateFlags::update_phi);
     FECache X_fe_cache(dim, X_fe_type, FEUpdateFlags::update_phi);
-    JacobianCalculatorCache jacobian_calculator_cache(mesh.spatial_dimension());
 
     // Communicate any unsynchronized ghost data.
     for (const auto& f_refine_sched : f_refine_scheds)
@@ -1673,13 +1992,29 @@ FEDataManager::interpWeighted(const int f_data_idx,
     }
     else
     {
+        // When threading the element loops, each thread requires its own
+        // Jacobian calculators. The FE caches are shared, so the loops are not
+        // threaded if the caches reinitialize their FE objects on every element
+        // (e.g., for subdivision elements).
+        const bool use_threads = interp_spec.use_threaded_quadrature && !X_fe_cache.reinitializesOnEveryElement() &&
+                                 !F_fe_cache.reinitializesOnEveryElement();
+        std::vector<std::unique_ptr<JacobianCalculatorCache> > thread_jacobian_calculator_caches(
+            get_num_elem_loop_threads(use_threads));
+        for (auto& thread_jacobian_calculator_cache : thread_jacobian_calculator_caches)
+        {
+            thread_jacobian_calculator_cache.reset(new JacobianCalculatorCache(mesh.spatial_dimension()));
+        }
+
         // Loop over the patches to interpolate values to the element quadrature
         // points from the grid, then use these values to compute the projection
         // of the interpolated velocity field onto the FE basis functions.
         DenseVector<double> F_rhs;
-        // Assemble F_rhs_e's vectors in an interleaved format (see the implementation):
+        // Assemble F_rhs_e's vectors in an interleaved format (see the
+        // implementation), contiguously for all elements on the patch:
         std::vector<double> F_rhs_concatenated;
         std::vector<double> F_qp, X_qp;
+        AdaptiveQuadratureKeyCache* quad_key_cache = nullptr;
+        double X_displacement = 0.0;
         int local_patch_num = 0;
         std::vector<libMesh::dof_id_type> dof_id_scratch;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
@@ -1694,6 +2029,16 @@ FEDataManager::interpWeighted(const int f_data_idx,
             const double* const patch_dx = patch_geom->getDx();
             const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
 
+            // Reuse the adaptive quadrature keys computed during previous
+            // calls unless the mesh has moved too far.
+            if (interp_spec.use_adaptive_quadrature && !quad_key_cache)
+            {
+                quad_key_cache = &d_adaptive_quad_key_caches[std::make_tuple(
+                    interp_spec.quad_type, interp_spec.quad_order, interp_spec.point_density)];
+                X_displacement = prepareAdaptiveQuadratureKeyCache(
+                    *quad_key_cache, *X_petsc_vec, X_local_soln, interp_spec.point_density, patch_dx_min);
+            }
+
             // Determining which quadrature rule should be used on which
             // processor is surprisingly expensive, so cache the keys:
             std::vector<quad_key_type> quad_keys(num_active_patch_elems);
@@ -1701,23 +2046,49 @@ FEDataManager::interpWeighted(const int f_data_idx,
             // Cache interpolated positions too:
             std::vector<boost::multi_array<double, 2> > X_nodes(num_active_patch_elems);
 
+            // Also cache the offsets of the quadrature points and of the
+            // right-hand-side values of each element and the DoF indices of
+            // F. Together with the FE caches (which are populated here), this
+            // ensures that the element loops below only read from shared data
+            // structures, unless the FE caches reinitialize their FE objects on
+            // every element, in which case the loops are not threaded.
+            std::vector<int> qp_offsets(num_active_patch_elems);
+            std::vector<int> rhs_offsets(num_active_patch_elems);
+            std::vector<const std::vector<std::vector<dof_id_type> >*> F_dof_indices_ptrs(num_active_patch_elems);
+
             // Setup vectors to store the values of F and X at the quadrature
             // points.
             unsigned int n_qp_patch = 0;
+            unsigned int n_rhs_patch = 0;
             for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
             {
                 Elem* const elem = patch_elems[e_idx];
                 const auto& X_dof_indices = X_dof_map_cache.dof_indices(elem);
                 get_values_for_interpolation(X_nodes[e_idx], *X_petsc_vec, X_local_soln, X_dof_indices);
-                const quad_key_type key = getQuadratureKey(interp_spec.quad_type,
-                                                           interp_spec.quad_order,
-                                                           interp_spec.use_adaptive_quadrature,
-                                                           interp_spec.point_density,
-                                                           elem,
-                                                           X_nodes[e_idx],
-                                                           patch_dx_min);
+                const quad_key_type key =
+                    quad_key_cache ? getCachedAdaptiveQuadratureKey(*quad_key_cache,
+                                                                    interp_spec.quad_type,
+                                                                    interp_spec.point_density,
+                                                                    elem,
+                                                                    X_nodes[e_idx],
+                                                                    patch_dx_min,
+                                                                    X_displacement) :
+                                     getQuadratureKey(interp_spec.quad_type,
+                                                      interp_spec.quad_order,
+                                                      interp_spec.use_adaptive_quadrature,
+                                                      interp_spec.point_density,
+                                                      elem,
+                                                      X_nodes[e_idx],
+                                                      patch_dx_min);
                 QBase& qrule = d_fe_data->d_quadrature_cache[key];
+                X_fe_cache(key, elem);
+                F_fe_cache(key, elem);
+                const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
+                F_dof_indices_ptrs[e_idx] = &F_dof_indices;
+                qp_offsets[e_idx] = n_qp_patch;
+                rhs_offsets[e_idx] = n_rhs_patch;
                 n_qp_patch += qrule.n_points();
+                n_rhs_patch += n_vars * F_dof_indices[0].size();
                 quad_keys[e_idx] = key;
             }
             if (!n_qp_patch) continue;
@@ -1727,8 +2098,10 @@ FEDataManager::interpWeighted(const int f_data_idx,
 
             // Loop over the elements and compute the positions of the
             // quadrature points.
-            int qp_offset = 0;
-            for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static) if (use_threads)
+#endif
+            for (int e_idx = 0; e_idx < static_cast<int>(num_active_patch_elems); ++e_idx)
             {
                 Elem* const elem = patch_elems[e_idx];
                 const quad_key_type& key = quad_keys[e_idx];
@@ -1739,10 +2112,10 @@ FEDataManager::interpWeighted(const int f_data_idx,
                 const unsigned int n_node = elem->n_nodes();
                 const unsigned int n_qp = qrule.n_points();
                 TBOX_ASSERT(n_qp == phi_X[0].size());
+                const int qp_offset = qp_offsets[e_idx];
                 double* X_begin = &X_qp[NDIM * qp_offset];
                 std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
                 sum_weighted_elem_solution<true>(NDIM, n_node, qp_offset, phi_X, {}, X_nodes[e_idx], X_qp);
-                qp_offset += n_qp;
             }
 
             // Interpolate values from the Cartesian grid patch to the
@@ -1765,43 +2138,64 @@ FEDataManager::interpWeighted(const int f_data_idx,
                     F_qp, n_vars, X_qp, NDIM, f_sc_data, patch, interp_box, interp_spec.kernel_fcn);
             }
 
-            // Loop over the elements and accumulate the right-hand-side values.
-            qp_offset = 0;
-            for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+            // Loop over the elements and compute the right-hand-side values.
+            F_rhs_concatenated.resize(n_rhs_patch);
+            std::fill(F_rhs_concatenated.begin(), F_rhs_concatenated.end(), 0.0);
+#if defined(_OPENMP)
+#pragma omp parallel if (use_threads)
+#endif
             {
-                Elem* const elem = patch_elems[e_idx];
-                const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
-                // check the concatenation assumption
-#ifndef NDEBUG
-                for (unsigned int i = 0; i < n_vars; ++i)
+                JacobianCalculatorCache& elem_jacobian_calculator_cache =
+                    *thread_jacobian_calculator_caches[get_elem_loop_thread_num()];
+                std::vector<double> F_rhs_e;
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+                for (int e_idx = 0; e_idx < static_cast<int>(num_active_patch_elems); ++e_idx)
                 {
-                    TBOX_ASSERT(F_dof_indices[i].size() == F_dof_indices[0].size());
-                }
+                    Elem* const elem = patch_elems[e_idx];
+                    const auto& F_dof_indices = *F_dof_indices_ptrs[e_idx];
+                    // check the concatenation assumption
+#ifndef NDEBUG
+                    for (unsigned int i = 0; i < n_vars; ++i)
+                    {
+                        TBOX_ASSERT(F_dof_indices[i].size() == F_dof_indices[0].size());
+                    }
 #endif
-                F_rhs_concatenated.resize(n_vars * F_dof_indices[0].size());
-                std::fill(F_rhs_concatenated.begin(), F_rhs_concatenated.end(), 0.0);
-                const quad_key_type& key = quad_keys[e_idx];
-                const FEBase& F_fe = F_fe_cache(key, elem);
-                const QBase& qrule = d_fe_data->d_quadrature_cache[key];
-                JacobianCalculator& jacobian_calculator = jacobian_calculator_cache[key];
+                    const size_t n_basis = F_dof_indices[0].size();
+                    F_rhs_e.resize(n_vars * n_basis);
+                    std::fill(F_rhs_e.begin(), F_rhs_e.end(), 0.0);
+                    const quad_key_type& key = quad_keys[e_idx];
+                    const FEBase& F_fe = F_fe_cache(key, elem);
+                    const QBase& qrule = d_fe_data->d_quadrature_cache[key];
+                    JacobianCalculator& jacobian_calculator = elem_jacobian_calculator_cache[key];
 
-                // JxW depends on the element
-                const std::vector<double>& JxW_F = jacobian_calculator.get_JxW(elem);
-                const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
+                    // JxW depends on the element
+                    const std::vector<double>& JxW_F = jacobian_calculator.get_JxW(elem);
+                    const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
 
-                const unsigned int n_qp = qrule.n_points();
-                TBOX_ASSERT(n_qp == phi_F[0].size());
-                TBOX_ASSERT(n_qp == JxW_F.size());
-                const size_t n_basis = F_dof_indices[0].size();
-                integrate_elem_rhs(n_vars, n_basis, qp_offset, phi_F, JxW_F, F_qp, F_rhs_concatenated);
+                    const unsigned int n_qp = qrule.n_points();
+                    TBOX_ASSERT(n_qp == phi_F[0].size());
+                    TBOX_ASSERT(n_qp == JxW_F.size());
+                    integrate_elem_rhs(n_vars, n_basis, qp_offsets[e_idx], phi_F, JxW_F, F_qp, F_rhs_e);
+                    std::copy(F_rhs_e.begin(), F_rhs_e.end(), F_rhs_concatenated.begin() + rhs_offsets[e_idx]);
+                }
+            }
 
+            // Accumulate the right-hand-side values in element order, so that
+            // the result does not depend on the number of threads.
+            for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+            {
+                const auto& F_dof_indices = *F_dof_indices_ptrs[e_idx];
+                const size_t n_basis = F_dof_indices[0].size();
+                const auto F_rhs_e_begin = F_rhs_concatenated.begin() + rhs_offsets[e_idx];
                 for (unsigned int i = 0; i < n_vars; ++i)
                 {
                     // libMesh sometimes resizes F_rhs inside
                     // constrain_element_vector, so ensure it has the right size:
                     F_rhs.resize(F_dof_indices[i].size());
-                    std::copy(F_rhs_concatenated.begin() + i * n_basis,
-                              F_rhs_concatenated.begin() + (i + 1) * n_basis,
+                    std::copy(F_rhs_e_begin + i * n_basis,
+                              F_rhs_e_begin + (i + 1) * n_basis,
                               F_rhs.get_values().begin());
 
                     dof_id_scratch = F_dof_indices[i];
@@ -1818,7 +2212,6 @@ FEDataManager::interpWeighted(const int f_data_idx,
                         F_vec.add_vector(F_rhs, dof_id_scratch);
                     }
                 }
-                qp_offset += n_qp;
             }
         }
     }
@@ -1871,6 +2264,7 @@ FEDataManager::interp(const int f_data_idx,
                       const double fill_data_time,
                       const bool close_X)
 {
+    PerformanceMonitor::ScopedRegion region("FEDataManager::interp");
     IBTK_TIMER_START(t_interp);
 
     // Interpolate quantity at quadrature points and filter it to nodal points.
@@ -2125,14 +2519,16 @@ FEDataManager::buildDiagonalL2MassMatrix(const std::string& system_name)
 PetscVector<double>*
 FEDataManager::buildIBGhostedDiagonalL2MassMatrix(const std::string& system_name)
 {
-    if (!d_L2_proj_matrix_diag_ghost.count(system_name))
+    // Systems with the same DOF structure share a single mass matrix.
+    const std::string& mass_system_name = d_fe_projector->getMassMatrixSystemName(system_name);
+    if (!d_L2_proj_matrix_diag_ghost.count(mass_system_name))
     {
-        std::unique_ptr<PetscVector<double> > M_vec = buildIBGhostedVector(system_name);
-        *M_vec = *d_fe_projector->buildDiagonalL2MassMatrix(system_name);
+        std::unique_ptr<PetscVector<double> > M_vec = buildIBGhostedVector(mass_system_name);
+        *M_vec = *d_fe_projector->buildDiagonalL2MassMatrix(mass_system_name);
         M_vec->close();
-        d_L2_proj_matrix_diag_ghost[system_name] = std::move(M_vec);
+        d_L2_proj_matrix_diag_ghost[mass_system_name] = std::move(M_vec);
     }
-    return d_L2_proj_matrix_diag_ghost[system_name].get();
+    return d_L2_proj_matrix_diag_ghost[mass_system_name].get();
 }
 
 bool
@@ -2155,6 +2551,13 @@ FEDataManager::computeL2Projection(NumericVector<double>& U_vec,
                                                max_its);
 } // computeL2Projection
 
+void
+FEDataManager::setUseMatrixFreeMassOperator(const bool use_matrix_free)
+{
+    d_fe_projector->setUseMatrixFreeMassOperator(use_matrix_free);
+    return;
+} // setUseMatrixFreeMassOperator
+
 bool
 FEDataManager::updateQuadratureRule(std::unique_ptr<QBase>& qrule,
                                     QuadratureType type,
@@ -2228,7 +2631,7 @@ FEDataManager::addWorkloadEstimate(Pointer<PatchHierarchy<NDIM> > hierarchy,
         updateQuadPointCountData(ln, ln);
         HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(hierarchy, ln, ln);
         hier_cc_data_ops.axpy(
-            workload_data_idx, d_default_workload_spec.q_point_weight, d_qp_count_idx, workload_data_idx);
+            workload_data_idx, d_default_workload_spec.getTotalQuadPointWeight(), d_qp_count_idx, workload_data_idx);
     }
 
     IBTK_TIMER_STOP(t_update_workload_estimates);
@@ -2252,7 +2655,20 @@ FEDataManager::applyGradientDetector(const Pointer<BasePatchHierarchy<NDIM> > hi
     TBOX_ASSERT(hierarchy->getPatchLevel(level_number));
     TBOX_ASSERT(hierarchy == d_hierarchy);
 
-    if (initial_time)
+    if (d_use_bounding_box_tagging)
+    {
+        // Tag cells for refinement whenever they are covered by the bounding
+        // boxes of active elements, using the same buffers as below.
+        if (initial_time)
+        {
+            tagCellsInActiveElementBoundingBoxes(level_number, tag_index, /*buffer*/ 1);
+        }
+        else if (level_number + 1 == d_fe_data->d_level_number && level_number < d_hierarchy->getFinestLevelNumber())
+        {
+            tagCellsInActiveElementBoundingBoxes(level_number, tag_index, /*buffer*/ 0);
+        }
+    }
+    else if (initial_time)
     {
         // Determine the active elements associated with the prescribed patch
         // level.
@@ -2387,6 +2803,45 @@ FEDataManager::putToDatabase(Pointer<Database> db)
     db->putInteger("d_coarsest_ln", d_coarsest_ln);
     db->putInteger("d_finest_ln", d_finest_ln);
 
+    // Save the mapping between elements and local patches. Elements are
+    // identified by their ids and patches by their boxes, since neither
+    // pointers nor local patch numbers are preserved across restarts.
+    const int level_number = d_fe_data->d_level_number;
+    if (d_restore_element_mappings_from_restart && d_hierarchy && d_fe_data->d_es &&
+        level_number != IBTK::invalid_level_number && level_number <= d_hierarchy->getFinestLevelNumber())
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+        std::vector<int> patch_boxes, patch_n_elems, elem_ids;
+        int local_patch_num = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+        {
+            const Box<NDIM>& patch_box = level->getPatch(p())->getBox();
+            patch_boxes.insert(patch_boxes.end(), &patch_box.lower()(0), &patch_box.lower()(0) + NDIM);
+            patch_boxes.insert(patch_boxes.end(), &patch_box.upper()(0), &patch_box.upper()(0) + NDIM);
+            TBOX_ASSERT(local_patch_num < static_cast<int>(d_active_patch_elem_map.size()));
+            const std::vector<Elem*>& patch_elems = d_active_patch_elem_map[local_patch_num];
+            patch_n_elems.push_back(static_cast<int>(patch_elems.size()));
+            for (const Elem* const elem : patch_elems)
+            {
+                TBOX_ASSERT(elem->id() <= static_cast<dof_id_type>(std::numeric_limits<int>::max()));
+                elem_ids.push_back(static_cast<int>(elem->id()));
+            }
+        }
+        db->putInteger("restart_mapping_level_number", level_number);
+        db->putInteger("restart_mapping_n_active_elem", static_cast<int>(d_fe_data->d_es->get_mesh().n_active_elem()));
+        db->putInteger("restart_mapping_n_patches", local_patch_num);
+        if (local_patch_num > 0)
+        {
+            db->putIntegerArray("restart_mapping_patch_boxes", &patch_boxes[0], static_cast<int>(patch_boxes.size()));
+            db->putIntegerArray(
+                "restart_mapping_patch_n_elems", &patch_n_elems[0], static_cast<int>(patch_n_elems.size()));
+        }
+        if (!elem_ids.empty())
+        {
+            db->putIntegerArray("restart_mapping_elem_ids", &elem_ids[0], static_cast<int>(elem_ids.size()));
+        }
+    }
+
     IBTK_TIMER_STOP(t_put_to_database);
     return;
 } // putToDatabase
@@ -2488,6 +2943,25 @@ FEDataManager::FEDataManager(std::shared_ptr<FEData> fe_data,
     // Setup the FE projector logging state.
     d_fe_projector->setLoggingEnabled(getLoggingEnabled());
 
+    // Report the memory used by the ghosted vectors and the element mappings.
+    d_ghost_vectors_memory_reporter_id = MemoryMonitor::registerReporter("FE ghosted vectors", [this]() {
+        std::size_t bytes = 0;
+        for (const auto& system_ghost_vec : d_system_ghost_vec) bytes += get_vector_memory(*system_ghost_vec.second);
+        for (const auto& system_ghost_vec : d_system_ib_ghost_vec) bytes += get_vector_memory(*system_ghost_vec.second);
+        for (const auto& diag_vec : d_L2_proj_matrix_diag_ghost) bytes += get_vector_memory(*diag_vec.second);
+        return bytes;
+    });
+    d_element_mappings_memory_reporter_id = MemoryMonitor::registerReporter("FE element mappings", [this]() {
+        std::size_t bytes = d_active_elems.size() * sizeof(Elem*);
+        for (const auto& patch_elems : d_active_patch_elem_map) bytes += patch_elems.size() * sizeof(Elem*);
+        for (const auto& patch_nodes : d_active_patch_node_map) bytes += patch_nodes.size() * sizeof(Node*);
+        for (const auto& ghost_dofs : d_active_patch_ghost_dofs)
+        {
+            bytes += ghost_dofs.second.size() * sizeof(unsigned int);
+        }
+        return bytes;
+    });
+
     // Setup Timers.
     IBTK_DO_ONCE(
         t_reinit_element_mappings =
@@ -2535,6 +3009,8 @@ FEDataManager::~FEDataManager()
     {
         RestartManager::getManager()->unregisterRestartItem(d_object_name);
     }
+    MemoryMonitor::unregisterReporter(d_ghost_vectors_memory_reporter_id);
+    MemoryMonitor::unregisterReporter(d_element_mappings_memory_reporter_id);
 } // ~FEDataManager
 
 void
@@ -2725,11 +3201,9 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
 {
     // Get the necessary FE data.
     const MeshBase& mesh = d_fe_data->d_es->get_mesh();
-    System& X_system = d_fe_data->d_es->get_system(COORDINATES_SYSTEM_NAME);
 
     // Setup data structures used to assign elements to patches.
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
-    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
     const int num_local_patches = level->getProcessorMapping().getNumberOfLocalIndices();
     std::vector<std::set<Elem*> > local_patch_elems(num_local_patches);
     active_patch_elems.resize(num_local_patches);
@@ -2738,6 +3212,221 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
     // bounding box (which is computed based on the bounds of quadrature
     // points) intersects the patch interior grown by
     // d_associated_elem_ghost_width (which is presently assumed to be 1).
+    //
+    // The element bounding boxes are binned on a uniform grid so that each
+    // patch only needs to examine the elements in nearby bins.
+    const BoundingBoxGrid bbox_grid(collectGlobalActiveElementBoundingBoxes(level_number));
+    std::vector<Elem*> elems;
+    const MeshBase::const_element_iterator el_begin = mesh.active_elements_begin();
+    const MeshBase::const_element_iterator el_end = mesh.active_elements_end();
+    for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it) elems.push_back(*el_it);
+    TBOX_ASSERT(elems.size() == bbox_grid.getBoxes().size());
+
+    int local_patch_num = 0;
+    std::vector<std::size_t> patch_elem_idxs;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+    {
+        std::set<Elem*>& patch_elems = local_patch_elems[local_patch_num];
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const libMeshWrappers::BoundingBox patch_bbox = get_patch_bounding_box(*patch, d_associated_elem_ghost_width);
+        bbox_grid.findIntersectingBoxes(patch_bbox, patch_elem_idxs);
+        for (const std::size_t k : patch_elem_idxs) patch_elems.insert(elems[k]);
+    }
+
+    // Set the active patch element data.
+    local_patch_num = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+    {
+        const std::set<Elem*>& local_elems = local_patch_elems[local_patch_num];
+        std::vector<Elem*>& active_elems = active_patch_elems[local_patch_num];
+        active_elems.resize(local_elems.size());
+        std::copy(local_elems.begin(), local_elems.end(), active_elems.begin());
+    }
+    return;
+} // collectActivePatchElements
+
+bool
+FEDataManager::restoreActivePatchElements(std::vector<std::vector<Elem*> >& active_patch_elems, const int level_number)
+{
+    const MeshBase& mesh = d_fe_data->d_es->get_mesh();
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+    const int num_local_patches = level->getProcessorMapping().getNumberOfLocalIndices();
+
+    // The restart data is only usable if it was written for the same mesh and
+    // the same local patches. Patches are compared in the order in which they
+    // are visited by the level iterator, which is the local patch numbering.
+    bool is_consistent = level_number == d_restart_mapping_level_number &&
+                         mesh.n_active_elem() == d_restart_mapping_n_active_elem &&
+                         static_cast<std::size_t>(num_local_patches) == d_restart_mapping_patch_boxes.size();
+    std::vector<std::vector<Elem*> > restored_patch_elems(num_local_patches);
+    int local_patch_num = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); is_consistent && p; p++, ++local_patch_num)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        if (!(patch->getBox() == d_restart_mapping_patch_boxes[local_patch_num]))
+        {
+            is_consistent = false;
+            break;
+        }
+        std::vector<Elem*>& patch_elems = restored_patch_elems[local_patch_num];
+        patch_elems.reserve(d_restart_mapping_elem_ids[local_patch_num].size());
+        for (const dof_id_type elem_id : d_restart_mapping_elem_ids[local_patch_num])
+        {
+            Elem* const elem = mesh.query_elem_ptr(elem_id);
+            if (!elem || !elem->active())
+            {
+                is_consistent = false;
+                break;
+            }
+            patch_elems.push_back(elem);
+        }
+    }
+
+    // Setting up the ghost DOFs is collective, so either every process uses
+    // the restored mapping or none do.
+    is_consistent = SAMRAI_MPI::minReduction(static_cast<int>(is_consistent)) == 1;
+    if (d_enable_logging)
+    {
+        plog << "FEDataManager::restoreActivePatchElements(): "
+             << (is_consistent ? "restored element mappings from restart data\n" :
+                                 "restart data is inconsistent with the current mesh or patch level; "
+                                 "recomputing element mappings\n");
+    }
+    if (is_consistent) active_patch_elems = std::move(restored_patch_elems);
+    return is_consistent;
+} // restoreActivePatchElements
+
+void
+FEDataManager::collectActivePatchElementsIncremental(std::vector<std::vector<Elem*> >& active_patch_elems,
+                                                     const std::vector<std::vector<Elem*> >& prev_active_patch_elems,
+                                                     const int level_number)
+{
+    // Get the necessary FE data.
+    const MeshBase& mesh = d_fe_data->d_es->get_mesh();
+
+    // Setup data structures used to assign elements to patches.
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
+    const int num_local_patches = level->getProcessorMapping().getNumberOfLocalIndices();
+    active_patch_elems.resize(num_local_patches);
+    const std::vector<libMeshWrappers::BoundingBox> global_bboxes =
+        collectGlobalActiveElementBoundingBoxes(level_number);
+
+    // Determine the range of cells of the level covered by each element's
+    // bounding box. Since patch boundaries coincide with cell boundaries, an
+    // element can only change which patches it is associated with if this
+    // range has changed since the previous mapping.
+    const double* const dx_coarsest = grid_geom->getDx();
+    const double* const x_lower = grid_geom->getXLower();
+    const IntVector<NDIM>& ratio = level->getRatio();
+    std::vector<Elem*> elems;
+    std::vector<dof_id_type> elem_ids;
+    std::vector<Box<NDIM> > elem_boxes;
+    elems.reserve(global_bboxes.size());
+    elem_ids.reserve(global_bboxes.size());
+    elem_boxes.reserve(global_bboxes.size());
+    auto el_it = mesh.active_elements_begin();
+    for (const libMeshWrappers::BoundingBox& bbox : global_bboxes)
+    {
+        Box<NDIM> elem_box;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const double dx = dx_coarsest[d] / static_cast<double>(ratio(d));
+            elem_box.lower(d) = static_cast<int>(std::floor((bbox.first(d) - x_lower[d]) / dx));
+            elem_box.upper(d) = static_cast<int>(std::floor((bbox.second(d) - x_lower[d]) / dx));
+        }
+        elems.push_back(*el_it);
+        elem_ids.push_back((*el_it)->id());
+        elem_boxes.push_back(elem_box);
+        ++el_it;
+    }
+
+    // The previous mapping can only be used as a starting point if it was
+    // computed on the same level of the same mesh.
+    const bool can_reuse_mapping =
+        level_number == d_prev_mapping_level_number && elem_ids == d_prev_mapping_elem_ids &&
+        prev_active_patch_elems.size() == d_prev_mapping_patch_boxes.size();
+    std::vector<std::size_t> moved_elems;
+    std::unordered_set<const Elem*> moved_elem_set;
+    if (can_reuse_mapping)
+    {
+        for (std::size_t k = 0; k < elems.size(); ++k)
+        {
+            if (!(elem_boxes[k] == d_prev_mapping_elem_boxes[k]))
+            {
+                moved_elems.push_back(k);
+                moved_elem_set.insert(elems[k]);
+            }
+        }
+    }
+
+    // Patches without a previous counterpart use the same binning as
+    // collectActivePatchElements(), which is only built if it is needed.
+    std::unique_ptr<BoundingBoxGrid> bbox_grid;
+    std::vector<std::size_t> patch_elem_idxs;
+
+    int local_patch_num = 0;
+    std::vector<Box<NDIM> > patch_boxes;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        patch_boxes.push_back(patch_box);
+        const libMeshWrappers::BoundingBox patch_bbox = get_patch_bounding_box(*patch, d_associated_elem_ghost_width);
+        std::set<Elem*> patch_elems;
+
+        // Look for an identical patch in the previous mapping.
+        std::size_t prev_patch_num = d_prev_mapping_patch_boxes.size();
+        if (can_reuse_mapping)
+        {
+            for (std::size_t k = 0; k < d_prev_mapping_patch_boxes.size(); ++k)
+            {
+                if (d_prev_mapping_patch_boxes[k] == patch_box)
+                {
+                    prev_patch_num = k;
+                    break;
+                }
+            }
+        }
+
+        if (prev_patch_num < d_prev_mapping_patch_boxes.size())
+        {
+            // Elements that have not moved keep their previous association;
+            // only the elements that have moved need to be re-bucketed.
+            for (Elem* const elem : prev_active_patch_elems[prev_patch_num])
+            {
+                if (!moved_elem_set.count(elem)) patch_elems.insert(elem);
+            }
+            for (const std::size_t k : moved_elems)
+            {
+                if (bounding_boxes_intersect(global_bboxes[k], patch_bbox)) patch_elems.insert(elems[k]);
+            }
+        }
+        else
+        {
+            if (!bbox_grid) bbox_grid.reset(new BoundingBoxGrid(global_bboxes));
+            bbox_grid->findIntersectingBoxes(patch_bbox, patch_elem_idxs);
+            for (const std::size_t k : patch_elem_idxs) patch_elems.insert(elems[k]);
+        }
+        active_patch_elems[local_patch_num].assign(patch_elems.begin(), patch_elems.end());
+    }
+
+    // Store the data required to update this mapping the next time around.
+    d_prev_mapping_level_number = level_number;
+    d_prev_mapping_patch_boxes = std::move(patch_boxes);
+    d_prev_mapping_elem_ids = std::move(elem_ids);
+    d_prev_mapping_elem_boxes = std::move(elem_boxes);
+    return;
+} // collectActivePatchElementsIncremental
+
+std::vector<libMeshWrappers::BoundingBox>
+FEDataManager::collectGlobalActiveElementBoundingBoxes(const int level_number)
+{
+    // Get the necessary FE data.
+    const MeshBase& mesh = d_fe_data->d_es->get_mesh();
+    System& X_system = d_fe_data->d_es->get_system(COORDINATES_SYSTEM_NAME);
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+
     double dx_0 = std::numeric_limits<double>::max();
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
@@ -2779,52 +3468,122 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
         local_bboxes.back().union_with(local_qp_bboxes[box_n]);
 #endif
     }
-    const std::vector<libMeshWrappers::BoundingBox> global_bboxes =
-        get_global_active_element_bounding_boxes(mesh, local_bboxes);
+    return get_global_active_element_bounding_boxes(mesh, local_bboxes);
+} // collectGlobalActiveElementBoundingBoxes
 
-    int local_patch_num = 0;
-    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+void
+FEDataManager::tagCellsInActiveElementBoundingBoxes(const int level_number, const int tag_index, const int buffer)
+{
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+    const IntVector<NDIM>& ratio = level->getRatio();
+    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
+
+    // Tag the cells covered by the bounding boxes of the elements that
+    // intersect each patch grown by the buffer.
+    const BoundingBoxGrid bbox_grid(collectGlobalActiveElementBoundingBoxes(level_number));
+    const std::vector<libMeshWrappers::BoundingBox>& bboxes = bbox_grid.getBoxes();
+    std::vector<std::size_t> patch_elem_idxs;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
-        std::set<Elem*>& elems = local_patch_elems[local_patch_num];
-        Pointer<Patch<NDIM> > patch = level->getPatch(p());
-        const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-        const double* const dx = pgeom->getDx();
-        // TODO: reimplement this with an rtree description of SAMRAI's patches
-        libMeshWrappers::BoundingBox patch_bbox;
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            patch_bbox.first(d) = pgeom->getXLower()[d] - dx[d] * d_associated_elem_ghost_width(d);
-            patch_bbox.second(d) = pgeom->getXUpper()[d] + dx[d] * d_associated_elem_ghost_width(d);
-        }
-        for (unsigned int d = NDIM; d < LIBMESH_DIM; ++d)
+        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<CellData<NDIM, int> > tag_data = patch->getPatchData(tag_index);
+        bbox_grid.findIntersectingBoxes(get_patch_bounding_box(*patch, IntVector<NDIM>(buffer)), patch_elem_idxs);
+        for (const std::size_t k : patch_elem_idxs)
         {
-            patch_bbox.first(d) = 0.0;
-            patch_bbox.second(d) = 0.0;
+            const hier::Index<NDIM> bbox_lower = IndexUtilities::getCellIndex(bboxes[k].first, grid_geom, ratio);
+            const hier::Index<NDIM> bbox_upper = IndexUtilities::getCellIndex(bboxes[k].second, grid_geom, ratio);
+            const Box<NDIM> tag_box =
+                Box<NDIM>(bbox_lower - hier::Index<NDIM>(buffer), bbox_upper + hier::Index<NDIM>(buffer)) * patch_box;
+            if (!tag_box.empty()) tag_data->fillAll(1, tag_box);
         }
-
-        auto el_it = mesh.active_elements_begin();
-        for (const libMeshWrappers::BoundingBox& bbox : global_bboxes)
+    }
+    return;
+} // tagCellsInActiveElementBoundingBoxes
+
+double
+FEDataManager::prepareAdaptiveQuadratureKeyCache(AdaptiveQuadratureKeyCache& cache,
+                                                 PetscVector<double>& X_petsc_vec,
+                                                 const double* const X_local_soln,
+                                                 const double point_density,
+                                                 const double dx_min)
+{
+    Vec X_global_vec = X_petsc_vec.vec();
+    Vec X_local_vec = nullptr;
+    int ierr = VecGhostGetLocalForm(X_global_vec, &X_local_vec);
+    IBTK_CHKERRQ(ierr);
+    PetscInt X_local_size = 0;
+    ierr = VecGetLocalSize(X_local_vec ? X_local_vec : X_global_vec, &X_local_size);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostRestoreLocalForm(X_global_vec, &X_local_vec);
+    IBTK_CHKERRQ(ierr);
+
+    // The cached keys are only meaningful for the same layout of the position
+    // vector and the same grid spacing.
+    if (cache.X_ref.size() != static_cast<std::size_t>(X_local_size) || cache.dx_min != dx_min)
+    {
+        cache.dx_min = dx_min;
+        cache.X_ref.assign(X_local_soln, X_local_soln + X_local_size);
+        cache.entries.clear();
+        return 0.0;
+    }
+
+    // Bound the distance that any node has moved since the reference
+    // positions were recorded.  Each edge length changes by at most twice
+    // this distance.
+    double max_component_displacement = 0.0;
+    for (PetscInt i = 0; i < X_local_size; ++i)
+    {
+        max_component_displacement =
+            std::max(max_component_displacement, std::abs(X_local_soln[i] - cache.X_ref[i]));
+    }
+    const double X_displacement = std::sqrt(static_cast<double>(NDIM)) * max_component_displacement;
+
+    // Once the structure has moved a significant fraction of the distance
+    // between quadrature points, most of the cached keys cannot be verified
+    // anymore, so we start over from the current positions.
+    if (2.0 * X_displacement > 0.25 * dx_min / point_density)
+    {
+        cache.X_ref.assign(X_local_soln, X_local_soln + X_local_size);
+        cache.entries.clear();
+        return 0.0;
+    }
+    return X_displacement;
+} // prepareAdaptiveQuadratureKeyCache
+
+std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>
+FEDataManager::getCachedAdaptiveQuadratureKey(AdaptiveQuadratureKeyCache& cache,
+                                              const libMesh::QuadratureType quad_type,
+                                              const double point_density,
+                                              const Elem* const elem,
+                                              const boost::multi_array<double, 2>& X_node,
+                                              const double dx_min,
+                                              const double X_displacement)
+{
+    // The adaptive key only depends on the number of points per edge,
+    // ceil(point_density * hmax / dx_min), so it cannot change as long as
+    // hmax stays within the interval in which that number is constant.
+    auto it = cache.entries.find(elem->id());
+    if (it != cache.entries.end())
+    {
+        const AdaptiveQuadratureKeyCache::Entry& entry = it->second;
+        if (entry.hmax_lower - 2.0 * X_displacement > entry.valid_lower &&
+            entry.hmax_upper + 2.0 * X_displacement <= entry.valid_upper)
         {
-#if LIBMESH_VERSION_LESS_THAN(1, 2, 0)
-            if (bbox.intersect(patch_bbox)) elems.insert(*el_it);
-#else
-            if (bbox.intersects(patch_bbox)) elems.insert(*el_it);
-#endif
-            ++el_it;
+            return entry.key;
         }
     }
 
-    // Set the active patch element data.
-    local_patch_num = 0;
-    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
-    {
-        const std::set<Elem*>& local_elems = local_patch_elems[local_patch_num];
-        std::vector<Elem*>& active_elems = active_patch_elems[local_patch_num];
-        active_elems.resize(local_elems.size());
-        std::copy(local_elems.begin(), local_elems.end(), active_elems.begin());
-    }
-    return;
-} // collectActivePatchElements
+    const double hmax = get_max_edge_length(elem, X_node);
+    const double npts = std::ceil(point_density * hmax / dx_min);
+    AdaptiveQuadratureKeyCache::Entry& entry = cache.entries[elem->id()];
+    entry.key = getAdaptiveQuadratureKey(quad_type, point_density, elem, hmax, dx_min);
+    entry.hmax_lower = hmax - 2.0 * X_displacement;
+    entry.hmax_upper = hmax + 2.0 * X_displacement;
+    entry.valid_lower = (npts - 1.0) * dx_min / point_density;
+    entry.valid_upper = npts * dx_min / point_density;
+    return entry.key;
+} // getCachedAdaptiveQuadratureKey
 
 void
 FEDataManager::collectActivePatchNodes(std::vector<std::vector<Node*> >& active_patch_nodes,
@@ -2969,6 +3728,38 @@ FEDataManager::getFromRestart()
 
     d_coarsest_ln = db->getInteger("d_coarsest_ln");
     d_finest_ln = db->getInteger("d_finest_ln");
+
+    // The element mapping is only present if it was requested when the
+    // restart file was written.
+    if (db->keyExists("restart_mapping_level_number"))
+    {
+        d_restart_mapping_level_number = db->getInteger("restart_mapping_level_number");
+        d_restart_mapping_n_active_elem = db->getInteger("restart_mapping_n_active_elem");
+        const int n_patches = db->getInteger("restart_mapping_n_patches");
+        std::vector<int> patch_boxes(2 * NDIM * n_patches), patch_n_elems(n_patches);
+        if (n_patches > 0)
+        {
+            db->getIntegerArray("restart_mapping_patch_boxes", &patch_boxes[0], 2 * NDIM * n_patches);
+            db->getIntegerArray("restart_mapping_patch_n_elems", &patch_n_elems[0], n_patches);
+        }
+        const int n_elem_ids = std::accumulate(patch_n_elems.begin(), patch_n_elems.end(), 0);
+        std::vector<int> elem_ids(n_elem_ids);
+        if (n_elem_ids > 0) db->getIntegerArray("restart_mapping_elem_ids", &elem_ids[0], n_elem_ids);
+
+        d_restart_mapping_patch_boxes.resize(n_patches);
+        d_restart_mapping_elem_ids.resize(n_patches);
+        auto elem_id_it = elem_ids.begin();
+        for (int k = 0; k < n_patches; ++k)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                d_restart_mapping_patch_boxes[k].lower(d) = patch_boxes[2 * NDIM * k + d];
+                d_restart_mapping_patch_boxes[k].upper(d) = patch_boxes[2 * NDIM * k + NDIM + d];
+            }
+            d_restart_mapping_elem_ids[k].assign(elem_id_it, elem_id_it + patch_n_elems[k]);
+            elem_id_it += patch_n_elems[k];
+        }
+    }
     return;
 } // getFromRestart
 
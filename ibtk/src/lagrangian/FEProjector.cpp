@@ -15,8 +15,13 @@
 
 #include <IBTK_config.h>
 
+#include <ibtk/FEDataInterpolation.h>
 #include <ibtk/FEDataManager.h>
 #include <ibtk/FEProjector.h>
+#include <ibtk/FEValues.h>
+#include <ibtk/IBTK_CHKERRQ.h>
+#include <ibtk/MemoryMonitor.h>
+#include <ibtk/libmesh_utilities.h>
 #include <ibtk/namespaces.h> // IWYU pragma: keep
 
 #include <tbox/Timer.h>
@@ -25,6 +30,12 @@
 #include <libmesh/boundary_info.h>
 #include <libmesh/dof_map.h>
 #include <libmesh/elem.h>
+#include <libmesh/quadrature.h>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <numeric>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -38,6 +49,41 @@ namespace
 static Timer* t_build_l2_projection_solver;
 static Timer* t_build_diagonal_l2_mass_matrix;
 static Timer* t_compute_l2_projection;
+static Timer* t_apply_matrix_free_mass_operator;
+
+// Build the quadrature rule used by all representations of the mass matrix of a system (assembled, lumped, and
+// matrix-free), so that they agree. The rule is the default rule of the highest-order variable of the system.
+std::unique_ptr<QBase>
+build_mass_matrix_qrule(const DofMap& dof_map, const unsigned int dim)
+{
+    FEType fe_type = dof_map.variable_type(0);
+    for (unsigned int var_num = 1; var_num < dof_map.n_variables(); ++var_num)
+    {
+        const FEType& var_fe_type = dof_map.variable_type(var_num);
+        if (var_fe_type.order.get_order() > fe_type.order.get_order()) fe_type = var_fe_type;
+    }
+    return fe_type.default_quadrature_rule(dim);
+}
+
+// Determine whether the elements of the mesh can be processed in batches by IBTK::FEValues::reinitBatch().
+bool
+use_fe_values_batches(const MeshBase& mesh, const DofMap& dof_map)
+{
+    if (mesh.mesh_dimension() != NDIM) return false;
+    const FEType& fe_type = dof_map.variable_type(0);
+    for (unsigned int var_num = 1; var_num < dof_map.n_variables(); ++var_num)
+    {
+        if (dof_map.variable_type(var_num) != fe_type) return false;
+    }
+    const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
+    const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
+    for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+    {
+        const Elem* const elem = *el_it;
+        if (elem->p_level() != 0 || !FEValuesBase::isIsoparametricLagrange(fe_type, elem->type())) return false;
+    }
+    return true;
+}
 
 inline boundary_id_type
 get_dirichlet_bdry_ids(const std::vector<boundary_id_type>& bdry_ids)
@@ -71,7 +117,11 @@ FEProjector::FEProjector(EquationSystems* equation_systems, const bool enable_lo
                  t_build_diagonal_l2_mass_matrix =
                      TimerManager::getManager()->getTimer("IBTK::FEProjector::buildDiagonalL2MassMatrix()");
                  t_compute_l2_projection =
-                     TimerManager::getManager()->getTimer("IBTK::FEProjector::computeL2Projection()");)
+                     TimerManager::getManager()->getTimer("IBTK::FEProjector::computeL2Projection()");
+                 t_apply_matrix_free_mass_operator =
+                     TimerManager::getManager()->getTimer("IBTK::FEProjector::applyMatrixFreeMassOperator()");)
+    d_memory_reporter_id =
+        MemoryMonitor::registerReporter("FE projection matrices", [this]() { return getMemoryUsage(); });
 }
 
 FEProjector::FEProjector(std::shared_ptr<FEData> fe_data, const bool enable_logging)
@@ -83,7 +133,24 @@ FEProjector::FEProjector(std::shared_ptr<FEData> fe_data, const bool enable_logg
                  t_build_diagonal_l2_mass_matrix =
                      TimerManager::getManager()->getTimer("IBTK::FEProjector::buildDiagonalL2MassMatrix()");
                  t_compute_l2_projection =
-                     TimerManager::getManager()->getTimer("IBTK::FEProjector::computeL2Projection()");)
+                     TimerManager::getManager()->getTimer("IBTK::FEProjector::computeL2Projection()");
+                 t_apply_matrix_free_mass_operator =
+                     TimerManager::getManager()->getTimer("IBTK::FEProjector::applyMatrixFreeMassOperator()");)
+    d_memory_reporter_id =
+        MemoryMonitor::registerReporter("FE projection matrices", [this]() { return getMemoryUsage(); });
+}
+
+FEProjector::~FEProjector()
+{
+    MemoryMonitor::unregisterReporter(d_memory_reporter_id);
+    for (const auto& pair : d_L2_proj_mf_operator)
+    {
+        MatrixFreeMassOperator& op = *pair.second;
+        int ierr = KSPDestroy(&op.solver);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatDestroy(&op.M_mat);
+        IBTK_CHKERRQ(ierr);
+    }
 }
 
 std::pair<PetscLinearSolver<double>*, PetscMatrix<double>*>
@@ -91,7 +158,10 @@ FEProjector::buildL2ProjectionSolver(const std::string& system_name)
 {
     IBTK_TIMER_START(t_build_l2_projection_solver);
 
-    if (!d_L2_proj_solver.count(system_name) || !d_L2_proj_matrix.count(system_name))
+    // Systems with the same DOF structure share a single mass matrix.
+    const std::string& mass_system_name = getMassMatrixSystemName(system_name);
+
+    if (!d_L2_proj_solver.count(mass_system_name) || !d_L2_proj_matrix.count(mass_system_name))
     {
         if (d_enable_logging)
         {
@@ -105,13 +175,13 @@ FEProjector::buildL2ProjectionSolver(const std::string& system_name)
         const unsigned int dim = mesh.mesh_dimension();
 
         // Extract the FE system and DOF map, and setup the FE object.
-        System& system = d_fe_data->getEquationSystems()->get_system(system_name);
+        System& system = d_fe_data->getEquationSystems()->get_system(mass_system_name);
         const int sys_num = system.number();
         DofMap& dof_map = system.get_dof_map();
-        FEData::SystemDofMapCache& dof_map_cache = *d_fe_data->getDofMapCache(system_name);
+        FEData::SystemDofMapCache& dof_map_cache = *d_fe_data->getDofMapCache(mass_system_name);
         dof_map.compute_sparsity(mesh);
         FEType fe_type = dof_map.variable_type(0);
-        std::unique_ptr<QBase> qrule = fe_type.default_quadrature_rule(dim);
+        std::unique_ptr<QBase> qrule = build_mass_matrix_qrule(dof_map, dim);
         std::unique_ptr<FEBase> fe(FEBase::build(dim, fe_type));
         fe->attach_quadrature_rule(qrule.get());
         const std::vector<double>& JxW = fe->get_JxW();
@@ -207,16 +277,19 @@ FEProjector::buildL2ProjectionSolver(const std::string& system_name)
         // Assemble the matrix.
         M_mat->close();
 
-        // Setup the solver.
+        // Setup the solver. Runtime options are applied once, here, rather
+        // than every time that the solver is used.
         solver->reuse_preconditioner(true);
+        int ierr = KSPSetFromOptions(solver->ksp());
+        IBTK_CHKERRQ(ierr);
 
         // Store the solver, mass matrix, and configuration options.
-        d_L2_proj_solver[system_name] = std::move(solver);
-        d_L2_proj_matrix[system_name] = std::move(M_mat);
+        d_L2_proj_solver[mass_system_name] = std::move(solver);
+        d_L2_proj_matrix[mass_system_name] = std::move(M_mat);
     }
 
     IBTK_TIMER_STOP(t_build_l2_projection_solver);
-    return std::make_pair(d_L2_proj_solver[system_name].get(), d_L2_proj_matrix[system_name].get());
+    return std::make_pair(d_L2_proj_solver[mass_system_name].get(), d_L2_proj_matrix[mass_system_name].get());
 }
 
 PetscVector<double>*
@@ -224,7 +297,10 @@ FEProjector::buildDiagonalL2MassMatrix(const std::string& system_name)
 {
     IBTK_TIMER_START(t_build_diagonal_l2_mass_matrix);
 
-    if (!d_L2_proj_matrix_diag.count(system_name))
+    // Systems with the same DOF structure share a single mass matrix.
+    const std::string& mass_system_name = getMassMatrixSystemName(system_name);
+
+    if (!d_L2_proj_matrix_diag.count(mass_system_name))
     {
         if (d_enable_logging)
         {
@@ -237,13 +313,13 @@ FEProjector::buildDiagonalL2MassMatrix(const std::string& system_name)
         const unsigned int dim = mesh.mesh_dimension();
 
         // Extract the FE system and DOF map, and setup the FE object.
-        System& system = d_fe_data->getEquationSystems()->get_system(system_name);
+        System& system = d_fe_data->getEquationSystems()->get_system(mass_system_name);
         const int sys_num = system.number();
         DofMap& dof_map = system.get_dof_map();
-        FEData::SystemDofMapCache& dof_map_cache = *d_fe_data->getDofMapCache(system_name);
+        FEData::SystemDofMapCache& dof_map_cache = *d_fe_data->getDofMapCache(mass_system_name);
         dof_map.compute_sparsity(mesh);
         FEType fe_type = dof_map.variable_type(0);
-        std::unique_ptr<QBase> qrule = fe_type.default_quadrature_rule(dim);
+        std::unique_ptr<QBase> qrule = build_mass_matrix_qrule(dof_map, dim);
         std::unique_ptr<FEBase> fe(FEBase::build(dim, fe_type));
         fe->attach_quadrature_rule(qrule.get());
         const std::vector<double>& JxW = fe->get_JxW();
@@ -341,11 +417,141 @@ FEProjector::buildDiagonalL2MassMatrix(const std::string& system_name)
         M_vec->close();
 
         // Store the diagonal mass matrix.
-        d_L2_proj_matrix_diag[system_name] = std::move(M_vec);
+        d_L2_proj_matrix_diag[mass_system_name] = std::move(M_vec);
     }
 
     IBTK_TIMER_STOP(t_build_diagonal_l2_mass_matrix);
-    return d_L2_proj_matrix_diag[system_name].get();
+    return d_L2_proj_matrix_diag[mass_system_name].get();
+}
+
+KSP
+FEProjector::buildMatrixFreeL2ProjectionSolver(const std::string& system_name)
+{
+    IBTK_TIMER_START(t_build_l2_projection_solver);
+
+    // Systems with the same DOF structure share a single mass operator.
+    const std::string& mass_system_name = getMassMatrixSystemName(system_name);
+
+    std::unique_ptr<MatrixFreeMassOperator>& op = d_L2_proj_mf_operator[mass_system_name];
+    if (!op)
+    {
+        if (d_enable_logging)
+        {
+            plog << "FEProjector::buildMatrixFreeL2ProjectionSolver(): building matrix-free L2 projection solver for "
+                    "system: "
+                 << system_name << "\n";
+        }
+
+        int ierr;
+        const MeshBase& mesh = d_fe_data->getEquationSystems()->get_mesh();
+        const unsigned int dim = mesh.mesh_dimension();
+        System& system = d_fe_data->getEquationSystems()->get_system(mass_system_name);
+        const DofMap& dof_map = system.get_dof_map();
+        const Parallel::Communicator& comm = system.comm();
+        op.reset(new MatrixFreeMassOperator());
+        op->projector = this;
+        op->system_name = mass_system_name;
+        op->x_ghost_vec.reset(static_cast<PetscVector<double>*>(system.current_local_solution->zero_clone().release()));
+
+        // Set up the quadrature rule and the FE objects that are used by every
+        // application of the operator.
+        //
+        // NOTE: FEDataInterpolation reuses the reference configuration element
+        // data stored by d_fe_data when that cache is enabled, so that repeated
+        // applications of the operator do not need to recompute the element
+        // maps.
+        op->qrule = build_mass_matrix_qrule(dof_map, dim);
+        std::vector<int> vars(dof_map.n_variables());
+        std::iota(vars.begin(), vars.end(), 0);
+        op->fe.reset(new FEDataInterpolation(dim, d_fe_data));
+        op->fe->attachQuadratureRule(op->qrule.get());
+        op->fe->evalQuadratureWeights();
+        op->fe->registerSystem(system, vars, std::vector<int>());
+        op->fe->init();
+        if (use_fe_values_batches(mesh, dof_map))
+        {
+            op->fe_values = FEValuesBase::build(dim, NDIM, op->qrule.get(), update_phi | update_JxW);
+        }
+        computeMatrixFreeMassOperatorDiagonal(*op);
+
+        // Set up the shell matrix.
+        const auto n_local = static_cast<PetscInt>(system.solution->local_size());
+        const auto n_global = static_cast<PetscInt>(system.solution->size());
+        ierr = MatCreateShell(
+            comm.get(), n_local, n_local, n_global, n_global, static_cast<void*>(op.get()), &op->M_mat);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatShellSetOperation(
+            op->M_mat, MATOP_MULT, reinterpret_cast<void (*)(void)>(FEProjector::MatVecMult_MassOperator));
+        IBTK_CHKERRQ(ierr);
+        ierr = MatShellSetOperation(
+            op->M_mat, MATOP_GET_DIAGONAL, reinterpret_cast<void (*)(void)>(FEProjector::MatGetDiagonal_MassOperator));
+        IBTK_CHKERRQ(ierr);
+
+        // Set up a Jacobi-preconditioned CG solver. The mass matrix is
+        // symmetric positive definite and is spectrally equivalent to its
+        // diagonal, so the iteration count is independent of the mesh size.
+        ierr = KSPCreate(comm.get(), &op->solver);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetOptionsPrefix(op->solver, "mf_l2_proj_");
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetOperators(op->solver, op->M_mat, op->M_mat);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetType(op->solver, KSPCG);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetInitialGuessNonzero(op->solver, PETSC_TRUE);
+        IBTK_CHKERRQ(ierr);
+        PC pc;
+        ierr = KSPGetPC(op->solver, &pc);
+        IBTK_CHKERRQ(ierr);
+        ierr = PCSetType(pc, PCJACOBI);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetReusePreconditioner(op->solver, PETSC_TRUE);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetFromOptions(op->solver);
+        IBTK_CHKERRQ(ierr);
+
+        // Runtime tolerances take precedence over those passed to
+        // computeL2Projection().
+        const char* prefix;
+        ierr = KSPGetOptionsPrefix(op->solver, &prefix);
+        IBTK_CHKERRQ(ierr);
+        PetscBool rtol_set, max_it_set;
+        ierr = PetscOptionsHasName(nullptr, prefix, "-ksp_rtol", &rtol_set);
+        IBTK_CHKERRQ(ierr);
+        ierr = PetscOptionsHasName(nullptr, prefix, "-ksp_max_it", &max_it_set);
+        IBTK_CHKERRQ(ierr);
+        op->rtol_set_from_options = rtol_set;
+        op->max_it_set_from_options = max_it_set;
+    }
+
+    IBTK_TIMER_STOP(t_build_l2_projection_solver);
+    return op->solver;
+}
+
+const std::string&
+FEProjector::getMassMatrixSystemName(const std::string& system_name)
+{
+    auto it = d_mass_matrix_system_name.find(system_name);
+    if (it != d_mass_matrix_system_name.end()) return it->second;
+
+    // Compare against the systems that own mass matrices. The map is ordered,
+    // so all processes perform the (collective) comparisons in the same order.
+    std::string mass_system_name = system_name;
+    for (const auto& pair : d_mass_matrix_system_name)
+    {
+        if (pair.first != pair.second) continue;
+        if (haveSameMassMatrix(pair.first, system_name))
+        {
+            mass_system_name = pair.first;
+            break;
+        }
+    }
+    if (d_enable_logging && mass_system_name != system_name)
+    {
+        plog << "FEProjector::getMassMatrixSystemName(): system " << system_name
+             << " uses the mass matrices of system " << mass_system_name << "\n";
+    }
+    return d_mass_matrix_system_name[system_name] = mass_system_name;
 }
 
 bool
@@ -366,7 +572,24 @@ FEProjector::computeL2Projection(PetscVector<double>& U_vec,
     if (close_F) F_vec.close();
     const System& system = d_fe_data->getEquationSystems()->get_system(system_name);
     const DofMap& dof_map = system.get_dof_map();
-    if (consistent_mass_matrix)
+    if (consistent_mass_matrix && d_use_matrix_free_mass_operator)
+    {
+        KSP solver = buildMatrixFreeL2ProjectionSolver(system_name);
+        const MatrixFreeMassOperator& op = *d_L2_proj_mf_operator[getMassMatrixSystemName(system_name)];
+        ierr = KSPSetTolerances(solver,
+                                op.rtol_set_from_options ? PETSC_DEFAULT : tol,
+                                PETSC_DEFAULT,
+                                PETSC_DEFAULT,
+                                op.max_it_set_from_options ? PETSC_DEFAULT : static_cast<PetscInt>(max_its));
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSolve(solver, F_vec.vec(), U_vec.vec());
+        IBTK_CHKERRQ(ierr);
+        KSPConvergedReason reason;
+        ierr = KSPGetConvergedReason(solver, &reason);
+        IBTK_CHKERRQ(ierr);
+        converged = reason > 0;
+    }
+    else if (consistent_mass_matrix)
     {
         std::pair<PetscLinearSolver<double>*, PetscMatrix<double>*> proj_solver_components =
             buildL2ProjectionSolver(system_name);
@@ -380,8 +603,6 @@ FEProjector::computeL2Projection(PetscVector<double>& U_vec,
         int runtime_max_it;
         ierr = PetscOptionsGetInt(nullptr, "", "-ksp_max_it", &runtime_max_it, &max_it_set);
         IBTK_CHKERRQ(ierr);
-        ierr = KSPSetFromOptions(solver->ksp());
-        IBTK_CHKERRQ(ierr);
         solver->solve(
             *M_mat, *M_mat, U_vec, F_vec, rtol_set ? runtime_rtol : tol, max_it_set ? runtime_max_it : max_its);
         KSPConvergedReason reason;
@@ -415,10 +636,368 @@ FEProjector::getLoggingEnabled() const
     return d_enable_logging;
 }
 
+void
+FEProjector::setUseMatrixFreeMassOperator(const bool use_matrix_free)
+{
+    d_use_matrix_free_mass_operator = use_matrix_free;
+}
+
+bool
+FEProjector::getUseMatrixFreeMassOperator() const
+{
+    return d_use_matrix_free_mass_operator;
+}
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+bool
+FEProjector::haveSameMassMatrix(const std::string& system_name_1, const std::string& system_name_2)
+{
+    const MeshBase& mesh = d_fe_data->getEquationSystems()->get_mesh();
+    const System& system_1 = d_fe_data->getEquationSystems()->get_system(system_name_1);
+    const System& system_2 = d_fe_data->getEquationSystems()->get_system(system_name_2);
+    const DofMap& dof_map_1 = system_1.get_dof_map();
+    const DofMap& dof_map_2 = system_2.get_dof_map();
+
+    // The variables and the parallel layout must match.
+    bool same = dof_map_1.n_variables() == dof_map_2.n_variables() && dof_map_1.n_dofs() == dof_map_2.n_dofs() &&
+                dof_map_1.first_dof() == dof_map_2.first_dof() &&
+                dof_map_1.n_local_dofs() == dof_map_2.n_local_dofs();
+    for (unsigned int var_num = 0; same && var_num < dof_map_1.n_variables(); ++var_num)
+    {
+        same = dof_map_1.variable_type(var_num) == dof_map_2.variable_type(var_num);
+    }
+
+    // The DOF numbering of the local elements must match.
+    if (same)
+    {
+        FEData::SystemDofMapCache& dof_map_cache_1 = *d_fe_data->getDofMapCache(system_name_1);
+        FEData::SystemDofMapCache& dof_map_cache_2 = *d_fe_data->getDofMapCache(system_name_2);
+        const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
+        const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
+        for (MeshBase::const_element_iterator el_it = el_begin; same && el_it != el_end; ++el_it)
+        {
+            const Elem* const elem = *el_it;
+            same = dof_map_cache_1.dof_indices(elem) == dof_map_cache_2.dof_indices(elem);
+        }
+    }
+
+    // The constraints, which are built into the mass matrices, must match.
+    if (same)
+    {
+        auto it_1 = dof_map_1.constraint_rows_begin();
+        auto it_2 = dof_map_2.constraint_rows_begin();
+        for (; same && it_1 != dof_map_1.constraint_rows_end() && it_2 != dof_map_2.constraint_rows_end();
+             ++it_1, ++it_2)
+        {
+            same = it_1->first == it_2->first && it_1->second == it_2->second;
+        }
+        same = same && it_1 == dof_map_1.constraint_rows_end() && it_2 == dof_map_2.constraint_rows_end();
+    }
+
+    mesh.comm().min(same);
+    return same;
+} // haveSameMassMatrix
+
+void
+FEProjector::applyMatrixFreeMassOperator(MatrixFreeMassOperator& op,
+                                         PetscVector<double>& x_vec,
+                                         PetscVector<double>& y_vec)
+{
+    IBTK_TIMER_START(t_apply_matrix_free_mass_operator);
+
+    // Extract the mesh.
+    const MeshBase& mesh = d_fe_data->getEquationSystems()->get_mesh();
+
+    // Extract the FE system and DOF map. The quadrature rule and FE objects
+    // are set up once by buildMatrixFreeL2ProjectionSolver().
+    const System& system = d_fe_data->getEquationSystems()->get_system(op.system_name);
+    const DofMap& dof_map = system.get_dof_map();
+    FEData::SystemDofMapCache& dof_map_cache = *d_fe_data->getDofMapCache(op.system_name);
+    const QBase& qrule = *op.qrule;
+    FEDataInterpolation& fe = *op.fe;
+
+    // Set up the ghosted input vector, eliminating any constrained DOFs so
+    // that we compute the action of C^T M C.
+    PetscVector<double>& x_ghost_vec = *op.x_ghost_vec;
+    copy_and_synch(x_vec, x_ghost_vec, /*close_v_in*/ false);
+    dof_map.enforce_constraints_exactly(system, &x_ghost_vec, /*homogeneous*/ true);
+
+    // Loop over the elements and apply the element mass matrices at the
+    // quadrature points: for each variable, this costs O(n_basis * n_qp)
+    // operations per element instead of the O(n_basis^2 * n_qp) required to
+    // form the element mass matrix.
+    //
+    // When the element data are not cached and all variables have the same FE
+    // type, elements of the same type are processed in batches by
+    // IBTK::FEValues so that the quadrature loops vectorize across the
+    // elements of each batch.
+    y_vec.zero();
+    std::vector<double> x_e, x_qp;
+    DenseVector<double> y_e;
+    std::vector<libMesh::dof_id_type> dof_id_scratch;
+    const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
+    const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
+    if (!d_fe_data->getUseReferenceQuadratureCache() && op.fe_values)
+    {
+        constexpr unsigned int B = FEValuesBase::batch_size;
+        FEValuesBase& fe_values = *op.fe_values;
+        std::vector<const Elem*> batch_elems;
+        batch_elems.reserve(B);
+        std::vector<double> x_batch, x_qp_batch, y_batch;
+        auto apply_batch = [&]() {
+            const auto n_elems = static_cast<unsigned int>(batch_elems.size());
+            fe_values.reinitBatch(batch_elems.data(), n_elems);
+            const std::vector<double>& JxW_batch = fe_values.getBatchJxW();
+            const std::vector<std::vector<double> >& phi_batch = fe_values.getShapeValues();
+            const size_t n_basis = phi_batch.size();
+            const unsigned int n_qp = qrule.n_points();
+            for (unsigned int var_num = 0; var_num < dof_map.n_variables(); ++var_num)
+            {
+                x_batch.assign(n_basis * B, 0.0);
+                for (unsigned int e = 0; e < n_elems; ++e)
+                {
+                    x_e.resize(n_basis);
+                    x_ghost_vec.get(dof_map_cache.dof_indices(batch_elems[e])[var_num], x_e);
+                    for (unsigned int j = 0; j < n_basis; ++j) x_batch[j * B + e] = x_e[j];
+                }
+                x_qp_batch.assign(n_qp * B, 0.0);
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    double* const x_qp_e = &x_qp_batch[qp * B];
+                    for (unsigned int j = 0; j < n_basis; ++j)
+                    {
+                        const double phi = phi_batch[j][qp];
+                        const double* const x_j = &x_batch[j * B];
+                        for (unsigned int e = 0; e < B; ++e) x_qp_e[e] += phi * x_j[e];
+                    }
+                    for (unsigned int e = 0; e < B; ++e) x_qp_e[e] *= JxW_batch[qp * B + e];
+                }
+                y_batch.assign(n_basis * B, 0.0);
+                for (unsigned int i = 0; i < n_basis; ++i)
+                {
+                    double* const y_i = &y_batch[i * B];
+                    for (unsigned int qp = 0; qp < n_qp; ++qp)
+                    {
+                        const double phi = phi_batch[i][qp];
+                        const double* const x_qp_e = &x_qp_batch[qp * B];
+                        for (unsigned int e = 0; e < B; ++e) y_i[e] += phi * x_qp_e[e];
+                    }
+                }
+                for (unsigned int e = 0; e < n_elems; ++e)
+                {
+                    y_e.resize(static_cast<unsigned int>(n_basis));
+                    for (unsigned int i = 0; i < n_basis; ++i) y_e(i) = y_batch[i * B + e];
+                    dof_id_scratch = dof_map_cache.dof_indices(batch_elems[e])[var_num];
+                    dof_map.constrain_element_vector(y_e, dof_id_scratch);
+                    y_vec.add_vector(y_e, dof_id_scratch);
+                }
+            }
+            batch_elems.clear();
+        };
+        for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+        {
+            const Elem* const elem = *el_it;
+            if (!batch_elems.empty() && (batch_elems.size() == B || elem->type() != batch_elems[0]->type()))
+            {
+                apply_batch();
+            }
+            batch_elems.push_back(elem);
+        }
+        if (!batch_elems.empty()) apply_batch();
+    }
+    else
+    {
+        for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+        {
+            const Elem* const elem = *el_it;
+            fe.reinit(elem);
+            const std::vector<double>& JxW = fe.getQuadratureWeights();
+            const auto& dof_indices = dof_map_cache.dof_indices(elem);
+            const unsigned int n_qp = qrule.n_points();
+            x_qp.resize(n_qp);
+            for (unsigned int var_num = 0; var_num < dof_map.n_variables(); ++var_num)
+            {
+                const std::vector<std::vector<double> >& phi = fe.getPhi(dof_map.variable_type(var_num));
+                const size_t n_basis = phi.size();
+                const auto& dof_indices_var = dof_indices[var_num];
+                x_e.resize(n_basis);
+                x_ghost_vec.get(dof_indices_var, x_e);
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    x_qp[qp] = 0.0;
+                    for (unsigned int j = 0; j < n_basis; ++j)
+                    {
+                        x_qp[qp] += phi[j][qp] * x_e[j];
+                    }
+                    x_qp[qp] *= JxW[qp];
+                }
+                y_e.resize(static_cast<unsigned int>(n_basis));
+                for (unsigned int i = 0; i < n_basis; ++i)
+                {
+                    for (unsigned int qp = 0; qp < n_qp; ++qp)
+                    {
+                        y_e(i) += phi[i][qp] * x_qp[qp];
+                    }
+                }
+                dof_id_scratch = dof_indices_var;
+                dof_map.constrain_element_vector(y_e, dof_id_scratch);
+                y_vec.add_vector(y_e, dof_id_scratch);
+            }
+        }
+    }
+    y_vec.close();
+
+    // As in the assembled mass matrix, constrained DOFs are given unit
+    // diagonal entries.
+    const libMesh::dof_id_type first_local_dof = dof_map.first_dof();
+    const libMesh::dof_id_type end_local_dof = dof_map.end_dof();
+    for (auto i = dof_map.constraint_rows_begin(); i != dof_map.constraint_rows_end(); ++i)
+    {
+        const libMesh::dof_id_type constrained_dof = i->first;
+        if (constrained_dof >= first_local_dof && constrained_dof < end_local_dof)
+        {
+            y_vec.set(constrained_dof, x_vec(constrained_dof));
+        }
+    }
+    y_vec.close();
+
+    IBTK_TIMER_STOP(t_apply_matrix_free_mass_operator);
+    return;
+}
+
+void
+FEProjector::computeMatrixFreeMassOperatorDiagonal(MatrixFreeMassOperator& op)
+{
+    // Extract the mesh.
+    const MeshBase& mesh = d_fe_data->getEquationSystems()->get_mesh();
+    const unsigned int dim = mesh.mesh_dimension();
+
+    // Extract the FE system and DOF map, and set up one FE object for each
+    // distinct FE type of the system, using the quadrature rule of the
+    // operator.
+    System& system = d_fe_data->getEquationSystems()->get_system(op.system_name);
+    const DofMap& dof_map = system.get_dof_map();
+    FEData::SystemDofMapCache& dof_map_cache = *d_fe_data->getDofMapCache(op.system_name);
+    const QBase& qrule = *op.qrule;
+    std::map<FEType, std::unique_ptr<FEBase> > fe_map;
+    for (unsigned int var_num = 0; var_num < dof_map.n_variables(); ++var_num)
+    {
+        const FEType& fe_type = dof_map.variable_type(var_num);
+        std::unique_ptr<FEBase>& fe = fe_map[fe_type];
+        if (fe) continue;
+        fe = FEBase::build(dim, fe_type);
+        fe->attach_quadrature_rule(op.qrule.get());
+        fe->get_JxW();
+        fe->get_phi();
+    }
+
+    // Accumulate the diagonal entries of the element mass matrices. Entries
+    // corresponding to constrained DOFs are reset below.
+    op.M_diag_vec.reset(static_cast<PetscVector<double>*>(system.solution->zero_clone().release()));
+    PetscVector<double>& M_diag_vec = *op.M_diag_vec;
+    DenseVector<double> M_e_diag;
+    const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
+    const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
+    for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+    {
+        const Elem* const elem = *el_it;
+        for (const auto& pair : fe_map) pair.second->reinit(elem);
+        const auto& dof_indices = dof_map_cache.dof_indices(elem);
+        const unsigned int n_qp = qrule.n_points();
+        for (unsigned int var_num = 0; var_num < dof_map.n_variables(); ++var_num)
+        {
+            const FEBase& fe = *fe_map[dof_map.variable_type(var_num)];
+            const std::vector<double>& JxW = fe.get_JxW();
+            const std::vector<std::vector<double> >& phi = fe.get_phi();
+            const size_t n_basis = phi.size();
+            M_e_diag.resize(static_cast<unsigned int>(n_basis));
+            for (unsigned int i = 0; i < n_basis; ++i)
+            {
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    M_e_diag(i) += phi[i][qp] * phi[i][qp] * JxW[qp];
+                }
+            }
+            M_diag_vec.add_vector(M_e_diag, dof_indices[var_num]);
+        }
+    }
+    M_diag_vec.close();
+
+    const libMesh::dof_id_type first_local_dof = dof_map.first_dof();
+    const libMesh::dof_id_type end_local_dof = dof_map.end_dof();
+    for (auto i = dof_map.constraint_rows_begin(); i != dof_map.constraint_rows_end(); ++i)
+    {
+        const libMesh::dof_id_type constrained_dof = i->first;
+        if (constrained_dof >= first_local_dof && constrained_dof < end_local_dof)
+        {
+            M_diag_vec.set(constrained_dof, 1.0);
+        }
+    }
+    M_diag_vec.close();
+    return;
+}
+
+PetscErrorCode
+FEProjector::MatVecMult_MassOperator(Mat A, Vec x, Vec y)
+{
+    void* p_ctx;
+    int ierr = MatShellGetContext(A, &p_ctx);
+    CHKERRQ(ierr);
+    auto op = static_cast<MatrixFreeMassOperator*>(p_ctx);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(op);
+    TBOX_ASSERT(op->projector);
+#endif
+    const Parallel::Communicator& comm = op->projector->d_fe_data->getEquationSystems()->comm();
+    PetscVector<double> x_vec(x, comm);
+    PetscVector<double> y_vec(y, comm);
+    op->projector->applyMatrixFreeMassOperator(*op, x_vec, y_vec);
+    PetscFunctionReturn(0);
+} // MatVecMult_MassOperator
+
+PetscErrorCode
+FEProjector::MatGetDiagonal_MassOperator(Mat A, Vec d)
+{
+    void* p_ctx;
+    int ierr = MatShellGetContext(A, &p_ctx);
+    CHKERRQ(ierr);
+    auto op = static_cast<MatrixFreeMassOperator*>(p_ctx);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(op);
+    TBOX_ASSERT(op->M_diag_vec);
+#endif
+    ierr = VecCopy(op->M_diag_vec->vec(), d);
+    CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+} // MatGetDiagonal_MassOperator
+
+std::size_t
+FEProjector::getMemoryUsage() const
+{
+    std::size_t bytes = 0;
+    for (const auto& pair : d_L2_proj_matrix)
+    {
+        if (pair.second->initialized()) bytes += MemoryMonitor::getMatMemory(pair.second->mat());
+    }
+    for (const auto& pair : d_L2_proj_matrix_diag)
+    {
+        if (pair.second->initialized()) bytes += MemoryMonitor::getVecMemory(pair.second->vec());
+    }
+    for (const auto& pair : d_L2_proj_mf_operator)
+    {
+        const MatrixFreeMassOperator& op = *pair.second;
+        if (op.M_diag_vec && op.M_diag_vec->initialized()) bytes += MemoryMonitor::getVecMemory(op.M_diag_vec->vec());
+        if (op.x_ghost_vec && op.x_ghost_vec->initialized())
+        {
+            bytes += MemoryMonitor::getVecMemory(op.x_ghost_vec->vec());
+        }
+    }
+    return bytes;
+} // getMemoryUsage
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
@@ -31,7 +31,10 @@
 #include <libmesh/point.h>
 #include <libmesh/quadrature.h>
 
+#include <algorithm>
+#include <cmath>
 #include <map>
+#include <memory>
 #include <vector>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -40,8 +43,146 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Evaluate the one-dimensional Lagrange polynomial associated with node i or its derivative.
+double
+lagrange_1d(const std::vector<double>& nodes, const unsigned int i, const double x)
+{
+    double val = 1.0;
+    for (unsigned int j = 0; j < nodes.size(); ++j)
+    {
+        if (j != i) val *= (x - nodes[j]) / (nodes[i] - nodes[j]);
+    }
+    return val;
+} // lagrange_1d
+
+double
+lagrange_1d_derivative(const std::vector<double>& nodes, const unsigned int i, const double x)
+{
+    double deriv = 0.0;
+    for (unsigned int l = 0; l < nodes.size(); ++l)
+    {
+        if (l == i) continue;
+        double val = 1.0 / (nodes[i] - nodes[l]);
+        for (unsigned int j = 0; j < nodes.size(); ++j)
+        {
+            if (j != i && j != l) val *= (x - nodes[j]) / (nodes[i] - nodes[j]);
+        }
+        deriv += val;
+    }
+    return deriv;
+} // lagrange_1d_derivative
+
+// Apply the one-dimensional operator B, indexed by input index (of n) and then by output index (of m), along one
+// direction of a tensor stored with the first direction varying fastest.  The directions before the contracted one
+// have total size inner and those after it have total size outer.
+void
+contract_1d(const double* const in,
+            double* const out,
+            const double* const B,
+            const unsigned int n,
+            const unsigned int m,
+            const unsigned int inner,
+            const unsigned int outer)
+{
+    for (unsigned int o = 0; o < outer; ++o)
+    {
+        for (unsigned int a = 0; a < m; ++a)
+        {
+            double* const out_row = out + (o * m + a) * inner;
+            std::fill(out_row, out_row + inner, 0.0);
+            for (unsigned int i = 0; i < n; ++i)
+            {
+                const double b = B[i * m + a];
+                const double* const in_row = in + (o * n + i) * inner;
+                for (unsigned int r = 0; r < inner; ++r) out_row[r] += b * in_row[r];
+            }
+        }
+    }
+    return;
+} // contract_1d
+
+// Compute the inverses and determinants of a batch of Jacobians.
+using BatchMatrix1 = double[1][1][FEValuesBase::batch_size];
+using BatchMatrix2 = double[2][2][FEValuesBase::batch_size];
+using BatchMatrix3 = double[3][3][FEValuesBase::batch_size];
+using BatchScalar = double[FEValuesBase::batch_size];
+
+void
+invert_batch(const BatchMatrix1& J, BatchMatrix1& J_inv, BatchScalar& det)
+{
+    for (unsigned int e = 0; e < FEValuesBase::batch_size; ++e)
+    {
+        det[e] = J[0][0][e];
+        J_inv[0][0][e] = 1.0 / det[e];
+    }
+    return;
+} // invert_batch
+
+void
+invert_batch(const BatchMatrix2& J, BatchMatrix2& J_inv, BatchScalar& det)
+{
+    for (unsigned int e = 0; e < FEValuesBase::batch_size; ++e)
+    {
+        det[e] = J[0][0][e] * J[1][1][e] - J[0][1][e] * J[1][0][e];
+        const double det_inv = 1.0 / det[e];
+        J_inv[0][0][e] = J[1][1][e] * det_inv;
+        J_inv[0][1][e] = -J[0][1][e] * det_inv;
+        J_inv[1][0][e] = -J[1][0][e] * det_inv;
+        J_inv[1][1][e] = J[0][0][e] * det_inv;
+    }
+    return;
+} // invert_batch
+
+void
+invert_batch(const BatchMatrix3& J, BatchMatrix3& J_inv, BatchScalar& det)
+{
+    for (unsigned int e = 0; e < FEValuesBase::batch_size; ++e)
+    {
+        const double c00 = J[1][1][e] * J[2][2][e] - J[1][2][e] * J[2][1][e];
+        const double c01 = J[1][2][e] * J[2][0][e] - J[1][0][e] * J[2][2][e];
+        const double c02 = J[1][0][e] * J[2][1][e] - J[1][1][e] * J[2][0][e];
+        det[e] = J[0][0][e] * c00 + J[0][1][e] * c01 + J[0][2][e] * c02;
+        const double det_inv = 1.0 / det[e];
+        J_inv[0][0][e] = c00 * det_inv;
+        J_inv[1][0][e] = c01 * det_inv;
+        J_inv[2][0][e] = c02 * det_inv;
+        J_inv[0][1][e] = (J[0][2][e] * J[2][1][e] - J[0][1][e] * J[2][2][e]) * det_inv;
+        J_inv[1][1][e] = (J[0][0][e] * J[2][2][e] - J[0][2][e] * J[2][0][e]) * det_inv;
+        J_inv[2][1][e] = (J[0][1][e] * J[2][0][e] - J[0][0][e] * J[2][1][e]) * det_inv;
+        J_inv[0][2][e] = (J[0][1][e] * J[1][2][e] - J[0][2][e] * J[1][1][e]) * det_inv;
+        J_inv[1][2][e] = (J[0][2][e] * J[1][0][e] - J[0][0][e] * J[1][2][e]) * det_inv;
+        J_inv[2][2][e] = (J[0][0][e] * J[1][1][e] - J[0][1][e] * J[1][0][e]) * det_inv;
+    }
+    return;
+} // invert_batch
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
+constexpr unsigned int FEValuesBase::batch_size;
+
+bool
+FEValuesBase::isIsoparametricLagrange(const libMesh::FEType& fe_type, const libMesh::ElemType elem_type)
+{
+    if (fe_type.family != libMesh::LAGRANGE) return false;
+    switch (elem_type)
+    {
+    case libMesh::TRI3:
+    case libMesh::TRI6:
+    case libMesh::QUAD4:
+    case libMesh::QUAD9:
+    case libMesh::TET4:
+    case libMesh::TET10:
+    case libMesh::HEX8:
+    case libMesh::HEX27:
+        return fe_type.order.get_order() == static_cast<int>(get_default_order(elem_type));
+    default:
+        return false;
+    }
+}
+
 std::unique_ptr<FEValuesBase>
 FEValuesBase::build(const int dim, const int spacedim, libMesh::QBase* qrule, const FEUpdateFlags update_flags)
 {
@@ -126,6 +267,7 @@ FEValues<dim, spacedim>::reinit(const libMesh::Elem* elem)
     }
     Mapping<dim, spacedim>& mapping = *map_iter->second;
     mapping.reinit(elem);
+    d_current_mapping = &mapping;
 
     if (d_update_flags & update_JxW)
     {
@@ -139,25 +281,7 @@ FEValues<dim, spacedim>::reinit(const libMesh::Elem* elem)
     //
     // update shape function quantities:
     //
-    auto ref_iter = d_reference_values.find(elem_type);
-    if (ref_iter == d_reference_values.end())
-    {
-        ref_iter = d_reference_values.insert(ref_iter, { elem_type, *d_qrule });
-    }
-    const ReferenceValues& ref_values = ref_iter->second;
-
-    if (d_last_elem_type != elem_type && d_update_flags & update_phi)
-    {
-        const boost::multi_array<double, 2>& ref_shape_values = ref_values.d_reference_shape_values;
-        d_shape_values.resize(ref_shape_values.shape()[0]);
-        for (unsigned int i = 0; i < d_shape_values.size(); ++i)
-        {
-            d_shape_values[i].resize(0);
-            d_shape_values[i].insert(d_shape_values[i].begin(),
-                                     &ref_shape_values[i][0],
-                                     &ref_shape_values[i][0] + ref_shape_values.shape()[1]);
-        }
-    }
+    const ReferenceValues& ref_values = updateReferenceValues(elem_type);
 
     if (d_update_flags & update_dphi)
     {
@@ -190,8 +314,219 @@ FEValues<dim, spacedim>::reinit(const libMesh::Elem* elem)
     d_last_elem_type = elem_type;
 }
 
+template <int dim, int spacedim>
+void
+FEValues<dim, spacedim>::reinitBatch(const libMesh::Elem* const* const elems, const unsigned int n_elems)
+{
+    constexpr unsigned int B = FEValuesBase::batch_size;
+    TBOX_ASSERT(n_elems > 0 && n_elems <= B);
+    if (dim != spacedim)
+    {
+        TBOX_ERROR("FEValues::reinitBatch():\n"
+                   << "  batched evaluation is only implemented for dim == spacedim" << std::endl);
+    }
+    const libMesh::ElemType elem_type = elems[0]->type();
+    for (unsigned int e = 0; e < n_elems; ++e)
+    {
+        TBOX_ASSERT(elems[e]->type() == elem_type);
+        TBOX_ASSERT(elems[e]->p_level() == 0);
+    }
+    if (elem_type != d_last_elem_type)
+    {
+        d_qrule->init(elem_type, 0);
+    }
+    const ReferenceValues& ref_values = updateReferenceValues(elem_type);
+    d_current_mapping = nullptr;
+    d_tensor_product = false;
+    const boost::multi_array<double, 2>& ref_shape_values = ref_values.d_reference_shape_values;
+    const boost::multi_array<libMesh::VectorValue<double>, 2>& ref_shape_gradients =
+        ref_values.d_reference_shape_gradients;
+    const auto n_nodes = static_cast<unsigned int>(ref_shape_values.shape()[0]);
+    const auto n_qp = static_cast<unsigned int>(ref_shape_values.shape()[1]);
+
+    // Gather the nodal coordinates.  Unused lanes repeat the last element so
+    // that every lane has a valid geometry.
+    d_batch_nodes.resize(n_nodes * dim * B);
+    for (unsigned int e = 0; e < B; ++e)
+    {
+        const libMesh::Elem* const elem = elems[std::min(e, n_elems - 1)];
+        for (unsigned int i = 0; i < n_nodes; ++i)
+        {
+            const libMesh::Point& X = elem->point(i);
+            for (unsigned int d = 0; d < dim; ++d) d_batch_nodes[(i * dim + d) * B + e] = X(d);
+        }
+    }
+
+    const bool update_JxW_values = d_update_flags & update_JxW;
+    const bool update_points = d_update_flags & update_quadrature_points;
+    const bool update_gradients = d_update_flags & update_dphi;
+    if (update_JxW_values) d_batch_JxW.resize(n_qp * B);
+    if (update_points) d_batch_quadrature_points.resize(n_qp * dim * B);
+    if (update_gradients) d_batch_shape_gradients.resize(n_nodes * n_qp * dim * B);
+    for (unsigned int q = 0; q < n_qp; ++q)
+    {
+        // Compute the Jacobians of all elements of the batch at once.
+        double J[dim][dim][B] = {};
+        for (unsigned int i = 0; i < n_nodes; ++i)
+        {
+            for (unsigned int c = 0; c < dim; ++c)
+            {
+                const double g = ref_shape_gradients[i][q](c);
+                for (unsigned int r = 0; r < dim; ++r)
+                {
+                    const double* const X = &d_batch_nodes[(i * dim + r) * B];
+                    for (unsigned int e = 0; e < B; ++e) J[r][c][e] += X[e] * g;
+                }
+            }
+        }
+        double J_inv[dim][dim][B], det[B];
+        invert_batch(J, J_inv, det);
+
+        if (update_JxW_values)
+        {
+            const double w = d_qrule->w(q);
+            for (unsigned int e = 0; e < B; ++e) d_batch_JxW[q * B + e] = det[e] * w;
+        }
+        if (update_points)
+        {
+            for (unsigned int d = 0; d < dim; ++d)
+            {
+                double* const x = &d_batch_quadrature_points[(q * dim + d) * B];
+                std::fill(x, x + B, 0.0);
+                for (unsigned int i = 0; i < n_nodes; ++i)
+                {
+                    const double phi = ref_shape_values[i][q];
+                    const double* const X = &d_batch_nodes[(i * dim + d) * B];
+                    for (unsigned int e = 0; e < B; ++e) x[e] += phi * X[e];
+                }
+            }
+        }
+        if (update_gradients)
+        {
+            // The physical gradients are J^{-T} times the reference gradients.
+            for (unsigned int i = 0; i < n_nodes; ++i)
+            {
+                for (unsigned int d = 0; d < dim; ++d)
+                {
+                    double* const grad = &d_batch_shape_gradients[((i * n_qp + q) * dim + d) * B];
+                    std::fill(grad, grad + B, 0.0);
+                    for (unsigned int c = 0; c < dim; ++c)
+                    {
+                        const double g = ref_shape_gradients[i][q](c);
+                        for (unsigned int e = 0; e < B; ++e) grad[e] += J_inv[c][d][e] * g;
+                    }
+                }
+            }
+        }
+    }
+
+    d_last_elem_type = elem_type;
+    return;
+}
+
+template <int dim, int spacedim>
+void
+FEValues<dim, spacedim>::interpolateTensorProduct(const boost::multi_array<double, 2>& elem_data,
+                                                  const unsigned int var,
+                                                  std::vector<double>* const values,
+                                                  std::vector<libMesh::VectorValue<double> >* const gradients)
+{
+    TBOX_ASSERT(d_tensor_product && d_current_reference_values);
+    TBOX_ASSERT(!gradients || (d_update_flags & update_covariants));
+    const ReferenceValues& ref_values = *d_current_reference_values;
+    const unsigned int n = ref_values.d_n_nodes_1d;
+    const unsigned int m = ref_values.d_n_qp_1d;
+    const auto n_nodes = static_cast<unsigned int>(ref_values.d_lexicographic_nodes.size());
+    unsigned int n_qp = 1, work_size = 1;
+    for (unsigned int d = 0; d < dim; ++d)
+    {
+        n_qp *= m;
+        work_size *= std::max(n, m);
+    }
+    d_tp_work_a.resize(work_size);
+    d_tp_work_b.resize(work_size);
+
+    // Contract the nodal values (in lexicographic order) with one-dimensional operators one direction at a time.  The
+    // result is indexed lexicographically by quadrature point, which is the ordering of tensor-product quadrature
+    // rules.
+    const double* const phi_1d = ref_values.d_shape_values_1d.data();
+    const double* const dphi_1d = ref_values.d_shape_derivatives_1d.data();
+    auto evaluate = [&](const int deriv_dir, double* const result) {
+        for (unsigned int k = 0; k < n_nodes; ++k)
+        {
+            d_tp_work_a[k] = elem_data[ref_values.d_lexicographic_nodes[k]][var];
+        }
+        unsigned int inner = 1, outer = n_nodes / n;
+        for (int d = 0; d < dim; ++d)
+        {
+            contract_1d(
+                d_tp_work_a.data(), d_tp_work_b.data(), d == deriv_dir ? dphi_1d : phi_1d, n, m, inner, outer);
+            std::swap(d_tp_work_a, d_tp_work_b);
+            inner *= m;
+            outer /= n;
+        }
+        std::copy(d_tp_work_a.begin(), d_tp_work_a.begin() + n_qp, result);
+    };
+
+    if (values)
+    {
+        values->resize(n_qp);
+        evaluate(-1, values->data());
+    }
+    if (gradients)
+    {
+        // Compute the reference gradients and map them to the current element.
+        d_tp_ref_gradients.resize(dim * n_qp);
+        for (int d = 0; d < dim; ++d) evaluate(d, &d_tp_ref_gradients[d * n_qp]);
+        const EigenAlignedVector<Eigen::Matrix<double, spacedim, dim> >& covariants =
+            d_current_mapping->getCovariants();
+        gradients->resize(n_qp);
+        for (unsigned int q = 0; q < n_qp; ++q)
+        {
+            libMesh::VectorValue<double>& grad = (*gradients)[q];
+            grad.zero();
+            for (unsigned int s = 0; s < spacedim; ++s)
+            {
+                for (unsigned int d = 0; d < dim; ++d)
+                {
+                    grad(s) += covariants[q](s, d) * d_tp_ref_gradients[d * n_qp + q];
+                }
+            }
+        }
+    }
+    return;
+}
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+template <int dim, int spacedim>
+const typename FEValues<dim, spacedim>::ReferenceValues&
+FEValues<dim, spacedim>::updateReferenceValues(const libMesh::ElemType elem_type)
+{
+    auto ref_iter = d_reference_values.find(elem_type);
+    if (ref_iter == d_reference_values.end())
+    {
+        ref_iter = d_reference_values.insert(ref_iter, { elem_type, *d_qrule });
+    }
+    const ReferenceValues& ref_values = ref_iter->second;
+    d_current_reference_values = &ref_values;
+    d_tensor_product = ref_values.d_tensor_product;
+
+    if (d_last_elem_type != elem_type && d_update_flags & update_phi)
+    {
+        const boost::multi_array<double, 2>& ref_shape_values = ref_values.d_reference_shape_values;
+        d_shape_values.resize(ref_shape_values.shape()[0]);
+        for (unsigned int i = 0; i < d_shape_values.size(); ++i)
+        {
+            d_shape_values[i].resize(0);
+            d_shape_values[i].insert(d_shape_values[i].begin(),
+                                     &ref_shape_values[i][0],
+                                     &ref_shape_values[i][0] + ref_shape_values.shape()[1]);
+        }
+    }
+    return ref_values;
+}
+
 template <int dim, int spacedim>
 FEValues<dim, spacedim>::ReferenceValues::ReferenceValues(const libMesh::QBase& quadrature)
     : d_elem_type(quadrature.get_elem_type())
@@ -225,6 +560,96 @@ FEValues<dim, spacedim>::ReferenceValues::ReferenceValues(const libMesh::QBase&
             }
         }
     }
+
+    // sum factorization data:
+    if (d_elem_type == libMesh::QUAD4 || d_elem_type == libMesh::QUAD9 || d_elem_type == libMesh::HEX8 ||
+        d_elem_type == libMesh::HEX27)
+    {
+        setupTensorProduct(quadrature, order);
+    }
+}
+
+template <int dim, int spacedim>
+void
+FEValues<dim, spacedim>::ReferenceValues::setupTensorProduct(const libMesh::QBase& quadrature,
+                                                             const libMesh::Order order)
+{
+    using FE = libMesh::FE<dim, libMesh::LAGRANGE>;
+    const double tol = 1.0e-10;
+    const std::vector<double> nodes_1d =
+        order == libMesh::FIRST ? std::vector<double>{ -1.0, 1.0 } : std::vector<double>{ -1.0, 0.0, 1.0 };
+    const auto n = static_cast<unsigned int>(nodes_1d.size());
+
+    // Check that the quadrature rule is the tensor product of the corresponding one-dimensional rule, with the
+    // first coordinate varying fastest.
+    std::unique_ptr<libMesh::QBase> quadrature_1d = libMesh::QBase::build(quadrature.type(), 1, quadrature.get_order());
+    quadrature_1d->init(libMesh::EDGE2);
+    const unsigned int m = quadrature_1d->n_points();
+    unsigned int n_qp = 1, n_nodes = 1;
+    for (unsigned int d = 0; d < dim; ++d)
+    {
+        n_qp *= m;
+        n_nodes *= n;
+    }
+    if (quadrature.n_points() != n_qp || d_reference_shape_values.shape()[0] != n_nodes) return;
+    for (unsigned int q = 0; q < n_qp; ++q)
+    {
+        for (unsigned int d = 0, stride = 1; d < dim; ++d, stride *= m)
+        {
+            const unsigned int a = (q / stride) % m;
+            if (std::abs(quadrature.qp(q)(d) - quadrature_1d->qp(a)(0)) > tol) return;
+        }
+    }
+
+    // Determine the node numbers in lexicographic order.
+    d_lexicographic_nodes.resize(n_nodes);
+    for (unsigned int k = 0; k < n_nodes; ++k)
+    {
+        libMesh::Point p;
+        for (unsigned int d = 0, stride = 1; d < dim; ++d, stride *= n) p(d) = nodes_1d[(k / stride) % n];
+        bool found = false;
+        for (unsigned int node_n = 0; node_n < n_nodes && !found; ++node_n)
+        {
+            if (std::abs(FE::shape(d_elem_type, order, node_n, p) - 1.0) < tol)
+            {
+                d_lexicographic_nodes[k] = node_n;
+                found = true;
+            }
+        }
+        if (!found) return;
+    }
+
+    // Tabulate the one-dimensional shape functions.
+    d_shape_values_1d.resize(n * m);
+    d_shape_derivatives_1d.resize(n * m);
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        for (unsigned int a = 0; a < m; ++a)
+        {
+            const double x = quadrature_1d->qp(a)(0);
+            d_shape_values_1d[i * m + a] = lagrange_1d(nodes_1d, i, x);
+            d_shape_derivatives_1d[i * m + a] = lagrange_1d_derivative(nodes_1d, i, x);
+        }
+    }
+
+    // Make sure that the tensor-product basis reproduces the libMesh shape functions.
+    for (unsigned int k = 0; k < n_nodes; ++k)
+    {
+        for (unsigned int q = 0; q < n_qp; ++q)
+        {
+            double val = 1.0;
+            for (unsigned int d = 0, node_stride = 1, qp_stride = 1; d < dim; ++d, node_stride *= n, qp_stride *= m)
+            {
+                val *= d_shape_values_1d[((k / node_stride) % n) * m + (q / qp_stride) % m];
+            }
+            if (std::abs(val - d_reference_shape_values[d_lexicographic_nodes[k]][q]) > tol) return;
+        }
+    }
+
+    d_n_nodes_1d = n;
+    d_n_qp_1d = m;
+    d_tensor_product = true;
+    return;
 }
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -29,6 +29,8 @@ IBTK_DISABLE_EXTRA_WARNINGS
 IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <algorithm>
+#include <map>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
@@ -39,6 +41,22 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// The communicator of the processes that share memory with this process,
+// which is created the first time it is needed.
+MPI_Comm
+get_shared_memory_comm()
+{
+    static MPI_Comm shared_memory_comm = MPI_COMM_NULL;
+    if (shared_memory_comm == MPI_COMM_NULL)
+    {
+        MPI_Comm_split_type(PETSC_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &shared_memory_comm);
+    }
+    return shared_memory_comm;
+} // get_shared_memory_comm
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 LData::LData(std::string name,
@@ -133,6 +151,7 @@ LData::LData(Pointer<Database> db) : d_name(db->getString("d_name")), d_depth(db
 LData::~LData()
 {
     restoreArrays();
+    clearSharedMemoryGhostUpdate();
     if (d_managing_petsc_vec)
     {
         const int ierr = VecDestroy(&d_global_vec);
@@ -145,6 +164,7 @@ void
 LData::resetData(Vec vec, const std::vector<int>& nonlocal_petsc_indices, const bool manage_petsc_vec)
 {
     restoreArrays();
+    clearSharedMemoryGhostUpdate();
     int ierr;
     if (d_managing_petsc_vec)
     {
@@ -184,6 +204,14 @@ LData::resetData(Vec vec, const std::vector<int>& nonlocal_petsc_indices, const
     return;
 } // resetData
 
+void
+LData::setUseSharedMemoryGhostUpdate(const bool use_shared_memory_ghost_update)
+{
+    if (!use_shared_memory_ghost_update) clearSharedMemoryGhostUpdate();
+    d_use_shared_memory_ghost_update = use_shared_memory_ghost_update;
+    return;
+} // setUseSharedMemoryGhostUpdate
+
 void
 LData::putToDatabase(Pointer<Database> db)
 {
@@ -213,6 +241,175 @@ LData::putToDatabase(Pointer<Database> db)
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+LData::setupSharedMemoryGhostUpdate()
+{
+    int ierr;
+    MPI_Comm shared_memory_comm = get_shared_memory_comm();
+    const int num_local_vals = d_depth * d_local_node_count;
+    MPI_Win_allocate_shared(static_cast<MPI_Aint>(num_local_vals * sizeof(double)),
+                            sizeof(double),
+                            MPI_INFO_NULL,
+                            shared_memory_comm,
+                            &d_shared_memory_array,
+                            &d_shared_memory_win);
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, d_shared_memory_win);
+
+    // Determine the rank in the shared-memory communicator of each process, or
+    // MPI_UNDEFINED for processes on other nodes.
+    int nprocs;
+    MPI_Comm_size(PETSC_COMM_WORLD, &nprocs);
+    std::vector<int> ranks(nprocs), shared_memory_ranks(nprocs);
+    std::iota(ranks.begin(), ranks.end(), 0);
+    MPI_Group group, shared_memory_group;
+    MPI_Comm_group(PETSC_COMM_WORLD, &group);
+    MPI_Comm_group(shared_memory_comm, &shared_memory_group);
+    MPI_Group_translate_ranks(group, nprocs, ranks.data(), shared_memory_group, shared_memory_ranks.data());
+    MPI_Group_free(&group);
+    MPI_Group_free(&shared_memory_group);
+
+    // Sort the ghost nodes by whether their owners are on this node.
+    const PetscInt* ownership_ranges;
+    ierr = VecGetOwnershipRanges(d_global_vec, &ownership_ranges);
+    IBTK_CHKERRQ(ierr);
+    std::map<int, const double*> segments;
+    std::vector<PetscInt> off_node_idxs, off_node_local_idxs;
+    d_on_node_ghost_srcs.clear();
+    for (unsigned int k = 0; k < d_ghost_node_count; ++k)
+    {
+        const PetscInt idx = d_nonlocal_petsc_indices[k];
+        const PetscInt val_idx = static_cast<PetscInt>(d_depth) * idx;
+        const auto owner = std::upper_bound(ownership_ranges, ownership_ranges + nprocs + 1, val_idx) -
+                           ownership_ranges - 1;
+        const int shared_memory_owner = shared_memory_ranks[owner];
+        if (shared_memory_owner == MPI_UNDEFINED)
+        {
+            off_node_idxs.push_back(idx);
+            off_node_local_idxs.push_back(d_local_node_count + k);
+            continue;
+        }
+        if (segments.find(shared_memory_owner) == segments.end())
+        {
+            MPI_Aint segment_size;
+            int disp_unit;
+            double* segment;
+            MPI_Win_shared_query(d_shared_memory_win, shared_memory_owner, &segment_size, &disp_unit, &segment);
+            segments[shared_memory_owner] = segment;
+        }
+        d_on_node_ghost_srcs.emplace_back(static_cast<int>(k),
+                                          segments[shared_memory_owner] + (val_idx - ownership_ranges[owner]));
+    }
+
+    // Create the scatter that communicates the values of the remaining ghost
+    // nodes to the ghosted local form.
+    IS off_node_is, off_node_local_is;
+    ierr = ISCreateBlock(PETSC_COMM_SELF,
+                         d_depth,
+                         static_cast<PetscInt>(off_node_idxs.size()),
+                         off_node_idxs.data(),
+                         PETSC_COPY_VALUES,
+                         &off_node_is);
+    IBTK_CHKERRQ(ierr);
+    ierr = ISCreateBlock(PETSC_COMM_SELF,
+                         d_depth,
+                         static_cast<PetscInt>(off_node_local_idxs.size()),
+                         off_node_local_idxs.data(),
+                         PETSC_COPY_VALUES,
+                         &off_node_local_is);
+    IBTK_CHKERRQ(ierr);
+    Vec ghosted_local_vec;
+    ierr = VecGhostGetLocalForm(d_global_vec, &ghosted_local_vec);
+    IBTK_CHKERRQ(ierr);
+    ierr =
+        VecScatterCreate(d_global_vec, off_node_is, ghosted_local_vec, off_node_local_is, &d_off_node_ghost_scatter);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostRestoreLocalForm(d_global_vec, &ghosted_local_vec);
+    IBTK_CHKERRQ(ierr);
+    ierr = ISDestroy(&off_node_is);
+    IBTK_CHKERRQ(ierr);
+    ierr = ISDestroy(&off_node_local_is);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // setupSharedMemoryGhostUpdate
+
+void
+LData::beginSharedMemoryGhostUpdate()
+{
+    if (d_shared_memory_win == MPI_WIN_NULL) setupSharedMemoryGhostUpdate();
+    MPI_Comm shared_memory_comm = get_shared_memory_comm();
+    int ierr;
+
+    // Copy the local values into the segment of this process and wait until
+    // all processes on this node have done the same.
+    const double* vals;
+    ierr = VecGetArrayRead(d_global_vec, &vals);
+    IBTK_CHKERRQ(ierr);
+    std::copy(vals, vals + d_depth * d_local_node_count, d_shared_memory_array);
+    ierr = VecRestoreArrayRead(d_global_vec, &vals);
+    IBTK_CHKERRQ(ierr);
+    MPI_Win_sync(d_shared_memory_win);
+    MPI_Barrier(shared_memory_comm);
+    MPI_Win_sync(d_shared_memory_win);
+
+    // Copy the values of the ghost nodes owned by processes on this node
+    // directly from their segments and start communicating the others.
+    Vec ghosted_local_vec;
+    ierr = VecGhostGetLocalForm(d_global_vec, &ghosted_local_vec);
+    IBTK_CHKERRQ(ierr);
+    double* ghosted_local_vals;
+    ierr = VecGetArray(ghosted_local_vec, &ghosted_local_vals);
+    IBTK_CHKERRQ(ierr);
+    for (const auto& ghost_src : d_on_node_ghost_srcs)
+    {
+        std::copy(ghost_src.second,
+                  ghost_src.second + d_depth,
+                  ghosted_local_vals + d_depth * (d_local_node_count + ghost_src.first));
+    }
+    ierr = VecRestoreArray(ghosted_local_vec, &ghosted_local_vals);
+    IBTK_CHKERRQ(ierr);
+    ierr =
+        VecScatterBegin(d_off_node_ghost_scatter, d_global_vec, ghosted_local_vec, INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostRestoreLocalForm(d_global_vec, &ghosted_local_vec);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // beginSharedMemoryGhostUpdate
+
+void
+LData::endSharedMemoryGhostUpdate()
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_shared_memory_win != MPI_WIN_NULL);
+#endif
+    int ierr;
+    Vec ghosted_local_vec;
+    ierr = VecGhostGetLocalForm(d_global_vec, &ghosted_local_vec);
+    IBTK_CHKERRQ(ierr);
+    ierr =
+        VecScatterEnd(d_off_node_ghost_scatter, d_global_vec, ghosted_local_vec, INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostRestoreLocalForm(d_global_vec, &ghosted_local_vec);
+    IBTK_CHKERRQ(ierr);
+
+    // The segment of this process must not be modified until the other
+    // processes on this node have read the values they need from it.
+    MPI_Barrier(get_shared_memory_comm());
+    return;
+} // endSharedMemoryGhostUpdate
+
+void
+LData::clearSharedMemoryGhostUpdate()
+{
+    if (d_shared_memory_win == MPI_WIN_NULL) return;
+    MPI_Win_unlock_all(d_shared_memory_win);
+    MPI_Win_free(&d_shared_memory_win);
+    d_shared_memory_array = nullptr;
+    d_on_node_ghost_srcs.clear();
+    const int ierr = VecScatterDestroy(&d_off_node_ghost_scatter);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // clearSharedMemoryGhostUpdate
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
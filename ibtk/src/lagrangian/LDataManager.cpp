@@ -16,10 +16,12 @@
 #include <IBTK_config.h>
 
 #include "ibtk/IBTK_CHKERRQ.h"
+#include "ibtk/IBTK_MPI.h"
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LData.h"
 #include "ibtk/LDataManager.h"
 #include "ibtk/LEInteractor.h"
+#include "ibtk/LHDF5DataWriter.h"
 #include "ibtk/LIndexSetData.h"
 #include "ibtk/LInitStrategy.h"
 #include "ibtk/LMesh.h"
@@ -34,10 +36,13 @@
 #include "ibtk/LSetDataIterator.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/LTransaction.h"
+#include "ibtk/MemoryMonitor.h"
 #include "ibtk/ParallelSet.h"
+#include "ibtk/PerformanceMonitor.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/SAMRAIDataCache.h"
 #include "ibtk/compiler_hints.h"
+#include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
 #include "BasePatchHierarchy.h"
@@ -105,7 +110,10 @@ IBTK_DISABLE_EXTRA_WARNINGS
 IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <map>
 #include <memory>
@@ -159,6 +167,28 @@ static const double TOL = std::sqrt(std::numeric_limits<double>::epsilon());
 
 // Version of LDataManager restart file data.
 static const int LDATA_MANAGER_VERSION = 1;
+
+// Return a description of the parallel layout of a vector that is identical on
+// all processes, which is used to index the cached VecScatter objects.
+std::vector<int>
+get_vec_layout(Vec vec)
+{
+    int ierr;
+    MPI_Comm comm;
+    ierr = PetscObjectGetComm(reinterpret_cast<PetscObject>(vec), &comm);
+    IBTK_CHKERRQ(ierr);
+    int comm_size;
+    MPI_Comm_size(comm, &comm_size);
+    int bs;
+    ierr = VecGetBlockSize(vec, &bs);
+    IBTK_CHKERRQ(ierr);
+    const PetscInt* ranges;
+    ierr = VecGetOwnershipRanges(vec, &ranges);
+    IBTK_CHKERRQ(ierr);
+    std::vector<int> layout(1, bs);
+    layout.insert(layout.end(), ranges, ranges + comm_size + 1);
+    return layout;
+} // get_vec_layout
 } // namespace
 
 const std::string LDataManager::POSN_DATA_NAME = "X";
@@ -287,6 +317,8 @@ LDataManager::setPatchLevels(const int coarsest_ln, const int finest_ln)
     d_nonlocal_lag_indices.resize(d_finest_ln + 1);
     d_local_petsc_indices.resize(d_finest_ln + 1);
     d_nonlocal_petsc_indices.resize(d_finest_ln + 1);
+    d_lag_petsc_scatters.resize(d_finest_ln + 1);
+    d_scratch_lag_data.resize(d_finest_ln + 1);
     return;
 } // setPatchLevels
 
@@ -296,6 +328,44 @@ LDataManager::getPatchLevels() const
     return std::make_pair(d_coarsest_ln, d_finest_ln + 1);
 } // getPatchLevels
 
+void
+LDataManager::setUseSpaceFillingCurveNodeOrdering(const bool use_sfc_ordering)
+{
+    d_use_sfc_node_ordering = use_sfc_ordering;
+    return;
+} // setUseSpaceFillingCurveNodeOrdering
+
+void
+LDataManager::setUseBoundingBoxTagging(const bool use_bounding_box_tagging)
+{
+    d_use_bounding_box_tagging = use_bounding_box_tagging;
+    return;
+} // setUseBoundingBoxTagging
+
+void
+LDataManager::setUseSharedMemoryGhostUpdates(const bool use_shared_memory_ghost_updates)
+{
+    d_use_shared_memory_ghost_updates = use_shared_memory_ghost_updates;
+    for (const auto& level_data : d_lag_mesh_data)
+    {
+        for (const auto& name_data_pair : level_data)
+        {
+            name_data_pair.second->setUseSharedMemoryGhostUpdate(d_use_shared_memory_ghost_updates);
+        }
+    }
+    for (const auto& level_pools : d_scratch_lag_data)
+    {
+        for (const auto& depth_pool_pair : level_pools)
+        {
+            for (const auto& data : depth_pool_pair.second)
+            {
+                data->setUseSharedMemoryGhostUpdate(d_use_shared_memory_ghost_updates);
+            }
+        }
+    }
+    return;
+} // setUseSharedMemoryGhostUpdates
+
 void
 LDataManager::spread(const int f_data_idx,
                      Pointer<LData> F_data,
@@ -432,7 +502,7 @@ LDataManager::spread(const int f_data_idx,
         if (ds_data_ghost_node_update) ds_data[ln]->endGhostUpdate();
 
         const int depth = F_data[ln]->getDepth();
-        F_ds_data[ln] = new LData("", getNumberOfLocalNodes(ln), depth, d_nonlocal_petsc_indices[ln]);
+        F_ds_data[ln] = getScratchLData(ln, depth);
         boost::multi_array_ref<double, 2>& F_ds_arr = *F_ds_data[ln]->getGhostedLocalFormVecArray();
         const boost::multi_array_ref<double, 2>& F_arr = *F_data[ln]->getGhostedLocalFormVecArray();
         const boost::multi_array_ref<double, 1>& ds_arr = *ds_data[ln]->getGhostedLocalFormArray();
@@ -462,6 +532,12 @@ LDataManager::spread(const int f_data_idx,
            X_data_ghost_node_update,
            coarsest_ln,
            finest_ln);
+
+    // Return the temporary data to the pool.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (F_ds_data[ln]) restoreScratchLData(F_ds_data[ln], ln);
+    }
     return;
 } // spread
 
@@ -860,6 +936,16 @@ LDataManager::registerLSiloDataWriter(Pointer<LSiloDataWriter> silo_writer)
     return;
 } // registerLSiloDataWriter
 
+void
+LDataManager::registerLHDF5DataWriter(Pointer<LHDF5DataWriter> hdf5_writer)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(hdf5_writer);
+#endif
+    d_hdf5_writer = hdf5_writer;
+    return;
+} // registerLHDF5DataWriter
+
 void
 LDataManager::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > load_balancer, int workload_idx)
 {
@@ -893,6 +979,7 @@ LDataManager::createLData(const std::string& quantity_name,
 #endif
     Pointer<LData> ret_val =
         new LData(quantity_name, getNumberOfLocalNodes(level_number), depth, d_nonlocal_petsc_indices[level_number]);
+    ret_val->setUseSharedMemoryGhostUpdate(d_use_shared_memory_ghost_updates);
     if (maintain_data)
     {
         d_lag_mesh_data[level_number][quantity_name] = ret_val;
@@ -900,6 +987,101 @@ LDataManager::createLData(const std::string& quantity_name,
     return ret_val;
 } // createLData
 
+Pointer<LData>
+LDataManager::getScratchLData(const int level_number, const unsigned int depth)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+    TBOX_ASSERT(depth > 0);
+#endif
+    std::vector<Pointer<LData> >& pool = d_scratch_lag_data[level_number][depth];
+    if (pool.empty()) return createLData("scratch", level_number, depth, /*maintain_data*/ false);
+    Pointer<LData> ret_val = pool.back();
+    pool.pop_back();
+    return ret_val;
+} // getScratchLData
+
+void
+LDataManager::restoreScratchLData(Pointer<LData> data, const int level_number)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(data);
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+    // Data created before the nodes were last redistributed are discarded.
+    if (data->getLocalNodeCount() != getNumberOfLocalNodes(level_number) ||
+        data->getGhostNodeCount() != d_nonlocal_petsc_indices[level_number].size())
+    {
+        return;
+    }
+    d_scratch_lag_data[level_number][data->getDepth()].push_back(data);
+    return;
+} // restoreScratchLData
+
+void
+LDataManager::updateGhostValues(const std::vector<Pointer<LData> >& data, const int level_number)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+    if (data.empty()) return;
+    if (data.size() == 1)
+    {
+        data[0]->beginGhostUpdate();
+        data[0]->endGhostUpdate();
+        return;
+    }
+
+    // Pack the local values of all of the quantities into a single vector so
+    // that only one ghost value update is required.
+    unsigned int packed_depth = 0;
+    for (const auto& lag_data : data) packed_depth += lag_data->getDepth();
+    Pointer<LData> packed_data = getScratchLData(level_number, packed_depth);
+    const unsigned int num_local_nodes = getNumberOfLocalNodes(level_number);
+    const unsigned int num_ghost_nodes = static_cast<unsigned int>(d_nonlocal_petsc_indices[level_number].size());
+    unsigned int offset = 0;
+    boost::multi_array_ref<double, 2>& packed_local_arr = *packed_data->getGhostedLocalFormVecArray();
+    for (const auto& lag_data : data)
+    {
+        const unsigned int depth = lag_data->getDepth();
+        const boost::multi_array_ref<double, 2>& arr = *lag_data->getGhostedLocalFormVecArray();
+        for (unsigned int k = 0; k < num_local_nodes; ++k)
+        {
+            for (unsigned int d = 0; d < depth; ++d)
+            {
+                packed_local_arr[k][offset + d] = arr[k][d];
+            }
+        }
+        lag_data->restoreArrays();
+        offset += depth;
+    }
+    packed_data->restoreArrays();
+
+    packed_data->beginGhostUpdate();
+    packed_data->endGhostUpdate();
+
+    // Unpack the ghost values.
+    offset = 0;
+    const boost::multi_array_ref<double, 2>& packed_ghost_arr = *packed_data->getGhostedLocalFormVecArray();
+    for (const auto& lag_data : data)
+    {
+        const unsigned int depth = lag_data->getDepth();
+        boost::multi_array_ref<double, 2>& arr = *lag_data->getGhostedLocalFormVecArray();
+        for (unsigned int k = num_local_nodes; k < num_local_nodes + num_ghost_nodes; ++k)
+        {
+            for (unsigned int d = 0; d < depth; ++d)
+            {
+                arr[k][d] = packed_ghost_arr[k][offset + d];
+            }
+        }
+        lag_data->restoreArrays();
+        offset += depth;
+    }
+    packed_data->restoreArrays();
+    restoreScratchLData(packed_data, level_number);
+    return;
+} // updateGhostValues
+
 Point
 LDataManager::computeLagrangianStructureCenterOfMass(const int structure_id, const int level_number)
 {
@@ -1171,6 +1353,7 @@ LDataManager::activateLagrangianStructures(const std::vector<int>& structure_ids
         d_inactive_strcts[level_number].removeItem(structure_id);
     }
     d_inactive_strcts[level_number].communicateData();
+    updateInactivatedIndexCaches(level_number);
     return;
 } // activateLagrangianStructures
 
@@ -1185,9 +1368,27 @@ LDataManager::inactivateLagrangianStructures(const std::vector<int>& structure_i
         d_inactive_strcts[level_number].addItem(structure_id);
     }
     d_inactive_strcts[level_number].communicateData();
+    updateInactivatedIndexCaches(level_number);
     return;
 } // inactivateLagrangianStructures
 
+std::vector<std::pair<int, int> >
+LDataManager::getInactivatedLagrangianIndexRanges(const int level_number) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+    std::vector<std::pair<int, int> > ranges;
+    for (int strct_id : d_inactive_strcts[level_number].getSet())
+    {
+        const auto it = d_strct_id_to_lag_idx_range_map[level_number].find(strct_id);
+        if (it == d_strct_id_to_lag_idx_range_map[level_number].end()) continue;
+        if (it->second.first < it->second.second) ranges.push_back(it->second);
+    }
+    std::sort(ranges.begin(), ranges.end());
+    return ranges;
+} // getInactivatedLagrangianIndexRanges
+
 void
 LDataManager::zeroInactivatedComponents(Pointer<LData> lag_data, const int level_number) const
 {
@@ -1310,15 +1511,30 @@ LDataManager::scatterToAll(Vec& parallel_vec, Vec& sequential_vec) const
 {
     int ierr;
     const bool create_vout = !sequential_vec;
-    VecScatter ctx;
-    ierr = VecScatterCreateToAll(parallel_vec, &ctx, (create_vout ? &sequential_vec : nullptr));
-    IBTK_CHKERRQ(ierr);
+
+    // Scatters to all processes depend only on the layout of the parallel
+    // vector, so they are reused until the node distribution changes.
+    const std::vector<int> layout = get_vec_layout(parallel_vec);
+    auto it = d_scatters_to_all.find(layout);
+    if (it == d_scatters_to_all.end())
+    {
+        VecScatter ctx;
+        ierr = VecScatterCreateToAll(parallel_vec, &ctx, (create_vout ? &sequential_vec : nullptr));
+        IBTK_CHKERRQ(ierr);
+        it = d_scatters_to_all.insert(std::make_pair(layout, ctx)).first;
+    }
+    else if (create_vout)
+    {
+        ierr = VecCreateSeq(PETSC_COMM_SELF, layout.back(), &sequential_vec);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecSetBlockSize(sequential_vec, layout.front());
+        IBTK_CHKERRQ(ierr);
+    }
+    VecScatter& ctx = it->second;
     ierr = VecScatterBegin(ctx, parallel_vec, sequential_vec, INSERT_VALUES, SCATTER_FORWARD);
     IBTK_CHKERRQ(ierr);
     ierr = VecScatterEnd(ctx, parallel_vec, sequential_vec, INSERT_VALUES, SCATTER_FORWARD);
     IBTK_CHKERRQ(ierr);
-    ierr = VecScatterDestroy(&ctx);
-    IBTK_CHKERRQ(ierr);
     return;
 } // scatterToAll
 
@@ -1327,21 +1543,37 @@ LDataManager::scatterToZero(Vec& parallel_vec, Vec& sequential_vec) const
 {
     int ierr;
     const bool create_vout = !sequential_vec;
-    VecScatter ctx;
-    ierr = VecScatterCreateToZero(parallel_vec, &ctx, (create_vout ? &sequential_vec : nullptr));
-    IBTK_CHKERRQ(ierr);
+
+    // Scatters to process zero depend only on the layout of the parallel
+    // vector, so they are reused until the node distribution changes.
+    const std::vector<int> layout = get_vec_layout(parallel_vec);
+    auto it = d_scatters_to_zero.find(layout);
+    if (it == d_scatters_to_zero.end())
+    {
+        VecScatter ctx;
+        ierr = VecScatterCreateToZero(parallel_vec, &ctx, (create_vout ? &sequential_vec : nullptr));
+        IBTK_CHKERRQ(ierr);
+        it = d_scatters_to_zero.insert(std::make_pair(layout, ctx)).first;
+    }
+    else if (create_vout)
+    {
+        ierr = VecCreateSeq(PETSC_COMM_SELF, IBTK_MPI::getRank() == 0 ? layout.back() : 0, &sequential_vec);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecSetBlockSize(sequential_vec, layout.front());
+        IBTK_CHKERRQ(ierr);
+    }
+    VecScatter& ctx = it->second;
     ierr = VecScatterBegin(ctx, parallel_vec, sequential_vec, INSERT_VALUES, SCATTER_FORWARD);
     IBTK_CHKERRQ(ierr);
     ierr = VecScatterEnd(ctx, parallel_vec, sequential_vec, INSERT_VALUES, SCATTER_FORWARD);
     IBTK_CHKERRQ(ierr);
-    ierr = VecScatterDestroy(&ctx);
-    IBTK_CHKERRQ(ierr);
     return;
 } // scatterToZero
 
 void
 LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest_ln_in)
 {
+    PerformanceMonitor::ScopedRegion region("LDataManager::beginDataRedistribution");
     IBTK_TIMER_START(t_begin_data_redistribution);
 
     const int coarsest_ln = (coarsest_ln_in == -1) ? d_coarsest_ln : coarsest_ln_in;
@@ -1513,6 +1745,7 @@ LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest
 void
 LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_ln_in)
 {
+    PerformanceMonitor::ScopedRegion region("LDataManager::endDataRedistribution");
     IBTK_TIMER_START(t_end_data_redistribution);
 
     const int coarsest_ln = (coarsest_ln_in == -1) ? d_coarsest_ln : coarsest_ln_in;
@@ -1684,6 +1917,10 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
     std::vector<std::map<int, IS> > dst_IS(finest_ln + 1);
     std::vector<std::map<int, VecScatter> > scatter_template(finest_ln + 1);
 
+    // Levels on which the node distribution is unchanged by the regrid keep
+    // their existing Vec objects, so no data needs to be scattered.
+    std::vector<bool> distribution_unchanged(finest_ln + 1, false);
+
     // The number of all local (e.g., on processor) and ghost (e.g., off
     // processor) nodes.
     //
@@ -1725,6 +1962,13 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         dst_vec[level_number].resize(num_data);
         scatter[level_number].resize(num_data);
 
+        // Keep track of the old distribution of nodes for the level.
+        const std::vector<int> old_local_lag_indices = d_local_lag_indices[level_number];
+        const std::vector<int> old_nonlocal_lag_indices = d_nonlocal_lag_indices[level_number];
+        const std::vector<int> old_nonlocal_petsc_indices = d_nonlocal_petsc_indices[level_number];
+        const unsigned int old_num_nodes = d_num_nodes[level_number];
+        const unsigned int old_node_offset = d_node_offset[level_number];
+
         // Get the new distribution of nodes for the level.
         //
         // NOTE: This process updates the local PETSc indices of the LNodeSet
@@ -1740,6 +1984,19 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         num_local_nodes[level_number] = static_cast<int>(d_local_lag_indices[level_number].size());
         num_nonlocal_nodes[level_number] = static_cast<int>(d_nonlocal_lag_indices[level_number].size());
 
+        // If no process has changed its distribution of nodes (including the
+        // ordering of the local and ghost nodes), the existing Vec objects
+        // are already laid out correctly and do not need to be rebuilt.
+        //
+        // NOTE: d_ao is null before the first redistribution.
+        const bool locally_unchanged = d_ao[level_number] && old_num_nodes == d_num_nodes[level_number] &&
+                                       old_node_offset == d_node_offset[level_number] &&
+                                       old_local_lag_indices == d_local_lag_indices[level_number] &&
+                                       old_nonlocal_lag_indices == d_nonlocal_lag_indices[level_number] &&
+                                       old_nonlocal_petsc_indices == d_nonlocal_petsc_indices[level_number];
+        distribution_unchanged[level_number] = SAMRAI_MPI::minReduction(locally_unchanged ? 1 : 0) == 1;
+        if (distribution_unchanged[level_number]) continue;
+
         // Setup src indices.
         std::vector<int> src_inds(num_local_nodes[level_number]);
         for (int k = 0; k < num_local_nodes[level_number]; ++k)
@@ -1814,12 +2071,19 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
                 &dst_vec[level_number][i]);
             IBTK_CHKERRQ(ierr);
 
-            // Create the VecScatter.
-            ierr = VecScatterCreate(src_vec[level_number][i],
-                                    src_IS[level_number][depth],
-                                    dst_vec[level_number][i],
-                                    dst_IS[level_number][depth],
-                                    &scatter[level_number][i]);
+            // Create the VecScatter.  The communication pattern only depends
+            // on the data depth, so it is computed once for each unique depth
+            // and copied for the remaining LData objects.
+            if (scatter_template[level_number].find(depth) == scatter_template[level_number].end())
+            {
+                ierr = VecScatterCreate(src_vec[level_number][i],
+                                        src_IS[level_number][depth],
+                                        dst_vec[level_number][i],
+                                        dst_IS[level_number][depth],
+                                        &scatter_template[level_number][depth]);
+                IBTK_CHKERRQ(ierr);
+            }
+            ierr = VecScatterCopy(scatter_template[level_number][depth], &scatter[level_number][i]);
             IBTK_CHKERRQ(ierr);
 
             // Begin scattering data.
@@ -1851,12 +2115,14 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         }
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
         const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
+        const std::vector<std::pair<int, int> > inactive_lag_idx_ranges =
+            getInactivatedLagrangianIndexRanges(level_number);
         std::set<int> local_petsc_idxs;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-            idx_data->cacheLocalIndices(patch, periodic_shift);
+            idx_data->cacheLocalIndices(patch, periodic_shift, inactive_lag_idx_ranges);
             const Box<NDIM>& ghost_box = idx_data->getGhostBox();
             for (LNodeSetData::DataIterator it = idx_data->data_begin(ghost_box); it != idx_data->data_end(); ++it)
             {
@@ -1891,7 +2157,7 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
     // contexts.
     for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
     {
-        if (!d_level_contains_lag_data[level_number]) continue;
+        if (!d_level_contains_lag_data[level_number] || distribution_unchanged[level_number]) continue;
 
         std::map<std::string, Pointer<LData> >& level_data = d_lag_mesh_data[level_number];
         std::map<std::string, Pointer<LData> >::iterator it;
@@ -1939,14 +2205,27 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
             ierr = ISDestroy(&IS.second);
             IBTK_CHKERRQ(ierr);
         }
+
+        for (auto& ctx : scatter_template[level_number])
+        {
+            ierr = VecScatterDestroy(&ctx.second);
+            IBTK_CHKERRQ(ierr);
+        }
     }
 
-    // If a Silo data writer is registered with the manager, give it access to
-    // the new application orderings.
+    // If Silo or HDF5 data writers are registered with the manager, give them
+    // access to the new application orderings.
     if (d_silo_writer)
     {
         d_silo_writer->registerLagrangianAO(d_ao, coarsest_ln, finest_ln);
     }
+    if (d_hdf5_writer)
+    {
+        d_hdf5_writer->registerLagrangianAO(d_ao, coarsest_ln, finest_ln);
+    }
+
+    // The cached scatters are invalid once the nodes have been redistributed.
+    clearLayoutDependentCaches();
 
     IBTK_TIMER_STOP(t_end_data_redistribution);
     return;
@@ -2237,6 +2516,8 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
         // 4. Compute the initial distribution (indexing) data.
         Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
         const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
+        const std::vector<std::pair<int, int> > inactive_lag_idx_ranges =
+            getInactivatedLagrangianIndexRanges(level_number);
         std::set<LNode*, LNodeIndexLocalPETScIndexComp> local_nodes, ghost_nodes;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
@@ -2248,7 +2529,7 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
 
             node_count_data->fillAll(0.0);
 
-            idx_data->cacheLocalIndices(patch, periodic_shift);
+            idx_data->cacheLocalIndices(patch, periodic_shift, inactive_lag_idx_ranges);
             for (LNodeSetData::SetIterator it(*idx_data); it; it++)
             {
                 const CellIndex<NDIM>& i = it.getIndex();
@@ -2307,13 +2588,21 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
         IBTK_CHKERRQ(ierr);
     }
 
-    // If a Silo data writer is registered with the manager, give it access to
-    // the new application ordering.
+    // Any cached scatters are invalid for the new application ordering.
+    clearLayoutDependentCaches();
+
+    // If Silo or HDF5 data writers are registered with the manager, give them
+    // access to the new application ordering.
     if (d_silo_writer && d_level_contains_lag_data[level_number])
     {
         d_silo_writer->registerCoordsData(d_lag_mesh_data[level_number][POSN_DATA_NAME], level_number);
         d_silo_writer->registerLagrangianAO(d_ao[level_number], level_number);
     }
+    if (d_hdf5_writer && d_level_contains_lag_data[level_number])
+    {
+        d_hdf5_writer->registerCoordsData(d_lag_mesh_data[level_number][POSN_DATA_NAME], level_number);
+        d_hdf5_writer->registerLagrangianAO(d_ao[level_number], level_number);
+    }
 
     IBTK_TIMER_STOP(t_initialize_level_data);
     return;
@@ -2352,6 +2641,18 @@ LDataManager::resetHierarchyConfiguration(const Pointer<BasePatchHierarchy<NDIM>
         }
     }
 
+    // Reset the HDF5 data writer.
+    if (d_hdf5_writer)
+    {
+        d_hdf5_writer->setPatchHierarchy(hierarchy);
+        d_hdf5_writer->resetLevels(d_coarsest_ln, d_finest_ln);
+        for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
+        {
+            if (!d_level_contains_lag_data[level_number]) continue;
+            d_hdf5_writer->registerCoordsData(d_lag_mesh_data[level_number][POSN_DATA_NAME], level_number);
+        }
+    }
+
     // If we have added or removed a level, resize the schedule vectors.
     d_lag_node_index_bdry_fill_scheds.resize(finest_hier_level + 1);
     d_node_count_coarsen_scheds.resize(finest_hier_level + 1);
@@ -2407,38 +2708,47 @@ LDataManager::applyGradientDetector(const Pointer<BasePatchHierarchy<NDIM> > hie
         Pointer<PatchLevel<NDIM> > finer_level = hierarchy->getPatchLevel(level_number + 1);
         const IntVector<NDIM>& ratio = level->getRatio();
 
-        // Zero out the node count data on the current level.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        if (d_use_bounding_box_tagging)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            Pointer<CellData<NDIM, double> > node_count_data = patch->getPatchData(d_node_count_idx);
-            node_count_data->fillAll(0.0);
+            // Tag cells for refinement within the bounding boxes of the nodes on
+            // the patches of the next finer level of the Cartesian grid.
+            tagCellsInNodeBoundingBoxes(level_number, tag_index);
         }
+        else
+        {
+            // Zero out the node count data on the current level.
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > node_count_data = patch->getPatchData(d_node_count_idx);
+                node_count_data->fillAll(0.0);
+            }
 
-        // Compute the node count data on the next finer level of the patch
-        // hierarchy.
-        updateNodeCountData(level_number + 1, level_number + 1);
+            // Compute the node count data on the next finer level of the patch
+            // hierarchy.
+            updateNodeCountData(level_number + 1, level_number + 1);
 
-        // Coarsen the node count data from the next finer level of the patch
-        // hierarchy.
-        d_node_count_coarsen_scheds[level_number + 1]->coarsenData();
+            // Coarsen the node count data from the next finer level of the
+            // patch hierarchy.
+            d_node_count_coarsen_scheds[level_number + 1]->coarsenData();
 
-        // Tag cells for refinement wherever there exist nodes on the next finer
-        // level of the Cartesian grid.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            const Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            const Box<NDIM>& patch_box = patch->getBox();
+            // Tag cells for refinement wherever there exist nodes on the next
+            // finer level of the Cartesian grid.
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
 
-            Pointer<CellData<NDIM, int> > tag_data = patch->getPatchData(tag_index);
-            const Pointer<CellData<NDIM, double> > node_count_data = patch->getPatchData(d_node_count_idx);
+                Pointer<CellData<NDIM, int> > tag_data = patch->getPatchData(tag_index);
+                const Pointer<CellData<NDIM, double> > node_count_data = patch->getPatchData(d_node_count_idx);
 
-            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
-            {
-                const CellIndex<NDIM>& i = ic();
-                if (!MathUtilities<double>::equalEps((*node_count_data)(i), 0.0))
+                for (CellIterator<NDIM> ic(patch_box); ic; ic++)
                 {
-                    (*tag_data)(i) = 1;
+                    const CellIndex<NDIM>& i = ic();
+                    if (!MathUtilities<double>::equalEps((*node_count_data)(i), 0.0))
+                    {
+                        (*tag_data)(i) = 1;
+                    }
                 }
             }
         }
@@ -2470,7 +2780,7 @@ LDataManager::applyGradientDetector(const Pointer<BasePatchHierarchy<NDIM> > hie
 
         // Re-compute the node count data on the present level of the patch
         // hierarchy (since it was invalidated above).
-        updateNodeCountData(level_number, level_number);
+        if (!d_use_bounding_box_tagging) updateNodeCountData(level_number, level_number);
     }
 
     IBTK_TIMER_STOP(t_apply_gradient_detector);
@@ -2693,6 +3003,25 @@ LDataManager::LDataManager(std::string object_name,
         t_compute_node_distribution =
             TimerManager::getManager()->getTimer("IBTK::LDataManager::computeNodeDistribution()");
         t_compute_node_offsets = TimerManager::getManager()->getTimer("IBTK::LDataManager::computeNodeOffsets()"););
+
+    // Report the memory used by the Lagrangian data and the index mappings.
+    d_memory_reporter_id = MemoryMonitor::registerReporter("Lagrangian data", [this]() {
+        std::size_t bytes = 0;
+        for (const auto& level_data : d_lag_mesh_data)
+        {
+            for (const auto& data : level_data)
+            {
+                if (!data.second) continue;
+                bytes += static_cast<std::size_t>(data.second->getLocalNodeCount() + data.second->getGhostNodeCount()) *
+                         data.second->getDepth() * sizeof(double);
+            }
+        }
+        for (const auto& indices : d_local_lag_indices) bytes += indices.size() * sizeof(int);
+        for (const auto& indices : d_nonlocal_lag_indices) bytes += indices.size() * sizeof(int);
+        for (const auto& indices : d_local_petsc_indices) bytes += indices.size() * sizeof(int);
+        for (const auto& indices : d_nonlocal_petsc_indices) bytes += indices.size() * sizeof(int);
+        return bytes;
+    });
     return;
 } // LDataManager
 
@@ -2708,6 +3037,8 @@ LDataManager::~LDataManager()
             IBTK_CHKERRQ(ierr);
         }
     }
+    clearLayoutDependentCaches();
+    MemoryMonitor::unregisterReporter(d_memory_reporter_id);
     return;
 } // ~LDataManager
 
@@ -2737,6 +3068,22 @@ LDataManager::scatterData(Vec& lagrangian_vec, Vec& petsc_vec, const int level_n
 #endif
     const int depth = petsc_bs;
 
+    // The scatter depends only on the layouts of the two vectors and on the
+    // application ordering of the level, so it is reused until the node
+    // distribution changes.
+    std::vector<int> layout = get_vec_layout(petsc_vec);
+    const std::vector<int> lagrangian_layout = get_vec_layout(lagrangian_vec);
+    layout.insert(layout.end(), lagrangian_layout.begin(), lagrangian_layout.end());
+    auto it = d_lag_petsc_scatters[level_number].find(layout);
+    if (it != d_lag_petsc_scatters[level_number].end())
+    {
+        ierr = VecScatterBegin(it->second, petsc_vec, lagrangian_vec, INSERT_VALUES, mode);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecScatterEnd(it->second, petsc_vec, lagrangian_vec, INSERT_VALUES, mode);
+        IBTK_CHKERRQ(ierr);
+        return;
+    }
+
     // Determine the application indices corresponding to the local PETSc
     // indices.
     int local_sz;
@@ -2777,14 +3124,63 @@ LDataManager::scatterData(Vec& lagrangian_vec, Vec& petsc_vec, const int level_n
     ierr = VecScatterEnd(vec_scatter, petsc_vec, lagrangian_vec, INSERT_VALUES, mode);
     IBTK_CHKERRQ(ierr);
 
-    // Cleanup allocated data.
+    // Cleanup allocated data and cache the scatter.
     ierr = ISDestroy(&lag_is);
     IBTK_CHKERRQ(ierr);
-    ierr = VecScatterDestroy(&vec_scatter);
-    IBTK_CHKERRQ(ierr);
+    d_lag_petsc_scatters[level_number].insert(std::make_pair(layout, vec_scatter));
     return;
 } // scatterData
 
+void
+LDataManager::clearLayoutDependentCaches()
+{
+    int ierr;
+    for (auto& level_scatters : d_lag_petsc_scatters)
+    {
+        for (auto& ctx : level_scatters)
+        {
+            ierr = VecScatterDestroy(&ctx.second);
+            IBTK_CHKERRQ(ierr);
+        }
+        level_scatters.clear();
+    }
+    for (auto& ctx : d_scatters_to_all)
+    {
+        ierr = VecScatterDestroy(&ctx.second);
+        IBTK_CHKERRQ(ierr);
+    }
+    d_scatters_to_all.clear();
+    for (auto& ctx : d_scatters_to_zero)
+    {
+        ierr = VecScatterDestroy(&ctx.second);
+        IBTK_CHKERRQ(ierr);
+    }
+    d_scatters_to_zero.clear();
+    for (auto& level_pool : d_scratch_lag_data)
+    {
+        level_pool.clear();
+    }
+    return;
+} // clearLayoutDependentCaches
+
+void
+LDataManager::updateInactivatedIndexCaches(const int level_number)
+{
+    if (!d_hierarchy || level_number > d_hierarchy->getFinestLevelNumber()) return;
+    if (!d_level_contains_lag_data[level_number]) return;
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
+    const std::vector<std::pair<int, int> > inactive_lag_idx_ranges = getInactivatedLagrangianIndexRanges(level_number);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+        idx_data->cacheLocalIndices(patch, periodic_shift, inactive_lag_idx_ranges);
+    }
+    return;
+} // updateInactivatedIndexCaches
+
 void
 LDataManager::beginNonlocalDataFill(const int coarsest_ln_in, const int finest_ln_in)
 {
@@ -2837,6 +3233,68 @@ LDataManager::endNonlocalDataFill(const int coarsest_ln_in, const int finest_ln_
     return;
 } // endNonlocalDataFill
 
+void
+LDataManager::tagCellsInNodeBoundingBoxes(const int level_number, const int tag_index)
+{
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+    Pointer<PatchLevel<NDIM> > finer_level = d_hierarchy->getPatchLevel(level_number + 1);
+    const IntVector<NDIM>& ratio = finer_level->getRatioToCoarserLevel();
+
+    // Compute the bounding box of the cells that contain nodes in each local
+    // patch of the finer level in the index space of the present level. The
+    // data for each patch consist of a flag that indicates whether the box is
+    // nonempty followed by the lower and upper indices of the box. Since each
+    // patch is assigned to exactly one process, summing the data over all
+    // processes provides every process with the boxes of all patches.
+    const int num_finer_patches = finer_level->getNumberOfPatches();
+    const int stride = 2 * NDIM + 1;
+    std::vector<int> box_data(stride * num_finer_patches, 0);
+    for (PatchLevel<NDIM>::Iterator p(finer_level); p; p++)
+    {
+        const Pointer<Patch<NDIM> > patch = finer_level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+        Box<NDIM> node_box;
+        for (LNodeSetData::SetIterator it(*idx_data); it; it++)
+        {
+            const hier::Index<NDIM>& i = it.getIndex();
+            if (patch_box.contains(i)) node_box += Box<NDIM>(i, i);
+        }
+        if (node_box.empty()) continue;
+        node_box.coarsen(ratio);
+        int* const patch_box_data = &box_data[stride * p()];
+        patch_box_data[0] = 1;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            patch_box_data[1 + d] = node_box.lower()(d);
+            patch_box_data[1 + NDIM + d] = node_box.upper()(d);
+        }
+    }
+    if (num_finer_patches > 0) SAMRAI_MPI::sumReduction(&box_data[0], stride * num_finer_patches);
+
+    // Tag all cells covered by the boxes.
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<CellData<NDIM, int> > tag_data = patch->getPatchData(tag_index);
+        for (int k = 0; k < num_finer_patches; ++k)
+        {
+            const int* const patch_box_data = &box_data[stride * k];
+            if (!patch_box_data[0]) continue;
+            Box<NDIM> tag_box;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                tag_box.lower()(d) = patch_box_data[1 + d];
+                tag_box.upper()(d) = patch_box_data[1 + NDIM + d];
+            }
+            tag_box = tag_box * patch_box;
+            if (!tag_box.empty()) tag_data->fillAll(1, tag_box);
+        }
+    }
+    return;
+} // tagCellsInNodeBoundingBoxes
+
 void
 LDataManager::computeNodeDistribution(AO& ao,
                                       std::vector<int>& local_lag_indices,
@@ -2876,15 +3334,44 @@ LDataManager::computeNodeDistribution(AO& ao,
     // Collect the local nodes and assign local indices to the local nodes.
     unsigned int local_offset = 0;
     std::map<int, int> lag_idx_to_petsc_idx;
-#if 1
-    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    if (d_use_sfc_node_ordering)
     {
-        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-        const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-        for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box); it != idx_data->data_end(); ++it)
+        // Sort the local nodes by the position along a Hilbert curve of the
+        // cells containing them. Cell indices are shifted to be relative to
+        // the bounding box of the level.
+        const Box<NDIM> level_bounding_box = BoxList<NDIM>(level->getBoxes()).getBoundingBox();
+        std::vector<std::pair<std::uint64_t, LNode*> > sfc_nodes;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
-            LNode* const node_idx = *it;
+            const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                const hier::Index<NDIM>& i = b();
+                if (!idx_data->isElement(i)) continue;
+                std::array<std::uint64_t, NDIM> cell_coords;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    cell_coords[d] = static_cast<std::uint64_t>(i(d) - level_bounding_box.lower()(d));
+                }
+                const std::uint64_t sfc_idx = hilbert_curve_index(cell_coords);
+                const LNodeSet* const node_set = idx_data->getItem(i);
+                for (LNodeSet::const_iterator node_it = node_set->begin(); node_it != node_set->end(); ++node_it)
+                {
+                    LNode* const node_idx = *node_it;
+                    sfc_nodes.push_back(std::make_pair(sfc_idx, node_idx));
+                }
+            }
+        }
+        std::stable_sort(sfc_nodes.begin(),
+                         sfc_nodes.end(),
+                         [](const std::pair<std::uint64_t, LNode*>& a, const std::pair<std::uint64_t, LNode*>& b) {
+                             return a.first < b.first;
+                         });
+        for (const auto& sfc_node : sfc_nodes)
+        {
+            LNode* const node_idx = sfc_node.second;
             const int lag_idx = node_idx->getLagrangianIndex();
             local_lag_indices.push_back(lag_idx);
             const int petsc_idx = local_offset++;
@@ -2892,20 +3379,17 @@ LDataManager::computeNodeDistribution(AO& ao,
             lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
         }
     }
-#else
-    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    else
     {
-        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-        const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-        for (Box<NDIM>::Iterator b(patch_box); b; b++)
+#if 1
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
-            const hier::Index<NDIM>& i = b();
-            if (!idx_data->isElement(i)) continue;
-            const LNodeSet* const node_set = idx_data->getItem(i);
-            for (LNodeSet::const_iterator node_it = node_set->begin(); node_it != node_set->end(); ++node_it)
+            const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+            for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box); it != idx_data->data_end(); ++it)
             {
-                LNode* const node_idx = *node_it;
+                LNode* const node_idx = *it;
                 const int lag_idx = node_idx->getLagrangianIndex();
                 local_lag_indices.push_back(lag_idx);
                 const int petsc_idx = local_offset++;
@@ -2913,8 +3397,30 @@ LDataManager::computeNodeDistribution(AO& ao,
                 lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
             }
         }
-    }
+#else
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                const hier::Index<NDIM>& i = b();
+                if (!idx_data->isElement(i)) continue;
+                const LNodeSet* const node_set = idx_data->getItem(i);
+                for (LNodeSet::const_iterator node_it = node_set->begin(); node_it != node_set->end(); ++node_it)
+                {
+                    LNode* const node_idx = *node_it;
+                    const int lag_idx = node_idx->getLagrangianIndex();
+                    local_lag_indices.push_back(lag_idx);
+                    const int petsc_idx = local_offset++;
+                    node_idx->setLocalPETScIndex(petsc_idx);
+                    lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
+                }
+            }
+        }
 #endif
+    }
 
     // Determine the Lagrangian indices of the nonlocal nodes.
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
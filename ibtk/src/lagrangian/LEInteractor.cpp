@@ -20,7 +20,9 @@
 #include "ibtk/LEInteractor.h"
 #include "ibtk/LIndexSetData.h"
 #include "ibtk/LSet.h"
+#include "ibtk/PerformanceMonitor.h"
 #include "ibtk/app_namespaces.h" // IWYU pragma: keep
+#include "ibtk/compiler_hints.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "ArrayData.h"
@@ -50,8 +52,13 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
 #include <ostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 // FORTRAN ROUTINES
@@ -1312,14 +1319,1054 @@ spread_data(const int stencil_sz,
     }
 #endif
 } // spread_data
+
+// Compiled (C++) implementations of the standard kernel functions.
+//
+// Each kernel is described by a small policy class providing the stencil
+// width and a function that computes the lower indices of the stencils
+// (relative to the lower corner of the patch) together with the one-dimensional
+// weights for a batch of markers.
+// Because the width is a compile-time constant, the tensor-product loops below
+// can be fully unrolled and vectorized by the compiler.
+
+inline double
+piecewise_linear_delta(double r)
+{
+    r = std::abs(r);
+    return r < 1.0 ? 1.0 - r : 0.0;
+}
+
+inline double
+ib_3_delta(double r)
+{
+    r = std::abs(r);
+    if (r < 0.5)
+    {
+        return (1.0 + std::sqrt(1.0 - 3.0 * r * r)) / 3.0;
+    }
+    else if (r < 1.5)
+    {
+        return (5.0 - 3.0 * r - std::sqrt(1.0 - 3.0 * (1.0 - r) * (1.0 - r))) / 6.0;
+    }
+    return 0.0;
+}
+
+inline double
+bspline_3_delta(const double x)
+{
+    const double modx = std::abs(x);
+    const double r = modx + 1.5;
+    const double r2 = r * r;
+    if (modx <= 0.5)
+    {
+        return 0.5 * (-2.0 * r2 + 6.0 * r - 3.0);
+    }
+    else if (modx <= 1.5)
+    {
+        return 0.5 * (r2 - 6.0 * r + 9.0);
+    }
+    return 0.0;
+}
+
+inline double
+bspline_4_delta(const double x)
+{
+    const double modx = std::abs(x);
+    const double r = modx + 2.0;
+    const double r2 = r * r;
+    const double r3 = r2 * r;
+    if (modx <= 1.0)
+    {
+        return (1.0 / 6.0) * (3.0 * r3 - 24.0 * r2 + 60.0 * r - 44.0);
+    }
+    else if (modx <= 2.0)
+    {
+        return (1.0 / 6.0) * (-r3 + 12.0 * r2 - 48.0 * r + 64.0);
+    }
+    return 0.0;
+}
+
+inline double
+bspline_5_delta(const double x)
+{
+    const double modx = std::abs(x);
+    const double r = modx + 2.5;
+    const double r2 = r * r;
+    const double r3 = r2 * r;
+    const double r4 = r3 * r;
+    if (modx <= 0.5)
+    {
+        return (1.0 / 24.0) * (6.0 * r4 - 60.0 * r3 + 210.0 * r2 - 300.0 * r + 155.0);
+    }
+    else if (modx <= 1.5)
+    {
+        return (1.0 / 24.0) * (-4.0 * r4 + 60.0 * r3 - 330.0 * r2 + 780.0 * r - 655.0);
+    }
+    else if (modx <= 2.5)
+    {
+        return (1.0 / 24.0) * (r4 - 20.0 * r3 + 150.0 * r2 - 500.0 * r + 625.0);
+    }
+    return 0.0;
+}
+
+inline double
+bspline_6_delta(const double x)
+{
+    const double modx = std::abs(x);
+    const double r = modx + 3.0;
+    const double r2 = r * r;
+    const double r3 = r2 * r;
+    const double r4 = r3 * r;
+    const double r5 = r4 * r;
+    if (modx <= 1.0)
+    {
+        return (1.0 / 60.0) * (2193.0 - 3465.0 * r + 2130.0 * r2 - 630.0 * r3 + 90.0 * r4 - 5.0 * r5);
+    }
+    else if (modx <= 2.0)
+    {
+        return (1.0 / 120.0) * (-10974.0 + 12270.0 * r - 5340.0 * r2 + 1140.0 * r3 - 120.0 * r4 + 5.0 * r5);
+    }
+    else if (modx <= 3.0)
+    {
+        return (1.0 / 120.0) * (7776.0 - 6480.0 * r + 2160.0 * r2 - 360.0 * r3 + 30.0 * r4 - r5);
+    }
+    return 0.0;
+}
+
+// Number of markers whose kernel weights are evaluated together.  The weight
+// computations are written as loops over the markers in a batch (with the
+// markers stored contiguously) so that they map directly onto SIMD lanes: a
+// batch of eight markers fills two AVX2 or one AVX-512 register per weight.
+static const int MARKER_BATCH_SIZE = 8;
+
+/*!
+ * Kernel policy for a delta function phi with a support of width grid cells.
+ * Odd-width stencils are centered on the cell containing the point; even-width
+ * stencils are centered on the cell vertex nearest to the point.
+ *
+ * computeWeights() evaluates the one-dimensional stencils of n markers at
+ * once: X_o_dx[k] is the position of marker k, relative to the lower corner of
+ * the patch, in units of the grid spacing, lower[k] is set to the first index
+ * of its stencil (again relative to the patch), and w[j][k] is set to the
+ * weight of the j-th stencil point.
+ */
+template <int W, double (*phi)(double)>
+struct DeltaKernel
+{
+    static const int width = W;
+
+    static inline void
+    computeWeights(const double* const X_o_dx, const int n, int* const lower, double (*const w)[MARKER_BATCH_SIZE])
+    {
+        for (int k = 0; k < n; ++k)
+        {
+            const double X_floor = std::floor(X_o_dx[k]);
+            const int shift = (W % 2 == 0 && X_o_dx[k] - X_floor >= 0.5) ? 1 : 0;
+            lower[k] = static_cast<int>(X_floor) - W / 2 + shift;
+        }
+        for (int j = 0; j < W; ++j)
+        {
+            for (int k = 0; k < n; ++k)
+            {
+                w[j][k] = phi(X_o_dx[k] - (static_cast<double>(lower[k] + j) + 0.5));
+            }
+        }
+        return;
+    }
+};
+
+/*!
+ * Kernel policy for the IB 4-point delta function.  The weights are evaluated
+ * simultaneously using a closed-form expression that requires only a single
+ * square root.
+ */
+struct IB4Kernel
+{
+    static const int width = 4;
+
+    static inline void
+    computeWeights(const double* const X_o_dx, const int n, int* const lower, double (*const w)[MARKER_BATCH_SIZE])
+    {
+        for (int k = 0; k < n; ++k)
+        {
+            lower[k] = NINT(X_o_dx[k]) - 2;
+            const double r = X_o_dx[k] - (static_cast<double>(lower[k] + 1) + 0.5);
+            const double q = std::sqrt(1.0 + 4.0 * r * (1.0 - r));
+            w[0][k] = 0.125 * (3.0 - 2.0 * r - q);
+            w[1][k] = 0.125 * (3.0 - 2.0 * r + q);
+            w[2][k] = 0.125 * (1.0 + 2.0 * r + q);
+            w[3][k] = 0.125 * (1.0 + 2.0 * r - q);
+        }
+        return;
+    }
+};
+
+/*!
+ * Kernel policy for the IB 6-point delta function.  As with IB4Kernel, the
+ * weights are evaluated simultaneously using a closed-form expression.
+ */
+struct IB6Kernel
+{
+    static const int width = 6;
+
+    static inline void
+    computeWeights(const double* const X_o_dx, const int n, int* const lower, double (*const w)[MARKER_BATCH_SIZE])
+    {
+        static const double K = (59.0 / 60.0) * (1.0 - std::sqrt(1.0 - (3220.0 / 3481.0)));
+        static const double K_sign = std::copysign(1.0, (3.0 / 2.0) - K);
+        for (int k = 0; k < n; ++k)
+        {
+            lower[k] = NINT(X_o_dx[k]) - 3;
+            const double r = 1.0 - X_o_dx[k] + (static_cast<double>(lower[k] + 2) + 0.5);
+            const double r2 = r * r;
+            const double r3 = r2 * r;
+            const double r4 = r2 * r2;
+            const double r6 = r4 * r2;
+
+            const double alpha = 28.0;
+            const double beta =
+                (9.0 / 4.0) - (3.0 / 2.0) * (K + r2) + ((22.0 / 3.0) - 7.0 * K) * r - (7.0 / 3.0) * r3;
+            const double gamma = 0.25 * (((161.0 / 36.0) - (59.0 / 6.0) * K + 5.0 * K * K) * 0.5 * r2 +
+                                         (-(109.0 / 24.0) + 5.0 * K) * (1.0 / 3.0) * r4 + (5.0 / 18.0) * r6);
+            const double discr = beta * beta - 4.0 * alpha * gamma;
+
+            const double pm3 = (-beta + K_sign * std::sqrt(discr)) / (2.0 * alpha);
+            w[0][k] = pm3;
+            w[1][k] = -3.0 * pm3 - (1.0 / 16.0) + (1.0 / 8.0) * (K + r2) + (1.0 / 12.0) * (3.0 * K - 1.0) * r +
+                      (1.0 / 12.0) * r3;
+            w[2][k] = 2.0 * pm3 + (1.0 / 4.0) + (1.0 / 6.0) * (4.0 - 3.0 * K) * r - (1.0 / 6.0) * r3;
+            w[3][k] = 2.0 * pm3 + (5.0 / 8.0) - (1.0 / 4.0) * (K + r2);
+            w[4][k] = -3.0 * pm3 + (1.0 / 4.0) - (1.0 / 6.0) * (4.0 - 3.0 * K) * r + (1.0 / 6.0) * r3;
+            w[5][k] = pm3 - (1.0 / 16.0) + (1.0 / 8.0) * (K + r2) - (1.0 / 12.0) * (3.0 * K - 1.0) * r -
+                      (1.0 / 12.0) * r3;
+        }
+        return;
+    }
+};
+
+using PiecewiseLinearKernel = DeltaKernel<2, &piecewise_linear_delta>;
+using IB3Kernel = DeltaKernel<3, &ib_3_delta>;
+using BSpline3Kernel = DeltaKernel<3, &bspline_3_delta>;
+using BSpline4Kernel = DeltaKernel<4, &bspline_4_delta>;
+using BSpline5Kernel = DeltaKernel<5, &bspline_5_delta>;
+using BSpline6Kernel = DeltaKernel<6, &bspline_6_delta>;
+
+/*!
+ * Description of a ghosted, Fortran-ordered patch data array.
+ */
+struct PatchArrayLayout
+{
+    PatchArrayLayout(const int* const ilower, const int* const iupper, const int* const gcw)
+    {
+        int stride = 1;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            patch_lower[d] = ilower[d];
+            ig_lower[d] = ilower[d] - gcw[d];
+            ig_upper[d] = iupper[d] + gcw[d];
+            strides[d] = stride;
+            stride *= ig_upper[d] - ig_lower[d] + 1;
+        }
+        depth_stride = stride;
+    }
+
+    int offset(const int* const ic) const
+    {
+        int off = 0;
+        for (unsigned int d = 0; d < NDIM; ++d) off += (ic[d] - ig_lower[d]) * strides[d];
+        return off;
+    }
+
+    int patch_lower[NDIM], ig_lower[NDIM], ig_upper[NDIM], strides[NDIM];
+    int depth_stride;
+};
+
+/*!
+ * Kernel stencils (lower corners and tensor-product factors) for a batch of
+ * markers.
+ */
+template <class Kernel>
+struct StencilBatch
+{
+    int ic_lower[NDIM][MARKER_BATCH_SIZE];
+    double w[NDIM][Kernel::width][MARKER_BATCH_SIZE];
+};
+
+/*!
+ * Compute the stencils and weights of the kernel for the n markers listed in
+ * local_indices, whose (periodic) shifts are stored in X_shift.
+ */
+template <class Kernel>
+inline void
+compute_stencil_batch(const double* const X,
+                      const double* const X_shift,
+                      const int* const local_indices,
+                      const int n,
+                      const double* const x_lower,
+                      const double* const dx,
+                      const PatchArrayLayout& layout,
+                      StencilBatch<Kernel>& stencils)
+{
+    double X_o_dx[MARKER_BATCH_SIZE];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        for (int k = 0; k < n; ++k)
+        {
+            X_o_dx[k] = (X[NDIM * local_indices[k] + d] + X_shift[NDIM * k + d] - x_lower[d]) / dx[d];
+        }
+        if (n == MARKER_BATCH_SIZE)
+        {
+            Kernel::computeWeights(X_o_dx, MARKER_BATCH_SIZE, stencils.ic_lower[d], stencils.w[d]);
+        }
+        else
+        {
+            Kernel::computeWeights(X_o_dx, n, stencils.ic_lower[d], stencils.w[d]);
+        }
+        for (int k = 0; k < n; ++k)
+        {
+            stencils.ic_lower[d][k] += layout.patch_lower[d];
+        }
+    }
+    return;
+}
+
+/*!
+ * Extract the stencil of marker k from a batch.  The return value indicates
+ * whether the entire stencil lies within the ghost box of the patch data.  If
+ * it does not, istart and istop are set to the subset of the stencil that
+ * does.
+ */
+template <class Kernel>
+inline bool
+get_stencil(const StencilBatch<Kernel>& stencils,
+            const int k,
+            const PatchArrayLayout& layout,
+            int* const ic_lower,
+            int* const istart,
+            int* const istop,
+            double (*const w)[Kernel::width])
+{
+    static const int W = Kernel::width;
+    bool interior = true;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        ic_lower[d] = stencils.ic_lower[d][k];
+        for (int j = 0; j < W; ++j) w[d][j] = stencils.w[d][j][k];
+        istart[d] = std::max(layout.ig_lower[d] - ic_lower[d], 0);
+        istop[d] = (W - 1) - std::max(ic_lower[d] + (W - 1) - layout.ig_upper[d], 0);
+        interior = interior && istart[d] == 0 && istop[d] == W - 1;
+    }
+    return interior;
+}
+
+/*!
+ * Interpolate to a batch of n markers with precomputed stencils.
+ */
+template <class Kernel>
+void
+interpolate_batch(double* const Q,
+                  const double* const q,
+                  const PatchArrayLayout& layout,
+                  const int q_depth,
+                  const int* const local_indices,
+                  const int n,
+                  const StencilBatch<Kernel>& stencils)
+{
+    static const int W = Kernel::width;
+    int ic_lower[NDIM], istart[NDIM], istop[NDIM];
+    double w[NDIM][W];
+    for (int k = 0; k < n; ++k)
+    {
+        const int s = local_indices[k];
+        const bool interior = get_stencil<Kernel>(stencils, k, layout, ic_lower, istart, istop, w);
+        const double* const q_stencil = q + layout.offset(ic_lower);
+        for (int d = 0; d < q_depth; ++d)
+        {
+            const double* const u = q_stencil + d * layout.depth_stride;
+            double V = 0.0;
+            if (LIKELY(interior))
+            {
+#if (NDIM == 3)
+                for (int i2 = 0; i2 < W; ++i2)
+                {
+#endif
+                    for (int i1 = 0; i1 < W; ++i1)
+                    {
+#if (NDIM == 2)
+                        const double w12 = w[1][i1];
+                        const double* const u_row = u + i1 * layout.strides[1];
+#endif
+#if (NDIM == 3)
+                        const double w12 = w[1][i1] * w[2][i2];
+                        const double* const u_row = u + i1 * layout.strides[1] + i2 * layout.strides[2];
+#endif
+                        double V_row = 0.0;
+                        for (int i0 = 0; i0 < W; ++i0)
+                        {
+                            V_row += w[0][i0] * u_row[i0];
+                        }
+                        V += w12 * V_row;
+                    }
+#if (NDIM == 3)
+                }
+#endif
+            }
+            else
+            {
+#if (NDIM == 3)
+                for (int i2 = istart[2]; i2 <= istop[2]; ++i2)
+                {
+#endif
+                    for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+                    {
+#if (NDIM == 2)
+                        const double w12 = w[1][i1];
+                        const double* const u_row = u + i1 * layout.strides[1];
+#endif
+#if (NDIM == 3)
+                        const double w12 = w[1][i1] * w[2][i2];
+                        const double* const u_row = u + i1 * layout.strides[1] + i2 * layout.strides[2];
+#endif
+                        double V_row = 0.0;
+                        for (int i0 = istart[0]; i0 <= istop[0]; ++i0)
+                        {
+                            V_row += w[0][i0] * u_row[i0];
+                        }
+                        V += w12 * V_row;
+                    }
+#if (NDIM == 3)
+                }
+#endif
+            }
+            Q[d + s * q_depth] = V;
+        }
+    }
+    return;
+} // interpolate_batch
+
+template <class Kernel>
+void
+interpolate_compiled(double* const Q,
+                     const double* const X,
+                     const double* const q,
+                     const PatchArrayLayout& layout,
+                     const int q_depth,
+                     const double* const x_lower,
+                     const double* const dx,
+                     const int* const local_indices,
+                     const double* const X_shift,
+                     const int num_local_indices)
+{
+    StencilBatch<Kernel> stencils;
+    for (int l0 = 0; l0 < num_local_indices; l0 += MARKER_BATCH_SIZE)
+    {
+        const int n = std::min(MARKER_BATCH_SIZE, num_local_indices - l0);
+        compute_stencil_batch<Kernel>(
+            X, &X_shift[NDIM * l0], &local_indices[l0], n, x_lower, dx, layout, stencils);
+        interpolate_batch<Kernel>(Q, q, layout, q_depth, &local_indices[l0], n, stencils);
+    }
+    return;
+} // interpolate_compiled
+
+/*!
+ * Spread from a batch of n markers with precomputed stencils.  The spread
+ * values are scaled by fac.
+ */
+template <class Kernel>
+void
+spread_batch(double* const q,
+             const PatchArrayLayout& layout,
+             const int q_depth,
+             const double fac,
+             const double* const Q,
+             const int* const local_indices,
+             const int n,
+             const StencilBatch<Kernel>& stencils)
+{
+    static const int W = Kernel::width;
+    int ic_lower[NDIM], istart[NDIM], istop[NDIM];
+    double w[NDIM][W];
+    for (int k = 0; k < n; ++k)
+    {
+        const int s = local_indices[k];
+        const bool interior = get_stencil<Kernel>(stencils, k, layout, ic_lower, istart, istop, w);
+        double* const q_stencil = q + layout.offset(ic_lower);
+        for (int d = 0; d < q_depth; ++d)
+        {
+            double* const u = q_stencil + d * layout.depth_stride;
+            const double V = Q[d + s * q_depth] * fac;
+            if (LIKELY(interior))
+            {
+#if (NDIM == 3)
+                for (int i2 = 0; i2 < W; ++i2)
+                {
+#endif
+                    for (int i1 = 0; i1 < W; ++i1)
+                    {
+#if (NDIM == 2)
+                        const double Vw12 = V * w[1][i1];
+                        double* const u_row = u + i1 * layout.strides[1];
+#endif
+#if (NDIM == 3)
+                        const double Vw12 = V * w[1][i1] * w[2][i2];
+                        double* const u_row = u + i1 * layout.strides[1] + i2 * layout.strides[2];
+#endif
+                        for (int i0 = 0; i0 < W; ++i0)
+                        {
+                            u_row[i0] += w[0][i0] * Vw12;
+                        }
+                    }
+#if (NDIM == 3)
+                }
+#endif
+            }
+            else
+            {
+#if (NDIM == 3)
+                for (int i2 = istart[2]; i2 <= istop[2]; ++i2)
+                {
+#endif
+                    for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+                    {
+#if (NDIM == 2)
+                        const double Vw12 = V * w[1][i1];
+                        double* const u_row = u + i1 * layout.strides[1];
+#endif
+#if (NDIM == 3)
+                        const double Vw12 = V * w[1][i1] * w[2][i2];
+                        double* const u_row = u + i1 * layout.strides[1] + i2 * layout.strides[2];
+#endif
+                        for (int i0 = istart[0]; i0 <= istop[0]; ++i0)
+                        {
+                            u_row[i0] += w[0][i0] * Vw12;
+                        }
+                    }
+#if (NDIM == 3)
+                }
+#endif
+            }
+        }
+    }
+    return;
+} // spread_batch
+
+template <class Kernel>
+void
+spread_compiled(double* const q,
+                const PatchArrayLayout& layout,
+                const int q_depth,
+                const double* const x_lower,
+                const double* const dx,
+                const double* const Q,
+                const double* const X,
+                const int* const local_indices,
+                const double* const X_shift,
+                const int num_local_indices)
+{
+    double fac = 1.0;
+    for (unsigned int d = 0; d < NDIM; ++d) fac /= dx[d];
+    StencilBatch<Kernel> stencils;
+    for (int l0 = 0; l0 < num_local_indices; l0 += MARKER_BATCH_SIZE)
+    {
+        const int n = std::min(MARKER_BATCH_SIZE, num_local_indices - l0);
+        compute_stencil_batch<Kernel>(
+            X, &X_shift[NDIM * l0], &local_indices[l0], n, x_lower, dx, layout, stencils);
+        spread_batch<Kernel>(q, layout, q_depth, fac, Q, &local_indices[l0], n, stencils);
+    }
+    return;
+} // spread_compiled
+
+/*!
+ * Precomputed kernel stencils for the markers on a patch.  A plan can be reused
+ * for as long as the marker positions do not change, in which case
+ * interpolation and spreading reduce to gathering from and scattering to the
+ * patch data.
+ */
+struct InteractionPlan
+{
+    virtual ~InteractionPlan() = default;
+
+    // The marker indices and shifted marker positions for which the plan was
+    // built.
+    std::vector<int> local_indices;
+    std::vector<double> X;
+
+    // The marker indices in the order in which the markers are processed.
+    std::vector<int> marker_local_indices;
+
+    // The value of the plan use counter when the plan was last used.
+    unsigned long last_use = 0;
+};
+
+template <class Kernel>
+struct KernelInteractionPlan : public InteractionPlan
+{
+    std::vector<StencilBatch<Kernel> > stencils;
+};
+
+template <class Kernel>
+std::unique_ptr<InteractionPlan>
+build_interaction_plan(const double* const X,
+                       const std::vector<int>& local_indices,
+                       const std::vector<double>& periodic_shifts,
+                       const double* const x_lower,
+                       const double* const dx,
+                       const PatchArrayLayout& layout)
+{
+    std::unique_ptr<KernelInteractionPlan<Kernel> > plan(new KernelInteractionPlan<Kernel>());
+    const int num_local_indices = static_cast<int>(local_indices.size());
+    plan->marker_local_indices = local_indices;
+    plan->stencils.resize((num_local_indices + MARKER_BATCH_SIZE - 1) / MARKER_BATCH_SIZE);
+    for (int l0 = 0, b = 0; l0 < num_local_indices; l0 += MARKER_BATCH_SIZE, ++b)
+    {
+        const int n = std::min(MARKER_BATCH_SIZE, num_local_indices - l0);
+        compute_stencil_batch<Kernel>(
+            X, &periodic_shifts[NDIM * l0], &local_indices[l0], n, x_lower, dx, layout, plan->stencils[b]);
+    }
+    return std::unique_ptr<InteractionPlan>(plan.release());
+} // build_interaction_plan
+
+template <class Kernel>
+void
+interpolate_planned(double* const Q,
+                    const double* const q,
+                    const PatchArrayLayout& layout,
+                    const int q_depth,
+                    const InteractionPlan& plan)
+{
+    const auto& kernel_plan = static_cast<const KernelInteractionPlan<Kernel>&>(plan);
+    const int num_local_indices = static_cast<int>(plan.marker_local_indices.size());
+    for (int l0 = 0, b = 0; l0 < num_local_indices; l0 += MARKER_BATCH_SIZE, ++b)
+    {
+        const int n = std::min(MARKER_BATCH_SIZE, num_local_indices - l0);
+        interpolate_batch<Kernel>(
+            Q, q, layout, q_depth, &plan.marker_local_indices[l0], n, kernel_plan.stencils[b]);
+    }
+    return;
+} // interpolate_planned
+
+template <class Kernel>
+void
+spread_planned(double* const q,
+               const PatchArrayLayout& layout,
+               const int q_depth,
+               const double* const dx,
+               const double* const Q,
+               const InteractionPlan& plan)
+{
+    const auto& kernel_plan = static_cast<const KernelInteractionPlan<Kernel>&>(plan);
+    double fac = 1.0;
+    for (unsigned int d = 0; d < NDIM; ++d) fac /= dx[d];
+    const int num_local_indices = static_cast<int>(plan.marker_local_indices.size());
+    for (int l0 = 0, b = 0; l0 < num_local_indices; l0 += MARKER_BATCH_SIZE, ++b)
+    {
+        const int n = std::min(MARKER_BATCH_SIZE, num_local_indices - l0);
+        spread_batch<Kernel>(
+            q, layout, q_depth, fac, Q, &plan.marker_local_indices[l0], n, kernel_plan.stencils[b]);
+    }
+    return;
+} // spread_planned
+
+using CompiledInterpFcn = void (*)(double*,
+                                   const double*,
+                                   const double*,
+                                   const PatchArrayLayout&,
+                                   int,
+                                   const double*,
+                                   const double*,
+                                   const int*,
+                                   const double*,
+                                   int);
+
+using CompiledSpreadFcn = void (*)(double*,
+                                   const PatchArrayLayout&,
+                                   int,
+                                   const double*,
+                                   const double*,
+                                   const double*,
+                                   const double*,
+                                   const int*,
+                                   const double*,
+                                   int);
+
+using BuildInteractionPlanFcn = std::unique_ptr<InteractionPlan> (*)(const double*,
+                                                                      const std::vector<int>&,
+                                                                      const std::vector<double>&,
+                                                                      const double*,
+                                                                      const double*,
+                                                                      const PatchArrayLayout&);
+
+using PlannedInterpFcn = void (*)(double*, const double*, const PatchArrayLayout&, int, const InteractionPlan&);
+
+using KernelWeightsFcn = int (*)(double, int&, double*);
+
+using PlannedSpreadFcn =
+    void (*)(double*, const PatchArrayLayout&, int, const double*, const double*, const InteractionPlan&);
+
+struct CompiledKernel
+{
+    CompiledInterpFcn interp;
+    CompiledSpreadFcn spread;
+    BuildInteractionPlanFcn build_plan;
+    PlannedInterpFcn interp_planned;
+    PlannedSpreadFcn spread_planned;
+    KernelWeightsFcn weights;
+};
+
+template <class Kernel>
+int
+compute_kernel_weights(const double X_o_dx, int& lower, double* const w)
+{
+    double w_batch[Kernel::width][MARKER_BATCH_SIZE];
+    Kernel::computeWeights(&X_o_dx, 1, &lower, w_batch);
+    for (int j = 0; j < Kernel::width; ++j) w[j] = w_batch[j][0];
+    return Kernel::width;
+}
+
+template <class Kernel>
+CompiledKernel
+make_compiled_kernel()
+{
+    CompiledKernel kernel = { &interpolate_compiled<Kernel>,
+                              &spread_compiled<Kernel>,
+                              &build_interaction_plan<Kernel>,
+                              &interpolate_planned<Kernel>,
+                              &spread_planned<Kernel>,
+                              &compute_kernel_weights<Kernel> };
+    return kernel;
+}
+
+/*!
+ * Look up the compiled implementation of the named kernel function.  Returns
+ * nullptr if no compiled implementation is available, in which case the
+ * Fortran implementation is used.
+ */
+const CompiledKernel*
+get_compiled_kernel(const std::string& kernel_fcn)
+{
+    static const std::map<std::string, CompiledKernel> compiled_kernels = {
+        { "PIECEWISE_LINEAR", make_compiled_kernel<PiecewiseLinearKernel>() },
+        { "IB_3", make_compiled_kernel<IB3Kernel>() },
+        { "IB_4", make_compiled_kernel<IB4Kernel>() },
+        { "IB_6", make_compiled_kernel<IB6Kernel>() },
+        { "BSPLINE_3", make_compiled_kernel<BSpline3Kernel>() },
+        { "BSPLINE_4", make_compiled_kernel<BSpline4Kernel>() },
+        { "BSPLINE_5", make_compiled_kernel<BSpline5Kernel>() },
+        { "BSPLINE_6", make_compiled_kernel<BSpline6Kernel>() }
+    };
+    auto it = compiled_kernels.find(kernel_fcn);
+    return it != compiled_kernels.end() ? &it->second : nullptr;
+}
+
+// Whether to always use the Fortran implementations of the kernel functions.
+bool s_use_fortran_kernels = false;
+
+// Orderings in which the markers on a patch may be processed.
+enum MarkerOrdering
+{
+    NO_MARKER_ORDERING,
+    ROW_MAJOR_MARKER_ORDERING,
+    MORTON_MARKER_ORDERING
+};
+
+MarkerOrdering s_marker_ordering = NO_MARKER_ORDERING;
+
+// Spread the lower bits of i so that consecutive bits are NDIM apart.
+inline std::uint64_t
+spread_bits(std::uint64_t i)
+{
+    std::uint64_t m = 0;
+    for (unsigned int b = 0; b < 64 / NDIM; ++b)
+    {
+        m |= ((i >> b) & 1) << (NDIM * b);
+    }
+    return m;
+}
+
+/*!
+ * Reorder the markers listed in local_indices (along with their periodic
+ * shifts) by the Cartesian cell index (within the ghost box of the patch data)
+ * of the shifted marker positions, so that consecutive markers access
+ * neighboring parts of the patch data array.  Data are always read from and
+ * written to the Lagrangian arrays via the marker indices, so the results do
+ * not need to be permuted back to the original ordering.
+ */
+void
+reorder_markers(std::vector<int>& reordered_local_indices,
+                std::vector<double>& reordered_periodic_shifts,
+                const std::vector<int>& local_indices,
+                const std::vector<double>& periodic_shifts,
+                const double* const X,
+                const Box<NDIM>& q_data_box,
+                const IntVector<NDIM>& q_gcw,
+                const double* const x_lower,
+                const double* const dx)
+{
+    const int num_local_indices = static_cast<int>(local_indices.size());
+    std::array<int, NDIM> num_cells;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        num_cells[d] = q_data_box.numberCells(d) + 2 * q_gcw(d);
+    }
+    std::vector<std::pair<std::uint64_t, int> > keys(num_local_indices);
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        const int s = local_indices[l];
+        std::uint64_t key = 0;
+        for (int d = NDIM - 1; d >= 0; --d)
+        {
+            const double X_o_dx = (X[NDIM * s + d] + periodic_shifts[NDIM * l + d] - x_lower[d]) / dx[d];
+            const int ic = std::min(std::max(static_cast<int>(std::floor(X_o_dx)) + q_gcw(d), 0), num_cells[d] - 1);
+            if (s_marker_ordering == MORTON_MARKER_ORDERING)
+            {
+                key |= spread_bits(static_cast<std::uint64_t>(ic)) << d;
+            }
+            else
+            {
+                key = key * static_cast<std::uint64_t>(num_cells[d]) + static_cast<std::uint64_t>(ic);
+            }
+        }
+        keys[l] = std::make_pair(key, l);
+    }
+    std::sort(keys.begin(), keys.end());
+    reordered_local_indices.resize(num_local_indices);
+    reordered_periodic_shifts.resize(NDIM * num_local_indices);
+    for (int k = 0; k < num_local_indices; ++k)
+    {
+        const int l = keys[k].second;
+        reordered_local_indices[k] = local_indices[l];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            reordered_periodic_shifts[NDIM * k + d] = periodic_shifts[NDIM * l + d];
+        }
+    }
+    return;
+} // reorder_markers
+
+// Whether to spread using multiple threads.
+bool s_use_threaded_spreading = false;
+
+/*!
+ * Spread using multiple threads.  The markers are binned into slabs along the
+ * last coordinate axis that are at least as thick as the kernel stencil, so
+ * that markers in slabs that are not adjacent never update the same grid cell.
+ * The even slabs are then processed concurrently, followed by the odd slabs.
+ * Because each slab is processed in the original marker order, the results do
+ * not depend on the number of threads.
+ */
+void
+spread_threaded(const CompiledKernel& kernel,
+                double* const q,
+                const PatchArrayLayout& layout,
+                const int q_depth,
+                const double* const x_lower,
+                const double* const dx,
+                const double* const Q,
+                const double* const X,
+                const std::vector<int>& local_indices,
+                const std::vector<double>& periodic_shifts,
+                const int stencil_size)
+{
+    static const unsigned int axis = NDIM - 1;
+    const int num_local_indices = static_cast<int>(local_indices.size());
+    const int num_cells = layout.ig_upper[axis] - layout.ig_lower[axis] + 1;
+    const int cell_offset = layout.patch_lower[axis] - layout.ig_lower[axis];
+    const int num_slabs = (num_cells + stencil_size - 1) / stencil_size;
+    std::vector<std::vector<int> > slab_local_indices(num_slabs);
+    std::vector<std::vector<double> > slab_periodic_shifts(num_slabs);
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        const int s = local_indices[l];
+        const double X_o_dx = (X[NDIM * s + axis] + periodic_shifts[NDIM * l + axis] - x_lower[axis]) / dx[axis];
+        const int ic = std::min(std::max(static_cast<int>(std::floor(X_o_dx)) + cell_offset, 0), num_cells - 1);
+        const int slab = ic / stencil_size;
+        slab_local_indices[slab].push_back(s);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            slab_periodic_shifts[slab].push_back(periodic_shifts[NDIM * l + d]);
+        }
+    }
+    for (int color = 0; color < 2; ++color)
+    {
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int slab = color; slab < num_slabs; slab += 2)
+        {
+            if (slab_local_indices[slab].empty()) continue;
+            kernel.spread(q,
+                          layout,
+                          q_depth,
+                          x_lower,
+                          dx,
+                          Q,
+                          X,
+                          &slab_local_indices[slab][0],
+                          &slab_periodic_shifts[slab][0],
+                          static_cast<int>(slab_local_indices[slab].size()));
+        }
+    }
+    return;
+} // spread_threaded
+
+// Whether to cache interaction plans, and the maximum number of cached plans.
+bool s_cache_interaction_plans = false;
+int s_max_cached_interaction_plans = 1024;
+
+// Cached interaction plans, indexed by kernel function and by a hash of the
+// patch geometry and the marker indices and positions.
+using InteractionPlanKey = std::pair<std::string, std::uint64_t>;
+std::map<InteractionPlanKey, std::unique_ptr<InteractionPlan> > s_interaction_plans;
+unsigned long s_interaction_plan_counter = 0;
+
+inline void
+hash_combine(std::uint64_t& hash, const std::uint64_t value)
+{
+    hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    return;
+}
+
+inline std::uint64_t
+hash_value(const double value)
+{
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+/*!
+ * Return an interaction plan for the markers listed in local_indices, either
+ * by retrieving a cached plan that was built for the same patch geometry and
+ * the same marker indices and (shifted) positions, or by building a new one.
+ */
+const InteractionPlan&
+get_interaction_plan(const CompiledKernel& kernel,
+                     const std::string& kernel_fcn,
+                     const Box<NDIM>& q_data_box,
+                     const IntVector<NDIM>& q_gcw,
+                     const PatchArrayLayout& layout,
+                     const double* const x_lower,
+                     const double* const dx,
+                     const double* const X,
+                     const std::vector<int>& local_indices,
+                     const std::vector<double>& periodic_shifts)
+{
+    const int num_local_indices = static_cast<int>(local_indices.size());
+    std::uint64_t hash = static_cast<std::uint64_t>(s_marker_ordering);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        hash_combine(hash, static_cast<std::uint64_t>(layout.ig_lower[d]));
+        hash_combine(hash, static_cast<std::uint64_t>(layout.ig_upper[d]));
+        hash_combine(hash, static_cast<std::uint64_t>(layout.patch_lower[d]));
+        hash_combine(hash, hash_value(x_lower[d]));
+        hash_combine(hash, hash_value(dx[d]));
+    }
+    std::vector<double> X_shifted(NDIM * num_local_indices);
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        const int s = local_indices[l];
+        hash_combine(hash, static_cast<std::uint64_t>(s));
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X_shifted[NDIM * l + d] = X[NDIM * s + d] + periodic_shifts[NDIM * l + d];
+            hash_combine(hash, hash_value(X_shifted[NDIM * l + d]));
+        }
+    }
+
+    std::unique_ptr<InteractionPlan>& plan = s_interaction_plans[std::make_pair(kernel_fcn, hash)];
+    if (!plan || plan->local_indices != local_indices || plan->X != X_shifted)
+    {
+        // Evict the least recently used plans if the cache is full.
+        while (static_cast<int>(s_interaction_plans.size()) > std::max(s_max_cached_interaction_plans, 1))
+        {
+            auto lru = s_interaction_plans.end();
+            for (auto it = s_interaction_plans.begin(); it != s_interaction_plans.end(); ++it)
+            {
+                if (it->second.get() == plan.get()) continue;
+                if (lru == s_interaction_plans.end() || it->second->last_use < lru->second->last_use) lru = it;
+            }
+            s_interaction_plans.erase(lru);
+        }
+
+        if (s_marker_ordering != NO_MARKER_ORDERING && num_local_indices > 1)
+        {
+            std::vector<int> reordered_local_indices;
+            std::vector<double> reordered_periodic_shifts;
+            reorder_markers(reordered_local_indices,
+                            reordered_periodic_shifts,
+                            local_indices,
+                            periodic_shifts,
+                            X,
+                            q_data_box,
+                            q_gcw,
+                            x_lower,
+                            dx);
+            plan = kernel.build_plan(X, reordered_local_indices, reordered_periodic_shifts, x_lower, dx, layout);
+        }
+        else
+        {
+            plan = kernel.build_plan(X, local_indices, periodic_shifts, x_lower, dx, layout);
+        }
+        plan->local_indices = local_indices;
+        plan->X = std::move(X_shifted);
+    }
+    plan->last_use = ++s_interaction_plan_counter;
+    return *plan;
+} // get_interaction_plan
 } // namespace
 
 double (*LEInteractor::s_kernel_fcn)(double r) = &ib4_kernel_fcn;
 int LEInteractor::s_kernel_fcn_stencil_size = 4;
 
-void LEInteractor::setFromDatabase(Pointer<Database> /*db*/)
+void
+LEInteractor::setFromDatabase(Pointer<Database> db)
 {
-    // intentionally blank
+    if (!db) return;
+    if (db->keyExists("use_fortran_kernels")) s_use_fortran_kernels = db->getBool("use_fortran_kernels");
+    if (db->keyExists("use_threaded_spreading"))
+    {
+        s_use_threaded_spreading = db->getBool("use_threaded_spreading");
+#if !defined(_OPENMP)
+        if (s_use_threaded_spreading)
+        {
+            TBOX_WARNING("LEInteractor::setFromDatabase():\n"
+                         << "  use_threaded_spreading = TRUE requires IBTK to be compiled with OpenMP support\n"
+                         << "  spreading will be performed serially" << std::endl);
+            s_use_threaded_spreading = false;
+        }
+#endif
+    }
+    if (db->keyExists("cache_interaction_plans"))
+    {
+        s_cache_interaction_plans = db->getBool("cache_interaction_plans");
+        if (!s_cache_interaction_plans) clearInteractionPlans();
+    }
+    if (db->keyExists("max_cached_interaction_plans"))
+    {
+        s_max_cached_interaction_plans = db->getInteger("max_cached_interaction_plans");
+    }
+    if (db->keyExists("marker_ordering"))
+    {
+        const std::string marker_ordering = db->getString("marker_ordering");
+        if (marker_ordering == "NONE")
+        {
+            s_marker_ordering = NO_MARKER_ORDERING;
+        }
+        else if (marker_ordering == "ROW_MAJOR")
+        {
+            s_marker_ordering = ROW_MAJOR_MARKER_ORDERING;
+        }
+        else if (marker_ordering == "MORTON")
+        {
+            s_marker_ordering = MORTON_MARKER_ORDERING;
+        }
+        else
+        {
+            TBOX_ERROR("LEInteractor::setFromDatabase():\n"
+                       << "  unknown marker ordering " << marker_ordering << "\n"
+                       << "  valid choices are: NONE, ROW_MAJOR, MORTON" << std::endl);
+        }
+    }
     return;
 }
 
@@ -1327,6 +2374,22 @@ void
 LEInteractor::printClassData(std::ostream& os)
 {
     os << "LEInteractor::printClassData():\n";
+    os << "  use_fortran_kernels = " << (s_use_fortran_kernels ? "TRUE" : "FALSE") << "\n";
+    os << "  use_threaded_spreading = " << (s_use_threaded_spreading ? "TRUE" : "FALSE") << "\n";
+    os << "  cache_interaction_plans = " << (s_cache_interaction_plans ? "TRUE" : "FALSE") << "\n";
+    os << "  max_cached_interaction_plans = " << s_max_cached_interaction_plans << "\n";
+    os << "  marker_ordering = "
+       << (s_marker_ordering == MORTON_MARKER_ORDERING ?
+               "MORTON" :
+               s_marker_ordering == ROW_MAJOR_MARKER_ORDERING ? "ROW_MAJOR" : "NONE")
+       << "\n";
+    return;
+}
+
+void
+LEInteractor::clearInteractionPlans()
+{
+    s_interaction_plans.clear();
     return;
 }
 
@@ -1360,6 +2423,18 @@ LEInteractor::getMinimumGhostWidth(const std::string& kernel_fcn)
     return static_cast<int>(floor(0.5 * getStencilSize(kernel_fcn))) + 1;
 }
 
+int
+LEInteractor::computeKernelWeights(const std::string& kernel_fcn, const double X_o_dx, int& lower, double* const w)
+{
+    const CompiledKernel* const compiled_kernel = get_compiled_kernel(kernel_fcn);
+    if (!compiled_kernel)
+    {
+        TBOX_ERROR("LEInteractor::computeKernelWeights()\n"
+                   << "  kernel function " << kernel_fcn << " does not provide explicit weights" << std::endl);
+    }
+    return compiled_kernel->weights(X_o_dx, lower, w);
+}
+
 template <class T>
 void
 LEInteractor::interpolate(Pointer<LData> Q_data,
@@ -3699,6 +4774,7 @@ LEInteractor::interpolate(double* const Q_data,
                           const std::string& interp_fcn,
                           const int axis)
 {
+    PerformanceMonitor::ScopedRegion region("LEInteractor::interpolate");
     const int stencil_size = getStencilSize(interp_fcn);
     const int min_ghosts = getMinimumGhostWidth(interp_fcn);
     const int q_gcw_min = q_gcw.min();
@@ -3714,7 +4790,57 @@ LEInteractor::interpolate(double* const Q_data,
     const int local_indices_size = static_cast<int>(local_indices.size());
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
-    if (interp_fcn == "PIECEWISE_CONSTANT")
+    const CompiledKernel* const compiled_kernel = s_use_fortran_kernels ? nullptr : get_compiled_kernel(interp_fcn);
+    const bool use_interaction_plan = compiled_kernel && s_cache_interaction_plans;
+    std::vector<int> reordered_local_indices;
+    std::vector<double> reordered_periodic_shifts;
+    const bool use_reordered_markers =
+        !use_interaction_plan && s_marker_ordering != NO_MARKER_ORDERING && local_indices_size > 1;
+    if (use_reordered_markers)
+    {
+        reorder_markers(reordered_local_indices,
+                        reordered_periodic_shifts,
+                        local_indices,
+                        periodic_shifts,
+                        X_data,
+                        q_data_box,
+                        q_gcw,
+                        x_lower,
+                        dx);
+    }
+    const std::vector<int>& marker_local_indices = use_reordered_markers ? reordered_local_indices : local_indices;
+    const std::vector<double>& marker_periodic_shifts =
+        use_reordered_markers ? reordered_periodic_shifts : periodic_shifts;
+    if (use_interaction_plan)
+    {
+        const PatchArrayLayout q_layout(ilower, iupper, q_gcw);
+        const InteractionPlan& plan = get_interaction_plan(*compiled_kernel,
+                                                           interp_fcn,
+                                                           q_data_box,
+                                                           q_gcw,
+                                                           q_layout,
+                                                           x_lower,
+                                                           dx,
+                                                           X_data,
+                                                           local_indices,
+                                                           periodic_shifts);
+        compiled_kernel->interp_planned(Q_data, q_data, q_layout, q_depth, plan);
+    }
+    else if (compiled_kernel)
+    {
+        const PatchArrayLayout q_layout(ilower, iupper, q_gcw);
+        compiled_kernel->interp(Q_data,
+                                X_data,
+                                q_data,
+                                q_layout,
+                                q_depth,
+                                x_lower,
+                                dx,
+                                &marker_local_indices[0],
+                                &marker_periodic_shifts[0],
+                                local_indices_size);
+    }
+    else if (interp_fcn == "PIECEWISE_CONSTANT")
     {
         LAGRANGIAN_PIECEWISE_CONSTANT_INTERP_FC(dx,
                                                 x_lower,
@@ -3740,8 +4866,8 @@ LEInteractor::interpolate(double* const Q_data,
                                                 q_gcw(2),
 #endif
                                                 q_data,
-                                                &local_indices[0],
-                                                &periodic_shifts[0],
+                                                &marker_local_indices[0],
+                                                &marker_periodic_shifts[0],
                                                 local_indices_size,
                                                 X_data,
                                                 Q_data);
@@ -3773,8 +4899,8 @@ LEInteractor::interpolate(double* const Q_data,
                                                   q_gcw(2),
 #endif
                                                   q_data,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
+                                                  &marker_local_indices[0],
+                                                  &marker_periodic_shifts[0],
                                                   local_indices_size,
                                                   X_data,
                                                   Q_data);
@@ -3805,8 +4931,8 @@ LEInteractor::interpolate(double* const Q_data,
                                               q_gcw(2),
 #endif
                                               q_data,
-                                              &local_indices[0],
-                                              &periodic_shifts[0],
+                                              &marker_local_indices[0],
+                                              &marker_periodic_shifts[0],
                                               local_indices_size,
                                               X_data,
                                               Q_data);
@@ -3837,8 +4963,8 @@ LEInteractor::interpolate(double* const Q_data,
                                              q_gcw(2),
 #endif
                                              q_data,
-                                             &local_indices[0],
-                                             &periodic_shifts[0],
+                                             &marker_local_indices[0],
+                                             &marker_periodic_shifts[0],
                                              local_indices_size,
                                              X_data,
                                              Q_data);
@@ -3869,8 +4995,8 @@ LEInteractor::interpolate(double* const Q_data,
                                   q_gcw(2),
 #endif
                                   q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
+                                  &marker_local_indices[0],
+                                  &marker_periodic_shifts[0],
                                   local_indices_size,
                                   X_data,
                                   Q_data);
@@ -3901,8 +5027,8 @@ LEInteractor::interpolate(double* const Q_data,
                                   q_gcw(2),
 #endif
                                   q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
+                                  &marker_local_indices[0],
+                                  &marker_periodic_shifts[0],
                                   local_indices_size,
                                   X_data,
                                   Q_data);
@@ -3933,8 +5059,8 @@ LEInteractor::interpolate(double* const Q_data,
                                      q_gcw(2),
 #endif
                                      q_data,
-                                     &local_indices[0],
-                                     &periodic_shifts[0],
+                                     &marker_local_indices[0],
+                                     &marker_periodic_shifts[0],
                                      local_indices_size,
                                      X_data,
                                      Q_data);
@@ -3965,8 +5091,8 @@ LEInteractor::interpolate(double* const Q_data,
                                   q_gcw(2),
 #endif
                                   q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
+                                  &marker_local_indices[0],
+                                  &marker_periodic_shifts[0],
                                   local_indices_size,
                                   X_data,
                                   Q_data);
@@ -3997,8 +5123,8 @@ LEInteractor::interpolate(double* const Q_data,
                                   q_gcw(2),
 #endif
                                   q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
+                                  &marker_local_indices[0],
+                                  &marker_periodic_shifts[0],
                                   local_indices_size,
                                   X_data,
                                   Q_data);
@@ -4029,8 +5155,8 @@ LEInteractor::interpolate(double* const Q_data,
                                        q_gcw(2),
 #endif
                                        q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
+                                       &marker_local_indices[0],
+                                       &marker_periodic_shifts[0],
                                        local_indices_size,
                                        X_data,
                                        Q_data);
@@ -4061,8 +5187,8 @@ LEInteractor::interpolate(double* const Q_data,
                                        q_gcw(2),
 #endif
                                        q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
+                                       &marker_local_indices[0],
+                                       &marker_periodic_shifts[0],
                                        local_indices_size,
                                        X_data,
                                        Q_data);
@@ -4093,8 +5219,8 @@ LEInteractor::interpolate(double* const Q_data,
                                        q_gcw(2),
 #endif
                                        q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
+                                       &marker_local_indices[0],
+                                       &marker_periodic_shifts[0],
                                        local_indices_size,
                                        X_data,
                                        Q_data);
@@ -4125,8 +5251,8 @@ LEInteractor::interpolate(double* const Q_data,
                                        q_gcw(2),
 #endif
                                        q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
+                                       &marker_local_indices[0],
+                                       &marker_periodic_shifts[0],
                                        local_indices_size,
                                        X_data,
                                        Q_data);
@@ -4143,8 +5269,8 @@ LEInteractor::interpolate(double* const Q_data,
                                x_lower,
                                x_upper,
                                dx,
-                               &local_indices[0],
-                               &periodic_shifts[0],
+                               &marker_local_indices[0],
+                               &marker_periodic_shifts[0],
                                local_indices_size);
     }
     else
@@ -4173,6 +5299,7 @@ LEInteractor::spread(double* const q_data,
                      const std::string& spread_fcn,
                      const int axis)
 {
+    PerformanceMonitor::ScopedRegion region("LEInteractor::spread");
     const int stencil_size = getStencilSize(spread_fcn);
     const int min_ghosts = getMinimumGhostWidth(spread_fcn);
     const int q_gcw_min = q_gcw.min();
@@ -4194,14 +5321,81 @@ LEInteractor::spread(double* const q_data,
     const int local_indices_size = static_cast<int>(local_indices.size());
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
-    if (spread_fcn == "PIECEWISE_CONSTANT")
+    const CompiledKernel* const compiled_kernel = s_use_fortran_kernels ? nullptr : get_compiled_kernel(spread_fcn);
+    const bool use_interaction_plan = compiled_kernel && s_cache_interaction_plans && !s_use_threaded_spreading;
+    std::vector<int> reordered_local_indices;
+    std::vector<double> reordered_periodic_shifts;
+    const bool use_reordered_markers =
+        !use_interaction_plan && s_marker_ordering != NO_MARKER_ORDERING && local_indices_size > 1;
+    if (use_reordered_markers)
+    {
+        reorder_markers(reordered_local_indices,
+                        reordered_periodic_shifts,
+                        local_indices,
+                        periodic_shifts,
+                        X_data,
+                        q_data_box,
+                        q_gcw,
+                        x_lower,
+                        dx);
+    }
+    const std::vector<int>& marker_local_indices = use_reordered_markers ? reordered_local_indices : local_indices;
+    const std::vector<double>& marker_periodic_shifts =
+        use_reordered_markers ? reordered_periodic_shifts : periodic_shifts;
+    if (use_interaction_plan)
+    {
+        const PatchArrayLayout q_layout(ilower, iupper, q_gcw);
+        const InteractionPlan& plan = get_interaction_plan(*compiled_kernel,
+                                                           spread_fcn,
+                                                           q_data_box,
+                                                           q_gcw,
+                                                           q_layout,
+                                                           x_lower,
+                                                           dx,
+                                                           X_data,
+                                                           local_indices,
+                                                           periodic_shifts);
+        compiled_kernel->spread_planned(q_data, q_layout, q_depth, dx, Q_data, plan);
+    }
+    else if (compiled_kernel)
+    {
+        const PatchArrayLayout q_layout(ilower, iupper, q_gcw);
+        if (s_use_threaded_spreading)
+        {
+            spread_threaded(*compiled_kernel,
+                            q_data,
+                            q_layout,
+                            q_depth,
+                            x_lower,
+                            dx,
+                            Q_data,
+                            X_data,
+                            marker_local_indices,
+                            marker_periodic_shifts,
+                            stencil_size);
+        }
+        else
+        {
+            compiled_kernel->spread(q_data,
+                                    q_layout,
+                                    q_depth,
+                                    x_lower,
+                                    dx,
+                                    Q_data,
+                                    X_data,
+                                    &marker_local_indices[0],
+                                    &marker_periodic_shifts[0],
+                                    local_indices_size);
+        }
+    }
+    else if (spread_fcn == "PIECEWISE_CONSTANT")
     {
         LAGRANGIAN_PIECEWISE_CONSTANT_SPREAD_FC(dx,
                                                 x_lower,
                                                 x_upper,
                                                 q_depth,
-                                                &local_indices[0],
-                                                &periodic_shifts[0],
+                                                &marker_local_indices[0],
+                                                &marker_periodic_shifts[0],
                                                 local_indices_size,
                                                 X_data,
                                                 Q_data,
@@ -4233,8 +5427,8 @@ LEInteractor::spread(double* const q_data,
                                                   x_upper,
                                                   q_depth,
                                                   axis,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
+                                                  &marker_local_indices[0],
+                                                  &marker_periodic_shifts[0],
                                                   local_indices_size,
                                                   X_data,
                                                   Q_data,
@@ -4265,8 +5459,8 @@ LEInteractor::spread(double* const q_data,
                                               x_lower,
                                               x_upper,
                                               q_depth,
-                                              &local_indices[0],
-                                              &periodic_shifts[0],
+                                              &marker_local_indices[0],
+                                              &marker_periodic_shifts[0],
                                               local_indices_size,
                                               X_data,
                                               Q_data,
@@ -4297,8 +5491,8 @@ LEInteractor::spread(double* const q_data,
                                              x_lower,
                                              x_upper,
                                              q_depth,
-                                             &local_indices[0],
-                                             &periodic_shifts[0],
+                                             &marker_local_indices[0],
+                                             &marker_periodic_shifts[0],
                                              local_indices_size,
                                              X_data,
                                              Q_data,
@@ -4329,8 +5523,8 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
+                                  &marker_local_indices[0],
+                                  &marker_periodic_shifts[0],
                                   local_indices_size,
                                   X_data,
                                   Q_data,
@@ -4361,8 +5555,8 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
+                                  &marker_local_indices[0],
+                                  &marker_periodic_shifts[0],
                                   local_indices_size,
                                   X_data,
                                   Q_data,
@@ -4393,8 +5587,8 @@ LEInteractor::spread(double* const q_data,
                                      x_lower,
                                      x_upper,
                                      q_depth,
-                                     &local_indices[0],
-                                     &periodic_shifts[0],
+                                     &marker_local_indices[0],
+                                     &marker_periodic_shifts[0],
                                      local_indices_size,
                                      X_data,
                                      Q_data,
@@ -4425,8 +5619,8 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
+                                  &marker_local_indices[0],
+                                  &marker_periodic_shifts[0],
                                   local_indices_size,
                                   X_data,
                                   Q_data,
@@ -4457,8 +5651,8 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
+                                  &marker_local_indices[0],
+                                  &marker_periodic_shifts[0],
                                   local_indices_size,
                                   X_data,
                                   Q_data,
@@ -4489,8 +5683,8 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
+                                       &marker_local_indices[0],
+                                       &marker_periodic_shifts[0],
                                        local_indices_size,
                                        X_data,
                                        Q_data,
@@ -4521,8 +5715,8 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
+                                       &marker_local_indices[0],
+                                       &marker_periodic_shifts[0],
                                        local_indices_size,
                                        X_data,
                                        Q_data,
@@ -4553,8 +5747,8 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
+                                       &marker_local_indices[0],
+                                       &marker_periodic_shifts[0],
                                        local_indices_size,
                                        X_data,
                                        Q_data,
@@ -4585,8 +5779,8 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
+                                       &marker_local_indices[0],
+                                       &marker_periodic_shifts[0],
                                        local_indices_size,
                                        X_data,
                                        Q_data,
@@ -4623,8 +5817,8 @@ LEInteractor::spread(double* const q_data,
                           Q_data,
                           Q_depth,
                           X_data,
-                          &local_indices[0],
-                          &periodic_shifts[0],
+                          &marker_local_indices[0],
+                          &marker_periodic_shifts[0],
                           local_indices_size);
     }
     else
@@ -4704,6 +5898,7 @@ LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
             for (auto n = idx_set.begin(); n != idx_set.end(); ++n)
             {
                 const typename LSet<T>::value_type& idx = *n;
+                if (!idx_data->isActiveLagrangianIndex(idx->getLagrangianIndex())) continue;
                 local_indices.push_back(idx->getLocalPETScIndex());
                 for (unsigned int d = 0; d < NDIM; ++d)
                 {
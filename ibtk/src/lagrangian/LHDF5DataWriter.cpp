@@ -0,0 +1,1303 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <IBTK_config.h>
+
+#include "ibtk/IBTK_CHKERRQ.h"
+#include "ibtk/LData.h"
+#include "ibtk/LHDF5DataWriter.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+#include "IntVector.h"
+#include "PatchHierarchy.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+#include "tbox/RestartManager.h"
+#include "tbox/Utilities.h"
+
+#include "petscao.h"
+#include "petscis.h"
+#include "petscsys.h"
+#include "petscvec.h"
+
+#include <hdf5.h>
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// The rank of the root MPI process.
+static const int HDF5_MPI_ROOT = 0;
+
+// The names of the HDF5 and XDMF files.
+static const int HDF5_NAME_BUFSIZE = 128;
+static const std::string HDF5_FILE_PREFIX = "lag_data.cycle_";
+static const std::string HDF5_FILE_POSTFIX = ".h5";
+static const std::string HDF5_TIME_SERIES_FILE_NAME = "lag_data.h5";
+static const std::string HDF5_TIME_SERIES_GROUP_PREFIX = "cycle_";
+static const std::string XDMF_FILE_POSTFIX = ".xmf";
+static const std::string XDMF_TIME_SERIES_FILE_NAME = "lag_data.xmf";
+
+// The maximum number of rows in each chunk of a compressed dataset.
+static const hsize_t HDF5_CHUNK_ROWS = 16384;
+
+// Version of LHDF5DataWriter restart file data.
+static const int LAG_HDF5_DATA_WRITER_VERSION = 1;
+
+// Compute the offset of the locally owned rows of a distributed dataset and
+// the total number of rows in the dataset.
+void
+compute_row_offset(const unsigned long long num_local_rows, hsize_t& row_offset, hsize_t& num_rows)
+{
+    unsigned long long offset = 0, total = 0;
+    MPI_Exscan(&num_local_rows, &offset, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, SAMRAI_MPI::commWorld);
+    MPI_Allreduce(&num_local_rows, &total, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, SAMRAI_MPI::commWorld);
+    row_offset = SAMRAI_MPI::getRank() == 0 ? 0 : offset;
+    num_rows = total;
+    return;
+} // compute_row_offset
+
+// Create the group with the specified name, or return an invalid identifier if
+// the location is invalid (i.e., on MPI processes that do not access the file
+// when parallel HDF5 is not available).
+hid_t
+create_group(const hid_t loc_id, const std::string& name)
+{
+    if (loc_id < 0) return -1;
+    const hid_t group_id = H5Gcreate2(loc_id, name.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    if (group_id < 0)
+    {
+        TBOX_ERROR("LHDF5DataWriter::create_group()\n"
+                   << "  Could not create HDF5 group named " << name << std::endl);
+    }
+    return group_id;
+} // create_group
+
+// Write a distributed two-dimensional dataset in which each MPI process owns a
+// contiguous range of rows.  The ranges must be ordered by MPI rank.
+template <typename T>
+void
+write_dataset(const hid_t loc_id,
+              const std::string& name,
+              const std::vector<T>& local_data,
+              const hsize_t num_cols,
+              const hsize_t row_offset,
+              const hsize_t num_rows,
+              const hid_t h5_type,
+              const MPI_Datatype mpi_type,
+              const int compression_level)
+{
+    const hsize_t num_local_rows = local_data.size() / num_cols;
+    hsize_t dims[2] = { num_rows, num_cols };
+
+#if defined(H5_HAVE_PARALLEL)
+    const T* const data = local_data.data();
+#else
+    // Without parallel HDF5, the data are gathered to the root process, which
+    // writes the full dataset.
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int mpi_nodes = SAMRAI_MPI::getNodes();
+    const int local_size = static_cast<int>(local_data.size());
+    std::vector<int> counts(mpi_rank == HDF5_MPI_ROOT ? mpi_nodes : 0), displs;
+    MPI_Gather(&local_size, 1, MPI_INT, counts.data(), 1, MPI_INT, HDF5_MPI_ROOT, SAMRAI_MPI::commWorld);
+    std::vector<T> all_data;
+    if (mpi_rank == HDF5_MPI_ROOT)
+    {
+        displs.resize(mpi_nodes);
+        for (int proc = 0; proc < mpi_nodes; ++proc)
+        {
+            displs[proc] = proc == 0 ? 0 : displs[proc - 1] + counts[proc - 1];
+        }
+        all_data.resize(num_rows * num_cols);
+    }
+    MPI_Gatherv(local_data.data(),
+                local_size,
+                mpi_type,
+                all_data.data(),
+                counts.data(),
+                displs.data(),
+                mpi_type,
+                HDF5_MPI_ROOT,
+                SAMRAI_MPI::commWorld);
+    if (loc_id < 0) return;
+    const T* const data = all_data.data();
+#endif
+
+    const hid_t file_space = H5Screate_simple(2, dims, nullptr);
+    const hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    if (compression_level > 0 && num_rows > 0)
+    {
+        hsize_t chunk_dims[2] = { std::min(num_rows, HDF5_CHUNK_ROWS), num_cols };
+        H5Pset_chunk(dcpl, 2, chunk_dims);
+        H5Pset_shuffle(dcpl);
+        H5Pset_deflate(dcpl, static_cast<unsigned int>(compression_level));
+    }
+    const hid_t dataset = H5Dcreate2(loc_id, name.c_str(), h5_type, file_space, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    if (dataset < 0)
+    {
+        TBOX_ERROR("LHDF5DataWriter::write_dataset()\n"
+                   << "  Could not create HDF5 dataset named " << name << std::endl);
+    }
+
+#if defined(H5_HAVE_PARALLEL)
+    hsize_t start[2] = { row_offset, 0 };
+    hsize_t count[2] = { num_local_rows, num_cols };
+    const hid_t mem_space = H5Screate_simple(2, count, nullptr);
+    if (num_local_rows > 0)
+    {
+        H5Sselect_hyperslab(file_space, H5S_SELECT_SET, start, nullptr, count, nullptr);
+    }
+    else
+    {
+        H5Sselect_none(file_space);
+        H5Sselect_none(mem_space);
+    }
+    const hid_t dxpl = H5Pcreate(H5P_DATASET_XFER);
+    H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+#else
+    NULL_USE(row_offset);
+    NULL_USE(num_local_rows);
+    const hid_t mem_space = H5S_ALL;
+    const hid_t dxpl = H5P_DEFAULT;
+#endif
+    if (H5Dwrite(dataset, h5_type, mem_space, file_space, dxpl, data) < 0)
+    {
+        TBOX_ERROR("LHDF5DataWriter::write_dataset()\n"
+                   << "  Could not write HDF5 dataset named " << name << std::endl);
+    }
+
+#if defined(H5_HAVE_PARALLEL)
+    H5Pclose(dxpl);
+    H5Sclose(mem_space);
+    NULL_USE(mpi_type);
+#endif
+    H5Dclose(dataset);
+    H5Pclose(dcpl);
+    H5Sclose(file_space);
+    return;
+} // write_dataset
+
+// Concatenate, in rank order, strings contributed by each MPI process on the
+// root MPI process.
+std::string
+gather_strings(const std::string& local_string)
+{
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int mpi_nodes = SAMRAI_MPI::getNodes();
+    const int local_size = static_cast<int>(local_string.size());
+    std::vector<int> counts(mpi_rank == HDF5_MPI_ROOT ? mpi_nodes : 0), displs;
+    MPI_Gather(&local_size, 1, MPI_INT, counts.data(), 1, MPI_INT, HDF5_MPI_ROOT, SAMRAI_MPI::commWorld);
+    std::vector<char> all_chars;
+    if (mpi_rank == HDF5_MPI_ROOT)
+    {
+        displs.resize(mpi_nodes);
+        for (int proc = 0; proc < mpi_nodes; ++proc)
+        {
+            displs[proc] = proc == 0 ? 0 : displs[proc - 1] + counts[proc - 1];
+        }
+        all_chars.resize(displs[mpi_nodes - 1] + counts[mpi_nodes - 1]);
+    }
+    MPI_Gatherv(local_string.data(),
+                local_size,
+                MPI_CHAR,
+                all_chars.data(),
+                counts.data(),
+                displs.data(),
+                MPI_CHAR,
+                HDF5_MPI_ROOT,
+                SAMRAI_MPI::commWorld);
+    return std::string(all_chars.begin(), all_chars.end());
+} // gather_strings
+
+// Write an XDMF data item that refers to the rows [row_offset, row_offset +
+// count) of a two-dimensional HDF5 dataset.
+void
+write_xdmf_hyperslab(std::ostream& os,
+                     const std::string& indent,
+                     const std::string& dataset_path,
+                     const hsize_t row_offset,
+                     const hsize_t count,
+                     const hsize_t num_rows,
+                     const hsize_t num_cols,
+                     const std::string& number_type)
+{
+    const int precision = number_type == "Int" ? 4 : 8;
+    os << indent << "<DataItem ItemType=\"HyperSlab\" Dimensions=\"" << count << " " << num_cols
+       << "\" Type=\"HyperSlab\">\n";
+    os << indent << "  <DataItem Dimensions=\"3 2\" Format=\"XML\">" << row_offset << " 0 1 1 " << count << " "
+       << num_cols << "</DataItem>\n";
+    os << indent << "  <DataItem Dimensions=\"" << num_rows << " " << num_cols << "\" NumberType=\"" << number_type
+       << "\" Precision=\"" << precision << "\" Format=\"HDF\">" << dataset_path << "</DataItem>\n";
+    os << indent << "</DataItem>\n";
+    return;
+} // write_xdmf_hyperslab
+
+// Return the XDMF attribute type of a variable with the specified depth.
+std::string
+get_xdmf_attribute_type(const int depth)
+{
+    if (depth == 1) return "Scalar";
+    if (depth == 3) return "Vector";
+    return "Matrix";
+} // get_xdmf_attribute_type
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+LHDF5DataWriter::LHDF5DataWriter(std::string object_name, std::string dump_directory_name, bool register_for_restart)
+    : d_object_name(std::move(object_name)),
+      d_registered_for_restart(register_for_restart),
+      d_dump_directory_name(std::move(dump_directory_name)),
+      d_nclouds(d_finest_ln + 1, 0),
+      d_cloud_names(d_finest_ln + 1),
+      d_cloud_nmarks(d_finest_ln + 1),
+      d_cloud_first_lag_idx(d_finest_ln + 1),
+      d_nblocks(d_finest_ln + 1, 0),
+      d_block_names(d_finest_ln + 1),
+      d_block_nelems(d_finest_ln + 1),
+      d_block_first_lag_idx(d_finest_ln + 1),
+      d_nucd_meshes(d_finest_ln + 1, 0),
+      d_ucd_mesh_names(d_finest_ln + 1),
+      d_ucd_mesh_edges(d_finest_ln + 1),
+      d_coords_data(d_finest_ln + 1, Pointer<LData>(nullptr)),
+      d_nvars(d_finest_ln + 1, 0),
+      d_var_names(d_finest_ln + 1),
+      d_var_start_depths(d_finest_ln + 1),
+      d_var_plot_depths(d_finest_ln + 1),
+      d_var_depths(d_finest_ln + 1),
+      d_var_data(d_finest_ln + 1),
+      d_ao(d_finest_ln + 1),
+      d_build_vec_scatters(d_finest_ln + 1),
+      d_num_nodes(d_finest_ln + 1, 0),
+      d_num_local_nodes(d_finest_ln + 1, 0),
+      d_first_local_node(d_finest_ln + 1, 0),
+      d_dst_vec(d_finest_ln + 1),
+      d_vec_scatter(d_finest_ln + 1)
+{
+    if (d_registered_for_restart)
+    {
+        RestartManager::getManager()->registerRestartItem(d_object_name, this);
+    }
+
+    // Initialize object with data read from the restart database.
+    const bool from_restart = RestartManager::getManager()->isFromRestart();
+    if (from_restart)
+    {
+        getFromRestart();
+    }
+    return;
+} // LHDF5DataWriter
+
+LHDF5DataWriter::~LHDF5DataWriter()
+{
+    if (d_registered_for_restart)
+    {
+        RestartManager::getManager()->unregisterRestartItem(d_object_name);
+    }
+
+    // Destroy any remaining PETSc objects.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        destroyVecScatters(ln);
+    }
+    return;
+} // ~LHDF5DataWriter
+
+void
+LHDF5DataWriter::setPatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(hierarchy);
+    TBOX_ASSERT(hierarchy->getFinestLevelNumber() >= d_finest_ln);
+#endif
+    // Reset the hierarchy.
+    d_hierarchy = hierarchy;
+    return;
+} // setPatchHierarchy
+
+void
+LHDF5DataWriter::resetLevels(const int coarsest_ln, const int finest_ln)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT((coarsest_ln >= 0) && (finest_ln >= coarsest_ln));
+    if (d_hierarchy)
+    {
+        TBOX_ASSERT(finest_ln <= d_hierarchy->getFinestLevelNumber());
+    }
+#endif
+    // Destroy any unneeded PETSc objects.
+    for (int ln = std::max(d_coarsest_ln, 0); (ln <= d_finest_ln) && (ln < coarsest_ln); ++ln)
+    {
+        destroyVecScatters(ln);
+    }
+    for (int ln = finest_ln + 1; ln <= d_finest_ln; ++ln)
+    {
+        destroyVecScatters(ln);
+    }
+
+    // Reset the level numbers.
+    d_coarsest_ln = coarsest_ln;
+    d_finest_ln = finest_ln;
+
+    // Resize some arrays.
+    d_nclouds.resize(d_finest_ln + 1, 0);
+    d_cloud_names.resize(d_finest_ln + 1);
+    d_cloud_nmarks.resize(d_finest_ln + 1);
+    d_cloud_first_lag_idx.resize(d_finest_ln + 1);
+
+    d_nblocks.resize(d_finest_ln + 1, 0);
+    d_block_names.resize(d_finest_ln + 1);
+    d_block_nelems.resize(d_finest_ln + 1);
+    d_block_first_lag_idx.resize(d_finest_ln + 1);
+
+    d_nucd_meshes.resize(d_finest_ln + 1, 0);
+    d_ucd_mesh_names.resize(d_finest_ln + 1);
+    d_ucd_mesh_edges.resize(d_finest_ln + 1);
+
+    d_coords_data.resize(d_finest_ln + 1, nullptr);
+    d_nvars.resize(d_finest_ln + 1, 0);
+    d_var_names.resize(d_finest_ln + 1);
+    d_var_start_depths.resize(d_finest_ln + 1);
+    d_var_plot_depths.resize(d_finest_ln + 1);
+    d_var_depths.resize(d_finest_ln + 1);
+    d_var_data.resize(d_finest_ln + 1);
+
+    d_ao.resize(d_finest_ln + 1);
+    d_build_vec_scatters.resize(d_finest_ln + 1);
+    d_num_nodes.resize(d_finest_ln + 1, 0);
+    d_num_local_nodes.resize(d_finest_ln + 1, 0);
+    d_first_local_node.resize(d_finest_ln + 1, 0);
+    d_dst_vec.resize(d_finest_ln + 1);
+    d_vec_scatter.resize(d_finest_ln + 1);
+    return;
+} // resetLevels
+
+void
+LHDF5DataWriter::registerMarkerCloud(const std::string& name,
+                                     const int nmarks,
+                                     const int first_lag_idx,
+                                     const int level_number)
+{
+    if (level_number < d_coarsest_ln || level_number > d_finest_ln)
+    {
+        resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
+    }
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(nmarks > 0);
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+
+    // Check to see if we are updating a previously registered cloud.
+    for (int k = 0; k < d_nclouds[level_number]; ++k)
+    {
+        if (d_cloud_names[level_number][k] == name)
+        {
+            d_cloud_nmarks[level_number][k] = nmarks;
+            d_cloud_first_lag_idx[level_number][k] = first_lag_idx;
+            return;
+        }
+    }
+    checkMeshName(name, level_number, "registerMarkerCloud");
+
+    // Record the layout of the marker cloud.
+    ++d_nclouds[level_number];
+    d_cloud_names[level_number].push_back(name);
+    d_cloud_nmarks[level_number].push_back(nmarks);
+    d_cloud_first_lag_idx[level_number].push_back(first_lag_idx);
+    return;
+} // registerMarkerCloud
+
+void
+LHDF5DataWriter::registerLogicallyCartesianBlock(const std::string& name,
+                                                 const IntVector<NDIM>& nelem,
+                                                 const IntVector<NDIM>& periodic,
+                                                 const int first_lag_idx,
+                                                 const int level_number)
+{
+    if (level_number < d_coarsest_ln || level_number > d_finest_ln)
+    {
+        resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
+    }
+
+#if !defined(NDEBUG)
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        TBOX_ASSERT(nelem(d) > 0);
+        TBOX_ASSERT(periodic(d) == 0 || periodic(d) == 1);
+    }
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#else
+    NULL_USE(periodic);
+#endif
+
+    // Check to see if we are updating a previously registered block.
+    for (int k = 0; k < d_nblocks[level_number]; ++k)
+    {
+        if (d_block_names[level_number][k] == name)
+        {
+            d_block_nelems[level_number][k] = nelem;
+            d_block_first_lag_idx[level_number][k] = first_lag_idx;
+            return;
+        }
+    }
+    checkMeshName(name, level_number, "registerLogicallyCartesianBlock");
+
+    // Record the layout of the logically Cartesian block.
+    ++d_nblocks[level_number];
+    d_block_names[level_number].push_back(name);
+    d_block_nelems[level_number].push_back(nelem);
+    d_block_first_lag_idx[level_number].push_back(first_lag_idx);
+    return;
+} // registerLogicallyCartesianBlock
+
+void
+LHDF5DataWriter::registerUnstructuredMesh(const std::string& name,
+                                          const std::multimap<int, std::pair<int, int> >& edge_map,
+                                          const int level_number)
+{
+    if (level_number < d_coarsest_ln || level_number > d_finest_ln)
+    {
+        resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
+    }
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+
+    // Extract the list of edges.  The edges refer directly to rows of the
+    // coordinate and variable datasets, which are stored in Lagrangian index
+    // order.
+    std::vector<std::pair<int, int> > edges;
+    edges.reserve(edge_map.size());
+    for (const auto& edge_pair : edge_map)
+    {
+        edges.push_back(edge_pair.second);
+    }
+
+    // Check to see if we are updating a previously registered unstructured
+    // mesh.
+    for (int k = 0; k < d_nucd_meshes[level_number]; ++k)
+    {
+        if (d_ucd_mesh_names[level_number][k] == name)
+        {
+            d_ucd_mesh_edges[level_number][k] = edges;
+            return;
+        }
+    }
+    checkMeshName(name, level_number, "registerUnstructuredMesh");
+
+    // Record the layout of the unstructured mesh.
+    ++d_nucd_meshes[level_number];
+    d_ucd_mesh_names[level_number].push_back(name);
+    d_ucd_mesh_edges[level_number].push_back(edges);
+    return;
+} // registerUnstructuredMesh
+
+void
+LHDF5DataWriter::registerCoordsData(Pointer<LData> coords_data, const int level_number)
+{
+    if (level_number < d_coarsest_ln || level_number > d_finest_ln)
+    {
+        resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
+    }
+#if !defined(NDEBUG)
+    TBOX_ASSERT(coords_data);
+    TBOX_ASSERT(coords_data->getDepth() == NDIM);
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+    d_coords_data[level_number] = coords_data;
+    return;
+} // registerCoordsData
+
+void
+LHDF5DataWriter::registerVariableData(const std::string& var_name, Pointer<LData> var_data, const int level_number)
+{
+    const int start_depth = 0;
+    const int var_depth = var_data->getDepth();
+    registerVariableData(var_name, var_data, start_depth, var_depth, level_number);
+    return;
+} // registerVariableData
+
+void
+LHDF5DataWriter::registerVariableData(const std::string& var_name,
+                                      Pointer<LData> var_data,
+                                      const int start_depth,
+                                      const int var_depth,
+                                      const int level_number)
+{
+    if (level_number < d_coarsest_ln || level_number > d_finest_ln)
+    {
+        resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
+    }
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!var_name.empty());
+    TBOX_ASSERT(var_name != "X" && var_name != "edges");
+    TBOX_ASSERT(var_data);
+    TBOX_ASSERT(start_depth >= 0 && var_depth > 0 && start_depth + var_depth <= var_data->getDepth());
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+    if (find(d_var_names[level_number].begin(), d_var_names[level_number].end(), var_name) !=
+        d_var_names[level_number].end())
+    {
+        TBOX_ERROR(d_object_name << "::registerVariableData()\n"
+                                 << "  variable with name " << var_name << " already registered for plotting\n"
+                                 << "  on patch level " << level_number << std::endl);
+    }
+    ++d_nvars[level_number];
+    d_var_names[level_number].push_back(var_name);
+    d_var_start_depths[level_number].push_back(start_depth);
+    d_var_plot_depths[level_number].push_back(var_depth);
+    d_var_depths[level_number].push_back(var_data->getDepth());
+    d_var_data[level_number].push_back(var_data);
+    d_build_vec_scatters[level_number] = true;
+    return;
+} // registerVariableData
+
+void
+LHDF5DataWriter::registerLagrangianAO(AO& ao, const int level_number)
+{
+    if (level_number < d_coarsest_ln || level_number > d_finest_ln)
+    {
+        resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
+    }
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+    d_ao[level_number] = ao;
+    d_build_vec_scatters[level_number] = true;
+    return;
+} // registerLagrangianAO
+
+void
+LHDF5DataWriter::registerLagrangianAO(std::vector<AO>& ao, const int coarsest_ln, const int finest_ln)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(coarsest_ln <= finest_ln);
+#endif
+
+    if (coarsest_ln < d_coarsest_ln || finest_ln > d_finest_ln)
+    {
+        resetLevels(std::min(coarsest_ln, d_coarsest_ln), std::max(finest_ln, d_finest_ln));
+    }
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_coarsest_ln <= coarsest_ln && finest_ln <= d_finest_ln);
+#endif
+
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        registerLagrangianAO(ao[ln], ln);
+    }
+    return;
+} // registerLagrangianAO
+
+void
+LHDF5DataWriter::setUseTimeSeriesFile(const bool use_time_series_file)
+{
+    d_use_time_series_file = use_time_series_file;
+    return;
+} // setUseTimeSeriesFile
+
+void
+LHDF5DataWriter::setCompressionLevel(const int compression_level)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(compression_level >= 0 && compression_level <= 9);
+#endif
+    d_compression_level = compression_level;
+#if defined(H5_HAVE_PARALLEL) && !H5_VERSION_GE(1, 10, 2)
+    if (d_compression_level > 0)
+    {
+        TBOX_WARNING(d_object_name << "::setCompressionLevel()\n"
+                                   << "  parallel HDF5 versions prior to 1.10.2 do not support compressed datasets.\n"
+                                   << "  compression is disabled." << std::endl);
+        d_compression_level = 0;
+    }
+#endif
+    return;
+} // setCompressionLevel
+
+void
+LHDF5DataWriter::writePlotData(const int time_step_number, const double simulation_time)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(time_step_number >= 0);
+    TBOX_ASSERT(!d_dump_directory_name.empty());
+#endif
+
+    if (time_step_number <= d_time_step_number)
+    {
+        TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                 << "  data writer with name " << d_object_name << "\n"
+                                 << "  time step number: " << time_step_number
+                                 << " is <= last time step number: " << d_time_step_number << std::endl);
+    }
+    d_time_step_number = time_step_number;
+
+    if (d_dump_directory_name.empty())
+    {
+        TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                 << "  data writer with name " << d_object_name << "\n"
+                                 << "  dump directory name is empty" << std::endl);
+    }
+
+    char temp_buf[HDF5_NAME_BUFSIZE];
+    const int mpi_rank = SAMRAI_MPI::getRank();
+
+    // Construct the VecScatter objects required to write the plot data.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        if (d_build_vec_scatters[ln])
+        {
+            buildVecScatters(d_ao[ln], ln);
+        }
+        d_build_vec_scatters[ln] = false;
+    }
+
+    // Create the dump directory.
+    Utilities::recursiveMkdir(d_dump_directory_name);
+    SAMRAI_MPI::barrier();
+
+    // Determine the names of the HDF5 file, the group within the file that
+    // contains the data for this dump, and the XDMF file.
+    std::snprintf(temp_buf, sizeof(temp_buf), "%06d", d_time_step_number);
+    const std::string xdmf_file_name = HDF5_FILE_PREFIX + temp_buf + XDMF_FILE_POSTFIX;
+    const std::string hdf5_file_name =
+        d_use_time_series_file ? HDF5_TIME_SERIES_FILE_NAME : HDF5_FILE_PREFIX + temp_buf + HDF5_FILE_POSTFIX;
+    const std::string group_name = d_use_time_series_file ? HDF5_TIME_SERIES_GROUP_PREFIX + temp_buf : "";
+    const std::string hdf5_file_path = d_dump_directory_name + "/" + hdf5_file_name;
+
+    // Open the HDF5 file.  With parallel HDF5, the file is accessed by all MPI
+    // processes; otherwise, only the root process accesses the file.
+    hid_t file_id = -1;
+#if defined(H5_HAVE_PARALLEL)
+    const bool access_file = true;
+    const hid_t fapl = H5Pcreate(H5P_FILE_ACCESS);
+    H5Pset_fapl_mpio(fapl, SAMRAI_MPI::commWorld, MPI_INFO_NULL);
+#else
+    const bool access_file = mpi_rank == HDF5_MPI_ROOT;
+    const hid_t fapl = H5P_DEFAULT;
+#endif
+    if (access_file)
+    {
+        if (d_use_time_series_file && d_time_series_file_created)
+        {
+            file_id = H5Fopen(hdf5_file_path.c_str(), H5F_ACC_RDWR, fapl);
+        }
+        else
+        {
+            file_id = H5Fcreate(hdf5_file_path.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+        }
+        if (file_id < 0)
+        {
+            TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                     << "  Could not open HDF5 file named " << hdf5_file_path << std::endl);
+        }
+    }
+#if defined(H5_HAVE_PARALLEL)
+    H5Pclose(fapl);
+#endif
+    d_time_series_file_created = d_time_series_file_created || d_use_time_series_file;
+
+    // Create the group for this dump.  Data written by an earlier run for the
+    // same time step (e.g., before restarting) are replaced.
+    hid_t dump_id = file_id;
+    if (!group_name.empty() && file_id >= 0)
+    {
+        if (H5Lexists(file_id, group_name.c_str(), H5P_DEFAULT) > 0)
+        {
+            H5Ldelete(file_id, group_name.c_str(), H5P_DEFAULT);
+        }
+        dump_id = create_group(file_id, group_name);
+    }
+    const std::string dump_path = hdf5_file_name + ":" + (group_name.empty() ? "" : "/" + group_name);
+
+    // Write the data on each level and describe the local meshes in XDMF.
+    std::string xdmf_levels;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        if (!d_coords_data[ln]) continue;
+
+        const std::string level_name = "level_" + std::to_string(ln);
+        const std::string level_path = dump_path + "/" + level_name;
+        const hid_t level_id = create_group(dump_id, level_name);
+
+        const hsize_t num_nodes = d_num_nodes[ln];
+        const hsize_t node_offset = d_first_local_node[ln];
+        const int num_local_nodes = d_num_local_nodes[ln];
+
+        // Write the coordinates and variables in Lagrangian index order.
+        std::vector<double> buffer;
+        copyToLocalBuffer(buffer, d_coords_data[ln]->getVec(), NDIM, ln);
+        write_dataset(
+            level_id, "X", buffer, NDIM, node_offset, num_nodes, H5T_NATIVE_DOUBLE, MPI_DOUBLE, d_compression_level);
+        for (int v = 0; v < d_nvars[ln]; ++v)
+        {
+            const int var_depth = d_var_depths[ln][v];
+            const int start_depth = d_var_start_depths[ln][v];
+            const int plot_depth = d_var_plot_depths[ln][v];
+            copyToLocalBuffer(buffer, d_var_data[ln][v]->getVec(), var_depth, ln);
+            std::vector<double> var_vals(plot_depth * num_local_nodes);
+            for (int i = 0; i < num_local_nodes; ++i)
+            {
+                for (int d = 0; d < plot_depth; ++d)
+                {
+                    var_vals[plot_depth * i + d] = buffer[var_depth * i + start_depth + d];
+                }
+            }
+            write_dataset(level_id,
+                          d_var_names[ln][v],
+                          var_vals,
+                          plot_depth,
+                          node_offset,
+                          num_nodes,
+                          H5T_NATIVE_DOUBLE,
+                          MPI_DOUBLE,
+                          d_compression_level);
+        }
+
+        // Write the edges of the local unstructured meshes.
+        std::vector<int> edges;
+        for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
+        {
+            for (const auto& e : d_ucd_mesh_edges[ln][mesh])
+            {
+                edges.push_back(e.first);
+                edges.push_back(e.second);
+            }
+        }
+        hsize_t edge_offset, num_edges;
+        compute_row_offset(edges.size() / 2, edge_offset, num_edges);
+        if (num_edges > 0)
+        {
+            write_dataset(
+                level_id, "edges", edges, 2, edge_offset, num_edges, H5T_NATIVE_INT, MPI_INT, d_compression_level);
+        }
+        if (level_id >= 0) H5Gclose(level_id);
+
+        // Describe the local meshes.  Each mesh refers to a hyperslab of the
+        // datasets on the level.
+        const std::string geometry_type = NDIM == 2 ? "XY" : "XYZ";
+        std::ostringstream os;
+        for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
+        {
+            const hsize_t nmarks = d_cloud_nmarks[ln][cloud];
+            const hsize_t first_lag_idx = d_cloud_first_lag_idx[ln][cloud];
+            os << "      <Grid Name=\"" << d_cloud_names[ln][cloud] << "\" GridType=\"Uniform\">\n";
+            os << "        <Topology TopologyType=\"Polyvertex\" NumberOfElements=\"" << nmarks
+               << "\" NodesPerElement=\"1\"/>\n";
+            os << "        <Geometry GeometryType=\"" << geometry_type << "\">\n";
+            write_xdmf_hyperslab(
+                os, "          ", level_path + "/X", first_lag_idx, nmarks, num_nodes, NDIM, "Float");
+            os << "        </Geometry>\n";
+            for (int v = 0; v < d_nvars[ln]; ++v)
+            {
+                const int plot_depth = d_var_plot_depths[ln][v];
+                os << "        <Attribute Name=\"" << d_var_names[ln][v] << "\" AttributeType=\""
+                   << get_xdmf_attribute_type(plot_depth) << "\" Center=\"Node\">\n";
+                write_xdmf_hyperslab(os,
+                                     "          ",
+                                     level_path + "/" + d_var_names[ln][v],
+                                     first_lag_idx,
+                                     nmarks,
+                                     num_nodes,
+                                     plot_depth,
+                                     "Float");
+                os << "        </Attribute>\n";
+            }
+            os << "      </Grid>\n";
+        }
+        for (int block = 0; block < d_nblocks[ln]; ++block)
+        {
+            const IntVector<NDIM>& nelem = d_block_nelems[ln][block];
+            const hsize_t ntot = nelem.getProduct();
+            const hsize_t first_lag_idx = d_block_first_lag_idx[ln][block];
+            os << "      <Grid Name=\"" << d_block_names[ln][block] << "\" GridType=\"Uniform\">\n";
+            os << "        <Topology TopologyType=\"" << NDIM << "DSMesh\" Dimensions=\"";
+            for (int d = NDIM - 1; d >= 0; --d)
+            {
+                os << nelem(d) << (d > 0 ? " " : "");
+            }
+            os << "\"/>\n";
+            os << "        <Geometry GeometryType=\"" << geometry_type << "\">\n";
+            write_xdmf_hyperslab(os, "          ", level_path + "/X", first_lag_idx, ntot, num_nodes, NDIM, "Float");
+            os << "        </Geometry>\n";
+            for (int v = 0; v < d_nvars[ln]; ++v)
+            {
+                const int plot_depth = d_var_plot_depths[ln][v];
+                os << "        <Attribute Name=\"" << d_var_names[ln][v] << "\" AttributeType=\""
+                   << get_xdmf_attribute_type(plot_depth) << "\" Center=\"Node\">\n";
+                write_xdmf_hyperslab(os,
+                                     "          ",
+                                     level_path + "/" + d_var_names[ln][v],
+                                     first_lag_idx,
+                                     ntot,
+                                     num_nodes,
+                                     plot_depth,
+                                     "Float");
+                os << "        </Attribute>\n";
+            }
+            os << "      </Grid>\n";
+        }
+        hsize_t mesh_edge_offset = edge_offset;
+        for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
+        {
+            const hsize_t mesh_num_edges = d_ucd_mesh_edges[ln][mesh].size();
+            os << "      <Grid Name=\"" << d_ucd_mesh_names[ln][mesh] << "\" GridType=\"Uniform\">\n";
+            os << "        <Topology TopologyType=\"Polyline\" NumberOfElements=\"" << mesh_num_edges
+               << "\" NodesPerElement=\"2\">\n";
+            write_xdmf_hyperslab(
+                os, "          ", level_path + "/edges", mesh_edge_offset, mesh_num_edges, num_edges, 2, "Int");
+            os << "        </Topology>\n";
+            os << "        <Geometry GeometryType=\"" << geometry_type << "\">\n";
+            write_xdmf_hyperslab(os, "          ", level_path + "/X", 0, num_nodes, num_nodes, NDIM, "Float");
+            os << "        </Geometry>\n";
+            for (int v = 0; v < d_nvars[ln]; ++v)
+            {
+                const int plot_depth = d_var_plot_depths[ln][v];
+                os << "        <Attribute Name=\"" << d_var_names[ln][v] << "\" AttributeType=\""
+                   << get_xdmf_attribute_type(plot_depth) << "\" Center=\"Node\">\n";
+                write_xdmf_hyperslab(os,
+                                     "          ",
+                                     level_path + "/" + d_var_names[ln][v],
+                                     0,
+                                     num_nodes,
+                                     num_nodes,
+                                     plot_depth,
+                                     "Float");
+                os << "        </Attribute>\n";
+            }
+            os << "      </Grid>\n";
+            mesh_edge_offset += mesh_num_edges;
+        }
+
+        // Collect the mesh descriptions on the root MPI process.
+        const std::string level_grids = gather_strings(os.str());
+        if (mpi_rank == HDF5_MPI_ROOT)
+        {
+            xdmf_levels +=
+                "    <Grid Name=\"" + level_name + "\" GridType=\"Collection\" CollectionType=\"Spatial\">\n";
+            xdmf_levels += level_grids;
+            xdmf_levels += "    </Grid>\n";
+        }
+    }
+
+    if (!group_name.empty() && dump_id >= 0) H5Gclose(dump_id);
+    if (file_id >= 0) H5Fclose(file_id);
+
+    // Write the XDMF file for this dump and update the time-series XDMF file.
+    d_xdmf_file_names.push_back(xdmf_file_name);
+    if (mpi_rank == HDF5_MPI_ROOT)
+    {
+        const std::string xdmf_file_path = d_dump_directory_name + "/" + xdmf_file_name;
+        std::ofstream xdmf_file(xdmf_file_path.c_str(), std::ios::out);
+        xdmf_file.precision(16);
+        xdmf_file << "<?xml version=\"1.0\" ?>\n";
+        xdmf_file << "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n";
+        xdmf_file << "<Xdmf Version=\"2.0\">\n";
+        xdmf_file << "  <Domain>\n";
+        xdmf_file << "    <Grid Name=\"lag_data\" GridType=\"Collection\" CollectionType=\"Spatial\">\n";
+        xdmf_file << "      <Time Value=\"" << simulation_time << "\"/>\n";
+        xdmf_file << xdmf_levels;
+        xdmf_file << "    </Grid>\n";
+        xdmf_file << "  </Domain>\n";
+        xdmf_file << "</Xdmf>\n";
+        xdmf_file.close();
+
+        const std::string series_file_path = d_dump_directory_name + "/" + XDMF_TIME_SERIES_FILE_NAME;
+        std::ofstream series_file(series_file_path.c_str(), std::ios::out);
+        series_file << "<?xml version=\"1.0\" ?>\n";
+        series_file << "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n";
+        series_file << "<Xdmf Version=\"2.0\" xmlns:xi=\"http://www.w3.org/2001/XInclude\">\n";
+        series_file << "  <Domain>\n";
+        series_file << "    <Grid Name=\"lag_data\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+        for (const auto& file_name : d_xdmf_file_names)
+        {
+            series_file << "      <xi:include href=\"" << file_name
+                        << "\" xpointer=\"xpointer(//Xdmf/Domain/Grid)\"/>\n";
+        }
+        series_file << "    </Grid>\n";
+        series_file << "  </Domain>\n";
+        series_file << "</Xdmf>\n";
+        series_file.close();
+    }
+    SAMRAI_MPI::barrier();
+    return;
+} // writePlotData
+
+void
+LHDF5DataWriter::putToDatabase(Pointer<Database> db)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(db);
+#endif
+    db->putInteger("LAG_HDF5_DATA_WRITER_VERSION", LAG_HDF5_DATA_WRITER_VERSION);
+
+    db->putInteger("d_coarsest_ln", d_coarsest_ln);
+    db->putInteger("d_finest_ln", d_finest_ln);
+
+    db->putBool("d_time_series_file_created", d_time_series_file_created);
+    db->putInteger("d_xdmf_file_names.size()", static_cast<int>(d_xdmf_file_names.size()));
+    if (!d_xdmf_file_names.empty())
+    {
+        db->putStringArray("d_xdmf_file_names", &d_xdmf_file_names[0], static_cast<int>(d_xdmf_file_names.size()));
+    }
+
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        const std::string ln_string = "_" + std::to_string(ln);
+
+        db->putInteger("d_nclouds" + ln_string, d_nclouds[ln]);
+        if (d_nclouds[ln] > 0)
+        {
+            db->putStringArray(
+                "d_cloud_names" + ln_string, &d_cloud_names[ln][0], static_cast<int>(d_cloud_names[ln].size()));
+            db->putIntegerArray(
+                "d_cloud_nmarks" + ln_string, &d_cloud_nmarks[ln][0], static_cast<int>(d_cloud_nmarks[ln].size()));
+            db->putIntegerArray("d_cloud_first_lag_idx" + ln_string,
+                                &d_cloud_first_lag_idx[ln][0],
+                                static_cast<int>(d_cloud_first_lag_idx[ln].size()));
+        }
+
+        db->putInteger("d_nblocks" + ln_string, d_nblocks[ln]);
+        if (d_nblocks[ln] > 0)
+        {
+            db->putStringArray(
+                "d_block_names" + ln_string, &d_block_names[ln][0], static_cast<int>(d_block_names[ln].size()));
+
+            std::vector<int> flattened_block_nelems;
+            flattened_block_nelems.reserve(NDIM * d_block_nelems[ln].size());
+            for (const auto& block : d_block_nelems[ln])
+            {
+                flattened_block_nelems.insert(flattened_block_nelems.end(), &block[0], &block[0] + NDIM);
+            }
+            db->putIntegerArray("flattened_block_nelems" + ln_string,
+                                &flattened_block_nelems[0],
+                                static_cast<int>(flattened_block_nelems.size()));
+
+            db->putIntegerArray("d_block_first_lag_idx" + ln_string,
+                                &d_block_first_lag_idx[ln][0],
+                                static_cast<int>(d_block_first_lag_idx[ln].size()));
+        }
+
+        db->putInteger("d_nucd_meshes" + ln_string, d_nucd_meshes[ln]);
+        if (d_nucd_meshes[ln] > 0)
+        {
+            db->putStringArray("d_ucd_mesh_names" + ln_string,
+                               &d_ucd_mesh_names[ln][0],
+                               static_cast<int>(d_ucd_mesh_names[ln].size()));
+
+            for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
+            {
+                const std::string mesh_string = "_" + std::to_string(mesh);
+
+                std::vector<int> flattened_edges;
+                flattened_edges.reserve(2 * d_ucd_mesh_edges[ln][mesh].size());
+                for (const auto& e : d_ucd_mesh_edges[ln][mesh])
+                {
+                    flattened_edges.push_back(e.first);
+                    flattened_edges.push_back(e.second);
+                }
+                db->putInteger("flattened_edges.size()" + ln_string + mesh_string,
+                               static_cast<int>(flattened_edges.size()));
+                if (!flattened_edges.empty())
+                {
+                    db->putIntegerArray("flattened_edges" + ln_string + mesh_string,
+                                        &flattened_edges[0],
+                                        static_cast<int>(flattened_edges.size()));
+                }
+            }
+        }
+    }
+    return;
+} // putToDatabase
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+LHDF5DataWriter::checkMeshName(const std::string& name, const int level_number, const std::string& caller) const
+{
+    const std::vector<std::string>* const registered_names[3] = { &d_cloud_names[level_number],
+                                                                  &d_block_names[level_number],
+                                                                  &d_ucd_mesh_names[level_number] };
+    for (const std::vector<std::string>* const names : registered_names)
+    {
+        if (find(names->begin(), names->end(), name) != names->end())
+        {
+            TBOX_ERROR(d_object_name << "::" << caller << "()\n"
+                                     << "  meshes must have unique names.\n"
+                                     << "  a mesh named ``" << name << "'' has already been registered on level "
+                                     << level_number << ".\n");
+        }
+    }
+    return;
+} // checkMeshName
+
+void
+LHDF5DataWriter::destroyVecScatters(const int level_number)
+{
+    int ierr;
+    for (auto& vec : d_dst_vec[level_number])
+    {
+        Vec& v = vec.second;
+        if (v)
+        {
+            ierr = VecDestroy(&v);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+    for (auto& vec : d_vec_scatter[level_number])
+    {
+        VecScatter& vs = vec.second;
+        if (vs)
+        {
+            ierr = VecScatterDestroy(&vs);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+    d_dst_vec[level_number].clear();
+    d_vec_scatter[level_number].clear();
+    return;
+} // destroyVecScatters
+
+void
+LHDF5DataWriter::buildVecScatters(AO& ao, const int level_number)
+{
+    destroyVecScatters(level_number);
+    if (!d_coords_data[level_number]) return;
+
+    int ierr;
+
+    // Divide the Lagrangian indices on the level into contiguous ranges, one
+    // for each MPI process.  Each process writes its range of rows of the
+    // datasets on the level.
+    Vec X_vec = d_coords_data[level_number]->getVec();
+    int global_size;
+    ierr = VecGetSize(X_vec, &global_size);
+    IBTK_CHKERRQ(ierr);
+    int num_nodes = global_size / NDIM;
+    int num_local_nodes = PETSC_DECIDE;
+    ierr = PetscSplitOwnership(PETSC_COMM_WORLD, &num_local_nodes, &num_nodes);
+    IBTK_CHKERRQ(ierr);
+    int first_local_node = 0;
+    MPI_Exscan(&num_local_nodes, &first_local_node, 1, MPI_INT, MPI_SUM, PETSC_COMM_WORLD);
+    if (SAMRAI_MPI::getRank() == 0) first_local_node = 0;
+    d_num_nodes[level_number] = num_nodes;
+    d_num_local_nodes[level_number] = num_local_nodes;
+    d_first_local_node[level_number] = first_local_node;
+
+    // Map Lagrangian indices to PETSc indices.
+    std::vector<int> idxs(num_local_nodes);
+    for (int k = 0; k < num_local_nodes; ++k)
+    {
+        idxs[k] = first_local_node + k;
+    }
+    std::vector<int> ao_dummy(1, -1);
+    ierr = AOApplicationToPetsc(ao,
+                                (!idxs.empty() ? num_local_nodes : static_cast<int>(ao_dummy.size())),
+                                (!idxs.empty() ? &idxs[0] : &ao_dummy[0]));
+    IBTK_CHKERRQ(ierr);
+
+    // Create the VecScatters to scatter data from the global PETSc Vec to
+    // contiguous ranges of Lagrangian indices.  VecScatter objects are
+    // individually created for data depths as necessary.
+    std::map<int, Vec> src_vecs;
+    src_vecs[NDIM] = X_vec;
+    for (int v = 0; v < d_nvars[level_number]; ++v)
+    {
+        const int var_depth = d_var_depths[level_number][v];
+        if (src_vecs.find(var_depth) == src_vecs.end())
+        {
+            src_vecs[var_depth] = d_var_data[level_number][v]->getVec();
+        }
+    }
+    for (const auto& src_vec : src_vecs)
+    {
+        const int depth = src_vec.first;
+
+        IS src_is;
+        ierr = ISCreateBlock(
+            PETSC_COMM_WORLD, depth, num_local_nodes, (idxs.empty() ? nullptr : &idxs[0]), PETSC_COPY_VALUES, &src_is);
+        IBTK_CHKERRQ(ierr);
+
+        Vec& dst_vec = d_dst_vec[level_number][depth];
+        ierr = VecCreateMPI(PETSC_COMM_WORLD, depth * num_local_nodes, PETSC_DETERMINE, &dst_vec);
+        IBTK_CHKERRQ(ierr);
+
+        VecScatter& vec_scatter = d_vec_scatter[level_number][depth];
+        ierr = VecScatterCreate(src_vec.second, src_is, dst_vec, nullptr, &vec_scatter);
+        IBTK_CHKERRQ(ierr);
+
+        ierr = ISDestroy(&src_is);
+        IBTK_CHKERRQ(ierr);
+    }
+    return;
+} // buildVecScatters
+
+void
+LHDF5DataWriter::copyToLocalBuffer(std::vector<double>& buffer, Vec global_vec, const int depth, const int level_number)
+{
+    int ierr;
+    Vec local_vec = d_dst_vec[level_number][depth];
+    ierr = VecScatterBegin(d_vec_scatter[level_number][depth], global_vec, local_vec, INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecScatterEnd(d_vec_scatter[level_number][depth], global_vec, local_vec, INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    int local_size;
+    ierr = VecGetLocalSize(local_vec, &local_size);
+    IBTK_CHKERRQ(ierr);
+    const double* local_arr;
+    ierr = VecGetArrayRead(local_vec, &local_arr);
+    IBTK_CHKERRQ(ierr);
+    buffer.assign(local_arr, local_arr + local_size);
+    ierr = VecRestoreArrayRead(local_vec, &local_arr);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // copyToLocalBuffer
+
+void
+LHDF5DataWriter::getFromRestart()
+{
+    Pointer<Database> restart_db = RestartManager::getManager()->getRootDatabase();
+    Pointer<Database> db;
+    if (restart_db->isDatabase(d_object_name))
+    {
+        db = restart_db->getDatabase(d_object_name);
+    }
+    else
+    {
+        TBOX_ERROR("Restart database corresponding to " << d_object_name << " not found in restart file.");
+    }
+
+    int ver = db->getInteger("LAG_HDF5_DATA_WRITER_VERSION");
+    if (ver != LAG_HDF5_DATA_WRITER_VERSION)
+    {
+        TBOX_ERROR(d_object_name << ":  "
+                                 << "Restart file version different than class version.");
+    }
+
+    const int coarsest_ln = db->getInteger("d_coarsest_ln");
+    const int finest_ln = db->getInteger("d_finest_ln");
+    resetLevels(coarsest_ln, finest_ln);
+
+    d_time_series_file_created = db->getBool("d_time_series_file_created");
+    d_xdmf_file_names.resize(db->getInteger("d_xdmf_file_names.size()"));
+    if (!d_xdmf_file_names.empty())
+    {
+        db->getStringArray("d_xdmf_file_names", &d_xdmf_file_names[0], static_cast<int>(d_xdmf_file_names.size()));
+    }
+
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        const std::string ln_string = "_" + std::to_string(ln);
+
+        d_nclouds[ln] = db->getInteger("d_nclouds" + ln_string);
+        if (d_nclouds[ln] > 0)
+        {
+            d_cloud_names[ln].resize(d_nclouds[ln]);
+            db->getStringArray(
+                "d_cloud_names" + ln_string, &d_cloud_names[ln][0], static_cast<int>(d_cloud_names[ln].size()));
+
+            d_cloud_nmarks[ln].resize(d_nclouds[ln]);
+            db->getIntegerArray(
+                "d_cloud_nmarks" + ln_string, &d_cloud_nmarks[ln][0], static_cast<int>(d_cloud_nmarks[ln].size()));
+
+            d_cloud_first_lag_idx[ln].resize(d_nclouds[ln]);
+            db->getIntegerArray("d_cloud_first_lag_idx" + ln_string,
+                                &d_cloud_first_lag_idx[ln][0],
+                                static_cast<int>(d_cloud_first_lag_idx[ln].size()));
+        }
+
+        d_nblocks[ln] = db->getInteger("d_nblocks" + ln_string);
+        if (d_nblocks[ln] > 0)
+        {
+            d_block_names[ln].resize(d_nblocks[ln]);
+            db->getStringArray(
+                "d_block_names" + ln_string, &d_block_names[ln][0], static_cast<int>(d_block_names[ln].size()));
+
+            d_block_nelems[ln].resize(d_nblocks[ln]);
+            std::vector<int> flattened_block_nelems(NDIM * d_block_nelems[ln].size());
+            db->getIntegerArray("flattened_block_nelems" + ln_string,
+                                &flattened_block_nelems[0],
+                                static_cast<int>(flattened_block_nelems.size()));
+            for (unsigned int l = 0; l < d_block_nelems[ln].size(); ++l)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    d_block_nelems[ln][l](d) = flattened_block_nelems[NDIM * l + d];
+                }
+            }
+
+            d_block_first_lag_idx[ln].resize(d_nblocks[ln]);
+            db->getIntegerArray("d_block_first_lag_idx" + ln_string,
+                                &d_block_first_lag_idx[ln][0],
+                                static_cast<int>(d_block_first_lag_idx[ln].size()));
+        }
+
+        d_nucd_meshes[ln] = db->getInteger("d_nucd_meshes" + ln_string);
+        if (d_nucd_meshes[ln] > 0)
+        {
+            d_ucd_mesh_names[ln].resize(d_nucd_meshes[ln]);
+            db->getStringArray("d_ucd_mesh_names" + ln_string,
+                               &d_ucd_mesh_names[ln][0],
+                               static_cast<int>(d_ucd_mesh_names[ln].size()));
+
+            d_ucd_mesh_edges[ln].resize(d_nucd_meshes[ln]);
+            for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
+            {
+                const std::string mesh_string = "_" + std::to_string(mesh);
+
+                std::vector<int> flattened_edges(db->getInteger("flattened_edges.size()" + ln_string + mesh_string));
+                if (!flattened_edges.empty())
+                {
+                    db->getIntegerArray("flattened_edges" + ln_string + mesh_string,
+                                        &flattened_edges[0],
+                                        static_cast<int>(flattened_edges.size()));
+                }
+                d_ucd_mesh_edges[ln][mesh].resize(flattened_edges.size() / 2);
+                for (unsigned int e = 0; e < d_ucd_mesh_edges[ln][mesh].size(); ++e)
+                {
+                    d_ucd_mesh_edges[ln][mesh][e] = std::make_pair(flattened_edges[2 * e], flattened_edges[2 * e + 1]);
+                }
+            }
+        }
+    }
+    return;
+} // getFromRestart
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
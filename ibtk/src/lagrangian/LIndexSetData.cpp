@@ -50,8 +50,12 @@ LIndexSetData<T>::LIndexSetData(Box<NDIM> box, IntVector<NDIM> ghosts) : LSetDat
 
 template <class T>
 void
-LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector<NDIM>& periodic_shift)
+LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch,
+                                    const IntVector<NDIM>& periodic_shift,
+                                    const std::vector<std::pair<int, int> >& inactive_lag_idx_ranges)
 {
+    d_inactive_lag_idx_ranges = inactive_lag_idx_ranges;
+
     d_lag_indices.clear();
     d_interior_lag_indices.clear();
     d_ghost_lag_indices.clear();
@@ -104,6 +108,7 @@ LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector
         {
             const typename LSet<T>::value_type& idx = *n;
             const int lag_idx = idx->getLagrangianIndex();
+            if (!isActiveLagrangianIndex(lag_idx)) continue;
             const int global_petsc_idx = idx->getGlobalPETScIndex();
             const int local_petsc_idx = idx->getLocalPETScIndex();
             d_lag_indices.push_back(lag_idx);
@@ -16,14 +16,97 @@
 #include "ibtk/LNode.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// A pool of fixed-size blocks from which LNode objects are allocated.  The
+// blocks are carved out of chunks of BLOCKS_PER_CHUNK blocks, and free blocks
+// are kept in a singly linked list.  Chunks are never released.
+class LNodePool
+{
+public:
+    void* allocate()
+    {
+        if (!d_free_list) grow();
+        FreeBlock* const block = d_free_list;
+        d_free_list = block->next;
+        return block;
+    } // allocate
+
+    void deallocate(void* const ptr)
+    {
+        auto const block = static_cast<FreeBlock*>(ptr);
+        block->next = d_free_list;
+        d_free_list = block;
+        return;
+    } // deallocate
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    static const int BLOCKS_PER_CHUNK = 4096;
+    using Block = std::aligned_storage<(sizeof(LNode) > sizeof(FreeBlock) ? sizeof(LNode) : sizeof(FreeBlock)),
+                                       alignof(LNode)>::type;
+    static_assert(alignof(LNode) <= alignof(std::max_align_t), "LNode requires extended alignment");
+
+    void grow()
+    {
+        d_chunks.emplace_back(new Block[BLOCKS_PER_CHUNK]);
+        Block* const chunk = d_chunks.back().get();
+        for (int k = BLOCKS_PER_CHUNK - 1; k >= 0; --k) deallocate(&chunk[k]);
+        return;
+    } // grow
+
+    std::vector<std::unique_ptr<Block[]> > d_chunks;
+    FreeBlock* d_free_list = nullptr;
+};
+
+// The pool is intentionally never destroyed so that nodes that are owned by
+// static objects may be destroyed at any point during program termination.
+LNodePool&
+get_pool()
+{
+    static LNodePool* const pool = new LNodePool();
+    return *pool;
+} // get_pool
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
+void*
+LNode::operator new(const std::size_t size)
+{
+    if (size != sizeof(LNode)) return ::operator new(size);
+    return get_pool().allocate();
+} // operator new
+
+void
+LNode::operator delete(void* const ptr, const std::size_t size)
+{
+    if (!ptr) return;
+    if (size != sizeof(LNode))
+    {
+        ::operator delete(ptr);
+        return;
+    }
+    get_pool().deallocate(ptr);
+    return;
+} // operator delete
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -42,6 +42,7 @@
 #include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 // IWYU pragma: no_include "petsc-private/vecimpl.h"
@@ -74,7 +75,68 @@ static const std::string SILO_PROCESSOR_FILE_POSTFIX = ".silo";
 // Version of LSiloDataWriter restart file data.
 static const int LAG_SILO_DATA_WRITER_VERSION = 1;
 
+// Return the index of the Silo file written by the given MPI process when the
+// processes are divided into num_files contiguous groups.
+inline int
+get_silo_file_index(const int rank, const int nodes, const int num_files)
+{
+    return static_cast<int>((static_cast<long long>(rank) * num_files) / nodes);
+} // get_silo_file_index
+
+// Return the path of the data written by the given MPI process, relative to
+// the dump directory, in the form expected by the multimesh and multivar
+// objects.
+inline std::string
+get_silo_processor_data_path(const int rank, const int nodes, const int num_files)
+{
+    char temp_buf[SILO_NAME_BUFSIZE];
+    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", get_silo_file_index(rank, nodes, num_files));
+    std::string path = SILO_PROCESSOR_FILE_PREFIX + temp_buf + SILO_PROCESSOR_FILE_POSTFIX + ":";
+    if (num_files < nodes)
+    {
+        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", rank);
+        path += std::string("proc_") + temp_buf + "/";
+    }
+    return path;
+} // get_silo_processor_data_path
+
+// Append a list of names to a buffer of null-terminated strings.
+inline void
+pack_names(std::vector<char>& buffer, const std::vector<std::string>& names, const int num_names)
+{
+    for (int k = 0; k < num_names; ++k)
+    {
+        buffer.insert(buffer.end(), names[k].begin(), names[k].end());
+        buffer.push_back('\0');
+    }
+    return;
+} // pack_names
+
+// Extract a list of names from a buffer of null-terminated strings.
+inline void
+unpack_names(std::vector<std::string>& names, const int num_names, const char*& buffer)
+{
+    names.resize(num_names);
+    for (int k = 0; k < num_names; ++k)
+    {
+        names[k].assign(buffer);
+        buffer += names[k].size() + 1;
+    }
+    return;
+} // unpack_names
+
 #if defined(IBTK_HAVE_SILO)
+/*!
+ * \brief Set the compression that the Silo library applies to the data that are
+ * subsequently written.  An empty string disables compression.
+ */
+void
+set_compression(const std::string& compression)
+{
+    DBSetCompression(compression.empty() ? nullptr : compression.c_str());
+    return;
+} // set_compression
+
 /*!
  * \brief Build a local mesh database entry corresponding to a cloud of marker
  * points.
@@ -89,6 +151,8 @@ build_local_marker_cloud(DBfile* dbfile,
                          const std::vector<int>& varstartdepths,
                          const std::vector<int>& varplotdepths,
                          const std::vector<int>& vardepths,
+                         const std::string& meshcompression,
+                         const std::vector<std::string>& varcompressions,
                          const std::vector<const double*>& varvals,
                          const int time_step,
                          const double simulation_time)
@@ -149,6 +213,7 @@ build_local_marker_cloud(DBfile* dbfile,
 
     int ndims = NDIM;
 
+    set_compression(meshcompression);
     DBPutPointmesh(dbfile, meshname, ndims, &coords[0], nmarks, DB_FLOAT, optlist);
 
     for (int v = 0; v < nvars; ++v)
@@ -162,6 +227,7 @@ build_local_marker_cloud(DBfile* dbfile,
             vars[d] = nmarks > 0 ? &block_varvals[v][d * nmarks] : nullptr;
         }
 
+        set_compression(varcompressions[v]);
         if (varplotdepth == 1)
         {
             DBPutPointvar1(dbfile, varname, meshname, vars[0], nmarks, DB_FLOAT, optlist);
@@ -198,6 +264,8 @@ build_local_curv_block(DBfile* dbfile,
                        const std::vector<int>& varstartdepths,
                        const std::vector<int>& varplotdepths,
                        const std::vector<int>& vardepths,
+                       const std::string& meshcompression,
+                       const std::vector<std::string>& varcompressions,
                        const std::vector<const double*>& varvals,
                        const int time_step,
                        const double simulation_time)
@@ -318,6 +386,7 @@ build_local_curv_block(DBfile* dbfile,
         dims[d] = nelem(d) + (periodic(d) ? 1 : 0);
     }
 
+    set_compression(meshcompression);
     DBPutQuadmesh(dbfile,
                   meshname,
                   const_cast<char**>(coordnames),
@@ -349,6 +418,7 @@ build_local_curv_block(DBfile* dbfile,
             vars[d] = ntot > 0 ? &block_varvals[v][d * ntot] : nullptr;
         }
 
+        set_compression(varcompressions[v]);
         if (varplotdepth == 1)
         {
             DBPutQuadvar1(
@@ -398,6 +468,8 @@ build_local_ucd_mesh(DBfile* dbfile,
                      const std::vector<int>& varstartdepths,
                      const std::vector<int>& varplotdepths,
                      const std::vector<int>& vardepths,
+                     const std::string& meshcompression,
+                     const std::vector<std::string>& varcompressions,
                      const std::vector<const double*>& varvals,
                      const int time_step,
                      const double simulation_time)
@@ -518,6 +590,7 @@ build_local_ucd_mesh(DBfile* dbfile,
     const int hi_offset = 0;
 
     // Write out connectivity information.
+    set_compression(meshcompression);
     DBPutZonelist2(dbfile,
                    "zonelist",
                    nzones,
@@ -568,6 +641,7 @@ build_local_ucd_mesh(DBfile* dbfile,
             vars[d] = ntot > 0 ? &block_varvals[v][d * ntot] : nullptr;
         }
 
+        set_compression(varcompressions[v]);
         if (varplotdepth == 1)
         {
             DBPutUcdvar1(dbfile, varname, meshname, vars[0], nnodes, nullptr, 0, DB_FLOAT, DB_NODECENT, optlist);
@@ -602,6 +676,8 @@ build_local_ucd_mesh(DBfile* dbfile,
 #endif // if defined(IBTK_HAVE_SILO)
 } // namespace
 
+std::thread LSiloDataWriter::s_write_thread;
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 LSiloDataWriter::LSiloDataWriter(std::string object_name, std::string dump_directory_name, bool register_for_restart)
@@ -633,6 +709,7 @@ LSiloDataWriter::LSiloDataWriter(std::string object_name, std::string dump_direc
       d_var_start_depths(d_finest_ln + 1),
       d_var_plot_depths(d_finest_ln + 1),
       d_var_depths(d_finest_ln + 1),
+      d_var_compressions(d_finest_ln + 1),
       d_var_data(d_finest_ln + 1),
       d_ao(d_finest_ln + 1),
       d_build_vec_scatters(d_finest_ln + 1),
@@ -661,6 +738,8 @@ LSiloDataWriter::LSiloDataWriter(std::string object_name, std::string dump_direc
 
 LSiloDataWriter::~LSiloDataWriter()
 {
+    waitForPendingWrites();
+
     if (d_registered_for_restart)
     {
         RestartManager::getManager()->unregisterRestartItem(d_object_name);
@@ -695,6 +774,8 @@ LSiloDataWriter::~LSiloDataWriter()
 void
 LSiloDataWriter::setPatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy)
 {
+    waitForPendingWrites();
+
 #if !defined(NDEBUG)
     TBOX_ASSERT(hierarchy);
     TBOX_ASSERT(hierarchy->getFinestLevelNumber() >= d_finest_ln);
@@ -707,6 +788,8 @@ LSiloDataWriter::setPatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy)
 void
 LSiloDataWriter::resetLevels(const int coarsest_ln, const int finest_ln)
 {
+    waitForPendingWrites();
+
 #if !defined(NDEBUG)
     TBOX_ASSERT((coarsest_ln >= 0) && (finest_ln >= coarsest_ln));
     if (d_hierarchy)
@@ -794,6 +877,7 @@ LSiloDataWriter::resetLevels(const int coarsest_ln, const int finest_ln)
     d_var_start_depths.resize(d_finest_ln + 1);
     d_var_plot_depths.resize(d_finest_ln + 1);
     d_var_depths.resize(d_finest_ln + 1);
+    d_var_compressions.resize(d_finest_ln + 1);
     d_var_data.resize(d_finest_ln + 1);
 
     d_ao.resize(d_finest_ln + 1);
@@ -810,6 +894,8 @@ LSiloDataWriter::registerMarkerCloud(const std::string& name,
                                      const int first_lag_idx,
                                      const int level_number)
 {
+    waitForPendingWrites();
+
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -870,6 +956,8 @@ LSiloDataWriter::registerLogicallyCartesianBlock(const std::string& name,
                                                  const int first_lag_idx,
                                                  const int level_number)
 {
+    waitForPendingWrites();
+
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -936,6 +1024,8 @@ LSiloDataWriter::registerLogicallyCartesianMultiblock(const std::string& name,
                                                       const std::vector<int>& first_lag_idx,
                                                       const int level_number)
 {
+    waitForPendingWrites();
+
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -1009,6 +1099,8 @@ LSiloDataWriter::registerUnstructuredMesh(const std::string& name,
                                           const std::multimap<int, std::pair<int, int> >& edge_map,
                                           const int level_number)
 {
+    waitForPendingWrites();
+
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -1074,6 +1166,8 @@ LSiloDataWriter::registerUnstructuredMesh(const std::string& name,
 void
 LSiloDataWriter::registerCoordsData(Pointer<LData> coords_data, const int level_number)
 {
+    waitForPendingWrites();
+
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -1103,6 +1197,8 @@ LSiloDataWriter::registerVariableData(const std::string& var_name,
                                       const int var_depth,
                                       const int level_number)
 {
+    waitForPendingWrites();
+
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -1125,13 +1221,37 @@ LSiloDataWriter::registerVariableData(const std::string& var_name,
     d_var_start_depths[level_number].push_back(start_depth);
     d_var_plot_depths[level_number].push_back(var_depth);
     d_var_depths[level_number].push_back(var_data->getDepth());
+    d_var_compressions[level_number].push_back(std::string());
     d_var_data[level_number].push_back(var_data);
     return;
 } // registerVariableData
 
+void
+LSiloDataWriter::setVariableCompression(const std::string& var_name,
+                                        const std::string& compression,
+                                        const int level_number)
+{
+    waitForPendingWrites();
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+    const auto it = std::find(d_var_names[level_number].begin(), d_var_names[level_number].end(), var_name);
+    if (it == d_var_names[level_number].end())
+    {
+        TBOX_ERROR(d_object_name << "::setVariableCompression()\n"
+                                 << "  variable with name " << var_name << " is not registered for plotting\n"
+                                 << "  on patch level " << level_number << std::endl);
+    }
+    d_var_compressions[level_number][it - d_var_names[level_number].begin()] = compression;
+    return;
+} // setVariableCompression
+
 void
 LSiloDataWriter::registerLagrangianAO(AO& ao, const int level_number)
 {
+    waitForPendingWrites();
+
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -1168,6 +1288,13 @@ LSiloDataWriter::registerLagrangianAO(std::vector<AO>& ao, const int coarsest_ln
     return;
 } // registerLagrangianAO
 
+void
+LSiloDataWriter::setNumberOfOutputFiles(const int num_files)
+{
+    d_num_output_files = num_files;
+    return;
+} // setNumberOfOutputFiles
+
 void
 LSiloDataWriter::writePlotData(const int time_step_number, const double simulation_time)
 {
@@ -1177,6 +1304,9 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
     TBOX_ASSERT(!d_dump_directory_name.empty());
 #endif
 
+    // Finish writing any previous plot data before the data are updated.
+    waitForPendingWrites();
+
     if (time_step_number <= d_time_step_number)
     {
         TBOX_ERROR(d_object_name << "::writePlotData()\n"
@@ -1193,7 +1323,6 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                                  << "  dump directory name is empty" << std::endl);
     }
 
-    int ierr;
     char temp_buf[SILO_NAME_BUFSIZE];
     std::string current_file_name;
     DBfile* dbfile;
@@ -1217,583 +1346,270 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
     Utilities::recursiveMkdir(dump_dirname);
 
-    // Create one local DBfile per MPI process.
-    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", mpi_rank);
+    // Determine the local DBfile.  There is one DBfile per MPI process, or, if
+    // the number of output files is limited, one DBfile per group of MPI
+    // processes.  In the latter
+    // case, the processes in each group take turns appending their data to the
+    // file of the group, each in its own directory.
+    const int num_files =
+        (d_num_output_files > 0 && d_num_output_files < mpi_nodes) ? d_num_output_files : mpi_nodes;
+    const bool use_file_groups = num_files < mpi_nodes;
+    const int file_index = get_silo_file_index(mpi_rank, mpi_nodes, num_files);
+    const bool first_in_group =
+        mpi_rank == 0 || get_silo_file_index(mpi_rank - 1, mpi_nodes, num_files) != file_index;
+    const bool last_in_group =
+        mpi_rank == mpi_nodes - 1 || get_silo_file_index(mpi_rank + 1, mpi_nodes, num_files) != file_index;
+
+    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", file_index);
     current_file_name = dump_dirname + "/" + SILO_PROCESSOR_FILE_PREFIX;
     current_file_name += temp_buf;
     current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+    const std::string local_file_name = current_file_name;
+    std::string proc_dirname;
+    if (use_file_groups)
+    {
+        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", mpi_rank);
+        proc_dirname = std::string("proc_") + temp_buf;
+    }
 
-    if (!(dbfile = DBCreate(current_file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
+    // Copy the local data into staging buffers.
+    std::vector<std::vector<double> > X_data(d_finest_ln + 1);
+    std::vector<std::vector<std::vector<double> > > var_data(d_finest_ln + 1);
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                 << "  Could not create DBfile named " << current_file_name << std::endl);
+        if (!d_coords_data[ln]) continue;
+        copyToLocalBuffer(X_data[ln], d_coords_data[ln]->getVec(), NDIM, ln);
+        var_data[ln].resize(d_nvars[ln]);
+        for (int v = 0; v < d_nvars[ln]; ++v)
+        {
+            copyToLocalBuffer(var_data[ln][v], d_var_data[ln][v]->getVec(), d_var_depths[ln][v], ln);
+        }
     }
 
+    // Determine the mesh and variable types of the local blocks.
     std::vector<std::vector<int> > meshtype(d_finest_ln + 1), vartype(d_finest_ln + 1);
     std::vector<std::vector<std::vector<int> > > multimeshtype(d_finest_ln + 1), multivartype(d_finest_ln + 1);
-
-    // Set the local data.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        if (d_coords_data[ln])
+        meshtype[ln].assign(d_nblocks[ln], DB_QUAD_CURV);
+        vartype[ln].assign(d_nblocks[ln], DB_QUADVAR);
+        multimeshtype[ln].resize(d_nmbs[ln]);
+        multivartype[ln].resize(d_nmbs[ln]);
+        for (int mb = 0; mb < d_nmbs[ln]; ++mb)
         {
-            // Scatter the data from "global" to "local" form.
-            Vec local_X_vec;
-            ierr = VecDuplicate(d_dst_vec[ln][NDIM], &local_X_vec);
-            IBTK_CHKERRQ(ierr);
+            multimeshtype[ln][mb].assign(d_mb_nblocks[ln][mb], DB_QUAD_CURV);
+            multivartype[ln][mb].assign(d_mb_nblocks[ln][mb], DB_QUADVAR);
+        }
+    }
 
-            Vec global_X_vec = d_coords_data[ln]->getVec();
-            ierr = VecScatterBegin(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
-            IBTK_CHKERRQ(ierr);
-            ierr = VecScatterEnd(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
-            IBTK_CHKERRQ(ierr);
+    // Gather the data required to create the multimesh and multivar objects on
+    // the root MPI process.  The data from each process is packed into a
+    // buffer of integers and a buffer of names so that it can be collected
+    // with a single pair of collective operations.
+    std::vector<int> int_data;
+    std::vector<char> name_data;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        int_data.push_back(d_nclouds[ln]);
+        pack_names(name_data, d_cloud_names[ln], d_nclouds[ln]);
 
-            double* local_X_arr;
-            ierr = VecGetArray(local_X_vec, &local_X_arr);
-            IBTK_CHKERRQ(ierr);
+        int_data.push_back(d_nblocks[ln]);
+        int_data.insert(int_data.end(), meshtype[ln].begin(), meshtype[ln].begin() + d_nblocks[ln]);
+        int_data.insert(int_data.end(), vartype[ln].begin(), vartype[ln].begin() + d_nblocks[ln]);
+        pack_names(name_data, d_block_names[ln], d_nblocks[ln]);
 
-            std::vector<Vec> local_v_vecs;
-            std::vector<double*> local_v_arrs;
+        int_data.push_back(d_nmbs[ln]);
+        for (int mb = 0; mb < d_nmbs[ln]; ++mb)
+        {
+            int_data.push_back(d_mb_nblocks[ln][mb]);
+            int_data.insert(int_data.end(),
+                            multimeshtype[ln][mb].begin(),
+                            multimeshtype[ln][mb].begin() + d_mb_nblocks[ln][mb]);
+            int_data.insert(
+                int_data.end(), multivartype[ln][mb].begin(), multivartype[ln][mb].begin() + d_mb_nblocks[ln][mb]);
+        }
+        pack_names(name_data, d_mb_names[ln], d_nmbs[ln]);
 
-            for (int v = 0; v < d_nvars[ln]; ++v)
-            {
-                const int var_depth = d_var_depths[ln][v];
-                Vec local_v_vec;
-                ierr = VecDuplicate(d_dst_vec[ln][var_depth], &local_v_vec);
-                IBTK_CHKERRQ(ierr);
+        int_data.push_back(d_nucd_meshes[ln]);
+        pack_names(name_data, d_ucd_mesh_names[ln], d_nucd_meshes[ln]);
+    }
 
-                Vec global_v_vec = d_var_data[ln][v]->getVec();
-                ierr = VecScatterBegin(
-                    d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
-                IBTK_CHKERRQ(ierr);
-                ierr = VecScatterEnd(
-                    d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
-                IBTK_CHKERRQ(ierr);
+    int local_sizes[2] = { static_cast<int>(int_data.size()), static_cast<int>(name_data.size()) };
+    std::vector<int> sizes(mpi_rank == SILO_MPI_ROOT ? 2 * mpi_nodes : 0);
+    MPI_Gather(local_sizes, 2, MPI_INT, sizes.data(), 2, MPI_INT, SILO_MPI_ROOT, SAMRAI_MPI::commWorld);
 
-                double* local_v_arr;
-                ierr = VecGetArray(local_v_vec, &local_v_arr);
-                IBTK_CHKERRQ(ierr);
+    std::vector<int> int_counts, int_displs, name_counts, name_displs;
+    std::vector<int> all_int_data;
+    std::vector<char> all_name_data;
+    if (mpi_rank == SILO_MPI_ROOT)
+    {
+        int_counts.resize(mpi_nodes);
+        int_displs.resize(mpi_nodes);
+        name_counts.resize(mpi_nodes);
+        name_displs.resize(mpi_nodes);
+        for (int proc = 0; proc < mpi_nodes; ++proc)
+        {
+            int_counts[proc] = sizes[2 * proc];
+            name_counts[proc] = sizes[2 * proc + 1];
+            int_displs[proc] = proc == 0 ? 0 : int_displs[proc - 1] + int_counts[proc - 1];
+            name_displs[proc] = proc == 0 ? 0 : name_displs[proc - 1] + name_counts[proc - 1];
+        }
+        all_int_data.resize(int_displs[mpi_nodes - 1] + int_counts[mpi_nodes - 1]);
+        all_name_data.resize(name_displs[mpi_nodes - 1] + name_counts[mpi_nodes - 1]);
+    }
+    MPI_Gatherv(int_data.data(),
+                local_sizes[0],
+                MPI_INT,
+                all_int_data.data(),
+                int_counts.data(),
+                int_displs.data(),
+                MPI_INT,
+                SILO_MPI_ROOT,
+                SAMRAI_MPI::commWorld);
+    MPI_Gatherv(name_data.data(),
+                local_sizes[1],
+                MPI_CHAR,
+                all_name_data.data(),
+                name_counts.data(),
+                name_displs.data(),
+                MPI_CHAR,
+                SILO_MPI_ROOT,
+                SAMRAI_MPI::commWorld);
 
-                local_v_vecs.push_back(local_v_vec);
-                local_v_arrs.push_back(local_v_arr);
-            }
+    std::vector<std::vector<int> > nclouds_per_proc, nblocks_per_proc, nmbs_per_proc, nucd_meshes_per_proc;
+    std::vector<std::vector<std::vector<int> > > meshtypes_per_proc, vartypes_per_proc, mb_nblocks_per_proc;
+    std::vector<std::vector<std::vector<std::vector<int> > > > multimeshtypes_per_proc, multivartypes_per_proc;
+    std::vector<std::vector<std::vector<std::string> > > cloud_names_per_proc, block_names_per_proc, mb_names_per_proc,
+        ucd_mesh_names_per_proc;
 
-            // Keep track of the current offset in the local Vec data.
-            int offset = 0;
+    if (mpi_rank == SILO_MPI_ROOT)
+    {
+        nclouds_per_proc.resize(d_finest_ln + 1, std::vector<int>(mpi_nodes));
+        nblocks_per_proc.resize(d_finest_ln + 1, std::vector<int>(mpi_nodes));
+        nmbs_per_proc.resize(d_finest_ln + 1, std::vector<int>(mpi_nodes));
+        nucd_meshes_per_proc.resize(d_finest_ln + 1, std::vector<int>(mpi_nodes));
+        meshtypes_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<int> >(mpi_nodes));
+        vartypes_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<int> >(mpi_nodes));
+        mb_nblocks_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<int> >(mpi_nodes));
+        multimeshtypes_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::vector<int> > >(mpi_nodes));
+        multivartypes_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::vector<int> > >(mpi_nodes));
+        cloud_names_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::string> >(mpi_nodes));
+        block_names_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::string> >(mpi_nodes));
+        mb_names_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::string> >(mpi_nodes));
+        ucd_mesh_names_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::string> >(mpi_nodes));
 
-            // Add the local clouds to the local DBfile.
-            for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
+        for (int proc = 0; proc < mpi_nodes; ++proc)
+        {
+            const int* ints = all_int_data.data() + int_displs[proc];
+            const char* names = all_name_data.data() + name_displs[proc];
+            for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
             {
-                const int nmarks = d_cloud_nmarks[ln][cloud];
-
-                std::string dirname = "level_" + std::to_string(ln) + "_cloud_" + std::to_string(cloud);
-
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named " << dirname << std::endl);
-                }
-
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
+                nclouds_per_proc[ln][proc] = *ints++;
+                unpack_names(cloud_names_per_proc[ln][proc], nclouds_per_proc[ln][proc], names);
+
+                const int nblocks = nblocks_per_proc[ln][proc] = *ints++;
+                meshtypes_per_proc[ln][proc].assign(ints, ints + nblocks);
+                ints += nblocks;
+                vartypes_per_proc[ln][proc].assign(ints, ints + nblocks);
+                ints += nblocks;
+                unpack_names(block_names_per_proc[ln][proc], nblocks, names);
+
+                const int nmbs = nmbs_per_proc[ln][proc] = *ints++;
+                mb_nblocks_per_proc[ln][proc].resize(nmbs);
+                multimeshtypes_per_proc[ln][proc].resize(nmbs);
+                multivartypes_per_proc[ln][proc].resize(nmbs);
+                for (int mb = 0; mb < nmbs; ++mb)
                 {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                    const int mb_nblocks = mb_nblocks_per_proc[ln][proc][mb] = *ints++;
+                    multimeshtypes_per_proc[ln][proc][mb].assign(ints, ints + mb_nblocks);
+                    ints += mb_nblocks;
+                    multivartypes_per_proc[ln][proc][mb].assign(ints, ints + mb_nblocks);
+                    ints += mb_nblocks;
                 }
+                unpack_names(mb_names_per_proc[ln][proc], nmbs, names);
 
-                build_local_marker_cloud(dbfile,
-                                         dirname,
-                                         nmarks,
-                                         X,
-                                         d_nvars[ln],
-                                         d_var_names[ln],
-                                         d_var_start_depths[ln],
-                                         d_var_plot_depths[ln],
-                                         d_var_depths[ln],
-                                         var_vals,
-                                         time_step_number,
-                                         simulation_time);
-
-                offset += nmarks;
+                nucd_meshes_per_proc[ln][proc] = *ints++;
+                unpack_names(ucd_mesh_names_per_proc[ln][proc], nucd_meshes_per_proc[ln][proc], names);
             }
+        }
+    }
 
-            // Add the local blocks to the local DBfile.
-            for (int block = 0; block < d_nblocks[ln]; ++block)
-            {
-                const IntVector<NDIM>& nelem = d_block_nelems[ln][block];
-                const IntVector<NDIM>& periodic = d_block_periodic[ln][block];
-                const int ntot = nelem.getProduct();
+    if (mpi_rank == SILO_MPI_ROOT)
+    {
+        // Create and initialize the multimesh Silo database on the root MPI
+        // process.
+        std::snprintf(temp_buf, sizeof(temp_buf), "%06d", d_time_step_number);
+        std::string summary_file_name =
+            dump_dirname + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
+        if (!(dbfile = DBCreate(summary_file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
+        {
+            TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                     << "  Could not create DBfile named " << summary_file_name << std::endl);
+        }
 
-                std::string dirname = "level_" + std::to_string(ln) + "_block_" + std::to_string(block);
+        int cycle = time_step_number;
+        auto time = static_cast<float>(simulation_time);
+        double dtime = simulation_time;
 
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named " << dirname << std::endl);
-                }
+        static const int MAX_OPTS = 3;
+        DBoptlist* optlist = DBMakeOptlist(MAX_OPTS);
+        DBAddOption(optlist, DBOPT_CYCLE, &cycle);
+        DBAddOption(optlist, DBOPT_TIME, &time);
+        DBAddOption(optlist, DBOPT_DTIME, &dtime);
 
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
+        for (int proc = 0; proc < mpi_nodes; ++proc)
+        {
+            for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+            {
+                for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
                 {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                }
-
-                build_local_curv_block(dbfile,
-                                       dirname,
-                                       nelem,
-                                       periodic,
-                                       X,
-                                       d_nvars[ln],
-                                       d_var_names[ln],
-                                       d_var_start_depths[ln],
-                                       d_var_plot_depths[ln],
-                                       d_var_depths[ln],
-                                       var_vals,
-                                       time_step_number,
-                                       simulation_time);
-                meshtype[ln].push_back(DB_QUAD_CURV);
-                vartype[ln].push_back(DB_QUADVAR);
+                    current_file_name = get_silo_processor_data_path(proc, mpi_nodes, num_files);
 
-                offset += ntot;
-            }
+                    std::string meshname = current_file_name + "level_" + std::to_string(ln) + "_cloud_" +
+                                           std::to_string(cloud) + "/mesh";
+                    auto meshname_ptr = const_cast<char*>(meshname.c_str());
+                    int meshtype = DB_POINTMESH;
 
-            // Add the local multiblocks to the local DBfile.
-            multimeshtype[ln].resize(d_nmbs[ln]);
-            multivartype[ln].resize(d_nmbs[ln]);
-            for (int mb = 0; mb < d_nmbs[ln]; ++mb)
-            {
-                for (int block = 0; block < d_mb_nblocks[ln][mb]; ++block)
-                {
-                    const IntVector<NDIM>& nelem = d_mb_nelems[ln][mb][block];
-                    const IntVector<NDIM>& periodic = d_mb_periodic[ln][mb][block];
-                    const int ntot = nelem.getProduct();
+                    std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
 
-                    std::string dirname =
-                        "level_" + std::to_string(ln) + "_mb_" + std::to_string(mb) + "_block_" + std::to_string(block);
+                    DBPutMultimesh(dbfile, cloud_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
 
-                    if (DBMkDir(dbfile, dirname.c_str()) == -1)
+                    if (DBMkDir(dbfile, cloud_name.c_str()) == -1)
                     {
                         TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named " << dirname << std::endl);
-                    }
-
-                    const double* const X = local_X_arr + NDIM * offset;
-                    std::vector<const double*> var_vals(d_nvars[ln]);
-                    for (int v = 0; v < d_nvars[ln]; ++v)
-                    {
-                        var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                                                 << "  Could not create directory named " << cloud_name << std::endl);
                     }
+                }
 
-                    build_local_curv_block(dbfile,
-                                           dirname,
-                                           nelem,
-                                           periodic,
-                                           X,
-                                           d_nvars[ln],
-                                           d_var_names[ln],
-                                           d_var_start_depths[ln],
-                                           d_var_plot_depths[ln],
-                                           d_var_depths[ln],
-                                           var_vals,
-                                           time_step_number,
-                                           simulation_time);
-                    multimeshtype[ln][mb].push_back(DB_QUAD_CURV);
-                    multivartype[ln][mb].push_back(DB_QUADVAR);
+                for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
+                {
+                    current_file_name = get_silo_processor_data_path(proc, mpi_nodes, num_files);
 
-                    offset += ntot;
-                }
-            }
+                    std::string meshname = current_file_name + "level_" + std::to_string(ln) + "_block_" +
+                                           std::to_string(block) + "/mesh";
+                    auto meshname_ptr = const_cast<char*>(meshname.c_str());
+                    int meshtype = meshtypes_per_proc[ln][proc][block];
 
-            // Add the local UCD meshes to the local DBfile.
-            for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
-            {
-                const std::set<int>& vertices = d_ucd_mesh_vertices[ln][mesh];
-                const std::multimap<int, std::pair<int, int> >& edge_map = d_ucd_mesh_edge_maps[ln][mesh];
-                const size_t ntot = vertices.size();
+                    std::string& block_name = block_names_per_proc[ln][proc][block];
 
-                std::string dirname = "level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh);
+                    DBPutMultimesh(dbfile, block_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
 
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named " << dirname << std::endl);
+                    if (DBMkDir(dbfile, block_name.c_str()) == -1)
+                    {
+                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                                 << "  Could not create directory named " << block_name << std::endl);
+                    }
                 }
 
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
+                for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
                 {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                }
-
-                build_local_ucd_mesh(dbfile,
-                                     dirname,
-                                     vertices,
-                                     edge_map,
-                                     X,
-                                     d_nvars[ln],
-                                     d_var_names[ln],
-                                     d_var_start_depths[ln],
-                                     d_var_plot_depths[ln],
-                                     d_var_depths[ln],
-                                     var_vals,
-                                     time_step_number,
-                                     simulation_time);
-
-                offset += ntot;
-            }
-
-            // Clean up allocated data.
-            ierr = VecRestoreArray(local_X_vec, &local_X_arr);
-            IBTK_CHKERRQ(ierr);
-            ierr = VecDestroy(&local_X_vec);
-            IBTK_CHKERRQ(ierr);
-            for (int v = 0; v < d_nvars[ln]; ++v)
-            {
-                ierr = VecRestoreArray(local_v_vecs[v], &local_v_arrs[v]);
-                IBTK_CHKERRQ(ierr);
-                ierr = VecDestroy(&local_v_vecs[v]);
-                IBTK_CHKERRQ(ierr);
-            }
-        }
-    }
-
-    DBClose(dbfile);
-
-    // Send data to the root MPI process required to create the multimesh and
-    // multivar objects.
-    std::vector<std::vector<int> > nclouds_per_proc, nblocks_per_proc, nmbs_per_proc, nucd_meshes_per_proc;
-    std::vector<std::vector<std::vector<int> > > meshtypes_per_proc, vartypes_per_proc, mb_nblocks_per_proc;
-    std::vector<std::vector<std::vector<std::vector<int> > > > multimeshtypes_per_proc, multivartypes_per_proc;
-    std::vector<std::vector<std::vector<std::string> > > cloud_names_per_proc, block_names_per_proc, mb_names_per_proc,
-        ucd_mesh_names_per_proc;
-
-    if (mpi_rank == SILO_MPI_ROOT)
-    {
-        nclouds_per_proc.resize(d_finest_ln + 1);
-        nblocks_per_proc.resize(d_finest_ln + 1);
-        nmbs_per_proc.resize(d_finest_ln + 1);
-        nucd_meshes_per_proc.resize(d_finest_ln + 1);
-        meshtypes_per_proc.resize(d_finest_ln + 1);
-        vartypes_per_proc.resize(d_finest_ln + 1);
-        mb_nblocks_per_proc.resize(d_finest_ln + 1);
-        multimeshtypes_per_proc.resize(d_finest_ln + 1);
-        multivartypes_per_proc.resize(d_finest_ln + 1);
-        cloud_names_per_proc.resize(d_finest_ln + 1);
-        block_names_per_proc.resize(d_finest_ln + 1);
-        mb_names_per_proc.resize(d_finest_ln + 1);
-        ucd_mesh_names_per_proc.resize(d_finest_ln + 1);
-    }
-
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        if (mpi_rank == SILO_MPI_ROOT)
-        {
-            nclouds_per_proc[ln].resize(mpi_nodes);
-            nblocks_per_proc[ln].resize(mpi_nodes);
-            nmbs_per_proc[ln].resize(mpi_nodes);
-            nucd_meshes_per_proc[ln].resize(mpi_nodes);
-            meshtypes_per_proc[ln].resize(mpi_nodes);
-            vartypes_per_proc[ln].resize(mpi_nodes);
-            mb_nblocks_per_proc[ln].resize(mpi_nodes);
-            multimeshtypes_per_proc[ln].resize(mpi_nodes);
-            multivartypes_per_proc[ln].resize(mpi_nodes);
-            cloud_names_per_proc[ln].resize(mpi_nodes);
-            block_names_per_proc[ln].resize(mpi_nodes);
-            mb_names_per_proc[ln].resize(mpi_nodes);
-            ucd_mesh_names_per_proc[ln].resize(mpi_nodes);
-
-            // Set the values for the root process.
-            nclouds_per_proc[ln][mpi_rank] = d_nclouds[ln];
-            nblocks_per_proc[ln][mpi_rank] = d_nblocks[ln];
-            nmbs_per_proc[ln][mpi_rank] = d_nmbs[ln];
-            nucd_meshes_per_proc[ln][mpi_rank] = d_nucd_meshes[ln];
-            meshtypes_per_proc[ln][mpi_rank] = meshtype[ln];
-            vartypes_per_proc[ln][mpi_rank] = vartype[ln];
-            mb_nblocks_per_proc[ln][mpi_rank] = d_mb_nblocks[ln];
-            multimeshtypes_per_proc[ln][mpi_rank] = multimeshtype[ln];
-            multivartypes_per_proc[ln][mpi_rank] = multivartype[ln];
-            cloud_names_per_proc[ln][mpi_rank] = d_cloud_names[ln];
-            block_names_per_proc[ln][mpi_rank] = d_block_names[ln];
-            mb_names_per_proc[ln][mpi_rank] = d_mb_names[ln];
-            ucd_mesh_names_per_proc[ln][mpi_rank] = d_ucd_mesh_names[ln];
-        }
-
-        // Get the values for the non-root processes.
-        int one = 1;
-        for (int proc = 0; proc < mpi_nodes; ++proc)
-        {
-            // Skip the root process; we already have those values.
-            if (proc == SILO_MPI_ROOT)
-            {
-                proc += 1;
-                if (proc >= mpi_nodes) break;
-            }
-
-            if (mpi_rank == proc)
-            {
-                SAMRAI_MPI::send(&d_nclouds[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                SAMRAI_MPI::recv(&nclouds_per_proc[ln][proc], one, proc, false);
-            }
-
-            if (mpi_rank == proc && d_nclouds[ln] > 0)
-            {
-                int num_bytes;
-                for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
-                {
-                    num_bytes = static_cast<int>((d_cloud_names[ln][cloud].size() + 1) * sizeof(char));
-                    SAMRAI_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    SAMRAI_MPI::sendBytes(
-                        static_cast<const void*>(d_cloud_names[ln][cloud].c_str()), num_bytes, SILO_MPI_ROOT);
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nclouds_per_proc[ln][proc] > 0)
-            {
-                cloud_names_per_proc[ln][proc].resize(nclouds_per_proc[ln][proc]);
-
-                int num_bytes;
-                for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
-                {
-                    SAMRAI_MPI::recv(&num_bytes, one, proc, false);
-                    std::vector<char> name(num_bytes / sizeof(char));
-                    SAMRAI_MPI::recvBytes(static_cast<void*>(name.data()), num_bytes);
-                    cloud_names_per_proc[ln][proc][cloud].assign(name.data());
-                }
-            }
-
-            if (mpi_rank == proc)
-            {
-                SAMRAI_MPI::send(&d_nblocks[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                SAMRAI_MPI::recv(&nblocks_per_proc[ln][proc], one, proc, false);
-            }
-
-            if (mpi_rank == proc && d_nblocks[ln] > 0)
-            {
-                SAMRAI_MPI::send(&meshtype[ln][0], d_nblocks[ln], SILO_MPI_ROOT, false);
-                SAMRAI_MPI::send(&vartype[ln][0], d_nblocks[ln], SILO_MPI_ROOT, false);
-
-                int num_bytes;
-                for (int block = 0; block < d_nblocks[ln]; ++block)
-                {
-                    num_bytes = static_cast<int>((d_block_names[ln][block].size() + 1) * sizeof(char));
-                    SAMRAI_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    SAMRAI_MPI::sendBytes(
-                        static_cast<const void*>(d_block_names[ln][block].c_str()), num_bytes, SILO_MPI_ROOT);
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nblocks_per_proc[ln][proc] > 0)
-            {
-                meshtypes_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
-                vartypes_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
-                block_names_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
-
-                SAMRAI_MPI::recv(&meshtypes_per_proc[ln][proc][0], nblocks_per_proc[ln][proc], proc, false);
-                SAMRAI_MPI::recv(&vartypes_per_proc[ln][proc][0], nblocks_per_proc[ln][proc], proc, false);
-
-                int num_bytes;
-                for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
-                {
-                    SAMRAI_MPI::recv(&num_bytes, one, proc, false);
-                    std::vector<char> name(num_bytes / sizeof(char));
-                    SAMRAI_MPI::recvBytes(static_cast<void*>(name.data()), num_bytes);
-                    block_names_per_proc[ln][proc][block].assign(name.data());
-                }
-            }
-
-            if (mpi_rank == proc)
-            {
-                SAMRAI_MPI::send(&d_nmbs[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                SAMRAI_MPI::recv(&nmbs_per_proc[ln][proc], one, proc, false);
-            }
-
-            if (mpi_rank == proc && d_nmbs[ln] > 0)
-            {
-                SAMRAI_MPI::send(&d_mb_nblocks[ln][0], d_nmbs[ln], SILO_MPI_ROOT, false);
-
-                int num_bytes;
-                for (int mb = 0; mb < d_nmbs[ln]; ++mb)
-                {
-                    SAMRAI_MPI::send(&multimeshtype[ln][mb][0], d_mb_nblocks[ln][mb], SILO_MPI_ROOT, false);
-                    SAMRAI_MPI::send(&multivartype[ln][mb][0], d_mb_nblocks[ln][mb], SILO_MPI_ROOT, false);
-
-                    num_bytes = static_cast<int>(d_mb_names[ln][mb].size()) + 1;
-                    SAMRAI_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-
-                    const void* mb_name_ptr = d_mb_names[ln][mb].c_str();
-                    MPI_Send(const_cast<void*>(mb_name_ptr),
-                             num_bytes,
-                             MPI_CHAR,
-                             SILO_MPI_ROOT,
-                             SILO_MPI_TAG,
-                             SAMRAI_MPI::commWorld);
-                    const int tree = SAMRAI_MPI::getTreeDepth();
-                    SAMRAI_MPI::updateOutgoingStatistics(tree, num_bytes * sizeof(char));
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nmbs_per_proc[ln][proc] > 0)
-            {
-                mb_nblocks_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-                multimeshtypes_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-                multivartypes_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-                mb_names_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-
-                SAMRAI_MPI::recv(&mb_nblocks_per_proc[ln][proc][0], nmbs_per_proc[ln][proc], proc, false);
-
-                int num_bytes;
-                for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
-                {
-                    multimeshtypes_per_proc[ln][proc][mb].resize(mb_nblocks_per_proc[ln][proc][mb]);
-                    multivartypes_per_proc[ln][proc][mb].resize(mb_nblocks_per_proc[ln][proc][mb]);
-
-                    SAMRAI_MPI::recv(
-                        &multimeshtypes_per_proc[ln][proc][mb][0], mb_nblocks_per_proc[ln][proc][mb], proc, false);
-                    SAMRAI_MPI::recv(
-                        &multivartypes_per_proc[ln][proc][mb][0], mb_nblocks_per_proc[ln][proc][mb], proc, false);
-
-                    SAMRAI_MPI::recv(&num_bytes, one, proc, false);
-                    std::vector<char> name(num_bytes / sizeof(char));
-
-                    MPI_Status status;
-                    MPI_Recv(name.data(), num_bytes, MPI_CHAR, proc, SILO_MPI_TAG, SAMRAI_MPI::commWorld, &status);
-                    const int tree = SAMRAI_MPI::getTreeDepth();
-                    SAMRAI_MPI::updateIncomingStatistics(tree, num_bytes * sizeof(char));
-
-                    mb_names_per_proc[ln][proc][mb].assign(name.data());
-                }
-            }
-
-            if (mpi_rank == proc)
-            {
-                SAMRAI_MPI::send(&d_nucd_meshes[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                SAMRAI_MPI::recv(&nucd_meshes_per_proc[ln][proc], one, proc, false);
-            }
-
-            if (mpi_rank == proc && d_nucd_meshes[ln] > 0)
-            {
-                int num_bytes;
-                for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
-                {
-                    num_bytes = static_cast<int>((d_ucd_mesh_names[ln][mesh].size() + 1) * sizeof(char));
-                    SAMRAI_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    SAMRAI_MPI::sendBytes(
-                        static_cast<const void*>(d_ucd_mesh_names[ln][mesh].c_str()), num_bytes, SILO_MPI_ROOT);
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nucd_meshes_per_proc[ln][proc] > 0)
-            {
-                ucd_mesh_names_per_proc[ln][proc].resize(nucd_meshes_per_proc[ln][proc]);
-                int num_bytes;
-                for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
-                {
-                    SAMRAI_MPI::recv(&num_bytes, one, proc, false);
-                    std::vector<char> name(num_bytes / sizeof(char));
-                    SAMRAI_MPI::recvBytes(static_cast<void*>(name.data()), num_bytes);
-                    ucd_mesh_names_per_proc[ln][proc][mesh].assign(name.data());
-                }
-            }
-
-            SAMRAI_MPI::barrier();
-        }
-    }
-
-    if (mpi_rank == SILO_MPI_ROOT)
-    {
-        // Create and initialize the multimesh Silo database on the root MPI
-        // process.
-        std::snprintf(temp_buf, sizeof(temp_buf), "%06d", d_time_step_number);
-        std::string summary_file_name =
-            dump_dirname + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
-        if (!(dbfile = DBCreate(summary_file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
-        {
-            TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                     << "  Could not create DBfile named " << summary_file_name << std::endl);
-        }
-
-        int cycle = time_step_number;
-        auto time = static_cast<float>(simulation_time);
-        double dtime = simulation_time;
-
-        static const int MAX_OPTS = 3;
-        DBoptlist* optlist = DBMakeOptlist(MAX_OPTS);
-        DBAddOption(optlist, DBOPT_CYCLE, &cycle);
-        DBAddOption(optlist, DBOPT_TIME, &time);
-        DBAddOption(optlist, DBOPT_DTIME, &dtime);
-
-        for (int proc = 0; proc < mpi_nodes; ++proc)
-        {
-            for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-            {
-                for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
-                {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    std::string meshname = current_file_name + ":level_" + std::to_string(ln) + "_cloud_" +
-                                           std::to_string(cloud) + "/mesh";
-                    auto meshname_ptr = const_cast<char*>(meshname.c_str());
-                    int meshtype = DB_POINTMESH;
-
-                    std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
-
-                    DBPutMultimesh(dbfile, cloud_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
-
-                    if (DBMkDir(dbfile, cloud_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named " << cloud_name << std::endl);
-                    }
-                }
-
-                for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
-                {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    std::string meshname = current_file_name + ":level_" + std::to_string(ln) + "_block_" +
-                                           std::to_string(block) + "/mesh";
-                    auto meshname_ptr = const_cast<char*>(meshname.c_str());
-                    int meshtype = meshtypes_per_proc[ln][proc][block];
-
-                    std::string& block_name = block_names_per_proc[ln][proc][block];
-
-                    DBPutMultimesh(dbfile, block_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
-
-                    if (DBMkDir(dbfile, block_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named " << block_name << std::endl);
-                    }
-                }
-
-                for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
-                {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+                    current_file_name = get_silo_processor_data_path(proc, mpi_nodes, num_files);
 
                     const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
                     std::vector<std::string> meshnames;
                     for (int block = 0; block < nblocks; ++block)
                     {
-                        meshnames.push_back(current_file_name + ":level_" + std::to_string(ln) + "_mb_" +
+                        meshnames.push_back(current_file_name + "level_" + std::to_string(ln) + "_mb_" +
                                             std::to_string(mb) + "_block_" + std::to_string(block) + "/mesh");
                     }
                     std::vector<const char*> meshnames_ptrs;
@@ -1820,13 +1636,10 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                 for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
                 {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+                    current_file_name = get_silo_processor_data_path(proc, mpi_nodes, num_files);
 
                     std::string meshname =
-                        current_file_name + ":level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh) + "/mesh";
+                        current_file_name + "level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh) + "/mesh";
                     auto meshname_ptr = const_cast<char*>(meshname.c_str());
                     int meshtype = DB_UCDMESH;
 
@@ -1845,12 +1658,9 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                 {
                     for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
                     {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+                        current_file_name = get_silo_processor_data_path(proc, mpi_nodes, num_files);
 
-                        std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_cloud_" +
+                        std::string varname = current_file_name + "level_" + std::to_string(ln) + "_cloud_" +
                                               std::to_string(cloud) + "/" + d_var_names[ln][v];
                         auto varname_ptr = const_cast<char*>(varname.c_str());
                         int vartype = DB_POINTVAR;
@@ -1864,12 +1674,9 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                     for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
                     {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+                        current_file_name = get_silo_processor_data_path(proc, mpi_nodes, num_files);
 
-                        std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_block_" +
+                        std::string varname = current_file_name + "level_" + std::to_string(ln) + "_block_" +
                                               std::to_string(block) + "/" + d_var_names[ln][v];
                         auto varname_ptr = const_cast<char*>(varname.c_str());
                         int vartype = vartypes_per_proc[ln][proc][block];
@@ -1883,17 +1690,14 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                     for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
                     {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+                        current_file_name = get_silo_processor_data_path(proc, mpi_nodes, num_files);
 
                         const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
 
                         std::vector<std::string> varnames;
                         for (int block = 0; block < nblocks; ++block)
                         {
-                            varnames.push_back(current_file_name + ":level_" + std::to_string(ln) + "_mb_" +
+                            varnames.push_back(current_file_name + "level_" + std::to_string(ln) + "_mb_" +
                                                std::to_string(mb) + "_block_" + std::to_string(block) +
                                                d_var_names[ln][v]);
                         }
@@ -1917,12 +1721,9 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                     for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
                     {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+                        current_file_name = get_silo_processor_data_path(proc, mpi_nodes, num_files);
 
-                        std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_mesh_" +
+                        std::string varname = current_file_name + "level_" + std::to_string(ln) + "_mesh_" +
                                               std::to_string(mesh) + "/" + d_var_names[ln][v];
                         auto varname_ptr = const_cast<char*>(varname.c_str());
                         int vartype = DB_UCDVAR;
@@ -1960,6 +1761,35 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
             sfile.close();
         }
     }
+
+    // Write the local data.  Asynchronous writes are not used with grouped
+    // output files because the processes in each group must take turns
+    // writing to the file of the group.  They are also not used with the HDF5
+    // driver, since other code may use HDF5 on the main thread (e.g., plot
+    // and restart files written by SAMRAI) while the write is pending.
+    //
+    // NOTE: The summary file is written before the local data so that the
+    // Silo library is not used by more than one thread at a time.
+    if (d_use_async_writes && !use_file_groups && !useHDF5Driver())
+    {
+        s_write_thread = std::thread(&LSiloDataWriter::writeLocalPlotData,
+                                     this,
+                                     local_file_name,
+                                     /*create_file*/ true,
+                                     proc_dirname,
+                                     std::move(X_data),
+                                     std::move(var_data),
+                                     time_step_number,
+                                     simulation_time);
+    }
+    else
+    {
+        int baton = 1, baton_sz = 1;
+        if (!first_in_group) SAMRAI_MPI::recv(&baton, baton_sz, mpi_rank - 1, false, SILO_MPI_TAG);
+        writeLocalPlotData(
+            local_file_name, first_in_group, proc_dirname, X_data, var_data, time_step_number, simulation_time);
+        if (!last_in_group) SAMRAI_MPI::send(&baton, baton_sz, mpi_rank + 1, false, SILO_MPI_TAG);
+    }
     SAMRAI_MPI::barrier();
 #else
     TBOX_WARNING("LSiloDataWriter::writePlotData(): SILO is not installed; cannot write data." << std::endl);
@@ -1967,12 +1797,42 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
     return;
 } // writePlotData
 
+void
+LSiloDataWriter::setCompression(const std::string& compression)
+{
+    waitForPendingWrites();
+    d_compression = compression;
+    return;
+} // setCompression
+
+void
+LSiloDataWriter::setUseAsynchronousWrites(const bool use_async_writes)
+{
+    d_use_async_writes = use_async_writes;
+    return;
+} // setUseAsynchronousWrites
+
+void
+LSiloDataWriter::waitForPendingWrites()
+{
+    waitForAllPendingWrites();
+    return;
+} // waitForPendingWrites
+
+void
+LSiloDataWriter::waitForAllPendingWrites()
+{
+    if (s_write_thread.joinable()) s_write_thread.join();
+    return;
+} // waitForAllPendingWrites
+
 void
 LSiloDataWriter::putToDatabase(Pointer<Database> db)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(db);
 #endif
+    waitForPendingWrites();
     db->putInteger("LAG_SILO_DATA_WRITER_VERSION", LAG_SILO_DATA_WRITER_VERSION);
 
     db->putInteger("d_coarsest_ln", d_coarsest_ln);
@@ -2234,6 +2094,286 @@ LSiloDataWriter::buildVecScatters(AO& ao, const int level_number)
     return;
 } // buildVecScatters
 
+void
+LSiloDataWriter::copyToLocalBuffer(std::vector<double>& buffer, Vec global_vec, const int depth, const int level_number)
+{
+    int ierr;
+    Vec local_vec;
+    ierr = VecDuplicate(d_dst_vec[level_number][depth], &local_vec);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecScatterBegin(d_vec_scatter[level_number][depth], global_vec, local_vec, INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecScatterEnd(d_vec_scatter[level_number][depth], global_vec, local_vec, INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    int local_size;
+    ierr = VecGetLocalSize(local_vec, &local_size);
+    IBTK_CHKERRQ(ierr);
+    const double* local_arr;
+    ierr = VecGetArrayRead(local_vec, &local_arr);
+    IBTK_CHKERRQ(ierr);
+    buffer.assign(local_arr, local_arr + local_size);
+    ierr = VecRestoreArrayRead(local_vec, &local_arr);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&local_vec);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // copyToLocalBuffer
+
+bool
+LSiloDataWriter::useHDF5Driver() const
+{
+    // The Silo library compresses data only when the HDF5 driver is used.
+    bool use_compression = !d_compression.empty();
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        for (const auto& var_compression : d_var_compressions[ln])
+        {
+            use_compression = use_compression || !var_compression.empty();
+        }
+    }
+    return use_compression;
+} // useHDF5Driver
+
+void
+LSiloDataWriter::writeLocalPlotData(const std::string& file_name,
+                                    const bool create_file,
+                                    const std::string& proc_dirname,
+                                    const std::vector<std::vector<double> >& X_data,
+                                    const std::vector<std::vector<std::vector<double> > >& var_data,
+                                    const int time_step_number,
+                                    const double simulation_time)
+{
+#if defined(IBTK_HAVE_SILO)
+    const int db_type = useHDF5Driver() ? DB_HDF5 : DB_PDB;
+
+    DBfile* dbfile;
+    if (create_file)
+    {
+        dbfile = DBCreate(file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, db_type);
+    }
+    else
+    {
+        dbfile = DBOpen(file_name.c_str(), db_type, DB_APPEND);
+    }
+    if (!dbfile)
+    {
+        TBOX_ERROR(d_object_name << "::writeLocalPlotData()\n"
+                                 << "  Could not create DBfile named " << file_name << std::endl);
+    }
+    if (!proc_dirname.empty())
+    {
+        if (DBMkDir(dbfile, proc_dirname.c_str()) == -1 || DBSetDir(dbfile, proc_dirname.c_str()) == -1)
+        {
+            TBOX_ERROR(d_object_name << "::writeLocalPlotData()\n"
+                                     << "  Could not create directory named " << proc_dirname << std::endl);
+        }
+    }
+
+    // Write the local data.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        if (d_coords_data[ln])
+        {
+            const double* const local_X_arr = X_data[ln].data();
+            std::vector<const double*> local_v_arrs(d_nvars[ln]);
+            for (int v = 0; v < d_nvars[ln]; ++v)
+            {
+                local_v_arrs[v] = var_data[ln][v].data();
+            }
+
+            // Determine the compression of each variable.
+            std::vector<std::string> var_compressions(d_nvars[ln]);
+            for (int v = 0; v < d_nvars[ln]; ++v)
+            {
+                const std::string& var_compression = d_var_compressions[ln][v];
+                var_compressions[v] = var_compression.empty() ? d_compression : var_compression;
+                if (var_compressions[v] == "NONE") var_compressions[v].clear();
+            }
+
+            // Keep track of the current offset in the local Vec data.
+            int offset = 0;
+
+            // Add the local clouds to the local DBfile.
+            for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
+            {
+                const int nmarks = d_cloud_nmarks[ln][cloud];
+
+                std::string dirname = "level_" + std::to_string(ln) + "_cloud_" + std::to_string(cloud);
+
+                if (DBMkDir(dbfile, dirname.c_str()) == -1)
+                {
+                    TBOX_ERROR(d_object_name << "::writeLocalPlotData()\n"
+                                             << "  Could not create directory named " << dirname << std::endl);
+                }
+
+                const double* const X = local_X_arr + NDIM * offset;
+                std::vector<const double*> var_vals(d_nvars[ln]);
+                for (int v = 0; v < d_nvars[ln]; ++v)
+                {
+                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                }
+
+                build_local_marker_cloud(dbfile,
+                                         dirname,
+                                         nmarks,
+                                         X,
+                                         d_nvars[ln],
+                                         d_var_names[ln],
+                                         d_var_start_depths[ln],
+                                         d_var_plot_depths[ln],
+                                         d_var_depths[ln],
+                                         d_compression,
+                                         var_compressions,
+                                         var_vals,
+                                         time_step_number,
+                                         simulation_time);
+
+                offset += nmarks;
+            }
+
+            // Add the local blocks to the local DBfile.
+            for (int block = 0; block < d_nblocks[ln]; ++block)
+            {
+                const IntVector<NDIM>& nelem = d_block_nelems[ln][block];
+                const IntVector<NDIM>& periodic = d_block_periodic[ln][block];
+                const int ntot = nelem.getProduct();
+
+                std::string dirname = "level_" + std::to_string(ln) + "_block_" + std::to_string(block);
+
+                if (DBMkDir(dbfile, dirname.c_str()) == -1)
+                {
+                    TBOX_ERROR(d_object_name << "::writeLocalPlotData()\n"
+                                             << "  Could not create directory named " << dirname << std::endl);
+                }
+
+                const double* const X = local_X_arr + NDIM * offset;
+                std::vector<const double*> var_vals(d_nvars[ln]);
+                for (int v = 0; v < d_nvars[ln]; ++v)
+                {
+                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                }
+
+                build_local_curv_block(dbfile,
+                                       dirname,
+                                       nelem,
+                                       periodic,
+                                       X,
+                                       d_nvars[ln],
+                                       d_var_names[ln],
+                                       d_var_start_depths[ln],
+                                       d_var_plot_depths[ln],
+                                       d_var_depths[ln],
+                                       d_compression,
+                                       var_compressions,
+                                       var_vals,
+                                       time_step_number,
+                                       simulation_time);
+
+                offset += ntot;
+            }
+
+            // Add the local multiblocks to the local DBfile.
+            for (int mb = 0; mb < d_nmbs[ln]; ++mb)
+            {
+                for (int block = 0; block < d_mb_nblocks[ln][mb]; ++block)
+                {
+                    const IntVector<NDIM>& nelem = d_mb_nelems[ln][mb][block];
+                    const IntVector<NDIM>& periodic = d_mb_periodic[ln][mb][block];
+                    const int ntot = nelem.getProduct();
+
+                    std::string dirname =
+                        "level_" + std::to_string(ln) + "_mb_" + std::to_string(mb) + "_block_" + std::to_string(block);
+
+                    if (DBMkDir(dbfile, dirname.c_str()) == -1)
+                    {
+                        TBOX_ERROR(d_object_name << "::writeLocalPlotData()\n"
+                                                 << "  Could not create directory named " << dirname << std::endl);
+                    }
+
+                    const double* const X = local_X_arr + NDIM * offset;
+                    std::vector<const double*> var_vals(d_nvars[ln]);
+                    for (int v = 0; v < d_nvars[ln]; ++v)
+                    {
+                        var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                    }
+
+                    build_local_curv_block(dbfile,
+                                           dirname,
+                                           nelem,
+                                           periodic,
+                                           X,
+                                           d_nvars[ln],
+                                           d_var_names[ln],
+                                           d_var_start_depths[ln],
+                                           d_var_plot_depths[ln],
+                                           d_var_depths[ln],
+                                           d_compression,
+                                           var_compressions,
+                                           var_vals,
+                                           time_step_number,
+                                           simulation_time);
+
+                    offset += ntot;
+                }
+            }
+
+            // Add the local UCD meshes to the local DBfile.
+            for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
+            {
+                const std::set<int>& vertices = d_ucd_mesh_vertices[ln][mesh];
+                const std::multimap<int, std::pair<int, int> >& edge_map = d_ucd_mesh_edge_maps[ln][mesh];
+                const size_t ntot = vertices.size();
+
+                std::string dirname = "level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh);
+
+                if (DBMkDir(dbfile, dirname.c_str()) == -1)
+                {
+                    TBOX_ERROR(d_object_name << "::writeLocalPlotData()\n"
+                                             << "  Could not create directory named " << dirname << std::endl);
+                }
+
+                const double* const X = local_X_arr + NDIM * offset;
+                std::vector<const double*> var_vals(d_nvars[ln]);
+                for (int v = 0; v < d_nvars[ln]; ++v)
+                {
+                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                }
+
+                build_local_ucd_mesh(dbfile,
+                                     dirname,
+                                     vertices,
+                                     edge_map,
+                                     X,
+                                     d_nvars[ln],
+                                     d_var_names[ln],
+                                     d_var_start_depths[ln],
+                                     d_var_plot_depths[ln],
+                                     d_var_depths[ln],
+                                     d_compression,
+                                     var_compressions,
+                                     var_vals,
+                                     time_step_number,
+                                     simulation_time);
+
+                offset += ntot;
+            }
+        }
+    }
+
+    set_compression(std::string());
+    DBClose(dbfile);
+#else
+    NULL_USE(file_name);
+    NULL_USE(create_file);
+    NULL_USE(proc_dirname);
+    NULL_USE(X_data);
+    NULL_USE(var_data);
+    NULL_USE(time_step_number);
+    NULL_USE(simulation_time);
+#endif // if defined(IBTK_HAVE_SILO)
+    return;
+} // writeLocalPlotData
+
 void
 LSiloDataWriter::getFromRestart()
 {
@@ -70,6 +70,7 @@
 #include "tbox/MathUtilities.h"
 #include "tbox/Pointer.h"
 
+#include <functional>
 #include <ostream>
 #include <utility>
 #include <vector>
@@ -131,7 +132,8 @@ HierarchyMathOps::HierarchyMathOps(std::string name,
                                    Pointer<PatchHierarchy<NDIM> > hierarchy,
                                    const int coarsest_ln,
                                    const int finest_ln,
-                                   std::string coarsen_op_name)
+                                   std::string coarsen_op_name,
+                                   const unsigned int num_threads)
     : d_object_name(std::move(name)),
       d_coarsest_ln(coarsest_ln),
       d_finest_ln(finest_ln),
@@ -228,6 +230,10 @@ HierarchyMathOps::HierarchyMathOps(std::string name,
         d_wgt_sc_idx = var_db->registerVariableAndContext(d_wgt_sc_var, d_context);
     }
 
+    // Setup the threads used to execute patch computations.
+    const unsigned int num_patch_threads = num_threads > 0 ? num_threads : ThreadPool::getDefaultNumberOfThreads();
+    if (num_patch_threads > 1) d_thread_pool.reset(new ThreadPool(num_patch_threads));
+
     // Set the patch hierarchy.
     setPatchHierarchy(hierarchy);
     if ((coarsest_ln < 0) || (finest_ln < 0))
@@ -400,15 +406,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        });
     }
     else
     {
@@ -438,10 +441,7 @@ HierarchyMathOps::curl(const int dst_idx,
             {
                 Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-                {
-                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+                forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
                     Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
                     Pointer<SideData<NDIM, double> > sc_data = patch->getPatchData(d_sc_idx);
 #if (NDIM == 2)
@@ -557,7 +557,7 @@ HierarchyMathOps::curl(const int dst_idx,
                                              patch_box.lower(2),
                                              patch_box.upper(2));
 #endif
-                }
+                });
             }
         }
 
@@ -584,15 +584,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // curl
@@ -612,15 +609,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // curl
@@ -640,15 +634,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // curl
@@ -668,15 +659,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // curl
@@ -700,15 +688,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // curl
@@ -732,15 +717,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<EdgeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // curl
@@ -931,17 +913,14 @@ HierarchyMathOps::div(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete divergence.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
                 (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
 
             d_patch_math_ops.div(dst_data, alpha, src1_data, beta, src2_data, patch, dst_depth, src2_depth);
-        }
+        });
     }
     else
     {
@@ -1011,10 +990,7 @@ HierarchyMathOps::div(const int dst_idx,
 
         // Compute the discrete divergence and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
@@ -1027,7 +1003,7 @@ HierarchyMathOps::div(const int dst_idx,
                 Pointer<OuterfaceData<NDIM, double> > of_data = patch->getPatchData(d_of_idx);
                 of_data->copy(*src1_data);
             }
-        }
+        });
 
         // Synchronize the coarse-fine interface of src1 and deallocate
         // temporary data.
@@ -1069,10 +1045,7 @@ HierarchyMathOps::div(const int dst_idx,
 
         // Compute the discrete divergence and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
@@ -1085,7 +1058,7 @@ HierarchyMathOps::div(const int dst_idx,
                 Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
                 os_data->copy(*src1_data);
             }
-        }
+        });
 
         // Synchronize the coarse-fine interface of src1 and deallocate
         // temporary data.
@@ -1119,17 +1092,14 @@ HierarchyMathOps::grad(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete gradient.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
                 (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
 
             d_patch_math_ops.grad(dst_data, alpha, src1_data, beta, src2_data, patch, src1_depth);
-        }
+        });
     }
     else
     {
@@ -1218,10 +1188,7 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<FaceData<NDIM, double> > src2_data =
@@ -1234,7 +1201,7 @@ HierarchyMathOps::grad(const int dst_idx,
                 Pointer<OuterfaceData<NDIM, double> > of_data = patch->getPatchData(d_of_idx);
                 of_data->copy(*dst_data);
             }
-        }
+        });
     }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
@@ -1277,10 +1244,7 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<SideData<NDIM, double> > src2_data =
@@ -1293,7 +1257,7 @@ HierarchyMathOps::grad(const int dst_idx,
                 Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
                 os_data->copy(*dst_data);
             }
-        }
+        });
     }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
@@ -1483,10 +1447,7 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<FaceData<NDIM, double> > src2_data =
@@ -1536,7 +1497,7 @@ HierarchyMathOps::grad(const int dst_idx,
                 Pointer<OuterfaceData<NDIM, double> > of_data = patch->getPatchData(d_of_idx);
                 of_data->copy(*dst_data);
             }
-        }
+        });
     }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
@@ -1580,10 +1541,7 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<SideData<NDIM, double> > src2_data =
@@ -1633,7 +1591,7 @@ HierarchyMathOps::grad(const int dst_idx,
                 Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
                 os_data->copy(*dst_data);
             }
-        }
+        });
     }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
@@ -1670,10 +1628,7 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
@@ -1684,7 +1639,7 @@ HierarchyMathOps::interp(const int dst_idx,
                 Pointer<OuterfaceData<NDIM, double> > of_data = patch->getPatchData(d_of_idx);
                 of_data->copy(*src_data);
             }
-        }
+        });
 
         // Synchronize the coarse-fine interface and deallocate temporary data.
         if ((ln > d_coarsest_ln) && src_cf_bdry_synch)
@@ -1718,10 +1673,7 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
@@ -1732,7 +1684,7 @@ HierarchyMathOps::interp(const int dst_idx,
                 Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
                 os_data->copy(*src_data);
             }
-        }
+        });
 
         // Synchronize the coarse-fine interface and deallocate temporary data.
         if ((ln > d_coarsest_ln) && src_cf_bdry_synch)
@@ -1766,10 +1718,7 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
@@ -1780,7 +1729,7 @@ HierarchyMathOps::interp(const int dst_idx,
                 Pointer<OuterfaceData<NDIM, double> > of_data = patch->getPatchData(d_of_idx);
                 of_data->copy(*dst_data);
             }
-        }
+        });
     }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
@@ -1817,10 +1766,7 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
@@ -1831,7 +1777,7 @@ HierarchyMathOps::interp(const int dst_idx,
                 Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
                 os_data->copy(*dst_data);
             }
-        }
+        });
     }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
@@ -1861,15 +1807,12 @@ HierarchyMathOps::interp(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Interpolate.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.interp(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // interp
@@ -1889,15 +1832,12 @@ HierarchyMathOps::interp(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Interpolate.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<EdgeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.interp(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // interp
@@ -1918,15 +1858,12 @@ HierarchyMathOps::interp(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Interpolate.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.interp(dst_data, src_data, patch, dst_ghost_interp);
-        }
+        });
     }
     return;
 } // interp
@@ -1947,15 +1884,12 @@ HierarchyMathOps::interp(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Interpolate.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<EdgeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.interp(dst_data, src_data, patch, dst_ghost_interp);
-        }
+        });
     }
     return;
 } // interp
@@ -1982,10 +1916,7 @@ HierarchyMathOps::harmonic_interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
@@ -1996,7 +1927,7 @@ HierarchyMathOps::harmonic_interp(const int dst_idx,
                 Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
                 os_data->copy(*dst_data);
             }
-        }
+        });
     }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
@@ -2027,15 +1958,12 @@ HierarchyMathOps::harmonic_interp(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Interpolate
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.interp(dst_data, src_data, patch, dst_ghost_interp);
-        }
+        });
     }
     return;
 } // harmonic_interp
@@ -2056,15 +1984,12 @@ HierarchyMathOps::harmonic_interp(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Interpolate.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<EdgeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.interp(dst_data, src_data, patch, dst_ghost_interp);
-        }
+        });
     }
     return;
 } // harmonic_interp
@@ -2131,10 +2056,7 @@ HierarchyMathOps::laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete Laplacian.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
@@ -2142,7 +2064,7 @@ HierarchyMathOps::laplace(const int dst_idx,
 
             d_patch_math_ops.laplace(
                 dst_data, alpha, beta, src1_data, gamma, src2_data, patch, dst_depth, src1_depth, src2_depth);
-        }
+        });
     }
     else
     {
@@ -2348,17 +2270,14 @@ HierarchyMathOps::laplace(const int dst_idx,
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<SideData<NDIM, double> > src2_data =
                 (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
 
             d_patch_math_ops.laplace(dst_data, alpha, beta, src1_data, gamma, src2_data, patch);
-        }
+        });
     }
 
     // Allocate temporary data.
@@ -2374,14 +2293,11 @@ HierarchyMathOps::laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
             os_data->copy(*dst_data);
-        }
+        });
 
         // Synchronize the coarse-fine interface of dst.
         xeqScheduleOutersideRestriction(dst_idx, d_os_idx, ln - 1);
@@ -2446,10 +2362,7 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > coef1_data = patch->getPatchData(coef1_idx);
             Pointer<SideData<NDIM, double> > coef2_data =
@@ -2460,7 +2373,7 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
 
             d_patch_math_ops.vc_laplace(
                 dst_data, alpha, beta, coef1_data, coef2_data, src1_data, gamma, src2_data, patch, use_harmonic_interp);
-        }
+        });
     }
 
     // Allocate temporary data.
@@ -2476,14 +2389,11 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
             os_data->copy(*dst_data);
-        }
+        });
 
         // Synchronize the coarse-fine interface of dst.
         xeqScheduleOutersideRestriction(dst_idx, d_os_idx, ln - 1);
@@ -2548,10 +2458,7 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<EdgeData<NDIM, double> > coef1_data = patch->getPatchData(coef1_idx);
             Pointer<SideData<NDIM, double> > coef2_data =
@@ -2562,7 +2469,7 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
 
             d_patch_math_ops.vc_laplace(
                 dst_data, alpha, beta, coef1_data, coef2_data, src1_data, gamma, src2_data, patch, use_harmonic_interp);
-        }
+        });
     }
 
     // Allocate temporary data.
@@ -2578,14 +2485,11 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        forEachPatch(level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
             os_data->copy(*dst_data);
-        }
+        });
 
         // Synchronize the coarse-fine interface of dst.
         xeqScheduleOutersideRestriction(dst_idx, d_os_idx, ln - 1);
@@ -3377,6 +3281,31 @@ HierarchyMathOps::xeqScheduleOutersideRestriction(const int dst_idx, const int s
     return;
 } // xeqScheduleOutersideRestriction
 
+void
+HierarchyMathOps::forEachPatch(Pointer<PatchLevel<NDIM> > level,
+                               const std::function<void(const Pointer<Patch<NDIM> >&)>& task)
+{
+    if (!d_thread_pool)
+    {
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            task(level->getPatch(p()));
+        }
+        return;
+    }
+
+    // Collect the local patches on the calling thread so that the reference
+    // counted patch pointers are not shared between threads.
+    d_patches.clear();
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        d_patches.push_back(level->getPatch(p()));
+    }
+    d_thread_pool->parallelFor(static_cast<int>(d_patches.size()), [this, &task](const int k) { task(d_patches[k]); });
+    d_patches.clear();
+    return;
+} // forEachPatch
+
 void
 HierarchyMathOps::resetCellWeights(const int coarsest_ln, const int finest_ln)
 {
@@ -15,6 +15,7 @@
 
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/IndexUtilities.h"
+#include "ibtk/LEInteractor.h"
 #include "ibtk/PETScMatUtilities.h"
 #include "ibtk/PoissonUtilities.h"
 #include "ibtk/ibtk_enums.h"
@@ -1016,6 +1017,198 @@ PETScMatUtilities::constructPatchLevelSCInterpOp(Mat& mat,
     return;
 } // constructPatchLevelSCInterpOp
 
+void
+PETScMatUtilities::constructPatchLevelSCInterpOp(Mat& mat,
+                                                 const std::string& kernel_fcn,
+                                                 Vec& X_vec,
+                                                 const std::vector<int>& num_dofs_per_proc,
+                                                 const int dof_index_idx,
+                                                 Pointer<PatchLevel<NDIM> > patch_level)
+{
+    int ierr;
+    if (mat)
+    {
+        ierr = MatDestroy(&mat);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    // Determine the grid extents.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = patch_level->getGridGeometry();
+    const double* const x_lower = grid_geom->getXLower();
+    const double* const dx0 = grid_geom->getDx();
+    const IntVector<NDIM>& ratio = patch_level->getRatio();
+    double dx[NDIM];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        dx[d] = dx0[d] / static_cast<double>(ratio(d));
+    }
+    const BoxArray<NDIM>& domain_boxes = patch_level->getPhysicalDomain();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(domain_boxes.size() == 1);
+#endif
+    const hier::Index<NDIM>& domain_lower = domain_boxes[0].lower();
+
+    // The processor mapping determines which patches are assigned to which processors.
+    const ProcessorMapping& proc_mapping = patch_level->getProcessorMapping();
+
+    // Determine the matrix dimensions and index ranges.
+    int m_local;
+    ierr = VecGetLocalSize(X_vec, &m_local);
+    IBTK_CHKERRQ(ierr);
+    int i_lower, i_upper;
+    ierr = VecGetOwnershipRange(X_vec, &i_lower, &i_upper);
+    IBTK_CHKERRQ(ierr);
+
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int n_local = num_dofs_per_proc[mpi_rank];
+    const int j_lower = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.begin() + mpi_rank, 0);
+    const int j_upper = j_lower + n_local;
+    const int n_total = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.end(), 0);
+
+    // Determine the stencils and weights of the kernel function for each
+    // component of each local IB point, find a local patch that contains the
+    // IB point in its interior or ghost cell region, and compute the nonzero
+    // structure of the matrix.
+    const int n_local_points = m_local / NDIM;
+    const int stencil_size = LEInteractor::getStencilSize(kernel_fcn);
+    double* X_arr;
+    ierr = VecGetArray(X_vec, &X_arr);
+    IBTK_CHKERRQ(ierr);
+    std::vector<int> patch_num(n_local_points);
+    std::vector<Box<NDIM> > stencil_box(m_local);
+    std::vector<double> stencil_weights(m_local * NDIM * stencil_size);
+    std::vector<int> d_nnz(m_local, 0), o_nnz(m_local, 0);
+    for (int k = 0; k < n_local_points; ++k)
+    {
+        const double* const X = &X_arr[NDIM * k];
+        const hier::Index<NDIM> X_idx = IndexUtilities::getCellIndex(X, grid_geom, ratio);
+
+        // Find a local patch that contains the IB point in either its patch
+        // interior or ghost cell region.
+        bool found_local_patch = false;
+        for (int growth_size = 0; growth_size <= 1; ++growth_size)
+        {
+            Box<NDIM> box(X_idx, X_idx);
+            box.grow(IntVector<NDIM>(growth_size));
+            Array<int> patch_num_arr;
+            patch_level->getBoxTree()->findOverlapIndices(patch_num_arr, box);
+            for (int j = 0; j < patch_num_arr.size() && !found_local_patch; ++j)
+            {
+                const int n = patch_num_arr[j];
+                if (proc_mapping.isMappingLocal(n))
+                {
+                    patch_num[k] = n;
+                    found_local_patch = true;
+                }
+            }
+        }
+#if !defined(NDEBUG)
+        TBOX_ASSERT(found_local_patch);
+#endif
+        Pointer<Patch<NDIM> > patch = patch_level->getPatch(patch_num[k]);
+        Pointer<SideData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(dof_index_data->getDepth() == 1);
+#endif
+
+        // Compute the stencil boxes and weights and setup the nonzero
+        // structure.  Along the component axis, the degrees of freedom are
+        // located at the cell sides; along the other axes, they are located at
+        // the cell centers.
+        for (int axis = 0; axis < NDIM; ++axis)
+        {
+            const int local_idx = NDIM * k + axis;
+            Box<NDIM>& stencil_box_axis = stencil_box[local_idx];
+            double* const w = &stencil_weights[local_idx * NDIM * stencil_size];
+            for (int d = 0; d < NDIM; ++d)
+            {
+                const double X_o_dx = (X[d] - x_lower[d]) / dx[d] + (d == axis ? 0.5 : 0.0);
+                int lower;
+                const int width = LEInteractor::computeKernelWeights(kernel_fcn, X_o_dx, lower, &w[d * stencil_size]);
+                stencil_box_axis.lower()(d) = domain_lower(d) + lower;
+                stencil_box_axis.upper()(d) = domain_lower(d) + lower + width - 1;
+            }
+#if !defined(NDEBUG)
+            TBOX_ASSERT(SideGeometry<NDIM>::toSideBox(dof_index_data->getGhostBox(), axis).contains(stencil_box_axis));
+#endif
+            for (Box<NDIM>::Iterator b(stencil_box_axis); b; b++)
+            {
+                const int dof_index = (*dof_index_data)(SideIndex<NDIM>(b(), axis, SideIndex<NDIM>::Lower));
+                if (dof_index >= j_lower && dof_index < j_upper)
+                {
+                    d_nnz[local_idx] += 1;
+                }
+                else
+                {
+                    o_nnz[local_idx] += 1;
+                }
+            }
+            d_nnz[local_idx] = std::min(n_local, d_nnz[local_idx]);
+            o_nnz[local_idx] = std::min(n_total - n_local, o_nnz[local_idx]);
+        }
+    }
+    ierr = VecRestoreArray(X_vec, &X_arr);
+    IBTK_CHKERRQ(ierr);
+
+    // Create an empty matrix.
+    ierr = MatCreateAIJ(PETSC_COMM_WORLD,
+                        m_local,
+                        n_local,
+                        PETSC_DETERMINE,
+                        PETSC_DETERMINE,
+                        0,
+                        m_local ? &d_nnz[0] : nullptr,
+                        0,
+                        m_local ? &o_nnz[0] : nullptr,
+                        &mat);
+    IBTK_CHKERRQ(ierr);
+
+    // Set the matrix coefficients as the tensor products of the
+    // one-dimensional weights.
+    std::vector<double> stencil_box_vals;
+    std::vector<int> stencil_box_cols;
+    for (int k = 0; k < n_local_points; ++k)
+    {
+        Pointer<Patch<NDIM> > patch = patch_level->getPatch(patch_num[k]);
+        Pointer<SideData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
+        for (int axis = 0; axis < NDIM; ++axis)
+        {
+            const int local_idx = NDIM * k + axis;
+            const Box<NDIM>& stencil_box_axis = stencil_box[local_idx];
+            const hier::Index<NDIM>& stencil_box_lower = stencil_box_axis.lower();
+            const double* const w = &stencil_weights[local_idx * NDIM * stencil_size];
+            const int stencil_box_nvals = stencil_box_axis.size();
+            stencil_box_vals.resize(stencil_box_nvals);
+            stencil_box_cols.resize(stencil_box_nvals);
+            int stencil_idx = 0;
+            for (Box<NDIM>::Iterator b(stencil_box_axis); b; b++, ++stencil_idx)
+            {
+                const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
+                double val = 1.0;
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    val *= w[d * stencil_size + i(d) - stencil_box_lower(d)];
+                }
+                stencil_box_vals[stencil_idx] = val;
+                stencil_box_cols[stencil_idx] = (*dof_index_data)(i);
+            }
+
+            // Set the values for this IB point.
+            const int stencil_box_row = i_lower + local_idx;
+            ierr = MatSetValues(
+                mat, 1, &stencil_box_row, stencil_box_nvals, &stencil_box_cols[0], &stencil_box_vals[0], ADD_VALUES);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+
+    // Assemble the matrix.
+    ierr = MatAssemblyBegin(mat, MAT_FINAL_ASSEMBLY);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatAssemblyEnd(mat, MAT_FINAL_ASSEMBLY);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // constructPatchLevelSCInterpOp
+
 void
 PETScMatUtilities::constructProlongationOp(Mat& mat,
                                            const std::string& op_type,
@@ -17,6 +17,7 @@
 
 #include "ibtk/CartSideRobinPhysBdryOp.h"
 #include "ibtk/PatchMathOps.h"
+#include "ibtk/PatchTileIterator.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
 #include "Box.h"
@@ -38,11 +39,6 @@
 
 // FORTRAN ROUTINES
 #if (NDIM == 2)
-#define LAPLACE_FC IBTK_FC_FUNC(laplace2d, LAPLACE2D)
-#define LAPLACE_ADD_FC IBTK_FC_FUNC(laplaceadd2d, LAPLACEADD2D)
-#define DAMPED_LAPLACE_FC IBTK_FC_FUNC(dampedlaplace2d, DAMPEDLAPLACE2D)
-#define DAMPED_LAPLACE_ADD_FC IBTK_FC_FUNC(dampedlaplaceadd2d, DAMPEDLAPLACEADD2D)
-
 #define MULTIPLY1_FC IBTK_FC_FUNC(multiply12d, MULTIPLY12D)
 #define MULTIPLY_ADD1_FC IBTK_FC_FUNC(multiplyadd12d, MULTIPLYADD12D)
 #define MULTIPLY2_FC IBTK_FC_FUNC(multiply22d, MULTIPLY22D)
@@ -111,11 +107,6 @@
 #endif // if (NDIM == 2)
 
 #if (NDIM == 3)
-#define LAPLACE_FC IBTK_FC_FUNC(laplace3d, LAPLACE3D)
-#define LAPLACE_ADD_FC IBTK_FC_FUNC(laplaceadd3d, LAPLACEADD3D)
-#define DAMPED_LAPLACE_FC IBTK_FC_FUNC(dampedlaplace3d, DAMPEDLAPLACE3D)
-#define DAMPED_LAPLACE_ADD_FC IBTK_FC_FUNC(dampedlaplaceadd3d, DAMPEDLAPLACEADD3D)
-
 #define MULTIPLY1_FC IBTK_FC_FUNC(multiply13d, MULTIPLY13D)
 #define MULTIPLY_ADD1_FC IBTK_FC_FUNC(multiplyadd13d, MULTIPLYADD13D)
 #define MULTIPLY2_FC IBTK_FC_FUNC(multiply23d, MULTIPLY23D)
@@ -188,74 +179,6 @@
 
 extern "C"
 {
-    void LAPLACE_FC(double* F,
-                    const int& F_gcw,
-                    const double& alpha,
-                    const double* U,
-                    const int& U_gcw,
-                    const int& ilower0,
-                    const int& iupper0,
-                    const int& ilower1,
-                    const int& iupper1,
-#if (NDIM == 3)
-                    const int& ilower2,
-                    const int& iupper2,
-#endif
-                    const double* dx);
-
-    void LAPLACE_ADD_FC(double* F,
-                        const int& F_gcw,
-                        const double& alpha,
-                        const double* U,
-                        const int& U_gcw,
-                        const double& beta,
-                        const double* V,
-                        const int& V_gcw,
-                        const int& ilower0,
-                        const int& iupper0,
-                        const int& ilower1,
-                        const int& iupper1,
-#if (NDIM == 3)
-                        const int& ilower2,
-                        const int& iupper2,
-#endif
-                        const double* dx);
-
-    void DAMPED_LAPLACE_FC(double* F,
-                           const int& F_gcw,
-                           const double& alpha,
-                           const double& beta,
-                           const double* U,
-                           const int& U_gcw,
-                           const int& ilower0,
-                           const int& iupper0,
-                           const int& ilower1,
-                           const int& iupper1,
-#if (NDIM == 3)
-                           const int& ilower2,
-                           const int& iupper2,
-#endif
-                           const double* dx);
-
-    void DAMPED_LAPLACE_ADD_FC(double* F,
-                               const int& F_gcw,
-                               const double& alpha,
-                               const double& beta,
-                               const double* U,
-                               const int& U_gcw,
-                               const double& gamma,
-                               const double* V,
-                               const int& V_gcw,
-                               const int& ilower0,
-                               const int& iupper0,
-                               const int& ilower1,
-                               const int& iupper1,
-#if (NDIM == 3)
-                               const int& ilower2,
-                               const int& iupper2,
-#endif
-                               const double* dx);
-
     void C_TO_C_CURL_FC(double* W,
                         const int& W_gcw,
                         const double* U,
@@ -1427,6 +1350,131 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+/*!
+ * Compute F = alpha L U + beta U + gamma V on the tile [tile_lower,
+ * tile_upper] of the index box [ilower, iupper], where L is the standard
+ * (2*NDIM+1)-point Laplacian.  The arrays are stored in column-major order on
+ * the index box grown by their (uniform) ghost cell widths, and the damping and
+ * addition terms are enabled via the template parameters so that each variant
+ * is compiled into a single loop that can be inlined and vectorized.  The
+ * arithmetic is ordered as in the Fortran laplace routines.
+ */
+template <bool damped, bool add>
+inline void
+laplace_kernel(double* const F,
+               const int F_gcw,
+               const double alpha,
+               const double beta,
+               const double* const U,
+               const int U_gcw,
+               const double gamma,
+               const double* const V,
+               const int V_gcw,
+               const std::array<int, NDIM>& ilower,
+               const std::array<int, NDIM>& iupper,
+               const std::array<int, NDIM>& tile_lower,
+               const std::array<int, NDIM>& tile_upper,
+               const double* const dx)
+{
+    std::array<double, NDIM> fac;
+    std::array<int, NDIM> t0, t1;
+    std::array<int, NDIM> n, F_stride, U_stride, V_stride;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        fac[d] = alpha / (dx[d] * dx[d]);
+        n[d] = iupper[d] - ilower[d] + 1;
+        t0[d] = tile_lower[d] - ilower[d];
+        t1[d] = tile_upper[d] - ilower[d] + 1;
+        F_stride[d] = (d == 0 ? 1 : F_stride[d - 1] * (n[d - 1] + 2 * F_gcw));
+        U_stride[d] = (d == 0 ? 1 : U_stride[d - 1] * (n[d - 1] + 2 * U_gcw));
+        V_stride[d] = (d == 0 ? 1 : V_stride[d - 1] * (n[d - 1] + 2 * V_gcw));
+    }
+    const int U_s1 = U_stride[1];
+#if (NDIM == 3)
+    const int U_s2 = U_stride[2];
+    for (int i2 = t0[2]; i2 < t1[2]; ++i2)
+#endif
+    {
+        for (int i1 = t0[1]; i1 < t1[1]; ++i1)
+        {
+            int F_offset = F_gcw + (i1 + F_gcw) * F_stride[1];
+            int U_offset = U_gcw + (i1 + U_gcw) * U_stride[1];
+            int V_offset = V_gcw + (i1 + V_gcw) * V_stride[1];
+#if (NDIM == 3)
+            F_offset += (i2 + F_gcw) * F_stride[2];
+            U_offset += (i2 + U_gcw) * U_stride[2];
+            V_offset += (i2 + V_gcw) * V_stride[2];
+#endif
+            double* const F_row = F + F_offset;
+            const double* const U_row = U + U_offset;
+            const double* const V_row = add ? V + V_offset : nullptr;
+            for (int i0 = t0[0]; i0 < t1[0]; ++i0)
+            {
+                double val = fac[0] * (U_row[i0 - 1] + U_row[i0 + 1] - 2.0 * U_row[i0]) +
+                             fac[1] * (U_row[i0 - U_s1] + U_row[i0 + U_s1] - 2.0 * U_row[i0]);
+#if (NDIM == 3)
+                val += fac[2] * (U_row[i0 - U_s2] + U_row[i0 + U_s2] - 2.0 * U_row[i0]);
+#endif
+                if (damped) val += beta * U_row[i0];
+                if (add) val += gamma * V_row[i0];
+                F_row[i0] = val;
+            }
+        }
+    }
+    return;
+} // laplace_kernel
+
+/*!
+ * Dispatch to the appropriate instantiation of laplace_kernel(), which is
+ * applied tile by tile so that the working set of each sweep of the stencil
+ * remains in cache.
+ */
+inline void
+laplace_kernel(double* const F,
+               const int F_gcw,
+               const double alpha,
+               const double beta,
+               const double* const U,
+               const int U_gcw,
+               const double gamma,
+               const double* const V,
+               const int V_gcw,
+               const std::array<int, NDIM>& ilower,
+               const std::array<int, NDIM>& iupper,
+               const double* const dx)
+{
+    const bool damped = beta != 0.0;
+    const bool add = V && gamma != 0.0;
+    Box<NDIM> box;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        box.lower(d) = ilower[d];
+        box.upper(d) = iupper[d];
+    }
+    for (PatchTileIterator t(box, PatchTileIterator::getDefaultTileSize()); t; t++)
+    {
+        const Box<NDIM>& tile_box = t();
+        std::array<int, NDIM> tl, tu;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            tl[d] = tile_box.lower(d);
+            tu[d] = tile_box.upper(d);
+        }
+        if (damped && add)
+            laplace_kernel<true, true>(F, F_gcw, alpha, beta, U, U_gcw, gamma, V, V_gcw, ilower, iupper, tl, tu, dx);
+        else if (damped)
+            laplace_kernel<true, false>(F, F_gcw, alpha, beta, U, U_gcw, gamma, V, V_gcw, ilower, iupper, tl, tu, dx);
+        else if (add)
+            laplace_kernel<false, true>(F, F_gcw, alpha, beta, U, U_gcw, gamma, V, V_gcw, ilower, iupper, tl, tu, dx);
+        else
+            laplace_kernel<false, false>(F, F_gcw, alpha, beta, U, U_gcw, gamma, V, V_gcw, ilower, iupper, tl, tu, dx);
+    }
+    return;
+} // laplace_kernel
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 void
@@ -4863,48 +4911,12 @@ PatchMathOps::laplace(Pointer<CellData<NDIM, double> > dst,
     }
 #endif
 
-    if (!src2 || (gamma == 0.0))
-    {
-        if (beta == 0.0)
-        {
-            LAPLACE_FC(F,
-                       F_ghosts,
-                       alpha,
-                       U,
-                       U_ghosts,
-                       patch_box.lower(0),
-                       patch_box.upper(0),
-                       patch_box.lower(1),
-                       patch_box.upper(1),
-#if (NDIM == 3)
-                       patch_box.lower(2),
-                       patch_box.upper(2),
-#endif
-                       dx);
-        }
-        else
-        {
-            DAMPED_LAPLACE_FC(F,
-                              F_ghosts,
-                              alpha,
-                              beta,
-                              U,
-                              U_ghosts,
-                              patch_box.lower(0),
-                              patch_box.upper(0),
-                              patch_box.lower(1),
-                              patch_box.upper(1),
-#if (NDIM == 3)
-                              patch_box.lower(2),
-                              patch_box.upper(2),
-#endif
-                              dx);
-        }
-    }
-    else
+    const double* V = nullptr;
+    int V_ghosts = 0;
+    if (src2 && (gamma != 0.0))
     {
-        const double* const V = src2->getPointer(n);
-        const int V_ghosts = (src2->getGhostCellWidth()).max();
+        V = src2->getPointer(n);
+        V_ghosts = (src2->getGhostCellWidth()).max();
 
 #if !defined(NDEBUG)
         if (V_ghosts != (src2->getGhostCellWidth()).min())
@@ -4919,48 +4931,15 @@ PatchMathOps::laplace(Pointer<CellData<NDIM, double> > dst,
                        << "  dst, src1, and src2 must all live on the same patch" << std::endl);
         }
 #endif
-        if (beta == 0.0)
-        {
-            LAPLACE_ADD_FC(F,
-                           F_ghosts,
-                           alpha,
-                           U,
-                           U_ghosts,
-                           gamma,
-                           V,
-                           V_ghosts,
-                           patch_box.lower(0),
-                           patch_box.upper(0),
-                           patch_box.lower(1),
-                           patch_box.upper(1),
-#if (NDIM == 3)
-                           patch_box.lower(2),
-                           patch_box.upper(2),
-#endif
-                           dx);
-        }
-        else
-        {
-            DAMPED_LAPLACE_ADD_FC(F,
-                                  F_ghosts,
-                                  alpha,
-                                  beta,
-                                  U,
-                                  U_ghosts,
-                                  gamma,
-                                  V,
-                                  V_ghosts,
-                                  patch_box.lower(0),
-                                  patch_box.upper(0),
-                                  patch_box.lower(1),
-                                  patch_box.upper(1),
-#if (NDIM == 3)
-                                  patch_box.lower(2),
-                                  patch_box.upper(2),
-#endif
-                                  dx);
-        }
     }
+
+    std::array<int, NDIM> ilower, iupper;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        ilower[d] = patch_box.lower(d);
+        iupper[d] = patch_box.upper(d);
+    }
+    laplace_kernel(F, F_ghosts, alpha, beta, U, U_ghosts, gamma, V, V_ghosts, ilower, iupper, dx);
     return;
 } // laplace
 
@@ -5042,63 +5021,16 @@ PatchMathOps::laplace(Pointer<SideData<NDIM, double> > dst,
     }
 #endif
 
-    if (!src2 || (gamma == 0.0))
+    std::array<const double*, NDIM> V;
+    V.fill(nullptr);
+    int V_ghosts = 0;
+    if (src2 && (gamma != 0.0))
     {
-        std::array<int, NDIM> ilower, iupper;
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            for (unsigned int dd = 0; dd < NDIM; ++dd)
-            {
-                ilower[dd] = patch_box.lower(dd);
-                iupper[dd] = patch_box.upper(dd);
-            }
-            iupper[d] += 1;
-
-            if (beta == 0.0)
-            {
-                LAPLACE_FC(F[d],
-                           F_ghosts,
-                           alpha,
-                           U[d],
-                           U_ghosts,
-                           ilower[0],
-                           iupper[0],
-                           ilower[1],
-                           iupper[1],
-#if (NDIM == 3)
-                           ilower[2],
-                           iupper[2],
-#endif
-                           dx);
-            }
-            else
-            {
-                DAMPED_LAPLACE_FC(F[d],
-                                  F_ghosts,
-                                  alpha,
-                                  beta,
-                                  U[d],
-                                  U_ghosts,
-                                  ilower[0],
-                                  iupper[0],
-                                  ilower[1],
-                                  iupper[1],
-#if (NDIM == 3)
-                                  ilower[2],
-                                  iupper[2],
-#endif
-                                  dx);
-            }
-        }
-    }
-    else
-    {
-        std::array<const double*, NDIM> V;
         for (unsigned int d = 0; d < NDIM; ++d)
         {
             V[d] = src2->getPointer(d, n);
         }
-        const int V_ghosts = (src2->getGhostCellWidth()).max();
+        V_ghosts = (src2->getGhostCellWidth()).max();
 
 #if !defined(NDEBUG)
         if (V_ghosts != (src2->getGhostCellWidth()).min())
@@ -5113,58 +5045,18 @@ PatchMathOps::laplace(Pointer<SideData<NDIM, double> > dst,
                        << "  dst, src1, and src2 must all live on the same patch" << std::endl);
         }
 #endif
-        std::array<int, NDIM> ilower, iupper;
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            for (unsigned int dd = 0; dd < NDIM; ++dd)
-            {
-                ilower[dd] = patch_box.lower(dd);
-                iupper[dd] = patch_box.upper(dd);
-            }
-            iupper[d] += 1;
+    }
 
-            if (beta == 0.0)
-            {
-                LAPLACE_ADD_FC(F[d],
-                               F_ghosts,
-                               alpha,
-                               U[d],
-                               U_ghosts,
-                               gamma,
-                               V[d],
-                               V_ghosts,
-                               ilower[0],
-                               iupper[0],
-                               ilower[1],
-                               iupper[1],
-#if (NDIM == 3)
-                               ilower[2],
-                               iupper[2],
-#endif
-                               dx);
-            }
-            else
-            {
-                DAMPED_LAPLACE_ADD_FC(F[d],
-                                      F_ghosts,
-                                      alpha,
-                                      beta,
-                                      U[d],
-                                      U_ghosts,
-                                      gamma,
-                                      V[d],
-                                      V_ghosts,
-                                      ilower[0],
-                                      iupper[0],
-                                      ilower[1],
-                                      iupper[1],
-#if (NDIM == 3)
-                                      ilower[2],
-                                      iupper[2],
-#endif
-                                      dx);
-            }
+    std::array<int, NDIM> ilower, iupper;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        for (unsigned int dd = 0; dd < NDIM; ++dd)
+        {
+            ilower[dd] = patch_box.lower(dd);
+            iupper[dd] = patch_box.upper(dd);
         }
+        iupper[d] += 1;
+        laplace_kernel(F[d], F_ghosts, alpha, beta, U[d], U_ghosts, gamma, V[d], V_ghosts, ilower, iupper, dx);
     }
     return;
 } // laplace
@@ -0,0 +1,414 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/PeriodicHelmholtzFFT.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+#include "ArrayData.h"
+#include "Box.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "tbox/Utilities.h"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Split a box into the pieces that lie in a single periodic image of the
+// domain. Each piece is returned along with the shift that maps it into the
+// domain.
+std::vector<std::pair<Box<NDIM>, IntVector<NDIM> > >
+get_periodic_pieces(const Box<NDIM>& box, const Box<NDIM>& domain_box)
+{
+    std::vector<std::pair<Box<NDIM>, IntVector<NDIM> > > pieces;
+    int num_images = 1;
+    for (unsigned int d = 0; d < NDIM; ++d) num_images *= 3;
+    for (int image = 0; image < num_images; ++image)
+    {
+        IntVector<NDIM> offset;
+        for (unsigned int d = 0, k = image; d < NDIM; ++d, k /= 3)
+        {
+            offset(d) = (static_cast<int>(k % 3) - 1) * domain_box.numberCells(d);
+        }
+        Box<NDIM> image_box(domain_box);
+        image_box.shift(offset);
+        const Box<NDIM> piece = box * image_box;
+        if (!piece.empty()) pieces.push_back(std::make_pair(piece, -offset));
+    }
+    return pieces;
+} // get_periodic_pieces
+
+// Block decomposition of n values over num_procs processes.
+std::pair<int, int>
+get_block_range(const int n, const int num_procs, const int rank)
+{
+    const int lower = rank * (n / num_procs) + std::min(rank, n % num_procs);
+    const int upper = lower + n / num_procs + (rank < n % num_procs ? 1 : 0);
+    return std::make_pair(lower, upper);
+} // get_block_range
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+PeriodicHelmholtzFFT::PeriodicHelmholtzFFT(const Box<NDIM>& domain_box,
+                                           const double* const dx,
+                                           const std::vector<Box<NDIM> >& src_boxes,
+                                           const std::vector<Box<NDIM> >& dst_boxes,
+                                           const std::vector<int>& owners)
+    : d_domain_box(domain_box), d_rank(IBTK_MPI::getRank())
+{
+    TBOX_ASSERT(src_boxes.size() == owners.size());
+    TBOX_ASSERT(dst_boxes.size() == owners.size());
+    for (unsigned int d = 0; d < NDIM; ++d) d_dx[d] = dx[d];
+
+    // Set up the slab decompositions.
+    const int num_procs = IBTK_MPI::getNodes();
+    for (int rank = 0; rank < num_procs; ++rank)
+    {
+        Box<NDIM> slab_a_box(d_domain_box), slab_b_box(d_domain_box);
+        const std::pair<int, int> range_a = get_block_range(d_domain_box.numberCells(NDIM - 1), num_procs, rank);
+        slab_a_box.lower()(NDIM - 1) = d_domain_box.lower()(NDIM - 1) + range_a.first;
+        slab_a_box.upper()(NDIM - 1) = d_domain_box.lower()(NDIM - 1) + range_a.second - 1;
+        d_slab_a_boxes.push_back(slab_a_box);
+        const std::pair<int, int> range_b = get_block_range(d_domain_box.numberCells(0), num_procs, rank);
+        slab_b_box.lower()(0) = d_domain_box.lower()(0) + range_b.first;
+        slab_b_box.upper()(0) = d_domain_box.lower()(0) + range_b.second - 1;
+        d_slab_b_boxes.push_back(slab_b_box);
+    }
+    const Box<NDIM>& slab_a_box = d_slab_a_boxes[d_rank];
+    const Box<NDIM>& slab_b_box = d_slab_b_boxes[d_rank];
+    d_slab_a_data.resize(slab_a_box.empty() ? 0 : slab_a_box.size());
+    d_slab_b_data.resize(slab_b_box.empty() ? 0 : slab_b_box.size());
+    for (unsigned int d = 0; d < NDIM; ++d) d_transforms.emplace_back(d_domain_box.numberCells(d));
+
+    // Set up the communication patterns. The blocks for each peer are listed
+    // in the same order (by box number and then by periodic piece) on the
+    // sending and on the receiving process.
+    for (unsigned int k = 0; k < owners.size(); ++k)
+    {
+        for (const auto& piece : get_periodic_pieces(src_boxes[k], d_domain_box))
+        {
+            Box<NDIM> domain_piece(piece.first);
+            domain_piece.shift(piece.second);
+            if (owners[k] == d_rank)
+            {
+                for (int rank = 0; rank < num_procs; ++rank)
+                {
+                    const Box<NDIM> region = domain_piece * d_slab_a_boxes[rank];
+                    if (!region.empty()) d_src_to_a_send.push_back({ rank, static_cast<int>(k), region, piece.second });
+                }
+            }
+            const Box<NDIM> region = domain_piece * slab_a_box;
+            if (!region.empty()) d_src_to_a_recv.push_back({ owners[k], static_cast<int>(k), region, piece.second });
+        }
+        for (const auto& piece : get_periodic_pieces(dst_boxes[k], d_domain_box))
+        {
+            Box<NDIM> domain_piece(piece.first);
+            domain_piece.shift(piece.second);
+            const Box<NDIM> region = domain_piece * slab_a_box;
+            if (!region.empty()) d_a_to_dst_send.push_back({ owners[k], static_cast<int>(k), region, piece.second });
+            if (owners[k] == d_rank)
+            {
+                for (int rank = 0; rank < num_procs; ++rank)
+                {
+                    const Box<NDIM> region = domain_piece * d_slab_a_boxes[rank];
+                    if (!region.empty()) d_a_to_dst_recv.push_back({ rank, static_cast<int>(k), region, piece.second });
+                }
+            }
+        }
+    }
+    for (int rank = 0; rank < num_procs; ++rank)
+    {
+        const Box<NDIM> send_region = slab_a_box * d_slab_b_boxes[rank];
+        if (!send_region.empty()) d_a_to_b_send.push_back({ rank, -1, send_region, IntVector<NDIM>(0) });
+        const Box<NDIM> recv_region = d_slab_a_boxes[rank] * slab_b_box;
+        if (!recv_region.empty()) d_a_to_b_recv.push_back({ rank, -1, recv_region, IntVector<NDIM>(0) });
+    }
+    return;
+} // PeriodicHelmholtzFFT
+
+void
+PeriodicHelmholtzFFT::solve(const std::vector<ArrayData<NDIM, double>*>& u_data,
+                            const int u_depth,
+                            const std::vector<const ArrayData<NDIM, double>*>& f_data,
+                            const int f_depth,
+                            const double C,
+                            const double D)
+{
+    const Box<NDIM>& slab_a_box = d_slab_a_boxes[d_rank];
+    const Box<NDIM>& slab_b_box = d_slab_b_boxes[d_rank];
+
+    // Gather the right-hand side into the first slab decomposition.
+    communicate(
+        d_src_to_a_send,
+        d_src_to_a_recv,
+        1,
+        [&](const TransferBlock& block, double* buf) {
+            const ArrayData<NDIM, double>& f = *f_data[block.box_num];
+            for (Box<NDIM>::Iterator it(block.region); it; it++) *buf++ = f(it() - block.shift, f_depth);
+        },
+        [&](const TransferBlock& block, const double* buf) {
+            for (Box<NDIM>::Iterator it(block.region); it; it++)
+                d_slab_a_data[slabOffset(slab_a_box, it())] = *buf++;
+        });
+
+    // Transform in all directions but the last one, transpose, and transform
+    // in the last direction.
+    for (unsigned int axis = 0; axis < NDIM - 1; ++axis) transformSlab(d_slab_a_data, slab_a_box, axis, true);
+    const auto pack_complex = [](const std::vector<std::complex<double> >& data, const Box<NDIM>& slab_box) {
+        return [&data, &slab_box](const TransferBlock& block, double* buf) {
+            for (Box<NDIM>::Iterator it(block.region); it; it++)
+            {
+                const std::complex<double>& val = data[slabOffset(slab_box, it())];
+                *buf++ = val.real();
+                *buf++ = val.imag();
+            }
+        };
+    };
+    const auto unpack_complex = [](std::vector<std::complex<double> >& data, const Box<NDIM>& slab_box) {
+        return [&data, &slab_box](const TransferBlock& block, const double* buf) {
+            for (Box<NDIM>::Iterator it(block.region); it; it++, buf += 2)
+            {
+                data[slabOffset(slab_box, it())] = std::complex<double>(buf[0], buf[1]);
+            }
+        };
+    };
+    communicate(d_a_to_b_send,
+                d_a_to_b_recv,
+                2,
+                pack_complex(d_slab_a_data, slab_a_box),
+                unpack_complex(d_slab_b_data, slab_b_box));
+    transformSlab(d_slab_b_data, slab_b_box, NDIM - 1, true);
+
+    // Divide by the eigenvalues of the operator. The inverse transform is not
+    // normalized, so we also divide by the number of values here.
+    if (!slab_b_box.empty())
+    {
+        const double num_values = static_cast<double>(d_domain_box.size());
+        for (Box<NDIM>::Iterator it(slab_b_box); it; it++)
+        {
+            const hier::Index<NDIM>& i = it();
+            bool constant_mode = true;
+            double lambda = C;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                const int k = i(d) - d_domain_box.lower()(d);
+                constant_mode = constant_mode && k == 0;
+                const double theta =
+                    2.0 * M_PI * static_cast<double>(k) / static_cast<double>(d_domain_box.numberCells(d));
+                lambda += D * (2.0 * std::cos(theta) - 2.0) / (d_dx[d] * d_dx[d]);
+            }
+            std::complex<double>& val = d_slab_b_data[slabOffset(slab_b_box, i)];
+            if (constant_mode && C == 0.0)
+            {
+                val = 0.0;
+            }
+            else
+            {
+                val /= lambda * num_values;
+            }
+        }
+    }
+
+    // Invert the transforms and scatter the solution to the destination boxes.
+    transformSlab(d_slab_b_data, slab_b_box, NDIM - 1, false);
+    communicate(d_a_to_b_recv,
+                d_a_to_b_send,
+                2,
+                pack_complex(d_slab_b_data, slab_b_box),
+                unpack_complex(d_slab_a_data, slab_a_box));
+    for (unsigned int axis = 0; axis < NDIM - 1; ++axis) transformSlab(d_slab_a_data, slab_a_box, axis, false);
+    communicate(
+        d_a_to_dst_send,
+        d_a_to_dst_recv,
+        1,
+        [&](const TransferBlock& block, double* buf) {
+            for (Box<NDIM>::Iterator it(block.region); it; it++)
+                *buf++ = d_slab_a_data[slabOffset(slab_a_box, it())].real();
+        },
+        [&](const TransferBlock& block, const double* buf) {
+            ArrayData<NDIM, double>& u = *u_data[block.box_num];
+            for (Box<NDIM>::Iterator it(block.region); it; it++) u(it() - block.shift, u_depth) = *buf++;
+        });
+    return;
+} // solve
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+PeriodicHelmholtzFFT::Transform1D::Transform1D(const int n) : d_n(n)
+{
+    // Factor n, preferring radices four and two.
+    int m = n, p = 4;
+    while (m > 1)
+    {
+        while (m % p != 0)
+        {
+            p = (p == 4 ? 2 : p == 2 ? 3 : p + 2);
+            if (p * p > m) p = m;
+        }
+        m /= p;
+        d_factors.push_back(p);
+        d_factors.push_back(m);
+    }
+    for (int k = 0; k < d_n; ++k)
+    {
+        d_fwd_twiddles.push_back(std::polar(1.0, -2.0 * M_PI * static_cast<double>(k) / static_cast<double>(d_n)));
+        d_bwd_twiddles.push_back(std::conj(d_fwd_twiddles.back()));
+    }
+    d_line.resize(d_n);
+    d_work.resize(d_n);
+    d_scratch.resize(d_n);
+    return;
+} // Transform1D
+
+void
+PeriodicHelmholtzFFT::Transform1D::apply(std::complex<double>* const data, const int stride, const bool forward)
+{
+    if (d_n == 1) return;
+    for (int j = 0; j < d_n; ++j) d_line[j] = data[j * stride];
+    transform(d_work.data(), d_line.data(), 1, 0, forward ? d_fwd_twiddles : d_bwd_twiddles);
+    for (int j = 0; j < d_n; ++j) data[j * stride] = d_work[j];
+    return;
+} // apply
+
+void
+PeriodicHelmholtzFFT::Transform1D::transform(std::complex<double>* const out,
+                                             const std::complex<double>* const in,
+                                             const int fstride,
+                                             const unsigned int factor_idx,
+                                             const std::vector<std::complex<double> >& twiddles)
+{
+    // Decimation in time: transform the p interleaved subsequences of length
+    // m and then combine them with radix-p butterflies.
+    const int p = d_factors[factor_idx];
+    const int m = d_factors[factor_idx + 1];
+    for (int q = 0; q < p; ++q)
+    {
+        if (m == 1)
+            out[q] = in[q * fstride];
+        else
+            transform(out + q * m, in + q * fstride, fstride * p, factor_idx + 2, twiddles);
+    }
+    for (int u = 0; u < m; ++u)
+    {
+        for (int q = 0; q < p; ++q) d_scratch[q] = out[u + q * m];
+        for (int q1 = 0; q1 < p; ++q1)
+        {
+            const int k = u + q1 * m;
+            int twiddle_idx = 0;
+            out[k] = d_scratch[0];
+            for (int q = 1; q < p; ++q)
+            {
+                twiddle_idx += fstride * k;
+                if (twiddle_idx >= d_n) twiddle_idx -= d_n;
+                out[k] += d_scratch[q] * twiddles[twiddle_idx];
+            }
+        }
+    }
+    return;
+} // transform
+
+void
+PeriodicHelmholtzFFT::communicate(const std::vector<TransferBlock>& send_blocks,
+                                  const std::vector<TransferBlock>& recv_blocks,
+                                  const int values_per_index,
+                                  const std::function<void(const TransferBlock&, double*)>& pack,
+                                  const std::function<void(const TransferBlock&, const double*)>& unpack)
+{
+    const int num_procs = IBTK_MPI::getNodes();
+    std::vector<int> send_counts(num_procs, 0), recv_counts(num_procs, 0);
+    for (const TransferBlock& block : send_blocks) send_counts[block.peer] += values_per_index * block.region.size();
+    for (const TransferBlock& block : recv_blocks) recv_counts[block.peer] += values_per_index * block.region.size();
+    std::vector<int> send_displs(num_procs, 0), recv_displs(num_procs, 0);
+    for (int rank = 1; rank < num_procs; ++rank)
+    {
+        send_displs[rank] = send_displs[rank - 1] + send_counts[rank - 1];
+        recv_displs[rank] = recv_displs[rank - 1] + recv_counts[rank - 1];
+    }
+
+    std::vector<double> send_buf(send_displs.back() + send_counts.back());
+    std::vector<double> recv_buf(recv_displs.back() + recv_counts.back());
+    std::vector<int> offsets(send_displs);
+    for (const TransferBlock& block : send_blocks)
+    {
+        pack(block, send_buf.data() + offsets[block.peer]);
+        offsets[block.peer] += values_per_index * block.region.size();
+    }
+    MPI_Alltoallv(send_buf.data(),
+                  send_counts.data(),
+                  send_displs.data(),
+                  MPI_DOUBLE,
+                  recv_buf.data(),
+                  recv_counts.data(),
+                  recv_displs.data(),
+                  MPI_DOUBLE,
+                  IBTK_MPI::getCommunicator());
+    offsets = recv_displs;
+    for (const TransferBlock& block : recv_blocks)
+    {
+        unpack(block, recv_buf.data() + offsets[block.peer]);
+        offsets[block.peer] += values_per_index * block.region.size();
+    }
+    return;
+} // communicate
+
+void
+PeriodicHelmholtzFFT::transformSlab(std::vector<std::complex<double> >& slab_data,
+                                    const Box<NDIM>& slab_box,
+                                    const int axis,
+                                    const bool forward)
+{
+    if (slab_box.empty()) return;
+    int stride = 1;
+    for (int d = 0; d < axis; ++d) stride *= slab_box.numberCells(d);
+    Box<NDIM> line_starts(slab_box);
+    line_starts.upper()(axis) = line_starts.lower()(axis);
+    for (Box<NDIM>::Iterator it(line_starts); it; it++)
+    {
+        d_transforms[axis].apply(&slab_data[slabOffset(slab_box, it())], stride, forward);
+    }
+    return;
+} // transformSlab
+
+int
+PeriodicHelmholtzFFT::slabOffset(const Box<NDIM>& slab_box, const hier::Index<NDIM>& i)
+{
+    int offset = 0, stride = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        offset += (i(d) - slab_box.lower()(d)) * stride;
+        stride *= slab_box.numberCells(d);
+    }
+    return offset;
+} // slabOffset
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
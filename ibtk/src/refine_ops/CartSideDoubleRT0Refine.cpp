@@ -22,6 +22,7 @@
 #include "SideVariable.h"
 #include "tbox/Pointer.h"
 
+#include <array>
 #include <string>
 
 namespace SAMRAI
@@ -108,6 +109,112 @@ namespace
 {
 static const int REFINE_OP_PRIORITY = 0;
 static const int REFINE_OP_STENCIL_WIDTH = 1;
+
+// The layout of the data array of one axis of a side-centered patch data
+// object, which is stored in column-major order on the side-centered ghost box.
+struct SideArrayLayout
+{
+    SideArrayLayout(const Box<NDIM>& data_box, const int gcw, const unsigned int axis)
+    {
+        stride[0] = 1;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            lower[d] = data_box.lower(d) - gcw;
+            if (d == 0) continue;
+            const int n = data_box.numberCells(d - 1) + 2 * gcw + (d - 1 == axis ? 1 : 0);
+            stride[d] = stride[d - 1] * n;
+        }
+    }
+
+    // The offset of the first entry of the row with the given indices in the
+    // directions other than the first one, minus the lower index of the first
+    // direction (so that the row may be indexed by i0).
+    int rowOffset(const std::array<int, NDIM>& i) const
+    {
+        int offset = -lower[0];
+        for (unsigned int d = 1; d < NDIM; ++d) offset += (i[d] - lower[d]) * stride[d];
+        return offset;
+    }
+
+    std::array<int, NDIM> lower, stride;
+};
+
+// Coarsen a fine index, rounding towards negative infinity.
+template <int ratio>
+inline int
+coarsen_index(const int i)
+{
+    return (i < 0 ? (i + 1) / ratio - 1 : i / ratio);
+} // coarsen_index
+
+// Refine the data of one axis in the fine box by linear interpolation in the
+// normal direction and piecewise-constant interpolation in the tangential
+// directions.  The arithmetic is ordered as in the Fortran routines.
+template <int ratio, unsigned int axis>
+void
+rt0_refine(double* const u_f,
+           const SideArrayLayout& f_layout,
+           const double* const u_c,
+           const SideArrayLayout& c_layout,
+           const Box<NDIM>& fine_box)
+{
+    std::array<int, NDIM> ilower, iupper, i, i_c;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        ilower[d] = fine_box.lower(d);
+        iupper[d] = fine_box.upper(d) + (d == axis ? 1 : 0);
+    }
+    const int c_stride_n = c_layout.stride[axis];
+#if (NDIM == 3)
+    for (i[2] = ilower[2]; i[2] <= iupper[2]; ++i[2])
+    {
+        i_c[2] = coarsen_index<ratio>(i[2]);
+#endif
+        for (i[1] = ilower[1]; i[1] <= iupper[1]; ++i[1])
+        {
+            i_c[1] = coarsen_index<ratio>(i[1]);
+            double* const u_f_row = u_f + f_layout.rowOffset(i);
+            const double* const u_c_row = u_c + c_layout.rowOffset(i_c);
+            for (int i0 = ilower[0]; i0 <= iupper[0]; ++i0)
+            {
+                const int i_c0 = coarsen_index<ratio>(i0);
+                const double* const u = u_c_row + i_c0;
+                const int k = (axis == 0 ? i0 - i_c0 * ratio : i[axis] - i_c[axis] * ratio);
+                if (k == 0)
+                {
+                    u_f_row[i0] = u[0];
+                }
+                else
+                {
+                    const double w1 = static_cast<double>(k) / ratio;
+                    const double w0 = 1.0 - w1;
+                    u_f_row[i0] = w0 * u[0] + w1 * u[c_stride_n];
+                }
+            }
+        }
+#if (NDIM == 3)
+    }
+#endif
+    return;
+} // rt0_refine
+
+// Dispatch to the instantiation of rt0_refine() for the given axis.
+template <int ratio>
+void
+rt0_refine(const unsigned int axis,
+           double* const u_f,
+           const SideArrayLayout& f_layout,
+           const double* const u_c,
+           const SideArrayLayout& c_layout,
+           const Box<NDIM>& fine_box)
+{
+    if (axis == 0) rt0_refine<ratio, 0>(u_f, f_layout, u_c, c_layout, fine_box);
+    if (axis == 1) rt0_refine<ratio, 1>(u_f, f_layout, u_c, c_layout, fine_box);
+#if (NDIM == 3)
+    if (axis == 2) rt0_refine<ratio, 2>(u_f, f_layout, u_c, c_layout, fine_box);
+#endif
+    return;
+} // rt0_refine
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -167,6 +274,29 @@ CartSideDoubleRT0Refine::refine(Patch<NDIM>& fine,
     TBOX_ASSERT(cdata_gcw == cdata->getGhostCellWidth().min());
 #endif
 
+    // Use the C++ kernels for the refinement ratios used in practice; other
+    // ratios are handled by the Fortran implementation.
+    const bool use_ratio_2 = ratio == IntVector<NDIM>(2);
+    const bool use_ratio_4 = ratio == IntVector<NDIM>(4);
+    if (use_ratio_2 || use_ratio_4)
+    {
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            const SideArrayLayout f_layout(fdata_box, fdata_gcw, axis);
+            const SideArrayLayout c_layout(cdata_box, cdata_gcw, axis);
+            for (int depth = 0; depth < data_depth; ++depth)
+            {
+                double* const u_f = fdata->getPointer(axis, depth);
+                const double* const u_c = cdata->getPointer(axis, depth);
+                if (use_ratio_2)
+                    rt0_refine<2>(axis, u_f, f_layout, u_c, c_layout, fine_box);
+                else
+                    rt0_refine<4>(axis, u_f, f_layout, u_c, c_layout, fine_box);
+            }
+        }
+        return;
+    }
+
     // Refine the data.
     for (int depth = 0; depth < data_depth; ++depth)
     {
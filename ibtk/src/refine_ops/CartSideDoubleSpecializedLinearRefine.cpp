@@ -22,6 +22,8 @@
 #include "SideVariable.h"
 #include "tbox/Pointer.h"
 
+#include <algorithm>
+#include <array>
 #include <string>
 
 namespace SAMRAI
@@ -110,6 +112,142 @@ namespace
 {
 static const int REFINE_OP_PRIORITY = 0;
 static const int REFINE_OP_STENCIL_WIDTH = 1;
+
+// The layout of the data array of one axis of a side-centered patch data
+// object, which is stored in column-major order on the side-centered ghost box.
+struct SideArrayLayout
+{
+    SideArrayLayout(const Box<NDIM>& data_box, const int gcw, const unsigned int axis)
+    {
+        stride[0] = 1;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            lower[d] = data_box.lower(d) - gcw;
+            if (d == 0) continue;
+            const int n = data_box.numberCells(d - 1) + 2 * gcw + (d - 1 == axis ? 1 : 0);
+            stride[d] = stride[d - 1] * n;
+        }
+    }
+
+    // The offset of the first entry of the row with the given indices in the
+    // directions other than the first one, minus the lower index of the first
+    // direction (so that the row may be indexed by i0).
+    int rowOffset(const std::array<int, NDIM>& i) const
+    {
+        int offset = -lower[0];
+        for (unsigned int d = 1; d < NDIM; ++d) offset += (i[d] - lower[d]) * stride[d];
+        return offset;
+    }
+
+    std::array<int, NDIM> lower, stride;
+};
+
+// Coarsen a fine index, rounding towards negative infinity.
+template <int ratio>
+inline int
+coarsen_index(const int i)
+{
+    return (i < 0 ? (i + 1) / ratio - 1 : i / ratio);
+} // coarsen_index
+
+// Compute the MC-limited slope of the coarse data at u in the direction with
+// the given stride.
+inline double
+mc_slope(const double* const u, const int stride)
+{
+    const double a = 0.5 * (u[stride] - u[-stride]);
+    const double b = 2.0 * (u[0] - u[-stride]);
+    const double c = 2.0 * (u[stride] - u[0]);
+    if (a >= 0.0 && b >= 0.0 && c >= 0.0) return std::min(a, std::min(b, c));
+    if (a <= 0.0 && b <= 0.0 && c <= 0.0) return std::max(a, std::max(b, c));
+    return 0.0;
+} // mc_slope
+
+// Evaluate the MC-limited piecewise-linear reconstruction of the coarse data
+// at u at the tangential offsets w, which are measured in fine grid cells.
+template <int ratio, unsigned int axis>
+inline double
+limited_linear(const double* const u, const std::array<double, NDIM>& w, const std::array<int, NDIM>& stride)
+{
+    double val = u[0];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (d != axis) val += w[d] * (mc_slope(u, stride[d]) / ratio);
+    }
+    return val;
+} // limited_linear
+
+// Refine the data of one axis in the fine box.  The weight in direction d is
+// the linear interpolation weight of the lower coarse face in the normal
+// direction and the offset from the coarse cell center (in fine grid cells) in
+// the tangential directions.  The arithmetic is ordered as in the Fortran
+// routines.
+template <int ratio, unsigned int axis>
+void
+specialized_linear_refine(double* const u_f,
+                          const SideArrayLayout& f_layout,
+                          const double* const u_c,
+                          const SideArrayLayout& c_layout,
+                          const Box<NDIM>& fine_box)
+{
+    auto weight = [](const unsigned int d, const int i, const int i_c) {
+        const int k = i - i_c * ratio;
+        return d == axis ? 1.0 - static_cast<double>(k) / ratio : static_cast<double>(k) + 0.5 - 0.5 * ratio;
+    };
+    std::array<int, NDIM> ilower, iupper, i, i_c;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        ilower[d] = fine_box.lower(d);
+        iupper[d] = fine_box.upper(d) + (d == axis ? 1 : 0);
+    }
+    std::array<double, NDIM> w;
+    const int c_stride_n = c_layout.stride[axis];
+#if (NDIM == 3)
+    for (i[2] = ilower[2]; i[2] <= iupper[2]; ++i[2])
+    {
+        i_c[2] = coarsen_index<ratio>(i[2]);
+        w[2] = weight(2, i[2], i_c[2]);
+#endif
+        for (i[1] = ilower[1]; i[1] <= iupper[1]; ++i[1])
+        {
+            i_c[1] = coarsen_index<ratio>(i[1]);
+            w[1] = weight(1, i[1], i_c[1]);
+            double* const u_f_row = u_f + f_layout.rowOffset(i);
+            const double* const u_c_row = u_c + c_layout.rowOffset(i_c);
+            for (int i0 = ilower[0]; i0 <= iupper[0]; ++i0)
+            {
+                const int i_c0 = coarsen_index<ratio>(i0);
+                w[0] = weight(0, i0, i_c0);
+                const double* const u = u_c_row + i_c0;
+                const double w_n = w[axis];
+                u_f_row[i0] = w_n * limited_linear<ratio, axis>(u, w, c_layout.stride);
+                u_f_row[i0] += (1.0 - w_n) * limited_linear<ratio, axis>(u + c_stride_n, w, c_layout.stride);
+            }
+        }
+#if (NDIM == 3)
+    }
+#endif
+    return;
+} // specialized_linear_refine
+
+// Dispatch to the instantiation of specialized_linear_refine() for the given
+// axis.
+template <int ratio>
+void
+specialized_linear_refine(const unsigned int axis,
+                          double* const u_f,
+                          const SideArrayLayout& f_layout,
+                          const double* const u_c,
+                          const SideArrayLayout& c_layout,
+                          const Box<NDIM>& fine_box)
+{
+    if (axis == 0) specialized_linear_refine<ratio, 0>(u_f, f_layout, u_c, c_layout, fine_box);
+    if (axis == 1) specialized_linear_refine<ratio, 1>(u_f, f_layout, u_c, c_layout, fine_box);
+#if (NDIM == 3)
+    if (axis == 2) specialized_linear_refine<ratio, 2>(u_f, f_layout, u_c, c_layout, fine_box);
+#endif
+    return;
+} // specialized_linear_refine
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -170,6 +308,29 @@ CartSideDoubleSpecializedLinearRefine::refine(Patch<NDIM>& fine,
     TBOX_ASSERT(cdata_gcw == cdata->getGhostCellWidth().min());
 #endif
 
+    // Use the C++ kernels for the refinement ratios used in practice; other
+    // ratios are handled by the Fortran implementation.
+    const bool use_ratio_2 = ratio == IntVector<NDIM>(2);
+    const bool use_ratio_4 = ratio == IntVector<NDIM>(4);
+    if (use_ratio_2 || use_ratio_4)
+    {
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            const SideArrayLayout f_layout(fdata_box, fdata_gcw, axis);
+            const SideArrayLayout c_layout(cdata_box, cdata_gcw, axis);
+            for (int depth = 0; depth < data_depth; ++depth)
+            {
+                double* const u_f = fdata->getPointer(axis, depth);
+                const double* const u_c = cdata->getPointer(axis, depth);
+                if (use_ratio_2)
+                    specialized_linear_refine<2>(axis, u_f, f_layout, u_c, c_layout, fine_box);
+                else
+                    specialized_linear_refine<4>(axis, u_f, f_layout, u_c, c_layout, fine_box);
+            }
+        }
+        return;
+    }
+
     // Refine the data.
     for (int depth = 0; depth < data_depth; ++depth)
     {
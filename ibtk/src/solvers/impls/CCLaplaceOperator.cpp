@@ -58,6 +58,7 @@ static const bool CONSISTENT_TYPE_2_BDRY = false;
 
 // Timers.
 static Timer* t_apply;
+static Timer* t_apply_add;
 static Timer* t_initialize_operator_state;
 static Timer* t_deallocate_operator_state;
 } // namespace
@@ -72,6 +73,7 @@ CCLaplaceOperator::CCLaplaceOperator(std::string object_name, const bool homogen
 
     // Setup Timers.
     IBTK_DO_ONCE(t_apply = TimerManager::getManager()->getTimer("IBTK::CCLaplaceOperator::apply()");
+                 t_apply_add = TimerManager::getManager()->getTimer("IBTK::CCLaplaceOperator::applyAdd()");
                  t_initialize_operator_state =
                      TimerManager::getManager()->getTimer("IBTK::CCLaplaceOperator::initializeOperatorState()");
                  t_deallocate_operator_state =
@@ -89,82 +91,22 @@ void
 CCLaplaceOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDIM, double>& y)
 {
     IBTK_TIMER_START(t_apply);
-
-#if !defined(NDEBUG)
-    TBOX_ASSERT(d_is_initialized);
-    for (int comp = 0; comp < d_ncomp; ++comp)
-    {
-        Pointer<CellVariable<NDIM, double> > x_cc_var = x.getComponentVariable(comp);
-        Pointer<CellVariable<NDIM, double> > y_cc_var = y.getComponentVariable(comp);
-        if (!x_cc_var || !y_cc_var)
-        {
-            TBOX_ERROR(d_object_name << "::apply()\n"
-                                     << "  encountered non-cell centered vector components" << std::endl);
-        }
-        Pointer<CellDataFactory<NDIM, double> > x_factory = x_cc_var->getPatchDataFactory();
-        Pointer<CellDataFactory<NDIM, double> > y_factory = y_cc_var->getPatchDataFactory();
-        TBOX_ASSERT(x_factory);
-        TBOX_ASSERT(y_factory);
-        const unsigned int x_depth = x_factory->getDefaultDepth();
-        const unsigned int y_depth = y_factory->getDefaultDepth();
-        TBOX_ASSERT(x_depth == y_depth);
-        if (x_depth != d_bc_coefs.size() || y_depth != d_bc_coefs.size())
-        {
-            TBOX_ERROR(d_object_name << "::apply()\n"
-                                     << "  each vector component must have data depth == " << d_bc_coefs.size() << "\n"
-                                     << "  since d_bc_coefs.size() == " << d_bc_coefs.size() << std::endl);
-        }
-    }
-#endif
-
-    // Simultaneously fill ghost cell values for all components.
-    using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
-    std::vector<InterpolationTransactionComponent> transaction_comps;
-    for (int comp = 0; comp < d_ncomp; ++comp)
-    {
-        InterpolationTransactionComponent x_component(x.getComponentDescriptorIndex(comp),
-                                                      DATA_REFINE_TYPE,
-                                                      USE_CF_INTERPOLATION,
-                                                      DATA_COARSEN_TYPE,
-                                                      BDRY_EXTRAP_TYPE,
-                                                      CONSISTENT_TYPE_2_BDRY,
-                                                      d_bc_coefs,
-                                                      d_fill_pattern);
-        transaction_comps.push_back(x_component);
-    }
-    d_hier_bdry_fill->resetTransactionComponents(transaction_comps);
-    d_hier_bdry_fill->setHomogeneousBc(d_homogeneous_bc);
-    d_hier_bdry_fill->fillData(d_solution_time);
-    d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
-
-    // Compute the action of the operator.
-    for (int comp = 0; comp < d_ncomp; ++comp)
-    {
-        Pointer<CellVariable<NDIM, double> > x_cc_var = x.getComponentVariable(comp);
-        Pointer<CellVariable<NDIM, double> > y_cc_var = y.getComponentVariable(comp);
-        const int x_idx = x.getComponentDescriptorIndex(comp);
-        const int y_idx = y.getComponentDescriptorIndex(comp);
-        for (unsigned int l = 0; l < d_bc_coefs.size(); ++l)
-        {
-            d_hier_math_ops->laplace(y_idx,
-                                     y_cc_var,
-                                     d_poisson_spec,
-                                     x_idx,
-                                     x_cc_var,
-                                     d_no_fill,
-                                     0.0,
-                                     0.0,
-                                     -1,
-                                     Pointer<CellVariable<NDIM, double> >(nullptr),
-                                     l,
-                                     l);
-        }
-    }
-
+    computeAction(x, nullptr, y);
     IBTK_TIMER_STOP(t_apply);
     return;
 } // apply
 
+void
+CCLaplaceOperator::applyAdd(SAMRAIVectorReal<NDIM, double>& x,
+                            SAMRAIVectorReal<NDIM, double>& y,
+                            SAMRAIVectorReal<NDIM, double>& z)
+{
+    IBTK_TIMER_START(t_apply_add);
+    computeAction(x, &y, z);
+    IBTK_TIMER_STOP(t_apply_add);
+    return;
+} // applyAdd
+
 void
 CCLaplaceOperator::initializeOperatorState(const SAMRAIVectorReal<NDIM, double>& in,
                                            const SAMRAIVectorReal<NDIM, double>& out)
@@ -268,6 +210,89 @@ CCLaplaceOperator::deallocateOperatorState()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+CCLaplaceOperator::computeAction(SAMRAIVectorReal<NDIM, double>& x,
+                                 SAMRAIVectorReal<NDIM, double>* const y,
+                                 SAMRAIVectorReal<NDIM, double>& z)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_is_initialized);
+    for (int comp = 0; comp < d_ncomp; ++comp)
+    {
+        Pointer<CellVariable<NDIM, double> > x_cc_var = x.getComponentVariable(comp);
+        Pointer<CellVariable<NDIM, double> > z_cc_var = z.getComponentVariable(comp);
+        if (!x_cc_var || !z_cc_var)
+        {
+            TBOX_ERROR(d_object_name << "::computeAction()\n"
+                                     << "  encountered non-cell centered vector components" << std::endl);
+        }
+        Pointer<CellDataFactory<NDIM, double> > x_factory = x_cc_var->getPatchDataFactory();
+        Pointer<CellDataFactory<NDIM, double> > z_factory = z_cc_var->getPatchDataFactory();
+        TBOX_ASSERT(x_factory);
+        TBOX_ASSERT(z_factory);
+        const unsigned int x_depth = x_factory->getDefaultDepth();
+        const unsigned int z_depth = z_factory->getDefaultDepth();
+        TBOX_ASSERT(x_depth == z_depth);
+        if (x_depth != d_bc_coefs.size() || z_depth != d_bc_coefs.size())
+        {
+            TBOX_ERROR(d_object_name << "::computeAction()\n"
+                                     << "  each vector component must have data depth == " << d_bc_coefs.size() << "\n"
+                                     << "  since d_bc_coefs.size() == " << d_bc_coefs.size() << std::endl);
+        }
+    }
+#endif
+
+    // Simultaneously fill ghost cell values for all components.
+    using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
+    std::vector<InterpolationTransactionComponent> transaction_comps;
+    for (int comp = 0; comp < d_ncomp; ++comp)
+    {
+        InterpolationTransactionComponent x_component(x.getComponentDescriptorIndex(comp),
+                                                      DATA_REFINE_TYPE,
+                                                      USE_CF_INTERPOLATION,
+                                                      DATA_COARSEN_TYPE,
+                                                      BDRY_EXTRAP_TYPE,
+                                                      CONSISTENT_TYPE_2_BDRY,
+                                                      d_bc_coefs,
+                                                      d_fill_pattern);
+        transaction_comps.push_back(x_component);
+    }
+    d_hier_bdry_fill->resetTransactionComponents(transaction_comps);
+    d_hier_bdry_fill->setHomogeneousBc(d_homogeneous_bc);
+    d_hier_bdry_fill->fillData(d_solution_time);
+    d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
+
+    // Compute the action of the operator.  When an addend is provided, it is
+    // added to the result within the same sweep over the patch data.
+    for (int comp = 0; comp < d_ncomp; ++comp)
+    {
+        Pointer<CellVariable<NDIM, double> > x_cc_var = x.getComponentVariable(comp);
+        Pointer<CellVariable<NDIM, double> > y_cc_var =
+            y ? y->getComponentVariable(comp) : Pointer<CellVariable<NDIM, double> >(nullptr);
+        Pointer<CellVariable<NDIM, double> > z_cc_var = z.getComponentVariable(comp);
+        const int x_idx = x.getComponentDescriptorIndex(comp);
+        const int y_idx = y ? y->getComponentDescriptorIndex(comp) : -1;
+        const int z_idx = z.getComponentDescriptorIndex(comp);
+        for (unsigned int l = 0; l < d_bc_coefs.size(); ++l)
+        {
+            d_hier_math_ops->laplace(z_idx,
+                                     z_cc_var,
+                                     d_poisson_spec,
+                                     x_idx,
+                                     x_cc_var,
+                                     d_no_fill,
+                                     0.0,
+                                     y ? 1.0 : 0.0,
+                                     y_idx,
+                                     y_cc_var,
+                                     l,
+                                     l,
+                                     l);
+        }
+    }
+    return;
+} // computeAction
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -138,6 +138,7 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("rel_change")) d_rel_change = input_db->getInteger("rel_change");
+        if (input_db->keyExists("reuse_hypre_setup")) d_reuse_hypre_setup = input_db->getBool("reuse_hypre_setup");
 
         if (d_solver_type == "SMG" || d_precond_type == "SMG" || d_solver_type == "PFMG" || d_precond_type == "PFMG")
         {
@@ -180,6 +181,11 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
 CCPoissonHypreLevelSolver::~CCPoissonHypreLevelSolver()
 {
     if (d_is_initialized) deallocateSolverState();
+    if (d_grid)
+    {
+        destroyHypreSolver();
+        deallocateHypreData();
+    }
     return;
 } // ~CCPoissonHypreLevelSolver
 
@@ -292,26 +298,47 @@ CCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
         d_cf_boundary = new CoarseFineBoundary<NDIM>(*d_hierarchy, d_level_num, IntVector<NDIM>(1));
     }
 
-    // Allocate and initialize the hypre data structures.
+    // Determine the data depth and the type of stencil.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     const int x_idx = x.getComponentDescriptorIndex(0);
     Pointer<CellDataFactory<NDIM, double> > x_fac = var_db->getPatchDescriptor()->getPatchDataFactory(x_idx);
-    d_depth = x_fac->getDefaultDepth();
-    if (d_poisson_spec.dIsConstant())
+    const unsigned int depth = x_fac->getDefaultDepth();
+    bool grid_aligned_anisotropy = true;
+    if (!d_poisson_spec.dIsConstant())
     {
-        d_grid_aligned_anisotropy = true;
-    }
-    else
-    {
-        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
         Pointer<SideDataFactory<NDIM, double> > pdat_factory =
             var_db->getPatchDescriptor()->getPatchDataFactory(d_poisson_spec.getDPatchDataId());
 #if !defined(NDEBUG)
         TBOX_ASSERT(pdat_factory);
 #endif
-        d_grid_aligned_anisotropy = pdat_factory->getDefaultDepth() == 1;
+        grid_aligned_anisotropy = pdat_factory->getDefaultDepth() == 1;
     }
-    allocateHypreData();
+
+    // Determine whether the hypre grid, stencil, matrices, and vectors that
+    // were retained from the previous initialization can be reused.  This
+    // requires that the patch boxes on every process are unchanged.
+    std::vector<Box<NDIM> > grid_boxes;
+    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    {
+        grid_boxes.push_back(d_level->getPatch(p())->getBox());
+    }
+    bool reuse_hypre_data = d_grid && depth == d_depth && grid_aligned_anisotropy == d_grid_aligned_anisotropy &&
+                            d_level->getRatio() == d_grid_ratio && grid_boxes == d_grid_boxes;
+    if (d_grid) reuse_hypre_data = SAMRAI_MPI::minReduction(static_cast<int>(reuse_hypre_data)) == 1;
+    if (d_grid && !reuse_hypre_data)
+    {
+        destroyHypreSolver();
+        deallocateHypreData();
+    }
+    d_depth = depth;
+    d_grid_aligned_anisotropy = grid_aligned_anisotropy;
+    d_grid_ratio = d_level->getRatio();
+    d_grid_boxes = grid_boxes;
+
+    // Allocate the hypre data structures and compute the matrix coefficients.
+    if (!reuse_hypre_data) allocateHypreData();
+    std::vector<std::vector<double> > prev_matrix_vals;
+    prev_matrix_vals.swap(d_matrix_vals);
     if (d_grid_aligned_anisotropy)
     {
         setMatrixCoefficients_aligned();
@@ -320,7 +347,18 @@ CCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
     {
         setMatrixCoefficients_nonaligned();
     }
-    setupHypreSolver();
+
+    // Setup the hypre solver unless the matrix coefficients are unchanged, in
+    // which case the existing solver can be reused.  Otherwise, update the
+    // coefficients of the existing hypre matrices in place.
+    bool reuse_hypre_solver = reuse_hypre_data && d_matrix_vals == prev_matrix_vals;
+    if (reuse_hypre_data) reuse_hypre_solver = SAMRAI_MPI::minReduction(static_cast<int>(reuse_hypre_solver)) == 1;
+    if (!reuse_hypre_solver)
+    {
+        if (reuse_hypre_data) destroyHypreSolver();
+        copyMatrixCoefficientsToHypre();
+        setupHypreSolver();
+    }
 
     // Indicate that the solver is initialized.
     d_is_initialized = true;
@@ -336,9 +374,13 @@ CCPoissonHypreLevelSolver::deallocateSolverState()
 
     IBTK_TIMER_START(t_deallocate_solver_state);
 
-    // Deallocate the hypre data structures.
-    destroyHypreSolver();
-    deallocateHypreData();
+    // Deallocate the hypre data structures.  When the hypre setup is to be
+    // reused, they are retained until the solver is next initialized.
+    if (!d_reuse_hypre_setup)
+    {
+        destroyHypreSolver();
+        deallocateHypreData();
+    }
 
     // Indicate that the solver is NOT initialized.
     d_is_initialized = false;
@@ -477,14 +519,14 @@ CCPoissonHypreLevelSolver::allocateHypreData()
 void
 CCPoissonHypreLevelSolver::setMatrixCoefficients_aligned()
 {
-    // Set matrix entries and copy them to the hypre matrix structures.
+    // Compute the matrix entries.  For each patch, the entries are stored with
+    // the stencil index varying fastest, as required by hypre.
     const int stencil_sz = static_cast<int>(d_stencil_offsets.size());
-    std::vector<int> stencil_indices(stencil_sz);
-    for (int i = 0; i < stencil_sz; ++i)
+    d_matrix_vals.resize(d_depth);
+    for (unsigned int k = 0; k < d_depth; ++k)
     {
-        stencil_indices[i] = i;
+        d_matrix_vals[k].clear();
     }
-    std::vector<double> mat_vals(stencil_sz, 0.0);
     for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
@@ -499,24 +541,24 @@ CCPoissonHypreLevelSolver::setMatrixCoefficients_aligned()
                 hier::Index<NDIM> i = b();
                 for (int j = 0; j < stencil_sz; ++j)
                 {
-                    mat_vals[j] = matrix_coefs(i, j);
+                    d_matrix_vals[k].push_back(matrix_coefs(i, j));
                 }
-                HYPRE_StructMatrixSetValues(d_matrices[k], i, stencil_sz, &stencil_indices[0], &mat_vals[0]);
             }
         }
     }
-
-    // Assemble the hypre matrices.
-    for (unsigned int k = 0; k < d_depth; ++k)
-    {
-        HYPRE_StructMatrixAssemble(d_matrices[k]);
-    }
     return;
 } // setMatrixCoefficients_aligned
 
 void
 CCPoissonHypreLevelSolver::setMatrixCoefficients_nonaligned()
 {
+    // Compute the matrix entries.  For each patch, the entries are stored with
+    // the stencil index varying fastest, as required by hypre.
+    d_matrix_vals.resize(d_depth);
+    for (unsigned int k = 0; k < d_depth; ++k)
+    {
+        d_matrix_vals[k].clear();
+    }
     static const IntVector<NDIM> no_ghosts = 0;
     for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
     {
@@ -564,12 +606,6 @@ CCPoissonHypreLevelSolver::setMatrixCoefficients_nonaligned()
 
         // Setup the finite difference stencil.
         static const int stencil_sz = (NDIM == 2 ? 9 : 19);
-        int stencil_indices[stencil_sz];
-        for (int i = 0; i < stencil_sz; ++i)
-        {
-            stencil_indices[i] = i;
-        }
-
         std::map<hier::Index<NDIM>, int, IndexComp> stencil_index_map;
         int stencil_index = 0;
 #if (NDIM == 3)
@@ -707,10 +743,37 @@ CCPoissonHypreLevelSolver::setMatrixCoefficients_nonaligned()
 
             for (unsigned int k = 0; k < d_depth; ++k)
             {
-                HYPRE_StructMatrixSetValues(d_matrices[k], i, stencil_sz, stencil_indices, &mat_vals[0]);
+                d_matrix_vals[k].insert(d_matrix_vals[k].end(), mat_vals.begin(), mat_vals.end());
             }
         }
     }
+    return;
+} // setMatrixCoefficients_nonaligned
+
+void
+CCPoissonHypreLevelSolver::copyMatrixCoefficientsToHypre()
+{
+    // Copy the matrix entries to the hypre matrix structures one patch at a
+    // time.
+    const int stencil_sz = static_cast<int>(d_stencil_offsets.size());
+    std::vector<int> stencil_indices(stencil_sz);
+    for (int i = 0; i < stencil_sz; ++i)
+    {
+        stencil_indices[i] = i;
+    }
+    for (unsigned int k = 0; k < d_depth; ++k)
+    {
+        std::size_t offset = 0;
+        for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+        {
+            const Box<NDIM>& patch_box = d_level->getPatch(p())->getBox();
+            hier::Index<NDIM> lower = patch_box.lower();
+            hier::Index<NDIM> upper = patch_box.upper();
+            HYPRE_StructMatrixSetBoxValues(
+                d_matrices[k], lower, upper, stencil_sz, &stencil_indices[0], &d_matrix_vals[k][offset]);
+            offset += static_cast<std::size_t>(stencil_sz) * patch_box.size();
+        }
+    }
 
     // Assemble the hypre matrices.
     for (unsigned int k = 0; k < d_depth; ++k)
@@ -718,7 +781,7 @@ CCPoissonHypreLevelSolver::setMatrixCoefficients_nonaligned()
         HYPRE_StructMatrixAssemble(d_matrices[k]);
     }
     return;
-} // setMatrixCoefficients_nonaligned
+} // copyMatrixCoefficientsToHypre
 
 void
 CCPoissonHypreLevelSolver::setupHypreSolver()
@@ -1265,6 +1328,7 @@ CCPoissonHypreLevelSolver::destroyHypreSolver()
 void
 CCPoissonHypreLevelSolver::deallocateHypreData()
 {
+    d_matrix_vals.clear();
     if (d_grid) HYPRE_StructGridDestroy(d_grid);
     if (d_stencil) HYPRE_StructStencilDestroy(d_stencil);
     d_grid = nullptr;
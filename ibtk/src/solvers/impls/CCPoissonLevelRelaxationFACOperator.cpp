@@ -403,10 +403,21 @@ CCPoissonLevelRelaxationFACOperator::computeResidual(SAMRAIVectorReal<NDIM, doub
                                  coarsest_level_num,
                                  finest_level_num);
     }
-    d_level_math_ops[finest_level_num]->laplace(
-        res_idx, res_var, d_poisson_spec, sol_idx, sol_var, nullptr, d_solution_time);
-    HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(d_hierarchy, coarsest_level_num, finest_level_num);
-    hier_cc_data_ops.axpy(res_idx, -1.0, res_idx, rhs_idx, false);
+    PoissonSpecifications minus_poisson_spec(d_object_name + "::minus_poisson_spec");
+    if (getMinusPoissonSpecifications(minus_poisson_spec))
+    {
+        // Compute the residual in a single pass as r = (-A)*u + f.
+        const Pointer<CellVariable<NDIM, double> > rhs_var = rhs.getComponentVariable(0);
+        d_level_math_ops[finest_level_num]->laplace(
+            res_idx, res_var, minus_poisson_spec, sol_idx, sol_var, nullptr, d_solution_time, 1.0, rhs_idx, rhs_var);
+    }
+    else
+    {
+        d_level_math_ops[finest_level_num]->laplace(
+            res_idx, res_var, d_poisson_spec, sol_idx, sol_var, nullptr, d_solution_time);
+        HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(d_hierarchy, coarsest_level_num, finest_level_num);
+        hier_cc_data_ops.axpy(res_idx, -1.0, res_idx, rhs_idx, false);
+    }
 
     IBTK_TIMER_STOP(t_compute_residual);
     return;
@@ -36,6 +36,7 @@
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
+#include "CellIndex.h"
 #include "CoarsenOperator.h"
 #include "HierarchyCellDataOpsReal.h"
 #include "MultiblockDataTranslator.h"
@@ -46,6 +47,7 @@
 #include "PoissonSpecifications.h"
 #include "ProcessorMapping.h"
 #include "SideData.h"
+#include "SideIndex.h"
 #include "Variable.h"
 #include "VariableDatabase.h"
 #include "VariableFillPattern.h"
@@ -197,6 +199,7 @@ enum SmootherType
     PATCH_GAUSS_SEIDEL,
     PROCESSOR_GAUSS_SEIDEL,
     RED_BLACK_GAUSS_SEIDEL,
+    CHEBYSHEV,
     UNKNOWN = -1
 };
 
@@ -205,8 +208,9 @@ get_smoother_type(const std::string& smoother_type_string)
 {
     if (smoother_type_string == "PATCH_GAUSS_SEIDEL") return PATCH_GAUSS_SEIDEL;
     if (smoother_type_string == "PROCESSOR_GAUSS_SEIDEL") return PROCESSOR_GAUSS_SEIDEL;
-    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL")
-        return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL") return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "CHEBYSHEV")
+        return CHEBYSHEV;
     else
         return UNKNOWN;
 } // get_smoother_type
@@ -236,6 +240,60 @@ do_local_data_update(SmootherType smoother_type)
         return false;
     }
 } // do_local_data_update
+
+/*!
+ * Compute one step of the Chebyshev iteration on a patch.
+ *
+ * The update direction is reset to D_data = c1 * D_data + c2 * inv(diag(L)) (F
+ * - L U), in which L = C I + div D grad, and the error is then updated by U = U
+ * + D_data.  If alpha_data is non-null, the diffusion coefficient is taken to
+ * be spatially varying; otherwise, the constant value alpha is used.
+ */
+void
+chebyshev_patch_update(CellData<NDIM, double>& U_data,
+                       CellData<NDIM, double>& D_data,
+                       const CellData<NDIM, double>& F_data,
+                       const SideData<NDIM, double>* const alpha_data,
+                       const double alpha,
+                       const double beta,
+                       const double* const dx,
+                       const Box<NDIM>& patch_box,
+                       const double c1,
+                       const double c2)
+{
+    for (int depth = 0; depth < U_data.getDepth(); ++depth)
+    {
+        for (Box<NDIM>::Iterator b(patch_box); b; b++)
+        {
+            const CellIndex<NDIM> i(b());
+            double diag = beta;
+            double L_U = beta * U_data(i, depth);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                CellIndex<NDIM> i_lower(i), i_upper(i);
+                i_lower(axis) -= 1;
+                i_upper(axis) += 1;
+                const double fac = 1.0 / (dx[axis] * dx[axis]);
+                double alpha_lower = alpha, alpha_upper = alpha;
+                if (alpha_data)
+                {
+                    alpha_lower = (*alpha_data)(SideIndex<NDIM>(i, axis, SideIndex<NDIM>::Lower), depth);
+                    alpha_upper = (*alpha_data)(SideIndex<NDIM>(i, axis, SideIndex<NDIM>::Upper), depth);
+                }
+                diag -= fac * (alpha_lower + alpha_upper);
+                L_U += fac * (alpha_upper * (U_data(i_upper, depth) - U_data(i, depth)) -
+                              alpha_lower * (U_data(i, depth) - U_data(i_lower, depth)));
+            }
+            D_data(i, depth) = c1 * D_data(i, depth) + c2 * (F_data(i, depth) - L_U) / diag;
+        }
+        for (Box<NDIM>::Iterator b(patch_box); b; b++)
+        {
+            const CellIndex<NDIM> i(b());
+            U_data(i, depth) += D_data(i, depth);
+        }
+    }
+    return;
+} // chebyshev_patch_update
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -265,6 +323,10 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
     if (input_db)
     {
         if (input_db->keyExists("smoother_type")) d_smoother_type = input_db->getString("smoother_type");
+        if (input_db->keyExists("chebyshev_lower_bound"))
+            d_chebyshev_lower_bound = input_db->getDouble("chebyshev_lower_bound");
+        if (input_db->keyExists("chebyshev_upper_bound"))
+            d_chebyshev_upper_bound = input_db->getDouble("chebyshev_upper_bound");
         if (input_db->keyExists("prolongation_method"))
             d_prolongation_method = input_db->getString("prolongation_method");
         if (input_db->keyExists("restriction_method")) d_restriction_method = input_db->getString("restriction_method");
@@ -281,6 +343,12 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
         {
             d_coarse_solver_db = input_db->getDatabase("coarse_solver_db");
         }
+        if (d_chebyshev_lower_bound <= 0.0 || d_chebyshev_upper_bound <= d_chebyshev_lower_bound)
+        {
+            TBOX_ERROR(d_object_name << "::CCPoissonPointRelaxationFACOperator():\n"
+                                     << "  invalid Chebyshev eigenvalue bounds: [" << d_chebyshev_lower_bound << ", "
+                                     << d_chebyshev_upper_bound << "]" << std::endl);
+        }
         if (input_db->isDatabase("bottom_solver"))
         {
             tbox::pout << "WARNING: ``bottom_solver'' input entry is no longer used by class "
@@ -374,6 +442,29 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
 #endif
     const bool red_black_ordering = use_red_black_ordering(smoother_type);
     const bool update_local_data = do_local_data_update(smoother_type);
+    const bool use_chebyshev = smoother_type == CHEBYSHEV;
+
+    // Setup the Chebyshev iteration, which requires the update direction on
+    // each patch to be retained between sweeps.
+    //
+    // NOTE: Each Chebyshev sweep updates every cell from the same iterate, so
+    // only one ghost cell fill is required per sweep, whereas red-black
+    // Gauss-Seidel requires a fill after each of its two half-sweeps.
+    const double chebyshev_theta = 0.5 * (d_chebyshev_upper_bound + d_chebyshev_lower_bound);
+    const double chebyshev_delta = 0.5 * (d_chebyshev_upper_bound - d_chebyshev_lower_bound);
+    const double chebyshev_sigma = chebyshev_theta / chebyshev_delta;
+    double chebyshev_rho = 1.0 / chebyshev_sigma;
+    std::vector<Pointer<CellData<NDIM, double> > > chebyshev_dir_data;
+    if (use_chebyshev)
+    {
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+            chebyshev_dir_data.push_back(
+                new CellData<NDIM, double>(patch->getBox(), error_data->getDepth(), IntVector<NDIM>(0)));
+        }
+    }
 
     // Cache coarse-fine interface ghost cell values in the "scratch" data.
     if (level_num > d_coarsest_ln && num_sweeps > 1)
@@ -443,6 +534,16 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             xeqScheduleGhostFillNoCoarse(error_idx, level_num);
         }
 
+        // Determine the coefficients of the Chebyshev update.
+        double chebyshev_c1 = 0.0, chebyshev_c2 = 1.0 / chebyshev_theta;
+        if (use_chebyshev && isweep > 0)
+        {
+            const double chebyshev_rho_new = 1.0 / (2.0 * chebyshev_sigma - chebyshev_rho);
+            chebyshev_c1 = chebyshev_rho_new * chebyshev_rho;
+            chebyshev_c2 = 2.0 * chebyshev_rho_new / chebyshev_delta;
+            chebyshev_rho = chebyshev_rho_new;
+        }
+
         // Smooth the error on the patches.
         int patch_counter = 0;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
@@ -494,6 +595,20 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             }
 
             const double& beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+            if (use_chebyshev)
+            {
+                chebyshev_patch_update(*error_data,
+                                       *chebyshev_dir_data[patch_counter],
+                                       *residual_data,
+                                       alpha_data.getPointer(),
+                                       alpha,
+                                       beta,
+                                       dx,
+                                       patch_box,
+                                       chebyshev_c1,
+                                       chebyshev_c2);
+                continue;
+            }
             for (int depth = 0; depth < error_data->getDepth(); ++depth)
             {
                 double* const U = error_data->getPointer(depth);
@@ -695,10 +810,21 @@ CCPoissonPointRelaxationFACOperator::computeResidual(SAMRAIVectorReal<NDIM, doub
                                  coarsest_level_num,
                                  finest_level_num);
     }
-    d_level_math_ops[finest_level_num]->laplace(
-        res_idx, res_var, d_poisson_spec, sol_idx, sol_var, nullptr, d_solution_time);
-    HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(d_hierarchy, coarsest_level_num, finest_level_num);
-    hier_cc_data_ops.axpy(res_idx, -1.0, res_idx, rhs_idx, false);
+    PoissonSpecifications minus_poisson_spec(d_object_name + "::minus_poisson_spec");
+    if (getMinusPoissonSpecifications(minus_poisson_spec))
+    {
+        // Compute the residual in a single pass as r = (-A)*u + f.
+        const Pointer<CellVariable<NDIM, double> > rhs_var = rhs.getComponentVariable(0);
+        d_level_math_ops[finest_level_num]->laplace(
+            res_idx, res_var, minus_poisson_spec, sol_idx, sol_var, nullptr, d_solution_time, 1.0, rhs_idx, rhs_var);
+    }
+    else
+    {
+        d_level_math_ops[finest_level_num]->laplace(
+            res_idx, res_var, d_poisson_spec, sol_idx, sol_var, nullptr, d_solution_time);
+        HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(d_hierarchy, coarsest_level_num, finest_level_num);
+        hier_cc_data_ops.axpy(res_idx, -1.0, res_idx, rhs_idx, false);
+    }
 
     IBTK_TIMER_STOP(t_compute_residual);
     return;
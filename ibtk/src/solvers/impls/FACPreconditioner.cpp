@@ -120,10 +120,16 @@ FACPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorRe
         TBOX_ASSERT(d_f);
         TBOX_ASSERT(d_r);
 #endif
+        // The residual vector is always computed by computeResidual() before it
+        // is used, so it does not need to be initialized.  The right-hand side
+        // is needed on all levels: the cycles compute residuals on coarser
+        // levels from it before restrictResidual() overwrites covered cells.
         d_f->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&f, false), false);
-        d_r->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&f, false), false);
         switch (d_cycle_type)
         {
+        case ADDITIVE_CYCLE:
+            additiveCycle(u, *d_f);
+            break;
         case F_CYCLE:
             FCycle(u, *d_f, d_finest_ln);
             break;
@@ -152,10 +158,14 @@ void
 FACPreconditioner::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& solution,
                                          const SAMRAIVectorReal<NDIM, double>& rhs)
 {
-    // Deallocate the solver state if the solver is already initialized.
+    // Deallocate the solver state if the solver is already initialized. The
+    // operator state is reset by the FAC strategy, which only needs to reset
+    // the levels set by its setResetLevels() function (if any).
     if (d_is_initialized)
     {
+        d_reinitializing_solver = true;
         deallocateSolverState();
+        d_reinitializing_solver = false;
     }
 
     // Setup operator state.
@@ -177,6 +187,11 @@ FACPreconditioner::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& s
         d_r = rhs.cloneVector("");
         d_f->allocateVectorData();
         d_r->allocateVectorData();
+
+        // Zero out the temporary vectors so that values which are not set
+        // during each FAC cycle (e.g., ghost cell values) are well defined.
+        d_f->setToScalar(0.0, /*interior_only*/ false);
+        d_r->setToScalar(0.0, /*interior_only*/ false);
     }
 
     // Allocate scratch data.
@@ -210,8 +225,8 @@ FACPreconditioner::deallocateSolverState()
         d_r.setNull();
     }
 
-    // Deallocate operator state.
-    d_fac_strategy->deallocateOperatorState();
+    // Deallocate operator state only if we are not re-initializing the solver.
+    if (!d_reinitializing_solver) d_fac_strategy->deallocateOperatorState();
 
     // Indicate that the operator is NOT initialized.
     d_is_initialized = false;
@@ -389,6 +404,35 @@ FACPreconditioner::FMGCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorReal<
     return;
 } // FMGCycle
 
+void
+FACPreconditioner::additiveCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorReal<NDIM, double>& f)
+{
+    // Restrict the residual to all coarser levels.  Because the initial guess
+    // is zero, the residual on each level is the restricted right-hand side.
+    for (int level_num = d_finest_ln; level_num > d_coarsest_ln; --level_num)
+    {
+        d_fac_strategy->restrictResidual(f, f, level_num - 1);
+    }
+
+    // Compute the corrections on all levels independently.  The levels are
+    // processed from finest to coarsest so that the coarser level data used at
+    // coarse-fine interfaces are still zero when each level is smoothed.
+    const int num_sweeps = d_num_pre_sweeps + d_num_post_sweeps;
+    for (int level_num = d_finest_ln; level_num > d_coarsest_ln; --level_num)
+    {
+        if (num_sweeps > 0) d_fac_strategy->smoothError(u, f, level_num, num_sweeps, false, true);
+    }
+    d_fac_strategy->solveCoarsestLevel(u, f, d_coarsest_ln);
+
+    // Sum the corrections by prolonging the accumulated correction on each
+    // level to the next finer level.
+    for (int level_num = d_coarsest_ln + 1; level_num <= d_finest_ln; ++level_num)
+    {
+        d_fac_strategy->prolongErrorAndCorrect(u, u, level_num);
+    }
+    return;
+} // additiveCycle
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
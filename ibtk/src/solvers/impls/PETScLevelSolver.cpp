@@ -19,8 +19,10 @@
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
+#include "Box.h"
 #include "CoarseFineBoundary.h"
 #include "IntVector.h"
+#include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "SAMRAIVectorReal.h"
@@ -144,6 +146,8 @@ PETScLevelSolver::~PETScLevelSolver()
                                  << "  subclass must call deallocateSolverState in subclass destructor" << std::endl);
     }
 
+    if (d_have_cached_subdomain_factorizations) destroySubdomainFactorizations();
+
     int ierr;
     for (auto& is : d_nonoverlap_is)
     {
@@ -340,12 +344,45 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
     IBTK_CHKERRQ(ierr);
 
     // Setup KSP PC.
+    //
+    // When agglomeration is requested, the preconditioner is applied on a
+    // subcommunicator that is smaller than the full communicator by the
+    // agglomeration factor by wrapping it in a PCTELESCOPE.  Unless it is set
+    // on the command line, the preconditioner type of the inner solver is the
+    // one requested for this solver.
     PC ksp_pc;
     ierr = KSPGetPC(d_petsc_ksp, &ksp_pc);
     IBTK_CHKERRQ(ierr);
     PCType pc_type = d_pc_type.c_str();
-    ierr = PCSetType(ksp_pc, pc_type);
-    IBTK_CHKERRQ(ierr);
+    const int agglomeration_factor = std::min(d_agglomeration_factor, SAMRAI_MPI::getNodes());
+    const bool use_telescope = agglomeration_factor > 1;
+    if (use_telescope)
+    {
+        if (d_pc_type == "asm" || d_pc_type == "fieldsplit" || d_pc_type == "shell")
+        {
+            TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                     << "  agglomeration is not supported with pc_type = " << d_pc_type << std::endl);
+        }
+        ierr = PCSetType(ksp_pc, PCTELESCOPE);
+        IBTK_CHKERRQ(ierr);
+        ierr = PCTelescopeSetReductionFactor(ksp_pc, agglomeration_factor);
+        IBTK_CHKERRQ(ierr);
+        const std::string telescope_prefix = d_options_prefix + "telescope_";
+        PetscBool inner_pc_type_set;
+        ierr = PetscOptionsHasName(nullptr, telescope_prefix.c_str(), "-pc_type", &inner_pc_type_set);
+        IBTK_CHKERRQ(ierr);
+        if (!inner_pc_type_set)
+        {
+            const std::string inner_pc_type_option = "-" + telescope_prefix + "pc_type";
+            ierr = PetscOptionsSetValue(nullptr, inner_pc_type_option.c_str(), d_pc_type.c_str());
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+    else
+    {
+        ierr = PCSetType(ksp_pc, pc_type);
+        IBTK_CHKERRQ(ierr);
+    }
     if (d_options_prefix != "")
     {
         ierr = KSPSetOptionsPrefix(d_petsc_ksp, d_options_prefix.c_str());
@@ -357,9 +394,12 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
     // Reset class data structure to correspond to command-line options.
     ierr = KSPGetTolerances(d_petsc_ksp, &d_rel_residual_tol, &d_abs_residual_tol, nullptr, &d_max_iterations);
     IBTK_CHKERRQ(ierr);
-    ierr = PCGetType(ksp_pc, &pc_type);
-    IBTK_CHKERRQ(ierr);
-    d_pc_type = pc_type;
+    if (!use_telescope)
+    {
+        ierr = PCGetType(ksp_pc, &pc_type);
+        IBTK_CHKERRQ(ierr);
+        d_pc_type = pc_type;
+    }
 
     // Set the nullspace.
     if (d_nullspace_contains_constant_vec || !d_nullspace_basis_vecs.empty()) setupNullspace();
@@ -446,13 +486,24 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
             generate_petsc_is_from_std_is(overlap_is, nonoverlap_is, d_overlap_is, d_nonoverlap_is);
         }
 
-        // Get the local submatrices.
+        // Get the local submatrices.  If the subdomain factorizations of the
+        // previous solver state have been kept and the patch level and the
+        // subdomains are unchanged, the submatrices are updated in place.
+        const bool reuse_sub_ksp = d_have_cached_subdomain_factorizations && canReuseSubdomainFactorizations();
+        if (d_have_cached_subdomain_factorizations && !reuse_sub_ksp) destroySubdomainFactorizations();
+        std::vector<Mat> old_sub_mat(reuse_sub_ksp ? d_n_local_subdomains : 0);
+        for (unsigned int i = 0; i < old_sub_mat.size(); ++i)
+        {
+            ierr = MatDuplicate(d_sub_mat[i], MAT_COPY_VALUES, &old_sub_mat[i]);
+            IBTK_CHKERRQ(ierr);
+        }
+        const MatReuse sub_mat_reuse = reuse_sub_ksp ? MAT_REUSE_MATRIX : MAT_INITIAL_MATRIX;
 #if PETSC_VERSION_GE(3, 8, 0)
         ierr = MatCreateSubMatrices(
-            d_petsc_mat, d_n_local_subdomains, &d_overlap_is[0], &d_overlap_is[0], MAT_INITIAL_MATRIX, &d_sub_mat);
+            d_petsc_mat, d_n_local_subdomains, &d_overlap_is[0], &d_overlap_is[0], sub_mat_reuse, &d_sub_mat);
 #else
         ierr = MatGetSubMatrices(
-            d_petsc_mat, d_n_local_subdomains, &d_overlap_is[0], &d_overlap_is[0], MAT_INITIAL_MATRIX, &d_sub_mat);
+            d_petsc_mat, d_n_local_subdomains, &d_overlap_is[0], &d_overlap_is[0], sub_mat_reuse, &d_sub_mat);
 #endif
         IBTK_CHKERRQ(ierr);
 
@@ -572,9 +623,27 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
             IBTK_CHKERRQ(ierr);
         }
 
-        // Set up subdomain KSPs
-        d_sub_ksp.resize(d_n_local_subdomains);
-        for (int i = 0; i < d_n_local_subdomains; ++i)
+        // Set up subdomain KSPs.  Cached subdomain solvers are refactored only
+        // if the values of their matrices have changed.  Since the nonzero
+        // structure is unchanged, only the numerical factorization is redone.
+        for (unsigned int i = 0; i < old_sub_mat.size(); ++i)
+        {
+            PetscBool unchanged;
+            ierr = MatEqual(old_sub_mat[i], d_sub_mat[i], &unchanged);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatDestroy(&old_sub_mat[i]);
+            IBTK_CHKERRQ(ierr);
+            if (unchanged) continue;
+            KSP& sub_ksp = d_sub_ksp[i];
+            ierr = KSPSetReusePreconditioner(sub_ksp, PETSC_FALSE);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetUp(sub_ksp);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetReusePreconditioner(sub_ksp, PETSC_TRUE);
+            IBTK_CHKERRQ(ierr);
+        }
+        if (!reuse_sub_ksp) d_sub_ksp.resize(d_n_local_subdomains);
+        for (int i = 0; i < (reuse_sub_ksp ? 0 : d_n_local_subdomains); ++i)
         {
             KSP& sub_ksp = d_sub_ksp[i];
             Mat& sub_mat = d_sub_mat[i];
@@ -607,6 +676,7 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
             ierr = KSPSetInitialGuessNonzero(sub_ksp, PETSC_FALSE);
             IBTK_CHKERRQ(ierr);
         }
+        if (d_reuse_subdomain_factorizations && !reuse_sub_ksp) cacheSubdomainLayout();
         ierr = PCSetType(ksp_pc, PCSHELL);
         IBTK_CHKERRQ(ierr);
         ierr = PCShellSetContext(ksp_pc, static_cast<void*>(this));
@@ -677,10 +747,23 @@ PETScLevelSolver::deallocateSolverState()
     // Deallocate PETSc objects for shell preconditioner.
     if (d_pc_type == "shell")
     {
-        for (int i = 0; i < d_n_local_subdomains; ++i)
+        // The subdomain matrices and solvers are kept if they may be reused
+        // when the solver is reinitialized.
+        if (d_reuse_subdomain_factorizations)
         {
-            ierr = KSPDestroy(&d_sub_ksp[i]);
+            d_have_cached_subdomain_factorizations = true;
+        }
+        else
+        {
+            for (int i = 0; i < d_n_local_subdomains; ++i)
+            {
+                ierr = KSPDestroy(&d_sub_ksp[i]);
+                IBTK_CHKERRQ(ierr);
+            }
+            ierr = MatDestroyMatrices(d_n_local_subdomains, &d_sub_mat);
             IBTK_CHKERRQ(ierr);
+            d_sub_mat = nullptr;
+            d_sub_ksp.clear();
         }
         for (int i = 0; i < d_n_subdomains_max; ++i)
         {
@@ -693,14 +776,11 @@ PETScLevelSolver::deallocateSolverState()
             ierr = VecScatterDestroy(&d_restriction[i]);
             IBTK_CHKERRQ(ierr);
         }
-        ierr = MatDestroyMatrices(d_n_local_subdomains, &d_sub_mat);
-        IBTK_CHKERRQ(ierr);
         if (d_shell_pc_type == "multiplicative" && d_n_local_subdomains > 0)
         {
             ierr = MatDestroyMatrices(d_n_local_subdomains, &d_sub_bc_mat);
             IBTK_CHKERRQ(ierr);
         }
-        d_sub_mat = nullptr;
         ierr = VecDestroy(&d_local_x);
         IBTK_CHKERRQ(ierr);
         d_local_x = nullptr;
@@ -714,7 +794,6 @@ PETScLevelSolver::deallocateSolverState()
         d_local_nonoverlap_is.clear();
         d_restriction.clear();
         d_prolongation.clear();
-        d_sub_ksp.clear();
         d_sub_x.clear();
         d_sub_x.clear();
     }
@@ -747,6 +826,10 @@ PETScLevelSolver::init(Pointer<Database> input_db, const std::string& default_op
         if (input_db->keyExists("ksp_type")) d_ksp_type = input_db->getString("ksp_type");
         if (input_db->keyExists("pc_type")) d_pc_type = input_db->getString("pc_type");
         if (input_db->keyExists("shell_pc_type")) d_shell_pc_type = input_db->getString("shell_pc_type");
+        if (input_db->keyExists("agglomeration_factor"))
+            d_agglomeration_factor = input_db->getInteger("agglomeration_factor");
+        if (input_db->keyExists("reuse_subdomain_factorizations"))
+            d_reuse_subdomain_factorizations = input_db->getBool("reuse_subdomain_factorizations");
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("subdomain_box_size"))
@@ -811,6 +894,88 @@ PETScLevelSolver::setupNullspace()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+bool
+PETScLevelSolver::canReuseSubdomainFactorizations() const
+{
+    bool can_reuse = static_cast<int>(d_sub_ksp.size()) == d_n_local_subdomains &&
+                     static_cast<int>(d_cached_overlap_idxs.size()) == d_n_local_subdomains;
+
+    // Check that the local patch boxes are unchanged.
+    int patch_counter = 0;
+    for (PatchLevel<NDIM>::Iterator p(d_level); can_reuse && p; p++, ++patch_counter)
+    {
+        can_reuse = patch_counter < static_cast<int>(d_cached_patch_boxes.size()) &&
+                    d_level->getPatch(p())->getBox() == d_cached_patch_boxes[patch_counter];
+    }
+    can_reuse = can_reuse && patch_counter == static_cast<int>(d_cached_patch_boxes.size());
+
+    // Check that the subdomains are unchanged.
+    int ierr;
+    for (int i = 0; can_reuse && i < d_n_local_subdomains; ++i)
+    {
+        int overlap_is_size;
+        ierr = ISGetLocalSize(d_overlap_is[i], &overlap_is_size);
+        IBTK_CHKERRQ(ierr);
+        const PetscInt* overlap_is_arr;
+        ierr = ISGetIndices(d_overlap_is[i], &overlap_is_arr);
+        IBTK_CHKERRQ(ierr);
+        can_reuse = overlap_is_size == static_cast<int>(d_cached_overlap_idxs[i].size()) &&
+                    std::equal(overlap_is_arr, overlap_is_arr + overlap_is_size, d_cached_overlap_idxs[i].begin());
+        ierr = ISRestoreIndices(d_overlap_is[i], &overlap_is_arr);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    // Since the submatrices are extracted collectively, they may be reused
+    // only if they may be reused on all processes.
+    return SAMRAI_MPI::minReduction(can_reuse ? 1 : 0) == 1;
+} // canReuseSubdomainFactorizations
+
+void
+PETScLevelSolver::cacheSubdomainLayout()
+{
+    d_cached_patch_boxes.clear();
+    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    {
+        d_cached_patch_boxes.push_back(d_level->getPatch(p())->getBox());
+    }
+
+    int ierr;
+    d_cached_overlap_idxs.resize(d_n_local_subdomains);
+    for (int i = 0; i < d_n_local_subdomains; ++i)
+    {
+        int overlap_is_size;
+        ierr = ISGetLocalSize(d_overlap_is[i], &overlap_is_size);
+        IBTK_CHKERRQ(ierr);
+        const PetscInt* overlap_is_arr;
+        ierr = ISGetIndices(d_overlap_is[i], &overlap_is_arr);
+        IBTK_CHKERRQ(ierr);
+        d_cached_overlap_idxs[i].assign(overlap_is_arr, overlap_is_arr + overlap_is_size);
+        ierr = ISRestoreIndices(d_overlap_is[i], &overlap_is_arr);
+        IBTK_CHKERRQ(ierr);
+    }
+    return;
+} // cacheSubdomainLayout
+
+void
+PETScLevelSolver::destroySubdomainFactorizations()
+{
+    int ierr;
+    const int n_sub_ksp = static_cast<int>(d_sub_ksp.size());
+    for (int i = 0; i < n_sub_ksp; ++i)
+    {
+        ierr = KSPDestroy(&d_sub_ksp[i]);
+        IBTK_CHKERRQ(ierr);
+    }
+    ierr = MatDestroyMatrices(n_sub_ksp, &d_sub_mat);
+    IBTK_CHKERRQ(ierr);
+    d_sub_mat = nullptr;
+    d_sub_ksp.clear();
+    d_cached_patch_boxes.clear();
+    d_cached_overlap_idxs.clear();
+    d_have_cached_subdomain_factorizations = false;
+    return;
+} // destroySubdomainFactorizations
+
 PetscErrorCode
 PETScLevelSolver::PCApply_Additive(PC pc, Vec x, Vec y)
 {
@@ -431,7 +431,11 @@ PoissonFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVectorReal
                                                             d_prolongation_refine_patch_strategy.getPointer());
     }
 
-    for (int dst_ln = coarsest_reset_ln; dst_ln < std::min(finest_reset_ln + 1, d_finest_ln); ++dst_ln)
+    // NOTE: The restriction schedule for level (coarsest_reset_ln - 1) reads
+    // data from a reset level and must also be recreated.
+    for (int dst_ln = std::max(d_coarsest_ln, coarsest_reset_ln - 1);
+         dst_ln < std::min(finest_reset_ln + 1, d_finest_ln);
+         ++dst_ln)
     {
         d_restriction_coarsen_schedules[dst_ln] = d_restriction_coarsen_algorithm->createSchedule(
             d_hierarchy->getPatchLevel(dst_ln), d_hierarchy->getPatchLevel(dst_ln + 1));
@@ -602,6 +606,22 @@ PoissonFACPreconditionerStrategy::xeqScheduleDataSynch(const int dst_idx, const
     return;
 } // xeqScheduleDataSynch
 
+bool
+PoissonFACPreconditionerStrategy::getMinusPoissonSpecifications(PoissonSpecifications& minus_poisson_spec) const
+{
+    if (!d_poisson_spec.dIsConstant() || !(d_poisson_spec.cIsZero() || d_poisson_spec.cIsConstant())) return false;
+    minus_poisson_spec.setDConstant(-d_poisson_spec.getDConstant());
+    if (d_poisson_spec.cIsZero())
+    {
+        minus_poisson_spec.setCZero();
+    }
+    else
+    {
+        minus_poisson_spec.setCConstant(-d_poisson_spec.getCConstant());
+    }
+    return true;
+} // getMinusPoissonSpecifications
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,285 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/SCPoissonFFTLevelSolver.h"
+#include "ibtk/GeneralSolver.h"
+#include "ibtk/PeriodicHelmholtzFFT.h"
+#include "ibtk/ibtk_utilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+#include "ArrayData.h"
+#include "Box.h"
+#include "BoxArray.h"
+#include "CartesianGridGeometry.h"
+#include "SideData.h"
+#include "SideDataFactory.h"
+#include "SideGeometry.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchDescriptor.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "PoissonSpecifications.h"
+#include "ProcessorMapping.h"
+#include "SAMRAIVectorReal.h"
+#include "VariableDatabase.h"
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
+#include "tbox/Utilities.h"
+
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Timers.
+static Timer* t_solve_system;
+static Timer* t_initialize_solver_state;
+static Timer* t_deallocate_solver_state;
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+SCPoissonFFTLevelSolver::SCPoissonFFTLevelSolver(const std::string& object_name,
+                                                 Pointer<Database> input_db,
+                                                 const std::string& /*default_options_prefix*/)
+{
+    // Setup default options. The solver is direct, so there is exactly one
+    // "iteration" per solve.
+    GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
+    d_initial_guess_nonzero = false;
+    d_max_iterations = 1;
+
+    // Get values from the input database.
+    if (input_db)
+    {
+        if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+    }
+
+    // Setup Timers.
+    IBTK_DO_ONCE(t_solve_system = TimerManager::getManager()->getTimer("IBTK::SCPoissonFFTLevelSolver::solveSystem()");
+                 t_initialize_solver_state =
+                     TimerManager::getManager()->getTimer("IBTK::SCPoissonFFTLevelSolver::initializeSolverState()");
+                 t_deallocate_solver_state =
+                     TimerManager::getManager()->getTimer("IBTK::SCPoissonFFTLevelSolver::deallocateSolverState()"););
+    return;
+} // SCPoissonFFTLevelSolver
+
+SCPoissonFFTLevelSolver::~SCPoissonFFTLevelSolver()
+{
+    if (d_is_initialized) deallocateSolverState();
+    return;
+} // ~SCPoissonFFTLevelSolver
+
+bool
+SCPoissonFFTLevelSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBTK_TIMER_START(t_solve_system);
+
+    // Initialize the solver, when necessary.
+    const bool deallocate_after_solve = !d_is_initialized;
+    if (deallocate_after_solve) initializeSolverState(x, b);
+
+    // Solve the system for each component of the data.
+    double C, D;
+    getCoefficients(C, D);
+    const int x_idx = x.getComponentDescriptorIndex(0);
+    const int b_idx = b.getComponentDescriptorIndex(0);
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<SideDataFactory<NDIM, double> > x_fac = var_db->getPatchDescriptor()->getPatchDataFactory(x_idx);
+    const int depth = x_fac->getDefaultDepth();
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        std::vector<ArrayData<NDIM, double>*> x_data(d_level->getNumberOfPatches(), nullptr);
+        std::vector<const ArrayData<NDIM, double>*> b_data(d_level->getNumberOfPatches(), nullptr);
+        for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
+            Pointer<SideData<NDIM, double> > x_sc_data = patch->getPatchData(x_idx);
+            Pointer<SideData<NDIM, double> > b_sc_data = patch->getPatchData(b_idx);
+            x_data[p()] = &x_sc_data->getArrayData(axis);
+            b_data[p()] = &b_sc_data->getArrayData(axis);
+        }
+        for (int k = 0; k < depth; ++k) d_ffts[axis]->solve(x_data, k, b_data, k, C, D);
+    }
+    d_current_iterations = 1;
+    d_current_residual_norm = 0.0;
+
+    // Log solver info.
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::solveSystem(): direct solve with C = " << C << ", D = " << D << "\n";
+    }
+
+    // Deallocate the solver, when necessary.
+    if (deallocate_after_solve) deallocateSolverState();
+
+    IBTK_TIMER_STOP(t_solve_system);
+    return true;
+} // solveSystem
+
+void
+SCPoissonFFTLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
+                                               const SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBTK_TIMER_START(t_initialize_solver_state);
+
+#if !defined(NDEBUG)
+    // Rudimentary error checking.
+    if (x.getNumberOfComponents() != b.getNumberOfComponents())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same number of components" << std::endl);
+    }
+    if (x.getPatchHierarchy() != b.getPatchHierarchy())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same hierarchy" << std::endl);
+    }
+    if (x.getCoarsestLevelNumber() != b.getCoarsestLevelNumber() ||
+        x.getFinestLevelNumber() != b.getFinestLevelNumber())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same range of levels" << std::endl);
+    }
+#else
+    NULL_USE(b);
+#endif
+    // Deallocate the solver state if the solver is already initialized.
+    if (d_is_initialized) deallocateSolverState();
+
+    // Get the hierarchy information.
+    d_hierarchy = x.getPatchHierarchy();
+    d_level_num = x.getCoarsestLevelNumber();
+    if (d_level_num != x.getFinestLevelNumber())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  coarsest_ln != finest_ln in SCPoissonFFTLevelSolver" << std::endl);
+    }
+    d_level = d_hierarchy->getPatchLevel(d_level_num);
+
+    // Check that the patch level is uniform and fully periodic and that the
+    // problem has constant coefficients.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = d_hierarchy->getGridGeometry();
+    const IntVector<NDIM>& ratio = d_level->getRatio();
+    const IntVector<NDIM>& periodic_shift = grid_geometry->getPeriodicShift(ratio);
+    const BoxArray<NDIM>& domain_boxes = d_level->getPhysicalDomain();
+    const BoxArray<NDIM>& boxes = d_level->getBoxes();
+    const ProcessorMapping& mapping = d_level->getProcessorMapping();
+    std::vector<Box<NDIM> > grid_boxes;
+    std::vector<int> grid_owners;
+    int num_level_cells = 0;
+    for (int k = 0; k < boxes.getNumberOfBoxes(); ++k)
+    {
+        grid_boxes.push_back(boxes[k]);
+        grid_owners.push_back(mapping.getProcessorAssignment(k));
+        num_level_cells += boxes[k].size();
+    }
+    if (domain_boxes.getNumberOfBoxes() != 1 || num_level_cells != domain_boxes[0].size())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  patch level must cover a physical domain that is a single box" << std::endl);
+    }
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (periodic_shift(d) == 0)
+        {
+            TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                     << "  physical domain must be periodic in all directions" << std::endl);
+        }
+    }
+    double C, D;
+    getCoefficients(C, D);
+
+    // Set up the transforms unless they were set up for the same patch boxes.
+    if (!d_ffts[0] || grid_boxes != d_grid_boxes || grid_owners != d_grid_owners || ratio != d_grid_ratio)
+    {
+        const double* const dx_coarsest = grid_geometry->getDx();
+        double dx[NDIM];
+        for (unsigned int d = 0; d < NDIM; ++d) dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
+        // The side indices of each component are a periodic lattice with the
+        // same number of values as the cells. The values on the lower faces of
+        // the cells of each patch are read from the right-hand side, and the
+        // solution is set on all faces of the patch.
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            std::vector<Box<NDIM> > side_boxes;
+            for (const Box<NDIM>& box : grid_boxes) side_boxes.push_back(SideGeometry<NDIM>::toSideBox(box, axis));
+            d_ffts[axis].reset(new PeriodicHelmholtzFFT(domain_boxes[0], dx, grid_boxes, side_boxes, grid_owners));
+        }
+        d_grid_boxes = grid_boxes;
+        d_grid_owners = grid_owners;
+        d_grid_ratio = ratio;
+    }
+
+    // Indicate that the solver is initialized.
+    d_is_initialized = true;
+
+    IBTK_TIMER_STOP(t_initialize_solver_state);
+    return;
+} // initializeSolverState
+
+void
+SCPoissonFFTLevelSolver::deallocateSolverState()
+{
+    if (!d_is_initialized) return;
+
+    IBTK_TIMER_START(t_deallocate_solver_state);
+
+    // The transforms are retained until the solver is next initialized.
+    d_hierarchy.setNull();
+    d_level.setNull();
+    d_level_num = IBTK::invalid_level_number;
+
+    // Indicate that the solver is NOT initialized.
+    d_is_initialized = false;
+
+    IBTK_TIMER_STOP(t_deallocate_solver_state);
+    return;
+} // deallocateSolverState
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+SCPoissonFFTLevelSolver::getCoefficients(double& C, double& D) const
+{
+    if (!(d_poisson_spec.cIsZero() || d_poisson_spec.cIsConstant()) || !d_poisson_spec.dIsConstant())
+    {
+        TBOX_ERROR(d_object_name << "::getCoefficients()\n"
+                                 << "  C and D must be constant in SCPoissonFFTLevelSolver" << std::endl);
+    }
+    C = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+    D = d_poisson_spec.getDConstant();
+    return;
+} // getCoefficients
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -108,6 +108,7 @@ SCPoissonHypreLevelSolver::SCPoissonHypreLevelSolver(const std::string& object_n
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("rel_change")) d_rel_change = input_db->getInteger("rel_change");
+        if (input_db->keyExists("reuse_hypre_setup")) d_reuse_hypre_setup = input_db->getBool("reuse_hypre_setup");
 
         if (d_solver_type == "SysPFMG" || d_precond_type == "SysPFMG")
         {
@@ -146,6 +147,11 @@ SCPoissonHypreLevelSolver::SCPoissonHypreLevelSolver(const std::string& object_n
 SCPoissonHypreLevelSolver::~SCPoissonHypreLevelSolver()
 {
     if (d_is_initialized) deallocateSolverState();
+    if (d_grid)
+    {
+        destroyHypreSolver();
+        deallocateHypreData();
+    }
     return;
 } // ~SCPoissonHypreLevelSolver
 
@@ -260,10 +266,47 @@ SCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
         d_cf_boundary = new CoarseFineBoundary<NDIM>(*d_hierarchy, d_level_num, IntVector<NDIM>(1));
     }
 
-    // Allocate and initialize the hypre data structures.
-    allocateHypreData();
+    // Determine whether the hypre grid, graph, and vectors that were retained
+    // from the previous initialization can be reused.  This requires that the
+    // patch boxes on every process are unchanged.
+    std::vector<Box<NDIM> > grid_boxes;
+    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    {
+        grid_boxes.push_back(d_level->getPatch(p())->getBox());
+    }
+    bool reuse_hypre_data = d_grid && d_level->getRatio() == d_grid_ratio && grid_boxes == d_grid_boxes;
+    if (d_grid) reuse_hypre_data = SAMRAI_MPI::minReduction(static_cast<int>(reuse_hypre_data)) == 1;
+    if (d_grid && !reuse_hypre_data)
+    {
+        destroyHypreSolver();
+        deallocateHypreData();
+    }
+    d_grid_ratio = d_level->getRatio();
+    d_grid_boxes = grid_boxes;
+
+    // Allocate the hypre data structures and compute the matrix coefficients.
+    if (!reuse_hypre_data) allocateHypreData();
+    std::vector<double> prev_matrix_vals;
+    prev_matrix_vals.swap(d_matrix_vals);
     setMatrixCoefficients();
-    setupHypreSolver();
+
+    // Setup the hypre solver unless the matrix coefficients are unchanged, in
+    // which case the existing solver can be reused.  Otherwise, the hypre
+    // matrix is rebuilt on the existing graph.
+    bool reuse_hypre_solver = reuse_hypre_data && d_matrix_vals == prev_matrix_vals;
+    if (reuse_hypre_data) reuse_hypre_solver = SAMRAI_MPI::minReduction(static_cast<int>(reuse_hypre_solver)) == 1;
+    if (!reuse_hypre_solver)
+    {
+        if (reuse_hypre_data)
+        {
+            destroyHypreSolver();
+            HYPRE_SStructMatrixDestroy(d_matrix);
+            HYPRE_SStructMatrixCreate(SAMRAI_MPI::getCommunicator(), d_graph, &d_matrix);
+            HYPRE_SStructMatrixInitialize(d_matrix);
+        }
+        copyMatrixCoefficientsToHypre();
+        setupHypreSolver();
+    }
 
     // Indicate that the solver is initialized.
     d_is_initialized = true;
@@ -279,9 +322,13 @@ SCPoissonHypreLevelSolver::deallocateSolverState()
 
     IBTK_TIMER_START(t_deallocate_solver_state);
 
-    // Deallocate the hypre data structures.
-    destroyHypreSolver();
-    deallocateHypreData();
+    // Deallocate the hypre data structures.  When the hypre setup is to be
+    // reused, they are retained until the solver is next initialized.
+    if (!d_reuse_hypre_setup)
+    {
+        destroyHypreSolver();
+        deallocateHypreData();
+    }
 
     // Indicate that the solver is NOT initialized.
     d_is_initialized = false;
@@ -381,6 +428,9 @@ SCPoissonHypreLevelSolver::allocateHypreData()
 void
 SCPoissonHypreLevelSolver::setMatrixCoefficients()
 {
+    // Compute the matrix entries.  The entries are stored patch by patch and
+    // axis by axis, with the stencil index varying fastest.
+    d_matrix_vals.clear();
     for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
@@ -389,14 +439,6 @@ SCPoissonHypreLevelSolver::setMatrixCoefficients()
         SideData<NDIM, double> matrix_coefs(patch_box, stencil_sz, IntVector<NDIM>(0));
         PoissonUtilities::computeMatrixCoefficients(
             matrix_coefs, patch, d_stencil_offsets, d_poisson_spec, d_bc_coefs, d_solution_time);
-
-        // Copy matrix entries to the hypre matrix structure.
-        std::vector<int> stencil_indices(stencil_sz);
-        for (int i = 0; i < stencil_sz; ++i)
-        {
-            stencil_indices[i] = i;
-        }
-        std::vector<double> mat_vals(stencil_sz, 0.0);
         for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
             Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
@@ -405,14 +447,41 @@ SCPoissonHypreLevelSolver::setMatrixCoefficients()
                 SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
                 for (int k = 0; k < stencil_sz; ++k)
                 {
-                    mat_vals[k] = matrix_coefs(i, k);
+                    d_matrix_vals.push_back(matrix_coefs(i, k));
                 }
+            }
+        }
+    }
+    return;
+} // setMatrixCoefficients
+
+void
+SCPoissonHypreLevelSolver::copyMatrixCoefficientsToHypre()
+{
+    // Copy matrix entries to the hypre matrix structure.
+    const int stencil_sz = static_cast<int>(d_stencil_offsets.size());
+    std::vector<int> stencil_indices(stencil_sz);
+    for (int i = 0; i < stencil_sz; ++i)
+    {
+        stencil_indices[i] = i;
+    }
+    std::size_t offset = 0;
+    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    {
+        const Box<NDIM>& patch_box = d_level->getPatch(p())->getBox();
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+            for (Box<NDIM>::Iterator b(side_box); b; b++, offset += stencil_sz)
+            {
                 // NOTE: In SAMRAI, face-centered values are associated with the
                 // cell index located on the "upper" side of the face, but in
                 // hypre, face-centered values are associated with the cell
                 // index located on the "lower" side of the face.
+                hier::Index<NDIM> i = b();
                 i(axis) -= 1;
-                HYPRE_SStructMatrixSetValues(d_matrix, PART, i, axis, stencil_sz, &stencil_indices[0], &mat_vals[0]);
+                HYPRE_SStructMatrixSetValues(
+                    d_matrix, PART, i, axis, stencil_sz, &stencil_indices[0], &d_matrix_vals[offset]);
             }
         }
     }
@@ -420,7 +489,7 @@ SCPoissonHypreLevelSolver::setMatrixCoefficients()
     // Assemble the hypre matrix.
     HYPRE_SStructMatrixAssemble(d_matrix);
     return;
-} // setMatrixCoefficients
+} // copyMatrixCoefficientsToHypre
 
 void
 SCPoissonHypreLevelSolver::setupHypreSolver()
@@ -904,6 +973,7 @@ SCPoissonHypreLevelSolver::destroyHypreSolver()
 void
 SCPoissonHypreLevelSolver::deallocateHypreData()
 {
+    d_matrix_vals.clear();
     if (d_graph) HYPRE_SStructGraphDestroy(d_graph);
     for (const auto& var : d_stencil)
     {
@@ -914,6 +984,7 @@ SCPoissonHypreLevelSolver::deallocateHypreData()
     if (d_sol_vec) HYPRE_SStructVectorDestroy(d_sol_vec);
     if (d_rhs_vec) HYPRE_SStructVectorDestroy(d_rhs_vec);
     d_grid = nullptr;
+    d_graph = nullptr;
     for (auto& var : d_stencil)
     {
         var = nullptr;
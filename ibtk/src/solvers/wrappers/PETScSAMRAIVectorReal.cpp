@@ -19,9 +19,19 @@
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
+#include "ArrayData.h"
+#include "Box.h"
+#include "CellData.h"
+#include "CellVariable.h"
+#include "Index.h"
 #include "IntVector.h"
+#include "Patch.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "SAMRAIVectorReal.h"
+#include "SideData.h"
+#include "SideGeometry.h"
+#include "SideVariable.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/Pointer.h"
 #include "tbox/Timer.h"
@@ -35,6 +45,7 @@
 #include <cmath>
 #include <ostream>
 #include <string>
+#include <vector>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -102,6 +113,237 @@ static Timer* t_vec_dot_norm2;
 #define PSVR_CHECK3(v1, v2, v3)
 #define PSVR_CHECKN(v, N)
 #endif
+
+// The fused MAXPY kernel processes the data in chunks of this many values so
+// that the data being updated remain in cache while they are combined with
+// each of the other vectors.
+const int FUSED_KERNEL_CHUNK_SIZE = 256;
+
+// Determine whether the fused kernels implemented below may be used with the
+// vector x and the nv vectors y.  The fused kernels require all components to
+// be cell-centered or (fully) side-centered and require the patch data for
+// each component to have the same ghost box in all of the vectors.
+bool
+use_fused_kernels(const SAMRAIVectorReal<NDIM, double>& x, const PetscInt nv, const Vec* y)
+{
+    const int ncomp = x.getNumberOfComponents();
+    const int coarsest_ln = x.getCoarsestLevelNumber();
+    const int finest_ln = x.getFinestLevelNumber();
+    for (PetscInt k = 0; k < nv; ++k)
+    {
+        const SAMRAIVectorReal<NDIM, double>& y_vec = *PSVR_CAST2(y[k]);
+        if (y_vec.getNumberOfComponents() != ncomp || y_vec.getCoarsestLevelNumber() != coarsest_ln ||
+            y_vec.getFinestLevelNumber() != finest_ln ||
+            y_vec.getPatchHierarchy().getPointer() != x.getPatchHierarchy().getPointer())
+        {
+            return false;
+        }
+    }
+    Pointer<PatchHierarchy<NDIM> > hierarchy = x.getPatchHierarchy();
+    for (int comp = 0; comp < ncomp; ++comp)
+    {
+        Pointer<CellVariable<NDIM, double> > comp_cc_var = x.getComponentVariable(comp);
+        Pointer<SideVariable<NDIM, double> > comp_sc_var = x.getComponentVariable(comp);
+        if (!comp_cc_var && !comp_sc_var) return false;
+        for (PetscInt k = 0; k < nv; ++k)
+        {
+            Pointer<CellVariable<NDIM, double> > y_cc_var = PSVR_CAST2(y[k])->getComponentVariable(comp);
+            Pointer<SideVariable<NDIM, double> > y_sc_var = PSVR_CAST2(y[k])->getComponentVariable(comp);
+            if (bool(y_cc_var) != bool(comp_cc_var) || bool(y_sc_var) != bool(comp_sc_var)) return false;
+        }
+        const int x_idx = x.getComponentDescriptorIndex(comp);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<PatchData<NDIM> > x_data = patch->getPatchData(x_idx);
+                if (comp_sc_var)
+                {
+                    Pointer<SideData<NDIM, double> > x_sc_data = x_data;
+                    if (x_sc_data->getDirectionVector() != IntVector<NDIM>(1)) return false;
+                }
+                for (PetscInt k = 0; k < nv; ++k)
+                {
+                    Pointer<PatchData<NDIM> > y_data =
+                        patch->getPatchData(PSVR_CAST2(y[k])->getComponentDescriptorIndex(comp));
+                    if (!(y_data->getGhostBox() == x_data->getGhostBox()) ||
+                        y_data->getGhostCellWidth() != x_data->getGhostCellWidth())
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+    return true;
+} // use_fused_kernels
+
+// Collect the arrays that store the values of a cell- or side-centered patch
+// data object.
+void
+get_arrays(std::vector<ArrayData<NDIM, double>*>& arrays, const Pointer<PatchData<NDIM> >& data)
+{
+    arrays.clear();
+    Pointer<CellData<NDIM, double> > cc_data = data;
+    if (cc_data)
+    {
+        arrays.push_back(&cc_data->getArrayData());
+        return;
+    }
+    Pointer<SideData<NDIM, double> > sc_data = data;
+    if (sc_data)
+    {
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            arrays.push_back(&sc_data->getArrayData(axis));
+        }
+        return;
+    }
+    TBOX_ERROR("PETScSAMRAIVectorReal: unsupported patch data type" << std::endl);
+} // get_arrays
+
+// Compute the offset of index i in the data of the given array.
+inline int
+array_offset(const ArrayData<NDIM, double>& array, const Index<NDIM>& i)
+{
+    const Box<NDIM>& box = array.getBox();
+    int offset = 0, stride = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        offset += (i(d) - box.lower(d)) * stride;
+        stride *= box.upper(d) - box.lower(d) + 1;
+    }
+    return offset;
+} // array_offset
+
+// Compute the local contributions to the (control volume weighted) inner
+// products of x with each of the nv vectors y while traversing the data of x
+// only once.
+void
+fused_mdot_local(const SAMRAIVectorReal<NDIM, double>& x, const PetscInt nv, const Vec* y, PetscScalar* val)
+{
+    std::fill(val, val + nv, 0.0);
+    Pointer<PatchHierarchy<NDIM> > hierarchy = x.getPatchHierarchy();
+    const int coarsest_ln = x.getCoarsestLevelNumber();
+    const int finest_ln = x.getFinestLevelNumber();
+    const int ncomp = x.getNumberOfComponents();
+    std::vector<ArrayData<NDIM, double>*> x_arrays, cvol_arrays;
+    std::vector<std::vector<ArrayData<NDIM, double>*> > y_arrays(nv);
+    std::vector<double> xw_row;
+    for (int comp = 0; comp < ncomp; ++comp)
+    {
+        const int x_idx = x.getComponentDescriptorIndex(comp);
+        const int cvol_idx = x.getControlVolumeIndex(comp);
+        const bool has_cvol = cvol_idx >= 0;
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                Pointer<PatchData<NDIM> > x_data = patch->getPatchData(x_idx);
+                get_arrays(x_arrays, x_data);
+                if (has_cvol) get_arrays(cvol_arrays, patch->getPatchData(cvol_idx));
+                for (PetscInt k = 0; k < nv; ++k)
+                {
+                    get_arrays(y_arrays[k], patch->getPatchData(PSVR_CAST2(y[k])->getComponentDescriptorIndex(comp)));
+                }
+                Pointer<SideData<NDIM, double> > x_sc_data = x_data;
+                for (unsigned int a = 0; a < x_arrays.size(); ++a)
+                {
+                    // The inner products are computed only over the interior
+                    // of the patch, one row of the data at a time.
+                    const Box<NDIM> box = x_sc_data ? SideGeometry<NDIM>::toSideBox(patch_box, a) : patch_box;
+                    const int row_length = box.upper(0) - box.lower(0) + 1;
+                    if (row_length <= 0) continue;
+                    xw_row.resize(row_length);
+                    Box<NDIM> row_start_box = box;
+                    row_start_box.upper(0) = row_start_box.lower(0);
+                    const int depth = x_arrays[a]->getDepth();
+                    for (int d = 0; d < depth; ++d)
+                    {
+                        const int cvol_depth = has_cvol ? (d < cvol_arrays[a]->getDepth() ? d : 0) : 0;
+                        for (Box<NDIM>::Iterator b(row_start_box); b; b++)
+                        {
+                            const Index<NDIM> i = b();
+                            const double* const x_row = x_arrays[a]->getPointer(d) + array_offset(*x_arrays[a], i);
+                            if (has_cvol)
+                            {
+                                const double* const w_row =
+                                    cvol_arrays[a]->getPointer(cvol_depth) + array_offset(*cvol_arrays[a], i);
+                                for (int j = 0; j < row_length; ++j) xw_row[j] = x_row[j] * w_row[j];
+                            }
+                            else
+                            {
+                                std::copy(x_row, x_row + row_length, xw_row.begin());
+                            }
+                            for (PetscInt k = 0; k < nv; ++k)
+                            {
+                                const double* const y_row =
+                                    y_arrays[k][a]->getPointer(d) + array_offset(*y_arrays[k][a], i);
+                                double sum = 0.0;
+                                for (int j = 0; j < row_length; ++j) sum += xw_row[j] * y_row[j];
+                                val[k] += sum;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return;
+} // fused_mdot_local
+
+// Compute y := y + sum_k alpha[k] x[k] over the data of y (including ghost
+// cells) while traversing the data of y only once.
+void
+fused_maxpy(SAMRAIVectorReal<NDIM, double>& y, const PetscInt nv, const PetscScalar* alpha, const Vec* x)
+{
+    Pointer<PatchHierarchy<NDIM> > hierarchy = y.getPatchHierarchy();
+    const int coarsest_ln = y.getCoarsestLevelNumber();
+    const int finest_ln = y.getFinestLevelNumber();
+    const int ncomp = y.getNumberOfComponents();
+    std::vector<ArrayData<NDIM, double>*> y_arrays;
+    std::vector<std::vector<ArrayData<NDIM, double>*> > x_arrays(nv);
+    for (int comp = 0; comp < ncomp; ++comp)
+    {
+        const int y_idx = y.getComponentDescriptorIndex(comp);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                get_arrays(y_arrays, patch->getPatchData(y_idx));
+                for (PetscInt k = 0; k < nv; ++k)
+                {
+                    get_arrays(x_arrays[k], patch->getPatchData(PSVR_CAST2(x[k])->getComponentDescriptorIndex(comp)));
+                }
+                for (unsigned int a = 0; a < y_arrays.size(); ++a)
+                {
+                    // All of the arrays have the same layout, so that they may
+                    // be processed as contiguous blocks of memory.
+                    double* const y_ptr = y_arrays[a]->getPointer();
+                    const int size = y_arrays[a]->getDepth() * y_arrays[a]->getOffset();
+                    for (int chunk_begin = 0; chunk_begin < size; chunk_begin += FUSED_KERNEL_CHUNK_SIZE)
+                    {
+                        const int chunk_end = std::min(chunk_begin + FUSED_KERNEL_CHUNK_SIZE, size);
+                        for (PetscInt k = 0; k < nv; ++k)
+                        {
+                            const double* const x_ptr = x_arrays[k][a]->getPointer();
+                            const double alpha_k = alpha[k];
+                            for (int j = chunk_begin; j < chunk_end; ++j) y_ptr[j] += alpha_k * x_ptr[j];
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return;
+} // fused_maxpy
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -305,10 +547,17 @@ PETScSAMRAIVectorReal::VecMDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscSca
     IBTK_TIMER_START(t_vec_m_dot);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
+    if (use_fused_kernels(*PSVR_CAST2(x), nv, y))
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        fused_mdot_local(*PSVR_CAST2(x), nv, y, val);
+    }
+    else
+    {
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
     }
     SAMRAI_MPI::sumReduction(val, nv);
     IBTK_TIMER_STOP(t_vec_m_dot);
@@ -334,12 +583,9 @@ PETScSAMRAIVectorReal::VecNorm_SAMRAI(Vec x, NormType type, PetscScalar* val)
     }
     else if (type == NORM_1_AND_2)
     {
-        static const bool local_only = true;
-        val[0] = NormOps::L1Norm(PSVR_CAST2(x), local_only);
-        val[1] = NormOps::L2Norm(PSVR_CAST2(x), local_only);
-        val[1] = val[1] * val[1];
-        SAMRAI_MPI::sumReduction(val, 2);
-        val[1] = std::sqrt(val[1]);
+        const NormOps::Norms norms = NormOps::norms(PSVR_CAST2(x));
+        val[0] = norms.L1_norm;
+        val[1] = norms.L2_norm;
     }
     else
     {
@@ -366,10 +612,17 @@ PETScSAMRAIVectorReal::VecMTDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscSc
     IBTK_TIMER_START(t_vec_m_t_dot);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
+    if (use_fused_kernels(*PSVR_CAST2(x), nv, y))
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        fused_mdot_local(*PSVR_CAST2(x), nv, y, val);
+    }
+    else
+    {
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
     }
     SAMRAI_MPI::sumReduction(val, nv);
     IBTK_TIMER_STOP(t_vec_m_t_dot);
@@ -489,7 +742,9 @@ PETScSAMRAIVectorReal::VecMAXPY_SAMRAI(Vec y, PetscInt nv, const PetscScalar* al
     PSVR_CHECK1(y);
     PSVR_CHECKN(x, nv);
     static const bool interior_only = false;
-    for (PetscInt i = 0; i < nv; ++i)
+    const bool fused = use_fused_kernels(*PSVR_CAST2(y), nv, x);
+    if (fused) fused_maxpy(*PSVR_CAST2(y), nv, alpha, x);
+    for (PetscInt i = 0; !fused && i < nv; ++i)
     {
         if (MathUtilities<double>::equalEps(alpha[i], 1.0))
         {
@@ -698,8 +953,9 @@ PETScSAMRAIVectorReal::VecNorm_local_SAMRAI(Vec x, NormType type, PetscScalar* v
     }
     else if (type == NORM_1_AND_2)
     {
-        val[0] = NormOps::L1Norm(PSVR_CAST2(x), local_only);
-        val[1] = NormOps::L2Norm(PSVR_CAST2(x), local_only);
+        const NormOps::Norms norms = NormOps::norms(PSVR_CAST2(x), nullptr, local_only);
+        val[0] = norms.L1_norm;
+        val[1] = norms.L2_norm;
     }
     else
     {
@@ -716,10 +972,17 @@ PETScSAMRAIVectorReal::VecMDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, Pe
     IBTK_TIMER_START(t_vec_m_dot_local);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
+    if (use_fused_kernels(*PSVR_CAST2(x), nv, y))
+    {
+        fused_mdot_local(*PSVR_CAST2(x), nv, y, val);
+    }
+    else
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
     }
     IBTK_TIMER_STOP(t_vec_m_dot_local);
     PetscFunctionReturn(0);
@@ -731,10 +994,17 @@ PETScSAMRAIVectorReal::VecMTDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, P
     IBTK_TIMER_START(t_vec_m_t_dot_local);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
+    if (use_fused_kernels(*PSVR_CAST2(x), nv, y))
+    {
+        fused_mdot_local(*PSVR_CAST2(x), nv, y, val);
+    }
+    else
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
     }
     IBTK_TIMER_STOP(t_vec_m_t_dot_local);
     PetscFunctionReturn(0);
@@ -755,8 +1025,21 @@ PETScSAMRAIVectorReal::VecDotNorm2_SAMRAI(Vec s, Vec t, PetscScalar* dp, PetscSc
 {
     IBTK_TIMER_START(t_vec_dot_norm2);
     PSVR_CHECK2(s, t);
-    *dp = PSVR_CAST2(s)->dot(PSVR_CAST2(t));
-    *nm = PSVR_CAST2(t)->dot(PSVR_CAST2(t));
+    static const bool local_only = true;
+    PetscScalar vals[2];
+    const Vec st[2] = { s, t };
+    if (use_fused_kernels(*PSVR_CAST2(t), 2, st))
+    {
+        fused_mdot_local(*PSVR_CAST2(t), 2, st, vals);
+    }
+    else
+    {
+        vals[0] = PSVR_CAST2(s)->dot(PSVR_CAST2(t), local_only);
+        vals[1] = PSVR_CAST2(t)->dot(PSVR_CAST2(t), local_only);
+    }
+    SAMRAI_MPI::sumReduction(vals, 2);
+    *dp = vals[0];
+    *nm = vals[1];
     IBTK_TIMER_STOP(t_vec_dot_norm2);
     PetscFunctionReturn(0);
 }
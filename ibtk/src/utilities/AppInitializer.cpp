@@ -14,12 +14,14 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibtk/AppInitializer.h"
+#include "ibtk/IBTKInit.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
 #include "VisItDataWriter.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
+#include "tbox/DatabaseBox.h"
 #include "tbox/InputDatabase.h"
 #include "tbox/InputManager.h"
 #include "tbox/NullDatabase.h"
@@ -43,6 +45,61 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Recursively copy the entries of src_db into dst_db, replacing existing
+// entries with the same names.
+void
+override_database(Pointer<Database> dst_db, Pointer<Database> src_db)
+{
+    const Array<std::string> keys = src_db->getAllKeys();
+    for (int k = 0; k < keys.size(); ++k)
+    {
+        const std::string& key = keys[k];
+        if (src_db->isDatabase(key))
+        {
+            Pointer<Database> dst_sub_db =
+                dst_db->isDatabase(key) ? dst_db->getDatabase(key) : dst_db->putDatabase(key);
+            override_database(dst_sub_db, src_db->getDatabase(key));
+        }
+        else if (src_db->isInteger(key))
+        {
+            dst_db->putIntegerArray(key, src_db->getIntegerArray(key));
+        }
+        else if (src_db->isDouble(key))
+        {
+            dst_db->putDoubleArray(key, src_db->getDoubleArray(key));
+        }
+        else if (src_db->isFloat(key))
+        {
+            dst_db->putFloatArray(key, src_db->getFloatArray(key));
+        }
+        else if (src_db->isBool(key))
+        {
+            dst_db->putBoolArray(key, src_db->getBoolArray(key));
+        }
+        else if (src_db->isChar(key))
+        {
+            dst_db->putCharArray(key, src_db->getCharArray(key));
+        }
+        else if (src_db->isString(key))
+        {
+            dst_db->putStringArray(key, src_db->getStringArray(key));
+        }
+        else if (src_db->isDatabaseBox(key))
+        {
+            dst_db->putDatabaseBoxArray(key, src_db->getDatabaseBoxArray(key));
+        }
+        else
+        {
+            TBOX_ERROR("AppInitializer::AppInitializer():\n"
+                       << "  unsupported type of ensemble input override `" << key << "'\n");
+        }
+    }
+    return;
+} // override_database
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 AppInitializer::AppInitializer(int argc, char* argv[], const std::string& default_log_file_name)
@@ -53,15 +110,22 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
                              << "OPTIONS: PETSc command line options; use -help for more information.\n");
     }
 
+    // In ensemble runs, each group of processes writes to its own files and
+    // directories, whose names are suffixed with the group number.
+    const int ensemble_group_num = IBTKInit::getEnsembleGroupNumber();
+    const bool is_ensemble_run = IBTKInit::getNumberOfEnsembleGroups() > 1;
+    const std::string ensemble_suffix = is_ensemble_run ? "_group_" + std::to_string(ensemble_group_num) : "";
+
     // Process command line options.
     const std::string input_filename = argv[1];
     if (argc >= 4)
     {
         // Check whether this appears to be a restarted run.
-        FILE* fstream = (SAMRAI_MPI::getRank() == 0 ? fopen(argv[2], "r") : nullptr);
+        const std::string restart_read_dirname = argv[2] + ensemble_suffix;
+        FILE* fstream = (SAMRAI_MPI::getRank() == 0 ? fopen(restart_read_dirname.c_str(), "r") : nullptr);
         if (SAMRAI_MPI::bcast(fstream ? 1 : 0, 0) == 1)
         {
-            d_restart_read_dirname = argv[2];
+            d_restart_read_dirname = restart_read_dirname;
             d_restart_restore_num = atoi(argv[3]);
             d_is_from_restart = true;
         }
@@ -82,6 +146,18 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
     d_input_db = new InputDatabase("input_db");
     InputManager::getManager()->parseInputFile(input_filename, d_input_db);
 
+    // In ensemble runs, the entries of the database "group_<n>" of the "Ensemble"
+    // section override those of the input database in group n.
+    if (is_ensemble_run && d_input_db->isDatabase("Ensemble"))
+    {
+        Pointer<Database> ensemble_db = d_input_db->getDatabase("Ensemble");
+        const std::string group_db_name = "group_" + std::to_string(ensemble_group_num);
+        if (ensemble_db->isDatabase(group_db_name))
+        {
+            override_database(d_input_db, ensemble_db->getDatabase(group_db_name));
+        }
+    }
+
     // Set custom PETSc options file when one is specified.
     if (d_input_db->keyExists("petsc_options_file"))
     {
@@ -96,8 +172,30 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         main_db = d_input_db->getDatabase("Main");
     }
 
+    // Suffix the output file and directory names in ensemble runs. This is done
+    // in the input database so that application codes see the same names.
+    if (is_ensemble_run)
+    {
+        for (const std::string& key : { "log_file_name",
+                                        "viz_dirname",
+                                        "viz_dump_dirname",
+                                        "viz_write_dirname",
+                                        "restart_dirname",
+                                        "restart_dump_dirname",
+                                        "restart_write_dirname",
+                                        "data_dirname",
+                                        "data_dump_dirname",
+                                        "data_write_dirname" })
+        {
+            if (main_db->isString(key) && !main_db->getString(key).empty())
+            {
+                main_db->putString(key, main_db->getString(key) + ensemble_suffix);
+            }
+        }
+    }
+
     // Configure logging options.
-    std::string log_file_name = default_log_file_name;
+    std::string log_file_name = default_log_file_name.empty() ? "" : default_log_file_name + ensemble_suffix;
     bool log_all_nodes = false;
     if (main_db->keyExists("log_file_name")) log_file_name = main_db->getString("log_file_name");
     if (main_db->keyExists("log_all_nodes")) log_all_nodes = main_db->getBool("log_all_nodes");
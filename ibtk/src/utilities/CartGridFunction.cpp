@@ -20,7 +20,9 @@
 #include "Patch.h"
 #include "PatchHierarchy.h"
 #include "Variable.h"
+#include "tbox/Utilities.h"
 
+#include <ostream>
 #include <string>
 #include <utility>
 
@@ -76,6 +78,25 @@ CartGridFunction::setDataOnPatchLevel(const int data_idx,
     return;
 } // setDataOnPatchLevel
 
+bool
+CartGridFunction::supportsAddDataOnPatch() const
+{
+    return false;
+} // supportsAddDataOnPatch
+
+void
+CartGridFunction::addDataOnPatch(const int /*data_idx*/,
+                                 Pointer<Variable<NDIM> > /*var*/,
+                                 Pointer<Patch<NDIM> > /*patch*/,
+                                 const double /*data_time*/,
+                                 const bool /*initial_time*/,
+                                 Pointer<PatchLevel<NDIM> > /*patch_level*/)
+{
+    TBOX_ERROR(d_object_name << "::addDataOnPatch():\n"
+                             << "  this function does not support accumulating values on a patch.\n");
+    return;
+} // addDataOnPatch
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -99,37 +99,66 @@ CartGridFunctionSet::setDataOnPatchHierarchy(const int data_idx,
 #endif
     const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
     const int finest_ln = (finest_ln_in == -1 ? hierarchy->getFinestLevelNumber() : finest_ln_in);
-    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
-    const int cloned_data_idx = var_db->registerClonedPatchDataIndex(var, data_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!d_fcns.empty());
+#endif
+    std::vector<Pointer<CartGridFunction> > set_fcns, add_fcns;
+    splitFunctions(set_fcns, add_fcns);
+
+    // Functions that can be accumulated patch by patch are evaluated together
+    // in a single traversal of the hierarchy.
+    if (set_fcns.empty())
     {
-        hierarchy->getPatchLevel(ln)->allocatePatchData(cloned_data_idx);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            addDataOnPatchLevel(
+                data_idx, var, hierarchy->getPatchLevel(ln), data_time, initial_time, add_fcns, /*overwrite*/ true);
+        }
+        return;
     }
-    Pointer<HierarchyDataOpsReal<NDIM, double> > hier_data_ops =
+
+    // The remaining functions are each evaluated on the entire hierarchy and
+    // are summed by way of scratch data.
+    set_fcns[0]->setDataOnPatchHierarchy(
+        data_idx, var, hierarchy, data_time, initial_time, coarsest_ln_in, finest_ln_in);
+    if (set_fcns.size() > 1)
+    {
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        const int cloned_data_idx = var_db->registerClonedPatchDataIndex(var, data_idx);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            hierarchy->getPatchLevel(ln)->allocatePatchData(cloned_data_idx);
+        }
+        Pointer<HierarchyDataOpsReal<NDIM, double> > hier_data_ops =
         HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(var,
                                                                          hierarchy,
                                                                          /* get_unique */ true);
-    if (!hier_data_ops)
-    {
-        TBOX_ERROR(d_object_name << "::setDataOnPatchHierarchy():\n"
-                                 << "  unsupported data centering.\n");
-    }
-    hier_data_ops->resetLevels(coarsest_ln, finest_ln);
-#if !defined(NDEBUG)
-    TBOX_ASSERT(!d_fcns.empty());
-#endif
-    d_fcns[0]->setDataOnPatchHierarchy(data_idx, var, hierarchy, data_time, initial_time, coarsest_ln_in, finest_ln_in);
-    for (unsigned int k = 1; k < d_fcns.size(); ++k)
-    {
-        d_fcns[k]->setDataOnPatchHierarchy(
-            cloned_data_idx, var, hierarchy, data_time, initial_time, coarsest_ln_in, finest_ln_in);
-        hier_data_ops->add(data_idx, data_idx, cloned_data_idx);
+        if (!hier_data_ops)
+        {
+            TBOX_ERROR(d_object_name << "::setDataOnPatchHierarchy():\n"
+                                     << "  unsupported data centering.\n");
+        }
+        hier_data_ops->resetLevels(coarsest_ln, finest_ln);
+        for (unsigned int k = 1; k < set_fcns.size(); ++k)
+        {
+            set_fcns[k]->setDataOnPatchHierarchy(
+                cloned_data_idx, var, hierarchy, data_time, initial_time, coarsest_ln_in, finest_ln_in);
+            hier_data_ops->add(data_idx, data_idx, cloned_data_idx);
+        }
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            hierarchy->getPatchLevel(ln)->deallocatePatchData(cloned_data_idx);
+        }
+        var_db->removePatchDataIndex(cloned_data_idx);
     }
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    if (!add_fcns.empty())
     {
-        hierarchy->getPatchLevel(ln)->deallocatePatchData(cloned_data_idx);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            addDataOnPatchLevel(
+                data_idx, var, hierarchy->getPatchLevel(ln), data_time, initial_time, add_fcns, /*overwrite*/ false);
+        }
     }
-    var_db->removePatchDataIndex(cloned_data_idx);
     return;
 } // setDataOnPatchHierarchy
 
@@ -151,16 +180,28 @@ CartGridFunctionSet::setDataOnPatchLevel(const int data_idx,
 #if !defined(NDEBUG)
     TBOX_ASSERT(cc_var || ec_var || fc_var || nc_var || sc_var);
 #endif
-    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
-    const int cloned_data_idx = var_db->registerClonedPatchDataIndex(var, data_idx);
-    level->allocatePatchData(cloned_data_idx);
 #if !defined(NDEBUG)
     TBOX_ASSERT(!d_fcns.empty());
 #endif
-    d_fcns[0]->setDataOnPatchLevel(data_idx, var, level, data_time, initial_time);
-    for (unsigned int k = 1; k < d_fcns.size(); ++k)
+    std::vector<Pointer<CartGridFunction> > set_fcns, add_fcns;
+    splitFunctions(set_fcns, add_fcns);
+    if (set_fcns.empty())
+    {
+        addDataOnPatchLevel(data_idx, var, level, data_time, initial_time, add_fcns, /*overwrite*/ true);
+        return;
+    }
+    set_fcns[0]->setDataOnPatchLevel(data_idx, var, level, data_time, initial_time);
+    if (!add_fcns.empty())
+    {
+        addDataOnPatchLevel(data_idx, var, level, data_time, initial_time, add_fcns, /*overwrite*/ false);
+    }
+    if (set_fcns.size() == 1) return;
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int cloned_data_idx = var_db->registerClonedPatchDataIndex(var, data_idx);
+    level->allocatePatchData(cloned_data_idx);
+    for (unsigned int k = 1; k < set_fcns.size(); ++k)
     {
-        d_fcns[k]->setDataOnPatchLevel(cloned_data_idx, var, level, data_time, initial_time);
+        set_fcns[k]->setDataOnPatchLevel(cloned_data_idx, var, level, data_time, initial_time);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
@@ -230,6 +271,27 @@ CartGridFunctionSet::setDataOnPatch(int data_idx,
 #if !defined(NDEBUG)
     TBOX_ASSERT(cc_var || ec_var || fc_var || nc_var || sc_var);
 #endif
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!d_fcns.empty());
+#endif
+    std::vector<Pointer<CartGridFunction> > set_fcns, add_fcns;
+    splitFunctions(set_fcns, add_fcns);
+    if (set_fcns.size() <= 1)
+    {
+        if (set_fcns.empty())
+        {
+            add_fcns[0]->setDataOnPatch(data_idx, var, patch, data_time, initial_time, patch_level);
+        }
+        else
+        {
+            set_fcns[0]->setDataOnPatch(data_idx, var, patch, data_time, initial_time, patch_level);
+        }
+        for (unsigned int k = set_fcns.empty() ? 1 : 0; k < add_fcns.size(); ++k)
+        {
+            add_fcns[k]->addDataOnPatch(data_idx, var, patch, data_time, initial_time, patch_level);
+        }
+        return;
+    }
     Pointer<PatchData<NDIM> > data = patch->getPatchData(data_idx);
     Pointer<PatchData<NDIM> > cloned_data;
     if (cc_var)
@@ -264,16 +326,13 @@ CartGridFunctionSet::setDataOnPatch(int data_idx,
                                  << "  unsupported data centering.\n");
     }
     cloned_data->setTime(data->getTime());
-#if !defined(NDEBUG)
-    TBOX_ASSERT(!d_fcns.empty());
-#endif
-    d_fcns[0]->setDataOnPatch(data_idx, var, patch, data_time, initial_time, patch_level);
+    set_fcns[0]->setDataOnPatch(data_idx, var, patch, data_time, initial_time, patch_level);
     cloned_data->copy(*data);
     // NOTE: We operate on data_idx instead of cloned_data_idx here because it
     // is not straightforward to add a cloned data index to a single patch.
-    for (unsigned int k = 1; k < d_fcns.size(); ++k)
+    for (unsigned int k = 1; k < set_fcns.size(); ++k)
     {
-        d_fcns[k]->setDataOnPatch(data_idx, var, patch, data_time, initial_time, patch_level);
+        set_fcns[k]->setDataOnPatch(data_idx, var, patch, data_time, initial_time, patch_level);
         if (cc_var)
         {
             Pointer<CellData<NDIM, double> > p_data = data;
@@ -316,9 +375,85 @@ CartGridFunctionSet::setDataOnPatch(int data_idx,
         }
     }
     data->copy(*cloned_data);
+    for (const auto& fcn : add_fcns)
+    {
+        fcn->addDataOnPatch(data_idx, var, patch, data_time, initial_time, patch_level);
+    }
     return;
 } // setDataOnPatch
 
+bool
+CartGridFunctionSet::supportsAddDataOnPatch() const
+{
+    for (const auto& fcn : d_fcns)
+    {
+        if (!fcn->supportsAddDataOnPatch()) return false;
+    }
+    return true;
+} // supportsAddDataOnPatch
+
+void
+CartGridFunctionSet::addDataOnPatch(const int data_idx,
+                                    Pointer<Variable<NDIM> > var,
+                                    Pointer<Patch<NDIM> > patch,
+                                    const double data_time,
+                                    const bool initial_time,
+                                    Pointer<PatchLevel<NDIM> > patch_level)
+{
+    for (const auto& fcn : d_fcns)
+    {
+        fcn->addDataOnPatch(data_idx, var, patch, data_time, initial_time, patch_level);
+    }
+    return;
+} // addDataOnPatch
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+CartGridFunctionSet::splitFunctions(std::vector<Pointer<CartGridFunction> >& set_fcns,
+                                    std::vector<Pointer<CartGridFunction> >& add_fcns) const
+{
+    for (const auto& fcn : d_fcns)
+    {
+        if (fcn->supportsAddDataOnPatch())
+        {
+            add_fcns.push_back(fcn);
+        }
+        else
+        {
+            set_fcns.push_back(fcn);
+        }
+    }
+    return;
+} // splitFunctions
+
+void
+CartGridFunctionSet::addDataOnPatchLevel(const int data_idx,
+                                         Pointer<Variable<NDIM> > var,
+                                         Pointer<PatchLevel<NDIM> > level,
+                                         const double data_time,
+                                         const bool initial_time,
+                                         const std::vector<Pointer<CartGridFunction> >& add_fcns,
+                                         const bool overwrite)
+{
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        for (unsigned int k = 0; k < add_fcns.size(); ++k)
+        {
+            if (overwrite && k == 0)
+            {
+                add_fcns[k]->setDataOnPatch(data_idx, var, patch, data_time, initial_time, level);
+            }
+            else
+            {
+                add_fcns[k]->addDataOnPatch(data_idx, var, patch, data_time, initial_time, level);
+            }
+        }
+    }
+    return;
+} // addDataOnPatchLevel
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -17,12 +17,14 @@
 #include "ibtk/CopyToRootTransaction.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
+#include "Box.h"
 #include "BoxArray.h"
 #include "GridGeometry.h"
 #include "IntVector.h"
 #include "PatchData.h"
 #include "PatchDataFactory.h"
 #include "PatchDescriptor.h"
+#include "ProcessorMapping.h"
 #include "tbox/Pointer.h"
 #include "tbox/Schedule.h"
 #include "tbox/Transaction.h"
@@ -30,15 +32,6 @@
 #include <utility>
 #include <vector>
 
-namespace SAMRAI
-{
-namespace hier
-{
-template <int DIM>
-class Box;
-} // namespace hier
-} // namespace SAMRAI
-
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBTK
@@ -50,7 +43,11 @@ namespace IBTK
 CopyToRootSchedule::CopyToRootSchedule(const int root_proc,
                                        const Pointer<PatchLevel<NDIM> > patch_level,
                                        const int src_patch_data_idx)
-    : d_root_proc(root_proc), d_patch_level(patch_level), d_src_patch_data_idxs(1, src_patch_data_idx)
+    : d_root_proc(root_proc),
+      d_patch_level(patch_level),
+      d_src_patch_data_idxs(1, src_patch_data_idx),
+      d_use_root_box(false),
+      d_root_box()
 {
     commonClassCtor();
     return;
@@ -59,7 +56,25 @@ CopyToRootSchedule::CopyToRootSchedule(const int root_proc,
 CopyToRootSchedule::CopyToRootSchedule(const int root_proc,
                                        const Pointer<PatchLevel<NDIM> > patch_level,
                                        std::vector<int> src_patch_data_idxs)
-    : d_root_proc(root_proc), d_patch_level(patch_level), d_src_patch_data_idxs(std::move(src_patch_data_idxs))
+    : d_root_proc(root_proc),
+      d_patch_level(patch_level),
+      d_src_patch_data_idxs(std::move(src_patch_data_idxs)),
+      d_use_root_box(false),
+      d_root_box()
+{
+    commonClassCtor();
+    return;
+} // CopyToRootSchedule
+
+CopyToRootSchedule::CopyToRootSchedule(const int root_proc,
+                                       const Pointer<PatchLevel<NDIM> > patch_level,
+                                       std::vector<int> src_patch_data_idxs,
+                                       const Box<NDIM>& root_box)
+    : d_root_proc(root_proc),
+      d_patch_level(patch_level),
+      d_src_patch_data_idxs(std::move(src_patch_data_idxs)),
+      d_use_root_box(true),
+      d_root_box(root_box)
 {
     commonClassCtor();
     return;
@@ -87,9 +102,9 @@ CopyToRootSchedule::commonClassCtor()
 {
     Pointer<GridGeometry<NDIM> > grid_geom = d_patch_level->getGridGeometry();
 #if !defined(NDEBUG)
-    TBOX_ASSERT(grid_geom->getDomainIsSingleBox());
+    TBOX_ASSERT(d_use_root_box || grid_geom->getDomainIsSingleBox());
 #endif
-    const Box<NDIM>& domain_box = grid_geom->getPhysicalDomain()[0];
+    const Box<NDIM>& root_box = d_use_root_box ? d_root_box : grid_geom->getPhysicalDomain()[0];
 
     const size_t num_vars = d_src_patch_data_idxs.size();
 
@@ -100,17 +115,35 @@ CopyToRootSchedule::commonClassCtor()
         {
             Pointer<PatchDataFactory<NDIM> > pdat_factory =
                 d_patch_level->getPatchDescriptor()->getPatchDataFactory(d_src_patch_data_idxs[k]);
-            d_root_patch_data[k] = pdat_factory->allocate(domain_box);
+            d_root_patch_data[k] = pdat_factory->allocate(root_box);
         }
     }
 
+    // Determine which processes own patches that touch the root box.  The
+    // boxes are grown by one cell so that data centered on the patch
+    // boundaries are included.
     const int mpi_nodes = SAMRAI_MPI::getNodes();
+    std::vector<bool> src_proc_touches_root_box(mpi_nodes, !d_use_root_box);
+    if (d_use_root_box)
+    {
+        const BoxArray<NDIM>& boxes = d_patch_level->getBoxes();
+        const ProcessorMapping& proc_mapping = d_patch_level->getProcessorMapping();
+        for (int i = 0; i < boxes.getNumberOfBoxes(); ++i)
+        {
+            if (Box<NDIM>::grow(boxes[i], IntVector<NDIM>(1)).intersects(root_box))
+            {
+                src_proc_touches_root_box[proc_mapping.getProcessorAssignment(i)] = true;
+            }
+        }
+    }
+
     for (int src_proc = 0; src_proc < mpi_nodes; ++src_proc)
     {
+        if (!src_proc_touches_root_box[src_proc]) continue;
         for (unsigned int k = 0; k < num_vars; ++k)
         {
             d_schedule.appendTransaction(new CopyToRootTransaction(
-                src_proc, d_root_proc, d_patch_level, d_src_patch_data_idxs[k], d_root_patch_data[k]));
+                src_proc, d_root_proc, d_patch_level, d_src_patch_data_idxs[k], d_root_patch_data[k], root_box));
         }
     }
     return;
@@ -15,8 +15,12 @@
 
 #include "ibtk/CartExtrapPhysBdryOp.h"
 #include "ibtk/CartGridFunction.h"
+#include "ibtk/DiagnosticsCollector.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/InSituAnalysisStrategy.h"
+#include "ibtk/MemoryMonitor.h"
+#include "ibtk/PerformanceMonitor.h"
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
@@ -33,12 +37,17 @@
 #include "CoarsenSchedule.h"
 #include "ComponentSelector.h"
 #include "EdgeData.h"
+#include "EdgeVariable.h"
 #include "FaceData.h"
+#include "FaceVariable.h"
 #include "GriddingAlgorithm.h"
 #include "HierarchyCellDataOpsReal.h"
+#include "HierarchyDataOpsManager.h"
+#include "HierarchyDataOpsReal.h"
 #include "LoadBalancer.h"
 #include "MultiblockDataTranslator.h"
 #include "NodeData.h"
+#include "NodeVariable.h"
 #include "Patch.h"
 #include "PatchData.h"
 #include "PatchHierarchy.h"
@@ -48,6 +57,7 @@
 #include "RefinePatchStrategy.h"
 #include "RefineSchedule.h"
 #include "SideData.h"
+#include "SideVariable.h"
 #include "TagAndInitializeStrategy.h"
 #include "Variable.h"
 #include "VariableContext.h"
@@ -59,9 +69,12 @@
 #include "tbox/PIO.h"
 #include "tbox/Pointer.h"
 #include "tbox/RestartManager.h"
+#include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <deque>
 #include <limits>
 #include <list>
@@ -83,6 +96,16 @@ namespace
 {
 // Version of HierarchyIntegrator restart file data.
 static const int HIERARCHY_INTEGRATOR_VERSION = 1;
+
+// Whether the data of the variable are double-valued and can be manipulated
+// with the SAMRAI hierarchy data operations.
+bool
+is_double_valued(const Pointer<Variable<NDIM> >& var)
+{
+    return Pointer<CellVariable<NDIM, double> >(var) || Pointer<EdgeVariable<NDIM, double> >(var) ||
+           Pointer<FaceVariable<NDIM, double> >(var) || Pointer<NodeVariable<NDIM, double> >(var) ||
+           Pointer<SideVariable<NDIM, double> >(var);
+}
 } // namespace
 
 const std::string HierarchyIntegrator::SYNCH_CURRENT_DATA_ALG = "SYNCH_CURRENT_DATA";
@@ -134,6 +157,7 @@ HierarchyIntegrator::~HierarchyIntegrator()
         RestartManager::getManager()->unregisterRestartItem(d_object_name);
         d_registered_for_restart = false;
     }
+    MemoryMonitor::unregisterReporter(d_memory_reporter_id);
     return;
 } // ~HierarchyIntegrator
 
@@ -217,12 +241,22 @@ HierarchyIntegrator::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hie
         hier_integrators.insert(
             hier_integrators.end(), integrator->d_child_integrators.begin(), integrator->d_child_integrators.end());
     }
+
+    // Report the memory used by the patch data allocated on the hierarchy.
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy = d_hierarchy;
+    d_memory_reporter_id = MemoryMonitor::registerReporter(
+        "Eulerian patch data",
+        [patch_hierarchy]() { return MemoryMonitor::getPatchDataMemory(patch_hierarchy); },
+        d_hierarchy.getPointer());
+    MemoryMonitor::sample();
     return;
 } // initializePatchHierarchy
 
 void
 HierarchyIntegrator::advanceHierarchy(double dt)
 {
+    PerformanceMonitor::ScopedRegion advance_region("HierarchyIntegrator::advanceHierarchy");
+
     const double dt_min = getMinimumTimeStepSize();
     const double dt_max = getMaximumTimeStepSize();
     if (dt < dt_min || dt > dt_max)
@@ -266,9 +300,44 @@ HierarchyIntegrator::advanceHierarchy(double dt)
         if (d_enable_logging)
             plog << d_object_name << "::advanceHierarchy(): regridding prior to timestep " << d_integrator_step << "\n";
         d_regridding_hierarchy = true;
+        PerformanceMonitor::ScopedRegion regrid_region("HierarchyIntegrator::regridHierarchy");
+        const auto regrid_start = std::chrono::steady_clock::now();
         regridHierarchy();
+        const std::chrono::duration<double> regrid_time = std::chrono::steady_clock::now() - regrid_start;
         d_regridding_hierarchy = false;
         d_at_regrid_time_step = true;
+
+        // Record the cost of the regrid operation and restart the measurement
+        // of the step times used to determine the adaptive regrid interval.
+        if (d_adaptive_regrid_interval)
+        {
+            if (d_enable_logging && d_last_regrid_cost >= 0.0)
+                plog << d_object_name << "::advanceHierarchy(): regridding after "
+                     << d_integrator_step - d_last_regrid_step << " timesteps; previous regrid cost "
+                     << d_last_regrid_cost << " s, accumulated step time excess " << d_cumulative_step_excess
+                     << " s\n";
+            d_last_regrid_cost = SAMRAI_MPI::maxReduction(regrid_time.count());
+            d_last_regrid_step = d_integrator_step;
+            d_num_timed_steps = 0;
+            d_min_step_time = std::numeric_limits<double>::max();
+            d_last_step_excess = 0.0;
+            d_cumulative_step_excess = 0.0;
+        }
+    }
+    const auto step_start = std::chrono::steady_clock::now();
+
+    // Reset the patch data allocation counters.
+    std::deque<HierarchyIntegrator*> hier_integrators(1, this);
+    if (d_audit_patch_data_allocations)
+    {
+        while (!hier_integrators.empty())
+        {
+            HierarchyIntegrator* integrator = hier_integrators.front();
+            integrator->d_num_patch_data_allocations = 0;
+            hier_integrators.pop_front();
+            hier_integrators.insert(
+                hier_integrators.end(), integrator->d_child_integrators.begin(), integrator->d_child_integrators.end());
+        }
     }
 
     // Determine the number of cycles and the time step size.
@@ -278,11 +347,15 @@ HierarchyIntegrator::advanceHierarchy(double dt)
     // Execute the preprocessing method of the parent integrator, and
     // recursively execute all preprocessing callbacks registered with the
     // parent and child integrators.
-    preprocessIntegrateHierarchy(current_time, new_time, d_current_num_cycles);
+    {
+        PerformanceMonitor::ScopedRegion preprocess_region("HierarchyIntegrator::preprocessIntegrateHierarchy");
+        preprocessIntegrateHierarchy(current_time, new_time, d_current_num_cycles);
+    }
 
     // Perform one or more cycles.  In each cycle, execute the integration
     // method of the parent integrator, and recursively execute all integration
     // callbacks registered with the parent and child integrators.
+    const bool dt_error_control = d_dt_error_tolerance > 0.0 || d_dt_error_abs_tolerance > 0.0;
     if (d_enable_logging) plog << d_object_name << "::advanceHierarchy(): integrating hierarchy\n";
     for (int cycle_num = 0; cycle_num < d_current_num_cycles; ++cycle_num)
     {
@@ -291,18 +364,61 @@ HierarchyIntegrator::advanceHierarchy(double dt)
             plog << d_object_name << "::advanceHierarchy(): executing cycle " << cycle_num + 1 << " of "
                  << d_current_num_cycles << "\n";
         }
+        PerformanceMonitor::ScopedRegion integrate_region("HierarchyIntegrator::integrateHierarchy");
         integrateHierarchy(current_time, new_time, cycle_num);
+        if (dt_error_control && cycle_num == 0 && d_current_num_cycles > 1) storePredictedStateData();
+    }
+
+    // Estimate the error of the time step by the difference between the
+    // predicted state (the state after the first cycle) and the corrected
+    // state, normalized by the tolerance, and select the size of the next time
+    // step for a first-order estimate, for which the local error scales like
+    // dt^2.  The time step is never repeated: a time step whose error exceeds
+    // the tolerance is kept, and only the next time step size is reduced (via
+    // getMaximumTimeStepSize()), so that the time step size passed by the
+    // caller is always the one that is taken.
+    if (dt_error_control && d_current_num_cycles < 2)
+    {
+        IBTK_DO_ONCE({
+            pout << d_object_name << "::advanceHierarchy():\n"
+                 << "  WARNING: the time step size is not error-controlled because num_cycles = "
+                 << d_current_num_cycles << "\n";
+        });
+    }
+    else if (dt_error_control)
+    {
+        const double error = computeStateErrorEstimate(d_dt_error_tolerance, d_dt_error_abs_tolerance);
+        const double dt_factor =
+            error > 0.0 ? d_dt_error_safety_factor / std::sqrt(error) : std::numeric_limits<double>::max();
+        d_dt_error_control = std::max(0.2, std::min(std::max(1.0, d_dt_growth_factor), dt_factor)) * d_current_dt;
+        d_dt_error_control = std::max(d_dt_error_control, d_dt_min);
+        if (d_enable_logging)
+        {
+            plog << d_object_name << "::advanceHierarchy(): estimated error / tolerance = " << error
+                 << ", error-controlled dt = " << d_dt_error_control << "\n";
+            if (error > 1.0)
+                plog << d_object_name << "::advanceHierarchy(): time step with dt = " << d_current_dt
+                     << " exceeds the error tolerance; reducing the next time step size\n";
+        }
     }
 
     // Execute the postprocessing method of the parent integrator, and
     // recursively execute all postprocessing callbacks registered with the
     // parent and child integrators.
     static const bool skip_synchronize_new_state_data = true;
-    postprocessIntegrateHierarchy(current_time, new_time, skip_synchronize_new_state_data, d_current_num_cycles);
+    {
+        PerformanceMonitor::ScopedRegion postprocess_region("HierarchyIntegrator::postprocessIntegrateHierarchy");
+        postprocessIntegrateHierarchy(current_time, new_time, skip_synchronize_new_state_data, d_current_num_cycles);
+    }
+
+    // Start the reduction of the scalar diagnostics computed by this
+    // integrator and all of its child integrators.
+    DiagnosticsCollector& diagnostics_collector = getDiagnosticsCollector();
+    diagnostics_collector.startReduction();
 
     // Ensure that the current values of num_cycles, cycle_num, and dt are
     // reset.
-    std::deque<HierarchyIntegrator*> hier_integrators(1, this);
+    hier_integrators.assign(1, this);
     while (!hier_integrators.empty())
     {
         HierarchyIntegrator* integrator = hier_integrators.front();
@@ -314,14 +430,69 @@ HierarchyIntegrator::advanceHierarchy(double dt)
             hier_integrators.end(), integrator->d_child_integrators.begin(), integrator->d_child_integrators.end());
     }
 
+    // Complete the reduction of the scalar diagnostics.
+    diagnostics_collector.finishReduction();
+
     // Synchronize the updated data.
     if (d_enable_logging) plog << d_object_name << "::advanceHierarchy(): synchronizing updated data\n";
-    synchronizeHierarchyData(NEW_DATA);
+    {
+        PerformanceMonitor::ScopedRegion synchronize_region("HierarchyIntegrator::synchronizeHierarchyData");
+        synchronizeHierarchyData(NEW_DATA);
+    }
 
     // Reset all time dependent data.
     if (d_enable_logging) plog << d_object_name << "::advanceHierarchy(): resetting time dependent data\n";
     resetTimeDependentHierarchyData(new_time);
 
+    // Report the number of patch data arrays allocated during the time step.
+    if (d_audit_patch_data_allocations)
+    {
+        int num_allocations = 0;
+        hier_integrators.assign(1, this);
+        while (!hier_integrators.empty())
+        {
+            HierarchyIntegrator* integrator = hier_integrators.front();
+            num_allocations += integrator->d_num_patch_data_allocations;
+            hier_integrators.pop_front();
+            hier_integrators.insert(
+                hier_integrators.end(), integrator->d_child_integrators.begin(), integrator->d_child_integrators.end());
+        }
+        num_allocations = SAMRAI_MPI::sumReduction(num_allocations);
+        plog << d_object_name << "::advanceHierarchy(): allocated " << num_allocations
+             << " patch data arrays during timestep " << d_integrator_step - 1
+             << (d_at_regrid_time_step ? " (excluding regridding)\n" : "\n");
+    }
+
+    // Update the step time measurements used to determine the adaptive regrid
+    // interval.  The step time is maximized over all processes so that it
+    // reflects the load imbalance.
+    if (d_adaptive_regrid_interval)
+    {
+        const std::chrono::duration<double> step_time = std::chrono::steady_clock::now() - step_start;
+        const double max_step_time = SAMRAI_MPI::maxReduction(step_time.count());
+        d_min_step_time = std::min(d_min_step_time, max_step_time);
+        d_last_step_excess = max_step_time - d_min_step_time;
+        d_cumulative_step_excess += d_last_step_excess;
+        ++d_num_timed_steps;
+    }
+
+    // Execute the in situ analyses that are due at this time step.
+    bool plot_data_ready = false;
+    for (const auto& analysis_interval : d_in_situ_analyses)
+    {
+        if (d_integrator_step % analysis_interval.second != 0) continue;
+        PerformanceMonitor::ScopedRegion analysis_region("HierarchyIntegrator::executeInSituAnalysis");
+        if (!plot_data_ready)
+        {
+            setupPlotData();
+            plot_data_ready = true;
+        }
+        analysis_interval.first->execute(d_hierarchy, d_integrator_time, d_integrator_step);
+    }
+
+    // Update the memory high-water marks.
+    MemoryMonitor::sample();
+
     // Reset the regrid indicator.
     d_at_regrid_time_step = false;
     return;
@@ -346,6 +517,7 @@ HierarchyIntegrator::getMaximumTimeStepSize()
     {
         dt = std::min(dt, child_integrator->getMaximumTimeStepSize());
     }
+    dt = std::min(dt, d_dt_error_control);
     return std::min(dt, d_end_time - d_integrator_time);
 } // getMaximumTimeStepSize
 
@@ -448,6 +620,13 @@ HierarchyIntegrator::regridHierarchy()
 
     // Synchronize the state data on the patch hierarchy.
     synchronizeHierarchyData(CURRENT_DATA);
+
+    // Report the memory usage after regridding.
+    if (MemoryMonitor::isEnabled())
+    {
+        MemoryMonitor::sample();
+        if (d_enable_logging) MemoryMonitor::printUsage(plog);
+    }
     return;
 } // regridHierarchy
 
@@ -572,6 +751,21 @@ HierarchyIntegrator::getVisItDataWriter() const
     return d_visit_writer;
 }
 
+void
+HierarchyIntegrator::registerInSituAnalysis(Pointer<InSituAnalysisStrategy> analysis, const int interval)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(analysis);
+#endif
+    if (interval <= 0)
+    {
+        TBOX_ERROR(d_object_name << "::registerInSituAnalysis():\n"
+                                 << "  invalid interval " << interval << "; the interval must be positive\n");
+    }
+    d_in_situ_analyses.push_back(std::make_pair(analysis, interval));
+    return;
+} // registerInSituAnalysis
+
 void
 HierarchyIntegrator::setupPlotData()
 {
@@ -776,7 +970,7 @@ HierarchyIntegrator::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM>
         d_fill_after_regrid_prolong_alg
             .createSchedule(level, old_level, level_number - 1, hierarchy, &fill_after_regrid_patch_strategy_set)
             ->fillData(init_data_time);
-        level->deallocatePatchData(d_scratch_data);
+        if (!d_keep_scratch_data_allocated) level->deallocatePatchData(d_scratch_data);
     }
 
     // Initialize level data at the initial time.
@@ -1001,7 +1195,39 @@ HierarchyIntegrator::allocatePatchData(const int data_idx, const double data_tim
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        if (!level->checkAllocated(data_idx)) level->allocatePatchData(data_idx, data_time);
+        if (!level->checkAllocated(data_idx))
+        {
+            level->allocatePatchData(data_idx, data_time);
+            ++d_num_patch_data_allocations;
+        }
+    }
+    return;
+} // allocatePatchData
+
+void
+HierarchyIntegrator::allocatePatchData(const ComponentSelector& data,
+                                       const double data_time,
+                                       int coarsest_ln,
+                                       int finest_ln) const
+{
+    if (coarsest_ln == -1) coarsest_ln = 0;
+    if (finest_ln == -1) finest_ln = d_hierarchy->getFinestLevelNumber();
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (int data_idx = 0; data_idx < data.getSize(); ++data_idx)
+        {
+            if (!data.isSet(data_idx)) continue;
+            if (level->checkAllocated(data_idx))
+            {
+                level->setTime(data_time, data_idx);
+            }
+            else
+            {
+                level->allocatePatchData(data_idx, data_time);
+                ++d_num_patch_data_allocations;
+            }
+        }
     }
     return;
 } // allocatePatchData
@@ -1026,6 +1252,12 @@ HierarchyIntegrator::getHierarchyMathOps() const
     return d_hier_math_ops;
 } // HierarchyMathOps
 
+DiagnosticsCollector&
+HierarchyIntegrator::getDiagnosticsCollector() const
+{
+    return d_parent_integrator ? d_parent_integrator->getDiagnosticsCollector() : d_diagnostics_collector;
+} // getDiagnosticsCollector
+
 void
 HierarchyIntegrator::registerVariable(int& current_idx,
                                       int& new_idx,
@@ -1150,6 +1382,7 @@ HierarchyIntegrator::putToDatabase(Pointer<Database> db)
     db->putDouble("d_dt_min", d_dt_min);
     db->putDouble("d_dt_max", d_dt_max);
     db->putDouble("d_dt_growth_factor", d_dt_growth_factor);
+    db->putDouble("d_dt_error_control", d_dt_error_control);
     db->putInteger("d_integrator_step", d_integrator_step);
     db->putInteger("d_max_integrator_steps", d_max_integrator_steps);
     db->putInteger("d_num_cycles", d_num_cycles);
@@ -1258,6 +1491,7 @@ HierarchyIntegrator::resetTimeDependentHierarchyDataSpecialized(const double new
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         level->setTime(d_integrator_time, d_current_data);
+        if (d_keep_scratch_data_allocated) continue;
         level->deallocatePatchData(d_scratch_data);
         level->deallocatePatchData(d_new_data);
     }
@@ -1275,8 +1509,11 @@ HierarchyIntegrator::resetIntegratorToPreadvanceStateSpecialized()
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_scratch_data);
-        level->deallocatePatchData(d_new_data);
+        if (!d_keep_scratch_data_allocated)
+        {
+            level->deallocatePatchData(d_scratch_data);
+            level->deallocatePatchData(d_new_data);
+        }
         level->setTime(d_integrator_time, d_current_data);
     }
     return;
@@ -1295,11 +1532,31 @@ HierarchyIntegrator::atRegridPointSpecialized() const
         //
         // Subsequently, regrid according to the regrid interval.
         const bool initial_time = MathUtilities<double>::equalEps(d_integrator_time, d_start_time);
-        return initial_time ||
-               ((d_integrator_step > 0) && (d_regrid_interval != 0) && (d_integrator_step % d_regrid_interval == 0));
+        if (initial_time) return true;
+        if (d_adaptive_regrid_interval) return atAdaptiveRegridPoint();
+        return (d_integrator_step > 0) && (d_regrid_interval != 0) && (d_integrator_step % d_regrid_interval == 0);
     }
 } // atRegridPointSpecialized
 
+bool
+HierarchyIntegrator::atAdaptiveRegridPoint() const
+{
+    const int num_steps = d_integrator_step - d_last_regrid_step;
+    if (num_steps < d_min_regrid_interval) return false;
+    if (d_max_regrid_interval > 0 && num_steps >= d_max_regrid_interval) return true;
+
+    // Use the fixed regrid interval until the cost of regridding is known.
+    if (d_last_regrid_cost < 0.0 || d_num_timed_steps == 0)
+    {
+        return (d_integrator_step > 0) && (d_regrid_interval != 0) && (d_integrator_step % d_regrid_interval == 0);
+    }
+
+    // Regrid once the excess cost of the most recent time step exceeds the
+    // average cost per time step of regridding now, i.e., once the average cost
+    // per time step of the current regrid cycle would begin to increase.
+    return d_num_timed_steps * d_last_step_excess >= d_last_regrid_cost + d_cumulative_step_excess;
+} // atAdaptiveRegridPoint
+
 void
 HierarchyIntegrator::setupPlotDataSpecialized()
 {
@@ -1614,6 +1871,10 @@ HierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_restart)
     if (db->keyExists("max_integrator_steps")) d_max_integrator_steps = db->getInteger("max_integrator_steps");
     if (db->keyExists("num_cycles")) d_num_cycles = db->getInteger("num_cycles");
     if (db->keyExists("regrid_interval")) d_regrid_interval = db->getInteger("regrid_interval");
+    if (db->keyExists("adaptive_regrid_interval"))
+        d_adaptive_regrid_interval = db->getBool("adaptive_regrid_interval");
+    if (db->keyExists("min_regrid_interval")) d_min_regrid_interval = db->getInteger("min_regrid_interval");
+    if (db->keyExists("max_regrid_interval")) d_max_regrid_interval = db->getInteger("max_regrid_interval");
     if (db->keyExists("regrid_mode")) d_regrid_mode = string_to_enum<RegridMode>(db->getString("regrid_mode"));
     if (db->keyExists("enable_logging"))
     {
@@ -1629,9 +1890,70 @@ HierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_restart)
     }
     if (db->keyExists("bdry_extrap_type")) d_bdry_extrap_type = db->getString("bdry_extrap_type");
     if (db->keyExists("tag_buffer")) d_tag_buffer = db->getIntegerArray("tag_buffer");
+    if (db->keyExists("keep_scratch_data_allocated"))
+        d_keep_scratch_data_allocated = db->getBool("keep_scratch_data_allocated");
+    if (db->keyExists("audit_patch_data_allocations"))
+        d_audit_patch_data_allocations = db->getBool("audit_patch_data_allocations");
+    if (db->keyExists("dt_error_tolerance")) d_dt_error_tolerance = db->getDouble("dt_error_tolerance");
+    if (db->keyExists("dt_error_abs_tolerance")) d_dt_error_abs_tolerance = db->getDouble("dt_error_abs_tolerance");
+    if (db->keyExists("dt_error_safety_factor")) d_dt_error_safety_factor = db->getDouble("dt_error_safety_factor");
     return;
 } // getFromInput
 
+void
+HierarchyIntegrator::storePredictedStateData()
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    for (const auto& var : d_state_variables)
+    {
+        if (!is_double_valued(var)) continue;
+        const int new_idx = var_db->mapVariableAndContextToIndex(var, getNewContext());
+        auto it = d_predicted_state_idxs.find(var.getPointer());
+        if (it == d_predicted_state_idxs.end())
+        {
+            const int predicted_idx = var_db->registerClonedPatchDataIndex(var, new_idx);
+            it = d_predicted_state_idxs.insert(std::make_pair(var.getPointer(), predicted_idx)).first;
+        }
+        const int predicted_idx = it->second;
+        if (!isAllocatedPatchData(predicted_idx)) allocatePatchData(predicted_idx, d_integrator_time);
+        Pointer<HierarchyDataOpsReal<NDIM, double> > hier_data_ops =
+            HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(var, d_hierarchy, true);
+        hier_data_ops->copyData(predicted_idx, new_idx);
+    }
+    for (const auto& child_integrator : d_child_integrators)
+    {
+        child_integrator->storePredictedStateData();
+    }
+    return;
+} // storePredictedStateData
+
+double
+HierarchyIntegrator::computeStateErrorEstimate(const double rel_tol, const double abs_tol)
+{
+    double error = 0.0;
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    for (const auto& var : d_state_variables)
+    {
+        const auto it = d_predicted_state_idxs.find(var.getPointer());
+        if (it == d_predicted_state_idxs.end() || !isAllocatedPatchData(it->second)) continue;
+        const int new_idx = var_db->mapVariableAndContextToIndex(var, getNewContext());
+        const int predicted_idx = it->second;
+        Pointer<HierarchyDataOpsReal<NDIM, double> > hier_data_ops =
+            HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(var, d_hierarchy, true);
+        hier_data_ops->subtract(predicted_idx, new_idx, predicted_idx);
+        const double diff_norm = hier_data_ops->maxNorm(predicted_idx);
+        const double scale = abs_tol + rel_tol * hier_data_ops->maxNorm(new_idx);
+        deallocatePatchData(predicted_idx);
+        if (diff_norm == 0.0) continue;
+        error = std::max(error, scale > 0.0 ? diff_norm / scale : std::numeric_limits<double>::max());
+    }
+    for (const auto& child_integrator : d_child_integrators)
+    {
+        error = std::max(error, child_integrator->computeStateErrorEstimate(rel_tol, abs_tol));
+    }
+    return error;
+} // computeStateErrorEstimate
+
 void
 HierarchyIntegrator::getFromRestart()
 {
@@ -1668,10 +1990,12 @@ HierarchyIntegrator::getFromRestart()
     d_dt_min = db->getDoubleWithDefault("d_dt_min", 0.0);
     d_dt_max = db->getDouble("d_dt_max");
     d_dt_growth_factor = db->getDouble("d_dt_growth_factor");
+    d_dt_error_control = db->getDoubleWithDefault("d_dt_error_control", std::numeric_limits<double>::max());
     d_integrator_step = db->getInteger("d_integrator_step");
     d_max_integrator_steps = db->getInteger("d_max_integrator_steps");
     d_num_cycles = db->getInteger("d_num_cycles");
     d_regrid_interval = db->getInteger("d_regrid_interval");
+    d_last_regrid_step = d_integrator_step;
     d_regrid_mode = string_to_enum<RegridMode>(db->getString("d_regrid_mode"));
     d_enable_logging = db->getBool("d_enable_logging");
     d_enable_logging_solver_iterations = db->getBool("d_enable_logging_solver_iterations");
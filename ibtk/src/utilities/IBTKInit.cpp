@@ -17,10 +17,26 @@
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/app_namespaces.h"
 
+#include <cstdlib>
+
 namespace IBTK
 {
 /////////////////////////////// STATIC //////////////////////////////////////
 bool IBTKInit::s_initialized = false;
+int IBTKInit::s_ensemble_group_num = 0;
+int IBTKInit::s_num_ensemble_groups = 1;
+MPI_Comm IBTKInit::s_ensemble_world_communicator = MPI_COMM_WORLD;
+
+namespace
+{
+void
+finalize_mpi()
+{
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if (!finalized) MPI_Finalize();
+}
+} // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 IBTKInit::IBTKInit(int argc, char** argv, MPI_Comm communicator, char* petsc_file, char* petsc_help)
@@ -34,7 +50,8 @@ IBTKInit::IBTKInit(int argc, char** argv, MPI_Comm communicator, char* petsc_fil
     NULL_USE(petsc_file);
     NULL_USE(petsc_help);
 #else
-    // We need to initialize PETSc.
+    // We need to initialize PETSc on the given communicator.
+    PETSC_COMM_WORLD = communicator;
     PetscInitialize(&argc, &argv, petsc_file, petsc_help);
 #endif
 #if SAMRAI_VERSION_MAJOR > 2
@@ -51,6 +68,60 @@ IBTKInit::IBTKInit(int argc, char** argv, MPI_Comm communicator, char* petsc_fil
     s_initialized = true;
 }
 
+MPI_Comm
+IBTKInit::splitEnsembleCommunicator(const int num_groups, MPI_Comm world_communicator)
+{
+    if (s_initialized) TBOX_ERROR("The ensemble communicator must be split before IBAMR is initialized.\n");
+
+    // MPI must be initialized before the communicator can be split. In that
+    // case, libMesh and PETSc do not finalize MPI, so we do it at exit, after
+    // the IBTKInit object has been destroyed.
+    int mpi_initialized = 0;
+    MPI_Initialized(&mpi_initialized);
+    if (!mpi_initialized)
+    {
+        MPI_Init(nullptr, nullptr);
+        std::atexit(finalize_mpi);
+    }
+
+    int rank = 0, nprocs = 0;
+    MPI_Comm_rank(world_communicator, &rank);
+    MPI_Comm_size(world_communicator, &nprocs);
+    if (num_groups < 1 || num_groups > nprocs)
+    {
+        TBOX_ERROR("IBTKInit::splitEnsembleCommunicator():\n"
+                   << "  the number of ensemble groups must be between 1 and the number of processes (" << nprocs
+                   << "), but is " << num_groups << "\n");
+    }
+
+    // Assign blocks of consecutive ranks of (nearly) equal size to the groups.
+    const int group_num = static_cast<int>((static_cast<long>(rank) * num_groups) / nprocs);
+    MPI_Comm group_communicator;
+    MPI_Comm_split(world_communicator, group_num, rank, &group_communicator);
+    s_ensemble_group_num = group_num;
+    s_num_ensemble_groups = num_groups;
+    s_ensemble_world_communicator = world_communicator;
+    return group_communicator;
+}
+
+int
+IBTKInit::getEnsembleGroupNumber()
+{
+    return s_ensemble_group_num;
+}
+
+int
+IBTKInit::getNumberOfEnsembleGroups()
+{
+    return s_num_ensemble_groups;
+}
+
+MPI_Comm
+IBTKInit::getEnsembleWorldCommunicator()
+{
+    return s_ensemble_world_communicator;
+}
+
 IBTKInit::~IBTKInit()
 {
     pout << "IBTKInit destructor called. Shutting down libraries.\n";
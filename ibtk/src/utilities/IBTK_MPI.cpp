@@ -20,6 +20,7 @@
 #include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
 
+#include <cstddef>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -101,6 +102,59 @@ IBTK_MPI::recvBytes(void* buf, int number_bytes, IBTK_MPI::comm communicator)
     return rval;
 } // recvBytes
 
+IBTK_MPI::comm
+IBTK_MPI::createNeighborCommunicator(const std::vector<int>& neighbors, IBTK_MPI::comm communicator)
+{
+    IBTK_MPI::comm neighbor_communicator = MPI_COMM_NULL;
+    const int degree = static_cast<int>(neighbors.size());
+    MPI_Dist_graph_create_adjacent(communicator,
+                                   degree,
+                                   neighbors.data(),
+                                   MPI_UNWEIGHTED,
+                                   degree,
+                                   neighbors.data(),
+                                   MPI_UNWEIGHTED,
+                                   MPI_INFO_NULL,
+                                   /*reorder*/ 0,
+                                   &neighbor_communicator);
+    return neighbor_communicator;
+} // createNeighborCommunicator
+
+IBTK_MPI::RequestSet::~RequestSet()
+{
+    waitAll();
+} // ~RequestSet
+
+void
+IBTK_MPI::RequestSet::add(IBTK_MPI::request request)
+{
+    if (request != MPI_REQUEST_NULL) d_requests.push_back(request);
+} // add
+
+bool
+IBTK_MPI::RequestSet::testAll()
+{
+    if (d_requests.empty()) return true;
+    int flag = 0;
+    MPI_Testall(static_cast<int>(d_requests.size()), d_requests.data(), &flag, MPI_STATUSES_IGNORE);
+    if (flag) d_requests.clear();
+    return flag != 0;
+} // testAll
+
+void
+IBTK_MPI::RequestSet::waitAll()
+{
+    if (d_requests.empty()) return;
+    MPI_Waitall(static_cast<int>(d_requests.size()), d_requests.data(), MPI_STATUSES_IGNORE);
+    d_requests.clear();
+} // waitAll
+
+std::size_t
+IBTK_MPI::RequestSet::size() const
+{
+    return d_requests.size();
+} // size
+
 //////////////////////////////////////  PRIVATE  ///////////////////////////////////////////////////
 
 void
@@ -0,0 +1,77 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/InSituAnalysisStrategy.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+#include "tbox/Utilities.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+InSituAnalysisStrategy::InSituAnalysisStrategy(std::string object_name) : d_object_name(std::move(object_name))
+{
+    // intentionally blank
+    return;
+} // InSituAnalysisStrategy
+
+void
+InSituAnalysisStrategy::registerPlotQuantity(const std::string& name,
+                                             const std::string& type,
+                                             const int data_idx,
+                                             const int depth_start)
+{
+    if (type != "SCALAR" && type != "VECTOR" && type != "TENSOR")
+    {
+        TBOX_ERROR(d_object_name << "::registerPlotQuantity():\n"
+                                 << "  unsupported type " << type << " for quantity " << name << "\n"
+                                 << "  valid types are SCALAR, VECTOR, and TENSOR\n");
+    }
+    for (const auto& plot_quantity : d_plot_quantities)
+    {
+        if (plot_quantity.name == name)
+        {
+            TBOX_ERROR(d_object_name << "::registerPlotQuantity():\n"
+                                     << "  quantity " << name << " has already been registered\n");
+        }
+    }
+    d_plot_quantities.push_back(PlotQuantity{ name, type, data_idx, depth_start });
+    return;
+} // registerPlotQuantity
+
+const std::vector<InSituAnalysisStrategy::PlotQuantity>&
+InSituAnalysisStrategy::getPlotQuantities() const
+{
+    return d_plot_quantities;
+} // getPlotQuantities
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
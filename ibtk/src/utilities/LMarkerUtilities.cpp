@@ -30,6 +30,7 @@
 #include "BasePatchLevel.h"
 #include "Box.h"
 #include "BoxArray.h"
+#include "BoxList.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
@@ -107,6 +108,80 @@ discard_comments(const std::string& input_string)
     string_stream.clear();
     return output_string;
 } // discard_comments
+
+// Determine the position of a marker relative to the patch that stores it.
+inline Point
+get_shifted_position(const LMarker& mark, const double* const dx)
+{
+    const Point& X = mark.getPosition();
+    const IntVector<NDIM>& offset = mark.getPeriodicOffset();
+    Point X_shifted;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        X_shifted[d] = X[d] + static_cast<double>(offset(d)) * dx[d];
+    }
+    return X_shifted;
+} // get_shifted_position
+
+// Determine whether a position lies within the extents of a patch.
+inline bool
+patch_owns_position(const CartesianPatchGeometry<NDIM>& patch_geom, const Point& X)
+{
+    const double* const patchXLower = patch_geom.getXLower();
+    const double* const patchXUpper = patch_geom.getXUpper();
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (X[d] < patchXLower[d] || patchXUpper[d] <= X[d]) return false;
+    }
+    return true;
+} // patch_owns_position
+
+// Determine whether a cell index (or its periodic image within the domain) is
+// covered by the boxes of a level.
+bool
+level_covers_index(const BoxArray<NDIM>& level_boxes,
+                   hier::Index<NDIM> i,
+                   const IntVector<NDIM>& periodic_shift,
+                   const Box<NDIM>& domain_box)
+{
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (periodic_shift(d) == 0) continue;
+        while (i(d) < domain_box.lower()(d)) i(d) += periodic_shift(d);
+        while (i(d) > domain_box.upper()(d)) i(d) -= periodic_shift(d);
+    }
+    for (int k = 0; k < level_boxes.getNumberOfBoxes(); ++k)
+    {
+        if (level_boxes[k].contains(i)) return true;
+    }
+    return false;
+} // level_covers_index
+
+// Append a marker to the specified cell of the destination data.
+inline void
+append_marker(LMarkerSetData& dst_mark_data, const hier::Index<NDIM>& i, const LMarkerSet::value_type& mark)
+{
+    if (!dst_mark_data.isElement(i))
+    {
+        dst_mark_data.appendItemPointer(i, new LMarkerSet());
+    }
+    dst_mark_data.getItem(i)->push_back(mark);
+    return;
+} // append_marker
+
+// Append the markers in the specified cell of the source data to the
+// destination data.
+inline void
+append_marker_set(LMarkerSetData& dst_mark_data, const hier::Index<NDIM>& i, const LMarkerSet& src_mark_set)
+{
+    if (!dst_mark_data.isElement(i))
+    {
+        dst_mark_data.appendItemPointer(i, new LMarkerSet());
+    }
+    LMarkerSet& dst_mark_set = *(dst_mark_data.getItem(i));
+    dst_mark_set.insert(dst_mark_set.end(), src_mark_set.begin(), src_mark_set.end());
+    return;
+} // append_marker_set
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -614,6 +689,183 @@ LMarkerUtilities::collectMarkersOnPatchHierarchy(const int mark_idx, Pointer<Pat
     return;
 } // collectMarkersOnPatchHierarchy
 
+void
+LMarkerUtilities::migrateMarkers(const int mark_idx, Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+
+    const unsigned int num_marks_before_migration = countMarkers(mark_idx, hierarchy);
+
+    // Allocate scratch data used to transfer markers between levels.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<Variable<NDIM> > var;
+    var_db->mapIndexToVariable(mark_idx, var);
+    int mark_scratch_idx = var_db->registerClonedPatchDataIndex(var, mark_idx);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        hierarchy->getPatchLevel(ln)->allocatePatchData(mark_scratch_idx);
+    }
+    Pointer<RefineAlgorithm<NDIM> > mark_level_fill_alg = new RefineAlgorithm<NDIM>();
+    mark_level_fill_alg->registerRefine(mark_idx, mark_idx, mark_idx, nullptr);
+    Pointer<CoarsenAlgorithm<NDIM> > mark_coarsen_alg = new CoarsenAlgorithm<NDIM>();
+    mark_coarsen_alg->registerCoarsen(mark_scratch_idx, mark_scratch_idx, new LMarkerCoarsen());
+    Pointer<RefineAlgorithm<NDIM> > mark_refine_alg = new RefineAlgorithm<NDIM>();
+    mark_refine_alg->registerRefine(mark_scratch_idx, mark_scratch_idx, mark_scratch_idx, new LMarkerRefine());
+    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+
+    // Exchange markers among neighboring patches of each level, starting from
+    // the finest level.  Markers that have left the region covered by a level
+    // are coarsened onto the next coarser level before that level is
+    // processed.
+    for (int ln = finest_ln; ln >= coarsest_ln; --ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        const IntVector<NDIM>& ratio = level->getRatio();
+        const BoxArray<NDIM>& level_boxes = level->getBoxes();
+        const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(ratio);
+        const Box<NDIM> domain_box = Box<NDIM>::refine(BoxList<NDIM>(grid_geom->getPhysicalDomain()).getBoundingBox(), ratio);
+
+        // Copy the markers of neighboring patches into the ghost cells of each
+        // patch, and keep the markers whose positions lie within the patch.
+        mark_level_fill_alg->createSchedule(level, nullptr)->fillData(0.0);
+        int num_departed_marks = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+            const double* const patchDx = patch_geom->getDx();
+
+            Pointer<LMarkerSetData> mark_data = patch->getPatchData(mark_idx);
+            Pointer<LMarkerSetData> mark_scratch_data = patch->getPatchData(mark_scratch_idx);
+            mark_scratch_data->removeAllItems();
+            Pointer<LMarkerSetData> mark_data_new =
+                new LMarkerSetData(mark_data->getBox(), mark_data->getGhostCellWidth());
+            for (LMarkerSetData::SetIterator it(*mark_data); it; it++)
+            {
+                const hier::Index<NDIM>& i = it.getIndex();
+                for (const auto& mark : *it)
+                {
+                    const Point X_shifted = get_shifted_position(*mark, patchDx);
+                    if (patch_owns_position(*patch_geom, X_shifted))
+                    {
+                        append_marker(*mark_data_new, IndexUtilities::getCellIndex(X_shifted, grid_geom, ratio), mark);
+                    }
+                    else if (ln > coarsest_ln && patch_box.contains(i) &&
+                             !level_covers_index(level_boxes,
+                                                 IndexUtilities::getCellIndex(X_shifted, grid_geom, ratio),
+                                                 periodic_shift,
+                                                 domain_box))
+                    {
+                        // Only the patch that stored the marker before the
+                        // exchange transfers it to the next coarser level.
+                        append_marker(*mark_scratch_data, i, mark);
+                        ++num_departed_marks;
+                    }
+                }
+            }
+
+            // Swap the old and new patch data pointers.
+            patch->setPatchData(mark_idx, mark_data_new);
+        }
+
+        // Merge the markers that have left this level into the data on the next
+        // coarser level.
+        if (ln == coarsest_ln || SAMRAI_MPI::sumReduction(num_departed_marks) == 0) continue;
+        Pointer<PatchLevel<NDIM> > coarser_level = hierarchy->getPatchLevel(ln - 1);
+        for (PatchLevel<NDIM>::Iterator p(coarser_level); p; p++)
+        {
+            Pointer<LMarkerSetData> mark_scratch_data = coarser_level->getPatch(p())->getPatchData(mark_scratch_idx);
+            mark_scratch_data->removeAllItems();
+        }
+        CoarsenPatchStrategy<NDIM>* mark_coarsen_op = nullptr;
+        mark_coarsen_alg->createSchedule(coarser_level, level, mark_coarsen_op)->coarsenData();
+        for (PatchLevel<NDIM>::Iterator p(coarser_level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = coarser_level->getPatch(p());
+            Pointer<LMarkerSetData> mark_data = patch->getPatchData(mark_idx);
+            Pointer<LMarkerSetData> mark_scratch_data = patch->getPatchData(mark_scratch_idx);
+            for (LMarkerSetData::SetIterator it(*mark_scratch_data); it; it++)
+            {
+                append_marker_set(*mark_data, it.getIndex(), *it);
+            }
+        }
+    }
+
+    // Refine markers that have entered the region covered by the next finer
+    // level onto that level, starting from the coarsest level.
+    for (int ln = coarsest_ln; ln < finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        Pointer<PatchLevel<NDIM> > finer_level = hierarchy->getPatchLevel(ln + 1);
+        BoxArray<NDIM> refined_region_boxes = finer_level->getBoxes();
+        refined_region_boxes.coarsen(finer_level->getRatioToCoarserLevel());
+        int num_arrived_marks = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<LMarkerSetData> mark_data = patch->getPatchData(mark_idx);
+            Pointer<LMarkerSetData> mark_scratch_data = patch->getPatchData(mark_scratch_idx);
+            mark_scratch_data->removeAllItems();
+            for (int k = 0; k < refined_region_boxes.getNumberOfBoxes(); ++k)
+            {
+                const Box<NDIM> intersection = patch_box * refined_region_boxes[k];
+                if (intersection.empty()) continue;
+                for (LMarkerSetData::SetIterator it(*mark_data); it; it++)
+                {
+                    const hier::Index<NDIM>& i = it.getIndex();
+                    if (!intersection.contains(i)) continue;
+                    append_marker_set(*mark_scratch_data, i, *it);
+                    num_arrived_marks += static_cast<int>(it().size());
+                }
+                mark_data->removeInsideBox(intersection);
+            }
+        }
+        if (SAMRAI_MPI::sumReduction(num_arrived_marks) == 0) continue;
+        for (PatchLevel<NDIM>::Iterator p(finer_level); p; p++)
+        {
+            Pointer<LMarkerSetData> mark_scratch_data = finer_level->getPatch(p())->getPatchData(mark_scratch_idx);
+            mark_scratch_data->removeAllItems();
+        }
+        RefinePatchStrategy<NDIM>* refine_mark_op = nullptr;
+        mark_refine_alg->createSchedule(finer_level, nullptr, ln, hierarchy, refine_mark_op)->fillData(0.0);
+        for (PatchLevel<NDIM>::Iterator p(finer_level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = finer_level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<LMarkerSetData> mark_data = patch->getPatchData(mark_idx);
+            Pointer<LMarkerSetData> mark_scratch_data = patch->getPatchData(mark_scratch_idx);
+            for (LMarkerSetData::SetIterator it(*mark_scratch_data); it; it++)
+            {
+                const hier::Index<NDIM>& i = it.getIndex();
+                if (patch_box.contains(i)) append_marker_set(*mark_data, i, *it);
+            }
+        }
+    }
+
+    // Deallocate scratch data.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        hierarchy->getPatchLevel(ln)->deallocatePatchData(mark_scratch_idx);
+    }
+    var_db->removePatchDataIndex(mark_scratch_idx);
+    mark_scratch_idx = -1;
+
+    // Ensure that the total number of markers is correct.
+    const unsigned int num_marks_after_migration = countMarkers(mark_idx, hierarchy);
+    if (num_marks_before_migration != num_marks_after_migration)
+    {
+        TBOX_ERROR("LMarkerUtilities::migrateMarkers()\n"
+                   << "  number of marker particles changed during migration\n"
+                   << "  number of markers in hierarchy before migration = " << num_marks_before_migration << "\n"
+                   << "  number of markers in hierarchy after  migration = " << num_marks_after_migration << "\n"
+                   << "  markers may have moved farther than the ghost cell width of the marker data\n");
+    }
+    return;
+} // migrateMarkers
+
 void
 LMarkerUtilities::initializeMarkersOnLevel(const int mark_idx,
                                            const std::vector<Point>& mark_init_posns,
@@ -0,0 +1,323 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/IBTK_CHKERRQ.h"
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/MemoryMonitor.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+#include "Patch.h"
+#include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "tbox/Pointer.h"
+
+#include "petscmat.h"
+#include "petscsys.h"
+#include "petscvec.h"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+bool MemoryMonitor::s_enabled = false;
+
+namespace
+{
+// The names of the categories that are not provided by registered reporters.
+const std::string PETSC_CATEGORY = "PETSc allocations";
+const std::string RSS_CATEGORY = "resident set size";
+
+// The usage of a category on this process.
+struct CategoryUsage
+{
+    double current;
+    double peak;
+};
+
+// A registered reporter.
+struct ReporterEntry
+{
+    std::string category;
+    const void* key;
+    MemoryMonitor::Reporter reporter;
+};
+
+std::map<int, ReporterEntry>&
+get_reporters()
+{
+    static std::map<int, ReporterEntry> reporters;
+    return reporters;
+} // get_reporters
+
+std::map<std::string, CategoryUsage>&
+get_usage()
+{
+    static std::map<std::string, CategoryUsage> usage;
+    return usage;
+} // get_usage
+
+int next_reporter_id = 0;
+
+// Print the usage of all categories recorded on any process.
+void
+print_table(std::ostream& os, const bool peak)
+{
+    // Gather the names of the categories recorded on all processes.
+    std::string local_buffer;
+    for (const auto& category : get_usage()) local_buffer += category.first + "\n";
+    const int nodes = IBTK_MPI::getNodes();
+    int local_size = static_cast<int>(local_buffer.size());
+    std::vector<int> sizes(nodes), offsets(nodes + 1, 0);
+    MPI_Allgather(&local_size, 1, MPI_INT, sizes.data(), 1, MPI_INT, IBTK_MPI::getCommunicator());
+    for (int k = 0; k < nodes; ++k) offsets[k + 1] = offsets[k] + sizes[k];
+    std::vector<char> buffer(std::max(offsets[nodes], 1));
+    MPI_Allgatherv(&local_buffer[0],
+                   local_size,
+                   MPI_CHAR,
+                   buffer.data(),
+                   sizes.data(),
+                   offsets.data(),
+                   MPI_CHAR,
+                   IBTK_MPI::getCommunicator());
+    std::set<std::string> categories;
+    std::string category;
+    for (int k = 0; k < offsets[nodes]; ++k)
+    {
+        if (buffer[k] != '\n')
+        {
+            category += buffer[k];
+            continue;
+        }
+        categories.insert(category);
+        category.clear();
+    }
+
+    // Reduce the usage of each category.  The categories are ordered
+    // alphabetically, except that the process-wide numbers come last.
+    std::vector<std::string> names;
+    for (const auto& name : categories)
+    {
+        if (name != PETSC_CATEGORY && name != RSS_CATEGORY) names.push_back(name);
+    }
+    if (categories.count(PETSC_CATEGORY)) names.push_back(PETSC_CATEGORY);
+    if (categories.count(RSS_CATEGORY)) names.push_back(RSS_CATEGORY);
+    const int num_categories = static_cast<int>(names.size());
+    std::vector<double> min_bytes(num_categories, 0.0), max_bytes(num_categories, 0.0), sum_bytes(num_categories, 0.0);
+    for (int k = 0; k < num_categories; ++k)
+    {
+        const auto it = get_usage().find(names[k]);
+        if (it == get_usage().end()) continue;
+        min_bytes[k] = max_bytes[k] = sum_bytes[k] = peak ? it->second.peak : it->second.current;
+    }
+    MPI_Allreduce(MPI_IN_PLACE, min_bytes.data(), num_categories, MPI_DOUBLE, MPI_MIN, IBTK_MPI::getCommunicator());
+    MPI_Allreduce(MPI_IN_PLACE, max_bytes.data(), num_categories, MPI_DOUBLE, MPI_MAX, IBTK_MPI::getCommunicator());
+    MPI_Allreduce(MPI_IN_PLACE, sum_bytes.data(), num_categories, MPI_DOUBLE, MPI_SUM, IBTK_MPI::getCommunicator());
+
+    const double MB = 1024.0 * 1024.0;
+    os << std::left << std::setw(40) << "category" << std::right << std::setw(14) << "min [MB]" << std::setw(14)
+       << "avg [MB]" << std::setw(14) << "max [MB]" << std::setw(14) << "total [MB]"
+       << "\n";
+    const std::ios_base::fmtflags flags = os.flags();
+    for (int k = 0; k < num_categories; ++k)
+    {
+        os << std::left << std::setw(40) << names[k] << std::right << std::fixed << std::setprecision(2)
+           << std::setw(14) << min_bytes[k] / MB << std::setw(14) << sum_bytes[k] / nodes / MB << std::setw(14)
+           << max_bytes[k] / MB << std::setw(14) << sum_bytes[k] / MB << "\n";
+        os.flags(flags);
+    }
+    return;
+} // print_table
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+MemoryMonitor::setEnabled(const bool enabled)
+{
+    s_enabled = enabled;
+    return;
+} // setEnabled
+
+int
+MemoryMonitor::registerReporter(const std::string& category, Reporter reporter, const void* const key)
+{
+    const int reporter_id = next_reporter_id++;
+    get_reporters()[reporter_id] = ReporterEntry{ category, key, std::move(reporter) };
+    return reporter_id;
+} // registerReporter
+
+void
+MemoryMonitor::unregisterReporter(const int reporter_id)
+{
+    get_reporters().erase(reporter_id);
+    return;
+} // unregisterReporter
+
+void
+MemoryMonitor::sample()
+{
+    if (!s_enabled) return;
+
+    // Sum the reporters of each category, skipping reporters whose keys have
+    // already been encountered in that category.
+    std::map<std::string, double> current;
+    std::set<std::pair<std::string, const void*> > keys;
+    for (const auto& id_entry : get_reporters())
+    {
+        const ReporterEntry& entry = id_entry.second;
+        if (entry.key && !keys.insert(std::make_pair(entry.category, entry.key)).second) continue;
+        current[entry.category] += static_cast<double>(entry.reporter());
+    }
+    PetscLogDouble petsc_bytes = 0.0, rss_bytes = 0.0;
+    int ierr = PetscMallocGetCurrentUsage(&petsc_bytes);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscMemoryGetCurrentUsage(&rss_bytes);
+    IBTK_CHKERRQ(ierr);
+    if (petsc_bytes > 0.0) current[PETSC_CATEGORY] = petsc_bytes;
+    if (rss_bytes > 0.0) current[RSS_CATEGORY] = rss_bytes;
+
+    // Update the current usage and the high-water marks.  Categories whose
+    // reporters have all been unregistered keep their high-water marks.
+    for (auto& usage : get_usage()) usage.second.current = 0.0;
+    for (const auto& category : current)
+    {
+        auto it = get_usage().find(category.first);
+        if (it == get_usage().end())
+        {
+            get_usage()[category.first] = CategoryUsage{ category.second, category.second };
+        }
+        else
+        {
+            it->second.current = category.second;
+            it->second.peak = std::max(it->second.peak, category.second);
+        }
+    }
+    return;
+} // sample
+
+void
+MemoryMonitor::reset()
+{
+    get_usage().clear();
+    return;
+} // reset
+
+void
+MemoryMonitor::printUsage(std::ostream& os)
+{
+    os << "MemoryMonitor usage per process over " << IBTK_MPI::getNodes() << " processes:\n";
+    print_table(os, /*peak*/ false);
+    return;
+} // printUsage
+
+void
+MemoryMonitor::printSummary(std::ostream& os)
+{
+    os << "MemoryMonitor high-water marks per process over " << IBTK_MPI::getNodes() << " processes:\n";
+    print_table(os, /*peak*/ true);
+    return;
+} // printSummary
+
+std::size_t
+MemoryMonitor::getPatchDataMemory(Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    std::size_t bytes = 0;
+    if (!hierarchy) return bytes;
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        Pointer<PatchDescriptor<NDIM> > patch_descriptor = level->getPatchDescriptor();
+        const int num_components = patch_descriptor->getMaxNumberRegisteredComponents();
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            for (int data_idx = 0; data_idx < num_components; ++data_idx)
+            {
+                if (!patch->checkAllocated(data_idx)) continue;
+                bytes += patch_descriptor->getPatchDataFactory(data_idx)->getSizeOfMemory(patch->getBox());
+            }
+        }
+    }
+    return bytes;
+} // getPatchDataMemory
+
+std::size_t
+MemoryMonitor::getPatchDataMemory(Pointer<PatchHierarchy<NDIM> > hierarchy, const int data_idx)
+{
+    std::size_t bytes = 0;
+    if (!hierarchy) return bytes;
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(data_idx)) continue;
+        Pointer<PatchDataFactory<NDIM> > pdat_factory = level->getPatchDescriptor()->getPatchDataFactory(data_idx);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            bytes += pdat_factory->getSizeOfMemory(level->getPatch(p())->getBox());
+        }
+    }
+    return bytes;
+} // getPatchDataMemory
+
+std::size_t
+MemoryMonitor::getVecMemory(Vec vec)
+{
+    if (!vec) return 0;
+    Vec local_vec = nullptr;
+    int ierr = VecGhostGetLocalForm(vec, &local_vec);
+    IBTK_CHKERRQ(ierr);
+    PetscInt local_size = 0;
+    ierr = VecGetLocalSize(local_vec ? local_vec : vec, &local_size);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostRestoreLocalForm(vec, &local_vec);
+    IBTK_CHKERRQ(ierr);
+    return static_cast<std::size_t>(local_size) * sizeof(PetscScalar);
+} // getVecMemory
+
+std::size_t
+MemoryMonitor::getMatMemory(Mat mat)
+{
+    if (!mat) return 0;
+    MatInfo info;
+    int ierr = MatGetInfo(mat, MAT_LOCAL, &info);
+    IBTK_CHKERRQ(ierr);
+    return static_cast<std::size_t>(info.memory);
+} // getMatMemory
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -127,9 +127,13 @@ NodeDataSynchronization::initializeOperatorState(
     }
 
     // Setup cached refine algorithms and schedules.
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    d_refine_algs.resize(d_finest_ln + 1);
+    d_refine_scheds.resize(d_finest_ln + 1);
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        d_refine_alg[axis] = new RefineAlgorithm<NDIM>();
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        const IntVector<NDIM>& periodic_shift = d_grid_geom->getPeriodicShift(level->getRatio());
+        d_refine_algs[ln] = new RefineAlgorithm<NDIM>();
         for (const auto& transaction_comp : d_transaction_comps)
         {
             const int data_idx = transaction_comp.d_data_idx;
@@ -142,20 +146,15 @@ NodeDataSynchronization::initializeOperatorState(
                            << "  only double-precision node-centered data is supported." << std::endl);
             }
             Pointer<RefineOperator<NDIM> > refine_op = nullptr;
-            Pointer<VariableFillPattern<NDIM> > fill_pattern = new NodeSynchCopyFillPattern(axis);
-            d_refine_alg[axis]->registerRefine(data_idx, // destination
-                                               data_idx, // source
-                                               data_idx, // temporary work space
-                                               refine_op,
-                                               fill_pattern);
-        }
-
-        d_refine_scheds[axis].resize(d_finest_ln + 1);
-        for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-        {
-            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-            d_refine_scheds[axis][ln] = d_refine_alg[axis]->createSchedule(level);
+            Pointer<VariableFillPattern<NDIM> > fill_pattern =
+                new NodeSynchCopyFillPattern(level->getBoxes(), periodic_shift);
+            d_refine_algs[ln]->registerRefine(data_idx, // destination
+                                              data_idx, // source
+                                              data_idx, // temporary work space
+                                              refine_op,
+                                              fill_pattern);
         }
+        d_refine_scheds[ln] = d_refine_algs[ln]->createSchedule(level);
     }
 
     // Indicate the operator is initialized.
@@ -231,9 +230,11 @@ NodeDataSynchronization::resetTransactionComponents(
     }
 
     // Reset cached refine algorithms and schedules.
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        d_refine_alg[axis] = new RefineAlgorithm<NDIM>();
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        const IntVector<NDIM>& periodic_shift = d_grid_geom->getPeriodicShift(level->getRatio());
+        d_refine_algs[ln] = new RefineAlgorithm<NDIM>();
         for (const auto& transaction_comp : d_transaction_comps)
         {
             const int data_idx = transaction_comp.d_data_idx;
@@ -246,18 +247,15 @@ NodeDataSynchronization::resetTransactionComponents(
                            << "  only double-precision node-centered data is supported." << std::endl);
             }
             Pointer<RefineOperator<NDIM> > refine_op = nullptr;
-            Pointer<VariableFillPattern<NDIM> > fill_pattern = new NodeSynchCopyFillPattern(axis);
-            d_refine_alg[axis]->registerRefine(data_idx, // destination
-                                               data_idx, // source
-                                               data_idx, // temporary work space
-                                               refine_op,
-                                               fill_pattern);
-        }
-
-        for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-        {
-            d_refine_alg[axis]->resetSchedule(d_refine_scheds[axis][ln]);
+            Pointer<VariableFillPattern<NDIM> > fill_pattern =
+                new NodeSynchCopyFillPattern(level->getBoxes(), periodic_shift);
+            d_refine_algs[ln]->registerRefine(data_idx, // destination
+                                              data_idx, // source
+                                              data_idx, // temporary work space
+                                              refine_op,
+                                              fill_pattern);
         }
+        d_refine_algs[ln]->resetSchedule(d_refine_scheds[ln]);
     }
     return;
 } // resetTransactionComponents
@@ -271,11 +269,8 @@ NodeDataSynchronization::deallocateOperatorState()
     d_coarsen_alg.setNull();
     d_coarsen_scheds.clear();
 
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        d_refine_alg[axis].setNull();
-        d_refine_scheds[axis].clear();
-    }
+    d_refine_algs.clear();
+    d_refine_scheds.clear();
 
     // Indicate that the operator is NOT initialized.
     d_is_initialized = false;
@@ -290,13 +285,8 @@ NodeDataSynchronization::synchronizeData(const double fill_time)
 #endif
     for (int ln = d_finest_ln; ln >= d_coarsest_ln; --ln)
     {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-
         // Synchronize data on the current level.
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            d_refine_scheds[axis][ln]->fillData(fill_time);
-        }
+        d_refine_scheds[ln]->fillData(fill_time);
 
         // When appropriate, coarsen data from the current level to the next
         // coarser level.
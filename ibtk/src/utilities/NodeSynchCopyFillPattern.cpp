@@ -17,12 +17,17 @@
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
 #include "Box.h"
+#include "BoxArray.h"
 #include "BoxGeometry.h"
+#include "BoxList.h"
+#include "Index.h"
+#include "IntVector.h"
 #include "NodeGeometry.h"
 #include "NodeOverlap.h"
 #include "tbox/Pointer.h"
 
 #include <string>
+#include <vector>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -33,6 +38,60 @@ namespace IBTK
 namespace
 {
 static const std::string PATTERN_NAME = "NODE_SYNCH_COPY_FILL_PATTERN";
+
+// Collect the given boxes and, in the periodic directions, their periodic
+// images.
+std::vector<Box<NDIM> >
+get_periodic_images(const BoxArray<NDIM>& boxes, const IntVector<NDIM>& periodic_shift)
+{
+    Box<NDIM> shift_box(IntVector<NDIM>(0), IntVector<NDIM>(0));
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (periodic_shift(d) != 0)
+        {
+            shift_box.lower(d) = -1;
+            shift_box.upper(d) = +1;
+        }
+    }
+    std::vector<Box<NDIM> > images;
+    for (int k = 0; k < boxes.getNumberOfBoxes(); ++k)
+    {
+        for (Box<NDIM>::Iterator s(shift_box); s; s++)
+        {
+            IntVector<NDIM> shift;
+            for (unsigned int d = 0; d < NDIM; ++d) shift(d) = s()(d) * periodic_shift(d);
+            images.push_back(Box<NDIM>::shift(boxes[k], shift));
+        }
+    }
+    return images;
+} // get_periodic_images
+
+// Determine whether a patch owns the value at index i, where upper_dirs is the
+// set of directions in which i lies on an upper boundary of the patch and
+// shared_dirs is the set of directions in which the value is shared across
+// patch boundaries.  Another patch that contains the value with a smaller set
+// of upper boundary directions m contains the cell i - m.
+bool
+is_owner(const hier::Index<NDIM>& i,
+         const unsigned int upper_dirs,
+         const unsigned int shared_dirs,
+         const std::vector<Box<NDIM> >& nbr_boxes)
+{
+    for (unsigned int m = 0; m < upper_dirs; ++m)
+    {
+        if ((m & ~shared_dirs) != 0) continue;
+        hier::Index<NDIM> cell = i;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            if (m & (1U << d)) cell(d) -= 1;
+        }
+        for (const auto& box : nbr_boxes)
+        {
+            if (box.contains(cell)) return false;
+        }
+    }
+    return true;
+} // is_owner
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -43,6 +102,14 @@ NodeSynchCopyFillPattern::NodeSynchCopyFillPattern(const unsigned int axis) : d_
     return;
 } // NodeSynchCopyFillPattern
 
+NodeSynchCopyFillPattern::NodeSynchCopyFillPattern(const BoxArray<NDIM>& level_boxes,
+                                                   const IntVector<NDIM>& periodic_shift)
+    : d_axis(NDIM), d_level_boxes(get_periodic_images(level_boxes, periodic_shift))
+{
+    // intentionally blank
+    return;
+} // NodeSynchCopyFillPattern
+
 Pointer<BoxOverlap<NDIM> >
 NodeSynchCopyFillPattern::calculateOverlap(const BoxGeometry<NDIM>& dst_geometry,
                                            const BoxGeometry<NDIM>& src_geometry,
@@ -63,6 +130,45 @@ NodeSynchCopyFillPattern::calculateOverlap(const BoxGeometry<NDIM>& dst_geometry
     TBOX_ASSERT(t_dst_geometry);
 #endif
     BoxList<NDIM> dst_boxes;
+    if (d_axis == NDIM)
+    {
+        // Copy the nodes on the upper boundaries of the destination patch that
+        // are owned by the source patch.  Periodic images of the source patch
+        // are treated like any other neighboring patch.
+        auto const t_src_geometry = dynamic_cast<const NodeGeometry<NDIM>*>(&src_geometry);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(t_src_geometry);
+#endif
+        const Box<NDIM>& dst_box = t_dst_geometry->getBox();
+        const Box<NDIM> dst_node_box = NodeGeometry<NDIM>::toNodeBox(dst_box);
+        const Box<NDIM> src_box = Box<NDIM>::shift(t_src_geometry->getBox(), src_offset);
+        const Box<NDIM> nbr_region = Box<NDIM>::grow(dst_box, IntVector<NDIM>(1));
+        std::vector<Box<NDIM> > nbr_boxes;
+        for (const auto& box : d_level_boxes)
+        {
+            if (box.intersects(nbr_region)) nbr_boxes.push_back(box);
+        }
+        const unsigned int all_dirs = (1U << NDIM) - 1;
+        const BoxList<NDIM>& box_geom_overlap_boxes = box_geom_overlap->getDestinationBoxList();
+        for (BoxList<NDIM>::Iterator it(box_geom_overlap_boxes); it; it++)
+        {
+            for (Box<NDIM>::Iterator b(dst_node_box * it()); b; b++)
+            {
+                const hier::Index<NDIM>& i = b();
+                unsigned int dst_upper_dirs = 0, src_upper_dirs = 0;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    if (i(d) == dst_node_box.upper(d)) dst_upper_dirs |= 1U << d;
+                    if (i(d) == src_box.upper(d) + 1) src_upper_dirs |= 1U << d;
+                }
+                if (dst_upper_dirs == 0 || !is_owner(i, src_upper_dirs, all_dirs, nbr_boxes)) continue;
+                dst_boxes.appendItem(Box<NDIM>(i, i));
+            }
+        }
+        dst_boxes.coalesceBoxes();
+        return new NodeOverlap<NDIM>(dst_boxes, src_offset);
+    }
+
     bool skip = false;
     for (unsigned int d = 0; d < NDIM && !skip; ++d)
     {
@@ -13,11 +13,15 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/IBTK_MPI.h"
 #include "ibtk/NormOps.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
+#include "ArrayData.h"
+#include "Box.h"
 #include "CellData.h"
 #include "CellVariable.h"
+#include "Index.h"
 #include "IntVector.h"
 #include "Patch.h"
 #include "PatchCellDataNormOpsReal.h"
@@ -27,9 +31,13 @@
 #include "PatchSideDataNormOpsReal.h"
 #include "SAMRAIVectorReal.h"
 #include "SideData.h"
+#include "SideGeometry.h"
 #include "SideVariable.h"
 #include "tbox/Pointer.h"
 #include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
+
+#include <mpi.h>
 
 #include <algorithm>
 #include <cmath>
@@ -44,8 +52,6 @@ namespace hier
 {
 template <int DIM>
 class Variable;
-template <int DIM>
-class Box;
 } // namespace hier
 } // namespace SAMRAI
 
@@ -74,6 +80,122 @@ accurate_sum_of_squares(std::vector<double>& vec)
     std::sort(vec.begin(), vec.end(), std::less<double>());
     return std::inner_product(vec.begin(), vec.end(), vec.begin(), 0.0);
 } // accurate_sum_of_squares
+
+// The number of independent partial sums in which the contributions of
+// contiguous data are accumulated. This allows the loops to be vectorized and
+// reduces the growth of the roundoff error of long sums.
+constexpr int NUM_LANES = 4;
+
+struct LaneSums
+{
+    double L1[NUM_LANES] = {};
+    double L2[NUM_LANES] = {};
+    double dot[NUM_LANES] = {};
+    double max[NUM_LANES] = {};
+};
+
+// Position of the given index in the storage of the given (ghost) box.
+inline int
+array_offset(const Box<NDIM>& box, const hier::Index<NDIM>& i)
+{
+    int offset = 0, stride = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        offset += (i(d) - box.lower(d)) * stride;
+        stride *= box.numberCells(d);
+    }
+    return offset;
+} // array_offset
+
+template <bool has_y, bool has_cvol>
+inline void
+accumulate_value(const double x, const double y, const double cvol, const int lane, LaneSums& sums)
+{
+    const double w = has_cvol ? cvol : 1.0;
+    const double a = std::abs(x);
+    sums.L1[lane] += w * a;
+    sums.L2[lane] += w * a * a;
+    if (has_y) sums.dot[lane] += w * x * y;
+    // As in SAMRAI, entries with zero control volume do not contribute to the
+    // max-norm.
+    sums.max[lane] = std::max(sums.max[lane], (!has_cvol || w > 0.0) ? a : 0.0);
+    return;
+} // accumulate_value
+
+template <bool has_y, bool has_cvol>
+inline void
+accumulate_line(const double* const x, const double* const y, const double* const cvol, const int n, LaneSums& sums)
+{
+    int k = 0;
+    for (; k + NUM_LANES <= n; k += NUM_LANES)
+    {
+        for (int l = 0; l < NUM_LANES; ++l)
+        {
+            accumulate_value<has_y, has_cvol>(
+                x[k + l], has_y ? y[k + l] : 0.0, has_cvol ? cvol[k + l] : 0.0, l, sums);
+        }
+    }
+    for (; k < n; ++k)
+    {
+        accumulate_value<has_y, has_cvol>(x[k], has_y ? y[k] : 0.0, has_cvol ? cvol[k] : 0.0, k % NUM_LANES, sums);
+    }
+    return;
+} // accumulate_line
+
+// Accumulate the contributions of the entries of x in the given box one line in
+// the first coordinate direction at a time. The entries of each line are
+// contiguous in all arrays.
+template <bool has_y, bool has_cvol>
+void
+accumulate_box(const ArrayData<NDIM, double>& x_data,
+               const ArrayData<NDIM, double>* const y_data,
+               const ArrayData<NDIM, double>* const cvol_data,
+               const Box<NDIM>& box,
+               LaneSums& sums)
+{
+    const int n0 = box.numberCells(0);
+    Box<NDIM> line_starts = box;
+    line_starts.upper(0) = line_starts.lower(0);
+    const int depth = x_data.getDepth();
+    for (int d = 0; d < depth; ++d)
+    {
+        const double* const x = x_data.getPointer(d);
+        const double* const y = has_y ? y_data->getPointer(d) : nullptr;
+        const double* const cvol =
+            has_cvol ? cvol_data->getPointer(cvol_data->getDepth() == depth ? d : 0) : nullptr;
+        for (Box<NDIM>::Iterator b(line_starts); b; b++)
+        {
+            const hier::Index<NDIM>& i = b();
+            accumulate_line<has_y, has_cvol>(x + array_offset(x_data.getBox(), i),
+                                             has_y ? y + array_offset(y_data->getBox(), i) : nullptr,
+                                             has_cvol ? cvol + array_offset(cvol_data->getBox(), i) : nullptr,
+                                             n0,
+                                             sums);
+        }
+    }
+    return;
+} // accumulate_box
+
+void
+accumulate_box(const ArrayData<NDIM, double>& x_data,
+               const ArrayData<NDIM, double>* const y_data,
+               const ArrayData<NDIM, double>* const cvol_data,
+               const Box<NDIM>& box,
+               LaneSums& sums)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!y_data || y_data->getDepth() == x_data.getDepth());
+#endif
+    if (y_data && cvol_data)
+        accumulate_box<true, true>(x_data, y_data, cvol_data, box, sums);
+    else if (y_data)
+        accumulate_box<true, false>(x_data, y_data, cvol_data, box, sums);
+    else if (cvol_data)
+        accumulate_box<false, true>(x_data, y_data, cvol_data, box, sums);
+    else
+        accumulate_box<false, false>(x_data, y_data, cvol_data, box, sums);
+    return;
+} // accumulate_box
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -110,6 +232,48 @@ NormOps::maxNorm(const SAMRAIVectorReal<NDIM, double>* const samrai_vector, cons
     return samrai_vector->maxNorm(local_only);
 } // maxNorm
 
+NormOps::Norms
+NormOps::norms(const SAMRAIVectorReal<NDIM, double>* const x,
+               const SAMRAIVectorReal<NDIM, double>* const y,
+               const bool local_only)
+{
+    std::vector<double> L1_sum_patch, L2_sum_patch, dot_sum_patch;
+    double max_norm_local = 0.0;
+    computeLocalSums(x, y, L1_sum_patch, L2_sum_patch, dot_sum_patch, max_norm_local);
+    const int num_values = 4;
+    double local_values[num_values] = {
+        accurate_sum(L1_sum_patch), accurate_sum(L2_sum_patch), accurate_sum(dot_sum_patch), max_norm_local
+    };
+    Norms ret_val;
+    if (local_only)
+    {
+        ret_val.L1_norm = local_values[0];
+        ret_val.L2_norm = std::sqrt(local_values[1]);
+        ret_val.dot = local_values[2];
+        ret_val.max_norm = local_values[3];
+        return ret_val;
+    }
+
+    // Gather all local values with a single collective operation, and sum them
+    // in the same order on every process (as in L1Norm() and L2Norm()).
+    const int nprocs = IBTK_MPI::getNodes();
+    std::vector<double> values_proc(num_values * nprocs, 0.0);
+    MPI_Allgather(
+        local_values, num_values, MPI_DOUBLE, values_proc.data(), num_values, MPI_DOUBLE, IBTK_MPI::getCommunicator());
+    std::vector<double> L1_sum_proc(nprocs), L2_sum_proc(nprocs), dot_sum_proc(nprocs);
+    for (int k = 0; k < nprocs; ++k)
+    {
+        L1_sum_proc[k] = values_proc[num_values * k];
+        L2_sum_proc[k] = values_proc[num_values * k + 1];
+        dot_sum_proc[k] = values_proc[num_values * k + 2];
+        ret_val.max_norm = std::max(ret_val.max_norm, values_proc[num_values * k + 3]);
+    }
+    ret_val.L1_norm = accurate_sum(L1_sum_proc);
+    ret_val.L2_norm = std::sqrt(accurate_sum(L2_sum_proc));
+    ret_val.dot = accurate_sum(dot_sum_proc);
+    return ret_val;
+} // norms
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -173,22 +337,51 @@ NormOps::L1Norm_local(const SAMRAIVectorReal<NDIM, double>* const samrai_vector)
 double
 NormOps::L2Norm_local(const SAMRAIVectorReal<NDIM, double>* const samrai_vector)
 {
-    std::vector<double> L2_norm_local_patch;
-    Pointer<PatchHierarchy<NDIM> > hierarchy = samrai_vector->getPatchHierarchy();
-    const int coarsest_ln = samrai_vector->getCoarsestLevelNumber();
-    const int finest_ln = samrai_vector->getFinestLevelNumber();
-    const int ncomp = samrai_vector->getNumberOfComponents();
+    std::vector<double> L1_sum_patch, L2_sum_patch, dot_sum_patch;
+    double max_norm = 0.0;
+    computeLocalSums(samrai_vector, nullptr, L1_sum_patch, L2_sum_patch, dot_sum_patch, max_norm);
+    return std::sqrt(accurate_sum(L2_sum_patch));
+} // L2Norm_local
+
+void
+NormOps::computeLocalSums(const SAMRAIVectorReal<NDIM, double>* const x,
+                          const SAMRAIVectorReal<NDIM, double>* const y,
+                          std::vector<double>& L1_sum_patch,
+                          std::vector<double>& L2_sum_patch,
+                          std::vector<double>& dot_sum_patch,
+                          double& max_norm)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x);
+    TBOX_ASSERT(!y || y->getNumberOfComponents() == x->getNumberOfComponents());
+#endif
+    L1_sum_patch.clear();
+    L2_sum_patch.clear();
+    dot_sum_patch.clear();
+    max_norm = 0.0;
+    const auto add_patch_sums = [&](const LaneSums& sums) {
+        L1_sum_patch.push_back(std::accumulate(sums.L1, sums.L1 + NUM_LANES, 0.0));
+        L2_sum_patch.push_back(std::accumulate(sums.L2, sums.L2 + NUM_LANES, 0.0));
+        dot_sum_patch.push_back(std::accumulate(sums.dot, sums.dot + NUM_LANES, 0.0));
+        max_norm = std::max(max_norm, *std::max_element(sums.max, sums.max + NUM_LANES));
+    };
+
+    Pointer<PatchHierarchy<NDIM> > hierarchy = x->getPatchHierarchy();
+    const int coarsest_ln = x->getCoarsestLevelNumber();
+    const int finest_ln = x->getFinestLevelNumber();
+    const int ncomp = x->getNumberOfComponents();
     for (int comp = 0; comp < ncomp; ++comp)
     {
-        const Pointer<Variable<NDIM> >& comp_var = samrai_vector->getComponentVariable(comp);
-        const int comp_idx = samrai_vector->getComponentDescriptorIndex(comp);
-        const int cvol_idx = samrai_vector->getControlVolumeIndex(comp);
+        const Pointer<Variable<NDIM> >& comp_var = x->getComponentVariable(comp);
+        const int x_idx = x->getComponentDescriptorIndex(comp);
+        const int y_idx = y ? y->getComponentDescriptorIndex(comp) : -1;
+        const int cvol_idx = x->getControlVolumeIndex(comp);
+        const bool has_y = y_idx >= 0;
         const bool has_cvol = cvol_idx >= 0;
 
         Pointer<CellVariable<NDIM, double> > comp_cc_var = comp_var;
         if (comp_cc_var)
         {
-            PatchCellDataNormOpsReal<NDIM, double> patch_ops;
             for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
             {
                 Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
@@ -196,10 +389,18 @@ NormOps::L2Norm_local(const SAMRAIVectorReal<NDIM, double>* const samrai_vector)
                 {
                     Pointer<Patch<NDIM> > patch = level->getPatch(p());
                     const Box<NDIM>& patch_box = patch->getBox();
-                    Pointer<CellData<NDIM, double> > comp_data = patch->getPatchData(comp_idx);
+                    Pointer<CellData<NDIM, double> > x_data = patch->getPatchData(x_idx);
+                    Pointer<CellData<NDIM, double> > y_data =
+                        (has_y ? patch->getPatchData(y_idx) : Pointer<PatchData<NDIM> >(nullptr));
                     Pointer<CellData<NDIM, double> > cvol_data =
                         (has_cvol ? patch->getPatchData(cvol_idx) : Pointer<PatchData<NDIM> >(nullptr));
-                    L2_norm_local_patch.push_back(patch_ops.L2Norm(comp_data, patch_box, cvol_data));
+                    LaneSums sums;
+                    accumulate_box(x_data->getArrayData(),
+                                   y_data ? &y_data->getArrayData() : nullptr,
+                                   cvol_data ? &cvol_data->getArrayData() : nullptr,
+                                   patch_box,
+                                   sums);
+                    add_patch_sums(sums);
                 }
             }
         }
@@ -207,7 +408,6 @@ NormOps::L2Norm_local(const SAMRAIVectorReal<NDIM, double>* const samrai_vector)
         Pointer<SideVariable<NDIM, double> > comp_sc_var = comp_var;
         if (comp_sc_var)
         {
-            PatchSideDataNormOpsReal<NDIM, double> patch_ops;
             for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
             {
                 Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
@@ -215,16 +415,28 @@ NormOps::L2Norm_local(const SAMRAIVectorReal<NDIM, double>* const samrai_vector)
                 {
                     Pointer<Patch<NDIM> > patch = level->getPatch(p());
                     const Box<NDIM>& patch_box = patch->getBox();
-                    Pointer<SideData<NDIM, double> > comp_data = patch->getPatchData(comp_idx);
+                    Pointer<SideData<NDIM, double> > x_data = patch->getPatchData(x_idx);
+                    Pointer<SideData<NDIM, double> > y_data =
+                        (has_y ? patch->getPatchData(y_idx) : Pointer<PatchData<NDIM> >(nullptr));
                     Pointer<SideData<NDIM, double> > cvol_data =
                         (has_cvol ? patch->getPatchData(cvol_idx) : Pointer<PatchData<NDIM> >(nullptr));
-                    L2_norm_local_patch.push_back(patch_ops.L2Norm(comp_data, patch_box, cvol_data));
+                    LaneSums sums;
+                    for (unsigned int axis = 0; axis < NDIM; ++axis)
+                    {
+                        if (!x_data->getDirectionVector()(axis)) continue;
+                        accumulate_box(x_data->getArrayData(axis),
+                                       y_data ? &y_data->getArrayData(axis) : nullptr,
+                                       cvol_data ? &cvol_data->getArrayData(axis) : nullptr,
+                                       SideGeometry<NDIM>::toSideBox(patch_box, axis),
+                                       sums);
+                    }
+                    add_patch_sums(sums);
                 }
             }
         }
     }
-    return std::sqrt(accurate_sum_of_squares(L2_norm_local_patch));
-} // L2Norm_local
+    return;
+} // computeLocalSums
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
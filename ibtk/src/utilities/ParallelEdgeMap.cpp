@@ -13,10 +13,13 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/IBTK_MPI.h"
 #include "ibtk/ParallelEdgeMap.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
-#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
+
+#include <mpi.h>
 
 #include <algorithm>
 #include <map>
@@ -61,44 +64,54 @@ ParallelEdgeMap::removeEdge(const std::pair<int, int>& link, int mastr_idx)
 void
 ParallelEdgeMap::communicateData()
 {
-    const int size = SAMRAI_MPI::getNodes();
-    const int rank = SAMRAI_MPI::getRank();
+    const int size = IBTK_MPI::getNodes();
 
-    std::vector<int> num_additions_and_removals(2 * size, 0);
-    num_additions_and_removals[2 * rank] = static_cast<int>(d_pending_additions.size());
-    num_additions_and_removals[2 * rank + 1] = static_cast<int>(d_pending_removals.size());
-    SAMRAI_MPI::sumReduction(&num_additions_and_removals[0], 2 * size);
+    // Determine the numbers of edges registered for addition and for removal on
+    // each process with a single collective.
+    int local_counts[2] = { static_cast<int>(d_pending_additions.size()), static_cast<int>(d_pending_removals.size()) };
+    std::vector<int> num_additions_and_removals(2 * size);
+    MPI_Allgather(
+        local_counts, 2, MPI_INT, num_additions_and_removals.data(), 2, MPI_INT, IBTK_MPI::getCommunicator());
 
-    int num_transactions = 0, offset = 0;
+    static const int SIZE = 3;
+    std::vector<int> transactions_sz(size), transactions_offset(size + 1, 0);
     for (int k = 0; k < size; ++k)
     {
-        int size_k = num_additions_and_removals[2 * k] + num_additions_and_removals[2 * k + 1];
-        num_transactions += size_k;
-        if (k < rank)
-        {
-            offset += size_k;
-        }
+        transactions_sz[k] = SIZE * (num_additions_and_removals[2 * k] + num_additions_and_removals[2 * k + 1]);
+        transactions_offset[k + 1] = transactions_offset[k] + transactions_sz[k];
     }
 
-    if (num_transactions == 0) return;
+    if (transactions_offset[size] == 0) return;
 
-    static const int SIZE = 3;
-    std::vector<int> transactions(SIZE * num_transactions, 0);
-    for (auto cit = d_pending_additions.begin(); cit != d_pending_additions.end(); ++cit, ++offset)
+    // Pack the local transactions and gather the transactions of all processes.
+    std::vector<int> local_transactions;
+    local_transactions.reserve(SIZE * (local_counts[0] + local_counts[1]));
+    for (const auto& pending_addition : d_pending_additions)
     {
-        transactions[SIZE * offset] = cit->first;
-        transactions[SIZE * offset + 1] = cit->second.first;
-        transactions[SIZE * offset + 2] = cit->second.second;
+        local_transactions.push_back(pending_addition.first);
+        local_transactions.push_back(pending_addition.second.first);
+        local_transactions.push_back(pending_addition.second.second);
     }
-    for (auto cit = d_pending_removals.begin(); cit != d_pending_removals.end(); ++cit, ++offset)
+    for (const auto& pending_removal : d_pending_removals)
     {
-        transactions[SIZE * offset] = cit->first;
-        transactions[SIZE * offset + 1] = cit->second.first;
-        transactions[SIZE * offset + 2] = cit->second.second;
+        local_transactions.push_back(pending_removal.first);
+        local_transactions.push_back(pending_removal.second.first);
+        local_transactions.push_back(pending_removal.second.second);
     }
-    SAMRAI_MPI::sumReduction(&transactions[0], SIZE * num_transactions);
-
-    offset = 0;
+    std::vector<int> transactions(transactions_offset[size]);
+    MPI_Allgatherv(local_transactions.data(),
+                   static_cast<int>(local_transactions.size()),
+                   MPI_INT,
+                   transactions.data(),
+                   transactions_sz.data(),
+                   transactions_offset.data(),
+                   MPI_INT,
+                   IBTK_MPI::getCommunicator());
+
+    // The gathered transactions include the local ones.
+    d_pending_additions.clear();
+    d_pending_removals.clear();
+    int offset = 0;
     for (int k = 0; k < size; ++k)
     {
         for (int t = 0; t < num_additions_and_removals[2 * k]; ++t, ++offset)
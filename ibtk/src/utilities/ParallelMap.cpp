@@ -14,6 +14,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibtk/FixedSizedStream.h"
+#include "ibtk/IBTK_MPI.h"
 #include "ibtk/ParallelMap.h"
 #include "ibtk/Streamable.h"
 #include "ibtk/StreamableManager.h"
@@ -21,8 +22,11 @@
 
 #include "IntVector.h"
 #include "tbox/Pointer.h"
-#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
 
+#include <mpi.h>
+
+#include <algorithm>
 #include <map>
 #include <utility>
 #include <vector>
@@ -64,51 +68,72 @@ ParallelMap::removeItem(const int key)
 void
 ParallelMap::communicateData()
 {
-    const int size = SAMRAI_MPI::getNodes();
-    const int rank = SAMRAI_MPI::getRank();
+    const int size = IBTK_MPI::getNodes();
+    const int rank = IBTK_MPI::getRank();
+    StreamableManager* streamable_manager = StreamableManager::getManager();
+
+    // Get the local values to send.
+    std::vector<int> keys_to_send;
+    std::vector<tbox::Pointer<Streamable> > data_items_to_send;
+    keys_to_send.reserve(d_pending_additions.size());
+    data_items_to_send.reserve(d_pending_additions.size());
+    for (const auto& pending_addition : d_pending_additions)
+    {
+        keys_to_send.push_back(pending_addition.first);
+        data_items_to_send.push_back(pending_addition.second);
+    }
 
-    // Add items to the map.
-    if (SAMRAI_MPI::maxReduction(static_cast<int>(d_pending_additions.size())) > 0)
+    // Determine the number of additions, the size of the packed additions, and
+    // the number of removals on each process with a single collective.
+    static const int NUM_COUNTS = 3;
+    int local_counts[NUM_COUNTS] = { 0, 0, 0 };
+    local_counts[0] = static_cast<int>(keys_to_send.size());
+    local_counts[2] = static_cast<int>(d_pending_removals.size());
+    if (local_counts[0] > 0)
+    {
+        local_counts[1] = static_cast<int>(tbox::AbstractStream::sizeofInt() * keys_to_send.size() +
+                                           streamable_manager->getDataStreamSize(data_items_to_send));
+    }
+    std::vector<int> counts(NUM_COUNTS * size);
+    MPI_Allgather(local_counts, NUM_COUNTS, MPI_INT, counts.data(), NUM_COUNTS, MPI_INT, IBTK_MPI::getCommunicator());
+    std::vector<int> data_sz(size), data_offset(size + 1, 0), num_removals(size), removal_offset(size + 1, 0);
+    for (int k = 0; k < size; ++k)
     {
-        StreamableManager* streamable_manager = StreamableManager::getManager();
-
-        // Determine how many keys have been registered for addition on each
-        // process.
-        std::vector<int> num_additions(size, 0);
-        num_additions[rank] = static_cast<int>(d_pending_additions.size());
-        SAMRAI_MPI::sumReduction(&num_additions[0], size);
-
-        // Get the local values to send and determine the amount of data to be
-        // broadcast by each process.
-        std::vector<int> keys_to_send;
-        std::vector<tbox::Pointer<Streamable> > data_items_to_send;
-        for (const auto& pending_addition : d_pending_additions)
+        data_sz[k] = counts[NUM_COUNTS * k + 1];
+        data_offset[k + 1] = data_offset[k] + data_sz[k];
+        num_removals[k] = counts[NUM_COUNTS * k + 2];
+        removal_offset[k + 1] = removal_offset[k] + num_removals[k];
+    }
+
+    // Add items to the map.  The packed additions of all processes are
+    // gathered into a single buffer and applied in process order so that the
+    // result does not depend on the order in which the messages arrive.
+    if (data_offset[size] > 0)
+    {
+        FixedSizedStream send_stream(std::max(local_counts[1], 1));
+        if (local_counts[0] > 0)
         {
-            keys_to_send.push_back(pending_addition.first);
-            data_items_to_send.push_back(pending_addition.second);
+            send_stream.pack(&keys_to_send[0], local_counts[0]);
+            streamable_manager->packStream(send_stream, data_items_to_send);
+#if !defined(NDEBUG)
+            TBOX_ASSERT(send_stream.getCurrentSize() == local_counts[1]);
+#endif
         }
-        std::vector<int> data_sz(size, 0);
-        data_sz[rank] = static_cast<int>(tbox::AbstractStream::sizeofInt() * keys_to_send.size() +
-                                         streamable_manager->getDataStreamSize(data_items_to_send));
-        SAMRAI_MPI::sumReduction(&data_sz[0], size);
-
-        // Broadcast data from each process.
+        std::vector<char> buffer(data_offset[size]);
+        MPI_Allgatherv(send_stream.getBufferStart(),
+                       local_counts[1],
+                       MPI_CHAR,
+                       buffer.data(),
+                       data_sz.data(),
+                       data_offset.data(),
+                       MPI_CHAR,
+                       IBTK_MPI::getCommunicator());
         for (int sending_proc = 0; sending_proc < size; ++sending_proc)
         {
-            int num_keys = num_additions[sending_proc];
+            const int num_keys = counts[NUM_COUNTS * sending_proc];
             if (num_keys == 0) continue;
             if (sending_proc == rank)
             {
-                // Pack and broadcast data on process sending_proc.
-                FixedSizedStream stream(data_sz[sending_proc]);
-                stream.pack(&keys_to_send[0], static_cast<int>(keys_to_send.size()));
-                streamable_manager->packStream(stream, data_items_to_send);
-                int data_size = stream.getCurrentSize();
-#if !defined(NDEBUG)
-                TBOX_ASSERT(static_cast<int>(d_pending_additions.size()) == num_keys);
-                TBOX_ASSERT(data_size == data_sz[sending_proc]);
-#endif
-                SAMRAI_MPI::bcast(static_cast<char*>(stream.getBufferStart()), data_size, sending_proc);
                 for (int k = 0; k < num_keys; ++k)
                 {
                     d_map[keys_to_send[k]] = data_items_to_send[k];
@@ -116,14 +141,8 @@ ParallelMap::communicateData()
             }
             else
             {
-                // Receive and unpack data broadcast from process sending_proc.
-                std::vector<char> buffer(data_sz[sending_proc]);
-                int data_size = data_sz[sending_proc];
-                SAMRAI_MPI::bcast(&buffer[0], data_size, sending_proc);
-#if !defined(NDEBUG)
-                TBOX_ASSERT(data_size == data_sz[sending_proc]);
-#endif
-                FixedSizedStream stream(&buffer[0], data_size);
+                // Unpack the data gathered from process sending_proc.
+                FixedSizedStream stream(&buffer[data_offset[sending_proc]], data_sz[sending_proc]);
                 std::vector<int> keys_received(num_keys);
                 stream.unpack(&keys_received[0], num_keys);
                 std::vector<tbox::Pointer<Streamable> > data_items_received;
@@ -138,52 +157,27 @@ ParallelMap::communicateData()
                 }
             }
         }
-
-        // Clear the set of pending additions.
-        d_pending_additions.clear();
     }
+    d_pending_additions.clear();
 
     // Remove items from the map.
-    if (SAMRAI_MPI::maxReduction(static_cast<int>(d_pending_removals.size())) > 0)
+    if (removal_offset[size] > 0)
     {
-        // Determine how many keys have been registered for removal on each
-        // process.
-        std::vector<int> num_removals(size, 0);
-        num_removals[rank] = static_cast<int>(d_pending_removals.size());
-        SAMRAI_MPI::sumReduction(&num_removals[0], size);
-
-        // Broadcast data from each process.
-        for (int sending_proc = 0; sending_proc < size; ++sending_proc)
+        std::vector<int> keys_received(removal_offset[size]);
+        MPI_Allgatherv(d_pending_removals.data(),
+                       local_counts[2],
+                       MPI_INT,
+                       keys_received.data(),
+                       num_removals.data(),
+                       removal_offset.data(),
+                       MPI_INT,
+                       IBTK_MPI::getCommunicator());
+        for (const int key : keys_received)
         {
-            int num_keys = num_removals[sending_proc];
-            if (num_keys == 0) continue;
-            if (sending_proc == rank)
-            {
-// Pack and broadcast data on process sending_proc.
-#if !defined(NDEBUG)
-                TBOX_ASSERT(static_cast<int>(d_pending_removals.size()) == num_keys);
-#endif
-                SAMRAI_MPI::bcast(&d_pending_removals[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_map.erase(d_pending_removals[k]);
-                }
-            }
-            else
-            {
-                // Receive and unpack data broadcast from process sending_proc.
-                std::vector<int> keys_received(num_removals[sending_proc]);
-                SAMRAI_MPI::bcast(&keys_received[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_map.erase(keys_received[k]);
-                }
-            }
+            d_map.erase(key);
         }
-
-        // Clear the set of pending removals.
-        d_pending_removals.clear();
     }
+    d_pending_removals.clear();
     return;
 } // communicateData
 
@@ -13,10 +13,11 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/IBTK_MPI.h"
 #include "ibtk/ParallelSet.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
-#include "tbox/SAMRAI_MPI.h"
+#include <mpi.h>
 
 #include <set>
 #include <vector>
@@ -58,92 +59,56 @@ ParallelSet::removeItem(const int key)
 void
 ParallelSet::communicateData()
 {
-    const int size = SAMRAI_MPI::getNodes();
-    const int rank = SAMRAI_MPI::getRank();
-
-    // Add items from the set.
-    if (SAMRAI_MPI::maxReduction(static_cast<int>(d_pending_additions.size())) > 0)
+    const int size = IBTK_MPI::getNodes();
+
+    // Determine the numbers of keys registered for addition and for removal on
+    // each process with a single collective.
+    int local_counts[2] = { static_cast<int>(d_pending_additions.size()), static_cast<int>(d_pending_removals.size()) };
+    std::vector<int> counts(2 * size);
+    MPI_Allgather(local_counts, 2, MPI_INT, counts.data(), 2, MPI_INT, IBTK_MPI::getCommunicator());
+    std::vector<int> num_additions(size), addition_offset(size + 1, 0), num_removals(size), removal_offset(size + 1, 0);
+    for (int k = 0; k < size; ++k)
     {
-        // Determine how many keys have been registered for addition on each
-        // process.
-        std::vector<int> num_additions(size, 0);
-        num_additions[rank] = static_cast<int>(d_pending_additions.size());
-        SAMRAI_MPI::sumReduction(&num_additions[0], size);
-
-        // Broadcast data from each process.
-        for (int sending_proc = 0; sending_proc < size; ++sending_proc)
-        {
-            int num_keys = num_additions[sending_proc];
-            if (num_keys == 0) continue;
-            if (sending_proc == rank)
-            {
-// Pack and broadcast data on process sending_proc.
-#if !defined(NDEBUG)
-                TBOX_ASSERT(static_cast<int>(d_pending_additions.size()) == num_keys);
-#endif
-                SAMRAI_MPI::bcast(&d_pending_additions[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_set.insert(d_pending_additions[k]);
-                }
-            }
-            else
-            {
-                // Receive and unpack data broadcast from process sending_proc.
-                std::vector<int> keys_received(num_additions[sending_proc]);
-                SAMRAI_MPI::bcast(&keys_received[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_set.insert(keys_received[k]);
-                }
-            }
-        }
+        num_additions[k] = counts[2 * k];
+        addition_offset[k + 1] = addition_offset[k] + num_additions[k];
+        num_removals[k] = counts[2 * k + 1];
+        removal_offset[k + 1] = removal_offset[k] + num_removals[k];
+    }
 
-        // Clear the set of pending additions.
-        d_pending_additions.clear();
+    // Add items to the set.
+    if (addition_offset[size] > 0)
+    {
+        std::vector<int> keys_received(addition_offset[size]);
+        MPI_Allgatherv(d_pending_additions.data(),
+                       local_counts[0],
+                       MPI_INT,
+                       keys_received.data(),
+                       num_additions.data(),
+                       addition_offset.data(),
+                       MPI_INT,
+                       IBTK_MPI::getCommunicator());
+        d_set.insert(keys_received.begin(), keys_received.end());
     }
+    d_pending_additions.clear();
 
     // Remove items from the set.
-    if (SAMRAI_MPI::maxReduction(static_cast<int>(d_pending_removals.size())) > 0)
+    if (removal_offset[size] > 0)
     {
-        // Determine how many keys have been registered for removal on each
-        // process.
-        std::vector<int> num_removals(size, 0);
-        num_removals[rank] = static_cast<int>(d_pending_removals.size());
-        SAMRAI_MPI::sumReduction(&num_removals[0], size);
-
-        // Broadcast data from each process.
-        for (int sending_proc = 0; sending_proc < size; ++sending_proc)
+        std::vector<int> keys_received(removal_offset[size]);
+        MPI_Allgatherv(d_pending_removals.data(),
+                       local_counts[1],
+                       MPI_INT,
+                       keys_received.data(),
+                       num_removals.data(),
+                       removal_offset.data(),
+                       MPI_INT,
+                       IBTK_MPI::getCommunicator());
+        for (const int key : keys_received)
         {
-            int num_keys = num_removals[sending_proc];
-            if (num_keys == 0) continue;
-            if (sending_proc == rank)
-            {
-// Pack and broadcast data on process sending_proc.
-#if !defined(NDEBUG)
-                TBOX_ASSERT(static_cast<int>(d_pending_removals.size()) == num_keys);
-#endif
-                SAMRAI_MPI::bcast(&d_pending_removals[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_set.erase(d_pending_removals[k]);
-                }
-            }
-            else
-            {
-                // Receive and unpack data broadcast from process sending_proc.
-                std::vector<int> keys_received(num_removals[sending_proc]);
-                SAMRAI_MPI::bcast(&keys_received[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_set.erase(keys_received[k]);
-                }
-            }
+            d_set.erase(key);
         }
-
-        // Clear the set of pending removals.
-        d_pending_removals.clear();
     }
+    d_pending_removals.clear();
     return;
 } // communicateData
 
@@ -0,0 +1,378 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/LEInteractor.h"
+#include "ibtk/PatchSizeAutotuner.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+#include "Box.h"
+#include "CartesianPatchGeometry.h"
+#include "CellData.h"
+#include "CellVariable.h"
+#include "GriddingAlgorithm.h"
+#include "Index.h"
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "RefineAlgorithm.h"
+#include "RefineOperator.h"
+#include "RefineSchedule.h"
+#include "SideData.h"
+#include "SideGeometry.h"
+#include "SideVariable.h"
+#include "StandardTagAndInitialize.h"
+#include "Variable.h"
+#include "VariableContext.h"
+#include "VariableDatabase.h"
+#include "tbox/Array.h"
+#include "tbox/MemoryDatabase.h"
+#include "tbox/PIO.h"
+#include "tbox/Utilities.h"
+
+#include <mpi.h>
+
+#include <array>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Names of the timed operations.
+const std::array<std::string, 3> OPERATION_NAMES = { "ghost_fill", "stokes_apply", "kernel_ghost_fill" };
+
+// Position of the given index in the storage of the given (ghost) box.
+inline int
+array_offset(const Box<NDIM>& box, const hier::Index<NDIM>& i)
+{
+    int offset = 0, stride = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        offset += (i(d) - box.lower(d)) * stride;
+        stride *= box.numberCells(d);
+    }
+    return offset;
+} // array_offset
+
+// Distances between consecutive indices in each direction in the storage of
+// the given (ghost) box.
+inline IntVector<NDIM>
+array_strides(const Box<NDIM>& box)
+{
+    IntVector<NDIM> strides;
+    int stride = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        strides(d) = stride;
+        stride *= box.numberCells(d);
+    }
+    return strides;
+} // array_strides
+
+// Look up a variable by name, creating it if it does not exist yet.
+template <class VariableType>
+Pointer<VariableType>
+get_variable(const std::string& name)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<VariableType> var = var_db->getVariable(name);
+    if (!var) var = new VariableType(name);
+    return var;
+} // get_variable
+
+// Time the given operation: run it once untimed and then num_trials times,
+// and return the maximum over all processes of the average time.
+template <class Operation>
+double
+time_operation(const Operation& op, const int num_trials)
+{
+    op();
+    IBTK_MPI::barrier();
+    const double start_time = MPI_Wtime();
+    for (int k = 0; k < num_trials; ++k) op();
+    const double avg_time = (MPI_Wtime() - start_time) / num_trials;
+    return IBTK_MPI::maxReduction(avg_time);
+} // time_operation
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+PatchSizeAutotuner::PatchSizeAutotuner(std::string object_name, Pointer<Database> input_db)
+    : d_object_name(std::move(object_name))
+{
+    if (input_db)
+    {
+        if (input_db->keyExists("candidate_patch_sizes"))
+        {
+            const int num_candidates = input_db->getArraySize("candidate_patch_sizes");
+            d_candidate_patch_sizes.resize(num_candidates);
+            input_db->getIntegerArray("candidate_patch_sizes", d_candidate_patch_sizes.data(), num_candidates);
+        }
+        d_num_trials = input_db->getIntegerWithDefault("num_trials", d_num_trials);
+        d_ib_kernel_fcn = input_db->getStringWithDefault("ib_kernel_fcn", d_ib_kernel_fcn);
+    }
+    if (d_candidate_patch_sizes.empty())
+    {
+        TBOX_ERROR(d_object_name << "::PatchSizeAutotuner():\n"
+                                 << "  candidate_patch_sizes must not be empty" << std::endl);
+    }
+    for (const int patch_size : d_candidate_patch_sizes)
+    {
+        if (patch_size <= 0)
+        {
+            TBOX_ERROR(d_object_name << "::PatchSizeAutotuner():\n"
+                                     << "  candidate_patch_sizes must be positive" << std::endl);
+        }
+    }
+    if (d_num_trials <= 0)
+    {
+        TBOX_ERROR(d_object_name << "::PatchSizeAutotuner():\n"
+                                 << "  num_trials must be positive" << std::endl);
+    }
+    return;
+} // PatchSizeAutotuner
+
+int
+PatchSizeAutotuner::tunePatchSize(Pointer<CartesianGridGeometry<NDIM> > grid_geometry,
+                                  Pointer<BoxGeneratorStrategy<NDIM> > box_generator,
+                                  Pointer<LoadBalanceStrategy<NDIM> > load_balancer,
+                                  Pointer<Database> gridding_alg_db)
+{
+    TBOX_ASSERT(grid_geometry);
+    TBOX_ASSERT(box_generator);
+    TBOX_ASSERT(load_balancer);
+    TBOX_ASSERT(gridding_alg_db);
+
+    // The smallest patch size of the coarsest level, if one is provided, is
+    // kept for all candidates that are not smaller than it.
+    IntVector<NDIM> smallest_patch_size(1);
+    if (gridding_alg_db->isDatabase("smallest_patch_size"))
+    {
+        Pointer<Database> sps_db = gridding_alg_db->getDatabase("smallest_patch_size");
+        if (sps_db->keyExists("level_0")) sps_db->getIntegerArray("level_0", smallest_patch_size, NDIM);
+    }
+
+    // Set up the data used by the timed operations.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<VariableContext> ctx = var_db->getContext(d_object_name + "::CONTEXT");
+    Pointer<VariableContext> kernel_ctx = var_db->getContext(d_object_name + "::KERNEL_CONTEXT");
+    Pointer<SideVariable<NDIM, double> > u_var = get_variable<SideVariable<NDIM, double> >(d_object_name + "::u");
+    Pointer<CellVariable<NDIM, double> > p_var = get_variable<CellVariable<NDIM, double> >(d_object_name + "::p");
+    Pointer<SideVariable<NDIM, double> > f_var = get_variable<SideVariable<NDIM, double> >(d_object_name + "::f");
+    Pointer<CellVariable<NDIM, double> > g_var = get_variable<CellVariable<NDIM, double> >(d_object_name + "::g");
+    const int u_idx = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+    const int p_idx = var_db->registerVariableAndContext(p_var, ctx, IntVector<NDIM>(1));
+    const int f_idx = var_db->registerVariableAndContext(f_var, ctx, IntVector<NDIM>(0));
+    const int g_idx = var_db->registerVariableAndContext(g_var, ctx, IntVector<NDIM>(0));
+    const int u_kernel_idx = var_db->registerVariableAndContext(
+        u_var, kernel_ctx, IntVector<NDIM>(LEInteractor::getMinimumGhostWidth(d_ib_kernel_fcn)));
+    const std::array<int, 5> data_idxs = { u_idx, p_idx, f_idx, g_idx, u_kernel_idx };
+
+    RefineAlgorithm<NDIM> ghost_fill_alg, kernel_ghost_fill_alg;
+    ghost_fill_alg.registerRefine(u_idx, u_idx, u_idx, Pointer<RefineOperator<NDIM> >(nullptr));
+    ghost_fill_alg.registerRefine(p_idx, p_idx, p_idx, Pointer<RefineOperator<NDIM> >(nullptr));
+    kernel_ghost_fill_alg.registerRefine(
+        u_kernel_idx, u_kernel_idx, u_kernel_idx, Pointer<RefineOperator<NDIM> >(nullptr));
+
+    Pointer<Database> tag_init_db = new MemoryDatabase(d_object_name + "::StandardTagAndInitialize");
+    tag_init_db->putString("tagging_method", "GRADIENT_DETECTOR");
+    Pointer<StandardTagAndInitialize<NDIM> > tag_init =
+        new StandardTagAndInitialize<NDIM>(d_object_name + "::StandardTagAndInitialize", nullptr, tag_init_db);
+
+    // Time the operations on the coarsest level generated with each candidate
+    // patch size.
+    plog << d_object_name << "::tunePatchSize(): timing " << d_candidate_patch_sizes.size()
+         << " candidate patch sizes\n";
+    int best_patch_size = d_candidate_patch_sizes.front();
+    double best_time = std::numeric_limits<double>::max();
+    for (const int patch_size : d_candidate_patch_sizes)
+    {
+        Pointer<Database> db = new MemoryDatabase(d_object_name + "::GriddingAlgorithm");
+        db->putInteger("max_levels", 1);
+        const IntVector<NDIM> largest_patch_size(patch_size);
+        IntVector<NDIM> candidate_smallest_patch_size = smallest_patch_size;
+        candidate_smallest_patch_size.min(largest_patch_size);
+        db->putDatabase("largest_patch_size")->putIntegerArray("level_0", largest_patch_size, NDIM);
+        db->putDatabase("smallest_patch_size")->putIntegerArray("level_0", candidate_smallest_patch_size, NDIM);
+        Pointer<GriddingAlgorithm<NDIM> > gridding_alg = new GriddingAlgorithm<NDIM>(
+            d_object_name + "::GriddingAlgorithm", db, tag_init, box_generator, load_balancer, false);
+        Pointer<PatchHierarchy<NDIM> > hierarchy =
+            new PatchHierarchy<NDIM>(d_object_name + "::PatchHierarchy", grid_geometry, false);
+        gridding_alg->makeCoarsestLevel(hierarchy, 0.0);
+
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(0);
+        for (const int idx : data_idxs) level->allocatePatchData(idx, 0.0);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+            Pointer<CellData<NDIM, double> > p_data = patch->getPatchData(p_idx);
+            Pointer<SideData<NDIM, double> > u_kernel_data = patch->getPatchData(u_kernel_idx);
+            u_data->fillAll(1.0);
+            p_data->fillAll(1.0);
+            u_kernel_data->fillAll(1.0);
+        }
+        Pointer<RefineSchedule<NDIM> > ghost_fill_sched = ghost_fill_alg.createSchedule(level, nullptr);
+        Pointer<RefineSchedule<NDIM> > kernel_ghost_fill_sched = kernel_ghost_fill_alg.createSchedule(level, nullptr);
+
+        const std::array<double, 3> times = {
+            time_operation([&]() { ghost_fill_sched->fillData(0.0); }, d_num_trials),
+            time_operation([&]() { applyStokesOperator(hierarchy, u_idx, p_idx, f_idx, g_idx); }, d_num_trials),
+            time_operation([&]() { kernel_ghost_fill_sched->fillData(0.0); }, d_num_trials)
+        };
+        double total_time = 0.0;
+        plog << d_object_name << "::tunePatchSize(): largest_patch_size = " << patch_size << ", "
+             << level->getGlobalNumberOfPatches() << " patches:";
+        for (unsigned int k = 0; k < times.size(); ++k)
+        {
+            plog << " " << OPERATION_NAMES[k] << " = " << times[k];
+            total_time += times[k];
+        }
+        plog << ", total = " << total_time << "\n";
+        if (total_time < best_time)
+        {
+            best_time = total_time;
+            best_patch_size = patch_size;
+        }
+
+        for (const int idx : data_idxs) level->deallocatePatchData(idx);
+    }
+    for (const int idx : data_idxs) var_db->removePatchDataIndex(idx);
+
+    pout << d_object_name << "::tunePatchSize(): selected largest_patch_size = " << best_patch_size << "\n";
+    plog << d_object_name << "::tunePatchSize(): selected largest_patch_size = " << best_patch_size << "\n";
+
+    // Set the selected patch size on every level for which one is given and on
+    // the coarsest level, and make sure that the smallest patch sizes do not
+    // exceed it.
+    const IntVector<NDIM> best_largest_patch_size(best_patch_size);
+    Pointer<Database> lps_db = gridding_alg_db->isDatabase("largest_patch_size") ?
+                                   gridding_alg_db->getDatabase("largest_patch_size") :
+                                   gridding_alg_db->putDatabase("largest_patch_size");
+    Array<std::string> lps_keys = lps_db->getAllKeys();
+    for (int k = 0; k < lps_keys.getSize(); ++k)
+    {
+        lps_db->putIntegerArray(lps_keys[k], best_largest_patch_size, NDIM);
+    }
+    lps_db->putIntegerArray("level_0", best_largest_patch_size, NDIM);
+    if (gridding_alg_db->isDatabase("smallest_patch_size"))
+    {
+        Pointer<Database> sps_db = gridding_alg_db->getDatabase("smallest_patch_size");
+        Array<std::string> sps_keys = sps_db->getAllKeys();
+        for (int k = 0; k < sps_keys.getSize(); ++k)
+        {
+            IntVector<NDIM> level_smallest_patch_size;
+            sps_db->getIntegerArray(sps_keys[k], level_smallest_patch_size, NDIM);
+            level_smallest_patch_size.min(best_largest_patch_size);
+            sps_db->putIntegerArray(sps_keys[k], level_smallest_patch_size, NDIM);
+        }
+    }
+    return best_patch_size;
+} // tunePatchSize
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+PatchSizeAutotuner::applyStokesOperator(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                        const int u_idx,
+                                        const int p_idx,
+                                        const int f_idx,
+                                        const int g_idx)
+{
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(0);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+        const double* const dx = pgeom->getDx();
+        Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+        Pointer<CellData<NDIM, double> > p_data = patch->getPatchData(p_idx);
+        Pointer<SideData<NDIM, double> > f_data = patch->getPatchData(f_idx);
+        Pointer<CellData<NDIM, double> > g_data = patch->getPatchData(g_idx);
+        const Box<NDIM>& p_box = p_data->getArrayData().getBox();
+        const Box<NDIM>& g_box = g_data->getArrayData().getBox();
+        const IntVector<NDIM> p_strides = array_strides(p_box);
+        const double* const p = p_data->getPointer();
+        double* const g = g_data->getPointer();
+
+        // f = -L u + grad p, one line in the first coordinate direction at a
+        // time.
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+            const Box<NDIM>& u_box = u_data->getArrayData(axis).getBox();
+            const Box<NDIM>& f_box = f_data->getArrayData(axis).getBox();
+            const IntVector<NDIM> u_strides = array_strides(u_box);
+            const double* const u = u_data->getPointer(axis);
+            double* const f = f_data->getPointer(axis);
+            const int n0 = side_box.numberCells(0);
+            Box<NDIM> line_starts = side_box;
+            line_starts.upper(0) = line_starts.lower(0);
+            for (Box<NDIM>::Iterator b(line_starts); b; b++)
+            {
+                const hier::Index<NDIM>& i = b();
+                const double* const u_line = u + array_offset(u_box, i);
+                const double* const p_line = p + array_offset(p_box, i);
+                double* const f_line = f + array_offset(f_box, i);
+                for (int k = 0; k < n0; ++k)
+                {
+                    double lap_u = 0.0;
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        lap_u += (u_line[k + u_strides(d)] - 2.0 * u_line[k] + u_line[k - u_strides(d)]) /
+                                 (dx[d] * dx[d]);
+                    }
+                    f_line[k] = -lap_u + (p_line[k] - p_line[k - p_strides(axis)]) / dx[axis];
+                }
+            }
+        }
+
+        // g = div u.
+        const int n0 = patch_box.numberCells(0);
+        Box<NDIM> line_starts = patch_box;
+        line_starts.upper(0) = line_starts.lower(0);
+        for (Box<NDIM>::Iterator b(line_starts); b; b++)
+        {
+            const hier::Index<NDIM>& i = b();
+            double* const g_line = g + array_offset(g_box, i);
+            for (int k = 0; k < n0; ++k) g_line[k] = 0.0;
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                const Box<NDIM>& u_box = u_data->getArrayData(axis).getBox();
+                const int u_stride = array_strides(u_box)(axis);
+                const double* const u_line = u_data->getPointer(axis) + array_offset(u_box, i);
+                for (int k = 0; k < n0; ++k) g_line[k] += (u_line[k + u_stride] - u_line[k]) / dx[axis];
+            }
+        }
+    }
+    return;
+} // applyStokesOperator
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,414 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <IBTK_config.h>
+
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/MemoryMonitor.h"
+#include "ibtk/PerformanceMonitor.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+#include "tbox/Utilities.h"
+
+#include <mpi.h>
+
+#if defined(IBTK_HAVE_CALIPER)
+#include <caliper/cali.h>
+#elif defined(IBTK_HAVE_NVTX)
+#include <nvToolsExt.h>
+#elif defined(IBTK_HAVE_SCOREP)
+#include <scorep/SCOREP_User.h>
+#elif defined(IBTK_HAVE_ITTNOTIFY)
+#include <ittnotify.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+bool PerformanceMonitor::s_enabled = false;
+
+#if defined(IBTK_HAVE_CALIPER) || defined(IBTK_HAVE_NVTX) || defined(IBTK_HAVE_SCOREP) || defined(IBTK_HAVE_ITTNOTIFY)
+bool PerformanceMonitor::s_annotations_enabled = true;
+#else
+bool PerformanceMonitor::s_annotations_enabled = false;
+#endif
+
+namespace
+{
+using clock_type = std::chrono::steady_clock;
+
+// A region of the hierarchy of regions recorded on this process.  The region
+// with index 0 is the root of the hierarchy.
+struct Region
+{
+    std::string name;
+    int parent;
+    std::vector<int> children;
+    int num_calls;
+    double time;
+    clock_type::time_point start;
+};
+
+std::vector<Region>&
+get_regions()
+{
+    static std::vector<Region> regions(1, Region{ "", -1, {}, 0, 0.0, clock_type::time_point() });
+    return regions;
+} // get_regions
+
+int current_region = 0;
+
+#if defined(IBTK_HAVE_ITTNOTIFY)
+__itt_domain*
+get_itt_domain()
+{
+    static __itt_domain* const domain = __itt_domain_create("IBAMR");
+    return domain;
+} // get_itt_domain
+#endif
+
+// The summary of a region over all processes.
+struct RegionSummary
+{
+    std::string path;
+    int depth;
+    int max_calls;
+    double min_time, avg_time, max_time;
+};
+
+// Collect the full names of the regions recorded on this process in
+// depth-first order.
+void
+collect_paths(const int idx, const std::string& path, std::vector<std::string>& paths, std::vector<int>& indices)
+{
+    for (const int child : get_regions()[idx].children)
+    {
+        const std::string child_path = (idx == 0 ? "" : path + "/") + get_regions()[child].name;
+        paths.push_back(child_path);
+        indices.push_back(child);
+        collect_paths(child, child_path, paths, indices);
+    }
+    return;
+} // collect_paths
+
+// Compute the summaries of the regions recorded on any process.  The regions
+// are ordered so that each region follows its parent and its siblings are in
+// the order in which they were first recorded.
+std::vector<RegionSummary>
+compute_summary()
+{
+    std::vector<std::string> local_paths;
+    std::vector<int> local_indices;
+    collect_paths(0, "", local_paths, local_indices);
+
+    // Gather the names of the regions recorded on all processes.
+    std::string local_buffer;
+    for (const auto& path : local_paths) local_buffer += path + "\n";
+    const int nodes = IBTK_MPI::getNodes();
+    int local_size = static_cast<int>(local_buffer.size());
+    std::vector<int> sizes(nodes), offsets(nodes + 1, 0);
+    MPI_Allgather(&local_size, 1, MPI_INT, sizes.data(), 1, MPI_INT, IBTK_MPI::getCommunicator());
+    for (int k = 0; k < nodes; ++k) offsets[k + 1] = offsets[k] + sizes[k];
+    std::vector<char> buffer(std::max(offsets[nodes], 1));
+    MPI_Allgatherv(&local_buffer[0],
+                   local_size,
+                   MPI_CHAR,
+                   buffer.data(),
+                   sizes.data(),
+                   offsets.data(),
+                   MPI_CHAR,
+                   IBTK_MPI::getCommunicator());
+
+    // Merge the hierarchies.  Each process lists the parent of each region
+    // before the region itself.
+    std::map<std::string, int> path_map;
+    std::vector<std::string> all_paths;
+    std::vector<std::vector<int> > children(1);
+    std::string path;
+    for (int k = 0; k < offsets[nodes]; ++k)
+    {
+        if (buffer[k] != '\n')
+        {
+            path += buffer[k];
+            continue;
+        }
+        if (path_map.find(path) == path_map.end())
+        {
+            const std::size_t pos = path.rfind('/');
+            const int parent = pos == std::string::npos ? 0 : path_map[path.substr(0, pos)] + 1;
+            path_map[path] = static_cast<int>(all_paths.size());
+            all_paths.push_back(path);
+            children.emplace_back();
+            children[parent].push_back(static_cast<int>(all_paths.size()));
+        }
+        path.clear();
+    }
+
+    // Order the regions depth-first.
+    std::vector<int> order, depths;
+    std::vector<std::pair<int, int> > stack(1, std::make_pair(0, -1));
+    while (!stack.empty())
+    {
+        const std::pair<int, int> node = stack.back();
+        stack.pop_back();
+        if (node.first != 0)
+        {
+            order.push_back(node.first - 1);
+            depths.push_back(node.second);
+        }
+        for (auto it = children[node.first].rbegin(); it != children[node.first].rend(); ++it)
+        {
+            stack.push_back(std::make_pair(*it, node.second + 1));
+        }
+    }
+
+    // Reduce the times and numbers of calls.
+    const int num_regions = static_cast<int>(all_paths.size());
+    std::vector<double> min_times(num_regions, 0.0), max_times(num_regions, 0.0), sum_times(num_regions, 0.0);
+    std::vector<int> max_calls(num_regions, 0);
+    for (unsigned int k = 0; k < local_paths.size(); ++k)
+    {
+        const Region& region = get_regions()[local_indices[k]];
+        const int idx = path_map[local_paths[k]];
+        min_times[idx] = max_times[idx] = sum_times[idx] = region.time;
+        max_calls[idx] = region.num_calls;
+    }
+    MPI_Allreduce(MPI_IN_PLACE, min_times.data(), num_regions, MPI_DOUBLE, MPI_MIN, IBTK_MPI::getCommunicator());
+    MPI_Allreduce(MPI_IN_PLACE, max_times.data(), num_regions, MPI_DOUBLE, MPI_MAX, IBTK_MPI::getCommunicator());
+    MPI_Allreduce(MPI_IN_PLACE, sum_times.data(), num_regions, MPI_DOUBLE, MPI_SUM, IBTK_MPI::getCommunicator());
+    MPI_Allreduce(MPI_IN_PLACE, max_calls.data(), num_regions, MPI_INT, MPI_MAX, IBTK_MPI::getCommunicator());
+
+    std::vector<RegionSummary> summary;
+    for (unsigned int k = 0; k < order.size(); ++k)
+    {
+        const int idx = order[k];
+        summary.push_back(RegionSummary{
+            all_paths[idx], depths[k], max_calls[idx], min_times[idx], sum_times[idx] / nodes, max_times[idx] });
+    }
+    return summary;
+} // compute_summary
+
+inline double
+imbalance_ratio(const RegionSummary& region)
+{
+    return region.avg_time > 0.0 ? region.max_time / region.avg_time : 1.0;
+} // imbalance_ratio
+
+std::string
+json_string(const std::string& str)
+{
+    std::string result = "\"";
+    for (const char c : str)
+    {
+        if (c == '"' || c == '\\') result += '\\';
+        result += c;
+    }
+    return result + "\"";
+} // json_string
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+PerformanceMonitor::setEnabled(const bool enabled)
+{
+    s_enabled = enabled;
+    return;
+} // setEnabled
+
+void
+PerformanceMonitor::setAnnotationsEnabled(const bool enabled)
+{
+#if defined(IBTK_HAVE_CALIPER) || defined(IBTK_HAVE_NVTX) || defined(IBTK_HAVE_SCOREP) || defined(IBTK_HAVE_ITTNOTIFY)
+    s_annotations_enabled = enabled;
+#else
+    NULL_USE(enabled);
+#endif
+    return;
+} // setAnnotationsEnabled
+
+void
+PerformanceMonitor::startRegion(const char* const name)
+{
+    std::vector<Region>& regions = get_regions();
+    int idx = -1;
+    for (const int child : regions[current_region].children)
+    {
+        if (std::strcmp(regions[child].name.c_str(), name) == 0)
+        {
+            idx = child;
+            break;
+        }
+    }
+    if (idx == -1)
+    {
+        idx = static_cast<int>(regions.size());
+        regions[current_region].children.push_back(idx);
+        regions.push_back(Region{ name, current_region, {}, 0, 0.0, clock_type::time_point() });
+    }
+    Region& region = regions[idx];
+    ++region.num_calls;
+    current_region = idx;
+    region.start = clock_type::now();
+    return;
+} // startRegion
+
+void
+PerformanceMonitor::stopRegion()
+{
+    const clock_type::time_point stop = clock_type::now();
+    if (current_region == 0)
+    {
+        TBOX_ERROR("PerformanceMonitor::stopRegion():\n"
+                   << "  no region is active\n");
+    }
+    Region& region = get_regions()[current_region];
+    region.time += std::chrono::duration<double>(stop - region.start).count();
+    current_region = region.parent;
+    return;
+} // stopRegion
+
+void
+PerformanceMonitor::reset()
+{
+    if (current_region != 0)
+    {
+        TBOX_ERROR("PerformanceMonitor::reset():\n"
+                   << "  region " << get_regions()[current_region].name << " is active\n");
+    }
+    get_regions().resize(1);
+    get_regions()[0].children.clear();
+    return;
+} // reset
+
+void
+PerformanceMonitor::printSummary(std::ostream& os)
+{
+    const std::vector<RegionSummary> summary = compute_summary();
+    os << "PerformanceMonitor summary over " << IBTK_MPI::getNodes() << " processes:\n";
+    os << std::left << std::setw(48) << "region" << std::right << std::setw(10) << "calls" << std::setw(14)
+       << "min [s]" << std::setw(14) << "avg [s]" << std::setw(14) << "max [s]" << std::setw(10) << "max/avg"
+       << "\n";
+    const std::ios_base::fmtflags flags = os.flags();
+    for (const auto& region : summary)
+    {
+        const std::string name = std::string(2 * region.depth, ' ') + region.path.substr(region.path.rfind('/') + 1);
+        os << std::left << std::setw(48) << name << std::right << std::setw(10) << region.max_calls << std::fixed
+           << std::setprecision(4) << std::setw(14) << region.min_time << std::setw(14) << region.avg_time
+           << std::setw(14) << region.max_time << std::setprecision(2) << std::setw(10) << imbalance_ratio(region)
+           << "\n";
+        os.flags(flags);
+    }
+    if (MemoryMonitor::isEnabled()) MemoryMonitor::printSummary(os);
+    return;
+} // printSummary
+
+void
+PerformanceMonitor::writeSummary(const std::string& file_name, const std::map<std::string, std::string>& metadata)
+{
+    const std::vector<RegionSummary> summary = compute_summary();
+    if (IBTK_MPI::getRank() != 0) return;
+    std::ofstream os(file_name);
+    if (!os)
+    {
+        TBOX_ERROR("PerformanceMonitor::writeSummary():\n"
+                   << "  unable to open file " << file_name << "\n");
+    }
+    os << std::setprecision(9);
+    os << "{\n";
+    os << "  \"num_processes\": " << IBTK_MPI::getNodes() << ",\n";
+    if (!metadata.empty())
+    {
+        os << "  \"metadata\": {";
+        bool first = true;
+        for (const auto& pair : metadata)
+        {
+            os << (first ? "\n" : ",\n") << "    " << json_string(pair.first) << ": " << json_string(pair.second);
+            first = false;
+        }
+        os << "\n  },\n";
+    }
+    os << "  \"regions\": [";
+    for (unsigned int k = 0; k < summary.size(); ++k)
+    {
+        const RegionSummary& region = summary[k];
+        os << (k == 0 ? "\n" : ",\n") << "    { \"name\": " << json_string(region.path)
+           << ", \"calls\": " << region.max_calls << ", \"min_time\": " << region.min_time
+           << ", \"avg_time\": " << region.avg_time << ", \"max_time\": " << region.max_time
+           << ", \"imbalance\": " << imbalance_ratio(region) << " }";
+    }
+    os << "\n  ]\n";
+    os << "}\n";
+    return;
+} // writeSummary
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+PerformanceMonitor::beginAnnotation(const char* const name)
+{
+#if defined(IBTK_HAVE_CALIPER)
+    cali_begin_region(name);
+#elif defined(IBTK_HAVE_NVTX)
+    nvtxRangePushA(name);
+#elif defined(IBTK_HAVE_SCOREP)
+    SCOREP_USER_REGION_BY_NAME_BEGIN(name, SCOREP_USER_REGION_TYPE_COMMON);
+#elif defined(IBTK_HAVE_ITTNOTIFY)
+    __itt_task_begin(get_itt_domain(), __itt_null, __itt_null, __itt_string_handle_create(name));
+#else
+    NULL_USE(name);
+#endif
+    return;
+} // beginAnnotation
+
+void
+PerformanceMonitor::endAnnotation(const char* const name)
+{
+#if defined(IBTK_HAVE_CALIPER)
+    cali_end_region(name);
+#elif defined(IBTK_HAVE_NVTX)
+    NULL_USE(name);
+    nvtxRangePop();
+#elif defined(IBTK_HAVE_SCOREP)
+    SCOREP_USER_REGION_BY_NAME_END(name);
+#elif defined(IBTK_HAVE_ITTNOTIFY)
+    NULL_USE(name);
+    __itt_task_end(get_itt_domain());
+#else
+    NULL_USE(name);
+#endif
+    return;
+} // endAnnotation
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,168 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/ReducedPlotHierarchy.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+#include "Box.h"
+#include "BoxArray.h"
+#include "BoxList.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchData.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "ProcessorMapping.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+ReducedPlotHierarchy::ReducedPlotHierarchy(std::string object_name,
+                                           const int finest_plot_ln,
+                                           const BoxList<NDIM>& region)
+    : d_object_name(std::move(object_name)), d_finest_plot_ln(finest_plot_ln), d_region(region)
+{
+    // intentionally blank
+    return;
+} // ReducedPlotHierarchy
+
+void
+ReducedPlotHierarchy::registerPlotDataIndex(const int data_idx)
+{
+    d_plot_data_idxs.insert(data_idx);
+    return;
+} // registerPlotDataIndex
+
+void
+ReducedPlotHierarchy::setFinestPlotLevelNumber(const int finest_plot_ln)
+{
+    d_finest_plot_ln = finest_plot_ln;
+    return;
+} // setFinestPlotLevelNumber
+
+void
+ReducedPlotHierarchy::setRegionOfInterest(const BoxList<NDIM>& region)
+{
+    d_region = region;
+    return;
+} // setRegionOfInterest
+
+Pointer<PatchHierarchy<NDIM> >
+ReducedPlotHierarchy::update(Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(hierarchy);
+#endif
+    if (d_plot_data_idxs.empty())
+    {
+        TBOX_ERROR(d_object_name << "::update():\n"
+                                 << "  no patch data indices have been registered\n");
+    }
+    if (d_finest_plot_ln < 0)
+    {
+        TBOX_ERROR(d_object_name << "::update():\n"
+                                 << "  invalid finest plot level number " << d_finest_plot_ln << "\n");
+    }
+
+    // Free the previous copy before making the new one.
+    clear();
+    d_reduced_hierarchy = new PatchHierarchy<NDIM>(
+        d_object_name + "::reduced_hierarchy", hierarchy->getGridGeometry(), /*register_for_restart*/ false);
+
+    const int finest_ln = std::min(d_finest_plot_ln, hierarchy->getFinestLevelNumber());
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        const BoxArray<NDIM>& boxes = level->getBoxes();
+        const ProcessorMapping& mapping = level->getProcessorMapping();
+
+        // Determine the parts of the patch boxes that lie within the region of
+        // interest.  Each reduced patch is assigned to the process that owns
+        // the patch from which it is copied.
+        BoxList<NDIM> level_region(d_region);
+        level_region.refine(level->getRatio());
+        BoxList<NDIM> reduced_boxes;
+        std::vector<int> src_patch_nums, reduced_procs;
+        for (int i = 0; i < boxes.getNumberOfBoxes(); ++i)
+        {
+            BoxList<NDIM> pieces(boxes[i]);
+            if (!d_region.isEmpty()) pieces.intersectBoxes(level_region);
+            for (BoxList<NDIM>::Iterator b(pieces); b; b++)
+            {
+                reduced_boxes.appendItem(b());
+                src_patch_nums.push_back(i);
+                reduced_procs.push_back(mapping.getProcessorAssignment(i));
+            }
+        }
+
+        // Stop at the first level that does not intersect the region of
+        // interest.
+        if (reduced_boxes.isEmpty()) break;
+
+        ProcessorMapping reduced_mapping(static_cast<int>(reduced_procs.size()));
+        for (unsigned int k = 0; k < reduced_procs.size(); ++k)
+        {
+            reduced_mapping.setProcessorAssignment(k, reduced_procs[k]);
+        }
+        d_reduced_hierarchy->makeNewPatchLevel(ln, level->getRatio(), BoxArray<NDIM>(reduced_boxes), reduced_mapping);
+
+        // Copy the data from the patches of the hierarchy.
+        Pointer<PatchLevel<NDIM> > reduced_level = d_reduced_hierarchy->getPatchLevel(ln);
+        for (const int data_idx : d_plot_data_idxs)
+        {
+            if (!level->checkAllocated(data_idx)) continue;
+            reduced_level->allocatePatchData(data_idx);
+            for (PatchLevel<NDIM>::Iterator p(reduced_level); p; p++)
+            {
+                Pointer<Patch<NDIM> > reduced_patch = reduced_level->getPatch(p());
+                Pointer<Patch<NDIM> > patch = level->getPatch(src_patch_nums[p()]);
+                Pointer<PatchData<NDIM> > src_data = patch->getPatchData(data_idx);
+                Pointer<PatchData<NDIM> > dst_data = reduced_patch->getPatchData(data_idx);
+                dst_data->copy(*src_data);
+                dst_data->setTime(src_data->getTime());
+            }
+        }
+    }
+    return d_reduced_hierarchy;
+} // update
+
+void
+ReducedPlotHierarchy::clear()
+{
+    d_reduced_hierarchy.setNull();
+    return;
+} // clear
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,261 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/RestartFileWriter.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+#include "tbox/RestartManager.h"
+#include "tbox/Utilities.h"
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Create the directory and all of its missing parents.  Unlike
+// Utilities::recursiveMkdir(), this function performs no communication, so it
+// may be called independently by each process and from a background thread.
+bool
+make_directories(const std::string& dirname)
+{
+    for (std::size_t pos = dirname.find('/', 1); pos != std::string::npos; pos = dirname.find('/', pos + 1))
+    {
+        if (mkdir(dirname.substr(0, pos).c_str(), S_IRWXU | S_IRWXG | S_IRWXO) != 0 && errno != EEXIST) return false;
+    }
+    return mkdir(dirname.c_str(), S_IRWXU | S_IRWXG | S_IRWXO) == 0 || errno == EEXIST;
+} // make_directories
+
+// Collect the paths, relative to root_dirname, of all regular files in the
+// directory tree rooted at root_dirname/rel_dirname.
+void
+list_files(const std::string& root_dirname, const std::string& rel_dirname, std::vector<std::string>& files)
+{
+    const std::string dirname = rel_dirname.empty() ? root_dirname : root_dirname + "/" + rel_dirname;
+    DIR* dir = opendir(dirname.c_str());
+    if (!dir) return;
+    while (const dirent* entry = readdir(dir))
+    {
+        const std::string name = entry->d_name;
+        if (name == "." || name == "..") continue;
+        const std::string rel_name = rel_dirname.empty() ? name : rel_dirname + "/" + name;
+        struct stat file_stat;
+        if (stat((root_dirname + "/" + rel_name).c_str(), &file_stat) != 0) continue;
+        if (S_ISDIR(file_stat.st_mode))
+        {
+            list_files(root_dirname, rel_name, files);
+        }
+        else if (S_ISREG(file_stat.st_mode))
+        {
+            files.push_back(rel_name);
+        }
+    }
+    closedir(dir);
+    return;
+} // list_files
+
+// Remove the directory tree rooted at dirname, if it exists.
+void
+remove_tree(const std::string& dirname)
+{
+    std::vector<std::string> files;
+    list_files(dirname, "", files);
+    for (const auto& file : files) std::remove((dirname + "/" + file).c_str());
+    // Remove the (now empty) directories, deepest first.
+    std::function<void(const std::string&)> remove_dirs = [&remove_dirs](const std::string& path) {
+        if (DIR* dir = opendir(path.c_str()))
+        {
+            std::vector<std::string> subdirs;
+            while (const dirent* entry = readdir(dir))
+            {
+                const std::string name = entry->d_name;
+                if (name != "." && name != "..") subdirs.push_back(path + "/" + name);
+            }
+            closedir(dir);
+            for (const auto& subdir : subdirs) remove_dirs(subdir);
+            rmdir(path.c_str());
+        }
+    };
+    remove_dirs(dirname);
+    return;
+} // remove_tree
+
+// Copy a file.  The copy is written to a temporary file that is renamed once it
+// is complete, so that an interrupted copy never leaves a truncated restart
+// file behind.
+bool
+copy_file(const std::string& src_file_name, const std::string& dst_file_name)
+{
+    const std::string tmp_file_name = dst_file_name + ".tmp";
+    {
+        std::ifstream src(src_file_name, std::ios::binary);
+        std::ofstream dst(tmp_file_name, std::ios::binary | std::ios::trunc);
+        if (!src || !dst) return false;
+        if (src.peek() != std::ifstream::traits_type::eof()) dst << src.rdbuf();
+        if (!dst) return false;
+    }
+    return std::rename(tmp_file_name.c_str(), dst_file_name.c_str()) == 0;
+} // copy_file
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+RestartFileWriter::RestartFileWriter(std::string object_name, Pointer<Database> input_db)
+    : d_object_name(std::move(object_name))
+{
+    if (input_db)
+    {
+        if (input_db->keyExists("use_asynchronous_writes"))
+            d_use_async_writes = input_db->getBool("use_asynchronous_writes");
+        if (input_db->keyExists("staging_directory")) d_staging_dirname = input_db->getString("staging_directory");
+    }
+    return;
+} // RestartFileWriter
+
+RestartFileWriter::~RestartFileWriter()
+{
+    if (d_write_thread.joinable()) d_write_thread.join();
+    if (!d_write_error.empty())
+    {
+        TBOX_WARNING(d_object_name << "::~RestartFileWriter():\n"
+                                   << "  " << d_write_error << "\n");
+    }
+    return;
+} // ~RestartFileWriter
+
+void
+RestartFileWriter::setUseAsynchronousWrites(const bool use_async_writes)
+{
+    d_use_async_writes = use_async_writes;
+    return;
+} // setUseAsynchronousWrites
+
+void
+RestartFileWriter::setStagingDirectory(const std::string& staging_dirname)
+{
+    d_staging_dirname = staging_dirname;
+    return;
+} // setStagingDirectory
+
+void
+RestartFileWriter::writeRestartFile(const std::string& restart_dump_dirname,
+                                    const int restore_num,
+                                    const std::vector<WriterFcn>& additional_writers)
+{
+    waitForPendingWrites();
+
+    RestartManager* restart_manager = RestartManager::getManager();
+    if (!d_use_async_writes)
+    {
+        restart_manager->writeRestartFile(restart_dump_dirname, restore_num);
+        for (const auto& writer : additional_writers) writer(restart_dump_dirname);
+        return;
+    }
+
+    // Each process stages its files in its own directory, so that each staged
+    // file is copied by exactly one process even if the staging directory is
+    // shared by several processes.
+    const std::string staged_dirname =
+        d_staging_dirname + "/ibtk_restart_staging.proc." + Utilities::processorToString(IBTK_MPI::getRank());
+    remove_tree(staged_dirname);
+
+    // RestartManager only creates the restart directory on the root process,
+    // which is not sufficient when the staging directories are node-local, so
+    // each process creates its own restart directory (using the same layout
+    // as RestartManager) before the restart files are written.
+    const std::string staged_restore_dirname = staged_dirname + "/restore." + Utilities::intToString(restore_num, 6) +
+                                               "/nodes." + Utilities::nodeToString(IBTK_MPI::getNodes());
+    if (!make_directories(staged_restore_dirname))
+    {
+        TBOX_ERROR(d_object_name << "::writeRestartFile():\n"
+                                 << "  unable to create staging directory " << staged_restore_dirname << "\n");
+    }
+    restart_manager->writeRestartFile(staged_dirname, restore_num);
+    for (const auto& writer : additional_writers) writer(staged_dirname);
+
+    // Copy the staged files from a background thread.
+    std::vector<std::string> files;
+    list_files(staged_dirname, "", files);
+    d_write_thread =
+        std::thread(&RestartFileWriter::copyStagedFiles, this, staged_dirname, restart_dump_dirname, std::move(files));
+    return;
+} // writeRestartFile
+
+void
+RestartFileWriter::waitForPendingWrites()
+{
+    if (d_write_thread.joinable()) d_write_thread.join();
+    if (!d_write_error.empty())
+    {
+        const std::string error = std::move(d_write_error);
+        d_write_error.clear();
+        TBOX_ERROR(d_object_name << "::waitForPendingWrites():\n"
+                                 << "  " << error << "\n");
+    }
+    return;
+} // waitForPendingWrites
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+RestartFileWriter::copyStagedFiles(const std::string staged_dirname,
+                                   const std::string restart_dump_dirname,
+                                   const std::vector<std::string> files)
+{
+    for (const auto& file : files)
+    {
+        const std::string dst_file_name = restart_dump_dirname + "/" + file;
+        const std::size_t pos = dst_file_name.rfind('/');
+        if (!make_directories(dst_file_name.substr(0, pos)))
+        {
+            d_write_error = "unable to create directory " + dst_file_name.substr(0, pos);
+            return;
+        }
+        const std::string src_file_name = staged_dirname + "/" + file;
+        if (!copy_file(src_file_name, dst_file_name))
+        {
+            d_write_error = "unable to copy staged restart file " + src_file_name + " to " + dst_file_name;
+            return;
+        }
+    }
+    remove_tree(staged_dirname);
+    return;
+} // copyStagedFiles
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -13,6 +13,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/MemoryMonitor.h"
 #include "ibtk/SAMRAIDataCache.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -41,6 +42,7 @@
 #include "VariableDatabase.h"
 #include "tbox/Utilities.h"
 
+#include <cstddef>
 #include <utility>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -145,8 +147,22 @@ get_data_characteristics(const int idx, int& depth, int& ghost_width)
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
+SAMRAIDataCache::SAMRAIDataCache()
+{
+    // Report the memory used by the cloned patch data.
+    d_memory_reporter_id = MemoryMonitor::registerReporter("SAMRAI data caches", [this]() {
+        std::size_t bytes = 0;
+        for (auto cloned_idx : d_all_cloned_patch_data_idxs)
+        {
+            bytes += MemoryMonitor::getPatchDataMemory(d_hierarchy, cloned_idx);
+        }
+        return bytes;
+    });
+}
+
 SAMRAIDataCache::~SAMRAIDataCache()
 {
+    MemoryMonitor::unregisterReporter(d_memory_reporter_id);
     setPatchHierarchy(nullptr);
     auto var_db = VariableDatabase<NDIM>::getDatabase();
     for (auto cloned_idx : d_all_cloned_patch_data_idxs)
@@ -0,0 +1,326 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/SpaceFillingCurveLoadBalancer.h"
+#include "ibtk/box_utilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+#include "Box.h"
+#include "CellData.h"
+#include "CellIterator.h"
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "ProcessorMapping.h"
+#include "tbox/PIO.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// The number of bits used to represent each coordinate in a Morton index.
+const int MORTON_BITS = 63 / NDIM;
+
+// Compute the Morton (Z-order) index of a point with nonnegative integer
+// coordinates by interleaving the bits of the coordinates.
+std::uint64_t
+morton_index(const std::array<std::uint64_t, NDIM>& x)
+{
+    std::uint64_t index = 0;
+    for (int bit = MORTON_BITS - 1; bit >= 0; --bit)
+    {
+        for (int d = NDIM - 1; d >= 0; --d)
+        {
+            index = (index << 1) | ((x[d] >> bit) & 1);
+        }
+    }
+    return index;
+} // morton_index
+
+// Compute the area of the face shared by two boxes, or zero if the boxes do
+// not share a face.
+double
+shared_face_area(const hier::Box<NDIM>& a, const hier::Box<NDIM>& b)
+{
+    int touching_axis = -1;
+    double area = 1.0;
+    for (int d = 0; d < NDIM; ++d)
+    {
+        if (a.upper()(d) + 1 == b.lower()(d) || b.upper()(d) + 1 == a.lower()(d))
+        {
+            if (touching_axis != -1) return 0.0;
+            touching_axis = d;
+            continue;
+        }
+        const int overlap = std::min(a.upper()(d), b.upper()(d)) - std::max(a.lower()(d), b.lower()(d)) + 1;
+        if (overlap <= 0) return 0.0;
+        area *= overlap;
+    }
+    return touching_axis == -1 ? 0.0 : area;
+} // shared_face_area
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+SpaceFillingCurveLoadBalancer::SpaceFillingCurveLoadBalancer(const std::string& object_name,
+                                                             Pointer<Database> input_db)
+    : mesh::LoadBalancer<NDIM>(object_name, input_db), d_object_name(object_name)
+{
+    if (input_db) getFromInput(input_db);
+    return;
+} // SpaceFillingCurveLoadBalancer
+
+SpaceFillingCurveLoadBalancer::SpaceFillingCurveLoadBalancer(Pointer<Database> input_db)
+    : mesh::LoadBalancer<NDIM>(input_db), d_object_name("SpaceFillingCurveLoadBalancer")
+{
+    if (input_db) getFromInput(input_db);
+    return;
+} // SpaceFillingCurveLoadBalancer
+
+void
+SpaceFillingCurveLoadBalancer::setWorkloadPatchDataIndex(const int data_id, const int level_number)
+{
+    mesh::LoadBalancer<NDIM>::setWorkloadPatchDataIndex(data_id, level_number);
+    if (level_number < 0) d_workload_idx.clear();
+    d_workload_idx[level_number < 0 ? -1 : level_number] = data_id;
+    return;
+} // setWorkloadPatchDataIndex
+
+void
+SpaceFillingCurveLoadBalancer::loadBalanceBoxes(hier::BoxArray<NDIM>& out_boxes,
+                                                hier::ProcessorMapping& mapping,
+                                                const hier::BoxList<NDIM>& in_boxes,
+                                                const Pointer<hier::PatchHierarchy<NDIM> > hierarchy,
+                                                const int level_number,
+                                                const hier::BoxArray<NDIM>& physical_domain,
+                                                const hier::IntVector<NDIM>& ratio_to_hierarchy_level_zero,
+                                                const hier::IntVector<NDIM>& min_size,
+                                                const hier::IntVector<NDIM>& max_size,
+                                                const hier::IntVector<NDIM>& cut_factor,
+                                                const hier::IntVector<NDIM>& bad_interval) const
+{
+    // Let the parent class chop the boxes.  We only keep the boxes and
+    // recompute the mapping.
+    mesh::LoadBalancer<NDIM>::loadBalanceBoxes(out_boxes,
+                                               mapping,
+                                               in_boxes,
+                                               hierarchy,
+                                               level_number,
+                                               physical_domain,
+                                               ratio_to_hierarchy_level_zero,
+                                               min_size,
+                                               max_size,
+                                               cut_factor,
+                                               bad_interval);
+    const int n_boxes = out_boxes.size();
+    const int n_nodes = SAMRAI_MPI::getNodes();
+    if (n_boxes == 0) return;
+
+    // Order the boxes along the space-filling curve.  The curve is laid out on
+    // a grid with spacing equal to the smallest box width so that the curve
+    // index of each box center is determined by a modest number of bits.
+    hier::Box<NDIM> bounding_box = out_boxes[0];
+    int min_width = std::numeric_limits<int>::max();
+    for (int i = 0; i < n_boxes; ++i)
+    {
+        bounding_box += out_boxes[i];
+        for (int d = 0; d < NDIM; ++d) min_width = std::min(min_width, out_boxes[i].numberCells(d));
+    }
+    min_width = std::max(min_width, 1);
+    std::vector<std::pair<std::uint64_t, int> > curve_order(n_boxes);
+    for (int i = 0; i < n_boxes; ++i)
+    {
+        std::array<std::uint64_t, NDIM> x;
+        for (int d = 0; d < NDIM; ++d)
+        {
+            const int center_offset =
+                (out_boxes[i].lower()(d) + out_boxes[i].upper()(d)) / 2 - bounding_box.lower()(d);
+            x[d] = static_cast<std::uint64_t>(center_offset / min_width);
+        }
+        curve_order[i] = std::make_pair(morton_index(x), i);
+    }
+    std::stable_sort(curve_order.begin(), curve_order.end());
+
+    // Compute the prefix sums of the workloads along the curve.
+    const std::vector<double> workloads = computeBoxWorkloads(out_boxes, hierarchy, level_number);
+    std::vector<double> prefix(n_boxes + 1, 0.0);
+    for (int k = 0; k < n_boxes; ++k) prefix[k + 1] = prefix[k] + workloads[curve_order[k].second];
+    const double avg_workload = prefix[n_boxes] / n_nodes;
+
+    // Compute the area cut by splitting the curve between positions k - 1 and
+    // k.  A face shared by the boxes at positions a < b is cut by all splits
+    // a < k <= b, which we accumulate with a difference array.
+    std::vector<double> cut_area(n_boxes + 1, 0.0);
+    for (int a = 0; a < n_boxes; ++a)
+    {
+        const hier::Box<NDIM>& box_a = out_boxes[curve_order[a].second];
+        for (int b = a + 1; b < n_boxes; ++b)
+        {
+            const double area = shared_face_area(box_a, out_boxes[curve_order[b].second]);
+            if (area == 0.0) continue;
+            cut_area[a + 1] += area;
+            cut_area[b + 1] -= area;
+        }
+    }
+    std::partial_sum(cut_area.begin(), cut_area.end(), cut_area.begin());
+
+    // Determine the split points.  Among the split points whose prefix
+    // workload is within the tolerance of the ideal split, pick the one that
+    // cuts the smallest area.
+    std::vector<int> splits(n_nodes + 1, n_boxes);
+    splits[0] = 0;
+    for (int r = 1; r < n_nodes; ++r)
+    {
+        const double target = r * avg_workload;
+        const double tolerance = d_cut_tolerance * avg_workload;
+        int best_k = -1;
+        for (int k = splits[r - 1]; k <= n_boxes; ++k)
+        {
+            if (prefix[k] > target + tolerance) break;
+            if (prefix[k] < target - tolerance) continue;
+            if (best_k == -1 || cut_area[k] < cut_area[best_k] ||
+                (cut_area[k] == cut_area[best_k] && std::abs(prefix[k] - target) < std::abs(prefix[best_k] - target)))
+            {
+                best_k = k;
+            }
+        }
+        if (best_k == -1)
+        {
+            // No split point is within the tolerance, so take the closest one.
+            best_k = splits[r - 1];
+            while (best_k < n_boxes && prefix[best_k + 1] <= target) ++best_k;
+            if (best_k < n_boxes && target - prefix[best_k] > prefix[best_k + 1] - target) ++best_k;
+        }
+        splits[r] = best_k;
+    }
+
+    // Assign the boxes to processes, optionally merging the boxes on each
+    // process.
+    std::vector<std::pair<int, hier::Box<NDIM> > > new_boxes;
+    for (int r = 0; r < n_nodes; ++r)
+    {
+        std::vector<hier::Box<NDIM> > boxes;
+        for (int k = splits[r]; k < splits[r + 1]; ++k) boxes.push_back(out_boxes[curve_order[k].second]);
+        if (d_merge_boxes) boxes = merge_boxes_by_longest_edge(boxes);
+        for (const hier::Box<NDIM>& box : boxes) new_boxes.emplace_back(r, box);
+    }
+    mapping.setMappingSize(static_cast<int>(new_boxes.size()));
+    out_boxes.resizeBoxArray(static_cast<int>(new_boxes.size()));
+    for (unsigned int i = 0; i < new_boxes.size(); ++i)
+    {
+        mapping.setProcessorAssignment(i, new_boxes[i].first);
+        out_boxes[i] = new_boxes[i].second;
+    }
+
+    if (d_enable_logging)
+    {
+        double max_workload = 0.0, total_cut_area = 0.0;
+        for (int r = 0; r < n_nodes; ++r)
+        {
+            max_workload = std::max(max_workload, prefix[splits[r + 1]] - prefix[splits[r]]);
+            if (r > 0) total_cut_area += cut_area[splits[r]];
+        }
+        plog << d_object_name << "::loadBalanceBoxes(): level " << level_number << ": " << n_boxes
+             << " boxes, max/avg workload = " << (avg_workload > 0.0 ? max_workload / avg_workload : 1.0)
+             << ", cut area = " << total_cut_area << "\n";
+    }
+    return;
+} // loadBalanceBoxes
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+SpaceFillingCurveLoadBalancer::getFromInput(Pointer<Database> input_db)
+{
+    d_cut_tolerance = input_db->getDoubleWithDefault("cut_tolerance", d_cut_tolerance);
+    d_merge_boxes = input_db->getBoolWithDefault("merge_boxes", d_merge_boxes);
+    d_enable_logging = input_db->getBoolWithDefault("enable_logging", d_enable_logging);
+    if (d_cut_tolerance < 0.0)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                   << "  cut_tolerance must be nonnegative\n");
+    }
+    return;
+} // getFromInput
+
+std::vector<double>
+SpaceFillingCurveLoadBalancer::computeBoxWorkloads(const hier::BoxArray<NDIM>& boxes,
+                                                   Pointer<hier::PatchHierarchy<NDIM> > hierarchy,
+                                                   const int level_number) const
+{
+    const int n_boxes = boxes.size();
+    std::vector<double> workloads(n_boxes, 0.0);
+
+    // Look up the workload data on the existing level, if any.
+    int workload_idx = -1;
+    auto it = d_workload_idx.find(level_number);
+    if (it == d_workload_idx.end()) it = d_workload_idx.find(-1);
+    if (it != d_workload_idx.end()) workload_idx = it->second;
+    Pointer<PatchLevel<NDIM> > level =
+        hierarchy && level_number <= hierarchy->getFinestLevelNumber() ? hierarchy->getPatchLevel(level_number) :
+                                                                          Pointer<PatchLevel<NDIM> >(nullptr);
+    const bool use_workload_data = workload_idx != -1 && level && level->checkAllocated(workload_idx);
+    if (!use_workload_data)
+    {
+        for (int i = 0; i < n_boxes; ++i) workloads[i] = boxes[i].size();
+        return workloads;
+    }
+
+    // Sum the workload over the parts of the boxes covered by local patches
+    // and then over all processes.  Parts of boxes that are not covered by the
+    // existing level are assigned a unit workload per cell.
+    std::vector<double> covered_cells(n_boxes, 0.0);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > workload_data = patch->getPatchData(workload_idx);
+        const hier::Box<NDIM>& patch_box = patch->getBox();
+        for (int i = 0; i < n_boxes; ++i)
+        {
+            const hier::Box<NDIM> overlap = patch_box * boxes[i];
+            if (overlap.empty()) continue;
+            for (CellIterator<NDIM> ic(overlap); ic; ic++) workloads[i] += (*workload_data)(ic());
+            covered_cells[i] += overlap.size();
+        }
+    }
+    SAMRAI_MPI::sumReduction(&workloads[0], n_boxes);
+    SAMRAI_MPI::sumReduction(&covered_cells[0], n_boxes);
+    for (int i = 0; i < n_boxes; ++i) workloads[i] += std::max(boxes[i].size() - covered_cells[i], 0.0);
+    return workloads;
+} // computeBoxWorkloads
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -89,6 +89,8 @@ StreamableManager::registerFactory(Pointer<StreamableFactory> factory)
     SAMRAI_MPI::barrier();
     factory->setStreamableClassID(factory_id);
     d_factory_map[factory_id] = factory;
+    if (factory_id >= static_cast<int>(d_factory_table.size())) d_factory_table.resize(factory_id + 1, nullptr);
+    d_factory_table[factory_id] = factory.getPointer();
     return factory_id;
 } // registerFactory
 
@@ -102,6 +104,7 @@ StreamableManager::StreamableManager() : d_factory_map()
 
 StreamableManager::~StreamableManager()
 {
+    d_factory_table.clear();
     d_factory_map.clear();
     return;
 } // ~StreamableManager
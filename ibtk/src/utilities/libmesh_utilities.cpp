@@ -61,6 +61,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <sstream>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -86,33 +87,44 @@ getQuadratureKey(const libMesh::QuadratureType quad_type,
 #endif
     if (use_adaptive_quadrature)
     {
-        const double hmax = get_max_edge_length(elem, X_node);
-        int npts = int(std::ceil(point_density * hmax / dx_min));
-        if (npts < 3)
-        {
-            if (elem->default_order() == libMesh::FIRST)
-                npts = 2;
-            else
-                npts = 3;
-        }
-        switch (quad_type)
-        {
-        case libMesh::QGAUSS:
-            order = static_cast<libMesh::Order>(std::min(2 * npts - 1, static_cast<int>(libMesh::FORTYTHIRD)));
-            break;
-        case libMesh::QGRID:
-            order = static_cast<libMesh::Order>(npts);
-            break;
-        default:
-            TBOX_ERROR("IBTK::getQuadratureKey():\n"
-                       << "  adaptive quadrature rules are available only for quad_type = QGAUSS "
-                          "or QGRID\n");
-        }
+        return getAdaptiveQuadratureKey(quad_type, point_density, elem, get_max_edge_length(elem, X_node), dx_min);
     }
 
     return std::make_tuple(elem_type, quad_type, order);
 }
 
+std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>
+getAdaptiveQuadratureKey(const libMesh::QuadratureType quad_type,
+                         const double point_density,
+                         const libMesh::Elem* const elem,
+                         const double hmax,
+                         const double dx_min)
+{
+    int npts = int(std::ceil(point_density * hmax / dx_min));
+    if (npts < 3)
+    {
+        if (elem->default_order() == libMesh::FIRST)
+            npts = 2;
+        else
+            npts = 3;
+    }
+    libMesh::Order order = libMesh::INVALID_ORDER;
+    switch (quad_type)
+    {
+    case libMesh::QGAUSS:
+        order = static_cast<libMesh::Order>(std::min(2 * npts - 1, static_cast<int>(libMesh::FORTYTHIRD)));
+        break;
+    case libMesh::QGRID:
+        order = static_cast<libMesh::Order>(npts);
+        break;
+    default:
+        TBOX_ERROR("IBTK::getQuadratureKey():\n"
+                   << "  adaptive quadrature rules are available only for quad_type = QGAUSS "
+                      "or QGRID\n");
+    }
+    return std::make_tuple(elem->type(), quad_type, order);
+}
+
 void
 write_elem_partitioning(const std::string& file_name, const libMesh::System& position_system)
 {
@@ -437,6 +449,314 @@ get_global_active_element_bounding_boxes(const libMesh::MeshBase& mesh, const li
                   "work correctly.");
     return get_global_active_element_bounding_boxes(mesh, get_local_active_element_bounding_boxes(mesh, X_system));
 } // get_global_active_element_bounding_boxes
+
+BoundingBoxGrid::BoundingBoxGrid(std::vector<libMeshWrappers::BoundingBox> bboxes, const double bin_width)
+    : d_bboxes(std::move(bboxes)), d_bin_width(bin_width)
+{
+    d_n_bins.fill(1);
+    if (d_bboxes.empty())
+    {
+        d_bin_offsets.assign(2, 0);
+        return;
+    }
+
+    // Determine the extents of the grid and the average size of the boxes.
+    libMesh::Point x_upper;
+    double avg_box_width = 0.0;
+    for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+    {
+        d_x_lower(d) = std::numeric_limits<double>::max();
+        x_upper(d) = std::numeric_limits<double>::lowest();
+    }
+    for (const libMeshWrappers::BoundingBox& bbox : d_bboxes)
+    {
+        double box_width = 0.0;
+        for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+        {
+            d_x_lower(d) = std::min(d_x_lower(d), bbox.first(d));
+            x_upper(d) = std::max(x_upper(d), bbox.second(d));
+            box_width = std::max(box_width, bbox.second(d) - bbox.first(d));
+        }
+        avg_box_width += box_width;
+    }
+    avg_box_width /= static_cast<double>(d_bboxes.size());
+
+    // Pick a bin width that results in roughly one bin per box (only
+    // accounting for dimensions with nonzero extents).
+    if (d_bin_width <= 0.0)
+    {
+        double volume = 1.0;
+        unsigned int n_nonzero_dims = 0;
+        for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+        {
+            const double extent = x_upper(d) - d_x_lower(d);
+            if (extent > 0.0)
+            {
+                volume *= extent;
+                ++n_nonzero_dims;
+            }
+        }
+        if (n_nonzero_dims > 0)
+        {
+            d_bin_width = std::pow(volume / static_cast<double>(d_bboxes.size()), 1.0 / n_nonzero_dims);
+        }
+        d_bin_width = std::max(d_bin_width, avg_box_width);
+    }
+    if (d_bin_width <= 0.0) d_bin_width = 1.0;
+    std::size_t n_total_bins = 1;
+    for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+    {
+        const double extent = x_upper(d) - d_x_lower(d);
+        d_n_bins[d] = std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(extent / d_bin_width)));
+        n_total_bins *= d_n_bins[d];
+    }
+
+    // Count the number of boxes in each bin and then fill the bins.
+    const auto bin_index = [this](const std::array<std::size_t, LIBMESH_DIM>& i) -> std::size_t {
+        std::size_t index = 0;
+        for (int d = LIBMESH_DIM - 1; d >= 0; --d) index = index * d_n_bins[d] + i[d];
+        return index;
+    };
+    std::array<std::size_t, LIBMESH_DIM> lower, upper, i;
+    d_bin_offsets.assign(n_total_bins + 1, 0);
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        std::vector<std::size_t> bin_fill;
+        if (pass == 1)
+        {
+            for (std::size_t k = 0; k < n_total_bins; ++k) d_bin_offsets[k + 1] += d_bin_offsets[k];
+            d_bin_boxes.resize(d_bin_offsets.back());
+            bin_fill.assign(d_bin_offsets.begin(), d_bin_offsets.end() - 1);
+        }
+        for (std::size_t box_n = 0; box_n < d_bboxes.size(); ++box_n)
+        {
+            getBinRange(d_bboxes[box_n], lower, upper);
+            i = lower;
+            while (true)
+            {
+                const std::size_t index = bin_index(i);
+                if (pass == 0)
+                    ++d_bin_offsets[index + 1];
+                else
+                    d_bin_boxes[bin_fill[index]++] = box_n;
+
+                // Advance to the next bin in the range.
+                unsigned int d = 0;
+                for (; d < LIBMESH_DIM; ++d)
+                {
+                    if (i[d] < upper[d])
+                    {
+                        ++i[d];
+                        break;
+                    }
+                    i[d] = lower[d];
+                }
+                if (d == LIBMESH_DIM) break;
+            }
+        }
+    }
+    return;
+} // BoundingBoxGrid
+
+void
+BoundingBoxGrid::findIntersectingBoxes(const libMeshWrappers::BoundingBox& query_bbox,
+                                       std::vector<std::size_t>& indices) const
+{
+    indices.clear();
+    if (d_bboxes.empty()) return;
+    for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+    {
+        if (query_bbox.second(d) < d_x_lower(d) ||
+            query_bbox.first(d) > d_x_lower(d) + d_bin_width * static_cast<double>(d_n_bins[d]))
+        {
+            return;
+        }
+    }
+    std::array<std::size_t, LIBMESH_DIM> lower, upper, i;
+    getBinRange(query_bbox, lower, upper);
+    i = lower;
+    while (true)
+    {
+        std::size_t index = 0;
+        for (int d = LIBMESH_DIM - 1; d >= 0; --d) index = index * d_n_bins[d] + i[d];
+        for (std::size_t k = d_bin_offsets[index]; k < d_bin_offsets[index + 1]; ++k)
+        {
+            const std::size_t box_n = d_bin_boxes[k];
+#if LIBMESH_VERSION_LESS_THAN(1, 2, 0)
+            if (d_bboxes[box_n].intersect(query_bbox)) indices.push_back(box_n);
+#else
+            if (d_bboxes[box_n].intersects(query_bbox)) indices.push_back(box_n);
+#endif
+        }
+
+        // Advance to the next bin in the range.
+        unsigned int d = 0;
+        for (; d < LIBMESH_DIM; ++d)
+        {
+            if (i[d] < upper[d])
+            {
+                ++i[d];
+                break;
+            }
+            i[d] = lower[d];
+        }
+        if (d == LIBMESH_DIM) break;
+    }
+
+    // Boxes spanning several bins are found more than once.
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+    return;
+} // findIntersectingBoxes
+
+void
+BoundingBoxGrid::getBinRange(const libMeshWrappers::BoundingBox& bbox,
+                             std::array<std::size_t, LIBMESH_DIM>& lower,
+                             std::array<std::size_t, LIBMESH_DIM>& upper) const
+{
+    for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+    {
+        const double max_bin = static_cast<double>(d_n_bins[d] - 1);
+        const double lower_bin = std::floor((bbox.first(d) - d_x_lower(d)) / d_bin_width);
+        const double upper_bin = std::floor((bbox.second(d) - d_x_lower(d)) / d_bin_width);
+        lower[d] = static_cast<std::size_t>(std::min(std::max(lower_bin, 0.0), max_bin));
+        upper[d] = static_cast<std::size_t>(std::min(std::max(upper_bin, 0.0), max_bin));
+    }
+    return;
+} // getBinRange
+
+BoundingBoxTree::BoundingBoxTree(std::vector<libMeshWrappers::BoundingBox> bboxes) : d_bboxes(std::move(bboxes))
+{
+    d_box_order.resize(d_bboxes.size());
+    for (std::size_t k = 0; k < d_box_order.size(); ++k) d_box_order[k] = k;
+    if (d_bboxes.empty()) return;
+    d_nodes.reserve(2 * d_bboxes.size());
+    buildNode(0, d_bboxes.size());
+    computeNodeBoxes();
+    return;
+} // BoundingBoxTree
+
+void
+BoundingBoxTree::refit(std::vector<libMeshWrappers::BoundingBox> bboxes)
+{
+    TBOX_ASSERT(bboxes.size() == d_bboxes.size());
+    d_bboxes = std::move(bboxes);
+    computeNodeBoxes();
+    return;
+} // refit
+
+void
+BoundingBoxTree::findIntersectingBoxes(const libMeshWrappers::BoundingBox& query_bbox,
+                                       std::vector<std::size_t>& indices) const
+{
+    indices.clear();
+    if (d_nodes.empty()) return;
+    const auto intersects = [&query_bbox](const libMeshWrappers::BoundingBox& bbox) {
+        for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+        {
+            if (bbox.second(d) < query_bbox.first(d) || query_bbox.second(d) < bbox.first(d)) return false;
+        }
+        return true;
+    };
+    std::vector<std::size_t> stack(1, 0);
+    while (!stack.empty())
+    {
+        const std::size_t node_n = stack.back();
+        const Node& node = d_nodes[node_n];
+        stack.pop_back();
+        if (!intersects(node.bbox)) continue;
+        if (node.right_child == 0)
+        {
+            for (std::size_t k = node.begin; k < node.end; ++k)
+            {
+                if (intersects(d_bboxes[d_box_order[k]])) indices.push_back(d_box_order[k]);
+            }
+        }
+        else
+        {
+            stack.push_back(node.right_child);
+            stack.push_back(node_n + 1);
+        }
+    }
+    std::sort(indices.begin(), indices.end());
+    return;
+} // findIntersectingBoxes
+
+std::size_t
+BoundingBoxTree::buildNode(const std::size_t begin, const std::size_t end)
+{
+    // Leaves hold a few boxes so that the tree is not needlessly deep.
+    static const std::size_t max_leaf_size = 4;
+    const std::size_t node_n = d_nodes.size();
+    d_nodes.push_back(Node{ libMeshWrappers::BoundingBox(), begin, end, 0 });
+    if (end - begin <= max_leaf_size) return node_n;
+
+    // Split the boxes at the median of their centers along the axis in which
+    // the centers are most spread out.
+    const auto center = [this](const std::size_t box_n, const unsigned int d) {
+        return 0.5 * (d_bboxes[box_n].first(d) + d_bboxes[box_n].second(d));
+    };
+    unsigned int split_axis = 0;
+    double max_extent = -1.0;
+    for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+    {
+        double c_min = std::numeric_limits<double>::max(), c_max = std::numeric_limits<double>::lowest();
+        for (std::size_t k = begin; k < end; ++k)
+        {
+            c_min = std::min(c_min, center(d_box_order[k], d));
+            c_max = std::max(c_max, center(d_box_order[k], d));
+        }
+        if (c_max - c_min > max_extent)
+        {
+            max_extent = c_max - c_min;
+            split_axis = d;
+        }
+    }
+    const std::size_t mid = begin + (end - begin) / 2;
+    std::nth_element(d_box_order.begin() + begin,
+                     d_box_order.begin() + mid,
+                     d_box_order.begin() + end,
+                     [&center, split_axis](const std::size_t a, const std::size_t b) {
+                         return center(a, split_axis) < center(b, split_axis);
+                     });
+    buildNode(begin, mid);
+    const std::size_t right_child = buildNode(mid, end);
+    d_nodes[node_n].right_child = right_child;
+    return node_n;
+} // buildNode
+
+void
+BoundingBoxTree::computeNodeBoxes()
+{
+    // Children are stored after their parents, so a reverse sweep visits
+    // every child before its parent.
+    for (std::size_t n = d_nodes.size(); n-- > 0;)
+    {
+        Node& node = d_nodes[n];
+        for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+        {
+            node.bbox.first(d) = std::numeric_limits<double>::max();
+            node.bbox.second(d) = std::numeric_limits<double>::lowest();
+        }
+        const auto merge = [&node](const libMeshWrappers::BoundingBox& bbox) {
+            for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+            {
+                node.bbox.first(d) = std::min(node.bbox.first(d), bbox.first(d));
+                node.bbox.second(d) = std::max(node.bbox.second(d), bbox.second(d));
+            }
+        };
+        if (node.right_child == 0)
+        {
+            for (std::size_t k = node.begin; k < node.end; ++k) merge(d_bboxes[d_box_order[k]]);
+        }
+        else
+        {
+            merge(d_nodes[n + 1].bbox);
+            merge(d_nodes[node.right_child].bbox);
+        }
+    }
+    return;
+} // computeNodeBoxes
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -16,6 +16,7 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/muParserCartGridFunction.h"
+#include "ibtk/muParserExpressionCompiler.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
 #include "Box.h"
@@ -49,10 +50,13 @@
 #include "muParserError.h"
 
 #include <algorithm>
+#include <array>
+#include <functional>
 #include <map>
 #include <memory>
 #include <ostream>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -80,6 +84,19 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// The data centerings for which cached function values are distinguished.
+enum DataCentering
+{
+    CELL_CENTERED,
+    FACE_CENTERED,
+    NODE_CENTERED,
+    SIDE_CENTERED,
+    EDGE_CENTERED
+};
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 muParserCartGridFunction::muParserCartGridFunction(std::string object_name,
@@ -256,6 +273,35 @@ muParserCartGridFunction::muParserCartGridFunction(std::string object_name,
             parser.DefineVar("x_" + postfix, &(d_parser_posn[d]));
         }
     }
+
+    // Determine which functions depend on time.  If this cannot be determined
+    // (e.g., because the function is not valid), the function is assumed to be
+    // time-dependent so that errors are reported when it is evaluated.
+    if (input_db->keyExists("cache_time_independent_values"))
+        d_cache_time_independent_values = input_db->getBool("cache_time_independent_values");
+    for (auto& parser : d_parsers)
+    {
+        bool time_dependent = true;
+        try
+        {
+            const mu::varmap_type& used_vars = parser.GetUsedVar();
+            time_dependent = used_vars.count("t") > 0 || used_vars.count("T") > 0;
+        }
+        catch (...)
+        {
+            time_dependent = true;
+        }
+        d_time_dependent.push_back(time_dependent);
+    }
+
+    // Optionally compile the functions into native code.
+    if (input_db->keyExists("use_compiled_expressions") && input_db->getBool("use_compiled_expressions"))
+    {
+        std::vector<const mu::Parser*> parsers;
+        for (const auto& parser : d_parsers) parsers.push_back(&parser);
+        d_compiler.reset(new muParserExpressionCompiler(
+            d_object_name, parsers, &d_parser_time, d_parser_posn.data(), input_db));
+    }
     return;
 } // muParserCartGridFunction
 
@@ -272,18 +318,48 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                                          const double data_time,
                                          const bool /*initial_time*/,
                                          Pointer<PatchLevel<NDIM> > /*level*/)
+{
+    evaluateOnPatch(data_idx, *patch, data_time, /*add*/ false);
+    return;
+} // setDataOnPatch
+
+bool
+muParserCartGridFunction::supportsAddDataOnPatch() const
+{
+    return true;
+} // supportsAddDataOnPatch
+
+void
+muParserCartGridFunction::addDataOnPatch(const int data_idx,
+                                         Pointer<Variable<NDIM> > /*var*/,
+                                         Pointer<Patch<NDIM> > patch,
+                                         const double data_time,
+                                         const bool /*initial_time*/,
+                                         Pointer<PatchLevel<NDIM> > /*level*/)
+{
+    evaluateOnPatch(data_idx, *patch, data_time, /*add*/ true);
+    return;
+} // addDataOnPatch
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+muParserCartGridFunction::evaluateOnPatch(const int data_idx,
+                                          Patch<NDIM>& patch,
+                                          const double data_time,
+                                          const bool add)
 {
     d_parser_time = data_time;
 
-    const Box<NDIM>& patch_box = patch->getBox();
+    const Box<NDIM>& patch_box = patch.getBox();
     const hier::Index<NDIM>& patch_lower = patch_box.lower();
-    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
 
     const double* const XLower = pgeom->getXLower();
     const double* const dx = pgeom->getDx();
 
     // Set the data in the patch.
-    Pointer<PatchData<NDIM> > data = patch->getPatchData(data_idx);
+    Pointer<PatchData<NDIM> > data = patch.getPatchData(data_idx);
 #if !defined(NDEBUG)
     TBOX_ASSERT(data);
 #endif
@@ -300,28 +376,25 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
         for (int data_depth = 0; data_depth < cc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
-            {
-                const CellIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                }
-                try
+            auto compute_positions = [&](std::vector<std::array<double, NDIM> >& X) {
+                for (CellIterator<NDIM> ic(patch_box); ic; ic++)
                 {
-                    (*cc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: " << e.GetMsg() << "\n"
-                               << "  in:    " << e.GetExpr() << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
+                    const CellIndex<NDIM>& i = ic();
+                    std::array<double, NDIM> posn;
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                    }
+                    X.push_back(posn);
                 }
+            };
+            const std::vector<double>& values =
+                evaluateFunction(function_depth, CELL_CENTERED, 0, patch, compute_positions);
+            std::size_t k = 0;
+            for (CellIterator<NDIM> ic(patch_box); ic; ic++, ++k)
+            {
+                double& value = (*cc_data)(ic(), data_depth);
+                value = add ? value + values[k] : values[k];
             }
         }
     }
@@ -336,57 +409,34 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
         {
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
-                int function_depth = -1;
-                const int parsers_size = static_cast<int>(d_parsers.size());
-                const int fc_data_depth = fc_data->getDepth();
-                if (parsers_size == 1)
-                {
-                    function_depth = 0;
-                }
-                else if (parsers_size == NDIM)
-                {
-                    function_depth = axis;
-                }
-                else if (parsers_size == fc_data_depth)
-                {
-                    function_depth = data_depth;
-                }
-                else if (parsers_size == NDIM * fc_data_depth)
-                {
-                    function_depth = NDIM * data_depth + axis;
-                }
-
-                for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++)
-                {
-                    const FaceIndex<NDIM>& i = ic();
-                    const hier::Index<NDIM>& cell_idx = i.toCell(1);
-                    for (unsigned int d = 0; d < NDIM; ++d)
+                const int function_depth = getFunctionDepth(data_depth, axis, fc_data->getDepth());
+                auto compute_positions = [&](std::vector<std::array<double, NDIM> >& X) {
+                    for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++)
                     {
-                        if (d == axis)
+                        const FaceIndex<NDIM>& i = ic();
+                        const hier::Index<NDIM>& cell_idx = i.toCell(1);
+                        std::array<double, NDIM> posn;
+                        for (unsigned int d = 0; d < NDIM; ++d)
                         {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] =
-                                XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)) + 0.5);
+                            if (d == axis)
+                            {
+                                posn[d] = XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)));
+                            }
+                            else
+                            {
+                                posn[d] = XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)) + 0.5);
+                            }
                         }
+                        X.push_back(posn);
                     }
-                    try
-                    {
-                        (*fc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: " << e.GetMsg() << "\n"
-                                   << "  in:    " << e.GetExpr() << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
+                };
+                const std::vector<double>& values =
+                    evaluateFunction(function_depth, FACE_CENTERED, axis, patch, compute_positions);
+                std::size_t k = 0;
+                for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
+                {
+                    double& value = (*fc_data)(ic(), data_depth);
+                    value = add ? value + values[k] : values[k];
                 }
             }
         }
@@ -399,28 +449,25 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
         for (int data_depth = 0; data_depth < nc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (NodeIterator<NDIM> ic(patch_box); ic; ic++)
-            {
-                const NodeIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                }
-                try
-                {
-                    (*nc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
+            auto compute_positions = [&](std::vector<std::array<double, NDIM> >& X) {
+                for (NodeIterator<NDIM> ic(patch_box); ic; ic++)
                 {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: " << e.GetMsg() << "\n"
-                               << "  in:    " << e.GetExpr() << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
+                    const NodeIndex<NDIM>& i = ic();
+                    std::array<double, NDIM> posn;
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                    }
+                    X.push_back(posn);
                 }
+            };
+            const std::vector<double>& values =
+                evaluateFunction(function_depth, NODE_CENTERED, 0, patch, compute_positions);
+            std::size_t k = 0;
+            for (NodeIterator<NDIM> ic(patch_box); ic; ic++, ++k)
+            {
+                double& value = (*nc_data)(ic(), data_depth);
+                value = add ? value + values[k] : values[k];
             }
         }
     }
@@ -435,55 +482,33 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
         {
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
-                int function_depth = -1;
-                const int parsers_size = static_cast<int>(d_parsers.size());
-                const int sc_data_depth = sc_data->getDepth();
-                if (parsers_size == 1)
-                {
-                    function_depth = 0;
-                }
-                else if (parsers_size == NDIM)
-                {
-                    function_depth = axis;
-                }
-                else if (parsers_size == sc_data_depth)
-                {
-                    function_depth = data_depth;
-                }
-                else if (parsers_size == NDIM * sc_data_depth)
-                {
-                    function_depth = NDIM * data_depth + axis;
-                }
-
-                for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++)
-                {
-                    const SideIndex<NDIM>& i = ic();
-                    for (unsigned int d = 0; d < NDIM; ++d)
+                const int function_depth = getFunctionDepth(data_depth, axis, sc_data->getDepth());
+                auto compute_positions = [&](std::vector<std::array<double, NDIM> >& X) {
+                    for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++)
                     {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                        }
-                        else
+                        const SideIndex<NDIM>& i = ic();
+                        std::array<double, NDIM> posn;
+                        for (unsigned int d = 0; d < NDIM; ++d)
                         {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                            if (d == axis)
+                            {
+                                posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                            }
+                            else
+                            {
+                                posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                            }
                         }
+                        X.push_back(posn);
                     }
-                    try
-                    {
-                        (*sc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: " << e.GetMsg() << "\n"
-                                   << "  in:    " << e.GetExpr() << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
+                };
+                const std::vector<double>& values =
+                    evaluateFunction(function_depth, SIDE_CENTERED, axis, patch, compute_positions);
+                std::size_t k = 0;
+                for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
+                {
+                    double& value = (*sc_data)(ic(), data_depth);
+                    value = add ? value + values[k] : values[k];
                 }
             }
         }
@@ -499,66 +524,133 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
         {
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
-                int function_depth = -1;
-                const int parsers_size = static_cast<int>(d_parsers.size());
-                const int ec_data_depth = ec_data->getDepth();
-                if (parsers_size == 1)
-                {
-                    function_depth = 0;
-                }
-                else if (parsers_size == NDIM)
-                {
-                    function_depth = axis;
-                }
-                else if (parsers_size == ec_data_depth)
-                {
-                    function_depth = data_depth;
-                }
-                else if (parsers_size == NDIM * ec_data_depth)
-                {
-                    function_depth = NDIM * data_depth + axis;
-                }
-
-                for (EdgeIterator<NDIM> ic(patch_box, axis); ic; ic++)
-                {
-                    const EdgeIndex<NDIM>& i = ic();
-                    for (unsigned int d = 0; d < NDIM; ++d)
+                const int function_depth = getFunctionDepth(data_depth, axis, ec_data->getDepth());
+                auto compute_positions = [&](std::vector<std::array<double, NDIM> >& X) {
+                    for (EdgeIterator<NDIM> ic(patch_box, axis); ic; ic++)
                     {
-                        if (d == axis)
+                        const EdgeIndex<NDIM>& i = ic();
+                        std::array<double, NDIM> posn;
+                        for (unsigned int d = 0; d < NDIM; ++d)
                         {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                            if (d == axis)
+                            {
+                                posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                            }
+                            else
+                            {
+                                posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                            }
                         }
-                        else
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                        }
-                    }
-                    try
-                    {
-                        (*ec_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: " << e.GetMsg() << "\n"
-                                   << "  in:    " << e.GetExpr() << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
+                        X.push_back(posn);
                     }
+                };
+                const std::vector<double>& values =
+                    evaluateFunction(function_depth, EDGE_CENTERED, axis, patch, compute_positions);
+                std::size_t k = 0;
+                for (EdgeIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
+                {
+                    double& value = (*ec_data)(ic(), data_depth);
+                    value = add ? value + values[k] : values[k];
                 }
             }
         }
     }
     else
     {
-        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+        TBOX_ERROR("muParserCartGridFunction::evaluateOnPatch():\n"
                    << "  unsupported patch data type encountered." << std::endl);
     }
     return;
-} // setDataOnPatch
+} // evaluateOnPatch
+
+int
+muParserCartGridFunction::getFunctionDepth(const int data_depth, const int axis, const int depth) const
+{
+    const int parsers_size = static_cast<int>(d_parsers.size());
+    if (parsers_size == 1)
+    {
+        return 0;
+    }
+    else if (parsers_size == NDIM)
+    {
+        return axis;
+    }
+    else if (parsers_size == depth)
+    {
+        return data_depth;
+    }
+    else if (parsers_size == NDIM * depth)
+    {
+        return NDIM * data_depth + axis;
+    }
+    return -1;
+} // getFunctionDepth
+
+const std::vector<double>&
+muParserCartGridFunction::evaluateFunction(
+    const int function_depth,
+    const int centering,
+    const int axis,
+    const Patch<NDIM>& patch,
+    const std::function<void(std::vector<std::array<double, NDIM> >&)>& compute_positions)
+{
+    // Values of time-independent functions are computed only the first time
+    // that they are requested on each patch.
+    std::vector<double>* values = &d_values;
+    if (d_cache_time_independent_values && !d_time_dependent[function_depth])
+    {
+        PatchValues& patch_values =
+            d_cached_values[std::make_pair(patch.getPatchLevelNumber(), patch.getPatchNumber())];
+        Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
+        std::array<double, NDIM> dx;
+        std::copy(pgeom->getDx(), pgeom->getDx() + NDIM, dx.begin());
+        if (!(patch_values.box == patch.getBox()) || patch_values.dx != dx)
+        {
+            patch_values.box = patch.getBox();
+            patch_values.dx = dx;
+            patch_values.values.clear();
+        }
+        const auto key = std::make_tuple(centering, function_depth, axis);
+        const auto it = patch_values.values.find(key);
+        if (it != patch_values.values.end()) return it->second;
+        values = &patch_values.values[key];
+    }
+
+    d_positions.clear();
+    compute_positions(d_positions);
+    values->resize(d_positions.size());
+    const muParserExpressionCompiler::FunctionPtr fcn =
+        d_compiler ? d_compiler->getFunction(function_depth) : nullptr;
+    if (fcn)
+    {
+        for (std::size_t k = 0; k < d_positions.size(); ++k)
+        {
+            (*values)[k] = fcn(d_positions[k].data(), d_parser_time);
+        }
+        return *values;
+    }
+    const mu::Parser& parser = d_parsers[function_depth];
+    try
+    {
+        for (std::size_t k = 0; k < d_positions.size(); ++k)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d) d_parser_posn[d] = d_positions[k][d];
+            (*values)[k] = parser.Eval();
+        }
+    }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  error: " << e.GetMsg() << "\n"
+                   << "  in:    " << e.GetExpr() << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
+    }
+    return *values;
+} // evaluateFunction
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -0,0 +1,529 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <IBTK_config.h>
+
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/muParserExpressionCompiler.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+#include "tbox/Utilities.h"
+
+#include "muParser.h"
+#include "muParserError.h"
+
+#if defined(IBTK_HAVE_COMPILED_EXPRESSIONS)
+#include <dlfcn.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+#if defined(IBTK_HAVE_COMPILED_EXPRESSIONS)
+namespace
+{
+// The flags used to compile the generated code into a shared library.
+static const std::string COMPILER_FLAGS = "-std=c++11 -O2 -fPIC -shared";
+
+// The prefix of the names of the compiled functions.
+static const std::string FUNCTION_PREFIX = "ibtk_compiled_expression_";
+
+// The number of sample points at which the compiled functions are compared to
+// the parsers.
+static const int NUM_SAMPLE_POINTS = 16;
+
+// Thrown when an expression cannot be translated.
+struct TranslationError
+{
+};
+
+// Print a double precision value as a C++ floating point literal.
+std::string
+print_literal(const double value)
+{
+    if (!std::isfinite(value)) throw TranslationError();
+    std::ostringstream os;
+    os << std::setprecision(std::numeric_limits<double>::max_digits10) << value;
+    std::string literal = os.str();
+    if (literal.find_first_of(".e") == std::string::npos) literal += ".0";
+    return literal;
+} // print_literal
+
+// Translates a mu::Parser expression into an equivalent C++ expression.  The
+// translator implements the subset of the mu::Parser grammar that is used in
+// input files, with the same operator precedences and associativities.
+// Anything else (e.g., assignment, strings, or unknown names) causes the
+// translation to fail.
+class ExpressionTranslator
+{
+public:
+    ExpressionTranslator(std::string expr, const std::map<std::string, std::string>& names)
+        : d_expr(std::move(expr)), d_names(names)
+    {
+        return;
+    } // ExpressionTranslator
+
+    std::string translate()
+    {
+        d_pos = 0;
+        const std::string result = parseTernary();
+        skipWhitespace();
+        if (d_pos != d_expr.size()) throw TranslationError();
+        return result;
+    } // translate
+
+private:
+    void skipWhitespace()
+    {
+        while (d_pos < d_expr.size() && std::isspace(static_cast<unsigned char>(d_expr[d_pos]))) ++d_pos;
+        return;
+    } // skipWhitespace
+
+    bool accept(const std::string& token)
+    {
+        skipWhitespace();
+        if (d_expr.compare(d_pos, token.size(), token) != 0) return false;
+        d_pos += token.size();
+        return true;
+    } // accept
+
+    void expect(const std::string& token)
+    {
+        if (!accept(token)) throw TranslationError();
+        return;
+    } // expect
+
+    // The ternary operator has the lowest precedence and is right associative.
+    std::string parseTernary()
+    {
+        const std::string cond = parseLogicalOr();
+        if (!accept("?")) return cond;
+        const std::string if_true = parseTernary();
+        expect(":");
+        const std::string if_false = parseTernary();
+        return "((" + cond + ") != 0.0 ? (" + if_true + ") : (" + if_false + "))";
+    } // parseTernary
+
+    std::string parseLogicalOr()
+    {
+        std::string lhs = parseLogicalAnd();
+        while (accept("||"))
+        {
+            const std::string rhs = parseLogicalAnd();
+            lhs = "static_cast<double>((" + lhs + ") != 0.0 || (" + rhs + ") != 0.0)";
+        }
+        return lhs;
+    } // parseLogicalOr
+
+    std::string parseLogicalAnd()
+    {
+        std::string lhs = parseComparison();
+        while (accept("&&"))
+        {
+            const std::string rhs = parseComparison();
+            lhs = "static_cast<double>((" + lhs + ") != 0.0 && (" + rhs + ") != 0.0)";
+        }
+        return lhs;
+    } // parseLogicalAnd
+
+    std::string parseComparison()
+    {
+        static const std::array<std::string, 6> ops = { { "<=", ">=", "==", "!=", "<", ">" } };
+        std::string lhs = parseAdditive();
+        while (true)
+        {
+            const auto op = std::find_if(ops.begin(), ops.end(), [this](const std::string& op) { return accept(op); });
+            if (op == ops.end()) return lhs;
+            const std::string rhs = parseAdditive();
+            lhs = "static_cast<double>((" + lhs + ") " + *op + " (" + rhs + "))";
+        }
+    } // parseComparison
+
+    std::string parseAdditive()
+    {
+        std::string lhs = parseMultiplicative();
+        while (true)
+        {
+            std::string op;
+            if (accept("+"))
+                op = " + ";
+            else if (accept("-"))
+                op = " - ";
+            else
+                return lhs;
+            lhs = "(" + lhs + op + parseMultiplicative() + ")";
+        }
+    } // parseAdditive
+
+    std::string parseMultiplicative()
+    {
+        std::string lhs = parseUnary();
+        while (true)
+        {
+            std::string op;
+            if (accept("*"))
+                op = " * ";
+            else if (accept("/"))
+                op = " / ";
+            else
+                return lhs;
+            lhs = "(" + lhs + op + parseUnary() + ")";
+        }
+    } // parseMultiplicative
+
+    // Signs have a lower precedence than the power operator, so that -2^2 is
+    // -(2^2).
+    std::string parseUnary()
+    {
+        if (accept("-")) return "(-" + parseUnary() + ")";
+        if (accept("+")) return parseUnary();
+        return parsePower();
+    } // parseUnary
+
+    // The power operator is right associative.
+    std::string parsePower()
+    {
+        const std::string base = parsePrimary();
+        if (!accept("^")) return base;
+        return "std::pow(" + base + ", " + parseUnary() + ")";
+    } // parsePower
+
+    std::string parsePrimary()
+    {
+        skipWhitespace();
+        if (d_pos == d_expr.size()) throw TranslationError();
+        if (accept("("))
+        {
+            const std::string result = parseTernary();
+            expect(")");
+            return "(" + result + ")";
+        }
+        const char c = d_expr[d_pos];
+        if (std::isdigit(static_cast<unsigned char>(c)) || c == '.')
+        {
+            const char* const begin = d_expr.c_str() + d_pos;
+            char* end = nullptr;
+            const double value = std::strtod(begin, &end);
+            if (end == begin) throw TranslationError();
+            d_pos += end - begin;
+            return print_literal(value);
+        }
+        if (std::isalpha(static_cast<unsigned char>(c)) || c == '_')
+        {
+            const std::size_t begin = d_pos;
+            while (d_pos < d_expr.size() &&
+                   (std::isalnum(static_cast<unsigned char>(d_expr[d_pos])) || d_expr[d_pos] == '_'))
+            {
+                ++d_pos;
+            }
+            const std::string name = d_expr.substr(begin, d_pos - begin);
+            if (accept("(")) return parseFunction(name);
+            const auto it = d_names.find(name);
+            if (it == d_names.end()) throw TranslationError();
+            return it->second;
+        }
+        throw TranslationError();
+    } // parsePrimary
+
+    std::string parseFunction(const std::string& name)
+    {
+        std::vector<std::string> args;
+        if (!accept(")"))
+        {
+            do
+            {
+                args.push_back(parseTernary());
+            } while (accept(","));
+            expect(")");
+        }
+
+        static const std::map<std::string, std::string> unary_fcns = {
+            { "sin", "std::sin" },     { "cos", "std::cos" },     { "tan", "std::tan" },   { "asin", "std::asin" },
+            { "acos", "std::acos" },   { "atan", "std::atan" },   { "sinh", "std::sinh" }, { "cosh", "std::cosh" },
+            { "tanh", "std::tanh" },   { "asinh", "std::asinh" }, { "acosh", "std::acosh" },
+            { "atanh", "std::atanh" }, { "log2", "ibtk_log2" },   { "log10", "std::log10" },
+            { "log", "std::log" },     { "ln", "std::log" },      { "exp", "std::exp" },   { "sqrt", "std::sqrt" },
+            { "sign", "ibtk_sign" },   { "rint", "ibtk_rint" },   { "abs", "ibtk_abs" }
+        };
+        const auto it = unary_fcns.find(name);
+        if (it != unary_fcns.end())
+        {
+            if (args.size() != 1) throw TranslationError();
+            return it->second + "(" + args[0] + ")";
+        }
+        if (name == "atan2")
+        {
+            if (args.size() != 2) throw TranslationError();
+            return "std::atan2(" + args[0] + ", " + args[1] + ")";
+        }
+        if (args.empty()) throw TranslationError();
+        std::string arg_list = args[0], arg_sum = args[0];
+        for (unsigned int k = 1; k < args.size(); ++k)
+        {
+            arg_list += ", " + args[k];
+            arg_sum = "(" + arg_sum + " + " + args[k] + ")";
+        }
+        if (name == "min") return "ibtk_min(" + arg_list + ")";
+        if (name == "max") return "ibtk_max(" + arg_list + ")";
+        if (name == "sum") return arg_sum;
+        if (name == "avg") return "(" + arg_sum + " / " + print_literal(static_cast<double>(args.size())) + ")";
+        throw TranslationError();
+    } // parseFunction
+
+    std::string d_expr;
+    const std::map<std::string, std::string>& d_names;
+    std::size_t d_pos = 0;
+};
+
+// Helper functions used by the generated code, which are implemented in the same
+// way as the corresponding mu::Parser functions.
+static const char* const GENERATED_CODE_HEADER = R"(#include <algorithm>
+#include <cmath>
+
+namespace
+{
+inline double ibtk_abs(const double v) { return (v >= 0) ? v : -v; }
+inline double ibtk_sign(const double v) { return (v < 0) ? -1.0 : (v > 0) ? 1.0 : 0.0; }
+inline double ibtk_rint(const double v) { return std::floor(v + 0.5); }
+inline double ibtk_log2(const double v) { return std::log(v) / std::log(2.0); }
+inline double ibtk_min(const double a) { return a; }
+template <typename... Args>
+inline double ibtk_min(const double a, const double b, const Args... args) { return ibtk_min(std::min(a, b), args...); }
+inline double ibtk_max(const double a) { return a; }
+template <typename... Args>
+inline double ibtk_max(const double a, const double b, const Args... args) { return ibtk_max(std::max(a, b), args...); }
+} // namespace
+)";
+
+// Determine whether two values agree to within roundoff.
+bool
+values_agree(const double a, const double b)
+{
+    if (std::isnan(a) || std::isnan(b)) return std::isnan(a) && std::isnan(b);
+    if (std::isinf(a) || std::isinf(b)) return a == b;
+    return std::abs(a - b) <= 1.0e-10 * std::max({ 1.0, std::abs(a), std::abs(b) });
+} // values_agree
+
+// Determine whether a character may appear in the paths that are passed to the
+// shell to compile the generated code.
+bool
+is_safe_path_character(const char c)
+{
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '-' || c == '.' || c == '/';
+} // is_safe_path_character
+} // namespace
+#endif
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+muParserExpressionCompiler::muParserExpressionCompiler(std::string object_name,
+                                                       const std::vector<const mu::Parser*>& parsers,
+                                                       double* const time_var,
+                                                       double* const posn_vars,
+                                                       Pointer<Database> input_db)
+    : d_object_name(std::move(object_name)), d_functions(parsers.size(), nullptr)
+{
+    if (input_db && (input_db->keyExists("expression_compiler") || input_db->keyExists("expression_compiler_flags")))
+    {
+        TBOX_WARNING(d_object_name << "::muParserExpressionCompiler():\n"
+                                   << "  the input keys expression_compiler and expression_compiler_flags are no "
+                                      "longer supported and are ignored.\n"
+                                   << "  the compiler is selected at configure time by EXPRESSION_CXX."
+                                   << std::endl);
+    }
+#if defined(IBTK_HAVE_COMPILED_EXPRESSIONS)
+    std::string directory = ".";
+    if (input_db && input_db->keyExists("compiled_expression_directory"))
+        directory = input_db->getString("compiled_expression_directory");
+    if (directory.empty() || !std::all_of(directory.begin(), directory.end(), is_safe_path_character))
+    {
+        TBOX_ERROR(d_object_name << "::muParserExpressionCompiler():\n"
+                                 << "  invalid compiled_expression_directory \"" << directory << "\".\n"
+                                 << "  the directory name may only contain letters, digits, and the characters "
+                                    "'_', '-', '.', and '/'."
+                                 << std::endl);
+    }
+
+    // Translate the expressions.  Translation is deterministic, so all
+    // processes generate the same code.
+    std::vector<bool> translated(parsers.size(), false);
+    std::ostringstream code;
+    code << "// Generated by IBTK::muParserExpressionCompiler for " << d_object_name << ".\n" << GENERATED_CODE_HEADER;
+    for (unsigned int k = 0; k < parsers.size(); ++k)
+    {
+        const mu::Parser& parser = *parsers[k];
+        std::map<std::string, std::string> names;
+        for (const auto& constant : parser.GetConst())
+        {
+            if (std::isfinite(constant.second)) names[constant.first] = print_literal(constant.second);
+        }
+        for (const auto& var : parser.GetVar())
+        {
+            if (var.second == time_var)
+            {
+                names[var.first] = "t";
+            }
+            else if (var.second >= posn_vars && var.second < posn_vars + NDIM)
+            {
+                names[var.first] = "X[" + std::to_string(var.second - posn_vars) + "]";
+            }
+        }
+        try
+        {
+            const std::string expr = ExpressionTranslator(parser.GetExpr(), names).translate();
+            code << "\nextern \"C\" double " << FUNCTION_PREFIX << k << "(const double* X, const double t)\n"
+                 << "{\n"
+                 << "    (void)X;\n"
+                 << "    (void)t;\n"
+                 << "    return " << expr << ";\n"
+                 << "}\n";
+            translated[k] = true;
+        }
+        catch (const TranslationError&)
+        {
+            translated[k] = false;
+        }
+    }
+    if (std::find(translated.begin(), translated.end(), true) == translated.end()) return;
+
+    // Compile the shared library on the root process unless it already exists.
+    std::ostringstream base_name;
+    base_name << directory << "/ibtk_expressions_" << std::hex << std::hash<std::string>()(code.str());
+    const std::string source_file = base_name.str() + ".cpp", library_file = base_name.str() + ".so";
+    int success = 1;
+    if (IBTK_MPI::getRank() == 0)
+    {
+        if (!std::ifstream(library_file).good())
+        {
+            Utilities::recursiveMkdir(directory);
+            std::ofstream(source_file) << code.str();
+            const std::string tmp_library_file = library_file + ".tmp";
+            const std::string command = std::string(IBTK_EXPRESSION_CXX) + " " + COMPILER_FLAGS + " -o " +
+                                        tmp_library_file + " " + source_file + " > " + base_name.str() +
+                                        ".log 2>&1";
+            success = std::system(command.c_str()) == 0 &&
+                      std::rename(tmp_library_file.c_str(), library_file.c_str()) == 0;
+        }
+    }
+    success = IBTK_MPI::bcast(success, 0);
+    if (!success)
+    {
+        TBOX_WARNING(d_object_name << "::muParserExpressionCompiler():\n"
+                                   << "  unable to compile " << source_file << "; see " << base_name.str()
+                                   << ".log for details.\n"
+                                   << "  the expressions will be evaluated by muParser." << std::endl);
+        return;
+    }
+
+    // Load the compiled functions on all processes.
+    d_library_handle = dlopen(library_file.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (!d_library_handle)
+    {
+        TBOX_WARNING(d_object_name << "::muParserExpressionCompiler():\n"
+                                   << "  unable to load " << library_file << ": " << dlerror() << "\n"
+                                   << "  the expressions will be evaluated by muParser." << std::endl);
+        return;
+    }
+    for (unsigned int k = 0; k < parsers.size(); ++k)
+    {
+        if (!translated[k]) continue;
+        const std::string function_name = FUNCTION_PREFIX + std::to_string(k);
+        d_functions[k] = reinterpret_cast<FunctionPtr>(dlsym(d_library_handle, function_name.c_str()));
+    }
+
+    // Compare the compiled functions to the parsers at a collection of sample
+    // points.  The sample points are the same on all processes.
+    const double time_value = *time_var;
+    std::array<double, NDIM> posn_values;
+    std::copy(posn_vars, posn_vars + NDIM, posn_values.begin());
+    unsigned int seed = 1;
+    auto random_value = [&seed]() {
+        seed = 1103515245u * seed + 12345u;
+        return static_cast<double>((seed >> 16) & 0x7fff) / 32767.0;
+    };
+    for (int j = 0; j < NUM_SAMPLE_POINTS; ++j)
+    {
+        *time_var = 2.0 * random_value();
+        for (unsigned int d = 0; d < NDIM; ++d) posn_vars[d] = 3.0 * random_value() - 1.0;
+        for (unsigned int k = 0; k < parsers.size(); ++k)
+        {
+            if (!d_functions[k]) continue;
+            try
+            {
+                if (!values_agree(parsers[k]->Eval(), d_functions[k](posn_vars, *time_var))) d_functions[k] = nullptr;
+            }
+            catch (...)
+            {
+                d_functions[k] = nullptr;
+            }
+        }
+    }
+    *time_var = time_value;
+    std::copy(posn_values.begin(), posn_values.end(), posn_vars);
+#else
+    NULL_USE(time_var);
+    NULL_USE(posn_vars);
+    TBOX_WARNING(d_object_name << "::muParserExpressionCompiler():\n"
+                               << "  IBTK was not configured with --enable-compiled-expressions.\n"
+                               << "  the expressions will be evaluated by muParser." << std::endl);
+#endif
+    return;
+} // muParserExpressionCompiler
+
+muParserExpressionCompiler::~muParserExpressionCompiler()
+{
+#if defined(IBTK_HAVE_COMPILED_EXPRESSIONS)
+    if (d_library_handle) dlclose(d_library_handle);
+#endif
+    return;
+} // ~muParserExpressionCompiler
+
+muParserExpressionCompiler::FunctionPtr
+muParserExpressionCompiler::getFunction(const unsigned int k) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(k < d_functions.size());
+#endif
+    return d_functions[k];
+} // getFunction
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -61,9 +61,18 @@ namespace IBAMR
  * advection velocity may be used with each quantity registered with the
  * integrator.
  *
- * This hierarchy integrator advances all levels of the patch hierarchy
- * synchronously in time.  In particular, subcycling in time is \em not
- * performed.
+ * By default, this hierarchy integrator advances all levels of the patch
+ * hierarchy synchronously in time.  If the input database sets
+ * <code>enable_subcycling = TRUE</code>, the levels instead are advanced by
+ * Berger-Oliger subcycling: each level takes time steps that are smaller than
+ * those of the next coarser level by the refinement ratio between the levels,
+ * the ghost values of the finer level are interpolated in time from the
+ * coarser level, and the coarser level is refluxed once the finer level has
+ * reached the same time.  The time step size then is limited only by the
+ * coarsest level for which the CFL condition is most restrictive.  Subcycling
+ * is only supported for pure transport problems, i.e., for quantities with
+ * zero diffusion and damping coefficients, and with a single cycle per time
+ * step.
  *
  * Either Crank-Nicolson (i.e., the trapezoidal rule) or backward Euler is used
  * for the linearly implicit treatment of the diffusive terms.  The advective
@@ -223,6 +232,19 @@ private:
     AdvDiffPredictorCorrectorHierarchyIntegrator&
     operator=(const AdvDiffPredictorCorrectorHierarchyIntegrator& that) = delete;
 
+    /*!
+     * Advance the given level and, recursively, all finer levels from
+     * current_time to new_time, taking multiple time steps on each finer level,
+     * and synchronize the levels.
+     */
+    void advanceLevelWithSubcycling(int ln, double current_time, double new_time, bool first_step, bool last_step);
+
+    /*
+     * Whether the levels of the patch hierarchy are advanced by Berger-Oliger
+     * subcycling.
+     */
+    bool d_enable_subcycling = false;
+
     /*
      * The SAMRAI::algs::HyperbolicLevelIntegrator supplies generic operations
      * use to handle the explicit integration of advection terms.
@@ -86,6 +86,19 @@ public:
      */
     ~AdvDiffPredictorCorrectorHyperbolicPatchOps() = default;
 
+    /*!
+     * Set whether conservativeDifferenceOnPatch() advances the transported
+     * quantities in place.
+     *
+     * By default, the transported quantities are replaced by their advective
+     * rates of change, which are subsequently combined with the diffusive terms
+     * by the hierarchy integrator. When levels are advanced with different time
+     * step sizes, the quantities instead must be advanced from the current time
+     * to the new time on each level, including the contribution of the source
+     * terms.
+     */
+    void setAdvanceInPlace(bool advance_in_place);
+
     /*!
      * Update solution variables by performing a conservative difference using
      * the fluxes calculated in computeFluxesOnPatch().
@@ -161,6 +174,11 @@ private:
      */
     AdvDiffPredictorCorrectorHyperbolicPatchOps&
     operator=(const AdvDiffPredictorCorrectorHyperbolicPatchOps& that) = delete;
+
+    /*!
+     * Whether the transported quantities are advanced in place.
+     */
+    bool d_advance_in_place = false;
 };
 } // namespace IBAMR
 
@@ -76,6 +76,15 @@ namespace IBAMR
  *
  * Various options are available for the spatial and temporal discretizations.
  *
+ * \note Each registered quantity is advanced with its own convective operator,
+ * which fills the ghost cells of that quantity separately.  When several
+ * quantities are advected by the same velocity and share boundary conditions,
+ * diffusion and damping coefficients, forcing terms, and convective operator
+ * settings, it is more efficient to register them as the components of a
+ * single multi-depth variable.  The convective operators fill the ghost cells
+ * of all of the components of such a variable at once and reconstruct all of
+ * the components in a single traversal of each patch.
+ *
  * \see HierarchyIntegrator
  * \see SAMRAI::mesh::StandardTagAndInitStrategy
  * \see SAMRAI::algs::TimeRefinementIntegrator
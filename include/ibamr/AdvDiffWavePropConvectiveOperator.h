@@ -95,6 +95,11 @@ namespace IBAMR
  * \note AdvDiffWavePropConvectiveOperator currently only works in
  * ADVECTIVE form.
  *
+ * If the input database key ``use_vectorized_kernel'' is set to TRUE, the
+ * convective derivative is computed by the row-wise, vectorizable C++
+ * implementation in WavePropConvectiveFunctions instead of the Fortran
+ * implementation.  The default is FALSE.
+ *
  * \todo Implement a CONSERVATIVE form for the operator. This will
  * involve writing a new Riemann solver for the flux.
  */
@@ -225,6 +230,10 @@ private:
     // Currently only available for k=3
     int d_k = 3;
 
+    // Whether to use the vectorized (C++) implementation of the differencing
+    // kernel instead of the Fortran implementation.
+    bool d_use_vectorized_kernel = false;
+
     ConvectiveDifferencingType d_difference_form;
 };
 } // namespace IBAMR
@@ -80,6 +80,14 @@ namespace IBAMR
  * non-conservative form of the source term must be supplied to the predictor
  * in-order to obtain a formally consistent method.
  *
+ * The predicted values are computed by Fortran routines that process a single
+ * component of the advected quantity at a time. Alternatively, when the input
+ * database key \p use_vectorized_predictor is set to \p TRUE, the predicted
+ * values are computed for all components of the advected quantity during a
+ * single sweep over each line of cells using branch-free slope limiters. The
+ * vectorized predictor supports all limiters except for \p PPM and \p XSPPM7,
+ * for which the Fortran routines are always used.
+ *
  * \see IBAMR::AdvectorPredictorCorrectorHyperbolicPatchOps
  */
 class AdvectorExplicitPredictorPatchOps : public SAMRAI::tbox::Serializable
@@ -349,6 +357,18 @@ private:
                                const SAMRAI::hier::Patch<NDIM>& patch,
                                double dt) const;
 
+    /*
+     * Compute the predicted values for all components of Q at once, with or
+     * without a source term. Only limiters other than PPM and XSPPM7 are
+     * supported.
+     */
+    void predictVectorized(SAMRAI::pdat::FaceData<NDIM, double>& q_half,
+                           const SAMRAI::pdat::FaceData<NDIM, double>& u_ADV,
+                           const SAMRAI::pdat::CellData<NDIM, double>& Q,
+                           const SAMRAI::pdat::CellData<NDIM, double>* F,
+                           const SAMRAI::hier::Patch<NDIM>& patch,
+                           double dt) const;
+
     /*
      * These private member functions read data from input and restart.  When
      * beginning a run from a restart file, all data members are read from the
@@ -375,11 +395,15 @@ private:
      *                            computing numerical fluxes
      *    d_using_full_ctu ...... specifies whether full corner transport
      *                            upwinding is used for 3D computations
+     *    d_use_vectorized_predictor
+     *                            specifies whether predicted values are
+     *                            computed by predictVectorized()
      */
     LimiterType d_limiter_type = MC_LIMITED;
 #if (NDIM == 3)
     bool d_using_full_ctu = true;
 #endif
+    bool d_use_vectorized_predictor = false;
 };
 } // namespace IBAMR
 
@@ -22,6 +22,7 @@
 #include "ibtk/ibtk_macros.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "PatchLevel.h"
 #include "tbox/Pointer.h"
 
 IBTK_DISABLE_EXTRA_WARNINGS
@@ -29,6 +30,8 @@ IBTK_DISABLE_EXTRA_WARNINGS
 #include "Eigen/Geometry"
 IBTK_ENABLE_EXTRA_WARNINGS
 
+#include <vector>
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBAMR
@@ -316,6 +319,11 @@ protected:
     KinematicsFcnData d_kinematics_fcn_data;
     ExternalForceTorqueFcnData d_ext_force_torque_fcn_data;
 
+    // Local patches of the finest level that intersect the solid or the zone
+    // around its interface over which the penalization is smeared.
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > d_brinkman_level;
+    std::vector<int> d_brinkman_patch_nums;
+
 private:
     /*!
      * \brief Copy constructor.
@@ -337,6 +345,13 @@ private:
      */
     BrinkmanPenalizationRigidBodyDynamics& operator=(const BrinkmanPenalizationRigidBodyDynamics& that) = delete;
 
+    /*!
+     * \brief Determine the local patches of the given level that contain cells
+     * in which the solid level set is at most the width of the smeared zone
+     * around the interface.
+     */
+    void findBrinkmanPatches(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level, int ls_idx);
+
     /*!
      * \brief Get options from input database.
      */
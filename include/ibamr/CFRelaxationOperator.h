@@ -93,6 +93,14 @@ public:
      */
     bool isTimeDependent() const override;
 
+    /*!
+     * \brief Compute the exponential of a symmetric matrix from its eigen decomposition.
+     *
+     * The eigen decomposition is computed in closed form, which is less expensive than evaluating the
+     * exponential of a general matrix.
+     */
+    static IBTK::MatrixNd exponentiateSymmetricMatrix(const IBTK::MatrixNd& mat);
+
 protected:
     /*!
      * \brief This function converts the data stored in the patch data index to the conformation tensor. This has a
@@ -40,6 +40,7 @@
 namespace IBTK
 {
 class LData;
+class LMesh;
 class RobinPhysBdryPatchStrategy;
 } // namespace IBTK
 namespace SAMRAI
@@ -387,6 +388,13 @@ public:
      */
     void computeNetRigidGeneralizedForce(const unsigned int part, Vec L, IBTK::RigidDOFVector& F) override;
 
+    // \see CIBStrategy::computeNetRigidGeneralizedForces() method.
+    /*!
+     * \brief Compute total force and torque on all of the rigid structures
+     * with a single global reduction.
+     */
+    void computeNetRigidGeneralizedForces(Vec L, IBTK::EigenAlignedVector<IBTK::RigidDOFVector>& F) override;
+
     // \see CIBStrategy::copyVecToArray() method.
     /*!
      * \brief Copy PETSc Vec to raw array for specified structures.
@@ -425,6 +433,19 @@ public:
                                  double f_periodic_corr,
                                  const int managing_rank) override;
 
+    // \see CIBStrategy::applyMobilityOperator() method.
+    /*!
+     * \brief Apply the RPY mobility matrix of all of the structures without
+     * forming the matrix.
+     */
+    void applyMobilityOperator(MobilityMatrixType mat_type,
+                               Vec lambda,
+                               Vec U,
+                               const double* grid_dx,
+                               double mu,
+                               double f_periodic_corr,
+                               const int managing_rank) override;
+
     // \see CIBStrategy::constructGeometricMatrix() method.
     /*!
      * \brief Generate block-diagonal geometric matrix for the prototypical structures
@@ -554,6 +575,26 @@ private:
      */
     void setInitialLambda(const int level_number);
 
+    /*!
+     * \brief Update the cached displacements of the local nodes of the
+     * structures from their centers of mass, when necessary.
+     */
+    void updateRigidBodyDisplacements();
+
+    /*!
+     * Local PETSc indices of the local nodes of each structure and the
+     * displacements of these nodes from the center of mass of the structure in
+     * the half-time orientation of the structure, stored contiguously.  These
+     * are used to apply the rigid body operators and are reconstructed when
+     * the Lagrangian mesh, the initial centers of mass, or the orientations of
+     * the structures change.
+     */
+    SAMRAI::tbox::Pointer<IBTK::LMesh> d_rigid_body_disp_mesh;
+    IBTK::EigenAlignedVector<Eigen::Vector3d> d_rigid_body_disp_com;
+    IBTK::EigenAlignedVector<Eigen::Quaterniond> d_rigid_body_disp_quaternion;
+    std::vector<std::vector<int> > d_rigid_body_local_idxs;
+    std::vector<std::vector<double> > d_rigid_body_disps;
+
 }; // CIBMethod
 } // namespace IBAMR
 
@@ -263,6 +263,21 @@ public:
      */
     virtual void computeNetRigidGeneralizedForce(const unsigned int part, Vec L, Vec F);
 
+    /*!
+     * \brief Compute total force and torque on each of the structures.
+     *
+     * \param L The Lagrange multiplier vector.
+     *
+     * \param F Vector of RDVs storing the net generalized force on each
+     * structure.
+     *
+     * \note The default implementation calls computeNetRigidGeneralizedForce()
+     * for each structure.  Implementations may override this function to
+     * determine the forces and torques on all structures with a single global
+     * reduction.
+     */
+    virtual void computeNetRigidGeneralizedForces(Vec L, IBTK::EigenAlignedVector<IBTK::RigidDOFVector>& F);
+
     /*!
      * \brief Compute total force and torque on the structure.
      *
@@ -508,6 +523,41 @@ public:
                                          double f_periodic_corr,
                                          const int managing_rank);
 
+    /*!
+     * \brief Apply the mobility matrix of all of the structures to a vector of
+     * nodal forces without forming the matrix.
+     *
+     * Unlike constructMobilityMatrix(), this function only requires storage
+     * proportional to the number of nodes, so that it may be used to apply
+     * the mobility of collections of nodes that are too large for a dense
+     * matrix (e.g., as the operator of a matrix-free Krylov mobility solver).
+     *
+     * \note A default implementation that raises an unrecoverable error is
+     * provided in this class. The derived class provides the actual
+     * implementation.
+     *
+     * \param mat_type Mobility matrix type. Only RPY is supported.
+     *
+     * \param lambda Vector of nodal forces of all of the structures.
+     *
+     * \param U Vector in which the resulting nodal velocities are stored.
+     *
+     * \param grid_dx NDIM vector of grid spacing of structure level.
+     *
+     * \param mu Fluid viscosity.
+     *
+     * \param f_periodic_corr Periodic domain correction of the mobility.
+     *
+     * \param managing_rank Rank of the processor that applies the operator.
+     */
+    virtual void applyMobilityOperator(MobilityMatrixType mat_type,
+                                       Vec lambda,
+                                       Vec U,
+                                       const double* grid_dx,
+                                       double mu,
+                                       double f_periodic_corr,
+                                       const int managing_rank);
+
     /*!
      * \brief Construct a geometric matrix for the prototypical structures
      * identified by their indices. A geometric matrix maps center of mass rigid
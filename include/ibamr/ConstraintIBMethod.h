@@ -173,6 +173,14 @@ public:
      */
     virtual void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db) override;
 
+    /*!
+     * \brief Override the resetHierarchyConfiguration method of the base
+     * IBMethod class.
+     */
+    virtual void resetHierarchyConfiguration(SAMRAI::tbox::Pointer<SAMRAI::hier::BasePatchHierarchy<NDIM> > hierarchy,
+                                             int coarsest_level,
+                                             int finest_level) override;
+
     /*!
      * \brief Get the volume element associated with material points
      * of all structures.
@@ -486,6 +494,13 @@ private:
      */
     bool d_needs_div_free_projection = false;
 
+    /*!
+     * Whether to keep the state of the divergence free projection solver
+     * between time steps when the fluid density is constant, and whether that
+     * state is currently initialized.
+     */
+    bool d_reuse_projection_solver_state = false, d_projection_solver_is_initialized = false;
+
     /*!
      * Rigid translational velocity of the structures.
      */
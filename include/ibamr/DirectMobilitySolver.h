@@ -25,6 +25,7 @@
 #include "petscmat.h"
 #include "petscvec.h"
 
+#include <array>
 #include <map>
 #include <string>
 #include <vector>
@@ -84,7 +85,8 @@ public:
      * \param scale Scale for improving the conditioning number of dense mobility
      * matrix. The matrix is scaled as \f$ [MM] = \alpha*[MM] + \beta*[I]. \f$
      *
-     * \param managing_proc MPI processor that manages this mobility matrix.
+     * \param managing_proc MPI processor that manages this mobility matrix.  If
+     * negative, the matrices are assigned to processors in round-robin order.
      */
     void registerMobilityMat(const std::string& mat_name,
                              const unsigned prototype_struct_id,
@@ -114,7 +116,8 @@ public:
      * \param scale Scale for improving the conditioning number of dense mobility
      * matrix. The matrix is scaled as \f$ [MM] = \alpha*[MM] + \beta*[I]. \f$
      *
-     * \param managing_proc MPI processor that manages this mobility matrix.
+     * \param managing_proc MPI processor that manages this mobility matrix.  If
+     * negative, the matrices are assigned to processors in round-robin order.
      */
     void registerMobilityMat(const std::string& mat_name,
                              const std::vector<unsigned>& prototype_struct_ids,
@@ -159,6 +162,25 @@ public:
      */
     void setStokesSpecifications(const IBAMR::StokesSpecifications& stokes_spec);
 
+    /*!
+     * \brief Indicate that the mobility matrices must be reconstructed and
+     * refactorized when the solver is next initialized, e.g., because the
+     * reference configurations of the structures have changed.
+     *
+     * \note Unless input option recompute_mob_mat_perstep is set to TRUE, the
+     * matrices are constructed once in the reference frame of the structures
+     * and are only reconstructed when the grid spacing or the fluid parameters
+     * change or when this function is called.  Otherwise, the matrices are
+     * reconstructed every recompute_mob_mat_interval initializations of the
+     * solver (default 1).
+     *
+     * \note Matrices of type READ_FROM_FILE are read from file again whenever
+     * they are reconstructed. Because the file corresponds to a single grid
+     * spacing, it is an error for the grid spacing of the finest level to
+     * change after such a matrix has been read.
+     */
+    void setMobilityMatricesOutOfDate();
+
     /*!
      * \brief Solves the mobility problem.
      *
@@ -237,8 +259,11 @@ private:
 
     /*!
      * \brief Compute solution and store in the rhs vector.
+     *
+     * \param num_rhs Number of right-hand sides, which are stored
+     * contiguously in column-major order in rhs.
      */
-    void computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs);
+    void computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs, int num_rhs = 1);
 
     // Solver stuff
     std::string d_object_name;
@@ -251,6 +276,7 @@ private:
     std::map<std::string, std::pair<std::vector<double>, std::vector<double> > > d_mat_map;
     std::map<std::string, std::vector<double> > d_geometric_mat_map;
     std::map<std::string, int> d_mat_proc_map;
+    int d_num_auto_managed_mats = 0;
     std::map<std::string, std::vector<unsigned> > d_mat_prototype_id_map;
     std::map<std::string, std::vector<std::vector<unsigned> > > d_mat_actual_id_map;
     std::map<std::string, MobilityMatrixType> d_mat_type_map;
@@ -267,12 +293,19 @@ private:
     //\}
 
     // System physical parameters.
-    double d_mu;
-    double d_rho;
+    double d_mu = 0.0;
+    double d_rho = 0.0;
 
     // Parameters used in this class.
     double d_f_periodic_corr = 0.0;
     bool d_recompute_mob_mat = false;
+    int d_recompute_mob_mat_interval = 1, d_num_inits_since_mob_mat_recompute = 0;
+
+    // The grid spacing used to construct the current matrices, whether the
+    // matrices must be reconstructed when the solver is next initialized, and
+    // whether they have been constructed at all.
+    std::array<double, NDIM> d_mob_mat_dx{};
+    bool d_mob_mat_out_of_date = true, d_mob_mat_constructed = false;
     double d_svd_replace_value, d_svd_eps;
 
 }; // DirectMobilitySolver
@@ -31,6 +31,7 @@
 #include "libmesh/enum_quadrature_type.h"
 #include "libmesh/explicit_system.h"
 
+#include <set>
 #include <string>
 #include <utility>
 
@@ -170,8 +171,19 @@ public:
      */
     using PK1StressFcnPtr = IBTK::TensorMeshFcnPtr;
 
+    /*!
+     * Typedef specifying interface for a PK1 stress tensor function that is
+     * evaluated at all of the quadrature points of an element at once.
+     */
+    using PK1StressBatchFcnPtr = IBTK::TensorMeshBatchFcnPtr;
+
     /*!
      * Struct encapsulating PK1 stress tensor function data.
+     *
+     * Either a pointwise function (fcn) or a batched function (batch_fcn, see
+     * fromBatchFunction()) may be provided.  When a batched function is
+     * provided, interior force assembly evaluates the stress at all
+     * quadrature points of each element with a single call.
      */
     struct PK1StressFcnData
     {
@@ -184,11 +196,60 @@ public:
         {
         }
 
-        PK1StressFcnPtr fcn;
+        /*!
+         * Create the data for a batched stress function.
+         *
+         * \note This is a named factory function rather than a constructor so
+         * that PK1StressFcnData(nullptr, ...) remains unambiguous.
+         */
+        static PK1StressFcnData fromBatchFunction(PK1StressBatchFcnPtr batch_fcn,
+                                                  std::vector<IBTK::SystemData> system_data = {},
+                                                  void* const ctx = nullptr,
+                                                  const libMesh::QuadratureType& quad_type = libMesh::INVALID_Q_RULE,
+                                                  const libMesh::Order& quad_order = libMesh::INVALID_ORDER)
+        {
+            PK1StressFcnData data(nullptr, std::move(system_data), ctx, quad_type, quad_order);
+            data.batch_fcn = batch_fcn;
+            return data;
+        }
+
+        /*!
+         * Whether a stress function has been provided.
+         */
+        bool isSet() const
+        {
+            return fcn || batch_fcn;
+        }
+
+        /*!
+         * Evaluate the stress at a single point, using whichever function has
+         * been provided.
+         */
+        void evaluate(libMesh::TensorValue<double>& PP,
+                      const libMesh::TensorValue<double>& FF,
+                      const libMesh::Point& x,
+                      const libMesh::Point& X,
+                      libMesh::Elem* elem,
+                      const std::vector<const std::vector<double>*>& system_var_data,
+                      const std::vector<const std::vector<libMesh::VectorValue<double> >*>& system_grad_var_data,
+                      double data_time) const;
+
+        PK1StressFcnPtr fcn = nullptr;
+        PK1StressBatchFcnPtr batch_fcn = nullptr;
         std::vector<IBTK::SystemData> system_data;
         void* ctx;
         libMesh::QuadratureType quad_type;
         libMesh::Order quad_order;
+
+        /*
+         * Single-point batches used by evaluate() when only a batched
+         * function is provided. These are reused between calls to avoid
+         * allocating memory at every quadrature point.
+         */
+        mutable std::vector<libMesh::TensorValue<double> > batch_PP, batch_FF;
+        mutable std::vector<libMesh::Point> batch_x, batch_X;
+        mutable std::vector<std::vector<const std::vector<double>*> > batch_var_data;
+        mutable std::vector<std::vector<const std::vector<libMesh::VectorValue<double> >*> > batch_grad_var_data;
     };
 
     /*!
@@ -318,6 +379,19 @@ public:
      */
     LagSurfaceForceFcnData getLagSurfaceForceFunction(unsigned int part = 0) const;
 
+    /*!
+     * Set whether or not the quadrature data (quadrature points, JxW values,
+     * and shape functions and their gradients) computed on the reference
+     * configuration of the specified part should be stored and reused across
+     * time steps when assembling force densities. This trades memory for not
+     * recomputing the element mappings at every time step and may also be
+     * set via the input database entry <code>use_reference_quadrature_cache</code>
+     * (either a single boolean or one boolean per part).
+     *
+     * @note This function must be called before initializeFEData().
+     */
+    void setUseReferenceQuadratureCache(bool use_cache, unsigned int part = 0);
+
     /*!
      * Method to prepare to advance data from current_time to new_time.
      */
@@ -367,6 +441,20 @@ public:
      *     fe_mechanics_base->writeFEDataToRestartFile(restart_dump_dirname, iteration_num);
      * }
      * @endcode
+     *
+     * IBTK::RestartFileWriter may be used to write both sets of restart files
+     * through a staging directory, so that they are copied to
+     * restart_dump_dirname asynchronously.
+     *
+     * If the input database key <code>use_incremental_libmesh_restart_files</code>
+     * is <code>TRUE</code>, the complete EquationSystems (without the additional
+     * system vectors, which are recomputed at the beginning of each time step)
+     * are written to a static restart file only once for each restart
+     * directory, and each subsequent restart file only stores the solution
+     * vectors of the time-varying systems.  Systems whose solutions do not
+     * change during the simulation (e.g., material parameters) may be listed
+     * in the input database key <code>libmesh_restart_static_systems</code>, in
+     * which case they are only stored in the static restart file.
      */
     virtual void writeFEDataToRestartFile(const std::string& restart_dump_dirname, unsigned int time_step_number);
 
@@ -437,6 +525,20 @@ protected:
                                                  unsigned int part,
                                                  const std::string& extension);
 
+    /*!
+     * Get the name of the libMesh restart file that stores the static data of
+     * incremental restart files.
+     */
+    static std::string libmesh_static_restart_file_name(const std::string& restart_dump_dirname,
+                                                        unsigned int part,
+                                                        const std::string& extension);
+
+    /*!
+     * Read the EquationSystems of the specified part from the libMesh restart
+     * file(s) in the restart read directory.
+     */
+    void readFEDataFromRestartFile(unsigned int part);
+
     /*!
      * Indicates whether the integrator should output logging messages.
      */
@@ -536,6 +638,8 @@ protected:
     std::vector<libMesh::QuadratureType> d_default_quad_type_stress, d_default_quad_type_force;
     std::vector<libMesh::Order> d_default_quad_order_stress, d_default_quad_order_force;
     bool d_use_consistent_mass_matrix = true;
+    bool d_use_matrix_free_mass_operator = false;
+    std::vector<bool> d_use_reference_quadrature_cache;
     bool d_include_normal_stress_in_weak_form = false;
     bool d_include_tangential_stress_in_weak_form = false;
     bool d_include_normal_surface_forces_in_weak_form = true;
@@ -587,6 +691,27 @@ protected:
      */
     std::string d_libmesh_restart_file_extension;
 
+    /*!
+     * Whether libMesh restart data are written incrementally, i.e., as a
+     * static restart file that is written once per restart directory and
+     * restart files that only store the solution vectors of the time-varying
+     * systems, and whether the restart data that are read were written in
+     * this way.
+     */
+    bool d_use_incremental_libmesh_restart_files = false;
+    bool d_read_incremental_libmesh_restart_files = false;
+
+    /*!
+     * The systems that are only stored in the static restart file.
+     */
+    std::set<std::string> d_libmesh_restart_static_systems;
+
+    /*!
+     * The directory to which the static restart files were last written.  This
+     * is cleared whenever the FE data are reinitialized.
+     */
+    std::string d_libmesh_static_restart_dump_dirname;
+
 private:
     /*!
      * Implementation of class constructor.
@@ -22,12 +22,16 @@
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/libmesh_utilities.h"
 
+#include "Box.h"
 #include "PatchHierarchy.h"
 #include "tbox/Pointer.h"
 
 #include "libmesh/boundary_mesh.h"
 
 #include <map>
+#include <memory>
+#include <set>
+#include <utility>
 #include <vector>
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
@@ -76,9 +80,27 @@ public:
 
     /*!
      * \brief Compute the signed distance in the viscinity of the finite element mesh.
+     *
+     * If incremental updates are enabled, the signed distance is only
+     * recomputed in cells that are intersected by a different set of elements
+     * than in the previous call or by an element that has moved by more than
+     * the incremental update threshold.  The previously computed values are
+     * used in all other cells.
      */
     void computeSignedDistance(int n_idx, int d_idx);
 
+    /*!
+     * \brief Enable incremental updates of the signed distance by
+     * computeSignedDistance() for element displacements of at most \em
+     * threshold times the grid spacing of the finest level, which bounds the
+     * error of the reused values by twice that distance.  A negative
+     * threshold, which is the default, disables incremental updates.
+     *
+     * \note All values are recomputed if the finest level of the patch
+     * hierarchy has changed (e.g., after regridding).
+     */
+    void setIncrementalUpdateThreshold(double threshold);
+
     /*!
      * \brief Update the sign of the distance function away from the finite element mesh.
      */
@@ -197,6 +219,15 @@ private:
      */
     std::vector<std::vector<libMesh::Elem*> > d_active_neighbor_patch_bdry_elem_map;
 
+    /*!
+     * Bounding volume hierarchies of the elements associated with each local
+     * patch, along with the elements from which they were built, which are
+     * reused by later calls to mapIntersections() if the patch elements do
+     * not change.
+     */
+    std::vector<std::unique_ptr<IBTK::BoundingBoxTree> > d_patch_elem_trees;
+    std::vector<std::vector<libMesh::Elem*> > d_patch_elem_tree_elems;
+
     /*!
      * Map object keeping track of element-cell intersections as well as elements intersecting that cell
      * and its neighboring cells within the ghost cell width. Note that the elements contained in thie
@@ -223,6 +254,23 @@ private:
      * Object to create a bounding box for sign update sweeping algorithm.
      */
     SAMRAI::hier::Box<NDIM> d_large_struct_box;
+
+    /*!
+     * Data used to incrementally update the signed distance: the threshold
+     * displacement, relative to the grid spacing, of the incremental updates;
+     * the previously computed signed distance and intersecting elements of
+     * each cell; the node positions of each element that are used to measure
+     * its displacement; and the finest level number and local patch boxes for
+     * which the signed distance was computed.
+     */
+    double d_incremental_update_threshold = -1.0;
+    std::map<SAMRAI::pdat::CellIndex<NDIM>,
+             std::pair<std::set<libMesh::Elem*>, double>,
+             IBTK::CellIndexFortranOrder>
+        d_cell_signed_distance_cache;
+    std::map<const libMesh::Elem*, std::vector<libMesh::Point> > d_elem_ref_points;
+    int d_incremental_finest_ln = -1;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_incremental_patch_boxes;
 };
 
 } // namespace IBAMR
@@ -88,11 +88,27 @@ protected:
     bool d_consider_phys_bdry_wall = false;
     int d_wall_location_idx[2 * NDIM];
 
+    // Tolerance used to determine whether the data of a patch have changed,
+    // so that the patch must be swept again.
+    double d_patch_abs_tol = 0.0;
+
 private:
     /*!
      * \brief Do one fast sweep over the hierarchy.
+     *
+     * Only the patches whose interior or ghost cell values have changed by
+     * more than the patch tolerance since they were last swept are swept,
+     * unless sweep_all_patches is true.  The values used as input to the most
+     * recent sweep of each patch are stored in dist_prev_idx, and the number
+     * of sweeps of each patch is accumulated in num_patch_sweeps.
+     *
+     * \return The number of local patches that were swept.
      */
-    void fastSweep(SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops, int dist_idx) const;
+    int fastSweep(SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops,
+                  int dist_idx,
+                  int dist_prev_idx,
+                  bool sweep_all_patches,
+                  std::vector<std::vector<int> >& num_patch_sweeps) const;
 
     /*!
      * \brief Do one fast sweep over a patch.
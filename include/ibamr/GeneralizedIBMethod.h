@@ -203,6 +203,13 @@ protected:
     SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > d_f_var, d_w_var, d_n_var;
     int d_f_idx, d_w_idx, d_n_idx;
 
+    /*
+     * Combined linear and angular velocity used to interpolate both in a single
+     * pass.  Only used with cell-centered velocity data.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > d_uw_var;
+    int d_uw_idx = IBTK::invalid_index;
+
     /*
      * Boolean values tracking whether certain quantities need to be
      * reinitialized.
@@ -250,6 +257,17 @@ private:
      */
     GeneralizedIBMethod& operator=(const GeneralizedIBMethod& that) = delete;
 
+    /*!
+     * Interpolate the cell-centered linear velocity and the angular velocity
+     * (already computed in d_w_idx with filled ghost cells) to the Lagrangian
+     * mesh in a single pass.
+     */
+    void interpolateCombinedVelocity(int u_data_idx,
+                                     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> >& U_data,
+                                     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> >& W_data,
+                                     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> >& X_LE_data,
+                                     double data_time);
+
     /*!
      * Reset the Lagrangian force function object.
      */
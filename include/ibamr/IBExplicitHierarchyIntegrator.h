@@ -146,6 +146,14 @@ private:
      * members.
      */
     void getFromRestart();
+
+    /*!
+     * The number of substeps in which the Lagrangian structure is advanced in
+     * each cycle with the Eulerian velocity held fixed (see
+     * IBStrategy::subcycledMidpointStep()).  Values larger than one are
+     * supported only with the midpoint rule.
+     */
+    int d_num_lagrangian_substeps = 1;
 };
 } // namespace IBAMR
 
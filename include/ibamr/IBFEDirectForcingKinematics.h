@@ -212,6 +212,14 @@ protected:
      */
     void computeMOIOfStructure(Eigen::Matrix3d& I, const Eigen::Vector3d& X0);
 
+    /*!
+     * Compute the data of the local part of the mesh in the reference
+     * configuration that are used to update the position of the structure and
+     * to compute its momentum.  The data are recomputed only if the active
+     * local elements have changed since they were last computed.
+     */
+    void updateReferenceMeshData();
+
     /*
      * The current time step interval.
      */
@@ -258,6 +266,33 @@ protected:
                     d_rot_vel_new = Eigen::Vector3d::Zero();
     Eigen::Matrix3d d_inertia_tensor_initial = Eigen::Matrix3d::Zero();
 
+    // Rotation that maps the initial configuration of the body, relative to
+    // its initial center of mass, to the configuration at the midpoint of the
+    // present time step.
+    Eigen::Matrix3d d_rotation_mat_half = Eigen::Matrix3d::Identity();
+
+    /*
+     * Reference configuration data of the local part of the mesh.
+     *
+     * For each local node, d_node_X_dofs stores the NDIM DOF indices of the
+     * position and d_node_dr stores the initial displacement from the initial
+     * center of mass.  For each node of each active local element,
+     * d_elem_node_U_dofs stores the NDIM DOF indices of the velocity,
+     * d_elem_node_vol stores the integral of the nodal basis function over the
+     * element, and d_elem_node_moment stores the integral of the nodal basis
+     * function times the initial displacement from the initial center of mass.
+     * Since the structure moves rigidly, the momentum of the structure can be
+     * computed from these integrals and the nodal velocities without
+     * reinitializing the elements.
+     */
+    bool d_ref_mesh_data_initialized = false;
+    std::vector<unsigned int> d_ref_elem_ids;
+    std::vector<unsigned int> d_node_X_dofs;
+    std::vector<Eigen::Vector3d> d_node_dr;
+    std::vector<unsigned int> d_elem_node_U_dofs;
+    std::vector<double> d_elem_node_vol;
+    std::vector<Eigen::Vector3d> d_elem_node_moment;
+
     /*
      * A boolean value indicating whether the class is registered with the
      * restart database.
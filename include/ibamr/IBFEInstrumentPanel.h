@@ -22,6 +22,8 @@
 #include "ibtk/ibtk_macros.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "BoxArray.h"
+#include "Index.h"
 #include "tbox/DescribedClass.h"
 #include "tbox/Pointer.h"
 
@@ -36,8 +38,12 @@ IBTK_DISABLE_EXTRA_WARNINGS
 #include <boost/multi_array.hpp>
 IBTK_ENABLE_EXTRA_WARNINGS
 
+#include <array>
 #include <fstream>
+#include <map>
 #include <memory>
+#include <utility>
+#include <vector>
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
 
@@ -70,7 +76,9 @@ public:
     /*!
      * \brief initialize data which depends on the Cartesian grid hierarchy.
      *
-     * \note this is done each time we compute things with the meter.
+     * \note this is done each time we compute things with the meter. the
+     * quadrature points of the meters are only located again in the patch
+     * hierarchy if a meter has moved or if the patch hierarchy has changed.
      */
     void initializeHierarchyDependentData(IBAMR::IBFEMethod* ib_method_ops,
                                           SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
@@ -126,9 +134,20 @@ private:
     /*!
      * \brief initialize data which depend on the FE equation systems for
      * the meter mesh.  this includes computing the max radius of the mesh
-     * in the current configuration, and updating the mesh's system data.
+     * in the current configuration, and updating the mesh's system data
+     * from the (serialized) solutions of the parent mesh.
+     *
+     * \return Whether the meter has moved since the last update.
      */
-    void initializeSystemDependentData(IBAMR::IBFEMethod* ib_method_ops, int meter_mesh_number);
+    bool initializeSystemDependentData(const std::vector<double>& U_coords_parent,
+                                       const std::vector<double>& dX_coords_parent,
+                                       int meter_mesh_number);
+
+    /*!
+     * \brief build the quadrature rule of the meter mesh in its reference
+     * configuration for the current quadrature order.
+     */
+    void buildMeterQuadRule(int meter_mesh_number);
 
     /*!
      * \brief write out data to file.
@@ -245,39 +264,62 @@ private:
     std::ofstream d_flux_stream;
 
     /*!
-     * \brief for ordering objects in a multimap.
+     * \brief struct for storing the quadrature rule of a meter mesh in its
+     * reference configuration, which only changes with the quadrature order.
+     * the dof indices of the displacement system of each element are ordered
+     * by variable.
      */
-    struct IndexFortranOrder
+    struct MeterQuadRule
     {
-        inline bool operator()(const SAMRAI::hier::Index<NDIM>& lhs, const SAMRAI::hier::Index<NDIM>& rhs) const
-        {
-            return (lhs(0) < rhs(0)
-#if (NDIM > 1)
-                    || (lhs(0) == rhs(0) && lhs(1) < rhs(1))
-#if (NDIM > 2)
-                    || (lhs(0) == rhs(0) && lhs(1) == rhs(1) && lhs(2) < rhs(2))
-#endif
-#endif
-            );
-        }
+        libMesh::Order order = libMesh::INVALID_ORDER;
+        std::vector<std::vector<libMesh::dof_id_type> > elem_dof_indices;
+        IBTK::EigenAlignedVector<IBTK::Vector> elem_normal;
+        std::vector<unsigned int> qp_elem;
+        std::vector<libMesh::Point> qp_xyz;
+        std::vector<std::vector<double> > qp_phi;
+        std::vector<double> qp_JxW;
     };
+    std::vector<MeterQuadRule> d_meter_quad_rules;
+
+    /*!
+     * \brief the displacement dofs of the perimeter nodes and the physical
+     * locations of the quadrature points of each meter mesh when the
+     * quadrature points were last located.
+     */
+    std::vector<std::vector<double> > d_meter_dX_dofs;
+    std::vector<IBTK::EigenAlignedVector<IBTK::Vector> > d_meter_qp_xyz_current;
+
+    /*!
+     * \brief the coefficients of the velocity dofs of the local elements of
+     * each meter mesh in the flow due to the motion of the meter.
+     */
+    std::vector<std::vector<std::pair<libMesh::dof_id_type, double> > > d_flux_correction_weights;
 
     /*!
-     * \brief struct for storing information about the quadrature points.
+     * \brief struct for storing information about the quadrature points: the
+     * lower index and the weights of the lower points in each direction of
+     * the linear interpolation stencils of cell-centered data and of each
+     * component of side-centered data.
      */
     struct QuadPointStruct
     {
         int meter_num;
         IBTK::Vector normal;
-        IBTK::Vector qp_xyz_current;
         double JxW;
+        SAMRAI::hier::Index<NDIM> cc_lower;
+        IBTK::Vector cc_wgt;
+        std::array<SAMRAI::hier::Index<NDIM>, NDIM> sc_lower;
+        std::array<IBTK::Vector, NDIM> sc_wgt;
     };
 
     /*!
-     * \brief a multimap which associates SAMRAI indices with quadrature point structures.
+     * \brief the quadrature points in each local patch, indexed by level and
+     * patch number, and the patch hierarchy configuration for which they were
+     * computed.
      */
-    using QuadPointMap = std::multimap<SAMRAI::hier::Index<NDIM>, QuadPointStruct, IndexFortranOrder>;
-    std::vector<QuadPointMap> d_quad_point_map;
+    std::vector<std::map<int, IBTK::EigenAlignedVector<QuadPointStruct> > > d_patch_quad_points;
+    std::vector<SAMRAI::hier::BoxArray<NDIM> > d_level_boxes;
+    std::vector<std::vector<int> > d_level_patch_owners;
 };
 } // namespace IBAMR
 
@@ -163,6 +163,33 @@ class IBFEDirectForcingKinematics;
  *   previous entry.
  *   <li><code>IB_use_consistent_mass_matrix</code>: Overriding alias of
  *   the previous entry.</li>
+ *   <li><code>use_matrix_free_mass_operator</code>: Whether or not L2
+ *   projections with the consistent mass matrix should apply the mass
+ *   operator element-by-element inside a Jacobi-preconditioned CG solver
+ *   instead of assembling and storing a sparse mass matrix for each system.
+ *   The solver can be configured at runtime with PETSc options prefixed by
+ *   <code>mf_l2_proj_</code>. Defaults to <code>FALSE</code>.</li>
+ *   <li><code>use_incremental_element_mappings</code>: Whether or not the
+ *   mappings between elements and patches should be updated after regridding
+ *   by only re-bucketing the elements that moved across grid cells, using
+ *   the previous mapping as a starting point. See
+ *   IBTK::FEDataManager::setUseIncrementalElementMappings(). Defaults to
+ *   <code>FALSE</code>.</li>
+ *   <li><code>restore_element_mappings_from_restart</code>: Whether or not
+ *   the mappings between elements and patches should be saved in restart
+ *   files and restored from them when restarting, instead of being
+ *   recomputed. See
+ *   IBTK::FEDataManager::setRestoreElementMappingsFromRestart(). Defaults to
+ *   <code>FALSE</code>.</li>
+ *   <li><code>use_bounding_box_tagging</code>: Whether or not cells should be
+ *   tagged for refinement using the bounding boxes of the elements instead of
+ *   the locations of their quadrature points. See
+ *   IBTK::FEDataManager::setUseBoundingBoxTagging(). Defaults to
+ *   <code>FALSE</code>.</li>
+ *   <li><code>use_reference_quadrature_cache</code>: Whether or not element
+ *   quadrature data computed on the reference configuration should be
+ *   stored and reused across time steps. May be a single boolean or one
+ *   boolean per part. Defaults to <code>FALSE</code>.</li>
  *   <li><code>interp_use_nodal_quadrature</code>: Whether or not nodal
  *   quadrature should be used, which is essentially interpolation instead of
  *   projection. This is an experimental feature. Defaults to
@@ -170,6 +197,15 @@ class IBFEDirectForcingKinematics;
  *   <li><code>spread_use_nodal_quadrature</code>: Same as above, but for spreading.
  *   <li><code>IB_use_nodal_quadrature</code>: overriding alias for the two previous
  *   entries - has the same default.</li>
+ *   <li><code>interp_use_threaded_quadrature</code>: Whether or not to use
+ *   OpenMP threads to evaluate values at the quadrature points of the
+ *   elements on each patch. The results do not depend on the number of
+ *   threads. This option has no effect unless IBTK is compiled with OpenMP
+ *   enabled, and is ignored for subdivision elements. Defaults to
+ *   <code>FALSE</code>.</li>
+ *   <li><code>spread_use_threaded_quadrature</code>: Same as above, but for spreading.
+ *   <li><code>IB_use_threaded_quadrature</code>: overriding alias for the two previous
+ *   entries - has the same default.</li>
  * </ul>
  *
  * <h2>Options Controlling libMesh Partitioning</h2>
@@ -197,7 +233,25 @@ class IBFEDirectForcingKinematics;
  *  <li>If <code>libmesh_partitioner_type</code> is <code>SAMRAI_BOX</code>
  *      then this class will always repartition the libMesh data with
  *      IBTK::BoxPartitioner every time the Eulerian data is regridded.</li>
+ *
+ *  <li>If <code>libmesh_partitioner_type</code> is
+ *      <code>SPACE_FILLING_CURVE</code> then this class will always
+ *      repartition the libMesh data with IBTK::SpaceFillingCurvePartitioner
+ *      every time the Eulerian data is regridded. This gives each processor
+ *      a contiguous, equally sized piece of the mesh along a Hilbert curve
+ *      which is matched as closely as possible with the patches owned by
+ *      that processor. If <code>libmesh_partitioner_use_quadrature_weights</code>
+ *      is <code>TRUE</code> (the default is <code>FALSE</code>) then the
+ *      pieces contain equal numbers of interpolation quadrature points instead
+ *      of equal numbers of elements.</li>
  * </ul>
+ * If <code>libmesh_repartition_threshold</code> is set to a nonnegative
+ * value then, before each regrid, the fraction of the elements on each
+ * processor's patches that are owned by other processors is computed for
+ * each part and that part is only repartitioned if the fraction exceeds the
+ * threshold. In this case a <code>libmesh_partitioner_type</code> of
+ * <code>LIBMESH_DEFAULT</code> uses IBTK::SpaceFillingCurvePartitioner for
+ * these repartitions.
  * The default value for <code>libmesh_partitioner_type</code> is
  * <code>LIBMESH_DEFAULT</code>. The intent of these choices is to
  * automatically use the fairest (that is, partitioning based on equal work
@@ -275,17 +329,29 @@ class IBFEDirectForcingKinematics;
  * <code>FALSE</code>) turns on the scratch hierarchy and the remaining
  * parameters determine how patches are generated and load balanced. The extra
  * argument <code>type</code> to <code>LoadBalancer</code> specifies whether
- * an IBTK::MergingLoadBalancer (chosen by <code>"MERGING"</code>) or the
- * default SAMRAI LoadBalancer (chosen by <code>"DEFAULT"</code>) is
- * used. Since IBTK::MergingLoadBalancer is usually what one wants
- * <code>"MERGING"</code> is the default. The merging option is better since
- * it reduces the total number of elements which end up in patch ghost
- * regions since some patches will be merged together.
+ * an IBTK::MergingLoadBalancer (chosen by <code>"MERGING"</code>), an
+ * IBTK::SpaceFillingCurveLoadBalancer (chosen by
+ * <code>"SPACE_FILLING_CURVE"</code>), or the default SAMRAI LoadBalancer
+ * (chosen by <code>"DEFAULT"</code>) is used. Since IBTK::MergingLoadBalancer
+ * is usually what one wants <code>"MERGING"</code> is the default. The merging
+ * option is better since it reduces the total number of elements which end up
+ * in patch ghost regions since some patches will be merged together. The
+ * space-filling curve option additionally balances the number of quadrature
+ * points per process and keeps the patches near each part of the structure on
+ * a small number of neighboring processes.
  *
  * The parameter <code>workload_quad_point_weight</code> is the multiplier
- * assigned to an IB point when calculating the work per processor: in the
- * future additional weights, such as <code>workload_node_point_weight</code>
- * will also be added.
+ * assigned to an IB point when calculating the work per processor. The
+ * parameters <code>workload_spread_quad_point_weight</code>,
+ * <code>workload_interp_quad_point_weight</code>, and
+ * <code>workload_stress_quad_point_weight</code> (all of which default to
+ * zero) are added to it and account separately for the cost of force
+ * spreading, velocity interpolation, and stress assembly relative to the
+ * work on one Eulerian cell. If <code>workload_calibration_steps</code> is
+ * set to a positive number N then these phases are timed over the first N
+ * time steps and the resulting per-quadrature point costs, relative to the
+ * measured per-cell cost of the rest of the time step, replace all four
+ * weights in subsequent load balancing.
  *
  * <h2>Options Controlling Logging</h2>
  * The logging options set by this class are propagated to the owned
@@ -766,6 +832,46 @@ protected:
      */
     bool d_use_scratch_hierarchy = false;
 
+    /*!
+     * Boolean controlling whether or not the FEDataManager objects should
+     * update the mappings between elements and patches incrementally after
+     * regridding.
+     */
+    bool d_use_incremental_element_mappings = false;
+
+    /*!
+     * Boolean controlling whether or not the primary FEDataManager objects
+     * should save the mappings between elements and patches in restart files
+     * and restore them when restarting.
+     */
+    bool d_restore_element_mappings_from_restart = false;
+
+    /*!
+     * Boolean controlling whether or not the FEDataManager objects should tag
+     * cells for refinement using the bounding boxes of the elements.
+     */
+    bool d_use_bounding_box_tagging = false;
+
+    /*!
+     * Boolean controlling whether or not IBTK::SpaceFillingCurvePartitioner
+     * weights elements by their number of interpolation quadrature points.
+     */
+    bool d_use_quadrature_partitioner_weights = false;
+
+    /*!
+     * If nonnegative, the libMesh data is only repartitioned when the
+     * fraction of nonlocal patch elements (see
+     * IBTK::FEDataManager::computeNonLocalPatchElementFraction()) prior to
+     * regridding exceeds this value. Negative values disable the check.
+     */
+    double d_libmesh_repartition_threshold = -1.0;
+
+    /*!
+     * Whether or not each part will be repartitioned at the end of the
+     * current regrid. Set in beginDataRedistribution().
+     */
+    std::vector<bool> d_repartition_part;
+
     /*!
      * Pointers to the patch hierarchy and gridding algorithm objects associated
      * with this object.
@@ -910,6 +1016,20 @@ protected:
     IBTK::FEDataManager::SpreadSpec d_default_spread_spec;
     IBTK::FEDataManager::WorkloadSpec d_default_workload_spec;
     std::vector<IBTK::FEDataManager::WorkloadSpec> d_workload_spec;
+
+    /*!
+     * Data used to calibrate the workload model: the number of time steps
+     * over which each phase is timed, the number of steps timed so far, and
+     * the accumulated wall clock times of the full time step and of force
+     * spreading, velocity interpolation, and stress assembly.
+     */
+    int d_workload_calibration_steps = 0;
+    int d_workload_calibration_step_num = 0;
+    double d_workload_calibration_step_start_time = 0.0;
+    double d_workload_calibration_step_time = 0.0;
+    double d_workload_calibration_spread_time = 0.0;
+    double d_workload_calibration_interp_time = 0.0;
+    double d_workload_calibration_stress_time = 0.0;
     std::vector<IBTK::FEDataManager::InterpSpec> d_interp_spec;
     std::vector<IBTK::FEDataManager::SpreadSpec> d_spread_spec;
     bool d_split_normal_force = false, d_split_tangential_force = false;
@@ -1012,6 +1132,13 @@ private:
      * explicitly asserts that this condition is met.
      */
     void assertStructureOnFinestLevel() const;
+
+    /*!
+     * Fit the quadrature point weights of the workload model to the phase
+     * timings collected over the first d_workload_calibration_steps time
+     * steps and apply them to all parts.
+     */
+    void calibrateWorkloadSpecs();
 };
 } // namespace IBAMR
 
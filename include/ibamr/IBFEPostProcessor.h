@@ -43,6 +43,7 @@
 
 #include "petscsys.h"
 
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -61,6 +62,11 @@ namespace IBAMR
  * \brief Class IBFEPostProcessor is a generic interface for specifying the
  * implementation details of a particular post processing algorithm for the
  * IB/FE scheme.
+ *
+ * The post-processed variables are evaluated lazily: they are only
+ * reconstructed when they are requested (by postProcessData() or updateData())
+ * and have been marked stale, by markDataStale() or by a request at a different
+ * time, since they were last computed.
  */
 class IBFEPostProcessor
 {
@@ -123,10 +129,8 @@ public:
         TBOX_ASSERT(ctx);
         auto PK1_stress_fcn_data = static_cast<IBFEMethod::PK1StressFcnData*>(ctx);
         TBOX_ASSERT(PK1_stress_fcn_data);
-        IBTK::TensorMeshFcnPtr PK1_stress_fcn = PK1_stress_fcn_data->fcn;
-        void* PK1_stress_fcn_ctx = PK1_stress_fcn_data->ctx;
         libMesh::TensorValue<double> PP;
-        PK1_stress_fcn(PP, FF, X, s, elem, system_var_data, system_grad_var_data, data_time, PK1_stress_fcn_ctx);
+        PK1_stress_fcn_data->evaluate(PP, FF, X, s, elem, system_var_data, system_grad_var_data, data_time);
         sigma = PP * FF.transpose() / FF.det();
         return;
     } // cauchy_stress_from_PK1_stress_fcn
@@ -274,8 +278,35 @@ public:
      */
     virtual void initializeFEData();
 
+    /*!
+     * Indicate that the data from which the post-processed variables are
+     * computed have changed, e.g., after a time step or a regrid. The variables
+     * are reconstructed at the given time the next time that they are
+     * requested.
+     *
+     * \note This is cheap and may be called at every time step.
+     */
+    virtual void markDataStale(double data_time);
+
+    /*!
+     * \return Whether the post-processed variables need to be recomputed
+     * before they are read.
+     */
+    bool isDataStale() const;
+
+    /*!
+     * Execute all reconstruction and interpolation operations at the time
+     * provided to markDataStale() if the post-processed variables are stale.
+     * Writers and instruments should call this function (or postProcessData())
+     * before they read the post-processed systems.
+     */
+    virtual void updateData();
+
     /*!
      * Execute all reconstruction and interpolation operations.
+     *
+     * \note Nothing is done if the post-processed variables have already been
+     * computed at data_time and have not been marked stale since.
      */
     virtual void postProcessData(double data_time);
 
@@ -344,6 +375,13 @@ protected:
      */
     std::vector<libMesh::System*> d_var_systems;
 
+    /*!
+     * Whether the post-processed variables need to be recomputed and the time
+     * at which they are (to be) computed.
+     */
+    bool d_data_is_stale = true;
+    double d_data_time = std::numeric_limits<double>::quiet_NaN();
+
 private:
     /*!
      * \brief Default constructor.
@@ -611,6 +611,16 @@ protected:
     std::vector<LagSurfaceForceFcnData> d_lag_surface_force_fcn_data;
     std::vector<libMesh::VectorValue<double> > d_lag_surface_force_integral;
 
+    /*
+     * Reference positions, unit normals, and area elements at the quadrature
+     * points of the active local elements of each part, used when computing
+     * surface forces, along with the IDs of the elements for which they were
+     * computed.
+     */
+    std::vector<std::vector<libMesh::dof_id_type> > d_reference_elem_ids;
+    std::vector<std::vector<libMesh::VectorValue<double> > > d_reference_X_qp, d_reference_N_qp;
+    std::vector<std::vector<double> > d_reference_dA_qp;
+
     /*
      * Nonuniform load balancing data structures.
      */
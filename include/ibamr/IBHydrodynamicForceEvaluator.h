@@ -21,6 +21,7 @@
 
 #include "Box.h"
 #include "CellVariable.h"
+#include "PatchLevel.h"
 #include "RobinBcCoefStrategy.h"
 #include "SideVariable.h"
 #include "tbox/Pointer.h"
@@ -49,8 +50,6 @@ template <int DIM>
 class Patch;
 template <int DIM>
 class PatchHierarchy;
-template <int DIM>
-class PatchLevel;
 } // namespace hier
 namespace pdat
 {
@@ -320,6 +319,20 @@ private:
      */
     IBHydrodynamicForceEvaluator& operator=(const IBHydrodynamicForceEvaluator& that) = delete;
 
+    /*!
+     * \brief Reset the face area and face volume weights if the configuration
+     * of the patch hierarchy has changed since they were last computed.
+     */
+    void resetWeights(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > patch_hierarchy);
+
+    /*!
+     * \brief Return the cell index boxes of the control volumes of all
+     * registered structures on the given level, in the order of the structure
+     * IDs.
+     */
+    std::vector<SAMRAI::hier::Box<NDIM> >
+    getIntegrationBoxes(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level) const;
+
     /*!
      * \brief Reset weight of the cell face to face area.
      */
@@ -376,6 +389,12 @@ private:
      */
     int d_face_wgt_sc_idx, d_vol_wgt_sc_idx;
 
+    /*!
+     * \brief Levels of the patch hierarchy for which the weights were last
+     * computed.
+     */
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > > d_wgt_levels;
+
     /*!
      * \brief Data structure encapsulating hydrodynamic force on an object.
      */
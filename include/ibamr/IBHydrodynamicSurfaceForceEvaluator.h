@@ -21,11 +21,13 @@
 #include "ibamr/AdvDiffHierarchyIntegrator.h"
 #include "ibamr/INSHierarchyIntegrator.h"
 
+#include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/ibtk_macros.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "Box.h"
 #include "CellVariable.h"
+#include "PatchLevel.h"
 #include "RobinBcCoefStrategy.h"
 #include "tbox/DescribedClass.h"
 #include "tbox/Pointer.h"
@@ -35,6 +37,7 @@ IBTK_DISABLE_EXTRA_WARNINGS
 #include "Eigen/Geometry"
 IBTK_ENABLE_EXTRA_WARNINGS
 
+#include <array>
 #include <iosfwd>
 #include <limits>
 #include <map>
@@ -175,6 +178,17 @@ private:
                        bool use_current_ctx,
                        bool use_new_ctx);
 
+    /*!
+     * Build the object that fills the ghost cells of all of the required
+     * quantities at once.
+     */
+    SAMRAI::tbox::Pointer<IBTK::HierarchyGhostCellInterpolation>
+    buildGhostFill(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > patch_hierarchy,
+                   bool use_current_ctx,
+                   bool use_new_ctx,
+                   SAMRAI::solv::RobinBcCoefStrategy<NDIM>* p_ins_bc_coef,
+                   SAMRAI::solv::RobinBcCoefStrategy<NDIM>* p_vc_ins_bc_coef);
+
     /*!
      * \brief Object name.
      */
@@ -220,6 +234,13 @@ private:
      */
     bool d_mu_is_const;
 
+    /*!
+     * \brief Ghost cell interpolation objects for the current and new contexts
+     * and the patch levels for which they were built.
+     */
+    std::array<SAMRAI::tbox::Pointer<IBTK::HierarchyGhostCellInterpolation>, 2> d_hier_bdry_fill;
+    std::array<std::vector<SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > >, 2> d_hier_bdry_fill_levels;
+
     /*!
      * \brief The contour level that describes the surface of the solid object.
      */
@@ -18,9 +18,12 @@
 
 #include "ibamr/IBStrategy.h"
 
+#include "tbox/Utilities.h"
+
 #include "petscmat.h"
 #include "petscvec.h"
 
+#include <string>
 #include <vector>
 
 namespace IBTK
@@ -138,6 +141,27 @@ public:
                                    int dof_index_idx,
                                    double data_time) = 0;
 
+    /*!
+     * Construct the IB interpolation operator for the named LEInteractor
+     * kernel function.
+     *
+     * This operator is only implemented for structures described by
+     * Lagrangian markers (class IBMethod).  It is assembled anew at each
+     * call, even if the structure positions have not changed.
+     *
+     * A default implementation is provided that emits an unrecoverable
+     * exception.
+     */
+    virtual void constructInterpOp(Mat& /*J*/,
+                                   const std::string& /*kernel_fcn*/,
+                                   const std::vector<int>& /*num_dofs_per_proc*/,
+                                   int /*dof_index_idx*/,
+                                   double /*data_time*/)
+    {
+        TBOX_ERROR("IBImplicitStrategy::constructInterpOp(): unimplemented\n");
+        return;
+    }
+
 protected:
 private:
     /*!
@@ -225,42 +225,36 @@ private:
     std::vector<double> d_flow_values, d_mean_pres_values, d_point_pres_values;
 
     /*!
-     * \brief Data structures employed to manage mappings between cell indices
+     * \brief Data structures employed to manage mappings between local patches
      * and web patch data (i.e., patch centroids and area-weighted normals) and
      * meter centroid data.
+     *
+     * The sampling plan is built by initializeHierarchyDependentData(), which
+     * records, for each local patch, the web patches and centroids that are
+     * sampled in the cells of that patch along with the cell index and cell
+     * center used to interpolate the Eulerian data.
      */
-    struct IndexFortranOrder
-    {
-        inline bool operator()(const SAMRAI::hier::Index<NDIM>& lhs, const SAMRAI::hier::Index<NDIM>& rhs) const
-        {
-            return (lhs(0) < rhs(0)
-#if (NDIM > 1)
-                    || (lhs(0) == rhs(0) && lhs(1) < rhs(1))
-#if (NDIM > 2)
-                    || (lhs(0) == rhs(0) && lhs(1) == rhs(1) && lhs(2) < rhs(2))
-#endif
-#endif
-            );
-        } // operator()
-    };
-
     struct WebPatch
     {
         int meter_num;
         const IBTK::Vector* X;
         const IBTK::Vector* dA;
+        SAMRAI::hier::Index<NDIM> i;
+        IBTK::Point X_cell;
     };
 
-    using WebPatchMap = std::multimap<SAMRAI::hier::Index<NDIM>, WebPatch, IndexFortranOrder>;
+    using WebPatchMap = std::map<int, IBTK::EigenAlignedVector<WebPatch> >;
     std::vector<WebPatchMap> d_web_patch_map;
 
     struct WebCentroid
     {
         int meter_num;
         const IBTK::Vector* X;
+        SAMRAI::hier::Index<NDIM> i;
+        IBTK::Point X_cell;
     };
 
-    using WebCentroidMap = std::multimap<SAMRAI::hier::Index<NDIM>, WebCentroid, IndexFortranOrder>;
+    using WebCentroidMap = std::map<int, IBTK::EigenAlignedVector<WebCentroid> >;
     std::vector<WebCentroidMap> d_web_centroid_map;
 
     /*
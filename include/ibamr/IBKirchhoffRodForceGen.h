@@ -130,9 +130,21 @@ private:
     //\{
     std::vector<Mat> d_D_next_mats, d_X_next_mats;
     std::vector<std::vector<int> > d_petsc_curr_node_idxs, d_petsc_next_node_idxs;
-    std::vector<std::vector<std::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> > > d_material_params;
     std::vector<bool> d_is_initialized;
     //\}
+
+    /*!
+     * \name Rod data stored in structure-of-arrays form for the force kernel.
+     *
+     * For each level, d_local_curr_node_idxs[ln][k] is the local (process)
+     * index of the "current" node of rod k, and d_rod_params[ln][p * n + k]
+     * is material parameter p of rod k (with 1/ds stored in place of ds),
+     * where n is the number of local rods.
+     */
+    //\{
+    std::vector<std::vector<int> > d_local_curr_node_idxs;
+    std::vector<std::vector<double> > d_rod_params;
+    //\}
 };
 } // namespace IBAMR
 
@@ -26,6 +26,7 @@
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "Box.h"
 #include "GriddingAlgorithm.h"
 #include "IntVector.h"
 #include "LoadBalancer.h"
@@ -36,6 +37,7 @@
 #include "petscsys.h"
 #include "petscvec.h"
 
+#include <array>
 #include <limits>
 #include <set>
 #include <string>
@@ -146,6 +148,18 @@ public:
      */
     const SAMRAI::hier::IntVector<NDIM>& getMinimumGhostCellWidth() const override;
 
+    /*!
+     * Return the number of ghost cells required by the interpolation kernel
+     * function.
+     */
+    SAMRAI::hier::IntVector<NDIM> getMinimumGhostCellWidthForInterpolation() const override;
+
+    /*!
+     * Return the number of ghost cells required by the spreading kernel
+     * function.
+     */
+    SAMRAI::hier::IntVector<NDIM> getMinimumGhostCellWidthForSpreading() const override;
+
     /*!
      * Setup the tag buffer.
      */
@@ -266,6 +280,19 @@ public:
      */
     void trapezoidalStep(double current_time, double new_time) override;
 
+    /*!
+     * Advance the positions of the Lagrangian structure in several explicit
+     * midpoint substeps with the Eulerian velocity held fixed, and set the
+     * midpoint force to the average force along the subcycled trajectory.
+     */
+    void subcycledMidpointStep(
+        int u_data_idx,
+        const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > >& u_synch_scheds,
+        const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
+        double current_time,
+        double new_time,
+        int num_substeps) override;
+
     /*!
      * Compute the Lagrangian force at the specified time within the current
      * time interval.
@@ -313,6 +340,16 @@ public:
                            int dof_index_idx,
                            double data_time) override;
 
+    /*!
+     * Construct the IB interpolation operator for the named LEInteractor
+     * kernel function.
+     */
+    void constructInterpOp(Mat& J,
+                           const std::string& kernel_fcn,
+                           const std::vector<int>& num_dofs_per_proc,
+                           int dof_index_idx,
+                           double data_time) override;
+
     /*!
      * Indicate whether there are any internal fluid sources/sinks.
      */
@@ -542,6 +579,18 @@ protected:
     bool d_error_if_points_leave_domain = false;
     SAMRAI::hier::IntVector<NDIM> d_ghosts;
 
+    /*
+     * Whether or not the LDataManager should order the local Lagrangian nodes
+     * along a Hilbert curve through the Cartesian grid.
+     */
+    bool d_use_sfc_node_ordering = false;
+
+    /*
+     * Whether or not the LDataManager should tag cells for refinement using
+     * the bounding boxes of the Lagrangian nodes on each patch.
+     */
+    bool d_use_bounding_box_tagging = false;
+
     /*
      * Lagrangian variables.
      */
@@ -587,6 +636,22 @@ protected:
     std::vector<int> d_n_src;
     bool d_normalize_source_strength = false;
 
+    /*
+     * Source/sink stencils, indexed by level number and local patch number.
+     * Each stencil stores the index of the source, the intersection of the
+     * source stencil with the patch, and the one-dimensional factors of the
+     * kernel weights.  The stencils are recomputed whenever the source
+     * locations are updated and are shared by spreading and interpolation.
+     */
+    struct SourceStencil
+    {
+        int src_idx;
+        SAMRAI::hier::Box<NDIM> box;
+        std::array<std::vector<double>, NDIM> wgt;
+    };
+    std::vector<std::vector<std::vector<SourceStencil> > > d_src_stencils;
+    std::vector<bool> d_src_stencils_valid;
+
     /*
      * Post-processor object.
      */
@@ -653,6 +718,12 @@ private:
      */
     void resetLagrangianSourceFunction(double init_data_time, bool initial_time);
 
+    /*!
+     * Compute the source/sink stencils on the specified level from the present
+     * source locations and radii.
+     */
+    void computeSourceStencils(int ln);
+
     /*!
      * Compute the flow rates and pressures in the internal flow meters and
      * pressure gauges.
@@ -672,10 +743,16 @@ private:
 
     /*!
      * Jacobian data.
+     *
+     * The assembled Jacobian is updated in place while its nonzero structure
+     * remains valid, and its values are recomputed every d_force_jac_lag
+     * linearizations.
      */
     bool d_force_jac_mffd = false;
     Mat d_force_jac = nullptr;
     double d_force_jac_data_time;
+    bool d_force_jac_structure_is_valid = false;
+    int d_force_jac_lag = 1, d_num_force_jac_lagged_updates = 0;
 };
 } // namespace IBAMR
 
@@ -65,6 +65,13 @@ namespace IBAMR
  *
  * \todo Document input database entries.
  *
+ * If the optional input key <code>distribute_structure_generation</code> is
+ * set to <code>TRUE</code>, the function registered with
+ * registerInitStructureFunction() is called for each structure on only one MPI
+ * process (assigned in a round-robin fashion) and the generated vertex
+ * positions are then broadcast to all processes, instead of calling the
+ * function for every structure on every process.  This requires that the
+ * function does not depend on being called on all processes.
  */
 class IBRedundantInitializer : public IBTK::LInitStrategy
 {
@@ -743,6 +750,26 @@ protected:
      */
     bool d_data_processed = false;
 
+    /*
+     * Whether to call the structure initialization function on one process
+     * per structure and broadcast the generated vertex positions.
+     */
+    bool d_distribute_structure_generation = false;
+
+    /*
+     * The vertices of each level sorted by the bins (blocks of cells of a
+     * given patch level) in which they are initially located, keyed by the
+     * level number of the vertices and the level number of the patches.  This
+     * spatial index permits getPatchVerticesAtLevel() to examine only the
+     * vertices near the patch instead of all vertices.
+     */
+    struct BinnedVertex
+    {
+        std::array<int, NDIM> bin, cell;
+        std::pair<int, int> point_index;
+    };
+    mutable std::map<std::pair<int, int>, std::vector<BinnedVertex> > d_binned_vertices;
+
 private:
     /*
      * Functions used to initialize structures programmatically.
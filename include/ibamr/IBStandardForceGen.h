@@ -28,6 +28,7 @@
 
 #include <map>
 #include <set>
+#include <utility>
 #include <vector>
 
 namespace IBTK
@@ -63,6 +64,16 @@ namespace IBAMR
  * force function with any function that implements the interface required by
  * registerSpringForceFunction().  Users may also specify additional force
  * functions that may be associated with arbitrary integer indices.
+ *
+ * \note If input database key \p deduplicate_parameters is true (default
+ * false), the distinct spring parameter sets, beam rigidities and curvatures,
+ * and target point stiffnesses and damping coefficients of each level are
+ * copied to compact tables when the level data are initialized, and the force
+ * computations read the parameters from these tables. This reduces the memory
+ * traffic of the force computations for structures in which many springs,
+ * beams, or target points share the same parameters. Changes made to the
+ * parameters stored in the force specifications then only take effect when the
+ * level data are next initialized, e.g., after regridding.
  */
 class IBStandardForceGen : public IBLagrangianForceStrategy
 {
@@ -187,30 +198,69 @@ private:
         std::vector<SpringForceFcnPtr> force_fcns;
         std::vector<SpringForceDerivFcnPtr> force_deriv_fcns;
         std::vector<const double*> parameters;
+
+        // The distinct parameter sets, if parameters are deduplicated.
+        std::vector<double> parameter_table;
+
+        // Springs which only involve local nodes are stored first so that they
+        // can be evaluated while the ghost node positions are communicated.
+        // Within each of these groups, springs which use default_spring_force()
+        // are stored first so that they can be evaluated without calling
+        // through a function pointer. Springs whose master nodes belong to
+        // inactivated structures are stored last and are not evaluated.
+        int num_local_springs = 0, num_active_springs = 0;
+        int num_local_linear_springs = 0, num_nonlocal_linear_springs = 0;
     };
     std::vector<SpringData> d_spring_data;
 
     struct BeamData
     {
+        std::vector<int> lag_mastr_node_idxs;
         std::vector<int> petsc_mastr_node_idxs, petsc_next_node_idxs, petsc_prev_node_idxs;
         std::vector<int> petsc_global_mastr_node_idxs, petsc_global_next_node_idxs, petsc_global_prev_node_idxs;
         std::vector<const double*> rigidities;
         std::vector<const IBTK::Vector*> curvatures;
+
+        // The distinct rigidities and curvatures, if parameters are
+        // deduplicated.
+        std::vector<double> rigidity_table;
+        IBTK::EigenAlignedVector<IBTK::Vector> curvature_table;
+
+        // Beams which only involve local nodes are stored first. Beams whose
+        // master nodes belong to inactivated structures are stored last and are
+        // not evaluated.
+        int num_local_beams = 0, num_active_beams = 0;
     };
     std::vector<BeamData> d_beam_data;
 
     struct TargetPointData
     {
-        std::vector<int> petsc_node_idxs, petsc_global_node_idxs;
+        std::vector<int> lag_node_idxs, petsc_node_idxs, petsc_global_node_idxs;
         std::vector<const double*> kappa, eta;
+        std::vector<double> kappa_table, eta_table;
         std::vector<const IBTK::Point*> X0;
+
+        // Target points of inactivated structures are stored last and are not
+        // evaluated.
+        int num_active_target_points = 0;
     };
     std::vector<TargetPointData> d_target_point_data;
 
     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_X_ghost_data, d_F_ghost_data, d_dX_data;
     std::vector<bool> d_is_initialized;
+
+    // The Lagrangian index ranges of the inactivated structures for which the
+    // cached data were last sorted.
+    std::vector<std::vector<std::pair<int, int> > > d_inactive_lag_idx_ranges;
     //\}
 
+    /*!
+     * Sort the cached data of the specified level so that the force
+     * computations traverse the node data in (nearly) increasing order and
+     * skip the nodes of inactivated structures.
+     */
+    void sortLevelData(int level_number, int num_local_nodes);
+
     /*!
      * Spring force routines.
      */
@@ -225,7 +275,8 @@ private:
                                       SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                       int level_number,
                                       double data_time,
-                                      IBTK::LDataManager* l_data_manager);
+                                      IBTK::LDataManager* l_data_manager,
+                                      bool local_springs);
 
     /*!
      * Beam force routines.
@@ -241,7 +292,8 @@ private:
                                     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                     int level_number,
                                     double data_time,
-                                    IBTK::LDataManager* l_data_manager);
+                                    IBTK::LDataManager* l_data_manager,
+                                    bool local_beams);
 
     /*!
      * TargetPoint force routines.
@@ -270,6 +322,11 @@ private:
      * \brief Logging settings.
      */
     bool d_log_target_point_displacements = false;
+
+    /*!
+     * \brief Parameter storage settings.
+     */
+    bool d_deduplicate_parameters = false;
 };
 } // namespace IBAMR
 
@@ -65,6 +65,17 @@ namespace IBAMR
  *
  * \todo Document input database entries.
  *
+ * When structures are listed with the <TT>structure_names</TT> key, each
+ * structure is assigned to a level of the patch hierarchy either explicitly by
+ * its <TT>level_number</TT> or, if it instead provides the spacing of its
+ * Lagrangian mesh as <TT>lagrangian_spacing</TT>, automatically.  In the latter
+ * case, the structure is placed on the coarsest level whose grid spacing is at
+ * most <TT>max_grid_to_lagrangian_spacing_ratio</TT> (default 2.0) times the
+ * Lagrangian spacing, so that slender or coarsely discretized structures do
+ * not force refinement to the finest level.  The grid spacings are determined
+ * from the keys <TT>coarsest_grid_spacing</TT> and <TT>refinement_ratios</TT>
+ * (an array whose last entry is used for all finer levels; default 2).
+ *
  * \note "C-style" indices are used for all input files.
  *
  * <HR>
@@ -203,6 +214,37 @@ namespace IBAMR
  *
  * <HR>
  *
+ * <B>Binary vertex, spring, and beam file formats</B>
+ *
+ * Vertex, spring, and beam data may also be provided in binary files, which are
+ * much faster to read for large structures.  Binary files are named by
+ * appending <TT>".bin"</TT> to the name of the corresponding ASCII file (e.g.,
+ * <TT>"foo.vertex.bin"</TT>).  Binary files are only read if the input database
+ * entry <TT>use_binary_structure_files</TT> is \a TRUE (the default is \a
+ * FALSE), in which case they take precedence over the ASCII files.  A warning is
+ * printed if a binary file is older than the corresponding ASCII file.  Each
+ * binary file starts with the eight characters <TT>"IBSTRUCT"</TT>, followed
+ * by the format version (currently \a 1), the spatial dimension, and the
+ * number of records, each stored as a 32-bit integer.  The records follow:
+ *
+ * - vertex files: the NDIM coordinates of each vertex as doubles;
+ * - spring files: the two vertex indices, the force function index, and the
+ *   number of parameters \a P (\a P >= 2) as 32-bit integers, followed by the
+ *   \a P parameters (spring constant, rest length, ...) as doubles;
+ * - beam files: the three vertex indices as 32-bit integers, followed by the
+ *   bending rigidity and the NDIM components of the curvature as doubles.
+ *
+ * If binary files are used and the input database entry
+ * <TT>use_collective_binary_vertex_reads</TT> is \a TRUE, each MPI process
+ * reads a disjoint range of the records of each binary vertex file, and the
+ * ranges are then gathered on all processes.
+ *
+ * All values are stored in the native byte order.  ASCII files may be
+ * converted to this format with the script
+ * <TT>scripts/IB/convert_structure_to_binary.pl</TT>.
+ *
+ * <HR>
+ *
  * <B> Rod file format</B>
  *
  * Rod input files end with the extension <TT>".rod"</TT> and have the following
@@ -462,6 +504,12 @@ private:
      */
     IBStandardInitializer& operator=(const IBStandardInitializer& that) = delete;
 
+    /*!
+     * \brief Return whether the binary version of the named ASCII structure
+     * file should be read instead of the ASCII file.
+     */
+    bool useBinaryFile(const std::string& ascii_filename) const;
+
     /*!
      * \brief Read the vertex data from one or more input files.
      */
@@ -539,6 +587,19 @@ private:
      */
     bool d_use_file_batons = true;
 
+    /*
+     * The boolean value determines whether binary structure files are read in
+     * place of the corresponding ASCII files when they exist.
+     */
+    bool d_use_binary_structure_files = false;
+
+    /*
+     * The boolean value determines whether binary vertex files are read
+     * collectively, with each MPI process reading a disjoint range of the
+     * records and the ranges being gathered on all processes.
+     */
+    bool d_use_collective_binary_vertex_reads = false;
+
     /*
      * The maximum number of levels in the Cartesian grid patch hierarchy and a
      * vector of boolean values indicating whether a particular level has been
@@ -154,6 +154,27 @@ public:
      */
     virtual const SAMRAI::hier::IntVector<NDIM>& getMinimumGhostCellWidth() const = 0;
 
+    /*!
+     * Return the number of ghost cells of the Eulerian velocity data required
+     * by interpolateVelocity().
+     *
+     * This may be smaller than getMinimumGhostCellWidth(), which also accounts
+     * for the other Lagrangian-Eulerian interaction routines, so that ghost
+     * cell filling before interpolation only communicates the cells that are
+     * actually read.  A default implementation is provided that returns
+     * getMinimumGhostCellWidth().
+     */
+    virtual SAMRAI::hier::IntVector<NDIM> getMinimumGhostCellWidthForInterpolation() const;
+
+    /*!
+     * Return the number of ghost cells of the Eulerian force data required by
+     * spreadForce().
+     *
+     * A default implementation is provided that returns
+     * getMinimumGhostCellWidth().
+     */
+    virtual SAMRAI::hier::IntVector<NDIM> getMinimumGhostCellWidthForSpreading() const;
+
     /*!
      * Setup the tag buffer.
      *
@@ -287,6 +308,29 @@ public:
      */
     virtual void trapezoidalStep(double current_time, double new_time) = 0;
 
+    /*!
+     * Advance the positions of the Lagrangian structure over the current time
+     * interval in \a num_substeps equal substeps while holding the Eulerian
+     * velocity field \a u_data_idx fixed.  Each substep uses the explicit
+     * midpoint rule with the Lagrangian velocity interpolated from the frozen
+     * Eulerian velocity at the substep positions.
+     *
+     * The Lagrangian force at the midpoint of the time interval is set to the
+     * average of the forces evaluated at the substep midpoints, so that a
+     * subsequent cycle can spread the force along the subcycled trajectory
+     * instead of re-evaluating it at the midpoint position.
+     *
+     * A default implementation is provided that emits an unrecoverable
+     * exception.
+     */
+    virtual void subcycledMidpointStep(
+        int u_data_idx,
+        const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > >& u_synch_scheds,
+        const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
+        double current_time,
+        double new_time,
+        int num_substeps);
+
     /*!
      * Compute the Lagrangian force at the specified time within the current
      * time interval.
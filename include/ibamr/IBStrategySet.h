@@ -90,6 +90,16 @@ public:
      * Register the IBHierarchyIntegrator object that is using this strategy
      * class.
      */
+    /*!
+     * Indicate whether the Eulerian velocity is synchronized and its ghost
+     * cells are filled once for all of the strategies in interpolateVelocity()
+     * (the coordinated mode) rather than separately by each strategy.
+     *
+     * \note The coordinated mode may only be used when every strategy in the
+     * set fills ghost cells only via the schedules it is passed.
+     */
+    void setUseCoordinatedInterpolation(bool use_coordinated_interpolation);
+
     void registerIBHierarchyIntegrator(IBHierarchyIntegrator* ib_solver) override;
 
     /*!
@@ -114,6 +124,18 @@ public:
      */
     const SAMRAI::hier::IntVector<NDIM>& getMinimumGhostCellWidth() const override;
 
+    /*!
+     * Return the number of ghost cells of the Eulerian velocity data required
+     * by the interpolation routines of all of the strategies.
+     */
+    SAMRAI::hier::IntVector<NDIM> getMinimumGhostCellWidthForInterpolation() const override;
+
+    /*!
+     * Return the number of ghost cells of the Eulerian force data required by
+     * the spreading routines of all of the strategies.
+     */
+    SAMRAI::hier::IntVector<NDIM> getMinimumGhostCellWidthForSpreading() const override;
+
     /*!
      * Setup the tag buffer.
      */
@@ -342,6 +364,12 @@ private:
      * \brief The set of IBStrategy objects.
      */
     std::vector<SAMRAI::tbox::Pointer<IBStrategy> > d_strategy_set;
+
+    /*!
+     * \brief Whether the Eulerian velocity ghost cells are filled once for all
+     * of the strategies.
+     */
+    bool d_use_coordinated_interpolation = false;
 };
 } // namespace IBAMR
 
@@ -30,6 +30,12 @@
 
 #include "libmesh/id_types.h"
 
+IBTK_DISABLE_EXTRA_WARNINGS
+#include <boost/multi_array.hpp>
+IBTK_ENABLE_EXTRA_WARNINGS
+
+#include <array>
+#include <cstddef>
 #include <limits>
 #include <string>
 #include <vector>
@@ -43,6 +49,7 @@ namespace IBTK
 {
 class LData;
 class LDataManager;
+class LNode;
 } // namespace IBTK
 namespace SAMRAI
 {
@@ -117,6 +124,41 @@ public:
      */
     void registerPK1StressTensorFunction(PK1StressFcnPtr PK1_stress_fcn, void* PK1_stress_fcn_ctx = nullptr);
 
+    /*!
+     * \brief The data of a batch of material points, stored in
+     * structure-of-arrays form.
+     *
+     * Component (i,j) of the deformation gradient of point k of the batch is
+     * FF[3 * i + j][k], component i of its current and reference positions are
+     * x[i][k] and X[i][k], and so on.  Tensors are always 3x3 (in 2D, FF(2,2) is
+     * 1).  The batch function must set PP.
+     */
+    struct MaterialPointBatch
+    {
+        std::size_t size = 0;
+        std::array<std::vector<double>, 9> FF, PP;
+        std::array<std::vector<double>, NDIM> x, X;
+        std::vector<libMesh::subdomain_id_type> subdomain_ids;
+        std::vector<std::vector<double>*> internal_vars;
+    };
+
+    /*!
+     * Typedef specifying interface for batched PK1 stress tensor function.
+     */
+    using PK1StressBatchFcnPtr = void (*)(MaterialPointBatch& batch, double time, void* ctx);
+
+    /*!
+     * Register the (optional) function to compute the first Piola-Kirchhoff
+     * stress tensor for all of the local material points of a level in a single
+     * call.  Batched functions avoid the per-point call overhead and can be
+     * vectorized over the points of the batch.
+     *
+     * \note If a batched function is registered, it is used in place of the
+     * function registered with registerPK1StressTensorFunction().
+     */
+    void registerPK1StressTensorBatchFunction(PK1StressBatchFcnPtr PK1_stress_batch_fcn,
+                                              void* PK1_stress_batch_fcn_ctx = nullptr);
+
     /*!
      * Supply a Lagrangian initialization object.
      */
@@ -362,6 +404,14 @@ protected:
      */
     PK1StressFcnPtr d_PK1_stress_fcn;
     void* d_PK1_stress_fcn_ctx;
+    PK1StressBatchFcnPtr d_PK1_stress_batch_fcn = nullptr;
+    void* d_PK1_stress_batch_fcn_ctx = nullptr;
+
+    /*
+     * Material point data passed to the batched PK1 stress function.  The
+     * storage is reused between calls.
+     */
+    MaterialPointBatch d_mp_batch;
 
     /*
      * Lagrangian variables.
@@ -434,6 +484,17 @@ private:
      */
     void getFromInput(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db, bool is_from_restart);
 
+    /*!
+     * Compute the Kirchhoff stresses of the given local nodes using the
+     * batched PK1 stress function.
+     */
+    void computeBatchedStress(const std::vector<IBTK::LNode*>& local_nodes,
+                              const boost::multi_array_ref<double, 2>& x_array,
+                              const boost::multi_array_ref<double, 2>& X_array,
+                              const boost::multi_array_ref<double, 2>& F_array,
+                              boost::multi_array_ref<double, 2>& tau_array,
+                              double data_time);
+
     /*!
      * Read object state from the restart file and initialize class data
      * members.
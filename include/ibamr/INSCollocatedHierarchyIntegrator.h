@@ -253,6 +253,15 @@ private:
      */
     void computeDivSourceTerm(int F_idx, int Q_idx, int U_idx);
 
+    /*!
+     * Correct the intermediate cell- and face-centered velocities by the
+     * gradient of Phi, which must already be stored in the face-centered
+     * gradient patch data, and, if update_pressure is true, set P(n+1/2) to the
+     * sum of the scratch pressure and Phi, in a single pass over the patch
+     * hierarchy.
+     */
+    void applyProjectionCorrection(double div_fac, bool update_pressure);
+
     /*!
      * Reinitialize the operators and solvers used by the hierarchy integrator.
      */
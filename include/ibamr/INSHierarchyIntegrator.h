@@ -34,6 +34,7 @@
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -338,6 +339,20 @@ public:
      */
     int getNumberOfCycles() const override;
 
+    /*!
+     * Prepare to advance the data from current_time to new_time.
+     *
+     * This method invalidates the stored stable time step size.
+     */
+    void preprocessIntegrateHierarchy(double current_time, double new_time, int num_cycles = 1) override;
+
+    /*!
+     * Regrid the patch hierarchy.
+     *
+     * This method invalidates the stored stable time step size.
+     */
+    void regridHierarchy() override;
+
 protected:
     /*!
      * The constructor for class INSHierarchyIntegrator sets some default
@@ -391,6 +406,10 @@ protected:
 
     /*!
      * Return the maximum stable time step size.
+     *
+     * The stable time step size is computed at most once per time step: it is
+     * recomputed only if the velocity data may have changed since it was last
+     * computed, i.e., after the start of a time step or a regridding operation.
      */
     double getMaximumTimeStepSizeSpecialized() override;
 
@@ -404,6 +423,15 @@ protected:
      */
     virtual double getStableTimestep(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch) const = 0;
 
+    /*!
+     * Determine the largest stable timestep on the entire patch hierarchy using
+     * the current velocity data.
+     *
+     * The local values on all patch levels are combined by a single global
+     * reduction, and the result is stored in d_stable_dt.
+     */
+    void updateStableTimestep();
+
     /*!
      * Write out specialized object state to the given database.
      */
@@ -449,6 +477,13 @@ protected:
      */
     double d_cfl_max = 1.0;
 
+    /*!
+     * The most recently computed stable time step size and whether it has
+     * been computed from the current velocity data.
+     */
+    double d_stable_dt = std::numeric_limits<double>::max();
+    bool d_stable_dt_is_current = false;
+
     /*!
      * Cell tagging criteria based on the relative and absolute magnitudes of
      * the local vorticity.
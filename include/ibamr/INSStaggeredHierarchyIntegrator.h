@@ -73,6 +73,21 @@ namespace IBAMR
 /*!
  * \brief Class INSStaggeredHierarchyIntegrator provides a staggered-grid solver
  * for the incompressible Navier-Stokes equations on an AMR grid hierarchy.
+ *
+ * By default, the velocity and pressure from the previous time step are used as
+ * the initial guess for the Stokes solver.  If the input database sets
+ * <code>extrapolate_initial_guess = TRUE</code>, the integrator instead keeps
+ * the velocity and pressure from one additional time step and uses a linear
+ * extrapolation in time as the initial guess.  This can substantially reduce
+ * the number of Krylov iterations required for flows that vary slowly in time.
+ *
+ * After each regrid, the solvers are reinitialized. If the input database sets
+ * <code>use_partial_solver_reinitialization = TRUE</code> and the coarsest
+ * level of the hierarchy was not changed by the regrid, the FAC
+ * preconditioners of the Stokes and subdomain solvers only reset the levels
+ * that were changed and keep their coarse level solvers (e.g., the hypre or
+ * PETSc data structures of the coarsest level). A change of the time step size
+ * still triggers a full reinitialization.
  */
 class INSStaggeredHierarchyIntegrator : public INSHierarchyIntegrator
 {
@@ -392,6 +407,22 @@ private:
     SAMRAI::tbox::Pointer<StaggeredStokesSolver> d_stokes_solver;
     bool d_stokes_solver_needs_init;
 
+    /*!
+     * Whether to extrapolate the initial guess for the Stokes solver from the
+     * two most recent time steps.
+     */
+    bool d_extrapolate_initial_guess = false;
+
+    /*!
+     * Whether to only reset the levels of the FAC preconditioners of the
+     * solvers that were reset by regridding, and the range of such levels
+     * since the solvers were last initialized. The range is empty (-1) if no
+     * levels have been reset and starts at level 0 if the solvers must be fully
+     * reinitialized.
+     */
+    bool d_use_partial_solver_reinitialization = false;
+    int d_solver_coarsest_reset_ln = 0, d_solver_finest_reset_ln = 0;
+
     /*!
      * Fluid solver variables.
      */
@@ -402,6 +433,8 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_F_cc_var;
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_Q_var;
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > d_N_old_var;
+    SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > d_U_old_var;
+    SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_P_old_var;
 
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_Omega_var;
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_Div_U_var;
@@ -429,6 +462,10 @@ private:
     int d_Q_current_idx = IBTK::invalid_index, d_Q_new_idx = IBTK::invalid_index, d_Q_scratch_idx = IBTK::invalid_index;
     int d_N_old_current_idx = IBTK::invalid_index, d_N_old_new_idx = IBTK::invalid_index,
         d_N_old_scratch_idx = IBTK::invalid_index;
+    int d_U_old_current_idx = IBTK::invalid_index, d_U_old_new_idx = IBTK::invalid_index,
+        d_U_old_scratch_idx = IBTK::invalid_index;
+    int d_P_old_current_idx = IBTK::invalid_index, d_P_old_new_idx = IBTK::invalid_index,
+        d_P_old_scratch_idx = IBTK::invalid_index;
 
     /*
      * Patch data descriptor indices for all "plot" variables managed by the
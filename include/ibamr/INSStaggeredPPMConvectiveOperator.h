@@ -21,6 +21,7 @@
 #include "ibamr/ibamr_enums.h"
 
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/PatchScratchDataPool.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "IntVector.h"
@@ -186,6 +187,9 @@ private:
     // Scratch data.
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > d_U_var;
     int d_U_scratch_idx = IBTK::invalid_index;
+
+    // Pooled patch data used as temporary storage within loops over patches.
+    IBTK::PatchScratchDataPool d_scratch_data_pool;
 };
 } // namespace IBAMR
 
@@ -172,6 +172,13 @@ private:
      */
     double d_velocity_bc_scaling, d_traction_bc_scaling = 0.0;
 
+    /*!
+     * Whether to use the counter-based random number generator, whose values
+     * are independent of the parallel partitioning, and its seed.
+     */
+    bool d_use_counter_based_rng = false;
+    int d_counter_based_rng_seed = 0;
+
     /*!
      * VariableContext and Variable objects for storing the components of the
      * stochastic stresses.
@@ -59,6 +59,11 @@ namespace IBAMR
  * \note INSStaggeredWavePropConvectiveOperator currently only works
  * in ADVECTIVE form.
  *
+ * If the input database key ``use_vectorized_kernel'' is set to TRUE, the
+ * convective derivative is computed by the row-wise, vectorizable C++
+ * implementation in WavePropConvectiveFunctions instead of the Fortran
+ * implementation.  The default is FALSE.
+ *
  * \todo Implement a CONSERVATIVE form for the operator. This will
  * involve writing a new Riemann solver for the flux.
  *
@@ -196,6 +201,10 @@ private:
     // Reconstruction order 2*k-1.
     // Currently only available for k=3
     int d_k = 3;
+
+    // Whether to use the vectorized (C++) implementation of the differencing
+    // kernel instead of the Fortran implementation.
+    bool d_use_vectorized_kernel = false;
 };
 } // namespace IBAMR
 
@@ -22,6 +22,7 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/PatchScratchDataPool.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "CoarseFineBoundary.h"
@@ -297,6 +298,27 @@ private:
         const double& dt,
         const double* const dx);
 
+    /*!
+     * \brief Compute N = div[rho_half*u_half*u_adv] (if N_data is non-null) and the density update rho = a0*rho^0 +
+     * a1*rho^1 + a2*dt*(-div[u_adv*rho_half]) + a2*dt*S in a single tiled sweep over each side-centered data
+     * component, without storing the face-centered momentum.
+     */
+    void computeConvectiveDerivativeAndDensityUpdate(
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > N_data,
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > R_data,
+        double a0,
+        const SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > R0_data,
+        double a1,
+        const SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > R1_data,
+        double a2,
+        const std::array<SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceData<NDIM, double> >, NDIM> U_adv_data,
+        const std::array<SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceData<NDIM, double> >, NDIM> R_half_data,
+        const std::array<SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceData<NDIM, double> >, NDIM> U_half_data,
+        const SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > S_data,
+        const std::array<SAMRAI::hier::Box<NDIM>, NDIM>& side_boxes,
+        double dt,
+        const double* const dx);
+
     /*!
      * \brief Enforce divergence free condition at the coarse-fine interface to ensure conservation of mass.
      */
@@ -351,6 +373,14 @@ private:
     // Logging configuration.
     bool d_enable_logging = false;
 
+    // Whether to compute the convective derivative and the density update in
+    // a single fused sweep.
+    bool d_use_fused_kernel = false;
+
+    // Face-centered scratch data, which are reused by the Runge-Kutta stages
+    // of each call to integrate().
+    IBTK::PatchScratchDataPool d_face_scratch_data_pool;
+
     // The limiter type for interpolation onto faces.
     LimiterType d_velocity_convective_limiter = UPWIND;
     LimiterType d_density_convective_limiter = UPWIND;
@@ -105,6 +105,18 @@ namespace IBAMR
  * If the scale array does not contain values for all the levels in the hierarchy,
  * it is filled by the most finest scaling factor provided by the user (for the missing
  * finer levels).
+ *
+ * If the input database sets <code>extrapolate_initial_guess = TRUE</code>, the
+ * initial guess for the Stokes solver is obtained by linear extrapolation in
+ * time from the velocity and pressure at the two most recent time steps,
+ * instead of by copying the values from the previous time step.
+ *
+ * If the input database sets <code>reuse_unchanged_viscosity = TRUE</code>, the
+ * viscosity is interpolated onto nodes (2D) or edges (3D) only when the
+ * cell-centered viscosity differs from the values used by the most recent
+ * linear operators; otherwise the stored interpolated values are reused.  This
+ * assumes that the physical boundary conditions of the viscosity do not depend
+ * on time.
  */
 
 class INSVCStaggeredHierarchyIntegrator : public INSHierarchyIntegrator
@@ -503,6 +515,29 @@ protected:
                         const int U_sc_idx,
                         SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
 
+    /*!
+     * Set the new velocity and pressure to the initial guess for the Stokes
+     * solver.
+     */
+    void setupInitialGuess(double current_time, double new_time);
+
+    /*!
+     * Determine whether the viscosity in the patch data index \p mu_idx is
+     * identical to the viscosity stored for use in the linear operators and,
+     * if so, copy the stored viscosity and interpolated viscosity into the
+     * scratch data.  Returns false (and does nothing) if the viscosity must be
+     * recomputed, or if reusing the viscosity is not enabled.
+     *
+     * \note Only the interior values of \p mu_idx are compared.
+     */
+    bool reuseStoredViscosity(int mu_idx);
+
+    /*!
+     * Store the scratch viscosity and interpolated viscosity for later use in
+     * the linear operators.
+     */
+    void storeViscosity();
+
     /*!
      * Hierarchy operations objects.
      */
@@ -553,6 +588,19 @@ protected:
     SAMRAI::tbox::Pointer<StaggeredStokesSolver> d_stokes_solver;
     bool d_stokes_solver_needs_init;
 
+    /*!
+     * Whether to extrapolate the initial guess for the Stokes solver from the
+     * two most recent time steps.
+     */
+    bool d_extrapolate_initial_guess = false;
+
+    /*!
+     * Whether to reuse the stored interpolated viscosity when the viscosity is
+     * unchanged, and whether the stored viscosity is valid for the current
+     * hierarchy configuration.
+     */
+    bool d_reuse_unchanged_viscosity = false, d_stored_viscosity_is_valid = false;
+
     /*!
      * Fluid solver variables.
      */
@@ -560,6 +608,7 @@ protected:
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > d_U_old_var;
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_U_cc_var;
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_P_var;
+    SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_P_old_var;
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > d_F_var;
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_F_cc_var;
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_Q_var;
@@ -642,6 +691,8 @@ protected:
     int d_U_current_idx, d_U_new_idx, d_U_scratch_idx;
     int d_U_old_current_idx, d_U_old_new_idx, d_U_old_scratch_idx;
     int d_P_current_idx, d_P_new_idx, d_P_scratch_idx;
+    int d_P_old_current_idx = IBTK::invalid_index, d_P_old_new_idx = IBTK::invalid_index,
+        d_P_old_scratch_idx = IBTK::invalid_index;
     int d_F_current_idx, d_F_new_idx, d_F_scratch_idx;
     int d_Q_current_idx, d_Q_new_idx, d_Q_scratch_idx;
     int d_N_old_current_idx, d_N_old_new_idx, d_N_old_scratch_idx;
@@ -273,6 +273,13 @@ private:
      */
     SAMRAI::solv::RobinBcCoefStrategy<NDIM>* d_rho_bc_coef = nullptr;
 
+    /*
+     * Ghost cell filling operator that fills both the density and the
+     * viscosity with a single set of communication schedules.  This operator
+     * is used only if both quantities are variable.
+     */
+    SAMRAI::tbox::Pointer<IBTK::HierarchyGhostCellInterpolation> d_rho_mu_bdry_bc_fill_op;
+
     /*
      * Variable to keep track of a transported density variable maintained by an advection-diffusion integrator
      */
@@ -24,6 +24,7 @@
 #include "RobinBcCoefStrategy.h"
 #include "tbox/Pointer.h"
 
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -169,6 +170,24 @@ private:
      */
     double getVelocity(double x, double z_plus_d, double time) const;
 
+    /*!
+     * Get the cosines of the phases of the component waves at the specified
+     * horizontal position and time.
+     */
+    const std::vector<double>& getCosPhaseTable(double x, double time) const;
+
+    /*!
+     * Get the sines of the phases of the component waves at the specified
+     * horizontal position and time.
+     */
+    const std::vector<double>& getSinPhaseTable(double x, double time) const;
+
+    /*!
+     * Set the horizontal position and time of the phase tables, invalidating
+     * the tables if either has changed.
+     */
+    void setPhaseTablePosition(double x, double time) const;
+
     /*!
      * Book-keeping.
      */
@@ -211,6 +230,29 @@ private:
     std::string d_wave_spectrum;
     std::vector<double> d_omega, d_wave_number, d_amplitude, d_phase;
 
+    /*!
+     * Velocity factors \f$ a_i \omega_i / \sinh(k_i d) \f$ of the component
+     * waves.
+     */
+    std::vector<double> d_velocity_factor;
+
+    /*!
+     * Tables of the phases of the component waves, which are evaluated for the
+     * most recently requested horizontal position and time, so that the
+     * faces along the wave inlet only require the depth-dependent factors to
+     * be evaluated.
+     *
+     * \param d_table_x         : Horizontal position of the tables
+     * \param d_table_time      : Time of the tables
+     * \param d_time_phase      : Time-dependent parts \f$ \phi_i - \omega_i t \f$ of the phases
+     * \param d_cos_phase       : Cosines of the phases
+     * \param d_sin_phase       : Sines of the phases
+     */
+    mutable double d_table_x = std::numeric_limits<double>::quiet_NaN(),
+                   d_table_time = std::numeric_limits<double>::quiet_NaN();
+    mutable std::vector<double> d_time_phase, d_cos_phase, d_sin_phase;
+    mutable bool d_cos_phase_valid = false, d_sin_phase_valid = false;
+
     /*!
      * Number of interface cells.
      */
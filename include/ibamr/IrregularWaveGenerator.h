@@ -39,6 +39,12 @@ namespace IBAMR
 {
 /*!
  * \brief Class for generating Irregular waves.
+ *
+ * The phases of the component waves are tabulated for the most recently
+ * requested position and time, so that repeated evaluations at the same
+ * horizontal position and time (e.g., of the surface elevation and the
+ * velocity at the faces along a vertical boundary) only require the
+ * depth-dependent factors to be evaluated.
  */
 class IrregularWaveGenerator : public StokesWaveGeneratorStrategy
 {
@@ -66,6 +72,24 @@ private:
      */
     void getFromInput(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
+    /*!
+     * Get the cosines of the phases of the component waves at the specified
+     * horizontal position and time.
+     */
+    const std::vector<double>& getCosPhaseTable(double x, double time) const;
+
+    /*!
+     * Get the sines of the phases of the component waves at the specified
+     * horizontal position and time.
+     */
+    const std::vector<double>& getSinPhaseTable(double x, double time) const;
+
+    /*!
+     * Set the horizontal position and time of the phase tables, invalidating
+     * the tables if either has changed.
+     */
+    void setPhaseTablePosition(double x, double time) const;
+
     ///
     /// Number of component waves with random phases to be generated (default = 50).
     ///
@@ -115,6 +139,28 @@ private:
     /// Phase (random) of component waves [rad].
     ///
     std::vector<double> d_phase;
+
+    ///
+    /// Velocity factors \f$ a_i \omega_i / \sinh(k_i d) \f$ of component waves [length/time].
+    ///
+    std::vector<double> d_velocity_factor;
+
+    ///
+    /// Horizontal position and time at which the phase tables are evaluated.
+    ///
+    mutable double d_table_x = std::numeric_limits<double>::quiet_NaN(),
+                   d_table_time = std::numeric_limits<double>::quiet_NaN();
+
+    ///
+    /// Time-dependent parts \f$ \phi_i - \omega_i t \f$ of the phases of component waves [rad].
+    ///
+    mutable std::vector<double> d_time_phase;
+
+    ///
+    /// Cosines and sines of the phases of component waves, and whether they are valid.
+    ///
+    mutable std::vector<double> d_cos_phase, d_sin_phase;
+    mutable bool d_cos_phase_valid = false, d_sin_phase_valid = false;
 };
 
 } // namespace IBAMR
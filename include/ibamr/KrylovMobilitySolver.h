@@ -54,6 +54,15 @@ namespace IBAMR
  * operator, \f$ L \f$ is the Stokes operator, and \f$ S \f$ is the spreading
  * operator.
  *
+ * If the input database sets <code>mobility_operator_type = "RPY"</code>, \f$
+ * M \f$ is instead approximated by the Rotne-Prager-Yamakawa mobility matrix of
+ * the markers (with the periodic correction <code>f_periodic_correction</code>),
+ * which is applied without forming the matrix and without solving the Stokes
+ * system (see CIBStrategy::applyMobilityOperator()).  This is typically used
+ * when the solver serves as the mobility preconditioner of
+ * CIBSaddlePointSolver for collections of markers that are too large for the
+ * dense matrices of DirectMobilitySolver.
+ *
  */
 class KrylovMobilitySolver : public SAMRAI::tbox::DescribedClass
 {
@@ -280,6 +289,7 @@ private:
     std::string d_object_name, d_ksp_type = KSPGMRES, d_pc_type = "none";
     bool d_is_initialized = false;
     bool d_reinitializing_solver = false;
+    bool d_reuse_ksp = false;
     Vec d_petsc_x = nullptr, d_petsc_b = nullptr;
     std::string d_options_prefix;
     MPI_Comm d_petsc_comm;
@@ -330,6 +340,12 @@ private:
     double d_current_time = std::numeric_limits<double>::signaling_NaN(),
            d_new_time = std::numeric_limits<double>::signaling_NaN();
 
+    // The mobility operator: "STOKES" applies J L^-1 S using the fluid solver,
+    // and "RPY" applies the Rotne-Prager-Yamakawa mobility matrix of the
+    // markers without forming it, with the given periodic correction.
+    std::string d_mobility_operator_type = "STOKES";
+    double d_f_periodic_corr = 0.0;
+
     // Scaling parameters and force normalization of the problem.
     double d_scale_interp = 1.0, d_scale_spread = 1.0, d_reg_mob_factor = 0.0, d_normalize_spread_force;
 };
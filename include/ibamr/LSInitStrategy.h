@@ -37,6 +37,8 @@ class BasePatchLevel;
 template <int DIM>
 class PatchHierarchy;
 template <int DIM>
+class PatchLevel;
+template <int DIM>
 class Variable;
 template <int DIM>
 class BasePatchHierarchy;
@@ -106,6 +108,22 @@ public:
      */
     virtual void setReinitializeLSData(bool reinit_ls_data);
 
+    /*!
+     * \brief Determine which local patches of the given level may contain
+     * cells in which the magnitude of the level set is at most band_dist,
+     * based on the level set data at its most recent initialization.
+     *
+     * \return false if this information is not available for the level, e.g.,
+     * because the level has been regridded since; otherwise, patch_in_band is
+     * resized to the number of patches of the level and patch_in_band[p]
+     * indicates whether local patch p may contain such cells.
+     *
+     * The default implementation returns false.
+     */
+    virtual bool getNarrowBandPatches(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+                                      double band_dist,
+                                      std::vector<bool>& patch_in_band) const;
+
     /*!
      * Write out object state to the given database.
      *
@@ -114,6 +132,15 @@ public:
     void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db) override;
 
 protected:
+    /*!
+     * \brief Write a histogram of the number of iterations carried out on each
+     * local patch to the log file.
+     *
+     * \param num_patch_iterations The number of iterations carried out on each
+     * patch, indexed by level number and then by patch number.
+     */
+    void logPatchIterationHistogram(const std::vector<std::vector<int> >& num_patch_iterations) const;
+
     // Book-keeping.
     std::string d_object_name;
     bool d_registered_for_restart;
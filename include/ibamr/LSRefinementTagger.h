@@ -0,0 +1,189 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBAMR_LSRefinementTagger
+#define included_IBAMR_LSRefinementTagger
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibamr/LSInitStrategy.h"
+
+#include "ibtk/HierarchyIntegrator.h"
+
+#include "CellVariable.h"
+#include "tbox/Pointer.h"
+
+#include <string>
+#include <vector>
+
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class BasePatchHierarchy;
+template <int DIM>
+class PatchHierarchy;
+} // namespace hier
+namespace tbox
+{
+class Database;
+} // namespace tbox
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBAMR
+{
+/*!
+ * \brief Class LSRefinementTagger tags cells for refinement in which the value
+ * of a level set variable is within a given threshold of a given value, e.g.,
+ * the cells near the zero contour of a signed distance function.
+ *
+ * The cells of each patch are scanned one line at a time. Optionally, the
+ * bounding box of the tagged cells of each patch is tagged instead, which
+ * yields fewer and more regular boxes. If the LSInitStrategy object that
+ * maintains the level set is provided and can report which patches intersect
+ * its narrow band (see LSInitStrategy::getNarrowBandPatches()), patches that
+ * are outside of the band are skipped without looking at their data.
+ *
+ * The following input database keys are recognized:
+ * - \p tag_value (default 0.0): the value of the level set to refine around.
+ * - \p tag_abs_thresh (default 0.0): cells in which the level set is within
+ *   this distance of \p tag_value are tagged.
+ * - \p use_bounding_box_tagging (default false): tag the bounding box of the
+ *   tagged cells of each patch.
+ * - \p narrow_band_margin (default 1): the number of cells by which the
+ *   distance used to query the narrow band exceeds the tagging threshold, to
+ *   account for the motion of the interface since the level set was last
+ *   initialized.
+ *
+ * No cells are tagged at the initial time, at which the level set data are
+ * not yet available.
+ */
+class LSRefinementTagger
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    LSRefinementTagger(std::string object_name,
+                       SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db = nullptr);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~LSRefinementTagger() = default;
+
+    /*!
+     * \brief Set the level set variable and the integrator that maintains it.
+     * The data of the current context of the integrator are used for tagging.
+     */
+    void setLevelSetVariable(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > ls_var,
+                             SAMRAI::tbox::Pointer<IBTK::HierarchyIntegrator> integrator);
+
+    /*!
+     * \brief Set the object that maintains the level set, which is queried for
+     * the patches that intersect its narrow band.
+     */
+    void setLSInitStrategy(SAMRAI::tbox::Pointer<LSInitStrategy> ls_init_strategy);
+
+    /*!
+     * \brief Set the value of the level set to refine around.
+     */
+    void setTagValue(double tag_value);
+
+    /*!
+     * \brief Set the threshold of the distance to the tag value.
+     */
+    void setTagAbsThreshold(double tag_abs_thresh);
+
+    /*!
+     * \brief Set whether to tag the bounding box of the tagged cells of each
+     * patch.
+     */
+    void setUseBoundingBoxTagging(bool use_bounding_box_tagging);
+
+    /*!
+     * \brief Register this object with the given integrator to tag cells in
+     * applyGradientDetector().
+     */
+    void registerWithHierarchyIntegrator(SAMRAI::tbox::Pointer<IBTK::HierarchyIntegrator> integrator);
+
+    /*!
+     * \brief Tag cells on the given level of the patch hierarchy.
+     */
+    void tagCells(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy, int level_number, int tag_idx);
+
+    /*!
+     * \brief Callback function to be registered with
+     * IBTK::HierarchyIntegrator::registerApplyGradientDetectorCallback(), in
+     * which ctx is a pointer to an LSRefinementTagger object.
+     */
+    static void applyGradientDetectorCallback(SAMRAI::tbox::Pointer<SAMRAI::hier::BasePatchHierarchy<NDIM> > hierarchy,
+                                              int level_number,
+                                              double error_data_time,
+                                              int tag_index,
+                                              bool initial_time,
+                                              bool uses_richardson_extrapolation_too,
+                                              void* ctx);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    LSRefinementTagger() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    LSRefinementTagger(const LSRefinementTagger& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    LSRefinementTagger& operator=(const LSRefinementTagger& that) = delete;
+
+    std::string d_object_name;
+
+    // The level set variable and the objects that maintain it.
+    SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_ls_var;
+    SAMRAI::tbox::Pointer<IBTK::HierarchyIntegrator> d_integrator;
+    SAMRAI::tbox::Pointer<LSInitStrategy> d_ls_init_strategy;
+
+    // Tagging parameters.
+    double d_tag_value = 0.0;
+    double d_tag_abs_thresh = 0.0;
+    bool d_use_bounding_box_tagging = false;
+    int d_narrow_band_margin = 1;
+
+    // Scratch storage for the narrow band query.
+    std::vector<bool> d_patch_in_band;
+};
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBAMR_LSRefinementTagger
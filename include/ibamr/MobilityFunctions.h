@@ -95,6 +95,43 @@ public:
                                            const int num_nodes,
                                            const double periodic_correction,
                                            double* mm);
+
+    /*!
+     * \brief Compute the product of the Rotne-Pragner-Yamakawa mobility matrix
+     * and a vector of forces without forming the matrix.
+     *
+     * The product is identical to the product of the matrix constructed by
+     * constructRPYMobilityMatrix() and the vector of forces, but it requires
+     * storage proportional to the number of markers rather than to its square,
+     * so that it may be used to apply the mobility of large collections of
+     * markers (e.g., in a matrix-free Krylov solver).
+     *
+     * \param kernel_name IB kernel function.
+     * \note Supported IB kernels are "IB_3", "IB_4" and "IB_6".
+     *
+     * \param mu Fluid viscosity.
+     *
+     * \param dx Cartesian grid spacing.
+     *
+     * \param X Array of IB markers' location.
+     *
+     * \param num_nodes Number of Lagrangian markers.
+     *
+     * \param periodic_correction Input parameter for incorporating
+     * periodic domain correction. Set it to zero if not known.
+     *
+     * \param F Array of forces applied to the markers.
+     *
+     * \param U Array in which the resulting marker velocities are stored.
+     */
+    static void applyRPYMobilityOperator(const char* kernel_name,
+                                         const double mu,
+                                         const double dx,
+                                         const double* X,
+                                         const int num_nodes,
+                                         const double periodic_correction,
+                                         const double* F,
+                                         double* U);
 }; // MobilityFunctions
 
 } // namespace IBAMR
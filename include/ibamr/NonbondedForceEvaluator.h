@@ -75,7 +75,21 @@ public:
                         std::vector<int> cell_offset,
                         SAMRAI::tbox::Pointer<IBTK::LData> F_data);
 
+    // Invalidate the neighbor lists of the level, which are rebuilt the next
+    // time forces are computed on it.
+    void initializeLevelData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                             int level_number,
+                             double init_data_time,
+                             bool initial_time,
+                             IBTK::LDataManager* l_data_manager) override;
+
     // Implementation of computeLagrangianForce.
+    //
+    // Interacting pairs of nodes are found by searching the cells within
+    // interaction_radius + 2*regrid_alpha cells of each node.  The resulting
+    // (Verlet) neighbor list is reused until the level is regridded or until
+    // some node has moved more than regrid_alpha grid cells since the list was
+    // built.
     void computeLagrangianForce(SAMRAI::tbox::Pointer<IBTK::LData> F_data,
                                 SAMRAI::tbox::Pointer<IBTK::LData> X_data,
                                 SAMRAI::tbox::Pointer<IBTK::LData> U_data,
@@ -97,6 +111,20 @@ private:
     // Assignment operator, not implemented.
     NonbondedForceEvaluator& operator=(const NonbondedForceEvaluator& that) = delete;
 
+    // Build the neighbor list of the specified level.
+    void buildNeighborList(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                           int level_number,
+                           const double* position,
+                           int n_local_positions,
+                           IBTK::LDataManager* l_data_manager);
+
+    // Add the force between a pair of nodes to the (mapped) force array.
+    void evaluateForces(int mstr_petsc_idx,
+                        int search_petsc_idx,
+                        const double* position,
+                        const double* periodic_shift,
+                        double* force);
+
     // interaction radius:
     double d_interaction_radius;
 
@@ -112,6 +140,15 @@ private:
     // spring force function pointer, to evaluate the force between particles:
     // TODO: Add species, make this a map from species1 x species2 -> Force Function Pointer
     NonBddForceFcnPtr d_force_fcn_ptr;
+
+    // Neighbor lists for each level: the local PETSc indices of the interacting
+    // pairs of nodes, the periodic shifts that are applied to the second node
+    // of each pair, and the local node positions at the time the list was
+    // built.
+    std::vector<bool> d_neighbor_list_is_valid;
+    std::vector<std::vector<int> > d_neighbor_pairs;
+    std::vector<std::vector<double> > d_neighbor_periodic_shifts;
+    std::vector<std::vector<double> > d_neighbor_list_positions;
 };
 } // namespace IBAMR
 
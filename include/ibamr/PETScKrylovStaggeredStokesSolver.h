@@ -40,6 +40,11 @@ namespace IBAMR
  * \brief Class PETScKrylovStaggeredStokesSolver is an extension of class
  * PETScKrylovLinearSolver that provides an implementation of the
  * StaggeredStokesSolver interface.
+ *
+ * Because the Stokes preconditioners are applied on the right, the pipelined
+ * variant of FGMRES may be selected via <code>ksp_type = "pipefgmres"</code> to
+ * overlap the global reductions of the Krylov method with the application of
+ * the preconditioner; see PETScKrylovLinearSolver.
  */
 class PETScKrylovStaggeredStokesSolver : public IBTK::PETScKrylovLinearSolver,
                                          public KrylovLinearSolverStaggeredStokesSolverInterface
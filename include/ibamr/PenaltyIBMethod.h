@@ -163,6 +163,14 @@ protected:
      */
     IBTK::Vector d_gravitational_acceleration;
 
+    /*
+     * Time stepping scheme for the penalty mass: "EXPLICIT" (the scheme used to
+     * advance the structure), "SEMI_IMPLICIT" (the implicit midpoint rule), or
+     * "EXPONENTIAL" (the exact solution of the penalty spring-mass system).
+     * The latter two are stable for any penalty stiffness.
+     */
+    std::string d_mass_time_stepping_type = "EXPLICIT";
+
 private:
     /*!
      * \brief Default constructor.
@@ -191,6 +199,15 @@ private:
      */
     PenaltyIBMethod& operator=(const PenaltyIBMethod& that) = delete;
 
+    /*!
+     * Advance the penalty mass positions and velocities from current_time to
+     * new_time using the (unconditionally stable) scheme specified by
+     * d_mass_time_stepping_type, with the massless structure held fixed at its
+     * position at current_time or, if \a use_half_position is true, at the
+     * midpoint of the time interval.
+     */
+    void advancePenaltyMass(double current_time, double new_time, bool use_half_position);
+
     /*!
      * Read input values from a given database.
      */
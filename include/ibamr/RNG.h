@@ -14,11 +14,20 @@
 #ifndef included_IBAMR_RNG
 #define included_IBAMR_RNG
 
+#include <cstdint>
+
 namespace IBAMR
 {
 /*!
  * \brief Class RNG organizes functions that provide random-number generator
  * functionality.
+ *
+ * In addition to the (stateful) Mersenne Twister generator, this class
+ * provides a counter-based generator (Philox4x32-10) whose values are pure
+ * functions of a counter and a key.  Because the values do not depend on the
+ * order in which they are generated, that generator is thread-safe and, when
+ * the counter is formed from global indices, produces results that are
+ * independent of the parallel partitioning.
  */
 class RNG
 {
@@ -31,6 +40,15 @@ public:
 
     static void parallel_seed(int global_seed);
 
+    /*!
+     * \brief Generate n normally distributed random values using the
+     * counter-based Philox4x32-10 generator.
+     *
+     * Value m is determined by the counter (counter[0] + m, counter[1],
+     * counter[2], counter[3]) and the key (key[0], key[1]).
+     */
+    static void genrandn(double* result, int n, const std::uint32_t counter[4], const std::uint32_t key[2]);
+
 private:
     RNG() = delete;
     RNG(RNG&) = delete;
@@ -19,6 +19,8 @@
 #include "ibamr/LSInitStrategy.h"
 #include "ibamr/ibamr_enums.h"
 
+#include "BoxArray.h"
+
 #include "tbox/Pointer.h"
 #include "tbox/Serializable.h"
 
@@ -38,6 +40,10 @@ template <int DIM>
 class Box;
 template <int DIM>
 class Patch;
+template <int DIM>
+class PatchHierarchy;
+template <int DIM>
+class PatchLevel;
 } // namespace hier
 } // namespace SAMRAI
 
@@ -122,6 +128,29 @@ public:
      */
     void setApplyVolumeShift(bool apply_volume_shift);
 
+    /*!
+     * \brief Set the width (in cells) of the narrow band around the interface
+     * in which the level set is relaxed.
+     *
+     * Only the patches that contain (or are adjacent to) cells in which the
+     * magnitude of the level set is at most the band width times the grid
+     * spacing are relaxed; the level set is left unchanged elsewhere.  A
+     * nonpositive width indicates that the level set is relaxed everywhere.
+     */
+    void setNarrowBandWidth(int narrow_band_width);
+
+    /*!
+     * \brief Determine which local patches of the given level may contain
+     * cells in which the magnitude of the level set is at most band_dist.
+     *
+     * This information is available if a narrow band is used, band_dist does
+     * not exceed the width of the band, and the boxes of the level have not
+     * changed since the level set was last initialized.
+     */
+    bool getNarrowBandPatches(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+                              double band_dist,
+                              std::vector<bool>& patch_in_band) const override;
+
 protected:
     // Flag for applying the mass constraint
     bool d_apply_mass_constraint = false;
@@ -144,14 +173,38 @@ protected:
     // Relaxation weight parameter
     double d_alpha = 1.0;
 
+    // Width (in cells) of the narrow band around the interface
+    int d_narrow_band_width = 0;
+
+    // Tolerance used to determine whether a patch has converged (a negative
+    // value indicates that all patches are relaxed in every iteration)
+    double d_patch_abs_tol = -1.0;
+
 private:
     /*!
      * \brief Do one relaxation step over the hierarchy.
+     *
+     * If per-patch convergence checks are enabled, converged patches are
+     * skipped unless the values used as input to their most recent relaxation
+     * step, which are stored in dist_prev_idx, have changed.
      */
     void relax(SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops,
                int dist_idx,
                int dist_init_idx,
-               const int iter) const;
+               int dist_prev_idx,
+               const int iter);
+
+    /*!
+     * \brief Determine the patches that have converged from the change in the
+     * level set over the most recent iteration.
+     */
+    void updatePatchConvergence(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy, int diff_idx);
+
+    /*!
+     * \brief Determine the local patches that intersect the narrow band around
+     * the interface.
+     */
+    void findNarrowBandPatches(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy, int dist_init_idx);
 
     /*!
      * \brief Do one relaxation step over a patch.
@@ -245,6 +298,24 @@ private:
      * \return A reference to this object.
      */
     RelaxationLSMethod& operator=(const RelaxationLSMethod& that) = delete;
+
+    // The local patch numbers of the patches that intersect the narrow band
+    // on each level of the patch hierarchy.
+    std::vector<std::vector<int> > d_narrow_band_patch_nums;
+
+    // The boxes of each level of the patch hierarchy and their owners, the
+    // width of the narrow band in physical units, and whether each local patch
+    // intersects the narrow band, at the time at which the narrow band was
+    // determined.
+    std::vector<SAMRAI::hier::BoxArray<NDIM> > d_narrow_band_level_boxes;
+    std::vector<std::vector<int> > d_narrow_band_patch_owners;
+    std::vector<double> d_narrow_band_dist;
+    std::vector<std::vector<bool> > d_patch_in_narrow_band;
+
+    // The number of iterations carried out on each patch and whether each
+    // patch has converged, indexed by level number and then by patch number.
+    std::vector<std::vector<int> > d_num_patch_iterations;
+    std::vector<std::vector<bool> > d_patch_is_converged;
 };
 } // namespace IBAMR
 
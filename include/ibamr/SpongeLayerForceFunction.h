@@ -18,14 +18,19 @@
 
 #include "ibtk/CartGridFunction.h"
 
+#include "Box.h"
+#include "BoxArray.h"
 #include "CartesianGridGeometry.h"
+#include "Index.h"
 #include "IntVector.h"
 #include "PatchLevel.h"
 #include "tbox/Array.h"
 #include "tbox/Pointer.h"
 
 #include <array>
+#include <map>
 #include <string>
+#include <vector>
 
 namespace IBAMR
 {
@@ -39,6 +44,8 @@ template <int DIM>
 class Variable;
 template <int DIM>
 class Patch;
+template <int DIM>
+class PatchData;
 } // namespace hier
 namespace pdat
 {
@@ -98,6 +105,37 @@ public:
                         SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level =
                             SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> >(NULL)) override;
 
+    /*!
+     * \note This concrete IBTK::CartGridFunction is evaluated one patch at a
+     * time and can be accumulated.
+     */
+    bool supportsAddDataOnPatch() const override;
+
+    /*!
+     * Add the forcing to the data on the patch interior.
+     */
+    void addDataOnPatch(int data_idx,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > var,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                        double data_time,
+                        bool initial_time = false,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level =
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> >(NULL)) override;
+
+    /*!
+     * Set the data on the patch interiors on the specified level of the patch
+     * hierarchy.
+     *
+     * The parts of the local patches that intersect the boundary layers are
+     * cached and are redetermined only when the boxes of the level change, so
+     * that patches away from the boundary layers are only zeroed.
+     */
+    void setDataOnPatchLevel(int data_idx,
+                             SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > var,
+                             SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+                             double data_time,
+                             bool initial_time = false) override;
+
     //\}
 
 private:
@@ -129,27 +167,66 @@ private:
     SpongeLayerForceFunction& operator=(const SpongeLayerForceFunction& that) = delete;
 
     /*!
-     * Set the data on the patch interior.
+     * Determine the intersection of the patch with the boundary layer at each
+     * location index. The box is empty for locations at which no forcing is
+     * applied or that the patch does not intersect.
+     */
+    std::array<SAMRAI::hier::Box<NDIM>, 2 * NDIM>
+    getLayerBoxes(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch) const;
+
+    /*!
+     * Determine whether the forcing of component d at index i is set by a
+     * boundary layer with a location index greater than location_index. At
+     * indices at which boundary layers overlap, only the forcing of the layer
+     * with the greatest location index is applied.
+     */
+    bool inLaterLayer(const std::array<SAMRAI::hier::Box<NDIM>, 2 * NDIM>& layer_boxes,
+                      unsigned int location_index,
+                      unsigned int d,
+                      const SAMRAI::hier::Index<NDIM>& i) const;
+
+    /*!
+     * Add the forcing on the given layer boxes of the patch interior to the
+     * data.
      */
-    void setDataOnPatchCell(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > F_data,
+    void addDataOnPatchLayers(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> > f_data,
+                              SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                              const std::array<SAMRAI::hier::Box<NDIM>, 2 * NDIM>& layer_boxes);
+
+    /*!
+     * Add the forcing on the given layer boxes of the patch interior to cell
+     * centered data.
+     */
+    void addDataOnPatchCell(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > F_data,
                             SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > U_current_data,
                             SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > U_new_data,
                             double kappa,
-                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch);
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const std::array<SAMRAI::hier::Box<NDIM>, 2 * NDIM>& layer_boxes);
 
     /*!
-     * Set the data on the patch interior.
+     * Add the forcing on the given layer boxes of the patch interior to side
+     * centered data.
      */
-    void setDataOnPatchSide(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > F_data,
+    void addDataOnPatchSide(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > F_data,
                             SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > U_current_data,
                             SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > U_new_data,
                             double kappa,
-                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch);
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const std::array<SAMRAI::hier::Box<NDIM>, 2 * NDIM>& layer_boxes);
 
     std::array<SAMRAI::tbox::Array<bool>, 2 * NDIM> d_forcing_enabled;
     std::array<double, 2 * NDIM> d_width;
     const INSHierarchyIntegrator* const d_fluid_solver;
     SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > d_grid_geometry;
+
+    // The boxes of each level of the patch hierarchy and their owners at the
+    // time at which the layer boxes were determined, and the layer boxes of the
+    // local patches that intersect at least one boundary layer, indexed by
+    // patch number.
+    std::vector<SAMRAI::hier::BoxArray<NDIM> > d_level_boxes;
+    std::vector<std::vector<int> > d_level_patch_owners;
+    std::vector<std::map<int, std::array<SAMRAI::hier::Box<NDIM>, 2 * NDIM> > > d_layer_boxes;
 };
 } // namespace IBAMR
 
@@ -117,6 +117,17 @@ public:
     virtual void setPhysicalBcCoefs(const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& U_bc_coefs,
                                     SAMRAI::solv::RobinBcCoefStrategy<NDIM>* P_bc_coef) override;
 
+    /*!
+     * \brief Set whether the velocity and pressure subdomain solvers are
+     * applied inexactly, i.e., with exactly one iteration (one multigrid cycle
+     * when the subdomain solver is preconditioned by a multigrid method) per
+     * application of the preconditioner.
+     *
+     * \note By default, the subdomain solvers are applied with their own
+     * iteration limits and tolerances.
+     */
+    void setInexactSubdomainSolves(bool inexact_subdomain_solves);
+
     /*!
      * \brief Compute hierarchy dependent data required for solving \f$Ax=b\f$.
      *
@@ -157,12 +168,20 @@ protected:
     void correctNullspace(SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > U_vec,
                           SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > P_vec);
 
+    /*!
+     * \brief Configure a subdomain solver to solve a problem with homogeneous
+     * boundary conditions using the specified initial guess.  If inexact
+     * subdomain solves are requested, the solver is limited to one iteration.
+     */
+    void setupSubdomainSolver(IBTK::PoissonSolver& solver, bool initial_guess_nonzero);
+
     // Subdomain solvers.
     const bool d_needs_velocity_solver;
     SAMRAI::tbox::Pointer<IBTK::PoissonSolver> d_velocity_solver;
     SAMRAI::solv::PoissonSpecifications d_P_problem_coefs;
     const bool d_needs_pressure_solver;
     SAMRAI::tbox::Pointer<IBTK::PoissonSolver> d_pressure_solver;
+    bool d_inexact_subdomain_solves = false;
 
     // Hierarchy data.
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
@@ -16,14 +16,13 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibamr/StaggeredStokesFACPreconditioner.h"
 #include "ibamr/StaggeredStokesFACPreconditionerStrategy.h"
+#include "ibamr/StaggeredStokesSolver.h"
 
+#include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
-#include "petscksp.h"
-#include "petscmat.h"
-#include "petscvec.h"
-
 #include <array>
 #include <string>
 #include <vector>
@@ -54,6 +53,24 @@ namespace IBAMR
  * \brief Class StaggeredStokesBoxRelaxationFACOperator is a concrete
  * StaggeredStokesFACPreconditionerStrategy implementing a box relaxation
  * (Vanka-type) smoother for use as a multigrid preconditioner.
+ *
+ * The smoother is matrix-free: the coupled velocity-pressure system is relaxed
+ * cell by cell using the finite difference stencils of the constant-coefficient
+ * staggered grid Stokes operator, so that no matrices are assembled on any
+ * level of the multigrid hierarchy.  Velocity and pressure ghost cell values
+ * are filled together before each sweep.  If the coarse level solver is a
+ * PETSc level solver (e.g., <code>coarse_solver_type =
+ * "PETSC_LEVEL_SOLVER"</code>), a matrix is assembled only on the coarsest
+ * level.
+ *
+ * Each box update is damped by a relaxation weight \f$ \omega \f$, i.e., the
+ * error in the box is replaced by \f$ (1 - \omega) e + \omega \hat{e} \f$, in
+ * which \f$ \hat{e} \f$ solves the box system.  In addition to the parameters
+ * of StaggeredStokesFACPreconditionerStrategy, the operator reads (with its
+ * default value): \verbatim
+
+ relaxation_weight = 0.65    // omega, in (0, 1]
+ \endverbatim
  */
 class StaggeredStokesBoxRelaxationFACOperator : public StaggeredStokesFACPreconditionerStrategy
 {
@@ -70,6 +87,21 @@ public:
      */
     ~StaggeredStokesBoxRelaxationFACOperator();
 
+    /*!
+     * \brief Static function to construct a StaggeredStokesFACPreconditioner with a
+     * StaggeredStokesBoxRelaxationFACOperator FAC strategy.
+     */
+    static SAMRAI::tbox::Pointer<StaggeredStokesSolver>
+    allocate_solver(const std::string& object_name,
+                    SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                    const std::string& default_options_prefix)
+    {
+        SAMRAI::tbox::Pointer<StaggeredStokesFACPreconditionerStrategy> fac_operator =
+            new StaggeredStokesBoxRelaxationFACOperator(
+                object_name + "::StaggeredStokesBoxRelaxationFACOperator", input_db, default_options_prefix);
+        return new StaggeredStokesFACPreconditioner(object_name, fac_operator, input_db, default_options_prefix);
+    } // allocate_solver
+
     /*!
      * \name Implementation of FACPreconditionerStrategy interface.
      */
@@ -141,11 +173,16 @@ private:
     StaggeredStokesBoxRelaxationFACOperator& operator=(const StaggeredStokesBoxRelaxationFACOperator& that) = delete;
 
     /*
-     * Box operator data.
+     * Box operator data.  Since the single-cell box operator is the same for
+     * all cells on a level, we store the dense inverse of the operator (in
+     * row-major order) for each level.
+     */
+    std::vector<std::vector<double> > d_box_inv;
+
+    /*
+     * The relaxation weight of the box updates.
      */
-    std::vector<Mat> d_box_op;
-    std::vector<Vec> d_box_e, d_box_r;
-    std::vector<KSP> d_box_ksp;
+    double d_relaxation_weight = 0.65;
 
     /*
      * Mappings from patch indices to patch operators.
@@ -18,13 +18,17 @@
 
 #include "ibtk/CartGridFunction.h"
 
+#include "Box.h"
+#include "BoxArray.h"
 #include "CartesianGridGeometry.h"
 #include "IntVector.h"
 #include "PatchLevel.h"
 #include "tbox/Pointer.h"
 
 #include <array>
+#include <map>
 #include <string>
+#include <vector>
 
 namespace IBAMR
 {
@@ -39,6 +43,11 @@ class Patch;
 template <int DIM>
 class Variable;
 } // namespace hier
+namespace pdat
+{
+template <int DIM, class TYPE>
+class SideData;
+} // namespace pdat
 namespace tbox
 {
 class Database;
@@ -91,6 +100,37 @@ public:
                         SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level =
                             SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> >(NULL)) override;
 
+    /*!
+     * \note This concrete IBTK::CartGridFunction is evaluated one patch at a
+     * time and can be accumulated.
+     */
+    bool supportsAddDataOnPatch() const override;
+
+    /*!
+     * Add the forcing to the data on the patch interior.
+     */
+    void addDataOnPatch(int data_idx,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > var,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                        double data_time,
+                        bool initial_time = false,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level =
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> >(NULL)) override;
+
+    /*!
+     * Set the data on the patch interiors on the specified level of the patch
+     * hierarchy.
+     *
+     * The parts of the local patches that intersect the boundary layers are
+     * cached and are redetermined only when the boxes of the level change, so
+     * that patches away from the boundary layers are only zeroed.
+     */
+    void setDataOnPatchLevel(int data_idx,
+                             SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > var,
+                             SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+                             double data_time,
+                             bool initial_time = false) override;
+
     //\}
 
 private:
@@ -121,10 +161,34 @@ private:
      */
     StaggeredStokesOpenBoundaryStabilizer& operator=(const StaggeredStokesOpenBoundaryStabilizer& that) = delete;
 
+    /*!
+     * Determine the intersection of the patch with the boundary layer at each
+     * location index. The box is empty for locations at which no forcing is
+     * applied or that the patch does not intersect.
+     */
+    std::array<SAMRAI::hier::Box<NDIM>, 2 * NDIM>
+    getLayerBoxes(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch) const;
+
+    /*!
+     * Add the forcing on the given layer boxes of the patch interior to the
+     * data.
+     */
+    void addDataOnPatchLayers(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > F_data,
+                              SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                              const std::array<SAMRAI::hier::Box<NDIM>, 2 * NDIM>& layer_boxes);
+
     std::array<bool, 2 * NDIM> d_open_bdry, d_inflow_bdry, d_outflow_bdry;
     std::array<double, 2 * NDIM> d_width;
     const INSHierarchyIntegrator* const d_fluid_solver;
     SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > d_grid_geometry;
+
+    // The boxes of each level of the patch hierarchy and their owners at the
+    // time at which the layer boxes were determined, and the layer boxes of the
+    // local patches that intersect at least one boundary layer, indexed by
+    // patch number.
+    std::vector<SAMRAI::hier::BoxArray<NDIM> > d_level_boxes;
+    std::vector<std::vector<int> > d_level_patch_owners;
+    std::vector<std::map<int, std::array<SAMRAI::hier::Box<NDIM>, 2 * NDIM> > > d_layer_boxes;
 };
 } // namespace IBAMR
 
@@ -232,7 +232,7 @@ private:
      * \param d_omega        : Angular frequency [$2 \pi/s$] (optional)
      *
      * \NOTE The class calculates a more accurate value of omega from the expansion coefficients
-     * and the provided value in not used.
+     * and the provided value in not used; d_omega is overwritten by the calculated value.
      */
     double d_depth, d_omega, d_wave_number, d_amplitude, d_gravity;
 
@@ -195,22 +195,16 @@ private:
     SurfaceTensionForceFunction& operator=(const SurfaceTensionForceFunction& that) = delete;
 
     /*!
-     * Convert the level set variable to a smoothed heaviside function.
-     */
-    void convertToHeaviside(int phi_idx,
-                            int coarsest_ln,
-                            int finest_ln,
-                            SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > patch_hierarchy);
-
-    /*!
-     * Mollify data.
+     * Compute the mollified smoothed Heaviside function of the level set on
+     * the patch interior and on the ghost cells of C_data from the level set
+     * data phi_data, which must have enough ghost cells for the mollifier.
+     *
+     * \return false if the level set is uniformly far from the interface on
+     * the ghost box of phi_data, in which case C_data is not set.
      */
-    void mollifyData(int phi_idx,
-                     int coarsest_ln,
-                     int finest_ln,
-                     double data_time,
-                     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
-                     SAMRAI::tbox::Pointer<IBTK::HierarchyGhostCellInterpolation> fill_op);
+    bool computeIndicatorOnPatch(SAMRAI::pdat::CellData<NDIM, double>& C_data,
+                                 const SAMRAI::pdat::CellData<NDIM, double>& phi_data,
+                                 SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch);
 
     /*!
      * Set the data on the patch interior.
@@ -243,7 +237,7 @@ private:
     const AdvDiffHierarchyIntegrator* const d_adv_diff_solver;
     const SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > d_ls_var;
     TimeSteppingType d_ts_type;
-    int d_C_idx, d_phi_idx;
+    int d_phi_idx;
     std::string d_kernel_fcn;
     double d_sigma, d_num_interface_cells;
 };
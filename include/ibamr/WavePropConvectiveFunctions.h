@@ -0,0 +1,267 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////// INCLUDE GUARD ////////////////////////////////////
+
+#ifndef included_IBAMR_WavePropConvectiveFunctions
+#define included_IBAMR_WavePropConvectiveFunctions
+
+///////////////////////////// INCLUDES ///////////////////////////////////
+
+#include "ibtk/PatchTileIterator.h"
+
+#include "Box.h"
+#include "IntVector.h"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+namespace IBAMR
+{
+/*!
+ * A collection of functions implementing the WENO reconstruction and wave
+ * propagation differencing of the wave propagation convective operators.
+ *
+ * These functions compute the same quantities as the Fortran kernel
+ * adv_diff_wp_convective_op, but they process rows of cells at a time: the
+ * reconstructed states on all of the faces of a row are computed in a single
+ * unit-stride, branch-free loop (the upwind selections are expressed via
+ * std::max() and std::min()), so that the loops can be vectorized by the
+ * compiler.  The functions are used by AdvDiffWavePropConvectiveOperator,
+ * INSCollocatedWavePropConvectiveOperator, and
+ * INSStaggeredWavePropConvectiveOperator when the input database key
+ * ``use_vectorized_kernel'' is set to TRUE.
+ */
+namespace WavePropConvectiveFunctions
+{
+/*!
+ * Compute the WENO5 interpolation of the values Q(-2), ..., Q(2) to the face
+ * between the cells associated with Q(0) and Q(1).
+ */
+inline double
+weno5_interp(const double Q_m2, const double Q_m1, const double Q_0, const double Q_p1, const double Q_p2)
+{
+    // Compute the candidate interpolations.
+    const double f0 = (11.0 * Q_0 - 7.0 * Q_m1 + 2.0 * Q_m2) / 6.0;
+    const double f1 = (2.0 * Q_p1 + 5.0 * Q_0 - Q_m1) / 6.0;
+    const double f2 = (-1.0 * Q_p2 + 5.0 * Q_p1 + 2.0 * Q_0) / 6.0;
+
+    // Compute the smoothness indicators.
+    const double a0 = Q_0 - 2.0 * Q_m1 + Q_m2, b0 = 3.0 * Q_0 - 4.0 * Q_m1 + Q_m2;
+    const double a1 = Q_p1 - 2.0 * Q_0 + Q_m1, b1 = Q_p1 - Q_m1;
+    const double a2 = Q_p2 - 2.0 * Q_p1 + Q_0, b2 = Q_p2 - 4.0 * Q_p1 + 3.0 * Q_0;
+    const double IS0 = (13.0 / 12.0) * (a0 * a0) + 0.25 * (b0 * b0);
+    const double IS1 = (13.0 / 12.0) * (a1 * a1) + 0.25 * (b1 * b1);
+    const double IS2 = (13.0 / 12.0) * (a2 * a2) + 0.25 * (b2 * b2);
+
+    // Compute the weights.
+    static const double omega_bar_0 = 0.1, omega_bar_1 = 0.6, omega_bar_2 = 0.3;
+    const double alpha0 = omega_bar_0 / (IS0 + 1.0e-40);
+    const double alpha1 = omega_bar_1 / (IS1 + 1.0e-40);
+    const double alpha2 = omega_bar_2 / (IS2 + 1.0e-40);
+    const double alpha_sum = alpha0 + alpha1 + alpha2;
+    double omega0 = alpha0 / alpha_sum, omega1 = alpha1 / alpha_sum, omega2 = alpha2 / alpha_sum;
+
+    // Improve the accuracy of the weights (following the approach of Henrick,
+    // Aslam, and Powers).
+    auto map_weight = [](const double omega, const double omega_bar) {
+        return omega * (omega_bar + omega_bar * omega_bar - 3.0 * omega_bar * omega + omega * omega) /
+               (omega_bar * omega_bar + omega * (1.0 - 2.0 * omega_bar));
+    };
+    omega0 = map_weight(omega0, omega_bar_0);
+    omega1 = map_weight(omega1, omega_bar_1);
+    omega2 = map_weight(omega2, omega_bar_2);
+    const double omega_sum = omega0 + omega1 + omega2;
+
+    // Compute the interpolant.
+    return omega0 / omega_sum * f0 + omega1 / omega_sum * f1 + omega2 / omega_sum * f2;
+} // weno5_interp
+
+/*!
+ * Compute R = u.grad(Q), in which Q and R are cell centered with the specified
+ * depth and u is face centered, on the specified box.
+ *
+ * All of the arrays are stored in the SAMRAI layout (i.e., in column-major
+ * order on the box grown by the specified uniform ghost cell width, with the
+ * face centered data for each axis stored with the indices permuted so that
+ * the face normal index varies most rapidly).  Q must provide at least three
+ * layers of ghost cells.
+ *
+ * The box is processed tile by tile (see IBTK::PatchTileIterator) so that the
+ * stencil of the transverse sweeps remains in cache.  The states on the faces
+ * between two tiles are reconstructed for both tiles; the result does not
+ * depend on the tile size.
+ */
+inline void
+computeWavePropConvectiveDerivative(const double* const Q_data,
+                                    const int Q_gcw,
+                                    const std::array<const double*, NDIM>& U_data,
+                                    const int U_gcw,
+                                    double* const R_data,
+                                    const int R_gcw,
+                                    const int depth,
+                                    const SAMRAI::hier::Box<NDIM>& box,
+                                    const double* const dx,
+                                    const SAMRAI::hier::IntVector<NDIM>& tile_size =
+                                        IBTK::PatchTileIterator::getDefaultTileSize())
+{
+    std::array<int, NDIM> n, Q_stride, R_stride;
+    std::array<std::array<int, NDIM>, NDIM> U_stride;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        n[d] = box.numberCells(d);
+        Q_stride[d] = (d == 0 ? 1 : Q_stride[d - 1] * (n[d - 1] + 2 * Q_gcw));
+        R_stride[d] = (d == 0 ? 1 : R_stride[d - 1] * (n[d - 1] + 2 * R_gcw));
+    }
+    const int Q_depth_stride = Q_stride[NDIM - 1] * (n[NDIM - 1] + 2 * Q_gcw);
+    const int R_depth_stride = R_stride[NDIM - 1] * (n[NDIM - 1] + 2 * R_gcw);
+
+    // The face centered data for axis a are indexed by (i_a, i_{a+1}, ...), in
+    // which the face normal index i_a ranges over n_a + 1 faces.
+    int U_offset[NDIM];
+    for (unsigned int a = 0; a < NDIM; ++a)
+    {
+        int stride = 1;
+        U_offset[a] = 0;
+        for (unsigned int k = 0; k < NDIM; ++k)
+        {
+            const unsigned int e = (a + k) % NDIM;
+            U_stride[a][e] = stride;
+            U_offset[a] += U_gcw * stride;
+            stride *= n[e] + (k == 0 ? 1 : 0) + 2 * U_gcw;
+        }
+    }
+
+    // The transverse direction of the rows that are swept for each direction
+    // other than the first one.
+#if (NDIM == 2)
+    const std::array<int, NDIM> t_axis = { { 1, 0 } };
+#endif
+#if (NDIM == 3)
+    const std::array<int, NDIM> t_axis = { { 1, 2, 1 } };
+#endif
+
+    int Q_offset = 0, R_offset = 0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        Q_offset += Q_gcw * Q_stride[d];
+        R_offset += R_gcw * R_stride[d];
+    }
+
+    const int max_n0 = std::min(n[0], tile_size(0));
+    std::vector<double> S0(max_n0 + 1), S1(max_n0 + 1), S0_prev(max_n0), S1_prev(max_n0);
+    for (IBTK::PatchTileIterator tile(box, tile_size); tile; tile++)
+    {
+        // The tile [lo, hi) in indices relative to the lower corner of the box.
+        std::array<int, NDIM> lo, hi;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            lo[d] = tile().lower(d) - box.lower(d);
+            hi[d] = tile().upper(d) - box.lower(d) + 1;
+        }
+        const int n0 = hi[0] - lo[0];
+
+        for (int j = 0; j < depth; ++j)
+        {
+            const double* const Q = Q_data + j * Q_depth_stride + Q_offset + lo[0];
+            double* const R = R_data + j * R_depth_stride + R_offset + lo[0];
+
+            // Sweep the rows of cells in the first direction.  The
+            // reconstructed states on the faces of each row are computed
+            // before they are differenced.
+            {
+                const double inv_dx = 1.0 / dx[0];
+                const double* const U = U_data[0] + U_offset[0] + lo[0];
+#if (NDIM == 3)
+                for (int i2 = lo[2]; i2 < hi[2]; ++i2)
+#endif
+                {
+                    for (int i1 = lo[1]; i1 < hi[1]; ++i1)
+                    {
+                        int Q_row_offset = i1 * Q_stride[1], R_row_offset = i1 * R_stride[1],
+                            U_row_offset = i1 * U_stride[0][1];
+#if (NDIM == 3)
+                        Q_row_offset += i2 * Q_stride[2];
+                        R_row_offset += i2 * R_stride[2];
+                        U_row_offset += i2 * U_stride[0][2];
+#endif
+                        const double* const Q_row = Q + Q_row_offset;
+                        double* const R_row = R + R_row_offset;
+                        const double* const U_row = U + U_row_offset;
+                        for (int f = 0; f <= n0; ++f)
+                        {
+                            S1[f] = weno5_interp(Q_row[f + 2], Q_row[f + 1], Q_row[f], Q_row[f - 1], Q_row[f - 2]);
+                            S0[f] = weno5_interp(Q_row[f - 3], Q_row[f - 2], Q_row[f - 1], Q_row[f], Q_row[f + 1]);
+                        }
+                        for (int i0 = 0; i0 < n0; ++i0)
+                        {
+                            R_row[i0] = inv_dx * (std::max(U_row[i0], 0.0) * (S1[i0] - S0[i0]) +
+                                                  std::min(U_row[i0 + 1], 0.0) * (S1[i0 + 1] - S0[i0 + 1]) +
+                                                  0.5 * (U_row[i0 + 1] + U_row[i0]) * (S0[i0 + 1] - S1[i0]));
+                        }
+                    }
+                }
+            }
+
+            // Sweep the remaining directions one row of faces at a time,
+            // keeping the reconstructed states on the preceding row of faces so
+            // that each face of the tile is reconstructed only once.
+            for (unsigned int d = 1; d < NDIM; ++d)
+            {
+                const double inv_dx = 1.0 / dx[d];
+                const double* const U = U_data[d] + U_offset[d];
+                const int t = t_axis[d];
+                const int Q_t_stride = (NDIM == 2 ? 0 : Q_stride[t]), R_t_stride = (NDIM == 2 ? 0 : R_stride[t]),
+                          U_t_stride = (NDIM == 2 ? 0 : U_stride[d][t]);
+                const int it_lower = (NDIM == 2 ? 0 : lo[t]), it_upper = (NDIM == 2 ? 1 : hi[t]);
+                const int Qs = Q_stride[d];
+                const int Us = U_stride[d][0];
+                for (int it = it_lower; it < it_upper; ++it)
+                {
+                    for (int f = lo[d]; f <= hi[d]; ++f)
+                    {
+                        const double* const Q_row = Q + it * Q_t_stride + f * Qs;
+                        for (int i0 = 0; i0 < n0; ++i0)
+                        {
+                            const double* const q = Q_row + i0;
+                            S1[i0] = weno5_interp(q[2 * Qs], q[Qs], q[0], q[-Qs], q[-2 * Qs]);
+                            S0[i0] = weno5_interp(q[-3 * Qs], q[-2 * Qs], q[-Qs], q[0], q[Qs]);
+                        }
+                        if (f > lo[d])
+                        {
+                            double* const R_row = R + it * R_t_stride + (f - 1) * R_stride[d];
+                            const double* const U_lower = U + (lo[0] * Us) + it * U_t_stride + (f - 1) * U_stride[d][d];
+                            const double* const U_upper = U_lower + U_stride[d][d];
+                            for (int i0 = 0; i0 < n0; ++i0)
+                            {
+                                const double u_lower = U_lower[i0 * Us], u_upper = U_upper[i0 * Us];
+                                R_row[i0] += inv_dx * (std::max(u_lower, 0.0) * (S1_prev[i0] - S0_prev[i0]) +
+                                                       std::min(u_upper, 0.0) * (S1[i0] - S0[i0]) +
+                                                       0.5 * (u_upper + u_lower) * (S0[i0] - S1_prev[i0]));
+                            }
+                        }
+                        std::copy(S0.begin(), S0.begin() + n0, S0_prev.begin());
+                        std::copy(S1.begin(), S1.begin() + n0, S1_prev.begin());
+                    }
+                }
+            }
+        }
+    }
+    return;
+} // computeWavePropConvectiveDerivative
+} // namespace WavePropConvectiveFunctions
+} // namespace IBAMR
+
+#endif // #ifndef included_IBAMR_WavePropConvectiveFunctions
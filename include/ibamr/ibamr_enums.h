@@ -433,6 +433,7 @@ enum LibmeshPartitionerType
 {
     LIBMESH_DEFAULT,
     SAMRAI_BOX,
+    SPACE_FILLING_CURVE,
     UNKNOWN_LIBMESH_PARTITIONER_TYPE = -1
 };
 
@@ -442,6 +443,7 @@ string_to_enum<LibmeshPartitionerType>(const std::string& val)
 {
     if (strcasecmp(val.c_str(), "LIBMESH_DEFAULT") == 0) return LIBMESH_DEFAULT;
     if (strcasecmp(val.c_str(), "SAMRAI_BOX") == 0) return SAMRAI_BOX;
+    if (strcasecmp(val.c_str(), "SPACE_FILLING_CURVE") == 0) return SPACE_FILLING_CURVE;
     return UNKNOWN_LIBMESH_PARTITIONER_TYPE;
 } // string_to_enum
 
@@ -451,6 +453,7 @@ enum_to_string<LibmeshPartitionerType>(LibmeshPartitionerType val)
 {
     if (val == LIBMESH_DEFAULT) return "LIBMESH_DEFAULT";
     if (val == SAMRAI_BOX) return "SAMRAI_BOX";
+    if (val == SPACE_FILLING_CURVE) return "SPACE_FILLING_CURVE";
     return "UNKNOWN_LIBMESH_PARTITIONER_TYPE";
 } // enum_to_string
 
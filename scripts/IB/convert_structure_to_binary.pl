@@ -0,0 +1,99 @@
+#!/usr/bin/perl -w
+## ---------------------------------------------------------------------
+##
+## Copyright (c) 2026 - 2026 by the IBAMR developers
+## All rights reserved.
+##
+## This file is part of IBAMR.
+##
+## IBAMR is free software and is distributed under the 3-clause BSD
+## license. The full text of the license can be found in the file
+## COPYRIGHT at the top level directory of IBAMR.
+##
+## ---------------------------------------------------------------------
+
+#
+# filename: convert_structure_to_binary.pl
+# usage: convert_structure_to_binary.pl <spatial dimension> <input filename>
+#
+# A simple Perl script to convert an ASCII IBAMR vertex, spring, or beam
+# input file into the binary format read by IBStandardInitializer.  The
+# type of the file is determined from its extension (.vertex, .spring, or
+# .beam), and the output is written to <input filename>.bin.  The binary
+# files are only read if IBStandardInitializer's use_binary_structure_files
+# input option is TRUE.
+
+use strict;
+
+if ($#ARGV != 1) {
+    die "incorrect number of command line arguments.\nusage:\n  convert_structure_to_binary.pl <spatial dimension> <input filename>\n";
+}
+
+# parse the command line arguments
+my $ndim = shift @ARGV;  chomp $ndim;
+my $input_filename = shift @ARGV;  chomp $input_filename;
+my $output_filename = "$input_filename.bin";
+
+if ($ndim != 2 && $ndim != 3) {
+    die "error: spatial dimension must be 2 or 3\n";
+}
+
+my $type;
+if ($input_filename =~ /\.vertex$/) {
+    $type = "vertex";
+} elsif ($input_filename =~ /\.spring$/) {
+    $type = "spring";
+} elsif ($input_filename =~ /\.beam$/) {
+    $type = "beam";
+} else {
+    die "error: input file must end with .vertex, .spring, or .beam\n";
+}
+
+print "input file: $input_filename\n";
+print "output file: $output_filename\n";
+
+open(INPUT, "$input_filename") or die "error: cannot open $input_filename\n";
+open(OUTPUT, ">$output_filename") or die "error: cannot open $output_filename\n";
+binmode(OUTPUT);
+
+# return the whitespace-separated entries of the next line, discarding any
+# text following a '!', '#', or '%' character
+sub next_entries {
+    my $line = <INPUT>;
+    defined($line) or die "error: premature end to input file $input_filename\n";
+    $line =~ s/[!#%].*//;
+    $line =~ s/^\s+//;
+    return split(/\s+/, $line);
+}
+
+# the header: tag, format version, spatial dimension, and number of records
+my ($num_records) = next_entries();
+($num_records > 0) or die "error: invalid number of records in $input_filename\n";
+print OUTPUT pack("a8 l l l", "IBSTRUCT", 1, $ndim, $num_records);
+
+for (my $k = 0; $k < $num_records; ++$k) {
+    my @entries = next_entries();
+    if ($type eq "vertex") {
+        ($#entries + 1 >= $ndim) or die "error: invalid entry on line " . ($k + 2) . "\n";
+        print OUTPUT pack("d$ndim", @entries[0 .. $ndim - 1]);
+    } elsif ($type eq "spring") {
+        ($#entries + 1 >= 4) or die "error: invalid entry on line " . ($k + 2) . "\n";
+        my ($i, $j, $kappa, $length, @rest) = @entries;
+        my $fcn_idx = @rest ? shift @rest : 0;
+        my @params = ($kappa, $length, @rest);
+        print OUTPUT pack("l4", $i, $j, $fcn_idx, $#params + 1);
+        print OUTPUT pack("d*", @params);
+    } else {
+        ($#entries + 1 >= 4) or die "error: invalid entry on line " . ($k + 2) . "\n";
+        my ($prev, $curr, $next, $bend, @curv) = @entries;
+        @curv = (0.0) x $ndim unless @curv;
+        ($#curv + 1 >= $ndim) or die "error: incomplete beam curvature on line " . ($k + 2) . "\n";
+        print OUTPUT pack("l3", $prev, $curr, $next);
+        print OUTPUT pack("d*", $bend, @curv[0 .. $ndim - 1]);
+    }
+}
+
+close(INPUT);
+close(OUTPUT);
+
+print "wrote $num_records records\n";
@@ -27,6 +27,7 @@
 #include "Box.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
+#include "CellIndex.h"
 #include "CellVariable.h"
 #include "HierarchyCellDataOpsReal.h"
 #include "IntVector.h"
@@ -54,6 +55,7 @@
 #include <cmath>
 #include <string>
 #include <utility>
+#include <vector>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -296,10 +298,14 @@ BrinkmanPenalizationRigidBodyDynamics::computeBrinkmanVelocity(int u_idx, double
     ghost_fill_alg->registerRefine(ls_scratch_idx, ls_scratch_idx, ls_scratch_idx, refine_op);
     ghost_fill_alg->createSchedule(finest_level)->fillData(time);
 
+    // Only the patches that intersect the solid or the smeared zone around its
+    // interface are modified below.
+    findBrinkmanPatches(finest_level, ls_scratch_idx);
+
     // Set the rigid body velocity in u_idx
-    for (PatchLevel<NDIM>::Iterator p(finest_level); p; p++)
+    for (const int patch_num : d_brinkman_patch_nums)
     {
-        Pointer<Patch<NDIM> > patch = finest_level->getPatch(p());
+        Pointer<Patch<NDIM> > patch = finest_level->getPatch(patch_num);
         const Box<NDIM>& patch_box = patch->getBox();
         const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
         const double* patch_dx = patch_geom->getDx();
@@ -370,9 +376,10 @@ BrinkmanPenalizationRigidBodyDynamics::demarcateBrinkmanZone(int u_idx, double t
     Pointer<PatchHierarchy<NDIM> > patch_hierarchy = d_adv_diff_solver->getPatchHierarchy();
     int finest_ln = patch_hierarchy->getFinestLevelNumber();
     Pointer<PatchLevel<NDIM> > finest_level = patch_hierarchy->getPatchLevel(finest_ln);
-    for (PatchLevel<NDIM>::Iterator p(finest_level); p; p++)
+    if (finest_level.getPointer() != d_brinkman_level.getPointer()) findBrinkmanPatches(finest_level, ls_scratch_idx);
+    for (const int patch_num : d_brinkman_patch_nums)
     {
-        Pointer<Patch<NDIM> > patch = finest_level->getPatch(p());
+        Pointer<Patch<NDIM> > patch = finest_level->getPatch(patch_num);
         const Box<NDIM>& patch_box = patch->getBox();
         const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
         const double* patch_dx = patch_geom->getDx();
@@ -454,6 +461,34 @@ BrinkmanPenalizationRigidBodyDynamics::putToDatabase(Pointer<Database> db)
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+BrinkmanPenalizationRigidBodyDynamics::findBrinkmanPatches(Pointer<PatchLevel<NDIM> > level, const int ls_idx)
+{
+    d_brinkman_level = level;
+    d_brinkman_patch_nums.clear();
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+        const double* patch_dx = patch_geom->getDx();
+        const double alpha = 2.0 * patch_dx[0];
+
+        // The side-centered values of the level set are averages of the values
+        // in adjacent cells, so one layer of ghost cells is also checked.
+        Pointer<CellData<NDIM, double> > ls_solid_data = patch->getPatchData(ls_idx);
+        for (Box<NDIM>::Iterator it(Box<NDIM>::grow(patch->getBox(), 1)); it; it++)
+        {
+            const CellIndex<NDIM> ci(it());
+            if ((*ls_solid_data)(ci) <= alpha)
+            {
+                d_brinkman_patch_nums.push_back(p());
+                break;
+            }
+        }
+    }
+    return;
+} // findBrinkmanPatches
+
 void
 BrinkmanPenalizationRigidBodyDynamics::getFromInput(Pointer<Database> input_db, bool is_from_restart)
 {
@@ -88,6 +88,40 @@ class RefineSchedule;
 
 namespace IBAMR
 {
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Accumulate the net generalized force due to the nodal forces of a structure
+// whose local nodes and displacements from its center of mass are stored
+// contiguously.
+inline void
+accumulate_rigid_generalized_force(const boost::multi_array_ref<double, 2>& P_array,
+                                   const std::vector<int>& local_idxs,
+                                   const double* const R_dr,
+                                   double* const F)
+{
+    const auto num_nodes = static_cast<int>(local_idxs.size());
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        const double* const P = &P_array[local_idxs[k]][0];
+        const double* const r = R_dr + k * NDIM;
+        for (int d = 0; d < NDIM; ++d)
+        {
+            F[d] += P[d];
+        }
+#if (NDIM == 2)
+        F[2] += P[1] * r[0] - P[0] * r[1];
+#elif (NDIM == 3)
+        F[3] += P[2] * r[1] - P[1] * r[2];
+        F[4] += P[0] * r[2] - P[2] * r[0];
+        F[5] += P[1] * r[0] - P[0] * r[1];
+#endif
+    }
+    return;
+} // accumulate_rigid_generalized_force
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 CIBMethod::CIBMethod(std::string object_name,
@@ -1149,50 +1183,32 @@ CIBMethod::setRigidBodyVelocity(const unsigned int part, const RigidDOFVector& U
     }
     else
     {
+        updateRigidBodyDisplacements();
+
         // Wrap the PETSc V into LData
         std::vector<int> nonlocal_indices;
         LData V_data("V", V, nonlocal_indices, false);
         boost::multi_array_ref<double, 2>& V_data_array = *V_data.getLocalFormVecArray();
 
-        // Get the position info.
-        const boost::multi_array_ref<double, 2>& X0_array =
-            *(d_l_data_manager->getLData("X0_unshifted", struct_ln)->getLocalFormVecArray());
-        Eigen::Vector3d dr = Eigen::Vector3d::Zero();
-        Eigen::Vector3d R_dr = Eigen::Vector3d::Zero();
-
-        // Get mesh nodes.
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(struct_ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-        const std::pair<int, int>& part_idx_range = d_struct_lag_idx_range[part];
-        for (const auto& node_idx : local_nodes)
+        const std::vector<int>& local_idxs = d_rigid_body_local_idxs[part];
+        const double* const R_dr = d_rigid_body_disps[part].data();
+        const auto num_nodes = static_cast<int>(local_idxs.size());
+        for (int k = 0; k < num_nodes; ++k)
         {
-            const int lag_idx = node_idx->getLagrangianIndex();
-            if (part_idx_range.first <= lag_idx && lag_idx < part_idx_range.second)
-            {
-                const int local_idx = node_idx->getLocalPETScIndex();
-                double* const V_node = &V_data_array[local_idx][0];
-                const double* const X0 = &X0_array[local_idx][0];
-
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    dr[d] = X0[d] - d_center_of_mass_initial[part][d];
-                }
-                R_dr = rotation_mat * dr;
-
+            double* const V_node = &V_data_array[local_idxs[k]][0];
+            const double* const r = R_dr + k * NDIM;
 #if (NDIM == 2)
-                V_node[0] = U[0] - U[2] * R_dr[1];
-                V_node[1] = U[1] + U[2] * R_dr[0];
+            V_node[0] = U[0] - U[2] * r[1];
+            V_node[1] = U[1] + U[2] * r[0];
 #elif (NDIM == 3)
-                V_node[0] = U[0] + U[4] * R_dr[2] - U[5] * R_dr[1];
-                V_node[1] = U[1] + U[5] * R_dr[0] - U[3] * R_dr[2];
-                V_node[2] = U[2] + U[3] * R_dr[1] - U[4] * R_dr[0];
+            V_node[0] = U[0] + U[4] * r[2] - U[5] * r[1];
+            V_node[1] = U[1] + U[5] * r[0] - U[3] * r[2];
+            V_node[2] = U[2] + U[3] * r[1] - U[4] * r[0];
 #endif
-            }
         }
 
         // Restore underlying arrays.
         V_data.restoreArrays();
-        d_l_data_manager->getLData("X0_unshifted", struct_ln)->restoreArrays();
     }
 
     return;
@@ -1201,61 +1217,53 @@ CIBMethod::setRigidBodyVelocity(const unsigned int part, const RigidDOFVector& U
 void
 CIBMethod::computeNetRigidGeneralizedForce(const unsigned int part, Vec L, RigidDOFVector& F)
 {
-    const int struct_ln = getStructuresLevelNumber();
+    updateRigidBodyDisplacements();
 
     // Wrap the distributed PETSc Vec L into LData
     std::vector<int> nonlocal_indices;
     LData p_data("P", L, nonlocal_indices, false);
     const boost::multi_array_ref<double, 2>& p_data_array = *p_data.getLocalFormVecArray();
 
-    // Get position info.
-    const boost::multi_array_ref<double, 2>& X0_array =
-        *(d_l_data_manager->getLData("X0_unshifted", struct_ln)->getLocalFormVecArray());
-    Eigen::Matrix3d rotation_mat = d_quaternion_half[part].toRotationMatrix();
-    Eigen::Vector3d dr = Eigen::Vector3d::Zero();
-    Eigen::Vector3d R_dr = Eigen::Vector3d::Zero();
-
-    // Loop over LMesh.
     F.setZero();
-    const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(struct_ln);
-    const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-    for (const auto& node_idx : local_nodes)
-    {
-        const int lag_idx = node_idx->getLagrangianIndex();
-        const int local_idx = node_idx->getLocalPETScIndex();
-        const double* const P = &p_data_array[local_idx][0];
-        const unsigned struct_id = getStructureHandle(lag_idx);
-        if (struct_id != part) continue;
+    accumulate_rigid_generalized_force(
+        p_data_array, d_rigid_body_local_idxs[part], d_rigid_body_disps[part].data(), F.data());
+    SAMRAI_MPI::sumReduction(&F[0], s_max_free_dofs);
+    p_data.restoreArrays();
 
-        const double* const X0 = &X0_array[local_idx][0];
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            dr[d] = X0[d] - d_center_of_mass_initial[part][d];
-        }
-        R_dr = rotation_mat * dr;
+    return;
+} // computeNetRigidGeneralizedForce
 
-#if (NDIM == 2)
-        for (int d = 0; d < NDIM; ++d)
-        {
-            F[d] += P[d];
-        }
-        F[2] += P[1] * R_dr[0] - P[0] * R_dr[1];
-#elif (NDIM == 3)
-        for (int d = 0; d < NDIM; ++d)
-        {
-            F[d] += P[d];
-        }
-        F[3] += P[2] * R_dr[1] - P[1] * R_dr[2];
-        F[4] += P[0] * R_dr[2] - P[2] * R_dr[0];
-        F[5] += P[1] * R_dr[0] - P[0] * R_dr[1];
-#endif
+void
+CIBMethod::computeNetRigidGeneralizedForces(Vec L, EigenAlignedVector<RigidDOFVector>& F)
+{
+    updateRigidBodyDisplacements();
+
+    // Wrap the distributed PETSc Vec L into LData
+    std::vector<int> nonlocal_indices;
+    LData p_data("P", L, nonlocal_indices, false);
+    const boost::multi_array_ref<double, 2>& p_data_array = *p_data.getLocalFormVecArray();
+
+    // Accumulate the local contributions for all structures and sum them in a
+    // single reduction.
+    std::vector<double> F_data(d_num_rigid_parts * s_max_free_dofs, 0.0);
+    for (unsigned part = 0; part < d_num_rigid_parts; ++part)
+    {
+        accumulate_rigid_generalized_force(p_data_array,
+                                           d_rigid_body_local_idxs[part],
+                                           d_rigid_body_disps[part].data(),
+                                           F_data.data() + part * s_max_free_dofs);
     }
-    SAMRAI_MPI::sumReduction(&F[0], s_max_free_dofs);
+    SAMRAI_MPI::sumReduction(F_data.data(), static_cast<int>(F_data.size()));
     p_data.restoreArrays();
-    d_l_data_manager->getLData("X0_unshifted", struct_ln)->restoreArrays();
+
+    F.resize(d_num_rigid_parts);
+    for (unsigned part = 0; part < d_num_rigid_parts; ++part)
+    {
+        std::copy(F_data.data() + part * s_max_free_dofs, F_data.data() + (part + 1) * s_max_free_dofs, F[part].data());
+    }
 
     return;
-} // computeNetRigidGeneralizedForce
+} // computeNetRigidGeneralizedForces
 
 void
 CIBMethod::copyVecToArray(Vec b,
@@ -1513,6 +1521,57 @@ CIBMethod::constructMobilityMatrix(const std::string& /*mat_name*/,
     return;
 } // constructMobilityMatrix
 
+void
+CIBMethod::applyMobilityOperator(MobilityMatrixType mat_type,
+                                 Vec lambda,
+                                 Vec U,
+                                 const double* grid_dx,
+                                 double mu,
+                                 double f_periodic_corr,
+                                 const int managing_rank)
+{
+    if (mat_type != RPY)
+    {
+        TBOX_ERROR("CIBMethod::applyMobilityOperator(): only the RPY mobility operator "
+                   "can be applied without forming the mobility matrix."
+                   << std::endl);
+    }
+    const int struct_ln = getStructuresLevelNumber();
+    const char* ib_kernel = d_l_data_manager->getDefaultInterpKernelFunction().c_str();
+    const int rank = SAMRAI_MPI::getRank();
+
+    // Gather the positions and forces of all of the structures on the managing
+    // rank.
+    std::vector<unsigned> struct_ids(d_num_rigid_parts);
+    unsigned num_nodes = 0;
+    for (unsigned struct_no = 0; struct_no < d_num_rigid_parts; ++struct_no)
+    {
+        struct_ids[struct_no] = struct_no;
+        num_nodes += getNumberOfNodes(struct_no);
+    }
+    const int size = num_nodes * NDIM;
+    std::vector<double> X_array, F_array, U_array;
+    if (rank == managing_rank)
+    {
+        X_array.resize(size);
+        F_array.resize(size);
+        U_array.resize(size);
+    }
+    std::vector<Pointer<LData> >* X_half_data;
+    bool* X_half_needs_ghost_fill;
+    getPositionData(&X_half_data, &X_half_needs_ghost_fill, d_half_time);
+    copyVecToArray((*X_half_data)[struct_ln]->getVec(), X_array.data(), struct_ids, /*depth*/ NDIM, managing_rank);
+    copyVecToArray(lambda, F_array.data(), struct_ids, /*depth*/ NDIM, managing_rank);
+
+    if (rank == managing_rank)
+    {
+        MobilityFunctions::applyRPYMobilityOperator(
+            ib_kernel, mu, grid_dx[0], X_array.data(), num_nodes, f_periodic_corr, F_array.data(), U_array.data());
+    }
+    copyArrayToVec(U, U_array.data(), struct_ids, /*depth*/ NDIM, managing_rank);
+    return;
+} // applyMobilityOperator
+
 void
 CIBMethod::constructGeometricMatrix(const std::string& /*mat_name*/,
                                     Mat& geometric_mat,
@@ -2057,6 +2116,58 @@ CIBMethod::setInitialLambda(const int level_number)
     return;
 } // setInitialLambda
 
+void
+CIBMethod::updateRigidBodyDisplacements()
+{
+    const int struct_ln = getStructuresLevelNumber();
+    const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(struct_ln);
+    bool is_current = mesh == d_rigid_body_disp_mesh && d_rigid_body_disp_com.size() == d_num_rigid_parts &&
+                      d_rigid_body_disp_quaternion.size() == d_num_rigid_parts;
+    for (unsigned part = 0; is_current && part < d_num_rigid_parts; ++part)
+    {
+        is_current = d_rigid_body_disp_com[part] == d_center_of_mass_initial[part] &&
+                     d_rigid_body_disp_quaternion[part].coeffs() == d_quaternion_half[part].coeffs();
+    }
+    if (is_current) return;
+
+    d_rigid_body_disp_mesh = mesh;
+    d_rigid_body_disp_com = d_center_of_mass_initial;
+    d_rigid_body_disp_quaternion = d_quaternion_half;
+    d_rigid_body_local_idxs.assign(d_num_rigid_parts, std::vector<int>());
+    d_rigid_body_disps.assign(d_num_rigid_parts, std::vector<double>());
+
+    const boost::multi_array_ref<double, 2>& X0_array =
+        *(d_l_data_manager->getLData("X0_unshifted", struct_ln)->getLocalFormVecArray());
+    IBTK::EigenAlignedVector<Eigen::Matrix3d> rotation_mat(d_num_rigid_parts);
+    for (unsigned part = 0; part < d_num_rigid_parts; ++part)
+    {
+        rotation_mat[part] = d_quaternion_half[part].toRotationMatrix();
+    }
+    Eigen::Vector3d dr = Eigen::Vector3d::Zero();
+    Eigen::Vector3d R_dr = Eigen::Vector3d::Zero();
+    const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+    for (const auto& node_idx : local_nodes)
+    {
+        const int lag_idx = node_idx->getLagrangianIndex();
+        const int struct_id = getStructureHandle(lag_idx);
+        if (struct_id < 0) continue;
+
+        const int local_idx = node_idx->getLocalPETScIndex();
+        const double* const X0 = &X0_array[local_idx][0];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            dr[d] = X0[d] - d_center_of_mass_initial[struct_id][d];
+        }
+        R_dr = rotation_mat[struct_id] * dr;
+
+        d_rigid_body_local_idxs[struct_id].push_back(local_idx);
+        d_rigid_body_disps[struct_id].insert(d_rigid_body_disps[struct_id].end(), R_dr.data(), R_dr.data() + NDIM);
+    }
+    d_l_data_manager->getLData("X0_unshifted", struct_ln)->restoreArrays();
+
+    return;
+} // updateRigidBodyDisplacements
+
 } // namespace IBAMR
 
 //////////////////////////////////////////////////////////////////////////////
@@ -501,6 +501,19 @@ CIBSaddlePointSolver::initializeSolverState(Vec x, Vec b)
     d_A->initializeOperatorState(*vx0, *vb0);
     initializeStokesSolver(*vx0, *vb0);
 
+    // Allocate the work vectors of the preconditioner, which would otherwise be
+    // allocated and freed in every application of it.
+    d_pc_g_h = vx0->cloneVector("");
+    d_pc_g_h->allocateVectorData();
+    int free_comps = 0;
+    VecGetSize(vx[2], &free_comps);
+    VecDuplicate(vx[1], &d_pc_U);
+    if (free_comps)
+    {
+        VecDuplicate(vx[1], &d_pc_delU);
+        VecDuplicate(vx[2], &d_pc_F_tilde);
+    }
+
     // Restore the SAMRAI vectors.
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVectorRead(vx[0], &vx0);
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVectorRead(vb[0], &vb0);
@@ -567,6 +580,19 @@ CIBSaddlePointSolver::deallocateSolverState()
     d_transaction_comps.clear();
     d_fill_pattern.setNull();
 
+    // Deallocate the work vectors of the preconditioner.
+    d_pc_g_h->resetLevels(
+        d_pc_g_h->getCoarsestLevelNumber(),
+        std::min(d_pc_g_h->getFinestLevelNumber(), d_pc_g_h->getPatchHierarchy()->getFinestLevelNumber()));
+    d_pc_g_h->freeVectorComponents();
+    d_pc_g_h.setNull();
+    VecDestroy(&d_pc_U);
+    VecDestroy(&d_pc_delU);
+    VecDestroy(&d_pc_F_tilde);
+    d_pc_U = nullptr;
+    d_pc_delU = nullptr;
+    d_pc_F_tilde = nullptr;
+
     // Indicate that the solver is NOT initialized.
     d_is_initialized = false;
 
@@ -986,19 +1012,17 @@ CIBSaddlePointSolver::PCApply_SaddlePoint(PC pc, Vec x, Vec y)
     IBTK::PETScSAMRAIVectorReal::getSAMRAIVector(vy[0], &vy0);
 
     // Get the individual components.
-    Pointer<SAMRAIVectorReal<NDIM, double> > g_h = vx0->cloneVector("");
-    g_h->allocateVectorData();
+    Pointer<SAMRAIVectorReal<NDIM, double> > g_h = solver->d_pc_g_h;
     g_h->copyVector(vx0);
     Pointer<SAMRAIVectorReal<NDIM, double> > u_p = vy0;
 
-    Vec W, Lambda, F_tilde;
+    Vec W, Lambda;
     W = vx[1];
     Lambda = vy[1];
 
-    // Create temporary vectors for storage.
+    // Get the work vectors.
     // U is the interpolated velocity and delU is the slip velocity.
-    Vec U, delU;
-    VecDuplicate(W, &U);
+    Vec U = solver->d_pc_U, delU = solver->d_pc_delU, F_tilde = solver->d_pc_F_tilde;
 
     // 1) (u,p) = L^-1 (g,h)
     dynamic_cast<IBTK::LinearSolver*>(solver->d_LInv.getPointer())->setInitialGuessNonzero(false);
@@ -1037,9 +1061,6 @@ CIBSaddlePointSolver::PCApply_SaddlePoint(PC pc, Vec x, Vec y)
     // 3) Calculate the slip velocity
     if (free_comps)
     {
-        VecDuplicate(vx[2], &F_tilde);
-        VecDuplicate(W, &delU);
-
         // 3a) lambda = M^-1(U)
         solver->d_mob_solver->solveMobilitySystem(Lambda, U);
 
@@ -1088,18 +1109,6 @@ CIBSaddlePointSolver::PCApply_SaddlePoint(PC pc, Vec x, Vec y)
     dynamic_cast<IBTK::LinearSolver*>(solver->d_LInv.getPointer())->setHomogeneousBc(true);
     solver->d_LInv->solveSystem(*u_p, *g_h);
 
-    // Destroy temporary vectors
-    g_h->resetLevels(g_h->getCoarsestLevelNumber(),
-                     std::min(g_h->getFinestLevelNumber(), g_h->getPatchHierarchy()->getFinestLevelNumber()));
-    g_h->freeVectorComponents();
-    g_h.setNull();
-    VecDestroy(&U);
-    if (free_comps)
-    {
-        VecDestroy(&delU);
-        VecDestroy(&F_tilde);
-    }
-
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVectorRead(vx[0], &vx0);
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVector(vy[0], &vy0);
 
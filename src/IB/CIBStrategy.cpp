@@ -293,6 +293,18 @@ CIBStrategy::computeNetRigidGeneralizedForce(const unsigned int part, Vec L, Vec
     return;
 } // computeNetRigidGeneralizedForce
 
+void
+CIBStrategy::computeNetRigidGeneralizedForces(Vec L, EigenAlignedVector<RigidDOFVector>& F)
+{
+    F.resize(d_num_rigid_parts);
+    for (unsigned part = 0; part < d_num_rigid_parts; ++part)
+    {
+        computeNetRigidGeneralizedForce(part, L, F[part]);
+    }
+
+    return;
+} // computeNetRigidGeneralizedForces
+
 void
 CIBStrategy::computeNetRigidGeneralizedForce(Vec L,
                                              Vec F,
@@ -307,6 +319,10 @@ CIBStrategy::computeNetRigidGeneralizedForce(Vec L,
     PetscScalar* F_array = nullptr;
     VecGetArray(F, &F_array);
 
+    // Compute the forces and torques on all of the structures at once.
+    EigenAlignedVector<RigidDOFVector> F_parts;
+    computeNetRigidGeneralizedForces(L, F_parts);
+
     if (only_free_dofs)
     {
         int part_free_dofs_begin = 0;
@@ -316,8 +332,7 @@ CIBStrategy::computeNetRigidGeneralizedForce(Vec L,
             const FRDV& solve_dofs = getSolveRigidBodyVelocity(part, num_free_dofs);
             if (!num_free_dofs) continue;
 
-            RigidDOFVector F_part;
-            computeNetRigidGeneralizedForce(part, L, F_part);
+            const RigidDOFVector& F_part = F_parts[part];
 
             if (F_array != nullptr)
             {
@@ -343,8 +358,7 @@ CIBStrategy::computeNetRigidGeneralizedForce(Vec L,
             const FRDV& solve_dofs = getSolveRigidBodyVelocity(part, num_free_dofs);
             if (num_free_dofs == s_max_free_dofs) continue;
 
-            RigidDOFVector F_part;
-            computeNetRigidGeneralizedForce(part, L, F_part);
+            const RigidDOFVector& F_part = F_parts[part];
 
             if (F_array != nullptr)
             {
@@ -366,8 +380,7 @@ CIBStrategy::computeNetRigidGeneralizedForce(Vec L,
         int part_dofs_begin = 0;
         for (unsigned part = 0; part < d_num_rigid_parts; ++part)
         {
-            RigidDOFVector F_part;
-            computeNetRigidGeneralizedForce(part, L, F_part);
+            const RigidDOFVector& F_part = F_parts[part];
 
             if (F_array != nullptr)
             {
@@ -825,6 +838,19 @@ CIBStrategy::constructMobilityMatrix(const std::string& /*mat_name*/,
     return;
 } // constructMobilityMatrix
 
+void
+CIBStrategy::applyMobilityOperator(MobilityMatrixType /*mat_type*/,
+                                   Vec /*lambda*/,
+                                   Vec /*U*/,
+                                   const double* /*grid_dx*/,
+                                   double /*mu*/,
+                                   double /*f_periodic_corr*/,
+                                   const int /*managing_rank*/)
+{
+    TBOX_ERROR("CIBStrategy::applyMobilityOperator(): unimplemented\n");
+    return;
+} // applyMobilityOperator
+
 void
 CIBStrategy::constructGeometricMatrix(const std::string& /*mat_name*/,
                                       Mat& /*geometric_mat*/,
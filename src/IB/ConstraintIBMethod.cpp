@@ -44,6 +44,7 @@
 #include "ibtk/ibtk_utilities.h"
 
 #include "ArrayData.h"
+#include "BasePatchHierarchy.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
@@ -177,6 +178,23 @@ find_struct_handle_position(itr begin, itr end, const T& value)
     return -1;
 }
 
+// Sum the specified arrays over all processes with a single reduction.
+inline void
+sum_reduction(const std::vector<std::pair<double*, int> >& arrays)
+{
+    std::vector<double> buffer;
+    for (const auto& array : arrays) buffer.insert(buffer.end(), array.first, array.first + array.second);
+    if (buffer.empty()) return;
+    SAMRAI_MPI::sumReduction(buffer.data(), static_cast<int>(buffer.size()));
+    std::size_t offset = 0;
+    for (const auto& array : arrays)
+    {
+        std::copy(buffer.begin() + offset, buffer.begin() + offset + array.second, array.first);
+        offset += array.second;
+    }
+    return;
+} // sum_reduction
+
 #if (NDIM == 3)
 // Routine to solve 3X3 equation to get rigid body rotational velocity.
 inline void
@@ -705,6 +723,24 @@ ConstraintIBMethod::putToDatabase(Pointer<Database> db)
 
 } // putToDatabase
 
+void
+ConstraintIBMethod::resetHierarchyConfiguration(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
+                                                int coarsest_level,
+                                                int finest_level)
+{
+    IBMethod::resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+
+    // The state of the velocity correction projection solver depends on the
+    // configuration of the patch hierarchy.
+    if (d_projection_solver_is_initialized)
+    {
+        d_velcorrection_projection_solver->deallocateSolverState();
+        d_projection_solver_is_initialized = false;
+    }
+
+    return;
+} // resetHierarchyConfiguration
+
 void
 ConstraintIBMethod::preprocessIntegrateData(double current_time, double new_time, int num_cycles)
 {
@@ -773,6 +809,8 @@ ConstraintIBMethod::getFromInput(Pointer<Database> input_db, const bool from_res
 {
     // Read in control parameters from input database.
     d_needs_div_free_projection = input_db->getBoolWithDefault("needs_divfree_projection", d_needs_div_free_projection);
+    d_reuse_projection_solver_state =
+        input_db->getBoolWithDefault("reuse_projection_solver_state", d_reuse_projection_solver_state);
     input_db->getDoubleArray("rho_solid", &d_rho_solid[0], d_no_structures);
     d_rho_fluid = input_db->getDoubleWithDefault("rho_fluid", d_rho_fluid);
     d_calculate_structure_linear_mom =
@@ -972,15 +1010,24 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         ptr_x_lag_data_new->restoreArrays();
     }
 
+    // Sum the contributions to the centers of mass and the tagged point
+    // positions of all of the structures in a single reduction.
+    std::vector<std::pair<double*, int> > com_data;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        com_data.emplace_back(d_center_of_mass_current[struct_no].data(),
+                              static_cast<int>(d_center_of_mass_current[struct_no].size()));
+        com_data.emplace_back(d_center_of_mass_new[struct_no].data(),
+                              static_cast<int>(d_center_of_mass_new[struct_no].size()));
+        com_data.emplace_back(tagged_position[struct_no].data(), 3);
+    }
+    sum_reduction(com_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         const int total_nodes = struct_param.getTotalNodes();
 
-        SAMRAI_MPI::sumReduction(d_center_of_mass_current[struct_no].data(),
-                                 d_center_of_mass_current[struct_no].size());
-        SAMRAI_MPI::sumReduction(d_center_of_mass_new[struct_no].data(), d_center_of_mass_new[struct_no].size());
-
         for (int i = 0; i < 3; ++i)
         {
             d_center_of_mass_current[struct_no][i] /= total_nodes;
@@ -990,7 +1037,6 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
 
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&tagged_position[struct_no][0], 3);
         d_tagged_pt_position[struct_no] = tagged_position[struct_no];
     }
 
@@ -1092,15 +1138,17 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         ptr_x_lag_data_new->restoreArrays();
     } // all levels
 
+    std::vector<std::pair<double*, int> > moi_data;
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfRotating())
         {
-            SAMRAI_MPI::sumReduction(&d_moment_of_inertia_current[struct_no](0, 0), 9);
-            SAMRAI_MPI::sumReduction(&d_moment_of_inertia_new[struct_no](0, 0), 9);
+            moi_data.emplace_back(&d_moment_of_inertia_current[struct_no](0, 0), 9);
+            moi_data.emplace_back(&d_moment_of_inertia_new[struct_no](0, 0), 9);
         }
     }
+    sum_reduction(moi_data);
 
     // Fill-in symmetric part of inertia tensor.
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
@@ -1520,12 +1568,23 @@ ConstraintIBMethod::calculateRigidTranslationalMomentum()
         d_l_data_U_interp[ln]->restoreArrays();
     } // all levels
 
+    std::vector<std::pair<double*, int> > trans_vel_data;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        if (struct_param.getStructureIsSelfTranslating())
+        {
+            trans_vel_data.emplace_back(d_rigid_trans_vel_new[struct_no].data(),
+                                        static_cast<int>(d_rigid_trans_vel_new[struct_no].size()));
+        }
+    }
+    sum_reduction(trans_vel_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfTranslating())
         {
-            SAMRAI_MPI::sumReduction(d_rigid_trans_vel_new[struct_no].data(), d_rigid_trans_vel_new[struct_no].size());
             tbox::Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
             for (int d = 0; d < NDIM; ++d)
             {
@@ -1624,12 +1683,19 @@ ConstraintIBMethod::calculateRigidRotationalMomentum()
         d_l_data_X_half_Euler[ln]->restoreArrays();
     } // all levels
 
+    std::vector<std::pair<double*, int> > rot_vel_data;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        if (struct_param.getStructureIsSelfRotating()) rot_vel_data.emplace_back(&d_rigid_rot_vel_new[struct_no][0], 3);
+    }
+    sum_reduction(rot_vel_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfRotating())
         {
-            SAMRAI_MPI::sumReduction(&d_rigid_rot_vel_new[struct_no][0], 3);
 #if (NDIM == 2)
             d_rigid_rot_vel_new[struct_no][2] /= d_moment_of_inertia_new[struct_no](2, 2);
 #endif
@@ -1956,17 +2022,28 @@ ConstraintIBMethod::applyProjection()
     d_velcorrection_projection_fac_op->setPoissonSpecifications(*d_velcorrection_projection_spec);
     d_velcorrection_projection_fac_op->setPhysicalBcCoef(&d_velcorrection_projection_bc_coef);
 
-    d_velcorrection_projection_solver->setInitialGuessNonzero(false);
-    d_velcorrection_projection_solver->setOperator(d_velcorrection_projection_op);
+    // Solve the projection Poisson problem.  When the density is constant,
+    // the Poisson operator does not change between time steps, and the solver
+    // and preconditioner state may be kept until the patch hierarchy changes.
+    const bool reuse_solver_state = d_reuse_projection_solver_state && d_rho_is_const;
+    if (!d_projection_solver_is_initialized)
+    {
+        d_velcorrection_projection_solver->setInitialGuessNonzero(false);
+        d_velcorrection_projection_solver->setOperator(d_velcorrection_projection_op);
 
-    // NOTE: We always use homogeneous Neumann boundary conditions for the
-    // velocity correction projection Poisson solver.
-    d_velcorrection_projection_solver->setNullspace(true);
+        // NOTE: We always use homogeneous Neumann boundary conditions for the
+        // velocity correction projection Poisson solver.
+        d_velcorrection_projection_solver->setNullspace(true);
 
-    // Solve the projection Poisson problem.
-    d_velcorrection_projection_solver->initializeSolverState(sol_vec, rhs_vec);
+        d_velcorrection_projection_solver->initializeSolverState(sol_vec, rhs_vec);
+        d_projection_solver_is_initialized = true;
+    }
     d_velcorrection_projection_solver->solveSystem(sol_vec, rhs_vec);
-    d_velcorrection_projection_solver->deallocateSolverState();
+    if (!reuse_solver_state)
+    {
+        d_velcorrection_projection_solver->deallocateSolverState();
+        d_projection_solver_is_initialized = false;
+    }
 
     // Setup the interpolation transaction information.
     using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
@@ -2469,10 +2546,16 @@ ConstraintIBMethod::calculateDrag()
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
+    std::vector<std::pair<double*, int> > force_data;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        force_data.emplace_back(&inertia_force[struct_no][0], 3);
+        force_data.emplace_back(&constraint_force[struct_no][0], 3);
+    }
+    sum_reduction(force_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_force[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_force[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_force[struct_no][d] *= (d_rho_solid[struct_no] / dt) * d_vol_element[struct_no];
@@ -2579,10 +2662,16 @@ ConstraintIBMethod::calculateTorque()
         d_l_data_U_correction[ln]->restoreArrays();
         d_X_new_data[ln]->restoreArrays();
     }
+    std::vector<std::pair<double*, int> > torque_data;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        torque_data.emplace_back(&inertia_torque[struct_no][0], 3);
+        torque_data.emplace_back(&constraint_torque[struct_no][0], 3);
+    }
+    sum_reduction(torque_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_torque[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_torque[struct_no][0], 3);
         for (int d = 0; d < 3; ++d)
         {
             inertia_torque[struct_no][d] *= (d_rho_solid[struct_no] / dt) * d_vol_element[struct_no];
@@ -2661,10 +2750,16 @@ ConstraintIBMethod::calculatePower()
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
+    std::vector<std::pair<double*, int> > power_data;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        power_data.emplace_back(&inertia_power[struct_no][0], 3);
+        power_data.emplace_back(&constraint_power[struct_no][0], 3);
+    }
+    sum_reduction(power_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_power[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_power[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_power[struct_no][d] *= (d_rho_solid[struct_no] / dt) * d_vol_element[struct_no];
@@ -2731,9 +2826,15 @@ ConstraintIBMethod::calculateStructureMomentum()
         d_l_data_U_new[ln]->restoreArrays();
     }
 
+    std::vector<std::pair<double*, int> > mom_data;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        mom_data.emplace_back(&d_structure_mom[struct_no][0], 3);
+    }
+    sum_reduction(mom_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&d_structure_mom[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             d_structure_mom[struct_no][d] *= d_rho_solid[struct_no] * d_vol_element[struct_no];
@@ -2810,9 +2911,15 @@ ConstraintIBMethod::calculateStructureRotationalMomentum()
         d_l_data_U_new[ln]->restoreArrays();
         d_X_new_data[ln]->restoreArrays();
     }
+    std::vector<std::pair<double*, int> > mom_data;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        mom_data.emplace_back(&d_structure_rotational_mom[struct_no][0], 3);
+    }
+    sum_reduction(mom_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&d_structure_rotational_mom[struct_no][0], 3);
         for (int d = 0; d < 3; ++d)
         {
             d_structure_rotational_mom[struct_no][d] *= d_rho_solid[struct_no] * d_vol_element[struct_no];
@@ -79,6 +79,21 @@ extern "C"
                 const int& ldb,
                 int& info);
 
+    // BLAS function to compute the matrix-matrix product C = alpha*op(A)*op(B) + beta*C.
+    void dgemm_(const char* transa,
+                const char* transb,
+                const int& m,
+                const int& n,
+                const int& k,
+                const double& alpha,
+                const double* a,
+                const int& lda,
+                const double* b,
+                const int& ldb,
+                const double& beta,
+                double* c,
+                const int& ldc);
+
     // LAPACK function to do SVD factorization.
     void dsyevr_(const char* jobz,
                  const char* range,
@@ -206,9 +221,12 @@ DirectMobilitySolver::registerMobilityMat(const std::string& mat_name,
         num_nodes += d_cib_strategy->getNumberOfNodes(prototype_struct_id);
     }
 
-    // Fill-in various maps.
+    // Fill-in various maps.  Matrices that are not assigned to a particular
+    // processor are distributed among the processors in round-robin order, so
+    // that their factorizations are computed concurrently.
     d_mat_prototype_id_map[mat_name] = prototype_struct_ids;
-    d_mat_proc_map[mat_name] = managing_proc;
+    d_mat_proc_map[mat_name] =
+        managing_proc >= 0 ? managing_proc : (d_num_auto_managed_mats++) % SAMRAI_MPI::getNodes();
     d_mat_nodes_map[mat_name] = num_nodes;
     d_mat_parts_map[mat_name] = static_cast<unsigned>(prototype_struct_ids.size());
     d_mat_type_map[mat_name] = mat_type;
@@ -226,7 +244,7 @@ DirectMobilitySolver::registerMobilityMat(const std::string& mat_name,
     const int body_mobility_mat_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
     const int rank = SAMRAI_MPI::getRank();
 
-    if (rank == managing_proc)
+    if (rank == d_mat_proc_map[mat_name])
     {
         d_mat_map[mat_name].first.resize(mobility_mat_size * mobility_mat_size);
         MatCreateSeqDense(PETSC_COMM_SELF,
@@ -290,12 +308,26 @@ DirectMobilitySolver::registerStructIDsWithMobilityMat(const std::string& mat_na
 void
 DirectMobilitySolver::setStokesSpecifications(const StokesSpecifications& stokes_spec)
 {
-    d_rho = stokes_spec.getRho();
-    d_mu = stokes_spec.getMu();
+    const double rho = stokes_spec.getRho();
+    const double mu = stokes_spec.getMu();
+    if (!MathUtilities<double>::equalEps(rho, d_rho) || !MathUtilities<double>::equalEps(mu, d_mu))
+    {
+        d_mob_mat_out_of_date = true;
+    }
+    d_rho = rho;
+    d_mu = mu;
 
     return;
 } // setStokesSpecifications
 
+void
+DirectMobilitySolver::setMobilityMatricesOutOfDate()
+{
+    d_mob_mat_out_of_date = true;
+
+    return;
+} // setMobilityMatricesOutOfDate
+
 void
 DirectMobilitySolver::setSolutionTime(const double solution_time)
 {
@@ -335,29 +367,31 @@ DirectMobilitySolver::solveSystem(Vec x, Vec b)
         const int mat_size = d_mat_nodes_map[mat_name] * data_depth;
         const int num_structs = static_cast<int>(struct_ids.size());
 
+        // All structures associated with the matrix share its factorization,
+        // so their right-hand sides are gathered and solved together.
+        std::vector<double> rhs_all;
+        if (rank == managing_proc) rhs_all.resize(mat_size * num_structs);
         for (int k = 0; k < num_structs; ++k)
         {
-            std::vector<double> rhs;
-            if (rank == managing_proc) rhs.resize(mat_size);
-            d_cib_strategy->copyVecToArray(b, rhs.data(), struct_ids[k], data_depth, managing_proc);
+            double* const rhs = rank == managing_proc ? rhs_all.data() + k * mat_size : nullptr;
+            d_cib_strategy->copyVecToArray(b, rhs, struct_ids[k], data_depth, managing_proc);
             if (!d_recompute_mob_mat)
             {
-                d_cib_strategy->rotateArray(rhs.data(),
-                                            struct_ids[k],
-                                            /*use_transpose*/ true,
-                                            managing_proc,
-                                            data_depth);
+                d_cib_strategy->rotateArray(rhs, struct_ids[k], /*use_transpose*/ true, managing_proc, data_depth);
             }
-            if (rank == managing_proc) computeSolution(mat, inv_type, d_ipiv_map[mat_name].first.data(), rhs.data());
+        }
+        if (rank == managing_proc && num_structs > 0)
+        {
+            computeSolution(mat, inv_type, d_ipiv_map[mat_name].first.data(), rhs_all.data(), num_structs);
+        }
+        for (int k = 0; k < num_structs; ++k)
+        {
+            double* const rhs = rank == managing_proc ? rhs_all.data() + k * mat_size : nullptr;
             if (!d_recompute_mob_mat)
             {
-                d_cib_strategy->rotateArray(rhs.data(),
-                                            struct_ids[k],
-                                            /*use_transpose*/ false,
-                                            managing_proc,
-                                            data_depth);
+                d_cib_strategy->rotateArray(rhs, struct_ids[k], /*use_transpose*/ false, managing_proc, data_depth);
             }
-            d_cib_strategy->copyArrayToVec(x, rhs.data(), struct_ids[k], data_depth, managing_proc);
+            d_cib_strategy->copyArrayToVec(x, rhs, struct_ids[k], data_depth, managing_proc);
         }
     }
 
@@ -388,29 +422,31 @@ DirectMobilitySolver::solveBodySystem(Vec x, Vec b)
         const int managing_proc = d_mat_proc_map[mat_name];
         const int num_structs = static_cast<int>(struct_ids.size());
 
+        // All structures associated with the matrix share its factorization,
+        // so their right-hand sides are gathered and solved together.
+        std::vector<double> rhs_all;
+        if (rank == managing_proc) rhs_all.resize(mat_size * num_structs);
         for (int k = 0; k < num_structs; ++k)
         {
-            std::vector<double> rhs;
-            if (rank == managing_proc) rhs.resize(mat_size);
-            d_cib_strategy->copyFreeDOFsVecToArray(b, rhs.data(), struct_ids[k], managing_proc);
+            double* const rhs = rank == managing_proc ? rhs_all.data() + k * mat_size : nullptr;
+            d_cib_strategy->copyFreeDOFsVecToArray(b, rhs, struct_ids[k], managing_proc);
             if (!d_recompute_mob_mat)
             {
-                d_cib_strategy->rotateArray(rhs.data(),
-                                            struct_ids[k],
-                                            /*use_transpose*/ true,
-                                            managing_proc,
-                                            data_depth);
+                d_cib_strategy->rotateArray(rhs, struct_ids[k], /*use_transpose*/ true, managing_proc, data_depth);
             }
-            if (rank == managing_proc) computeSolution(mat, inv_type, d_ipiv_map[mat_name].second.data(), rhs.data());
+        }
+        if (rank == managing_proc && num_structs > 0)
+        {
+            computeSolution(mat, inv_type, d_ipiv_map[mat_name].second.data(), rhs_all.data(), num_structs);
+        }
+        for (int k = 0; k < num_structs; ++k)
+        {
+            double* const rhs = rank == managing_proc ? rhs_all.data() + k * mat_size : nullptr;
             if (!d_recompute_mob_mat)
             {
-                d_cib_strategy->rotateArray(rhs.data(),
-                                            struct_ids[k],
-                                            /*use_transpose*/ false,
-                                            managing_proc,
-                                            data_depth);
+                d_cib_strategy->rotateArray(rhs, struct_ids[k], /*use_transpose*/ false, managing_proc, data_depth);
             }
-            d_cib_strategy->copyFreeDOFsArrayToVec(x, rhs.data(), struct_ids[k], managing_proc);
+            d_cib_strategy->copyFreeDOFsArrayToVec(x, rhs, struct_ids[k], managing_proc);
         }
     }
 
@@ -427,37 +463,45 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
     IBAMR_TIMER_START(t_initialize_solver_state);
 
     int rank = SAMRAI_MPI::getRank();
-    auto managed_mats = static_cast<unsigned>(d_mat_map.size());
-
-    static bool recreate_mobility_matrices = true;
-    static std::vector<bool> read_files(managed_mats, false);
     bool initial_time = !d_recompute_mob_mat;
 
-    if (recreate_mobility_matrices)
+    // Get grid-info
+    Vec* vx;
+    VecNestGetSubVecs(x, nullptr, &vx);
+    Pointer<SAMRAIVectorReal<NDIM, double> > vx0;
+    IBTK::PETScSAMRAIVectorReal::getSAMRAIVectorRead(vx[0], &vx0);
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy = vx0->getPatchHierarchy();
+    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+    IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVectorRead(vx[0], &vx0);
+    Pointer<PatchLevel<NDIM> > struct_patch_level = patch_hierarchy->getPatchLevel(finest_ln);
+    const IntVector<NDIM>& ratio = struct_patch_level->getRatio();
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = patch_hierarchy->getGridGeometry();
+    const double* dx0 = grid_geom->getDx();
+    const double* X_upper = grid_geom->getXUpper();
+    const double* X_lower = grid_geom->getXLower();
+    double domain_extents[NDIM], dx[NDIM];
+    bool dx_changed = false;
+    for (int d = 0; d < NDIM; ++d)
     {
-        // Get grid-info
-        Vec* vx;
-        VecNestGetSubVecs(x, nullptr, &vx);
-        Pointer<SAMRAIVectorReal<NDIM, double> > vx0;
-        IBTK::PETScSAMRAIVectorReal::getSAMRAIVectorRead(vx[0], &vx0);
-        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = vx0->getPatchHierarchy();
-        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
-        IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVectorRead(vx[0], &vx0);
-        Pointer<PatchLevel<NDIM> > struct_patch_level = patch_hierarchy->getPatchLevel(finest_ln);
-        const IntVector<NDIM>& ratio = struct_patch_level->getRatio();
-        Pointer<CartesianGridGeometry<NDIM> > grid_geom = patch_hierarchy->getGridGeometry();
-        const double* dx0 = grid_geom->getDx();
-        const double* X_upper = grid_geom->getXUpper();
-        const double* X_lower = grid_geom->getXLower();
-        double domain_extents[NDIM], dx[NDIM];
-        for (int d = 0; d < NDIM; ++d)
-        {
-            dx[d] = dx0[d] / ratio(d);
-            domain_extents[d] = X_upper[d] - X_lower[d];
-        }
-
-        int file_counter = 0;
-        for (auto it = d_petsc_mat_map.begin(); it != d_petsc_mat_map.end(); ++it, ++file_counter)
+        dx[d] = dx0[d] / ratio(d);
+        domain_extents[d] = X_upper[d] - X_lower[d];
+        if (!MathUtilities<double>::equalEps(dx[d], d_mob_mat_dx[d])) dx_changed = true;
+    }
+    if (dx_changed) d_mob_mat_out_of_date = true;
+
+    // Matrices that are constructed in the reference (body) frame of the
+    // structures only need to be reconstructed and refactorized when the grid
+    // spacing or the fluid parameters change.  Otherwise, the configuration
+    // of each structure is accounted for at solve time by rotating the
+    // right-hand side into the body frame and the solution back out of it.
+    // When the matrices are reconstructed in the current configuration of the
+    // structures, they may be reused for several initializations of the solver
+    // (e.g., when this solver is only used as a preconditioner).
+    const bool recompute_mob_mat =
+        d_recompute_mob_mat && (d_num_inits_since_mob_mat_recompute + 1 >= d_recompute_mob_mat_interval);
+    if (recompute_mob_mat || d_mob_mat_out_of_date)
+    {
+        for (auto it = d_petsc_mat_map.begin(); it != d_petsc_mat_map.end(); ++it)
         {
             const std::string& mat_name = it->first;
             Mat& mobility_mat = d_petsc_mat_map[mat_name].first;
@@ -467,10 +511,21 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
             const std::pair<double, double>& scale = d_mat_scale_map[mat_name];
             const int managing_proc = d_mat_proc_map[mat_name];
 
-            if (mat_type == READ_FROM_FILE && !read_files[file_counter])
+            if (mat_type == READ_FROM_FILE)
             {
-                // Get the matrix from file.
+                // The matrix is factorized in place, so it has to be read
+                // again whenever it is refactorized.  A matrix read from a
+                // file is only valid for the grid spacing it was generated
+                // with.
                 const std::string& filename = d_mat_filename_map[mat_name];
+                if (d_mob_mat_constructed && dx_changed)
+                {
+                    TBOX_ERROR(d_object_name << "::initializeSolverState():\n"
+                                             << "  the grid spacing of the finest level has changed, but mobility "
+                                             << "matrix " << mat_name << " is read from file " << filename << ".\n"
+                                             << "  READ_FROM_FILE matrices cannot be reconstructed for a new grid "
+                                             << "spacing.\n");
+                }
                 if (rank == managing_proc)
                 {
                     PetscViewer binary_viewer;
@@ -478,8 +533,6 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
                     MatLoad(mobility_mat, binary_viewer);
                     PetscViewerDestroy(&binary_viewer);
                 }
-
-                read_files[file_counter] = true;
             }
             else
             {
@@ -504,10 +557,17 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
         factorizeMobilityMatrix();
         constructBodyMobilityMatrix();
         factorizeBodyMobilityMatrix();
+        d_num_inits_since_mob_mat_recompute = 0;
+    }
+    else
+    {
+        ++d_num_inits_since_mob_mat_recompute;
     }
 
     d_is_initialized = true;
-    recreate_mobility_matrices = d_recompute_mob_mat;
+    std::copy(dx, dx + NDIM, d_mob_mat_dx.begin());
+    d_mob_mat_out_of_date = false;
+    d_mob_mat_constructed = true;
 
     IBAMR_TIMER_STOP(t_initialize_solver_state);
 
@@ -558,6 +618,13 @@ DirectMobilitySolver::getFromInput(Pointer<Database> input_db)
     // Other parameters
     d_f_periodic_corr = input_db->getDoubleWithDefault("f_periodic_correction", d_f_periodic_corr);
     d_recompute_mob_mat = input_db->getBoolWithDefault("recompute_mob_mat_perstep", d_recompute_mob_mat);
+    d_recompute_mob_mat_interval =
+        input_db->getIntegerWithDefault("recompute_mob_mat_interval", d_recompute_mob_mat_interval);
+    if (d_recompute_mob_mat_interval < 1)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  recompute_mob_mat_interval must be positive\n");
+    }
 
     return;
 } // getFromInput
@@ -607,14 +674,12 @@ DirectMobilitySolver::constructBodyMobilityMatrix()
         MatCreateSeqDense(PETSC_COMM_SELF, row_size, col_size, product_mat_data.data(), &product_mat);
         MatCopy(geometric_mat, product_mat, SAME_NONZERO_PATTERN);
 
-        for (int col = 0; col < col_size; ++col)
-        {
-            double* col_data;
-            MatDenseGetArray(product_mat, &col_data);
-            computeSolution(
-                mobility_mat, mobility_inv_type, d_ipiv_map[mat_name].first.data(), &col_data[col * row_size]);
-            MatDenseRestoreArray(product_mat, &col_data);
-        }
+        // Solve for all of the columns at once so that the solution is
+        // computed with level 3 BLAS operations.
+        double* product_data;
+        MatDenseGetArray(product_mat, &product_data);
+        computeSolution(mobility_mat, mobility_inv_type, d_ipiv_map[mat_name].first.data(), product_data, col_size);
+        MatDenseRestoreArray(product_mat, &product_data);
         MatTransposeMatMult(geometric_mat, product_mat, MAT_REUSE_MATRIX, PETSC_DEFAULT, &body_mob_mat);
 
         MatDestroy(&product_mat);
@@ -802,7 +867,11 @@ DirectMobilitySolver::factorizeDenseMatrix(double* mat_data,
 } // factorizeDenseMatrix
 
 void
-DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs)
+DirectMobilitySolver::computeSolution(Mat& mat,
+                                      const MobilityMatrixInverseType& inv_type,
+                                      int* ipiv,
+                                      double* rhs,
+                                      const int num_rhs)
 {
     // Get pointer to matrix.
     int mat_size;
@@ -813,7 +882,7 @@ DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType&
     int err = 0;
     if (inv_type == LAPACK_CHOLESKY)
     {
-        dpotrs_((char*)"L", mat_size, 1, mat_data, mat_size, rhs, mat_size, err);
+        dpotrs_((char*)"L", mat_size, num_rhs, mat_data, mat_size, rhs, mat_size, err);
         if (err)
         {
             TBOX_ERROR("DirectMobilitySolver::computeSolution(). Solution failed using "
@@ -822,7 +891,7 @@ DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType&
     }
     else if (inv_type == LAPACK_LU)
     {
-        dgetrs_((char*)"N", mat_size, 1, mat_data, mat_size, ipiv, rhs, mat_size, err);
+        dgetrs_((char*)"N", mat_size, num_rhs, mat_data, mat_size, ipiv, rhs, mat_size, err);
 
         if (err)
         {
@@ -832,24 +901,35 @@ DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType&
     }
     else if (inv_type == LAPACK_SVD)
     {
-        std::vector<double> temp(mat_size);
-        for (int i = 0; i < mat_size; ++i)
-        {
-            temp[i] = 0.0;
-            for (int j = 0; j < mat_size; ++j)
-            {
-                temp[i] += mat_data[i * mat_size + j] * rhs[j];
-            }
-        }
-
-        for (int i = 0; i < mat_size; ++i)
-        {
-            rhs[i] = 0.0;
-            for (int j = 0; j < mat_size; ++j)
-            {
-                rhs[i] += mat_data[j * mat_size + i] * temp[j];
-            }
-        }
+        // The factorization stores the matrix Z = V*inv(sqrt(W)), so that the
+        // solution is given by Z*Z^T*rhs.
+        std::vector<double> temp(mat_size * num_rhs);
+        dgemm_((char*)"T",
+               (char*)"N",
+               mat_size,
+               num_rhs,
+               mat_size,
+               1.0,
+               mat_data,
+               mat_size,
+               rhs,
+               mat_size,
+               0.0,
+               temp.data(),
+               mat_size);
+        dgemm_((char*)"N",
+               (char*)"N",
+               mat_size,
+               num_rhs,
+               mat_size,
+               1.0,
+               mat_data,
+               mat_size,
+               temp.data(),
+               mat_size,
+               0.0,
+               rhs,
+               mat_size);
     }
     else
     {
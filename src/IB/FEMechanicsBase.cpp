@@ -28,6 +28,7 @@
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/libmesh_utilities.h"
 
+#include "tbox/Array.h"
 #include "tbox/RestartManager.h"
 
 #include "libmesh/boundary_info.h"
@@ -54,6 +55,7 @@
 #include "libmesh/libmesh_config.h"
 #include "libmesh/linear_implicit_system.h"
 #include "libmesh/mesh_base.h"
+#include "libmesh/mesh_tools.h"
 #include "libmesh/node.h"
 #include "libmesh/numeric_vector.h"
 #include "libmesh/parameters.h"
@@ -69,7 +71,9 @@
 #include "libmesh/type_vector.h"
 #include "libmesh/variant_filter_iterator.h"
 #include "libmesh/vector_value.h"
+#include "libmesh/xdr_cxx.h"
 
+#include <algorithm>
 #include <iterator>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -153,6 +157,65 @@ get_x_and_FF(libMesh::VectorValue<double>& x,
         FF(i, i) = 1.0;
     }
 }
+
+// Write the solution vectors of the systems that are not listed in
+// static_systems.  As in EquationSystems::write(), the mesh is temporarily
+// renumbered so that the file does not depend on the parallel partitioning.
+void
+write_time_varying_fe_data(EquationSystems& equation_systems,
+                           const std::set<std::string>& static_systems,
+                           const std::string& file_name,
+                           const XdrMODE xdr_mode)
+{
+    MeshBase& mesh = equation_systems.get_mesh();
+    const bool is_root = mesh.processor_id() == 0;
+    MeshTools::Private::globally_renumber_nodes_and_elements(mesh);
+    {
+        Xdr io(is_root ? file_name : "", xdr_mode);
+        std::vector<std::string> system_names;
+        for (unsigned int sys_num = 0; sys_num < equation_systems.n_systems(); ++sys_num)
+        {
+            const std::string& system_name = equation_systems.get_system(sys_num).name();
+            if (!static_systems.count(system_name)) system_names.push_back(system_name);
+        }
+        unsigned int n_systems = system_names.size();
+        if (is_root) io.data(n_systems, "# No. of time-varying systems");
+        for (auto& system_name : system_names)
+        {
+            if (is_root) io.data(system_name, "# System name");
+            const System& system = equation_systems.get_system(system_name);
+            const std::vector<const NumericVector<Number>*> vecs = { system.solution.get() };
+            system.write_serialized_vectors(io, vecs);
+        }
+    }
+    mesh.fix_broken_node_and_element_numbering();
+}
+
+// Read the solution vectors written by write_time_varying_fe_data().
+void
+read_time_varying_fe_data(EquationSystems& equation_systems, const std::string& file_name, const XdrMODE xdr_mode)
+{
+    MeshBase& mesh = equation_systems.get_mesh();
+    const bool is_root = mesh.processor_id() == 0;
+    MeshTools::Private::globally_renumber_nodes_and_elements(mesh);
+    {
+        Xdr io(is_root ? file_name : "", xdr_mode);
+        unsigned int n_systems = 0;
+        if (is_root) io.data(n_systems);
+        mesh.comm().broadcast(n_systems);
+        for (unsigned int k = 0; k < n_systems; ++k)
+        {
+            std::string system_name;
+            if (is_root) io.data(system_name);
+            mesh.comm().broadcast(system_name);
+            System& system = equation_systems.get_system(system_name);
+            const std::vector<NumericVector<Number>*> vecs = { system.solution.get() };
+            system.read_serialized_vectors(io, vecs);
+            system.update();
+        }
+    }
+    mesh.fix_broken_node_and_element_numbering();
+}
 } // namespace
 
 const std::string FEMechanicsBase::COORDS_SYSTEM_NAME = "IB coordinates system";
@@ -256,6 +319,39 @@ FEMechanicsBase::getPK1StressFunction(unsigned int part) const
     return d_PK1_stress_fcn_data[part];
 }
 
+void
+FEMechanicsBase::PK1StressFcnData::evaluate(
+    TensorValue<double>& PP,
+    const TensorValue<double>& FF,
+    const libMesh::Point& x,
+    const libMesh::Point& X,
+    Elem* const elem,
+    const std::vector<const std::vector<double>*>& system_var_data,
+    const std::vector<const std::vector<VectorValue<double> >*>& system_grad_var_data,
+    const double data_time) const
+{
+    if (fcn)
+    {
+        fcn(PP, FF, x, X, elem, system_var_data, system_grad_var_data, data_time, ctx);
+        return;
+    }
+    TBOX_ASSERT(batch_fcn);
+    batch_PP.resize(1);
+    batch_FF.resize(1);
+    batch_x.resize(1);
+    batch_X.resize(1);
+    batch_var_data.resize(1);
+    batch_grad_var_data.resize(1);
+    batch_FF[0] = FF;
+    batch_x[0] = x;
+    batch_X[0] = X;
+    batch_var_data[0] = system_var_data;
+    batch_grad_var_data[0] = system_grad_var_data;
+    batch_fcn(batch_PP, batch_FF, batch_x, batch_X, elem, batch_var_data, batch_grad_var_data, data_time, ctx);
+    PP = batch_PP[0];
+    return;
+}
+
 void
 FEMechanicsBase::registerLagBodyForceFunction(const LagBodyForceFcnData& data, const unsigned int part)
 {
@@ -298,6 +394,15 @@ FEMechanicsBase::getLagSurfaceForceFunction(unsigned int part) const
     return d_lag_surface_force_fcn_data[part];
 }
 
+void
+FEMechanicsBase::setUseReferenceQuadratureCache(const bool use_cache, const unsigned int part)
+{
+    TBOX_ASSERT(part < d_meshes.size());
+    TBOX_ASSERT(!d_fe_data_initialized);
+    d_use_reference_quadrature_cache[part] = use_cache;
+    return;
+} // setUseReferenceQuadratureCache
+
 void
 FEMechanicsBase::preprocessIntegrateData(double current_time, double new_time, int /*num_cycles*/)
 {
@@ -342,6 +447,10 @@ FEMechanicsBase::initializeFEData()
     if (d_fe_data_initialized) return;
 
     initializeFEEquationSystems();
+    for (unsigned int part = 0; part < d_meshes.size(); ++part)
+    {
+        d_fe_data[part]->setUseReferenceQuadratureCache(d_use_reference_quadrature_cache[part]);
+    }
     doInitializeFEData(RestartManager::getManager()->isFromRestart());
     d_fe_data_initialized = true;
 }
@@ -350,6 +459,10 @@ void
 FEMechanicsBase::reinitializeFEData()
 {
     TBOX_ASSERT(d_fe_data_initialized);
+    // The mesh may have been modified, so stored reference configuration data may no longer be valid.
+    for (const auto& fe_data : d_fe_data) fe_data->clearReferenceQuadratureCache();
+    // For the same reason, the static restart data must be written again.
+    d_libmesh_static_restart_dump_dirname.clear();
     doInitializeFEData(true);
 }
 
@@ -359,22 +472,48 @@ FEMechanicsBase::putToDatabase(Pointer<Database> db)
     db->putInteger("FE_MECHANICS_BASE_VERSION", FE_MECHANICS_BASE_VERSION);
     db->putBool("d_use_consistent_mass_matrix", d_use_consistent_mass_matrix);
     db->putString("d_libmesh_partitioner_type", enum_to_string<LibmeshPartitionerType>(d_libmesh_partitioner_type));
+    db->putBool("d_use_incremental_libmesh_restart_files", d_use_incremental_libmesh_restart_files);
 }
 
 void
 FEMechanicsBase::writeFEDataToRestartFile(const std::string& restart_dump_dirname, unsigned int time_step_number)
 {
+    const XdrMODE xdr_mode = (d_libmesh_restart_file_extension == "xdr" ? ENCODE : WRITE);
+    if (!d_use_incremental_libmesh_restart_files)
+    {
+        for (unsigned int part = 0; part < d_meshes.size(); ++part)
+        {
+            const std::string& file_name = libmesh_restart_file_name(
+                restart_dump_dirname, time_step_number, part, d_libmesh_restart_file_extension);
+            const int write_mode = EquationSystems::WRITE_DATA | EquationSystems::WRITE_ADDITIONAL_DATA;
+            d_equation_systems[part]->write(file_name,
+                                            xdr_mode,
+                                            write_mode,
+                                            /*partition_agnostic*/ true);
+        }
+        return;
+    }
+
+    // The static restart files contain the complete equation systems.  The
+    // additional system vectors are not written, since they are recomputed
+    // from the solution vectors at the beginning of each time step.
+    const bool write_static_data = d_libmesh_static_restart_dump_dirname != restart_dump_dirname;
     for (unsigned int part = 0; part < d_meshes.size(); ++part)
     {
+        if (write_static_data)
+        {
+            const std::string& file_name =
+                libmesh_static_restart_file_name(restart_dump_dirname, part, d_libmesh_restart_file_extension);
+            d_equation_systems[part]->write(file_name,
+                                            xdr_mode,
+                                            EquationSystems::WRITE_DATA,
+                                            /*partition_agnostic*/ true);
+        }
         const std::string& file_name =
             libmesh_restart_file_name(restart_dump_dirname, time_step_number, part, d_libmesh_restart_file_extension);
-        const XdrMODE xdr_mode = (d_libmesh_restart_file_extension == "xdr" ? ENCODE : WRITE);
-        const int write_mode = EquationSystems::WRITE_DATA | EquationSystems::WRITE_ADDITIONAL_DATA;
-        d_equation_systems[part]->write(file_name,
-                                        xdr_mode,
-                                        write_mode,
-                                        /*partition_agnostic*/ true);
+        write_time_varying_fe_data(*d_equation_systems[part], d_libmesh_restart_static_systems, file_name, xdr_mode);
     }
+    d_libmesh_static_restart_dump_dirname = restart_dump_dirname;
 }
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
@@ -414,7 +553,8 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
     const size_t num_PK1_fcns = d_PK1_stress_fcn_data[part].size();
     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
     {
-        if (!d_PK1_stress_fcn_data[part][k].fcn) continue;
+        const PK1StressFcnData& PK1_stress_fcn_data = d_PK1_stress_fcn_data[part][k];
+        if (!PK1_stress_fcn_data.isSet()) continue;
 
         // Extract the FE systems and DOF maps, and setup the FE object.
         const DofMap& F_dof_map = F_system.get_dof_map();
@@ -463,6 +603,12 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
         std::vector<const std::vector<double>*> PK1_var_data;
         std::vector<const std::vector<VectorValue<double> >*> PK1_grad_var_data;
 
+        // Per-element data for batched stress functions.
+        std::vector<TensorValue<double> > PP_batch, FF_batch;
+        std::vector<libMesh::Point> x_batch, X_batch;
+        std::vector<std::vector<const std::vector<double>*> > PK1_var_data_batch;
+        std::vector<std::vector<const std::vector<VectorValue<double> >*> > PK1_grad_var_data_batch;
+
         // Loop over the elements to compute the right-hand side vector.  This
         // is computed via
         //
@@ -488,19 +634,56 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
             fe.interpolate(elem);
             const unsigned int n_qp = qrule->n_points();
             const size_t n_basis = dphi.size();
+            if (PK1_stress_fcn_data.batch_fcn)
+            {
+                // Evaluate the stress at all of the quadrature points of the
+                // element with a single call.
+                PP_batch.resize(n_qp);
+                FF_batch.resize(n_qp);
+                x_batch.resize(n_qp);
+                X_batch.resize(n_qp);
+                PK1_var_data_batch.resize(n_qp);
+                PK1_grad_var_data_batch.resize(n_qp);
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+                    const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
+                    get_x_and_FF(x, FF, x_data, grad_x_data);
+                    x_batch[qp] = x;
+                    FF_batch[qp] = FF;
+                    X_batch[qp] = q_point[qp];
+                    fe.setInterpolatedDataPointers(
+                        PK1_var_data_batch[qp], PK1_grad_var_data_batch[qp], PK1_fcn_system_idxs, elem, qp);
+                }
+                PK1_stress_fcn_data.batch_fcn(PP_batch,
+                                              FF_batch,
+                                              x_batch,
+                                              X_batch,
+                                              elem,
+                                              PK1_var_data_batch,
+                                              PK1_grad_var_data_batch,
+                                              data_time,
+                                              PK1_stress_fcn_data.ctx);
+            }
             for (unsigned int qp = 0; qp < n_qp; ++qp)
             {
-                const libMesh::Point& X = q_point[qp];
-                const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
-                const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
-                get_x_and_FF(x, FF, x_data, grad_x_data);
-
                 // Compute the value of the first Piola-Kirchhoff stress tensor
                 // at the quadrature point and add the corresponding forces to
                 // the right-hand-side vector.
-                fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
-                d_PK1_stress_fcn_data[part][k].fcn(
-                    PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, d_PK1_stress_fcn_data[part][k].ctx);
+                if (PK1_stress_fcn_data.batch_fcn)
+                {
+                    PP = PP_batch[qp];
+                }
+                else
+                {
+                    const libMesh::Point& X = q_point[qp];
+                    const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+                    const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
+                    get_x_and_FF(x, FF, x_data, grad_x_data);
+                    fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
+                    PK1_stress_fcn_data.fcn(
+                        PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, PK1_stress_fcn_data.ctx);
+                }
                 for (unsigned int basis_n = 0; basis_n < n_basis; ++basis_n)
                 {
                     F_qp = -PP * dphi[basis_n][qp] * JxW[qp];
@@ -544,20 +727,9 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
                     // Compute the value of the first Piola-Kirchhoff stress
                     // tensor at the quadrature point and add the corresponding
                     // traction force to the right-hand-side vector.
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
-                    {
-                        fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
-                        d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                           FF,
-                                                           x,
-                                                           X,
-                                                           elem,
-                                                           PK1_var_data,
-                                                           PK1_grad_var_data,
-                                                           data_time,
-                                                           d_PK1_stress_fcn_data[part][k].ctx);
-                        F += PP * normal_face[qp];
-                    }
+                    fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
+                    PK1_stress_fcn_data.evaluate(PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time);
+                    F += PP * normal_face[qp];
 
                     n = (FF_inv_trans * normal_face[qp]).unit();
 
@@ -1003,6 +1175,45 @@ FEMechanicsBase::setup_system_vector(System& system, const std::string& vector_n
     }
 }
 
+std::string
+FEMechanicsBase::libmesh_static_restart_file_name(const std::string& restart_dump_dirname,
+                                                  unsigned int part,
+                                                  const std::string& extension)
+{
+    std::ostringstream file_name_prefix;
+    file_name_prefix << restart_dump_dirname << "/libmesh_data_part_" << part << ".static." << extension;
+    return file_name_prefix.str();
+}
+
+void
+FEMechanicsBase::readFEDataFromRestartFile(const unsigned int part)
+{
+    EquationSystems& equation_systems = *d_equation_systems[part];
+    const XdrMODE xdr_mode = (d_libmesh_restart_file_extension == "xdr" ? DECODE : READ);
+    const std::string& file_name = libmesh_restart_file_name(
+        d_libmesh_restart_read_dir, d_libmesh_restart_restore_number, part, d_libmesh_restart_file_extension);
+    if (!d_read_incremental_libmesh_restart_files)
+    {
+        const int read_mode =
+            EquationSystems::READ_HEADER | EquationSystems::READ_DATA | EquationSystems::READ_ADDITIONAL_DATA;
+        equation_systems.read(file_name,
+                              xdr_mode,
+                              read_mode,
+                              /*partition_agnostic*/ true);
+        return;
+    }
+
+    // Read the complete equation systems from the static restart file and then
+    // update the time-varying solution vectors.
+    const std::string& static_file_name =
+        libmesh_static_restart_file_name(d_libmesh_restart_read_dir, part, d_libmesh_restart_file_extension);
+    equation_systems.read(static_file_name,
+                          xdr_mode,
+                          EquationSystems::READ_HEADER | EquationSystems::READ_DATA,
+                          /*partition_agnostic*/ true);
+    read_time_varying_fe_data(equation_systems, file_name, xdr_mode);
+}
+
 std::string
 FEMechanicsBase::libmesh_restart_file_name(const std::string& restart_dump_dirname,
                                            unsigned int time_step_number,
@@ -1050,6 +1261,7 @@ FEMechanicsBase::commonConstructor(const std::string& object_name,
     d_default_quad_type_force.resize(d_meshes.size(), INVALID_Q_RULE);
     d_default_quad_order_stress.resize(d_meshes.size(), INVALID_ORDER);
     d_default_quad_order_force.resize(d_meshes.size(), INVALID_ORDER);
+    d_use_reference_quadrature_cache.resize(d_meshes.size(), false);
 
     // Initialize function data to NULL.
     d_coordinate_mapping_fcn_data.resize(d_meshes.size());
@@ -1148,6 +1360,32 @@ FEMechanicsBase::getFromInput(const Pointer<Database>& db, bool /*is_from_restar
     // Force computation settings.
     if (db->isBool("use_consistent_mass_matrix"))
         d_use_consistent_mass_matrix = db->getBool("use_consistent_mass_matrix");
+    if (db->isBool("use_matrix_free_mass_operator"))
+        d_use_matrix_free_mass_operator = db->getBool("use_matrix_free_mass_operator");
+    if (db->keyExists("use_reference_quadrature_cache"))
+    {
+        const int n_entries = db->getArraySize("use_reference_quadrature_cache");
+        if (n_entries == 1)
+        {
+            const bool use_cache = db->getBool("use_reference_quadrature_cache");
+            std::fill(d_use_reference_quadrature_cache.begin(), d_use_reference_quadrature_cache.end(), use_cache);
+        }
+        else if (n_entries == static_cast<int>(d_meshes.size()))
+        {
+            const Array<bool> use_cache = db->getBoolArray("use_reference_quadrature_cache");
+            for (unsigned int part = 0; part < d_meshes.size(); ++part)
+            {
+                d_use_reference_quadrature_cache[part] = use_cache[part];
+            }
+        }
+        else
+        {
+            TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                     << "  use_reference_quadrature_cache must contain either one entry or one "
+                                        "entry per mesh part"
+                                     << std::endl);
+        }
+    }
 
     // Restart settings.
     if (db->isString("libmesh_restart_file_extension"))
@@ -1158,6 +1396,25 @@ FEMechanicsBase::getFromInput(const Pointer<Database>& db, bool /*is_from_restar
     {
         d_libmesh_restart_file_extension = "xdr";
     }
+    if (db->keyExists("use_incremental_libmesh_restart_files"))
+        d_use_incremental_libmesh_restart_files = db->getBool("use_incremental_libmesh_restart_files");
+    if (db->keyExists("libmesh_restart_static_systems"))
+    {
+        const Array<std::string> static_systems = db->getStringArray("libmesh_restart_static_systems");
+        for (int k = 0; k < static_systems.size(); ++k)
+        {
+            const std::string& system_name = static_systems[k];
+            if (system_name == COORDS_SYSTEM_NAME || system_name == COORD_MAPPING_SYSTEM_NAME ||
+                system_name == FORCE_SYSTEM_NAME || system_name == PRESSURE_SYSTEM_NAME ||
+                system_name == VELOCITY_SYSTEM_NAME)
+            {
+                TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                         << "  libmesh_restart_static_systems may not contain the time-varying system "
+                                         << system_name << std::endl);
+            }
+            d_libmesh_restart_static_systems.insert(system_name);
+        }
+    }
 
     // Other settings.
     if (db->keyExists("do_log"))
@@ -1187,6 +1444,8 @@ FEMechanicsBase::getFromRestart()
     }
     d_use_consistent_mass_matrix = db->getBool("d_use_consistent_mass_matrix");
     d_libmesh_partitioner_type = string_to_enum<LibmeshPartitionerType>(db->getString("d_libmesh_partitioner_type"));
+    if (db->keyExists("d_use_incremental_libmesh_restart_files"))
+        d_read_incremental_libmesh_restart_files = db->getBool("d_use_incremental_libmesh_restart_files");
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
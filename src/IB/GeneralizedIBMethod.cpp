@@ -32,12 +32,15 @@
 
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
+#include "Box.h"
+#include "CellData.h"
 #include "CellVariable.h"
 #include "CoarsenSchedule.h"
 #include "GriddingAlgorithm.h"
 #include "HierarchyDataOpsReal.h"
 #include "IntVector.h"
 #include "MultiblockDataTranslator.h"
+#include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "RefineAlgorithm.h"
@@ -127,6 +130,7 @@ GeneralizedIBMethod::registerEulerianVariables()
         d_f_var = new CellVariable<NDIM, double>(d_object_name + "::f", NDIM);
         d_w_var = new CellVariable<NDIM, double>(d_object_name + "::w", NDIM);
         d_n_var = new CellVariable<NDIM, double>(d_object_name + "::n", NDIM);
+        d_uw_var = new CellVariable<NDIM, double>(d_object_name + "::uw", 2 * NDIM);
     }
     else if (u_sc_var)
     {
@@ -142,6 +146,7 @@ GeneralizedIBMethod::registerEulerianVariables()
     registerVariable(d_f_idx, d_f_var, no_ghosts, d_ib_solver->getScratchContext());
     registerVariable(d_w_idx, d_w_var, ib_ghosts, d_ib_solver->getScratchContext());
     registerVariable(d_n_idx, d_n_var, ib_ghosts, d_ib_solver->getScratchContext());
+    if (d_uw_var) registerVariable(d_uw_idx, d_uw_var, ib_ghosts, d_ib_solver->getScratchContext());
     return;
 } // registerEulerianVariables
 
@@ -248,8 +253,36 @@ GeneralizedIBMethod::interpolateVelocity(const int u_data_idx,
                                          const std::vector<Pointer<RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
                                          const double data_time)
 {
-    // Interpolate the linear velocities.
-    IBMethod::interpolateVelocity(u_data_idx, u_synch_scheds, u_ghost_fill_scheds, data_time);
+    Pointer<Variable<NDIM> > u_var = d_ib_solver->getVelocityVariable();
+    Pointer<CellVariable<NDIM, double> > u_cc_var = u_var;
+    Pointer<SideVariable<NDIM, double> > u_sc_var = u_var;
+
+    // Interpolate the linear velocities.  With cell-centered data, the linear
+    // and angular velocities are instead interpolated together below, so here
+    // we only synchronize the velocity and fill its ghost cells.
+    if (u_cc_var)
+    {
+        const int coarsest_ln = 0;
+        const int finest_ln = d_hierarchy->getFinestLevelNumber();
+        for (int ln = finest_ln; ln >= coarsest_ln; --ln)
+        {
+            if (ln < static_cast<int>(u_synch_scheds.size()) && u_synch_scheds[ln])
+            {
+                u_synch_scheds[ln]->coarsenData();
+            }
+        }
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            if (ln < static_cast<int>(u_ghost_fill_scheds.size()) && u_ghost_fill_scheds[ln])
+            {
+                u_ghost_fill_scheds[ln]->fillData(data_time);
+            }
+        }
+    }
+    else
+    {
+        IBMethod::interpolateVelocity(u_data_idx, u_synch_scheds, u_ghost_fill_scheds, data_time);
+    }
 
     // Interpolate the angular velocities.
     std::vector<Pointer<LData> >* W_data = nullptr;
@@ -270,9 +303,6 @@ GeneralizedIBMethod::interpolateVelocity(const int u_data_idx,
     }
     TBOX_ASSERT(W_data);
 
-    Pointer<Variable<NDIM> > u_var = d_ib_solver->getVelocityVariable();
-    Pointer<CellVariable<NDIM, double> > u_cc_var = u_var;
-    Pointer<SideVariable<NDIM, double> > u_sc_var = u_var;
     if (u_cc_var)
     {
         Pointer<CellVariable<NDIM, double> > w_cc_var = d_w_var;
@@ -292,12 +322,35 @@ GeneralizedIBMethod::interpolateVelocity(const int u_data_idx,
     bool* X_LE_needs_ghost_fill;
     getLECouplingPositionData(&X_LE_data, &X_LE_needs_ghost_fill, data_time);
     getVelocityHierarchyDataOps()->scale(d_w_idx, 0.5, d_w_idx);
-    d_l_data_manager->interp(d_w_idx,
-                             *W_data,
-                             *X_LE_data,
-                             std::vector<Pointer<CoarsenSchedule<NDIM> > >(),
-                             getGhostfillRefineSchedules(d_object_name + "::w"),
-                             data_time);
+    if (u_cc_var)
+    {
+        const int finest_ln = d_hierarchy->getFinestLevelNumber();
+        const std::vector<Pointer<RefineSchedule<NDIM> > >& w_ghostfill_scheds =
+            getGhostfillRefineSchedules(d_object_name + "::w");
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            w_ghostfill_scheds[ln]->fillData(data_time);
+        }
+        std::vector<Pointer<LData> >* U_data;
+        getVelocityData(&U_data, data_time);
+        interpolateCombinedVelocity(u_data_idx, *U_data, *W_data, *X_LE_data, data_time);
+        resetAnchorPointValues(*U_data, /*coarsest_ln*/ 0, finest_ln);
+        if (!MathUtilities<double>::equalEps(data_time, d_half_time))
+        {
+            std::vector<Pointer<LData> >* U_half_data;
+            getVelocityData(&U_half_data, d_half_time);
+            reinitMidpointData(d_U_current_data, d_U_new_data, *U_half_data);
+        }
+    }
+    else
+    {
+        d_l_data_manager->interp(d_w_idx,
+                                 *W_data,
+                                 *X_LE_data,
+                                 std::vector<Pointer<CoarsenSchedule<NDIM> > >(),
+                                 getGhostfillRefineSchedules(d_object_name + "::w"),
+                                 data_time);
+    }
     resetAnchorPointValues(*W_data,
                            /*coarsest_ln*/ 0,
                            /*finest_ln*/ d_hierarchy->getFinestLevelNumber());
@@ -707,6 +760,74 @@ GeneralizedIBMethod::resetLagrangianForceAndTorqueFunction(const double init_dat
     return;
 } // resetLagrangianForceAndTorqueFunction
 
+void
+GeneralizedIBMethod::interpolateCombinedVelocity(const int u_data_idx,
+                                                 std::vector<Pointer<LData> >& U_data,
+                                                 std::vector<Pointer<LData> >& W_data,
+                                                 std::vector<Pointer<LData> >& X_LE_data,
+                                                 const double data_time)
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+
+    // Pack the linear and angular velocities, including their ghost cell
+    // values, into a single patch data.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > u_data = patch->getPatchData(u_data_idx);
+            Pointer<CellData<NDIM, double> > w_data = patch->getPatchData(d_w_idx);
+            Pointer<CellData<NDIM, double> > uw_data = patch->getPatchData(d_uw_idx);
+            const Box<NDIM> copy_box = uw_data->getGhostBox() * u_data->getGhostBox() * w_data->getGhostBox();
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                uw_data->getArrayData().copyDepth(d, u_data->getArrayData(), d, copy_box);
+                uw_data->getArrayData().copyDepth(NDIM + d, w_data->getArrayData(), d, copy_box);
+            }
+        }
+    }
+
+    // Interpolate both quantities with a single pass over the Lagrangian mesh.
+    std::vector<Pointer<LData> > UW_data(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        UW_data[ln] = d_l_data_manager->getScratchLData(ln, 2 * NDIM);
+    }
+    d_l_data_manager->interp(d_uw_idx,
+                             UW_data,
+                             X_LE_data,
+                             std::vector<Pointer<CoarsenSchedule<NDIM> > >(),
+                             std::vector<Pointer<RefineSchedule<NDIM> > >(),
+                             data_time);
+
+    // Unpack the interpolated values.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        const boost::multi_array_ref<double, 2>& UW_array = *UW_data[ln]->getLocalFormVecArray();
+        boost::multi_array_ref<double, 2>& U_array = *U_data[ln]->getLocalFormVecArray();
+        boost::multi_array_ref<double, 2>& W_array = *W_data[ln]->getLocalFormVecArray();
+        const unsigned int n_local = UW_data[ln]->getLocalNodeCount();
+        for (unsigned int i = 0; i < n_local; ++i)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                U_array[i][d] = UW_array[i][d];
+                W_array[i][d] = UW_array[i][NDIM + d];
+            }
+        }
+        UW_data[ln]->restoreArrays();
+        U_data[ln]->restoreArrays();
+        W_data[ln]->restoreArrays();
+        d_l_data_manager->restoreScratchLData(UW_data[ln], ln);
+    }
+    return;
+} // interpolateCombinedVelocity
+
 void
 GeneralizedIBMethod::getFromInput(Pointer<Database> /*db*/, bool /*is_from_restart*/)
 {
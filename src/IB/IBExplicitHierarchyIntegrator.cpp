@@ -21,6 +21,8 @@
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
 #include "ibtk/CartGridFunction.h"
+#include "ibtk/DiagnosticsCollector.h"
+#include "ibtk/PerformanceMonitor.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/ibtk_enums.h"
 
@@ -88,6 +90,18 @@ IBExplicitHierarchyIntegrator::IBExplicitHierarchyIntegrator(std::string object_
     {
         if (input_db->keyExists("use_structure_predictor"))
             d_use_structure_predictor = input_db->getBool("use_structure_predictor");
+        if (input_db->keyExists("num_lagrangian_substeps"))
+            d_num_lagrangian_substeps = input_db->getInteger("num_lagrangian_substeps");
+    }
+    if (d_num_lagrangian_substeps < 1)
+    {
+        TBOX_ERROR(d_object_name << "::IBExplicitHierarchyIntegrator():\n"
+                                 << "  num_lagrangian_substeps must be positive\n");
+    }
+    if (d_num_lagrangian_substeps > 1 && d_time_stepping_type != MIDPOINT_RULE)
+    {
+        TBOX_ERROR(d_object_name << "::IBExplicitHierarchyIntegrator():\n"
+                                 << "  Lagrangian substepping requires time_stepping_type = MIDPOINT_RULE\n");
     }
 
     // Initialize object with data read from the input and restart databases.
@@ -107,6 +121,8 @@ IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double current
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
 
     // Allocate Eulerian scratch and new data.
+    allocatePatchData(d_scratch_data, current_time, coarsest_ln, finest_ln);
+    allocatePatchData(d_new_data, new_time, coarsest_ln, finest_ln);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -118,8 +134,6 @@ IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double current
             level->allocatePatchData(d_p_idx, current_time);
             level->allocatePatchData(d_q_idx, current_time);
         }
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
     }
 
     // Initialize IB data.
@@ -208,8 +222,14 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
         // intentionally blank
         break;
     case MIDPOINT_RULE:
-        if (d_enable_logging) plog << d_object_name << "::integrateHierarchy(): computing Lagrangian force\n";
-        d_ib_method_ops->computeLagrangianForce(half_time);
+        // NOTE: With Lagrangian substepping, the previous cycle has already set
+        // the midpoint force to the average force along the subcycled
+        // trajectory of the structure.
+        if (d_num_lagrangian_substeps == 1 || cycle_num == 0)
+        {
+            if (d_enable_logging) plog << d_object_name << "::integrateHierarchy(): computing Lagrangian force\n";
+            d_ib_method_ops->computeLagrangianForce(half_time);
+        }
         if (d_enable_logging)
             plog << d_object_name << "::integrateHierarchy(): spreading Lagrangian force to the Eulerian grid\n";
         d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
@@ -266,19 +286,22 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
     d_ib_method_ops->preprocessSolveFluidEquations(current_time, new_time, cycle_num);
     if (d_enable_logging)
         plog << d_object_name << "::integrateHierarchy(): solving the incompressible Navier-Stokes equations\n";
-    if (d_current_num_cycles > 1)
-    {
-        d_ins_hier_integrator->integrateHierarchy(current_time, new_time, cycle_num);
-    }
-    else
     {
+        PerformanceMonitor::ScopedRegion solve_region("INSHierarchyIntegrator::integrateHierarchy");
+        if (d_current_num_cycles > 1)
+        {
+            d_ins_hier_integrator->integrateHierarchy(current_time, new_time, cycle_num);
+        }
+        else
+        {
 #if !defined(NDEBUG)
-        TBOX_ASSERT(d_current_num_cycles == 1);
+            TBOX_ASSERT(d_current_num_cycles == 1);
 #endif
-        const int ins_num_cycles = d_ins_hier_integrator->getNumberOfCycles();
-        for (int ins_cycle_num = 0; ins_cycle_num < ins_num_cycles; ++ins_cycle_num)
-        {
-            d_ins_hier_integrator->integrateHierarchy(current_time, new_time, ins_cycle_num);
+            const int ins_num_cycles = d_ins_hier_integrator->getNumberOfCycles();
+            for (int ins_cycle_num = 0; ins_cycle_num < ins_num_cycles; ++ins_cycle_num)
+            {
+                d_ins_hier_integrator->integrateHierarchy(current_time, new_time, ins_cycle_num);
+            }
         }
     }
     d_ib_method_ops->postprocessSolveFluidEquations(current_time, new_time, cycle_num);
@@ -336,7 +359,19 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
 
     // Compute an updated prediction of the updated positions of the Lagrangian
     // structure.
-    if (d_current_num_cycles > 1 && d_current_cycle_num == 0)
+    if (d_num_lagrangian_substeps > 1)
+    {
+        if (d_enable_logging)
+            plog << d_object_name << "::integrateHierarchy(): performing " << d_num_lagrangian_substeps
+                 << " Lagrangian midpoint-rule substeps\n";
+        d_ib_method_ops->subcycledMidpointStep(d_u_idx,
+                                               getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
+                                               getGhostfillRefineSchedules(d_object_name + "::u"),
+                                               current_time,
+                                               new_time,
+                                               d_num_lagrangian_substeps);
+    }
+    else if (d_current_num_cycles > 1 && d_current_cycle_num == 0)
     {
         if (d_enable_logging)
             plog << d_object_name << "::integrateHierarchy(): performing Lagrangian forward-Euler step\n";
@@ -450,17 +485,18 @@ IBExplicitHierarchyIntegrator::postprocessIntegrateHierarchy(const double curren
             cfl_max = std::max(cfl_max, u_max * dt / dx_min);
         }
     }
-    cfl_max = SAMRAI_MPI::maxReduction(cfl_max);
-    d_regrid_cfl_estimate += cfl_max;
-    if (d_enable_logging)
-    {
-        plog << d_object_name
-             << "::postprocessIntegrateHierarchy(): CFL number = " << cfl_max << "\n"
-             << d_object_name
-             << "::postprocessIntegrateHierarchy(): estimated upper bound on IB "
-                "point displacement since last regrid = "
-             << d_regrid_cfl_estimate << "\n";
-    }
+    getDiagnosticsCollector().addContribution(
+        d_object_name + "::CFL", cfl_max, DiagnosticsCollector::MAX, [this](const double cfl) {
+            d_regrid_cfl_estimate += cfl;
+            if (d_enable_logging)
+            {
+                plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl << "\n"
+                     << d_object_name
+                     << "::postprocessIntegrateHierarchy(): estimated upper bound on IB "
+                        "point displacement since last regrid = "
+                     << d_regrid_cfl_estimate << "\n";
+            }
+        });
 
     // Deallocate the fluid solver.
     const int ins_num_cycles = d_ins_hier_integrator->getNumberOfCycles();
@@ -265,67 +265,26 @@ IBFEDirectForcingKinematics::forwardEulerStep(double current_time,
 
     // Rotate the body with current rotational velocity about center of mass
     // and translate the body to predicted position.
-    EquationSystems* equation_systems = d_ibfe_method_ops->getFEDataManager(d_part)->getEquationSystems();
-    System& X_system = equation_systems->get_system(IBFEMethod::COORDS_SYSTEM_NAME);
-    const unsigned int X_sys_num = X_system.number();
-
-    MeshBase& mesh = equation_systems->get_mesh();
-    const unsigned int total_local_nodes = mesh.n_nodes_on_proc(SAMRAI_MPI::getRank());
-    std::vector<std::vector<numeric_index_type> > nodal_X_indices(NDIM);
-    std::vector<std::vector<double> > nodal_X0_values(NDIM);
-    for (unsigned int d = 0; d < NDIM; ++d)
-    {
-        nodal_X_indices[d].reserve(total_local_nodes);
-        nodal_X0_values[d].reserve(total_local_nodes);
-    }
-
-    IBFEMethod::CoordinateMappingFcnData mapping = d_ibfe_method_ops->getInitialCoordinateMappingFunction(d_part);
-    const bool identity_mapping = !(mapping.fcn);
-    auto it = mesh.local_nodes_begin();
-    const auto end_it = mesh.local_nodes_end();
-    for (; it != end_it; ++it)
-    {
-        const Node* const n = *it;
-        const libMesh::Point& s = *n;
-        libMesh::Point X0 = s;
-        if (!identity_mapping)
-        {
-            mapping.fcn(X0, s, mapping.ctx);
-        }
-        if (n->n_vars(X_sys_num))
-        {
-#if !defined(NDEBUG)
-            TBOX_ASSERT(n->n_vars(X_sys_num) == NDIM);
-#endif
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                nodal_X_indices[d].push_back(n->dof_number(X_sys_num, d, 0));
-                nodal_X0_values[d].push_back(X0(d));
-            }
-        }
-    }
-
-    for (unsigned int k = 0; k < total_local_nodes; ++k)
+    updateReferenceMeshData();
+    const auto num_local_nodes = static_cast<unsigned int>(d_node_dr.size());
+    for (unsigned int k = 0; k < num_local_nodes; ++k)
     {
-        Eigen::Vector3d dr = Eigen::Vector3d::Zero();
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            dr[d] = nodal_X0_values[d][k] - d_center_of_mass_initial[d];
-        }
+        const Eigen::Vector3d& dr = d_node_dr[k];
 
         // Rotate dr vector using the rotation matrix.
         const Eigen::Vector3d Rxdr_half = rotation_mat_half * dr;
         const Eigen::Vector3d Rxdr_new = rotation_mat_new * dr;
         for (unsigned int d = 0; d < NDIM; ++d)
         {
-            X_half_petsc.set(nodal_X_indices[d][k],
+            X_half_petsc.set(d_node_X_dofs[NDIM * k + d],
                              d_center_of_mass_current[d] + Rxdr_half[d] + 0.5 * dt * d_trans_vel_current[d]);
-            X_new_petsc.set(nodal_X_indices[d][k],
+            X_new_petsc.set(d_node_X_dofs[NDIM * k + d],
                             d_center_of_mass_current[d] + Rxdr_new[d] + dt * d_trans_vel_current[d]);
         }
     }
     X_half_petsc.close();
     X_new_petsc.close();
+    d_rotation_mat_half = rotation_mat_half;
 
     // Compute the COM at mid-step and new time.
     d_center_of_mass_half = d_center_of_mass_current + 0.5 * dt * d_trans_vel_current;
@@ -349,64 +308,24 @@ IBFEDirectForcingKinematics::midpointStep(double current_time,
 
     // Rotate the body with current rotational velocity about center of mass
     // and translate the body to predicted position.
-    EquationSystems* equation_systems = d_ibfe_method_ops->getFEDataManager(d_part)->getEquationSystems();
-    System& X_system = equation_systems->get_system(IBFEMethod::COORDS_SYSTEM_NAME);
-    const unsigned int X_sys_num = X_system.number();
-
-    MeshBase& mesh = equation_systems->get_mesh();
-    const unsigned int total_local_nodes = mesh.n_nodes_on_proc(SAMRAI_MPI::getRank());
-    std::vector<std::vector<numeric_index_type> > nodal_X_indices(NDIM);
-    std::vector<std::vector<double> > nodal_X0_values(NDIM);
-    for (unsigned int d = 0; d < NDIM; ++d)
-    {
-        nodal_X_indices[d].reserve(total_local_nodes);
-        nodal_X0_values[d].reserve(total_local_nodes);
-    }
-
-    IBFEMethod::CoordinateMappingFcnData mapping = d_ibfe_method_ops->getInitialCoordinateMappingFunction(d_part);
-    const bool identity_mapping = !(mapping.fcn);
-    auto it = mesh.local_nodes_begin();
-    const auto end_it = mesh.local_nodes_end();
-    for (; it != end_it; ++it)
-    {
-        const Node* const n = *it;
-        const libMesh::Point& s = *n;
-        libMesh::Point X0 = s;
-        if (!identity_mapping)
-        {
-            mapping.fcn(X0, s, mapping.ctx);
-        }
-        if (n->n_vars(X_sys_num))
-        {
-#if !defined(NDEBUG)
-            TBOX_ASSERT(n->n_vars(X_sys_num) == NDIM);
-#endif
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                nodal_X_indices[d].push_back(n->dof_number(X_sys_num, d, 0));
-                nodal_X0_values[d].push_back(X0(d));
-            }
-        }
-    }
-
-    for (unsigned int k = 0; k < total_local_nodes; ++k)
+    updateReferenceMeshData();
+    const auto num_local_nodes = static_cast<unsigned int>(d_node_dr.size());
+    for (unsigned int k = 0; k < num_local_nodes; ++k)
     {
-        Eigen::Vector3d dr = Eigen::Vector3d::Zero();
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            dr[d] = nodal_X0_values[d][k] - d_center_of_mass_initial[d];
-        }
+        const Eigen::Vector3d& dr = d_node_dr[k];
 
         // Rotate dr vector using the rotation matrix.
         const Eigen::Vector3d Rxdr = rotation_mat * dr;
         for (unsigned int d = 0; d < NDIM; ++d)
         {
-            X_half_petsc.set(nodal_X_indices[d][k], d_center_of_mass_current[d] + Rxdr[d] + dt * d_trans_vel_half[d]);
+            X_half_petsc.set(d_node_X_dofs[NDIM * k + d],
+                             d_center_of_mass_current[d] + Rxdr[d] + dt * d_trans_vel_half[d]);
         }
     }
     X_half_petsc.close();
     X_new_petsc = X_half_petsc;
     X_new_petsc.close();
+    d_rotation_mat_half = rotation_mat;
 
     // Move and rotate the structure.
     d_center_of_mass_half = d_center_of_mass_current + dt * d_trans_vel_half;
@@ -696,48 +615,142 @@ IBFEDirectForcingKinematics::computeMOIOfStructure(Eigen::Matrix3d& I, const Eig
 } // computeMOIOfStructure
 
 void
-IBFEDirectForcingKinematics::computeImposedLagrangianForceDensity(PetscVector<double>& F_petsc,
-                                                                  PetscVector<double>& X_petsc,
-                                                                  PetscVector<double>& U_petsc,
-                                                                  const double /*data_time*/)
+IBFEDirectForcingKinematics::updateReferenceMeshData()
 {
-    const Eigen::Vector3d& X_com = d_center_of_mass_half;
     EquationSystems* equation_systems = d_ibfe_method_ops->getFEDataManager(d_part)->getEquationSystems();
-    System& X_system = equation_systems->get_system(IBFEMethod::COORDS_SYSTEM_NAME);
-    System& U_system = equation_systems->get_system(IBFEMethod::VELOCITY_SYSTEM_NAME);
-    const unsigned int X_sys_num = X_system.number();
-    const unsigned int U_sys_num = U_system.number();
-
     MeshBase& mesh = equation_systems->get_mesh();
-    const unsigned int total_local_nodes = mesh.n_nodes_on_proc(SAMRAI_MPI::getRank());
-    std::vector<std::vector<numeric_index_type> > nodal_indices(NDIM);
-    std::vector<std::vector<double> > nodal_X_values(NDIM);
-    for (unsigned int d = 0; d < NDIM; ++d)
+    const unsigned int dim = mesh.mesh_dimension();
+
+    // Determine whether the active local elements have changed.
+    std::vector<unsigned int> elem_ids;
+    const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
+    const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
+    for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
     {
-        nodal_indices[d].reserve(total_local_nodes);
-        nodal_X_values[d].resize(total_local_nodes);
+        elem_ids.push_back((*el_it)->id());
     }
+    if (d_ref_mesh_data_initialized && elem_ids == d_ref_elem_ids) return;
+    d_ref_elem_ids.swap(elem_ids);
+    d_ref_mesh_data_initialized = true;
+
+    System& X_system = equation_systems->get_system(IBFEMethod::COORDS_SYSTEM_NAME);
+    System& U_system = equation_systems->get_system(IBFEMethod::VELOCITY_SYSTEM_NAME);
+    const unsigned int X_sys_num = X_system.number();
+    IBFEMethod::CoordinateMappingFcnData mapping = d_ibfe_method_ops->getInitialCoordinateMappingFunction(d_part);
+    const bool identity_mapping = !(mapping.fcn);
+    auto get_initial_displacement = [&](const libMesh::Point& s) {
+        libMesh::Point X0 = s;
+        if (!identity_mapping)
+        {
+            mapping.fcn(X0, s, mapping.ctx);
+        }
+        Eigen::Vector3d dr = Eigen::Vector3d::Zero();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            dr[d] = X0(d) - d_center_of_mass_initial[d];
+        }
+        return dr;
+    };
 
+    // Store the position DOF indices and the initial displacements of the
+    // local nodes.
+    d_node_X_dofs.clear();
+    d_node_dr.clear();
     auto it = mesh.local_nodes_begin();
     const auto end_it = mesh.local_nodes_end();
     for (; it != end_it; ++it)
     {
         const Node* const n = *it;
-        if (n->n_vars(X_sys_num) && n->n_vars(U_sys_num))
+        if (n->n_vars(X_sys_num))
         {
 #if !defined(NDEBUG)
-            TBOX_ASSERT(n->n_vars(X_sys_num) == NDIM && n->n_vars(U_sys_num) == NDIM);
+            TBOX_ASSERT(n->n_vars(X_sys_num) == NDIM);
 #endif
             for (unsigned int d = 0; d < NDIM; ++d)
             {
-                nodal_indices[d].push_back(n->dof_number(X_sys_num, d, 0));
+                d_node_X_dofs.push_back(n->dof_number(X_sys_num, d, 0));
+            }
+            d_node_dr.push_back(get_initial_displacement(*n));
+        }
+    }
+
+    // Compute the integrals of the nodal basis functions and of the nodal
+    // basis functions times the initial displacements over the active local
+    // elements.
+    d_elem_node_U_dofs.clear();
+    d_elem_node_vol.clear();
+    d_elem_node_moment.clear();
+    DofMap& U_dof_map = U_system.get_dof_map();
+    std::vector<std::vector<unsigned int> > U_dof_indices(NDIM);
+    FEType fe_type = U_dof_map.variable_type(0);
+    std::unique_ptr<QBase> qrule = fe_type.default_quadrature_rule(dim);
+    std::unique_ptr<FEBase> fe(FEBase::build(dim, fe_type));
+    fe->attach_quadrature_rule(qrule.get());
+    const std::vector<double>& JxW = fe->get_JxW();
+    const std::vector<std::vector<double> >& phi = fe->get_phi();
+    std::vector<Eigen::Vector3d> dr_node;
+    for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+    {
+        const Elem* const elem = *el_it;
+        fe->reinit(elem);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            U_dof_map.dof_indices(elem, U_dof_indices[d], d);
+        }
+        const std::size_t n_basis = U_dof_indices[0].size();
+        dr_node.resize(n_basis);
+        for (unsigned int k = 0; k < n_basis; ++k)
+        {
+            dr_node[k] = get_initial_displacement(elem->point(k));
+        }
+        const std::size_t offset = d_elem_node_vol.size();
+        d_elem_node_vol.resize(offset + n_basis, 0.0);
+        d_elem_node_moment.resize(offset + n_basis, Eigen::Vector3d::Zero());
+        const unsigned int n_qp = qrule->n_points();
+        for (unsigned int qp = 0; qp < n_qp; ++qp)
+        {
+            Eigen::Vector3d dr_qp = Eigen::Vector3d::Zero();
+            for (unsigned int k = 0; k < n_basis; ++k)
+            {
+                dr_qp += phi[k][qp] * dr_node[k];
+            }
+            for (unsigned int k = 0; k < n_basis; ++k)
+            {
+                d_elem_node_vol[offset + k] += phi[k][qp] * JxW[qp];
+                d_elem_node_moment[offset + k] += phi[k][qp] * JxW[qp] * dr_qp;
+            }
+        }
+        for (unsigned int k = 0; k < n_basis; ++k)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                d_elem_node_U_dofs.push_back(U_dof_indices[d][k]);
             }
         }
     }
+    return;
+} // updateReferenceMeshData
 
+void
+IBFEDirectForcingKinematics::computeImposedLagrangianForceDensity(PetscVector<double>& F_petsc,
+                                                                  PetscVector<double>& X_petsc,
+                                                                  PetscVector<double>& U_petsc,
+                                                                  const double /*data_time*/)
+{
+    const Eigen::Vector3d& X_com = d_center_of_mass_half;
+    updateReferenceMeshData();
+    const auto total_local_nodes = static_cast<unsigned int>(d_node_dr.size());
+    std::vector<std::vector<numeric_index_type> > nodal_indices(NDIM);
+    std::vector<std::vector<double> > nodal_X_values(NDIM);
     for (unsigned int d = 0; d < NDIM; ++d)
     {
-        X_petsc.get(nodal_indices[d], &nodal_X_values[d][0]);
+        nodal_indices[d].resize(total_local_nodes);
+        nodal_X_values[d].resize(total_local_nodes);
+        for (unsigned int k = 0; k < total_local_nodes; ++k)
+        {
+            nodal_indices[d][k] = d_node_X_dofs[NDIM * k + d];
+        }
+        if (total_local_nodes) X_petsc.get(nodal_indices[d], &nodal_X_values[d][0]);
     }
 
     // Set the cross-product matrix
@@ -788,38 +801,18 @@ IBFEDirectForcingKinematics::computeMixedLagrangianForceDensity(PetscVector<doub
                                                                 PetscVector<double>& U_petsc,
                                                                 const double data_time)
 {
-    const Eigen::Vector3d& X_com = d_center_of_mass_half;
-
-    // Get FE objects.
-    EquationSystems* equation_systems = d_ibfe_method_ops->getFEDataManager(d_part)->getEquationSystems();
-    MeshBase& mesh = equation_systems->get_mesh();
-    const unsigned int dim = mesh.mesh_dimension();
-
-    // Extract the FE system and DOF map, and setup the FE object.
-    System& X_system = equation_systems->get_system(IBFEMethod::COORDS_SYSTEM_NAME);
-    System& U_system = equation_systems->get_system(IBFEMethod::VELOCITY_SYSTEM_NAME);
-    DofMap& X_dof_map = X_system.get_dof_map();
-    DofMap& U_dof_map = U_system.get_dof_map();
-    std::vector<std::vector<unsigned int> > U_dof_indices(NDIM);
-    std::vector<std::vector<unsigned int> > X_dof_indices(NDIM);
-    FEType fe_type = U_dof_map.variable_type(0);
-    std::unique_ptr<QBase> qrule = fe_type.default_quadrature_rule(dim);
-    std::unique_ptr<FEBase> fe_autoptr(FEBase::build(dim, fe_type));
-    FEBase* fe = fe_autoptr.get();
-    fe->attach_quadrature_rule(qrule.get());
-    const std::vector<double>& JxW = fe->get_JxW();
-    const std::vector<std::vector<double> >& phi = fe->get_phi();
+    // Compute the linear and angular momentum of the structure.
+    //
+    // NOTE: The positions at the midpoint of the time step are obtained by
+    // rigidly rotating the initial configuration about the center of mass and
+    // translating it, so that X - X_com = R * dr with R = d_rotation_mat_half.
+    // The angular momentum is therefore computed from the integrals of the
+    // basis functions and of the initial displacements that are precomputed
+    // in the reference configuration, and the velocity at the nodes.
+    updateReferenceMeshData();
+    const Eigen::Matrix3d& R_half = d_rotation_mat_half;
 
     int ierr;
-    X_petsc.close();
-    Vec X_global_vec = X_petsc.vec();
-    Vec X_local_ghost_vec;
-    ierr = VecGhostGetLocalForm(X_global_vec, &X_local_ghost_vec);
-    IBTK_CHKERRQ(ierr);
-    double* X_local_ghost_soln;
-    ierr = VecGetArray(X_local_ghost_vec, &X_local_ghost_soln);
-    IBTK_CHKERRQ(ierr);
-
     U_petsc.close();
     Vec U_global_vec = U_petsc.vec();
     Vec U_local_ghost_vec;
@@ -831,52 +824,23 @@ IBFEDirectForcingKinematics::computeMixedLagrangianForceDensity(PetscVector<doub
 
     Eigen::Vector3d L = Eigen::Vector3d::Zero();
     Eigen::Vector3d F = Eigen::Vector3d::Zero();
-    boost::multi_array<double, 2> X_node, U_node;
-    double X_qp[NDIM], U_qp[NDIM];
+    Eigen::Vector3d U_node = Eigen::Vector3d::Zero();
     double vol_mesh = 0.0;
-    const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
-    const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
-    for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+    const auto num_elem_nodes = static_cast<unsigned int>(d_elem_node_vol.size());
+    for (unsigned int k = 0; k < num_elem_nodes; ++k)
     {
-        const Elem* const elem = *el_it;
-        fe->reinit(elem);
         for (unsigned int d = 0; d < NDIM; ++d)
         {
-            X_dof_map.dof_indices(elem, X_dof_indices[d], d);
-            U_dof_map.dof_indices(elem, U_dof_indices[d], d);
-        }
-        get_values_for_interpolation(U_node, U_petsc, U_local_ghost_soln, U_dof_indices);
-        get_values_for_interpolation(X_node, X_petsc, X_local_ghost_soln, X_dof_indices);
-
-        const unsigned int n_qp = qrule->n_points();
-        for (unsigned int qp = 0; qp < n_qp; ++qp)
-        {
-            interpolate(X_qp, qp, X_node, phi);
-            interpolate(U_qp, qp, U_node, phi);
-
-            vol_mesh += JxW[qp];
-            for (int d = 0; d < NDIM; ++d)
-            {
-                F[d] += U_qp[d] * JxW[qp];
-            }
-
-#if (NDIM == 2)
-            L[2] += (U_qp[1] * (X_qp[0] - X_com[0]) - U_qp[0] * (X_qp[1] - X_com[1])) * JxW[qp];
-#elif (NDIM == 3)
-            L[0] += (U_qp[2] * (X_qp[1] - X_com[1]) - U_qp[1] * (X_qp[2] - X_com[2])) * JxW[qp];
-            L[1] += (U_qp[0] * (X_qp[2] - X_com[2]) - U_qp[2] * (X_qp[0] - X_com[0])) * JxW[qp];
-            L[2] += (U_qp[1] * (X_qp[0] - X_com[0]) - U_qp[0] * (X_qp[1] - X_com[1])) * JxW[qp];
-#endif
+            U_node[d] = U_local_ghost_soln[U_petsc.map_global_to_local_index(d_elem_node_U_dofs[NDIM * k + d])];
         }
+        vol_mesh += d_elem_node_vol[k];
+        F += d_elem_node_vol[k] * U_node;
+        L += (R_half * d_elem_node_moment[k]).cross(U_node);
     }
     SAMRAI_MPI::sumReduction(&F[0], 3);
     SAMRAI_MPI::sumReduction(&L[0], 3);
     vol_mesh = SAMRAI_MPI::sumReduction(vol_mesh);
 
-    ierr = VecRestoreArray(X_local_ghost_vec, &X_local_ghost_soln);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecGhostRestoreLocalForm(X_global_vec, &X_local_ghost_vec);
-    IBTK_CHKERRQ(ierr);
     ierr = VecRestoreArray(U_local_ghost_vec, &U_local_ghost_soln);
     IBTK_CHKERRQ(ierr);
     ierr = VecGhostRestoreLocalForm(U_global_vec, &U_local_ghost_vec);
@@ -24,11 +24,10 @@
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/ibtk_utilities.h"
 
-#include "BasePatchLevel.h"
 #include "Box.h"
 #include "BoxArray.h"
+#include "BoxTree.h"
 #include "CartesianGridGeometry.h"
-#include "CartesianPatchGeometry.h"
 #include "CellData.h"
 #include "CellIndex.h"
 #include "Index.h"
@@ -36,6 +35,7 @@
 #include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "ProcessorMapping.h"
 #include "SideData.h"
 #include "SideIndex.h"
 #include "tbox/Array.h"
@@ -107,190 +107,65 @@ namespace IBAMR
 
 namespace
 {
-double
-linear_interp(const Vector& X,
-              const hier::Index<NDIM>& i_cell,
-              const Vector& X_cell,
-              const CellData<NDIM, double>& v,
-              const hier::Index<NDIM>& /*patch_lower*/,
-              const hier::Index<NDIM>& /*patch_upper*/,
-              const double* const /*x_lower*/,
-              const double* const /*x_upper*/,
-              const double* const dx)
+// Compute the lower index and the weights of the lower points in each
+// direction of the (bi/tri)linear interpolation stencil of the point X in cell
+// i, with center X_cell, for values at the cell centers (axis == NDIM) or at
+// the lower cell faces normal to axis.
+void
+compute_interp_stencil(hier::Index<NDIM>& lower,
+                       Vector& wgt,
+                       const Vector& X,
+                       const hier::Index<NDIM>& i,
+                       const Vector& X_cell,
+                       const double* const dx,
+                       const unsigned int axis)
 {
-    std::array<bool, NDIM> is_lower;
     for (unsigned int d = 0; d < NDIM; ++d)
     {
-        is_lower[d] = X[d] < X_cell[d];
-    }
-    double U = 0.0;
-#if (NDIM == 3)
-    for (int i_shift2 = (is_lower[2] ? -1 : 0); i_shift2 <= (is_lower[2] ? 0 : 1); ++i_shift2)
-    {
-#endif
-        for (int i_shift1 = (is_lower[1] ? -1 : 0); i_shift1 <= (is_lower[1] ? 0 : 1); ++i_shift1)
+        double X_lower;
+        if (d == axis)
         {
-            for (int i_shift0 = (is_lower[0] ? -1 : 0); i_shift0 <= (is_lower[0] ? 0 : 1); ++i_shift0)
-            {
-                const Vector X_center(X_cell[0] + static_cast<double>(i_shift0) * dx[0],
-                                      X_cell[1] + static_cast<double>(i_shift1) * dx[1]
-#if (NDIM == 3)
-                                      ,
-                                      X_cell[2] + static_cast<double>(i_shift2) * dx[2]
-#endif
-                );
-                const double wgt =
-                    (((X[0] < X_center[0] ? X[0] - (X_center[0] - dx[0]) : (X_center[0] + dx[0]) - X[0]) / dx[0]) *
-                     ((X[1] < X_center[1] ? X[1] - (X_center[1] - dx[1]) : (X_center[1] + dx[1]) - X[1]) / dx[1])
-#if (NDIM == 3)
-                     * ((X[2] < X_center[2] ? X[2] - (X_center[2] - dx[2]) : (X_center[2] + dx[2]) - X[2]) / dx[2])
-#endif
-                    );
-                const hier::Index<NDIM> i(i_shift0 + i_cell(0),
-                                          i_shift1 + i_cell(1)
-#if (NDIM == 3)
-                                              ,
-                                          i_shift2 + i_cell(2)
-#endif
-                );
-                const CellIndex<NDIM> i_c(i);
-                U += v(i_c) * wgt;
-            }
+            lower(d) = i(d);
+            X_lower = X_cell[d] - 0.5 * dx[d];
         }
-#if (NDIM == 3)
-    }
-#endif
-    return U;
-}
-
-template <int N>
-Eigen::Matrix<double, N, 1>
-linear_interp(const Vector& X,
-              const hier::Index<NDIM>& i_cell,
-              const Vector& X_cell,
-              const CellData<NDIM, double>& v,
-              const hier::Index<NDIM>& /*patch_lower*/,
-              const hier::Index<NDIM>& /*patch_upper*/,
-              const double* const /*x_lower*/,
-              const double* const /*x_upper*/,
-              const double* const dx)
-{
-#if !defined(NDEBUG)
-    TBOX_ASSERT(v.getDepth() == N);
-#endif
-    std::array<bool, NDIM> is_lower;
-    for (unsigned int d = 0; d < NDIM; ++d)
-    {
-        is_lower[d] = X[d] < X_cell[d];
-    }
-    Eigen::Matrix<double, N, 1> U(Eigen::Matrix<double, N, 1>::Zero());
-#if (NDIM == 3)
-    for (int i_shift2 = (is_lower[2] ? -1 : 0); i_shift2 <= (is_lower[2] ? 0 : 1); ++i_shift2)
-    {
-#endif
-        for (int i_shift1 = (is_lower[1] ? -1 : 0); i_shift1 <= (is_lower[1] ? 0 : 1); ++i_shift1)
+        else if (X[d] < X_cell[d])
         {
-            for (int i_shift0 = (is_lower[0] ? -1 : 0); i_shift0 <= (is_lower[0] ? 0 : 1); ++i_shift0)
-            {
-                const Vector X_center(X_cell[0] + static_cast<double>(i_shift0) * dx[0],
-                                      X_cell[1] + static_cast<double>(i_shift1) * dx[1]
-#if (NDIM == 3)
-                                      ,
-                                      X_cell[2] + static_cast<double>(i_shift2) * dx[2]
-#endif
-                );
-                const double wgt =
-                    (((X[0] < X_center[0] ? X[0] - (X_center[0] - dx[0]) : (X_center[0] + dx[0]) - X[0]) / dx[0]) *
-                     ((X[1] < X_center[1] ? X[1] - (X_center[1] - dx[1]) : (X_center[1] + dx[1]) - X[1]) / dx[1])
-#if (NDIM == 3)
-                     * ((X[2] < X_center[2] ? X[2] - (X_center[2] - dx[2]) : (X_center[2] + dx[2]) - X[2]) / dx[2])
-#endif
-                    );
-                const hier::Index<NDIM> i(i_shift0 + i_cell(0),
-                                          i_shift1 + i_cell(1)
-#if (NDIM == 3)
-                                              ,
-                                          i_shift2 + i_cell(2)
-#endif
-                );
-                const CellIndex<NDIM> i_c(i);
-                for (int k = 0; k < N; ++k)
-                {
-                    U[k] += v(i_c, k) * wgt;
-                }
-            }
+            lower(d) = i(d) - 1;
+            X_lower = X_cell[d] - dx[d];
         }
-#if (NDIM == 3)
+        else
+        {
+            lower(d) = i(d);
+            X_lower = X_cell[d];
+        }
+        wgt[d] = (X_lower + dx[d] - X[d]) / dx[d];
     }
-#endif
-    return U;
 }
 
-Vector
-linear_interp(const Vector& X,
-              const hier::Index<NDIM>& i_cell,
-              const Vector& X_cell,
-              const SideData<NDIM, double>& v,
-              const hier::Index<NDIM>& /*patch_lower*/,
-              const hier::Index<NDIM>& /*patch_upper*/,
-              const double* const /*x_lower*/,
-              const double* const /*x_upper*/,
-              const double* const dx)
+// Interpolate values with a stencil computed by compute_interp_stencil(), in
+// which v returns the value at a given index.
+template <class ValueFcn>
+double
+apply_interp_stencil(const hier::Index<NDIM>& lower, const Vector& wgt, ValueFcn v)
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(v.getDepth() == 1);
-#endif
-    Vector U(Vector::Zero());
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    double U = 0.0;
+    for (int corner = 0; corner < (1 << NDIM); ++corner)
     {
-        std::array<bool, NDIM> is_lower;
+        hier::Index<NDIM> i = lower;
+        double w = 1.0;
         for (unsigned int d = 0; d < NDIM; ++d)
         {
-            if (d == axis)
+            if (corner & (1 << d))
             {
-                is_lower[d] = false;
+                i(d) += 1;
+                w *= 1.0 - wgt[d];
             }
             else
             {
-                is_lower[d] = X[d] < X_cell[d];
-            }
-        }
-#if (NDIM == 3)
-        for (int i_shift2 = (is_lower[2] ? -1 : 0); i_shift2 <= (is_lower[2] ? 0 : 1); ++i_shift2)
-        {
-#endif
-            for (int i_shift1 = (is_lower[1] ? -1 : 0); i_shift1 <= (is_lower[1] ? 0 : 1); ++i_shift1)
-            {
-                for (int i_shift0 = (is_lower[0] ? -1 : 0); i_shift0 <= (is_lower[0] ? 0 : 1); ++i_shift0)
-                {
-                    const Vector X_side(X_cell[0] + (static_cast<double>(i_shift0) + (axis == 0 ? -0.5 : 0.0)) * dx[0],
-                                        X_cell[1] + (static_cast<double>(i_shift1) + (axis == 1 ? -0.5 : 0.0)) * dx[1]
-#if (NDIM == 3)
-                                        ,
-                                        X_cell[2] + (static_cast<double>(i_shift2) + (axis == 2 ? -0.5 : 0.0)) * dx[2]
-#endif
-                    );
-                    const double wgt =
-                        (((X[0] < X_side[0] ? X[0] - (X_side[0] - dx[0]) : (X_side[0] + dx[0]) - X[0]) / dx[0]) *
-                         ((X[1] < X_side[1] ? X[1] - (X_side[1] - dx[1]) : (X_side[1] + dx[1]) - X[1]) / dx[1])
-#if (NDIM == 3)
-                         * ((X[2] < X_side[2] ? X[2] - (X_side[2] - dx[2]) : (X_side[2] + dx[2]) - X[2]) / dx[2])
-#endif
-                        );
-                    const hier::Index<NDIM> i(i_shift0 + i_cell(0),
-                                              i_shift1 + i_cell(1)
-#if (NDIM == 3)
-                                                  ,
-                                              i_shift2 + i_cell(2)
-#endif
-                    );
-                    const SideIndex<NDIM> i_s(i, axis, SideIndex<NDIM>::Lower);
-                    U[axis] += v(i_s) * wgt;
-                }
+                w *= wgt[d];
             }
-#if (NDIM == 3)
         }
-#endif
+        U += w * v(i);
     }
     return U;
 }
@@ -361,6 +236,10 @@ IBFEInstrumentPanel::initializeHierarchyIndependentData(IBFEMethod* ib_method_op
     d_num_nodes.resize(d_num_meters);
     d_mean_pressure_values.resize(d_num_meters);
     d_flow_values.resize(d_num_meters);
+    d_meter_dX_dofs.resize(d_num_meters);
+    d_meter_quad_rules.resize(d_num_meters);
+    d_meter_qp_xyz_current.resize(d_num_meters);
+    d_flux_correction_weights.resize(d_num_meters);
     temp_node_dof_IDs.resize(d_num_meters);
     temp_node_dof_ID_sets.resize(d_num_meters);
     temp_nodes.resize(d_num_meters);
@@ -508,6 +387,51 @@ IBFEInstrumentPanel::initializeHierarchyIndependentData(IBFEMethod* ib_method_op
             d_U_dof_idx[jj].push_back(U_dof_index);
         }
     }
+    // the flow through a meter is corrected by the flow due to the motion of
+    // the meter, which is a linear function of the velocity dofs of the meter
+    // mesh whose coefficients only depend on the reference configuration.
+    for (unsigned int jj = 0; jj < d_num_meters; ++jj)
+    {
+        const LinearImplicitSystem& velocity_sys =
+            d_meter_systems[jj]->get_system<LinearImplicitSystem>(IBFEMethod::VELOCITY_SYSTEM_NAME);
+        const DofMap& dof_map = velocity_sys.get_dof_map();
+        FEType fe_type = velocity_sys.variable_type(0);
+
+        // set up FE objects
+        std::unique_ptr<FEBase> fe_elem(FEBase::build(NDIM - 1, fe_type));
+        QGauss qrule(NDIM - 1, fe_type.default_quadrature_order());
+        fe_elem->attach_quadrature_rule(&qrule);
+        const std::vector<Real>& JxW = fe_elem->get_JxW();
+        const std::vector<std::vector<Real> >& phi = fe_elem->get_phi();
+        std::vector<dof_id_type> dof_indices;
+
+        std::map<dof_id_type, double> weights;
+        MeshBase::const_element_iterator el = d_meter_meshes[jj]->active_local_elements_begin();
+        const MeshBase::const_element_iterator end_el = d_meter_meshes[jj]->active_local_elements_end();
+        for (; el != end_el; ++el)
+        {
+            const Elem* elem = *el;
+            fe_elem->reinit(elem);
+
+            // compute normal vector to element
+            const libMesh::Point tau1 = *elem->node_ptr(1) - *elem->node_ptr(0);
+            const libMesh::Point tau2 = *elem->node_ptr(2) - *elem->node_ptr(1);
+            const libMesh::Point normal = (tau1.cross(tau2)).unit();
+
+            for (unsigned int d = 0; d < NDIM; ++d) // here d is the "variable number"
+            {
+                dof_map.dof_indices(elem, dof_indices, d);
+                for (unsigned int qp = 0; qp < JxW.size(); ++qp)
+                {
+                    for (unsigned int nn = 0; nn < dof_indices.size(); ++nn)
+                    {
+                        weights[dof_indices[nn]] += phi[nn][qp] * normal(d) * JxW[qp];
+                    }
+                }
+            }
+        }
+        d_flux_correction_weights[jj].assign(weights.begin(), weights.end());
+    }
     d_initialized = true;
 }
 
@@ -521,14 +445,27 @@ IBFEInstrumentPanel::initializeHierarchyDependentData(IBFEMethod* ib_method_ops,
     }
     if (d_num_meters == 0) return;
 
+    // get the coordinate mapping system and velocity systems for the parent
+    // mesh, once for all meters.
+    // \todo: find a better way to do this
+    const FEDataManager* fe_data_manager = ib_method_ops->getFEDataManager(d_part);
+    const EquationSystems* equation_systems = fe_data_manager->getEquationSystems();
+    std::vector<double> dX_coords_parent;
+    equation_systems->get_system(IBFEMethod::COORD_MAPPING_SYSTEM_NAME).update_global_solution(dX_coords_parent);
+    std::vector<double> U_coords_parent;
+    equation_systems->get_system(IBFEMethod::VELOCITY_SYSTEM_NAME).update_global_solution(U_coords_parent);
+
     // loop over meters, update system data, and get the maximum
     // radius for each meter in this FE part.
     // the radius of a meter is defined to be the largest distance
     // from the centroid to a node.
+    // the quadrature points of a meter only need to be located again if the
+    // meter has moved.
+    std::vector<bool> relocate_meter(d_num_meters);
     for (unsigned int jj = 0; jj < d_num_meters; ++jj)
     {
         // update FE system data for meter_mesh
-        initializeSystemDependentData(ib_method_ops, jj);
+        relocate_meter[jj] = initializeSystemDependentData(U_coords_parent, dX_coords_parent, jj);
     }
 
     // get info about levels in AMR mesh
@@ -567,124 +504,123 @@ IBFEInstrumentPanel::initializeHierarchyDependentData(IBFEMethod* ib_method_ops,
                          << " there may be undefined behavior in casting to this"
                          << " Order in older versions of libMesh.");
         }
+        // the quadrature rule only needs to be rebuilt if its order changes
+        if (d_quad_order[jj] != d_meter_quad_rules[jj].order)
+        {
+            buildMeterQuadRule(jj);
+            relocate_meter[jj] = true;
+        }
     }
 
-    // reset the quad point maps
-    d_quad_point_map.clear();
-    d_quad_point_map.resize(finest_ln + 1);
-
-    // loop over levels and assign each quadrature point to one level
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    // the quadrature points also need to be located again if the patch
+    // hierarchy has changed.
+    bool hierarchy_changed = static_cast<int>(d_level_boxes.size()) != finest_ln + 1;
+    for (int ln = coarsest_ln; ln <= finest_ln && !hierarchy_changed; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
-        const IntVector<NDIM>& ratio = level->getRatio();
-        const Box<NDIM> domain_box_level = Box<NDIM>::refine(domain_box, ratio);
-        const hier::Index<NDIM>& domain_box_level_lower = domain_box_level.lower();
-        const hier::Index<NDIM>& domain_box_level_upper = domain_box_level.upper();
-        std::array<double, NDIM> dx;
-        for (unsigned int d = 0; d < NDIM; ++d)
+        const BoxArray<NDIM>& boxes = level->getBoxes();
+        hierarchy_changed = boxes.getNumberOfBoxes() != d_level_boxes[ln].getNumberOfBoxes();
+        for (int k = 0; k < boxes.getNumberOfBoxes() && !hierarchy_changed; ++k)
         {
-            dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
+            hierarchy_changed =
+                !(boxes[k] == d_level_boxes[ln][k]) || level->getMappingForPatch(k) != d_level_patch_owners[ln][k];
         }
-
-        Pointer<PatchLevel<NDIM> > finer_level =
-            (ln < finest_ln ? hierarchy->getPatchLevel(ln + 1) : Pointer<BasePatchLevel<NDIM> >(nullptr));
-        const IntVector<NDIM>& finer_ratio = (ln < finest_ln ? finer_level->getRatio() : IntVector<NDIM>(1));
-        const Box<NDIM> finer_domain_box_level = Box<NDIM>::refine(domain_box, finer_ratio);
-        const hier::Index<NDIM>& finer_domain_box_level_lower = finer_domain_box_level.lower();
-        const hier::Index<NDIM>& finer_domain_box_level_upper = finer_domain_box_level.upper();
-        std::array<double, NDIM> finer_dx;
-        for (unsigned int d = 0; d < NDIM; ++d)
+    }
+    if (!hierarchy_changed && std::find(relocate_meter.begin(), relocate_meter.end(), true) == relocate_meter.end())
+    {
+        return;
+    }
+    d_level_boxes.resize(finest_ln + 1);
+    d_level_patch_owners.resize(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        d_level_boxes[ln] = level->getBoxes();
+        d_level_patch_owners[ln].resize(level->getNumberOfPatches());
+        for (int k = 0; k < level->getNumberOfPatches(); ++k)
         {
-            finer_dx[d] = dx_coarsest[d] / static_cast<double>(finer_ratio(d));
+            d_level_patch_owners[ln][k] = level->getMappingForPatch(k);
         }
+    }
 
-        for (unsigned int jj = 0; jj < d_num_meters; ++jj)
+    // compute the physical locations of the quadrature points of the meters
+    // that have moved.
+    for (unsigned int jj = 0; jj < d_num_meters; ++jj)
+    {
+        if (!relocate_meter[jj]) continue;
+        const LinearImplicitSystem& displacement_sys =
+            d_meter_systems[jj]->get_system<LinearImplicitSystem>(IBFEMethod::COORD_MAPPING_SYSTEM_NAME);
+        const NumericVector<double>& displacement_coords = displacement_sys.get_vector("serial solution");
+        const MeterQuadRule& rule = d_meter_quad_rules[jj];
+        EigenAlignedVector<Vector>& qp_xyz_current = d_meter_qp_xyz_current[jj];
+        qp_xyz_current.resize(rule.qp_xyz.size());
+        for (unsigned int qp = 0; qp < rule.qp_xyz.size(); ++qp)
         {
-            const LinearImplicitSystem& displacement_sys =
-                d_meter_systems[jj]->get_system<LinearImplicitSystem>(IBFEMethod::COORD_MAPPING_SYSTEM_NAME);
-            const NumericVector<double>& displacement_coords = displacement_sys.get_vector("serial solution");
-            const DofMap& dof_map = displacement_sys.get_dof_map();
-            FEType fe_type = displacement_sys.variable_type(0);
-
-            // set up FE objects
-            std::unique_ptr<FEBase> fe_elem(FEBase::build(NDIM - 1, fe_type));
-            std::unique_ptr<QBase> qrule(QBase::build(d_quad_type, NDIM - 1, d_quad_order[jj]));
-            fe_elem->attach_quadrature_rule(qrule.get());
-            //  for evaluating the displacement system
-            const std::vector<Real>& JxW = fe_elem->get_JxW();
-            const std::vector<std::vector<Real> >& phi = fe_elem->get_phi();
-            const std::vector<libMesh::Point>& qp_points = fe_elem->get_xyz();
-            std::vector<dof_id_type> dof_indices;
-            DenseMatrix<double> disp_coords;
-
-            // loop over ALL elements in meter mesh, not just the local ones on this process!!
-            MeshBase::const_element_iterator el = d_meter_meshes[jj]->active_elements_begin();
-            const MeshBase::const_element_iterator end_el = d_meter_meshes[jj]->active_elements_end();
-            for (; el != end_el; ++el)
+            const std::vector<dof_id_type>& dof_indices = rule.elem_dof_indices[rule.qp_elem[qp]];
+            const std::vector<double>& phi = rule.qp_phi[qp];
+            for (unsigned int d = 0; d < NDIM; ++d)
             {
-                const Elem* elem = *el;
-                fe_elem->reinit(elem);
-
-                // get dofs for displacement system and store in dense matrix
-                disp_coords.resize(NDIM, phi.size());
-                for (unsigned int d = 0; d < NDIM; ++d) // here d is the "variable number"
+                double disp_comp = 0.0;
+                for (unsigned int nn = 0; nn < phi.size(); ++nn)
                 {
-                    dof_map.dof_indices(elem, dof_indices, d);
-                    for (unsigned int nn = 0; nn < dof_indices.size(); ++nn)
-                    {
-                        disp_coords(d, nn) = displacement_coords(dof_indices[nn]);
-                    }
+                    disp_comp += displacement_coords(dof_indices[d * phi.size() + nn]) * phi[nn];
                 }
+                qp_xyz_current[qp][d] = rule.qp_xyz[qp](d) + disp_comp;
+            }
+        }
+    }
 
-                // compute normal vector to element
-                const libMesh::Point tau1 = *elem->node_ptr(1) - *elem->node_ptr(0);
-                const libMesh::Point tau2 = *elem->node_ptr(2) - *elem->node_ptr(1);
-                libMesh::Point normal_temp = tau1.cross(tau2).unit();
-                Vector normal;
-                for (unsigned int d = 0; d < NDIM; ++d) normal[d] = normal_temp(d);
-
-                // loop over quadrature points, compute their physical locations
-                // after displacement, and store their indices.
-                for (unsigned int qp = 0; qp < qp_points.size(); ++qp)
+    // assign each quadrature point to the finest level that contains it and
+    // store its interpolation stencils with the local patch that contains it.
+    std::vector<std::array<double, NDIM> > level_dx(finest_ln + 1);
+    std::vector<Box<NDIM> > level_domain_boxes(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        const IntVector<NDIM>& ratio = hierarchy->getPatchLevel(ln)->getRatio();
+        level_domain_boxes[ln] = Box<NDIM>::refine(domain_box, ratio);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            level_dx[ln][d] = dx_coarsest[d] / static_cast<double>(ratio(d));
+        }
+    }
+    d_patch_quad_points.clear();
+    d_patch_quad_points.resize(finest_ln + 1);
+    tbox::Array<int> patch_nums;
+    for (unsigned int jj = 0; jj < d_num_meters; ++jj)
+    {
+        const MeterQuadRule& rule = d_meter_quad_rules[jj];
+        for (unsigned int qp = 0; qp < rule.qp_xyz.size(); ++qp)
+        {
+            const Vector& X = d_meter_qp_xyz_current[jj][qp];
+            for (int ln = finest_ln; ln >= coarsest_ln; --ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+                const double* const dx = level_dx[ln].data();
+                const Box<NDIM>& domain_box_level = level_domain_boxes[ln];
+                const hier::Index<NDIM> i = IndexUtilities::getCellIndex(
+                    &X[0], domainXLower, domainXUpper, dx, domain_box_level.lower(), domain_box_level.upper());
+                level->getBoxTree()->findOverlapIndices(patch_nums, Box<NDIM>(i, i));
+                if (patch_nums.size() == 0) continue;
+                if (level->getProcessorMapping().isMappingLocal(patch_nums[0]))
                 {
-                    Vector qp_temp;
+                    Vector X_cell;
                     for (unsigned int d = 0; d < NDIM; ++d)
                     {
-                        double disp_comp = 0.0;
-                        for (unsigned int nn = 0; nn < phi.size(); ++nn)
-                        {
-                            disp_comp += disp_coords(d, nn) * phi[nn][qp];
-                        }
-                        // calculating physical location of the quadrature point
-                        qp_temp[d] = qp_points[qp](d) + disp_comp;
+                        X_cell[d] = domainXLower[d] +
+                                    dx[d] * (static_cast<double>(i(d) - domain_box_level.lower()(d)) + 0.5);
                     }
-
-                    const hier::Index<NDIM> i = IndexUtilities::getCellIndex(&qp_temp[0],
-                                                                             domainXLower,
-                                                                             domainXUpper,
-                                                                             dx.data(),
-                                                                             domain_box_level_lower,
-                                                                             domain_box_level_upper);
-
-                    const hier::Index<NDIM> finer_i = IndexUtilities::getCellIndex(&qp_temp[0],
-                                                                                   domainXLower,
-                                                                                   domainXUpper,
-                                                                                   finer_dx.data(),
-                                                                                   finer_domain_box_level_lower,
-                                                                                   finer_domain_box_level_upper);
-
-                    if (level->getBoxes().contains(i) &&
-                        (ln == finest_ln || !finer_level->getBoxes().contains(finer_i)))
+                    QuadPointStruct q;
+                    q.meter_num = jj;
+                    q.normal = rule.elem_normal[rule.qp_elem[qp]];
+                    q.JxW = rule.qp_JxW[qp];
+                    compute_interp_stencil(q.cc_lower, q.cc_wgt, X, i, X_cell, dx, NDIM);
+                    for (unsigned int axis = 0; axis < NDIM; ++axis)
                     {
-                        QuadPointStruct q;
-                        q.meter_num = jj;
-                        q.qp_xyz_current = qp_temp;
-                        q.JxW = JxW[qp];
-                        q.normal = normal;
-                        d_quad_point_map[ln].insert(std::make_pair(i, q));
+                        compute_interp_stencil(q.sc_lower[axis], q.sc_wgt[axis], X, i, X_cell, dx, axis);
                     }
+                    d_patch_quad_points[ln][patch_nums[0]].push_back(q);
                 }
+                break;
             }
         }
     }
@@ -700,189 +636,84 @@ IBFEInstrumentPanel::readInstrumentData(const int U_data_idx,
 
     const int coarsest_ln = 0;
     const int finest_ln = hierarchy->getFinestLevelNumber();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(static_cast<int>(d_patch_quad_points.size()) == finest_ln + 1);
+#endif
 
-    // Reset the instrument values.
-    std::fill(d_flow_values.begin(), d_flow_values.end(), 0.0);
-    std::fill(d_mean_pressure_values.begin(), d_mean_pressure_values.end(), 0.0);
-    std::vector<double> A(d_num_meters, 0.0);
-
-    // local counters for checking whether we have consistent
-    // values for the number of quadrature points.
-    int count_qp_1 = 0;
-    int count_qp_2 = 0;
+    // The flow, the integral of the pressure, and the area of all meters are
+    // accumulated in a single buffer, which is summed by a single reduction.
+    std::vector<double> meter_sums(3 * d_num_meters, 0.0);
+    double* const flow_sums = &meter_sums[0];
+    double* const pressure_sums = flow_sums + d_num_meters;
+    double* const area_sums = pressure_sums + d_num_meters;
 
-    // compute flow and mean pressure on mesh meters
+    // compute flow and mean pressure on mesh meters, visiting only the local
+    // patches that contain quadrature points.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
-        count_qp_1 += d_quad_point_map[ln].size();
-
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        for (const auto& patch_quad_points : d_patch_quad_points[ln])
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            const Box<NDIM>& patch_box = patch->getBox();
-            const hier::Index<NDIM>& patch_lower = patch_box.lower();
-            const hier::Index<NDIM>& patch_upper = patch_box.upper();
-
-            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-            const double* const x_lower = pgeom->getXLower();
-            const double* const x_upper = pgeom->getXUpper();
-            const double* const dx = pgeom->getDx();
-
+            Pointer<Patch<NDIM> > patch = level->getPatch(patch_quad_points.first);
             Pointer<CellData<NDIM, double> > U_cc_data = patch->getPatchData(U_data_idx);
             Pointer<SideData<NDIM, double> > U_sc_data = patch->getPatchData(U_data_idx);
             Pointer<CellData<NDIM, double> > P_cc_data = patch->getPatchData(P_data_idx);
-
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            for (const QuadPointStruct& q : patch_quad_points.second)
             {
-                const hier::Index<NDIM>& i = b();
-                std::pair<QuadPointMap::const_iterator, QuadPointMap::const_iterator> qp_range =
-                    d_quad_point_map[ln].equal_range(i);
-                if (qp_range.first != qp_range.second)
+                if (U_cc_data || U_sc_data)
                 {
-                    const Vector X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                        x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
-#if (NDIM == 3)
-                                            ,
-                                        x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
-#endif
-                    );
-                    if (U_cc_data)
-                    {
-                        for (auto it = qp_range.first; it != qp_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const double& JxW = it->second.JxW;
-                            const Vector& X = it->second.qp_xyz_current;
-                            const Vector& normal = it->second.normal;
-                            const Vector U = linear_interp<NDIM>(
-                                X, i, X_cell, *U_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += (U.dot(normal)) * JxW;
-                        }
-                    }
-                    if (U_sc_data)
+                    Vector U;
+                    for (unsigned int d = 0; d < NDIM; ++d)
                     {
-                        for (auto it = qp_range.first; it != qp_range.second; ++it)
+                        if (U_cc_data)
                         {
-                            const int& meter_num = it->second.meter_num;
-                            const double& JxW = it->second.JxW;
-                            const Vector& X = it->second.qp_xyz_current;
-                            const Vector& normal = it->second.normal;
-                            const Vector U =
-                                linear_interp(X, i, X_cell, *U_sc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += (U.dot(normal)) * JxW;
+                            U[d] = apply_interp_stencil(q.cc_lower, q.cc_wgt, [&](const hier::Index<NDIM>& i) {
+                                return (*U_cc_data)(CellIndex<NDIM>(i), d);
+                            });
                         }
-                    }
-                    if (P_cc_data)
-                    {
-                        for (auto it = qp_range.first; it != qp_range.second; ++it)
+                        else
                         {
-                            const int& meter_num = it->second.meter_num;
-                            const double& JxW = it->second.JxW;
-                            const Vector& X = it->second.qp_xyz_current;
-                            double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_mean_pressure_values[meter_num] += P * JxW;
-                            A[meter_num] += JxW;
-                            count_qp_2 += 1;
+                            U[d] = apply_interp_stencil(q.sc_lower[d], q.sc_wgt[d], [&](const hier::Index<NDIM>& i) {
+                                return (*U_sc_data)(SideIndex<NDIM>(i, d, SideIndex<NDIM>::Lower));
+                            });
                         }
                     }
+                    flow_sums[q.meter_num] += (U.dot(q.normal)) * q.JxW;
+                }
+                if (P_cc_data)
+                {
+                    const double P = apply_interp_stencil(q.cc_lower, q.cc_wgt, [&](const hier::Index<NDIM>& i) {
+                        return (*P_cc_data)(CellIndex<NDIM>(i));
+                    });
+                    pressure_sums[q.meter_num] += P * q.JxW;
+                    area_sums[q.meter_num] += q.JxW;
                 }
             }
         }
     }
 
-    // check to make sure we don't double count quadrature points because
-    // of overlapping patches or something else.
-    const int count_qp_3 = SAMRAI_MPI::sumReduction(count_qp_2);
-    if (count_qp_1 != count_qp_3)
-    {
-        TBOX_WARNING("IBFEInstrumentPanel::readInstrumentData :"
-                     << " the total number of quadrature points in the meter meshes"
-                     << " is not consistent with the number used in the"
-                     << " calculations, for IBFE part " << d_part << "."
-                     << " there may be overlapping patches in the AMR grid.");
-    }
-
-    // Synchronize the values across all processes.
-    SAMRAI_MPI::sumReduction(&d_flow_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&d_mean_pressure_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&A[0], d_num_meters);
-
-    // Normalize the mean pressure.
-    for (unsigned int jj = 0; jj < d_num_meters; ++jj)
-    {
-        d_mean_pressure_values[jj] /= A[jj];
-    }
-
     // we need to compute the flow correction by calculating the contribution
     // from the velocity of each meter mesh.
     for (unsigned int jj = 0; jj < d_num_meters; ++jj)
     {
-        // get displacement and velocity systems for meter mesh
         const LinearImplicitSystem& velocity_sys =
             d_meter_systems[jj]->get_system<LinearImplicitSystem>(IBFEMethod::VELOCITY_SYSTEM_NAME);
         const NumericVector<double>& velocity_coords = velocity_sys.get_vector("serial solution");
-        const DofMap& dof_map = velocity_sys.get_dof_map();
-        FEType fe_type = velocity_sys.variable_type(0);
-
-        // set up FE objects
-        std::unique_ptr<FEBase> fe_elem(FEBase::build(NDIM - 1, fe_type));
-        QGauss qrule(NDIM - 1, fe_type.default_quadrature_order());
-        fe_elem->attach_quadrature_rule(&qrule);
-
-        //  for evaluating the velocity system
-        const std::vector<Real>& JxW = fe_elem->get_JxW();
-        const std::vector<std::vector<Real> >& phi = fe_elem->get_phi();
-        const std::vector<libMesh::Point>& qp_points = fe_elem->get_xyz();
-        std::vector<dof_id_type> dof_indices;
-        DenseMatrix<double> vel_coords;
-
-        // loop over elements again to compute mass flux and mean pressure
-        double flux_correction = 0.0;
-        MeshBase::const_element_iterator el = d_meter_meshes[jj]->active_local_elements_begin();
-        const MeshBase::const_element_iterator end_el = d_meter_meshes[jj]->active_local_elements_end();
-        for (; el != end_el; ++el)
+        for (const std::pair<dof_id_type, double>& dof_weight : d_flux_correction_weights[jj])
         {
-            const Elem* elem = *el;
-            fe_elem->reinit(elem);
-
-            // get dofs for displacement system and store in dense matrix
-            vel_coords.resize(NDIM, phi.size());
-            for (unsigned int d = 0; d < NDIM; ++d) // here d is the "variable number"
-            {
-                dof_map.dof_indices(elem, dof_indices, d);
-                for (unsigned int nn = 0; nn < dof_indices.size(); ++nn)
-                {
-                    vel_coords(d, nn) = velocity_coords(dof_indices[nn]);
-                }
-            }
-
-            // compute normal vector to element
-            const libMesh::Point tau1 = *elem->node_ptr(1) - *elem->node_ptr(0);
-            const libMesh::Point tau2 = *elem->node_ptr(2) - *elem->node_ptr(1);
-            const libMesh::Point normal = (tau1.cross(tau2)).unit();
-
-            // loop over quadrature points
-            double vel_comp;
-            for (unsigned int qp = 0; qp < qp_points.size(); ++qp)
-            {
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    vel_comp = 0.0;
-                    for (unsigned int nn = 0; nn < phi.size(); ++nn)
-                    {
-                        vel_comp += vel_coords(d, nn) * phi[nn][qp];
-                    }
-                    flux_correction += vel_comp * normal(d) * JxW[qp];
-                }
-            }
+            flow_sums[jj] -= dof_weight.second * velocity_coords(dof_weight.first);
         }
+    }
 
-        const double total_correction = SAMRAI_MPI::sumReduction(flux_correction);
-        d_flow_values[jj] -= total_correction;
+    // Synchronize the values across all processes.
+    SAMRAI_MPI::sumReduction(&meter_sums[0], static_cast<int>(meter_sums.size()));
 
-    } // loop over meters
+    // Normalize the mean pressure.
+    for (unsigned int jj = 0; jj < d_num_meters; ++jj)
+    {
+        d_flow_values[jj] = flow_sums[jj];
+        d_mean_pressure_values[jj] = pressure_sums[jj] / area_sums[jj];
+    }
 
     // write data
     outputData(data_time);
@@ -960,18 +791,84 @@ IBFEInstrumentPanel::getMeterMeshQuadOrder(const unsigned int jj) const
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
-IBFEInstrumentPanel::initializeSystemDependentData(IBFEMethod* ib_method_ops, const int meter_mesh_number)
+IBFEInstrumentPanel::buildMeterQuadRule(const int meter_mesh_number)
 {
-    // get the coordinate mapping system and velocity systems for the parent mesh
-    const FEDataManager* fe_data_manager = ib_method_ops->getFEDataManager(d_part);
-    const EquationSystems* equation_systems = fe_data_manager->getEquationSystems();
-    const System& dX_system = equation_systems->get_system(IBFEMethod::COORD_MAPPING_SYSTEM_NAME);
-    // \todo: find a better way to do this
-    std::vector<double> dX_coords_parent;
-    dX_system.update_global_solution(dX_coords_parent);
-    const System& U_system = equation_systems->get_system(IBFEMethod::VELOCITY_SYSTEM_NAME);
-    std::vector<double> U_coords_parent;
-    U_system.update_global_solution(U_coords_parent);
+    const LinearImplicitSystem& displacement_sys =
+        d_meter_systems[meter_mesh_number]->get_system<LinearImplicitSystem>(IBFEMethod::COORD_MAPPING_SYSTEM_NAME);
+    const DofMap& dof_map = displacement_sys.get_dof_map();
+    FEType fe_type = displacement_sys.variable_type(0);
+
+    // set up FE objects
+    std::unique_ptr<FEBase> fe_elem(FEBase::build(NDIM - 1, fe_type));
+    std::unique_ptr<QBase> qrule(QBase::build(d_quad_type, NDIM - 1, d_quad_order[meter_mesh_number]));
+    fe_elem->attach_quadrature_rule(qrule.get());
+    //  for evaluating the displacement system
+    const std::vector<Real>& JxW = fe_elem->get_JxW();
+    const std::vector<std::vector<Real> >& phi = fe_elem->get_phi();
+    const std::vector<libMesh::Point>& qp_points = fe_elem->get_xyz();
+    std::vector<dof_id_type> dof_indices;
+
+    MeterQuadRule& rule = d_meter_quad_rules[meter_mesh_number];
+    rule = MeterQuadRule();
+    rule.order = d_quad_order[meter_mesh_number];
+
+    // loop over ALL elements in meter mesh, not just the local ones on this process!!
+    MeshBase::const_element_iterator el = d_meter_meshes[meter_mesh_number]->active_elements_begin();
+    const MeshBase::const_element_iterator end_el = d_meter_meshes[meter_mesh_number]->active_elements_end();
+    for (; el != end_el; ++el)
+    {
+        const Elem* elem = *el;
+        fe_elem->reinit(elem);
+        const unsigned int elem_num = static_cast<unsigned int>(rule.elem_dof_indices.size());
+
+        // get dofs for displacement system, ordered by variable
+        std::vector<dof_id_type> elem_dof_indices;
+        for (unsigned int d = 0; d < NDIM; ++d) // here d is the "variable number"
+        {
+            dof_map.dof_indices(elem, dof_indices, d);
+            elem_dof_indices.insert(elem_dof_indices.end(), dof_indices.begin(), dof_indices.end());
+        }
+        rule.elem_dof_indices.push_back(std::move(elem_dof_indices));
+
+        // compute normal vector to element
+        const libMesh::Point tau1 = *elem->node_ptr(1) - *elem->node_ptr(0);
+        const libMesh::Point tau2 = *elem->node_ptr(2) - *elem->node_ptr(1);
+        libMesh::Point normal_temp = tau1.cross(tau2).unit();
+        Vector normal;
+        for (unsigned int d = 0; d < NDIM; ++d) normal[d] = normal_temp(d);
+        rule.elem_normal.push_back(normal);
+
+        // store the quadrature points in the reference configuration
+        for (unsigned int qp = 0; qp < qp_points.size(); ++qp)
+        {
+            rule.qp_elem.push_back(elem_num);
+            rule.qp_xyz.push_back(qp_points[qp]);
+            rule.qp_JxW.push_back(JxW[qp]);
+            std::vector<double> qp_phi(phi.size());
+            for (unsigned int nn = 0; nn < phi.size(); ++nn) qp_phi[nn] = phi[nn][qp];
+            rule.qp_phi.push_back(std::move(qp_phi));
+        }
+    }
+}
+
+bool
+IBFEInstrumentPanel::initializeSystemDependentData(const std::vector<double>& U_coords_parent,
+                                                   const std::vector<double>& dX_coords_parent,
+                                                   const int meter_mesh_number)
+{
+    // check whether the meter has moved since the last update
+    std::vector<double>& meter_dX_dofs = d_meter_dX_dofs[meter_mesh_number];
+    bool moved = meter_dX_dofs.size() != d_num_nodes[meter_mesh_number] * NDIM;
+    meter_dX_dofs.resize(d_num_nodes[meter_mesh_number] * NDIM);
+    for (unsigned int ii = 0; ii < d_num_nodes[meter_mesh_number]; ++ii)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const double dX = dX_coords_parent[d_dX_dof_idx[meter_mesh_number][ii][d]];
+            moved = moved || meter_dX_dofs[ii * NDIM + d] != dX;
+            meter_dX_dofs[ii * NDIM + d] = dX;
+        }
+    }
 
     // get displacement and velocity systems for meter mesh
     auto& velocity_sys =
@@ -1047,6 +944,7 @@ IBFEInstrumentPanel::initializeSystemDependentData(IBFEMethod* ib_method_ops, co
     }
     velocity_solution.close();
     displacement_solution.close();
+    if (!moved) return false;
 
     // compute the meter radius
     double max_meter_radius = 0.0;
@@ -1075,6 +973,7 @@ IBFEInstrumentPanel::initializeSystemDependentData(IBFEMethod* ib_method_ops, co
         max_meter_radius = std::max(std::pow(radius_squared, 0.5), max_meter_radius);
     }
     d_meter_radii[meter_mesh_number] = max_meter_radius;
+    return true;
 }
 
 double
@@ -32,9 +32,11 @@
 #include "ibtk/LibMeshSystemIBVectors.h"
 #include "ibtk/MergingLoadBalancer.h"
 #include "ibtk/PartitioningBox.h"
+#include "ibtk/PerformanceMonitor.h"
 #include "ibtk/QuadratureCache.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/SAMRAIDataCache.h"
+#include "ibtk/SpaceFillingCurveLoadBalancer.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/libmesh_utilities.h"
 
@@ -42,6 +44,7 @@
 #include "BasePatchLevel.h"
 #include "BergerRigoutsos.h"
 #include "Box.h"
+#include "BoxArray.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellIndex.h"
@@ -92,7 +95,6 @@
 #include "libmesh/enum_order.h"
 #include "libmesh/enum_parallel_type.h"
 #include "libmesh/enum_quadrature_type.h"
-#include "libmesh/enum_xdr_mode.h"
 #include "libmesh/equation_systems.h"
 #include "libmesh/explicit_system.h"
 #include "libmesh/face.h"
@@ -507,6 +509,11 @@ IBFEMethod::getLagrangianStructureIsActivated(int structure_number, int /*level_
 void
 IBFEMethod::preprocessIntegrateData(double current_time, double new_time, int num_cycles)
 {
+    if (d_workload_calibration_step_num < d_workload_calibration_steps)
+    {
+        d_workload_calibration_step_start_time = MPI_Wtime();
+    }
+
     FEMechanicsBase::preprocessIntegrateData(current_time, new_time, num_cycles);
 
     d_started_time_integration = true;
@@ -568,6 +575,12 @@ IBFEMethod::postprocessIntegrateData(double current_time, double new_time, int n
     }
 
     FEMechanicsBase::postprocessIntegrateData(current_time, new_time, num_cycles);
+
+    if (d_workload_calibration_step_num < d_workload_calibration_steps)
+    {
+        d_workload_calibration_step_time += MPI_Wtime() - d_workload_calibration_step_start_time;
+        if (++d_workload_calibration_step_num == d_workload_calibration_steps) calibrateWorkloadSpecs();
+    }
     return;
 } // postprocessIntegrateData
 
@@ -577,8 +590,20 @@ IBFEMethod::interpolateVelocity(const int u_data_idx,
                                 const std::vector<Pointer<RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
                                 const double data_time)
 {
+    PerformanceMonitor::ScopedRegion region("IBFEMethod::interpolateVelocity");
+    const double start_time = MPI_Wtime();
     const std::string data_time_str = get_data_time_str(data_time, d_current_time, d_new_time);
 
+    // Start communicating the Lagrangian ghost data so that it overlaps with
+    // the Eulerian data transfers below.
+    std::vector<PetscVector<double>*> U_vecs = d_U_vecs->get(data_time_str);
+    std::vector<PetscVector<double>*> X_vecs = d_X_vecs->get(data_time_str);
+    std::vector<PetscVector<double>*> U_rhs_vecs =
+        d_use_ghosted_velocity_rhs ? d_U_IB_vecs->getIBGhosted("tmp") : d_U_vecs->get("RHS Vector");
+    std::vector<PetscVector<double>*> X_IB_ghost_vecs = d_X_IB_vecs->getIBGhosted("tmp");
+    batch_vec_copy(X_vecs, X_IB_ghost_vecs);
+    batch_vec_ghost_update_begin(X_IB_ghost_vecs, INSERT_VALUES, SCATTER_FORWARD);
+
     if (d_use_scratch_hierarchy)
     {
         assertStructureOnFinestLevel();
@@ -597,13 +622,7 @@ IBFEMethod::interpolateVelocity(const int u_data_idx,
         }
     }
 
-    std::vector<PetscVector<double>*> U_vecs = d_U_vecs->get(data_time_str);
-    std::vector<PetscVector<double>*> X_vecs = d_X_vecs->get(data_time_str);
-    std::vector<PetscVector<double>*> U_rhs_vecs =
-        d_use_ghosted_velocity_rhs ? d_U_IB_vecs->getIBGhosted("tmp") : d_U_vecs->get("RHS Vector");
-    std::vector<PetscVector<double>*> X_IB_ghost_vecs = d_X_IB_vecs->getIBGhosted("tmp");
-    batch_vec_copy(X_vecs, X_IB_ghost_vecs);
-    batch_vec_ghost_update(X_IB_ghost_vecs, INSERT_VALUES, SCATTER_FORWARD);
+    batch_vec_ghost_update_end(X_IB_ghost_vecs, INSERT_VALUES, SCATTER_FORWARD);
 
     // Build the right-hand-sides to compute the interpolated data.
     std::vector<Pointer<RefineSchedule<NDIM> > > no_fill(u_ghost_fill_scheds.size());
@@ -656,6 +675,10 @@ IBFEMethod::interpolateVelocity(const int u_data_idx,
             U_vecs[part]->zero();
         }
     }
+    if (d_workload_calibration_step_num < d_workload_calibration_steps)
+    {
+        d_workload_calibration_interp_time += MPI_Wtime() - start_time;
+    }
     return;
 } // interpolateVelocity
 
@@ -780,6 +803,8 @@ IBFEMethod::trapezoidalStep(const double current_time, const double new_time)
 void
 IBFEMethod::computeLagrangianForce(const double data_time)
 {
+    PerformanceMonitor::ScopedRegion region("IBFEMethod::computeLagrangianForce");
+    const double start_time = MPI_Wtime();
     const std::string data_time_str = get_data_time_str(data_time, d_current_time, d_new_time);
     batch_vec_ghost_update(d_X_vecs->get(data_time_str), INSERT_VALUES, SCATTER_FORWARD);
     d_F_vecs->zero("RHS Vector");
@@ -821,6 +846,10 @@ IBFEMethod::computeLagrangianForce(const double data_time)
             IBTK_CHKERRQ(ierr);
         }
     }
+    if (d_workload_calibration_step_num < d_workload_calibration_steps)
+    {
+        d_workload_calibration_stress_time += MPI_Wtime() - start_time;
+    }
     return;
 } // computeLagrangianForce
 
@@ -830,14 +859,17 @@ IBFEMethod::spreadForce(const int f_data_idx,
                         const std::vector<Pointer<RefineSchedule<NDIM> > >& /*f_prolongation_scheds*/,
                         const double data_time)
 {
+    PerformanceMonitor::ScopedRegion region("IBFEMethod::spreadForce");
+    const double start_time = MPI_Wtime();
     const std::string data_time_str = get_data_time_str(data_time, d_current_time, d_new_time);
 
-    // Communicate ghost data.
+    // Start communicating ghost data. The update is completed after the
+    // Eulerian force data is set up, which does not depend on it.
     std::vector<PetscVector<double>*> X_IB_ghost_vecs = d_X_IB_vecs->getIBGhosted("tmp");
     std::vector<PetscVector<double>*> F_IB_ghost_vecs = d_F_IB_vecs->getIBGhosted("tmp");
     batch_vec_copy({ d_X_vecs->get(data_time_str), d_F_vecs->get(data_time_str) },
                    { X_IB_ghost_vecs, F_IB_ghost_vecs });
-    batch_vec_ghost_update({ X_IB_ghost_vecs, F_IB_ghost_vecs }, INSERT_VALUES, SCATTER_FORWARD);
+    batch_vec_ghost_update_begin({ X_IB_ghost_vecs, F_IB_ghost_vecs }, INSERT_VALUES, SCATTER_FORWARD);
 
     // set up a new data index for computing forces on the active hierarchy.
     Pointer<PatchHierarchy<NDIM> > hierarchy = d_use_scratch_hierarchy ? d_scratch_hierarchy : d_hierarchy;
@@ -852,6 +884,9 @@ IBFEMethod::spreadForce(const int f_data_idx,
                                    0.0,
                                    /*interior_only*/ false);
 
+    // Finish communicating ghost data.
+    batch_vec_ghost_update_end({ X_IB_ghost_vecs, F_IB_ghost_vecs }, INSERT_VALUES, SCATTER_FORWARD);
+
     // Spread interior force density values.
     for (unsigned int part = 0; part < d_meshes.size(); ++part)
     {
@@ -929,6 +964,10 @@ IBFEMethod::spreadForce(const int f_data_idx,
         // just need to add its values to those in f_data_idx
         f_active_data_ops->add(f_data_idx, f_data_idx, f_scratch_data_idx);
     }
+    if (d_workload_calibration_step_num < d_workload_calibration_steps)
+    {
+        d_workload_calibration_spread_time += MPI_Wtime() - start_time;
+    }
     return;
 } // spreadForce
 
@@ -1045,13 +1084,16 @@ IBFEMethod::spreadFluidSource(const int q_data_idx,
     std::vector<PetscVector<double>*> Q_IB_ghost_vecs = d_Q_IB_vecs->getIBGhosted("tmp");
     TBOX_ASSERT(MathUtilities<double>::equalEps(data_time, d_half_time));
     batch_vec_copy({ d_X_vecs->get("half"), d_Q_vecs->get("half") }, { X_IB_ghost_vecs, Q_IB_ghost_vecs });
-    batch_vec_ghost_update({ X_IB_ghost_vecs, Q_IB_ghost_vecs }, INSERT_VALUES, SCATTER_FORWARD);
 
+    // Overlap the Lagrangian ghost data communication with the transfer of
+    // the Eulerian data to the scratch hierarchy.
+    batch_vec_ghost_update_begin({ X_IB_ghost_vecs, Q_IB_ghost_vecs }, INSERT_VALUES, SCATTER_FORWARD);
     if (d_use_scratch_hierarchy)
     {
         assertStructureOnFinestLevel();
         getPrimaryToScratchSchedule(d_hierarchy->getFinestLevelNumber(), q_data_idx, q_data_idx).fillData(data_time);
     }
+    batch_vec_ghost_update_end({ X_IB_ghost_vecs, Q_IB_ghost_vecs }, INSERT_VALUES, SCATTER_FORWARD);
 
     for (unsigned int part = 0; part < d_meshes.size(); ++part)
     {
@@ -1298,6 +1340,26 @@ void IBFEMethod::beginDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierar
 {
     // clear some things that contain data specific to the current patch hierarchy
     d_ghost_data_accumulator.reset();
+
+    // Determine which parts should be repartitioned once the patches have
+    // been redistributed. This has to be done now since afterwards the
+    // element mappings no longer correspond to the patch hierarchy.
+    d_repartition_part.assign(d_meshes.size(),
+                              d_libmesh_partitioner_type == SAMRAI_BOX ||
+                                  d_libmesh_partitioner_type == SPACE_FILLING_CURVE);
+    if (d_is_initialized && d_libmesh_repartition_threshold >= 0.0)
+    {
+        for (unsigned int part = 0; part < d_meshes.size(); ++part)
+        {
+            const double fraction = d_active_fe_data_managers[part]->computeNonLocalPatchElementFraction();
+            d_repartition_part[part] = fraction > d_libmesh_repartition_threshold;
+            if (d_do_log)
+            {
+                plog << d_object_name << "::beginDataRedistribution(): fraction of nonlocal patch elements on part "
+                     << part << " = " << fraction << (d_repartition_part[part] ? " (repartitioning)" : "") << '\n';
+            }
+        }
+    }
     return;
 } // beginDataRedistribution
 
@@ -1372,15 +1434,25 @@ void IBFEMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarch
         // each patch). Here is the other half: if requested, we inform
         // libMesh of the updated partitioning so that libMesh Elems and Nodes
         // are on the same processor as the relevant SAMRAI patch.
-        if (d_libmesh_partitioner_type == SAMRAI_BOX)
+        for (unsigned int part = 0; part < d_meshes.size(); ++part)
         {
-            for (unsigned int part = 0; part < d_meshes.size(); ++part)
+            if (part >= d_repartition_part.size() || !d_repartition_part[part]) continue;
+            EquationSystems& equation_systems = *d_active_fe_data_managers[part]->getEquationSystems();
+            MeshBase& mesh = equation_systems.get_mesh();
+            if (d_libmesh_partitioner_type == SAMRAI_BOX)
             {
-                EquationSystems& equation_systems = *d_active_fe_data_managers[part]->getEquationSystems();
-                MeshBase& mesh = equation_systems.get_mesh();
                 BoxPartitioner partitioner(*d_hierarchy, equation_systems.get_system(COORDS_SYSTEM_NAME));
                 partitioner.repartition(mesh);
             }
+            else
+            {
+                SpaceFillingCurvePartitioner partitioner(*d_hierarchy, equation_systems.get_system(COORDS_SYSTEM_NAME));
+                if (d_use_quadrature_partitioner_weights)
+                {
+                    partitioner.setQuadratureWeights(d_interp_spec[part].quad_type, d_interp_spec[part].quad_order);
+                }
+                partitioner.repartition(mesh);
+            }
         }
 
         if (d_use_scratch_hierarchy)
@@ -1591,6 +1663,17 @@ IBFEMethod::doInitializeFEEquationSystems()
         d_fe_data[part] = d_primary_fe_data_managers[part]->getFEData();
 
         d_active_fe_data_managers[part]->setLoggingEnabled(d_do_log);
+        d_primary_fe_data_managers[part]->setUseMatrixFreeMassOperator(d_use_matrix_free_mass_operator);
+        if (d_use_scratch_hierarchy)
+            d_scratch_fe_data_managers[part]->setUseMatrixFreeMassOperator(d_use_matrix_free_mass_operator);
+        d_primary_fe_data_managers[part]->setUseIncrementalElementMappings(d_use_incremental_element_mappings);
+        if (d_use_scratch_hierarchy)
+            d_scratch_fe_data_managers[part]->setUseIncrementalElementMappings(d_use_incremental_element_mappings);
+        d_primary_fe_data_managers[part]->setUseBoundingBoxTagging(d_use_bounding_box_tagging);
+        if (d_use_scratch_hierarchy)
+            d_scratch_fe_data_managers[part]->setUseBoundingBoxTagging(d_use_bounding_box_tagging);
+        // Only the primary hierarchy is saved in restart files.
+        d_primary_fe_data_managers[part]->setRestoreElementMappingsFromRestart(d_restore_element_mappings_from_restart);
         d_ghosts = IntVector<NDIM>::max(d_ghosts, d_active_fe_data_managers[part]->getGhostCellWidth());
 
         // Create FE equation systems objects and corresponding variables.
@@ -1605,15 +1688,7 @@ IBFEMethod::doInitializeFEEquationSystems()
         d_active_fe_data_managers[part]->COORDINATES_SYSTEM_NAME = COORDS_SYSTEM_NAME;
         if (from_restart)
         {
-            const std::string& file_name = libmesh_restart_file_name(
-                d_libmesh_restart_read_dir, d_libmesh_restart_restore_number, part, d_libmesh_restart_file_extension);
-            const XdrMODE xdr_mode = (d_libmesh_restart_file_extension == "xdr" ? DECODE : READ);
-            const int read_mode =
-                EquationSystems::READ_HEADER | EquationSystems::READ_DATA | EquationSystems::READ_ADDITIONAL_DATA;
-            equation_systems.read(file_name,
-                                  xdr_mode,
-                                  read_mode,
-                                  /*partition_agnostic*/ true);
+            readFEDataFromRestartFile(part);
         }
         else
         {
@@ -1918,22 +1993,15 @@ IBFEMethod::computeStressNormalization(PetscVector<double>& Phi_vec,
                 double Phi = 0.0;
                 for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                 {
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
+                    if (d_PK1_stress_fcn_data[part][k].isSet())
                     {
                         // Compute the value of the first Piola-Kirchhoff stress
                         // tensor at the quadrature point and add the corresponding
                         // traction force to the right-hand-side vector.
                         fe.setInterpolatedDataPointers(
                             PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                        d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                           FF,
-                                                           x,
-                                                           X,
-                                                           elem,
-                                                           PK1_var_data[k],
-                                                           PK1_grad_var_data[k],
-                                                           data_time,
-                                                           d_PK1_stress_fcn_data[part][k].ctx);
+                        d_PK1_stress_fcn_data[part][k].evaluate(
+                            PP, FF, x, X, elem, PK1_var_data[k], PK1_grad_var_data[k], data_time);
                         Phi += n * ((PP * FF_trans) * n) / J;
                     }
                 }
@@ -2197,22 +2265,15 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (d_PK1_stress_fcn_data[part][k].isSet())
                         {
                             // Compute the value of the first Piola-Kirchhoff stress
                             // tensor at the quadrature point and compute the
                             // corresponding force.
                             fe.setInterpolatedDataPointers(
                                 PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               x,
-                                                               X,
-                                                               elem,
-                                                               PK1_var_data[k],
-                                                               PK1_grad_var_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            d_PK1_stress_fcn_data[part][k].evaluate(
+                                PP, FF, x, X, elem, PK1_var_data[k], PK1_grad_var_data[k], data_time);
                             F -= PP * normal_face[qp] * JxW_face[qp];
                         }
                     }
@@ -2582,22 +2643,15 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (d_PK1_stress_fcn_data[part][k].isSet())
                         {
                             // Compute the value of the first Piola-Kirchhoff
                             // stress tensor at the quadrature point and compute
                             // the corresponding force.
                             fe.setInterpolatedDataPointers(
                                 PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               x,
-                                                               X,
-                                                               elem,
-                                                               PK1_var_data[k],
-                                                               PK1_grad_var_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            d_PK1_stress_fcn_data[part][k].evaluate(
+                                PP, FF, x, X, elem, PK1_var_data[k], PK1_grad_var_data[k], data_time);
                             F -= PP * normal_face[qp];
                         }
                     }
@@ -2858,6 +2912,8 @@ IBFEMethod::commonConstructor(const std::string& object_name,
             d_scratch_load_balancer = new LoadBalancer<NDIM>(d_scratch_load_balancer_db);
         else if (load_balancer_type == "MERGING")
             d_scratch_load_balancer = new MergingLoadBalancer(d_scratch_load_balancer_db);
+        else if (load_balancer_type == "SPACE_FILLING_CURVE")
+            d_scratch_load_balancer = new SpaceFillingCurveLoadBalancer(d_scratch_load_balancer_db);
         else
             TBOX_ERROR(d_object_name << "::IBFEMethod():\n"
                                      << "unimplemented load balancer type " << load_balancer_type << std::endl);
@@ -2926,6 +2982,11 @@ IBFEMethod::getFromInput(const Pointer<Database>& db, bool /*is_from_restart*/)
     else if (db->isBool("IB_use_consistent_mass_matrix"))
         d_default_interp_spec.use_consistent_mass_matrix = db->getBool("IB_use_consistent_mass_matrix");
 
+    if (db->isBool("interp_use_threaded_quadrature"))
+        d_default_interp_spec.use_threaded_quadrature = db->getBool("interp_use_threaded_quadrature");
+    else if (db->isBool("IB_use_threaded_quadrature"))
+        d_default_interp_spec.use_threaded_quadrature = db->getBool("IB_use_threaded_quadrature");
+
     if (db->isString("vector_assembly_accumulation"))
     {
         const std::string vector_assembly = db->getString("vector_assembly_accumulation");
@@ -2981,6 +3042,11 @@ IBFEMethod::getFromInput(const Pointer<Database>& db, bool /*is_from_restart*/)
     else if (db->isDouble("IB_point_density"))
         d_default_spread_spec.point_density = db->getDouble("IB_point_density");
 
+    if (db->isBool("spread_use_threaded_quadrature"))
+        d_default_spread_spec.use_threaded_quadrature = db->getBool("spread_use_threaded_quadrature");
+    else if (db->isBool("IB_use_threaded_quadrature"))
+        d_default_spread_spec.use_threaded_quadrature = db->getBool("IB_use_threaded_quadrature");
+
     // Force computation settings.
     if (db->isBool("split_normal_force"))
         d_split_normal_force = db->getBool("split_normal_force");
@@ -3023,12 +3089,35 @@ IBFEMethod::getFromInput(const Pointer<Database>& db, bool /*is_from_restart*/)
 
     if (db->isDouble("epsilon")) d_epsilon = db->getDouble("epsilon");
 
+    if (db->isDatabase("LEInteractor")) LEInteractor::setFromDatabase(db->getDatabase("LEInteractor"));
+
     d_libmesh_partitioner_type =
         string_to_enum<LibmeshPartitionerType>(db->getStringWithDefault("libmesh_partitioner_type", "LIBMESH_DEFAULT"));
+    d_use_quadrature_partitioner_weights =
+        db->getBoolWithDefault("libmesh_partitioner_use_quadrature_weights", d_use_quadrature_partitioner_weights);
+    d_libmesh_repartition_threshold =
+        db->getDoubleWithDefault("libmesh_repartition_threshold", d_libmesh_repartition_threshold);
     if (db->keyExists("workload_quad_point_weight"))
     {
         d_default_workload_spec.q_point_weight = db->getDouble("workload_quad_point_weight");
     }
+    if (db->keyExists("workload_spread_quad_point_weight"))
+    {
+        d_default_workload_spec.spread_q_point_weight = db->getDouble("workload_spread_quad_point_weight");
+    }
+    if (db->keyExists("workload_interp_quad_point_weight"))
+    {
+        d_default_workload_spec.interp_q_point_weight = db->getDouble("workload_interp_quad_point_weight");
+    }
+    if (db->keyExists("workload_stress_quad_point_weight"))
+    {
+        d_default_workload_spec.stress_q_point_weight = db->getDouble("workload_stress_quad_point_weight");
+    }
+    d_workload_calibration_steps = db->getIntegerWithDefault("workload_calibration_steps", 0);
+
+    d_use_incremental_element_mappings = db->getBoolWithDefault("use_incremental_element_mappings", false);
+    d_restore_element_mappings_from_restart = db->getBoolWithDefault("restore_element_mappings_from_restart", false);
+    d_use_bounding_box_tagging = db->getBoolWithDefault("use_bounding_box_tagging", false);
 
     d_use_scratch_hierarchy = db->getBoolWithDefault("use_scratch_hierarchy", false);
     if (d_use_scratch_hierarchy)
@@ -3095,6 +3184,65 @@ IBFEMethod::assertStructureOnFinestLevel() const
     }
 }
 
+void
+IBFEMethod::calibrateWorkloadSpecs()
+{
+    // Sum the timings over all processors so that they measure the total
+    // amount of work in each phase.
+    std::array<double, 4> times = { { d_workload_calibration_step_time,
+                                      d_workload_calibration_spread_time,
+                                      d_workload_calibration_interp_time,
+                                      d_workload_calibration_stress_time } };
+    const int ierr = MPI_Allreduce(
+        MPI_IN_PLACE, times.data(), times.size(), MPI_DOUBLE, MPI_SUM, SAMRAI::tbox::SAMRAI_MPI::commWorld);
+    TBOX_ASSERT(ierr == 0);
+    const double fluid_time = times[0] - times[1] - times[2] - times[3];
+
+    // Everything other than the IB phases is attributed to the Eulerian
+    // cells, each of which has a workload of one.
+    double n_cells = 0.0;
+    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        const BoxArray<NDIM>& boxes = d_hierarchy->getPatchLevel(ln)->getBoxes();
+        for (int i = 0; i < boxes.getNumberOfBoxes(); ++i) n_cells += boxes[i].size();
+    }
+    double n_q_points = 0.0;
+    for (unsigned int part = 0; part < d_meshes.size(); ++part)
+    {
+        if (d_part_is_active[part]) n_q_points += d_active_fe_data_managers[part]->computeGlobalQuadPointCount();
+    }
+    if (fluid_time <= 0.0 || n_cells == 0.0 || n_q_points == 0.0)
+    {
+        TBOX_WARNING(d_object_name << "::calibrateWorkloadSpecs():\n"
+                                   << "  unable to calibrate the workload model from the collected timings;\n"
+                                   << "  the current workload weights will be used." << std::endl);
+        return;
+    }
+    const double cell_cost = fluid_time / n_cells;
+
+    FEDataManager::WorkloadSpec workload_spec;
+    workload_spec.q_point_weight = 0.0;
+    workload_spec.spread_q_point_weight = times[1] / n_q_points / cell_cost;
+    workload_spec.interp_q_point_weight = times[2] / n_q_points / cell_cost;
+    workload_spec.stress_q_point_weight = times[3] / n_q_points / cell_cost;
+    for (unsigned int part = 0; part < d_meshes.size(); ++part)
+    {
+        d_workload_spec[part] = workload_spec;
+        d_primary_fe_data_managers[part]->setWorkloadSpec(workload_spec);
+        if (d_use_scratch_hierarchy) d_scratch_fe_data_managers[part]->setWorkloadSpec(workload_spec);
+    }
+
+    if (d_do_log)
+    {
+        plog << d_object_name << "::calibrateWorkloadSpecs(): calibrated quadrature point weights after "
+             << d_workload_calibration_steps << " time steps:\n"
+             << "  spreading:     " << workload_spec.spread_q_point_weight << "\n"
+             << "  interpolation: " << workload_spec.interp_q_point_weight << "\n"
+             << "  stress:        " << workload_spec.stress_q_point_weight << std::endl;
+    }
+    return;
+} // calibrateWorkloadSpecs
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
@@ -22,6 +22,7 @@
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LEInteractor.h"
+#include "ibtk/ThreadPool.h"
 #include "ibtk/ibtk_macros.h"
 #include "ibtk/libmesh_utilities.h"
 
@@ -48,6 +49,9 @@ IBTK_DISABLE_EXTRA_WARNINGS
 #include "Eigen/Dense"
 IBTK_ENABLE_EXTRA_WARNINGS
 
+#include <algorithm>
+#include <vector>
+
 using namespace libMesh;
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -144,6 +148,80 @@ evaluate_polynomial_basis_fcns(Eigen::VectorXd& P,
     }
     return;
 } // evaluate_polynomial_basis_fcns
+
+// Perform the element patch L2 projections of n_vars variables whose values at
+// the quadrature points are stored in qp_vals (the value of variable var at
+// global quadrature point qp is stored at n_vars * qp + var) and return the
+// reconstructed values at the patch nodes (the value of variable var at the
+// node of patch k is stored at n_vars * k + var).
+//
+// The basis functions are evaluated once per quadrature point for all
+// variables, so that each patch requires a single solve with n_vars right-hand
+// sides.  The patches are distributed among the threads of a thread pool; each
+// thread uses its own finite element objects.
+template <class ElemPatchMap, class ElemQPOffsets>
+std::vector<double>
+project_elem_patches(const ElemPatchMap& elem_patches,
+                     const std::vector<Eigen::ColPivHouseholderQR<Eigen::MatrixXd> >& patch_proj_solvers,
+                     const ElemQPOffsets& elem_qp_global_offset,
+                     const std::vector<double>& qp_vals,
+                     const unsigned int n_vars,
+                     const MeshBase& mesh,
+                     const Order interp_order,
+                     const Order quad_order)
+{
+    std::vector<typename ElemPatchMap::const_iterator> patch_its;
+    patch_its.reserve(elem_patches.size());
+    for (auto it = elem_patches.begin(); it != elem_patches.end(); ++it) patch_its.push_back(it);
+    const int num_patches = static_cast<int>(patch_its.size());
+    std::vector<double> nodal_vals(n_vars * num_patches, 0.0);
+
+    const unsigned int dim = mesh.mesh_dimension();
+    const unsigned int num_basis_fcns = num_polynomial_basis_fcns(dim, interp_order);
+    const int num_chunks = static_cast<int>(
+        std::max(1u, std::min(ThreadPool::getDefaultNumberOfThreads(), static_cast<unsigned int>(num_patches))));
+    ThreadPool thread_pool(static_cast<unsigned int>(num_chunks));
+    thread_pool.parallelFor(num_chunks, [&](const int chunk) {
+        Eigen::VectorXd P(num_basis_fcns);
+        Eigen::MatrixXd F(num_basis_fcns, n_vars), A(num_basis_fcns, n_vars);
+        std::unique_ptr<FEBase> fe(FEBase::build(dim, FEType(interp_order, LAGRANGE)));
+        const std::vector<libMesh::Point>& q_point = fe->get_xyz();
+        std::unique_ptr<QBase> qrule = QBase::build(QGAUSS, dim, quad_order);
+        fe->attach_quadrature_rule(qrule.get());
+        const int k_begin = (chunk * num_patches) / num_chunks;
+        const int k_end = ((chunk + 1) * num_patches) / num_chunks;
+        for (int k = k_begin; k < k_end; ++k)
+        {
+            const Node& node = mesh.node(patch_its[k]->first);
+            F.setZero();
+            for (const auto& patch_elem : patch_its[k]->second)
+            {
+                const Elem* const elem = patch_elem.template get<0>();
+                const CompositePeriodicMapping& inverse_mapping = patch_elem.template get<2>();
+                const int global_offset = elem_qp_global_offset[elem->id()];
+                fe->reinit(elem);
+                for (unsigned int qp = 0; qp < qrule->n_points(); ++qp)
+                {
+                    evaluate_polynomial_basis_fcns(
+                        P, node, apply_composite_periodic_mapping(inverse_mapping, q_point[qp]), dim, interp_order);
+                    for (unsigned int var = 0; var < n_vars; ++var)
+                    {
+                        F.col(var) += P * qp_vals[n_vars * (global_offset + qp) + var];
+                    }
+                }
+            }
+
+            // Solve for the coefficients of the reconstructions and evaluate
+            // them at the node.
+            A = patch_proj_solvers[k].solve(F);
+            for (unsigned int var = 0; var < n_vars; ++var)
+            {
+                nodal_vals[n_vars * k + var] = A(0, var);
+            }
+        }
+    });
+    return nodal_vals;
+} // project_elem_patches
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -499,45 +577,24 @@ IBFEPatchRecoveryPostProcessor::reconstructCauchyStress(System& sigma_system)
     comm.sum(sigma_vals);
 
     // Perform element patch L2 projections.
-    const unsigned int dim = d_mesh->mesh_dimension();
-    const unsigned int num_basis_fcns = num_polynomial_basis_fcns(dim, d_interp_order);
-    Eigen::VectorXd P(num_basis_fcns), a(num_basis_fcns), f(num_basis_fcns);
-    std::unique_ptr<FEBase> fe(FEBase::build(dim, FEType(d_interp_order, LAGRANGE)));
-    const std::vector<libMesh::Point>& q_point = fe->get_xyz();
-    std::unique_ptr<QBase> qrule = QBase::build(QGAUSS, dim, d_quad_order);
-    fe->attach_quadrature_rule(qrule.get());
+    const std::vector<double> nodal_vals = project_elem_patches(d_local_elem_patches,
+                                                                d_local_patch_proj_solver,
+                                                                d_elem_qp_global_offset,
+                                                                sigma_vals,
+                                                                NVARS,
+                                                                *d_mesh,
+                                                                d_interp_order,
+                                                                d_quad_order);
     unsigned int k = 0;
     for (std::map<dof_id_type, ElemPatch>::const_iterator it = d_local_elem_patches.begin();
          it != d_local_elem_patches.end();
          ++it, ++k)
     {
-        const dof_id_type node_id = it->first;
-        const Node& node = d_mesh->node(node_id);
-        const ElemPatch& elem_patch = it->second;
-        Eigen::ColPivHouseholderQR<Eigen::MatrixXd>& patch_proj_solver = d_local_patch_proj_solver[k];
+        const Node& node = d_mesh->node(it->first);
         for (unsigned int var = 0; var < NVARS; ++var)
         {
-            // Solve for the coefficients of the reconstruction.
-            f.setZero();
-            for (ElemPatch::const_iterator el_it = elem_patch.begin(); el_it != elem_patch.end(); ++el_it)
-            {
-                const Elem* const elem = el_it->get<0>();
-                const CompositePeriodicMapping& inverse_mapping = el_it->get<2>();
-                const dof_id_type elem_id = elem->id();
-                const int global_offset = d_elem_qp_global_offset[elem_id];
-                fe->reinit(elem);
-                for (unsigned int qp = 0; qp < qrule->n_points(); ++qp)
-                {
-                    evaluate_polynomial_basis_fcns(
-                        P, node, apply_composite_periodic_mapping(inverse_mapping, q_point[qp]), dim, d_interp_order);
-                    f += P * sigma_vals[NVARS * (global_offset + qp) + var];
-                }
-            }
-            a = patch_proj_solver.solve(f);
-
-            // Evaluate the reconstruction at the node.
             const int dof_index = node.dof_number(sigma_sys_num, var, 0);
-            sigma_vec.set(dof_index, a(0));
+            sigma_vec.set(dof_index, nodal_vals[NVARS * k + var]);
         }
     }
     return;
@@ -567,45 +624,22 @@ IBFEPatchRecoveryPostProcessor::reconstructPressure(System& p_system)
     comm.sum(pressure_vals);
 
     // Perform element patch L2 projections.
-    const unsigned int dim = d_mesh->mesh_dimension();
-    const unsigned int num_basis_fcns = num_polynomial_basis_fcns(dim, d_interp_order);
-    Eigen::VectorXd P(num_basis_fcns), a(num_basis_fcns), f(num_basis_fcns);
-    std::unique_ptr<FEBase> fe(FEBase::build(dim, FEType(d_interp_order, LAGRANGE)));
-    const std::vector<libMesh::Point>& q_point = fe->get_xyz();
-    std::unique_ptr<QBase> qrule = QBase::build(QGAUSS, dim, d_quad_order);
-    fe->attach_quadrature_rule(qrule.get());
+    const std::vector<double> nodal_vals = project_elem_patches(d_local_elem_patches,
+                                                                d_local_patch_proj_solver,
+                                                                d_elem_qp_global_offset,
+                                                                pressure_vals,
+                                                                1,
+                                                                *d_mesh,
+                                                                d_interp_order,
+                                                                d_quad_order);
     unsigned int k = 0;
     for (std::map<dof_id_type, ElemPatch>::const_iterator it = d_local_elem_patches.begin();
          it != d_local_elem_patches.end();
          ++it, ++k)
     {
-        const dof_id_type node_id = it->first;
-        const Node& node = d_mesh->node(node_id);
-        const ElemPatch& elem_patch = it->second;
-        Eigen::ColPivHouseholderQR<Eigen::MatrixXd>& patch_proj_solver = d_local_patch_proj_solver[k];
-
-        // Solve for the coefficients of the reconstruction.
-        f.setZero();
-        for (ElemPatch::const_iterator el_it = elem_patch.begin(); el_it != elem_patch.end(); ++el_it)
-        {
-            const Elem* const elem = el_it->get<0>();
-            const CompositePeriodicMapping& inverse_mapping = el_it->get<2>();
-            const dof_id_type elem_id = elem->id();
-            const int global_offset = d_elem_qp_global_offset[elem_id];
-            fe->reinit(elem);
-            for (unsigned int qp = 0; qp < qrule->n_points(); ++qp)
-            {
-                evaluate_polynomial_basis_fcns(
-                    P, node, apply_composite_periodic_mapping(inverse_mapping, q_point[qp]), dim, d_interp_order);
-                f += P * pressure_vals[global_offset + qp];
-            }
-        }
-        a = patch_proj_solver.solve(f);
-
-        // Evaluate the reconstruction at the node.
         const unsigned int var = 0;
-        const int dof_index = node.dof_number(p_sys_num, var, 0);
-        p_vec.set(dof_index, a(0));
+        const int dof_index = d_mesh->node(it->first).dof_number(p_sys_num, var, 0);
+        p_vec.set(dof_index, nodal_vals[k]);
     }
     return;
 } // reconstructPressure
@@ -86,6 +86,7 @@ IBFEPostProcessor::registerScalarVariable(const std::string& name,
     d_scalar_var_system_data.push_back(system_data);
     d_scalar_var_fcn_ctxs.push_back(fcn_ctx);
     d_var_systems.push_back(&system);
+    d_data_is_stale = true;
     return;
 } // registerScalarVariable
 
@@ -112,6 +113,7 @@ IBFEPostProcessor::registerVectorVariable(const std::string& name,
     d_vector_var_fcn_ctxs.push_back(fcn_ctx);
     d_vector_var_dims.push_back(dim);
     d_var_systems.push_back(&system);
+    d_data_is_stale = true;
     return;
 } // registerVectorVariable
 
@@ -143,6 +145,7 @@ IBFEPostProcessor::registerTensorVariable(const std::string& var_name,
     d_tensor_var_fcn_ctxs.push_back(var_fcn_ctx);
     d_tensor_var_dims.push_back(var_dim);
     d_var_systems.push_back(&system);
+    d_data_is_stale = true;
     return;
 } // registerTensorVariable
 
@@ -188,6 +191,7 @@ IBFEPostProcessor::registerInterpolatedScalarEulerianVariable(
     d_scalar_interp_fill_transactions.push_back(ghost_fill_transaction);
     d_scalar_interp_specs.push_back(interp_spec);
     d_var_systems.push_back(&system);
+    d_data_is_stale = true;
 } // registerInterpolatedEulerianScalarVariable
 
 void
@@ -201,16 +205,42 @@ IBFEPostProcessor::initializeFEData()
         system.assemble();
     }
     d_fe_data_initialized = true;
+    d_data_is_stale = true;
     return;
 } // initializeFEData
 
 void
-IBFEPostProcessor::postProcessData(const double data_time)
+IBFEPostProcessor::markDataStale(const double data_time)
+{
+    d_data_is_stale = true;
+    d_data_time = data_time;
+    return;
+} // markDataStale
+
+bool
+IBFEPostProcessor::isDataStale() const
+{
+    return d_data_is_stale;
+} // isDataStale
+
+void
+IBFEPostProcessor::updateData()
 {
+    if (!d_data_is_stale) return;
+
     // First interpolate variables from the Eulerian grid, then reconstruct
     // variables on the Lagrangian mesh.
-    interpolateVariables(data_time);
-    reconstructVariables(data_time);
+    interpolateVariables(d_data_time);
+    reconstructVariables(d_data_time);
+    d_data_is_stale = false;
+    return;
+} // updateData
+
+void
+IBFEPostProcessor::postProcessData(const double data_time)
+{
+    if (data_time != d_data_time) markDataStale(data_time);
+    updateData();
     return;
 } // postProcessData
 
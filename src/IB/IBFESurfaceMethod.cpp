@@ -594,9 +594,11 @@ IBFESurfaceMethod::interpolateVelocity(const int u_data_idx,
         std::unique_ptr<NumericVector<double> > U_t_rhs_vec = U_t_vec->zero_clone();
         std::vector<DenseVector<double> > U_t_rhs_e(NDIM);
         boost::multi_array<double, 2> X_node, x_node;
-        std::vector<double> U_qp, x_qp;
-        VectorValue<double> U, U_n, U_t, N, n;
-        std::array<VectorValue<double>, 2> dX_dxi, dx_dxi;
+        std::vector<double> U_qp, x_qp, phi_JxW_qp;
+        std::vector<VectorValue<double> > N_qp;
+        std::vector<unsigned int> elem_n_qp;
+        VectorValue<double> U, U_n, U_t, N;
+        std::array<VectorValue<double>, 2> dX_dxi;
 
         std::vector<libMesh::dof_id_type> dof_id_scratch;
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_fe_data_managers[part]->getLevelNumber());
@@ -614,29 +616,20 @@ IBFESurfaceMethod::interpolateVelocity(const int u_data_idx,
             const double* const patch_dx = patch_geom->getDx();
             const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
 
-            // Setup vectors to store the values of F and X at the quadrature
-            // points.
-            unsigned int n_qp_patch = 0;
-            for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
-            {
-                Elem* const elem = patch_elems[e_idx];
-                const auto& X_dof_indices = X_dof_map_cache.dof_indices(elem);
-                get_values_for_interpolation(x_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-                FEDataManager::updateInterpQuadratureRule(qrule, d_default_interp_spec, elem, x_node, patch_dx_min);
-                n_qp_patch += qrule->n_points();
-            }
-            if (!n_qp_patch) continue;
-            U_qp.resize(NDIM * n_qp_patch);
-            x_qp.resize(NDIM * n_qp_patch);
-            std::fill(U_qp.begin(), U_qp.end(), 0.0);
-
-            // Loop over the elements and compute the positions of the quadrature points.
+            // Loop over the elements and compute the positions of the quadrature
+            // points.  The reference unit normals and the products of the basis
+            // functions with the JxW values are stored along with the positions
+            // so that each element is reinitialized only once.
+            x_qp.clear();
+            N_qp.clear();
+            phi_JxW_qp.clear();
+            elem_n_qp.resize(num_active_patch_elems);
             qrule.reset();
-            unsigned int qp_offset = 0;
             for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
             {
                 Elem* const elem = patch_elems[e_idx];
                 const auto& X_dof_indices = X_dof_map_cache.dof_indices(elem);
+                get_values_for_interpolation(X_node, *X0_vec, X_dof_indices);
                 get_values_for_interpolation(x_node, *X_petsc_vec, X_local_soln, X_dof_indices);
                 const bool qrule_changed =
                     FEDataManager::updateInterpQuadratureRule(qrule, d_default_interp_spec, elem, x_node, patch_dx_min);
@@ -644,21 +637,37 @@ IBFESurfaceMethod::interpolateVelocity(const int u_data_idx,
                 fe->reinit(elem);
                 const unsigned int n_node = elem->n_nodes();
                 const unsigned int n_qp = qrule->n_points();
-                double* x_begin = &x_qp[NDIM * qp_offset];
-                std::fill(x_begin, x_begin + NDIM * n_qp, 0.0);
-                for (unsigned int k = 0; k < n_node; ++k)
+                const size_t n_basis = phi.size();
+                elem_n_qp[e_idx] = n_qp;
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
                 {
-                    for (unsigned int qp = 0; qp < n_qp; ++qp)
+                    for (unsigned int d = 0; d < NDIM; ++d)
                     {
-                        const double& p = phi[k][qp];
-                        for (unsigned int d = 0; d < NDIM; ++d)
+                        double x = 0.0;
+                        for (unsigned int k = 0; k < n_node; ++k)
                         {
-                            x_qp[NDIM * (qp_offset + qp) + d] += x_node[k][d] * p;
+                            x += x_node[k][d] * phi[k][qp];
                         }
+                        x_qp.push_back(x);
+                    }
+                    for (unsigned int k = 0; k < NDIM - 1; ++k)
+                    {
+                        interpolate(dX_dxi[k], qp, X_node, *dphi_dxi[k]);
+                    }
+                    if (NDIM == 2)
+                    {
+                        dX_dxi[1] = VectorValue<double>(0.0, 0.0, 1.0);
+                    }
+                    N_qp.push_back((dX_dxi[0].cross(dX_dxi[1])).unit());
+                    for (unsigned int k = 0; k < n_basis; ++k)
+                    {
+                        phi_JxW_qp.push_back(phi[k][qp] * JxW[qp]);
                     }
                 }
-                qp_offset += n_qp;
             }
+            if (x_qp.empty()) continue;
+            U_qp.resize(x_qp.size());
+            std::fill(U_qp.begin(), U_qp.end(), 0.0);
 
             // Interpolate values from the Cartesian grid patch to the
             // quadrature points.
@@ -681,41 +690,23 @@ IBFESurfaceMethod::interpolateVelocity(const int u_data_idx,
             }
 
             // Loop over the elements and accumulate the right-hand-side values.
-            qrule.reset();
-            qp_offset = 0;
+            unsigned int qp_offset = 0;
+            size_t phi_JxW_offset = 0;
             for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
             {
                 Elem* const elem = patch_elems[e_idx];
                 const auto& U_dof_indices = U_dof_map_cache.dof_indices(elem);
-                const auto& X_dof_indices = X_dof_map_cache.dof_indices(elem);
                 for (unsigned int d = 0; d < NDIM; ++d)
                 {
                     U_rhs_e[d].resize(static_cast<int>(U_dof_indices[d].size()));
                     U_n_rhs_e[d].resize(static_cast<int>(U_dof_indices[d].size()));
                     U_t_rhs_e[d].resize(static_cast<int>(U_dof_indices[d].size()));
                 }
-                get_values_for_interpolation(X_node, *X0_vec, X_dof_indices);
-                get_values_for_interpolation(x_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-                const bool qrule_changed =
-                    FEDataManager::updateInterpQuadratureRule(qrule, d_default_interp_spec, elem, x_node, patch_dx_min);
-                if (qrule_changed) fe->attach_quadrature_rule(qrule.get());
-                fe->reinit(elem);
-                const unsigned int n_qp = qrule->n_points();
+                const unsigned int n_qp = elem_n_qp[e_idx];
                 const size_t n_basis = U_dof_indices[0].size();
                 for (unsigned int qp = 0; qp < n_qp; ++qp)
                 {
-                    for (unsigned int k = 0; k < NDIM - 1; ++k)
-                    {
-                        interpolate(dX_dxi[k], qp, X_node, *dphi_dxi[k]);
-                        interpolate(dx_dxi[k], qp, x_node, *dphi_dxi[k]);
-                    }
-                    if (NDIM == 2)
-                    {
-                        dX_dxi[1] = VectorValue<double>(0.0, 0.0, 1.0);
-                        dx_dxi[1] = VectorValue<double>(0.0, 0.0, 1.0);
-                    }
-                    N = (dX_dxi[0].cross(dX_dxi[1])).unit();
-                    n = (dx_dxi[0].cross(dx_dxi[1])).unit();
+                    N = N_qp[qp_offset + qp];
                     const int idx = NDIM * (qp_offset + qp);
                     for (unsigned int d = 0; d < NDIM; ++d)
                     {
@@ -723,9 +714,10 @@ IBFESurfaceMethod::interpolateVelocity(const int u_data_idx,
                     }
                     U_n = (U * N) * N;
                     U_t = U - U_n;
+                    const double* const phi_JxW = &phi_JxW_qp[phi_JxW_offset + qp * n_basis];
                     for (unsigned int k = 0; k < n_basis; ++k)
                     {
-                        const double p_JxW = phi[k][qp] * JxW[qp];
+                        const double p_JxW = phi_JxW[k];
                         for (unsigned int d = 0; d < NDIM; ++d)
                         {
                             U_rhs_e[d](k) += U(d) * p_JxW;
@@ -745,6 +737,7 @@ IBFESurfaceMethod::interpolateVelocity(const int u_data_idx,
                     U_t_rhs_vec->add_vector(U_t_rhs_e[d], dof_id_scratch);
                 }
                 qp_offset += n_qp;
+                phi_JxW_offset += n_qp * n_basis;
             }
         }
         U_rhs_vec->close();
@@ -943,6 +936,28 @@ IBFESurfaceMethod::computeLagrangianForce(const double data_time)
         std::vector<libMesh::dof_id_type> dof_id_scratch;
         const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
         const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
+
+        // The reference positions, unit normals, and area elements at the
+        // quadrature points do not depend on the current configuration and
+        // are cached.  They are recomputed only if the local elements have
+        // changed since they were last computed.
+        std::vector<dof_id_type> local_elem_ids;
+        for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+        {
+            local_elem_ids.push_back((*el_it)->id());
+        }
+        const bool update_reference_data = local_elem_ids != d_reference_elem_ids[part];
+        std::vector<VectorValue<double> >& X_ref_qp = d_reference_X_qp[part];
+        std::vector<VectorValue<double> >& N_ref_qp = d_reference_N_qp[part];
+        std::vector<double>& dA_ref_qp = d_reference_dA_qp[part];
+        if (update_reference_data)
+        {
+            d_reference_elem_ids[part].swap(local_elem_ids);
+            X_ref_qp.clear();
+            N_ref_qp.clear();
+            dA_ref_qp.clear();
+        }
+        unsigned int ref_qp_offset = 0;
         for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
         {
             Elem* const elem = *el_it;
@@ -961,29 +976,42 @@ IBFESurfaceMethod::computeLagrangianForce(const double data_time)
             fe_interpolator.collectDataForInterpolation(elem);
             fe_interpolator.interpolate(elem);
             get_values_for_interpolation(x_node, *X_vec, X_dof_indices);
-            get_values_for_interpolation(X_node, X0_vec, X_dof_indices);
             const unsigned int n_qp = qrule->n_points();
             const size_t n_basis = phi.size();
+            if (update_reference_data)
+            {
+                get_values_for_interpolation(X_node, X0_vec, X_dof_indices);
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    interpolate(X, qp, X_node, phi);
+                    for (unsigned int k = 0; k < NDIM - 1; ++k)
+                    {
+                        interpolate(dX_dxi[k], qp, X_node, *dphi_dxi[k]);
+                    }
+                    if (NDIM == 2) dX_dxi[1] = VectorValue<double>(0.0, 0.0, 1.0);
+                    N = dX_dxi[0].cross(dX_dxi[1]);
+                    X_ref_qp.push_back(X);
+                    dA_ref_qp.push_back(N.norm());
+                    N_ref_qp.push_back(N.unit());
+                }
+            }
             for (unsigned int qp = 0; qp < n_qp; ++qp)
             {
-                interpolate(X, qp, X_node, phi);
                 interpolate(x, qp, x_node, phi);
                 for (unsigned int k = 0; k < NDIM - 1; ++k)
                 {
-                    interpolate(dX_dxi[k], qp, X_node, *dphi_dxi[k]);
                     interpolate(dx_dxi[k], qp, x_node, *dphi_dxi[k]);
                 }
                 if (NDIM == 2)
                 {
-                    dX_dxi[1] = VectorValue<double>(0.0, 0.0, 1.0);
                     dx_dxi[1] = VectorValue<double>(0.0, 0.0, 1.0);
                 }
 
                 // Construct unit vectors in the reference and current
                 // configurations.
-                N = dX_dxi[0].cross(dX_dxi[1]);
-                const double dA = N.norm();
-                N = N.unit();
+                X = X_ref_qp[ref_qp_offset + qp];
+                N = N_ref_qp[ref_qp_offset + qp];
+                const double dA = dA_ref_qp[ref_qp_offset + qp];
                 n = dx_dxi[0].cross(dx_dxi[1]);
                 const double da = n.norm();
                 n = n.unit();
@@ -1063,6 +1091,8 @@ IBFESurfaceMethod::computeLagrangianForce(const double data_time)
                 }
             }
 
+            ref_qp_offset += n_qp;
+
             // Apply constraints (e.g., enforce periodic boundary conditions)
             // and add the elemental contributions to the global vector.
             for (unsigned int i = 0; i < NDIM; ++i)
@@ -2039,6 +2069,10 @@ IBFESurfaceMethod::commonConstructor(const std::string& object_name,
     d_lag_surface_pressure_fcn_data.resize(d_num_parts);
     d_lag_surface_force_fcn_data.resize(d_num_parts);
     d_lag_surface_force_integral.resize(d_num_parts);
+    d_reference_elem_ids.resize(d_num_parts);
+    d_reference_X_qp.resize(d_num_parts);
+    d_reference_N_qp.resize(d_num_parts);
+    d_reference_dA_qp.resize(d_num_parts);
 
     // Determine whether we should use first-order or second-order shape
     // functions for each part of the structure.
@@ -214,8 +214,14 @@ IBHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHierarchy<NDIM
     const IntVector<NDIM> ib_ghosts = d_ib_method_ops->getMinimumGhostCellWidth();
     const IntVector<NDIM> ghosts = 1;
 
-    d_u_idx = var_db->registerVariableAndContext(d_u_var, d_ib_context, ib_ghosts);
-    d_f_idx = var_db->registerVariableAndContext(d_f_var, d_ib_context, ib_ghosts);
+    // The velocity and force data used by the IB method are only read by
+    // interpolation and written by spreading, respectively, so their ghost cell
+    // widths are set by the corresponding kernel functions. This keeps their
+    // ghost cell fills as narrow as possible.
+    d_u_idx = var_db->registerVariableAndContext(
+        d_u_var, d_ib_context, d_ib_method_ops->getMinimumGhostCellWidthForInterpolation());
+    d_f_idx = var_db->registerVariableAndContext(
+        d_f_var, d_ib_context, d_ib_method_ops->getMinimumGhostCellWidthForSpreading());
     switch (d_time_stepping_type)
     {
     case FORWARD_EULER:
@@ -514,7 +520,17 @@ IBHierarchyIntegrator::atRegridPointSpecialized() const
     if (initial_time) return true;
     if (d_regrid_cfl_interval > 0.0)
     {
-        return (d_regrid_cfl_estimate >= d_regrid_cfl_interval);
+        // The CFL criterion ensures that the structure does not leave the
+        // refined region, so it remains in effect if the regrid interval is
+        // also chosen adaptively.  The estimate is updated when the CFL
+        // numbers are reduced, so reduce any that are still pending.
+        getDiagnosticsCollector().flush();
+        if (d_regrid_cfl_estimate >= d_regrid_cfl_interval) return true;
+        return d_adaptive_regrid_interval && atAdaptiveRegridPoint();
+    }
+    else if (d_adaptive_regrid_interval)
+    {
+        return atAdaptiveRegridPoint();
     }
     else if (d_regrid_interval != 0)
     {
@@ -622,6 +638,7 @@ IBHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Database> db)
     db->putInteger("IB_HIERARCHY_INTEGRATOR_VERSION", IB_HIERARCHY_INTEGRATOR_VERSION);
     db->putString("d_time_stepping_type", enum_to_string<TimeSteppingType>(d_time_stepping_type));
     db->putDouble("d_regrid_cfl_interval", d_regrid_cfl_interval);
+    getDiagnosticsCollector().flush();
     db->putDouble("d_regrid_cfl_estimate", d_regrid_cfl_estimate);
     return;
 } // putToDatabaseSpecialized
@@ -60,9 +60,11 @@
 #include "Eigen/Core"
 #include "Eigen/src/Geometry/OrthoMethods.h"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <fstream>
+#include <vector>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -313,8 +315,7 @@ IBHydrodynamicForceEvaluator::computeLaggedMomentumIntegral(
     Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
     const std::vector<RobinBcCoefStrategy<NDIM>*>& u_src_bc_coef)
 {
-    resetFaceAreaWeight(patch_hierarchy);
-    resetFaceVolWeight(patch_hierarchy);
+    resetWeights(patch_hierarchy);
     fillPatchData(u_old_idx, -1, patch_hierarchy, u_src_bc_coef, nullptr, d_current_time);
 
     const int coarsest_ln = 0;
@@ -334,34 +335,46 @@ IBHydrodynamicForceEvaluator::computeLaggedMomentumIntegral(
         // Compute the rotational momentum integral:= (rho * r x u * dv) for the previous time step (integral is over
         // new control volume)
         fobj.L_box_current.setZero();
+    }
+
+    // Coordinate of the side index and r vector needed for cross product
+    IBTK::Vector3d side_coord, r_vec;
+
+    // The integrals of all structures are accumulated in a single traversal of
+    // the hierarchy.
+    for (int ln = finest_ln; ln >= coarsest_ln; --ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
 
-        // Coordinate of the side index and r vector needed for cross product
-        IBTK::Vector3d side_coord, r_vec;
+        // Determine the control volumes of all structures on this level along
+        // with their bounding box, which is used to skip patches that do not
+        // intersect any of the control volumes.
+        const std::vector<Box<NDIM> > integration_boxes = getIntegrationBoxes(level);
+        Box<NDIM> bounding_box;
+        for (const auto& integration_box : integration_boxes) bounding_box += integration_box;
 
-        for (int ln = finest_ln; ln >= coarsest_ln; --ln)
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
-            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
-            Box<NDIM> integration_box(
-                IndexUtilities::getCellIndex(fobj.box_X_lower_new.data(), level->getGridGeometry(), level->getRatio()),
-                IndexUtilities::getCellIndex(fobj.box_X_upper_new.data(), level->getGridGeometry(), level->getRatio()));
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            if (!patch_box.intersects(bounding_box)) continue;
 
-            // Shorten the integration box so it only includes the control volume
-            integration_box.upper() -= 1;
+            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+            const double* const patch_dx = patch_geom->getDx();
 
-            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            // Loop over the control volumes and compute momentum.
+            Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(d_u_idx);
+            Pointer<SideData<NDIM, double> > vol_sc_data = patch->getPatchData(d_vol_wgt_sc_idx);
+            auto box_it = integration_boxes.begin();
+            for (auto& hydro_obj : d_hydro_objs)
             {
-                Pointer<Patch<NDIM> > patch = level->getPatch(p());
-                const Box<NDIM>& patch_box = patch->getBox();
-                const bool boxes_intersect = patch_box.intersects(integration_box);
-                if (!boxes_intersect) continue;
+                IBHydrodynamicForceObject& fobj = hydro_obj.second;
+                const Box<NDIM>& integration_box = *box_it++;
+                if (!patch_box.intersects(integration_box)) continue;
 
                 // Part of the box on this patch.
                 Box<NDIM> trim_box = patch_box * integration_box;
 
-                // Loop over the box and compute momentum.
-                Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(d_u_idx);
-                Pointer<SideData<NDIM, double> > vol_sc_data = patch->getPatchData(d_vol_wgt_sc_idx);
-
                 for (int axis = 0; axis < NDIM; ++axis)
                 {
                     for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(trim_box, axis)); b; b++)
@@ -401,8 +414,6 @@ IBHydrodynamicForceEvaluator::computeLaggedMomentumIntegral(
                              * If vol == 0, don't change anything
                              */
 
-                            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-                            const double* const patch_dx = patch_geom->getDx();
                             const double box_edge_dV = 0.5 * patch_dx[0] * patch_dx[1]
 #if (NDIM == 3)
                                                        * patch_dx[2]
@@ -445,9 +456,25 @@ IBHydrodynamicForceEvaluator::computeLaggedMomentumIntegral(
                 }
             }
         }
+    }
 
-        SAMRAI_MPI::sumReduction(fobj.P_box_current.data(), 3);
-        SAMRAI_MPI::sumReduction(fobj.L_box_current.data(), 3);
+    // Sum the integrals of all structures with a single reduction.
+    std::vector<double> integrals;
+    integrals.reserve(6 * d_hydro_objs.size());
+    for (const auto& hydro_obj : d_hydro_objs)
+    {
+        const IBHydrodynamicForceObject& fobj = hydro_obj.second;
+        integrals.insert(integrals.end(), fobj.P_box_current.data(), fobj.P_box_current.data() + 3);
+        integrals.insert(integrals.end(), fobj.L_box_current.data(), fobj.L_box_current.data() + 3);
+    }
+    if (!integrals.empty()) SAMRAI_MPI::sumReduction(integrals.data(), static_cast<int>(integrals.size()));
+    auto integral_it = integrals.cbegin();
+    for (auto& hydro_obj : d_hydro_objs)
+    {
+        IBHydrodynamicForceObject& fobj = hydro_obj.second;
+        std::copy(integral_it, integral_it + 3, fobj.P_box_current.data());
+        std::copy(integral_it + 3, integral_it + 6, fobj.L_box_current.data());
+        integral_it += 6;
     }
 
     return;
@@ -482,8 +509,7 @@ IBHydrodynamicForceEvaluator::computeHydrodynamicForce(int u_idx,
                                                        const std::vector<RobinBcCoefStrategy<NDIM>*>& u_src_bc_coef,
                                                        RobinBcCoefStrategy<NDIM>* p_src_bc_coef)
 {
-    resetFaceAreaWeight(patch_hierarchy);
-    resetFaceVolWeight(patch_hierarchy);
+    resetWeights(patch_hierarchy);
     fillPatchData(u_idx, p_idx, patch_hierarchy, u_src_bc_coef, p_src_bc_coef, d_current_time + dt);
 
     const int coarsest_ln = 0;
@@ -502,34 +528,55 @@ IBHydrodynamicForceEvaluator::computeHydrodynamicForce(int u_idx,
         // Compute the rotational momentum integral:= (rho * r x u * dv) for the new time step (integral is over new
         // control volume)
         fobj.L_box_new.setZero();
+    }
 
-        // Coordinate of the side index and r vector needed for cross product
-        IBTK::Vector3d side_coord, r_vec;
+    // Surface integral terms of each structure.
+    std::vector<IBTK::Vector3d> tracs(d_hydro_objs.size(), IBTK::Vector3d::Zero());
+    std::vector<IBTK::Vector3d> torque_tracs(d_hydro_objs.size(), IBTK::Vector3d::Zero());
 
-        for (int ln = finest_ln; ln >= coarsest_ln; --ln)
-        {
-            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
-            Box<NDIM> integration_box(
-                IndexUtilities::getCellIndex(fobj.box_X_lower_new.data(), level->getGridGeometry(), level->getRatio()),
-                IndexUtilities::getCellIndex(fobj.box_X_upper_new.data(), level->getGridGeometry(), level->getRatio()));
+    // Coordinate of the side index and r vector needed for cross product
+    IBTK::Vector3d side_coord, r_vec;
+
+    // The volume and surface integrals of all structures are accumulated in a
+    // single traversal of the hierarchy.
+    for (int ln = finest_ln; ln >= coarsest_ln; --ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
 
-            // Shorten the integration box so it only includes the control volume
-            integration_box.upper() -= 1;
+        // Determine the control volumes of all structures on this level along
+        // with their bounding box, which is used to skip patches that do not
+        // intersect any of the control volumes.
+        const std::vector<Box<NDIM> > integration_boxes = getIntegrationBoxes(level);
+        Box<NDIM> bounding_box;
+        for (const auto& integration_box : integration_boxes) bounding_box += integration_box;
 
-            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            if (!patch_box.intersects(bounding_box)) continue;
+
+            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+            const double* const patch_dx = patch_geom->getDx();
+
+            Pointer<CellData<NDIM, double> > p_data = patch->getPatchData(d_p_idx);
+            Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(d_u_idx);
+            Pointer<SideData<NDIM, double> > vol_sc_data = patch->getPatchData(d_vol_wgt_sc_idx);
+            Pointer<SideData<NDIM, double> > face_sc_data = patch->getPatchData(d_face_wgt_sc_idx);
+            auto box_it = integration_boxes.begin();
+            unsigned int k = 0;
+            for (auto& hydro_obj : d_hydro_objs)
             {
-                Pointer<Patch<NDIM> > patch = level->getPatch(p());
-                const Box<NDIM>& patch_box = patch->getBox();
-                const bool boxes_intersect = patch_box.intersects(integration_box);
-                if (!boxes_intersect) continue;
+                IBHydrodynamicForceObject& fobj = hydro_obj.second;
+                IBTK::Vector3d& trac = tracs[k];
+                IBTK::Vector3d& torque_trac = torque_tracs[k];
+                ++k;
+                const Box<NDIM>& integration_box = *box_it++;
+                if (!patch_box.intersects(integration_box)) continue;
 
                 // Part of the box on this patch.
                 Box<NDIM> trim_box = patch_box * integration_box;
 
-                // Loop over the box and compute momentum.
-                Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(d_u_idx);
-                Pointer<SideData<NDIM, double> > vol_sc_data = patch->getPatchData(d_vol_wgt_sc_idx);
-
                 for (int axis = 0; axis < NDIM; ++axis)
                 {
                     for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(trim_box, axis)); b; b++)
@@ -568,8 +615,6 @@ IBHydrodynamicForceEvaluator::computeHydrodynamicForce(int u_idx,
                              * If vol == 0, don't change anything
                              */
 
-                            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-                            const double* const patch_dx = patch_geom->getDx();
                             const double box_edge_dV = 0.5 * patch_dx[0] * patch_dx[1]
 #if (NDIM == 3)
                                                        * patch_dx[2]
@@ -610,35 +655,6 @@ IBHydrodynamicForceEvaluator::computeHydrodynamicForce(int u_idx,
                         }
                     }
                 }
-            }
-        }
-
-        SAMRAI_MPI::sumReduction(fobj.P_box_new.data(), 3);
-        SAMRAI_MPI::sumReduction(fobj.L_box_new.data(), 3);
-
-        // Compute surface integral term.
-        IBTK::Vector3d trac, torque_trac;
-        trac.setZero();
-        torque_trac.setZero();
-
-        for (int ln = finest_ln; ln >= coarsest_ln; --ln)
-        {
-            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
-            Box<NDIM> integration_box(
-                IndexUtilities::getCellIndex(fobj.box_X_lower_new.data(), level->getGridGeometry(), level->getRatio()),
-                IndexUtilities::getCellIndex(fobj.box_X_upper_new.data(), level->getGridGeometry(), level->getRatio()));
-
-            // Shorten the integration box so it only includes the control volume
-            integration_box.upper() -= 1;
-
-            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-            {
-                Pointer<Patch<NDIM> > patch = level->getPatch(p());
-                const Box<NDIM>& patch_box = patch->getBox();
-                const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-                const double* const patch_dx = patch_geom->getDx();
-                const bool boxes_intersect = patch_box.intersects(integration_box);
-                if (!boxes_intersect) continue;
 
                 // Store boxes corresponding to integration domain boundaries.
                 std::array<std::array<Box<NDIM>, 2>, NDIM> bdry_boxes;
@@ -658,9 +674,6 @@ IBHydrodynamicForceEvaluator::computeHydrodynamicForce(int u_idx,
                 }
 
                 // Integrate over boundary boxes.
-                Pointer<CellData<NDIM, double> > p_data = patch->getPatchData(d_p_idx);
-                Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(d_u_idx);
-                Pointer<SideData<NDIM, double> > face_sc_data = patch->getPatchData(d_face_wgt_sc_idx);
                 for (int axis = 0; axis < NDIM; ++axis)
                 {
                     for (int upperlower = 0; upperlower <= 1; ++upperlower)
@@ -771,8 +784,33 @@ IBHydrodynamicForceEvaluator::computeHydrodynamicForce(int u_idx,
                 }
             }
         }
-        SAMRAI_MPI::sumReduction(trac.data(), 3);
-        SAMRAI_MPI::sumReduction(torque_trac.data(), 3);
+    }
+
+    // Sum the integrals of all structures with a single reduction.
+    std::vector<double> integrals;
+    integrals.reserve(12 * d_hydro_objs.size());
+    unsigned int k = 0;
+    for (const auto& hydro_obj : d_hydro_objs)
+    {
+        const IBHydrodynamicForceObject& fobj = hydro_obj.second;
+        integrals.insert(integrals.end(), fobj.P_box_new.data(), fobj.P_box_new.data() + 3);
+        integrals.insert(integrals.end(), fobj.L_box_new.data(), fobj.L_box_new.data() + 3);
+        integrals.insert(integrals.end(), tracs[k].data(), tracs[k].data() + 3);
+        integrals.insert(integrals.end(), torque_tracs[k].data(), torque_tracs[k].data() + 3);
+        ++k;
+    }
+    if (!integrals.empty()) SAMRAI_MPI::sumReduction(integrals.data(), static_cast<int>(integrals.size()));
+
+    auto integral_it = integrals.cbegin();
+    for (auto& hydro_obj : d_hydro_objs)
+    {
+        IBHydrodynamicForceObject& fobj = hydro_obj.second;
+        IBTK::Vector3d trac, torque_trac;
+        std::copy(integral_it, integral_it + 3, fobj.P_box_new.data());
+        std::copy(integral_it + 3, integral_it + 6, fobj.L_box_new.data());
+        std::copy(integral_it + 6, integral_it + 9, trac.data());
+        std::copy(integral_it + 9, integral_it + 12, torque_trac.data());
+        integral_it += 12;
 
         // Compute hydrodynamic force on the body : -integral_{box_new} (rho du/dt) + d/dt(rho u)_body + trac
         fobj.F_new = -(fobj.P_box_new - fobj.P_box_current) / dt + (fobj.P_new - fobj.P_current) / dt + trac;
@@ -979,6 +1017,52 @@ IBAMR::IBHydrodynamicForceEvaluator::updateStructurePlotData(Pointer<PatchHierar
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+IBHydrodynamicForceEvaluator::resetWeights(Pointer<PatchHierarchy<NDIM> > patch_hierarchy)
+{
+    // The weights depend only on the configuration of the patch hierarchy and
+    // not on the positions of the control volumes, so they only need to be
+    // recomputed after the hierarchy has been regridded.
+    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+    std::vector<Pointer<PatchLevel<NDIM> > > levels(finest_ln + 1);
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        levels[ln] = patch_hierarchy->getPatchLevel(ln);
+    }
+    bool levels_changed = levels.size() != d_wgt_levels.size();
+    for (unsigned int ln = 0; !levels_changed && ln < levels.size(); ++ln)
+    {
+        levels_changed = levels[ln].getPointer() != d_wgt_levels[ln].getPointer();
+    }
+    if (!levels_changed) return;
+
+    resetFaceAreaWeight(patch_hierarchy);
+    resetFaceVolWeight(patch_hierarchy);
+    d_wgt_levels = levels;
+    return;
+
+} // resetWeights
+
+std::vector<Box<NDIM> >
+IBHydrodynamicForceEvaluator::getIntegrationBoxes(Pointer<PatchLevel<NDIM> > level) const
+{
+    std::vector<Box<NDIM> > integration_boxes;
+    integration_boxes.reserve(d_hydro_objs.size());
+    for (const auto& hydro_obj : d_hydro_objs)
+    {
+        const IBHydrodynamicForceObject& fobj = hydro_obj.second;
+        Box<NDIM> integration_box(
+            IndexUtilities::getCellIndex(fobj.box_X_lower_new.data(), level->getGridGeometry(), level->getRatio()),
+            IndexUtilities::getCellIndex(fobj.box_X_upper_new.data(), level->getGridGeometry(), level->getRatio()));
+
+        // Shorten the integration box so it only includes the control volume
+        integration_box.upper() -= 1;
+        integration_boxes.push_back(integration_box);
+    }
+    return integration_boxes;
+
+} // getIntegrationBoxes
+
 void
 IBHydrodynamicForceEvaluator::resetFaceAreaWeight(Pointer<PatchHierarchy<NDIM> > patch_hierarchy)
 {
@@ -52,7 +52,9 @@
 
 #include "Eigen/Core"
 
+#include <algorithm>
 #include <fstream>
+#include <limits>
 #include <utility>
 #include <vector>
 
@@ -271,6 +273,20 @@ IBHydrodynamicSurfaceForceEvaluator::computeHydrodynamicForceTorque(IBTK::Vector
             Pointer<CellData<NDIM, double> > mu_data;
             if (!d_mu_is_const) mu_data = patch->getPatchData(d_mu_idx);
 
+            // Skip patches that do not intersect the narrow band around the
+            // surface of the body.  The side loop below reads the level set in
+            // the cells adjacent to the patch, so those are included.
+            const Box<NDIM> ls_box = Box<NDIM>::grow(patch_box, IntVector<NDIM>(1));
+            double phi_min = std::numeric_limits<double>::max();
+            double phi_max = -std::numeric_limits<double>::max();
+            for (Box<NDIM>::Iterator it(ls_box); it; it++)
+            {
+                const double phi = (*ls_solid_data)(it());
+                phi_min = std::min(phi_min, phi);
+                phi_max = std::max(phi_max, phi);
+            }
+            if (phi_min > d_surface_contour_value || phi_max < d_surface_contour_value) continue;
+
             auto signof = [](const double x) { return x > 0.0 ? 1.0 : (x < 0.0 ? -1.0 : 0.0); };
 
             for (unsigned int axis = 0; axis < NDIM; ++axis)
@@ -423,51 +439,100 @@ IBHydrodynamicSurfaceForceEvaluator::fillPatchData(Pointer<PatchHierarchy<NDIM>
                                                    bool use_current_ctx,
                                                    bool use_new_ctx)
 {
-    // Fill ghost cells for level set
+#if !defined(NDEBUG)
+    TBOX_ASSERT(use_current_ctx || use_new_ctx);
+#endif
+    // The pressure boundary conditions are evaluated using the velocity that is
+    // filled together with the pressure.
+    auto p_ins_bc_coef = dynamic_cast<INSStaggeredPressureBcCoef*>(d_fluid_solver->getPressureBoundaryConditions());
+    auto p_vc_ins_bc_coef =
+        dynamic_cast<INSVCStaggeredPressureBcCoef*>(d_fluid_solver->getPressureBoundaryConditions());
+    if (p_ins_bc_coef)
+    {
+        p_ins_bc_coef->setTargetVelocityPatchDataIndex(d_u_idx);
+    }
+    else if (p_vc_ins_bc_coef)
+    {
+        p_vc_ins_bc_coef->setTargetVelocityPatchDataIndex(d_u_idx);
+    }
+    else
+    {
+        TBOX_ERROR(d_object_name << "::IBHydrodynamicSurfaceForceEvaluator():\n"
+                                 << " no valid pressure boundary condition object registered with INS integrator.\n"
+                                 << " This statement should not have been reached");
+    }
+
+    // The ghost cell interpolation objects are reused until the patch hierarchy
+    // is regridded, which replaces its levels.
+    const int ctx_num = use_current_ctx ? 0 : 1;
+    std::vector<Pointer<PatchLevel<NDIM> > > levels(patch_hierarchy->getFinestLevelNumber() + 1);
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        levels[ln] = patch_hierarchy->getPatchLevel(ln);
+    }
+    std::vector<Pointer<PatchLevel<NDIM> > >& fill_levels = d_hier_bdry_fill_levels[ctx_num];
+    bool levels_changed = levels.size() != fill_levels.size();
+    for (unsigned int ln = 0; !levels_changed && ln < levels.size(); ++ln)
+    {
+        levels_changed = levels[ln].getPointer() != fill_levels[ln].getPointer();
+    }
+    if (!d_hier_bdry_fill[ctx_num] || levels_changed)
+    {
+        d_hier_bdry_fill[ctx_num] =
+            buildGhostFill(patch_hierarchy, use_current_ctx, use_new_ctx, p_ins_bc_coef, p_vc_ins_bc_coef);
+        fill_levels = levels;
+    }
+
+    // Fill the ghost cells of all of the quantities at once.
+    d_hier_bdry_fill[ctx_num]->setHomogeneousBc(false);
+    d_hier_bdry_fill[ctx_num]->fillData(fill_time);
+    return;
+} // fillPatchData
+
+Pointer<HierarchyGhostCellInterpolation>
+IBHydrodynamicSurfaceForceEvaluator::buildGhostFill(Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                                                    bool use_current_ctx,
+                                                    bool use_new_ctx,
+                                                    RobinBcCoefStrategy<NDIM>* p_ins_bc_coef,
+                                                    RobinBcCoefStrategy<NDIM>* p_vc_ins_bc_coef)
+{
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
+    std::vector<InterpolationTransactionComponent> transaction_comps;
 
+    // Level set
     const int ls_solid_idx =
         use_current_ctx ?
             var_db->mapVariableAndContextToIndex(d_ls_solid_var, d_adv_diff_solver->getCurrentContext()) :
             use_new_ctx ? var_db->mapVariableAndContextToIndex(d_ls_solid_var, d_adv_diff_solver->getNewContext()) :
                           IBTK::invalid_index;
-    InterpolationTransactionComponent ls_solid_transaction(d_ls_solid_idx,
-                                                           ls_solid_idx,
-                                                           /*DATA_REFINE_TYPE*/ "CONSERVATIVE_LINEAR_REFINE",
-                                                           /*USE_CF_INTERPOLATION*/ true,
-                                                           /*DATA_COARSEN_TYPE*/ "CUBIC_COARSEN",
-                                                           /*BDRY_EXTRAP_TYPE*/ "LINEAR",
-                                                           /*CONSISTENT_TYPE_2_BDRY*/ false,
-                                                           d_adv_diff_solver->getPhysicalBcCoefs(d_ls_solid_var),
-                                                           Pointer<VariableFillPattern<NDIM> >(nullptr));
-    Pointer<HierarchyGhostCellInterpolation> hier_ls_bdry_fill = new HierarchyGhostCellInterpolation();
-    hier_ls_bdry_fill->initializeOperatorState(ls_solid_transaction, patch_hierarchy);
-    hier_ls_bdry_fill->setHomogeneousBc(false);
-    hier_ls_bdry_fill->fillData(fill_time);
-
-    // Fill ghost cells for velocity
+    transaction_comps.emplace_back(d_ls_solid_idx,
+                                   ls_solid_idx,
+                                   /*DATA_REFINE_TYPE*/ "CONSERVATIVE_LINEAR_REFINE",
+                                   /*USE_CF_INTERPOLATION*/ true,
+                                   /*DATA_COARSEN_TYPE*/ "CUBIC_COARSEN",
+                                   /*BDRY_EXTRAP_TYPE*/ "LINEAR",
+                                   /*CONSISTENT_TYPE_2_BDRY*/ false,
+                                   d_adv_diff_solver->getPhysicalBcCoefs(d_ls_solid_var),
+                                   Pointer<VariableFillPattern<NDIM> >(nullptr));
+
+    // Velocity
     Pointer<SideVariable<NDIM, double> > u_var = d_fluid_solver->getVelocityVariable();
     const int u_idx = use_current_ctx ?
                           var_db->mapVariableAndContextToIndex(u_var, d_fluid_solver->getCurrentContext()) :
                           use_new_ctx ? var_db->mapVariableAndContextToIndex(u_var, d_fluid_solver->getNewContext()) :
                                         IBTK::invalid_index;
-    InterpolationTransactionComponent u_transaction(d_u_idx,
-                                                    u_idx,
-                                                    /*DATA_REFINE_TYPE*/ "CONSERVATIVE_LINEAR_REFINE",
-                                                    /*USE_CF_INTERPOLATION*/ true,
-                                                    /*DATA_COARSEN_TYPE*/ "CUBIC_COARSEN",
-                                                    /*BDRY_EXTRAP_TYPE*/ "LINEAR",
-                                                    /*CONSISTENT_TYPE_2_BDRY*/ false,
-                                                    d_fluid_solver->getVelocityBoundaryConditions(),
-                                                    Pointer<VariableFillPattern<NDIM> >(nullptr));
-
-    Pointer<HierarchyGhostCellInterpolation> hier_vel_bdry_fill = new HierarchyGhostCellInterpolation();
-    hier_vel_bdry_fill->initializeOperatorState(u_transaction, patch_hierarchy);
-    hier_vel_bdry_fill->setHomogeneousBc(false);
-    hier_vel_bdry_fill->fillData(fill_time);
-
-    // Fill in ghost cells for viscosity, when necessary
+    transaction_comps.emplace_back(d_u_idx,
+                                   u_idx,
+                                   /*DATA_REFINE_TYPE*/ "CONSERVATIVE_LINEAR_REFINE",
+                                   /*USE_CF_INTERPOLATION*/ true,
+                                   /*DATA_COARSEN_TYPE*/ "CUBIC_COARSEN",
+                                   /*BDRY_EXTRAP_TYPE*/ "LINEAR",
+                                   /*CONSISTENT_TYPE_2_BDRY*/ false,
+                                   d_fluid_solver->getVelocityBoundaryConditions(),
+                                   Pointer<VariableFillPattern<NDIM> >(nullptr));
+
+    // Viscosity, when necessary
     if (!d_mu_is_const)
     {
         auto p_vc_ins_hier_integrator = dynamic_cast<INSVCStaggeredHierarchyIntegrator*>(d_fluid_solver.getPointer());
@@ -501,76 +566,37 @@ IBHydrodynamicSurfaceForceEvaluator::fillPatchData(Pointer<PatchHierarchy<NDIM>
         {
             TBOX_ERROR("This statement should not be reached");
         }
-
-        InterpolationTransactionComponent mu_transaction_comp(d_mu_idx,
-                                                              mu_idx,
-                                                              /*DATA_REFINE_TYPE*/ "CONSERVATIVE_LINEAR_REFINE",
-                                                              /*USE_CF_INTERPOLATION*/ true,
-                                                              /*DATA_COARSEN_TYPE*/ "CUBIC_COARSEN",
-                                                              /*BDRY_EXTRAP_TYPE*/ "LINEAR",
-                                                              /*CONSISTENT_TYPE_2_BDRY*/ false,
-                                                              mu_bc_coef,
-                                                              Pointer<VariableFillPattern<NDIM> >(nullptr));
-        Pointer<HierarchyGhostCellInterpolation> hier_mu_bdry_fill = new HierarchyGhostCellInterpolation();
-        hier_mu_bdry_fill->initializeOperatorState(mu_transaction_comp, patch_hierarchy);
-        hier_mu_bdry_fill->setHomogeneousBc(false);
-        hier_mu_bdry_fill->fillData(fill_time);
+        transaction_comps.emplace_back(d_mu_idx,
+                                       mu_idx,
+                                       /*DATA_REFINE_TYPE*/ "CONSERVATIVE_LINEAR_REFINE",
+                                       /*USE_CF_INTERPOLATION*/ true,
+                                       /*DATA_COARSEN_TYPE*/ "CUBIC_COARSEN",
+                                       /*BDRY_EXTRAP_TYPE*/ "LINEAR",
+                                       /*CONSISTENT_TYPE_2_BDRY*/ false,
+                                       mu_bc_coef,
+                                       Pointer<VariableFillPattern<NDIM> >(nullptr));
     }
 
-    // Fill ghost cells for pressure
+    // Pressure
     Pointer<CellVariable<NDIM, double> > p_var = d_fluid_solver->getPressureVariable();
     const int p_idx = use_current_ctx ?
                           var_db->mapVariableAndContextToIndex(p_var, d_fluid_solver->getCurrentContext()) :
                           use_new_ctx ? var_db->mapVariableAndContextToIndex(p_var, d_fluid_solver->getNewContext()) :
                                         IBTK::invalid_index;
-    auto p_ins_bc_coef = dynamic_cast<INSStaggeredPressureBcCoef*>(d_fluid_solver->getPressureBoundaryConditions());
-    auto p_vc_ins_bc_coef =
-        dynamic_cast<INSVCStaggeredPressureBcCoef*>(d_fluid_solver->getPressureBoundaryConditions());
-    InterpolationTransactionComponent p_transaction_comp;
-    if (p_ins_bc_coef)
-    {
-        p_ins_bc_coef->setTargetVelocityPatchDataIndex(d_u_idx);
-        InterpolationTransactionComponent p_transaction_comp(d_p_idx,
-                                                             p_idx,
-                                                             /*DATA_REFINE_TYPE*/ "CONSERVATIVE_LINEAR_REFINE",
-                                                             /*USE_CF_INTERPOLATION*/ true,
-                                                             /*DATA_COARSEN_TYPE*/ "CUBIC_COARSEN",
-                                                             /*BDRY_EXTRAP_TYPE*/ "LINEAR",
-                                                             /*CONSISTENT_TYPE_2_BDRY*/ false,
-                                                             p_ins_bc_coef,
-                                                             Pointer<VariableFillPattern<NDIM> >(nullptr));
-        Pointer<HierarchyGhostCellInterpolation> hier_p_bdry_fill = new HierarchyGhostCellInterpolation();
-        hier_p_bdry_fill->initializeOperatorState(p_transaction_comp, patch_hierarchy);
-        hier_p_bdry_fill->setHomogeneousBc(false);
-        hier_p_bdry_fill->fillData(fill_time);
-    }
-    else if (p_vc_ins_bc_coef)
-    {
-        p_vc_ins_bc_coef->setTargetVelocityPatchDataIndex(d_u_idx);
-        InterpolationTransactionComponent p_transaction_comp(d_p_idx,
-                                                             p_idx,
-                                                             /*DATA_REFINE_TYPE*/ "CONSERVATIVE_LINEAR_REFINE",
-                                                             /*USE_CF_INTERPOLATION*/ true,
-                                                             /*DATA_COARSEN_TYPE*/ "CUBIC_COARSEN",
-                                                             /*BDRY_EXTRAP_TYPE*/ "LINEAR",
-                                                             /*CONSISTENT_TYPE_2_BDRY*/ false,
-                                                             p_vc_ins_bc_coef,
-                                                             Pointer<VariableFillPattern<NDIM> >(nullptr));
-
-        Pointer<HierarchyGhostCellInterpolation> hier_p_bdry_fill = new HierarchyGhostCellInterpolation();
-        hier_p_bdry_fill->initializeOperatorState(p_transaction_comp, patch_hierarchy);
-        hier_p_bdry_fill->setHomogeneousBc(false);
-        hier_p_bdry_fill->fillData(fill_time);
-    }
-    else
-    {
-        TBOX_ERROR(d_object_name << "::IBHydrodynamicSurfaceForceEvaluator():\n"
-                                 << " no valid pressure boundary condition object registered with INS integrator.\n"
-                                 << " This statement should not have been reached");
-    }
-
-    return;
-} // fillPatchData
+    transaction_comps.emplace_back(d_p_idx,
+                                   p_idx,
+                                   /*DATA_REFINE_TYPE*/ "CONSERVATIVE_LINEAR_REFINE",
+                                   /*USE_CF_INTERPOLATION*/ true,
+                                   /*DATA_COARSEN_TYPE*/ "CUBIC_COARSEN",
+                                   /*BDRY_EXTRAP_TYPE*/ "LINEAR",
+                                   /*CONSISTENT_TYPE_2_BDRY*/ false,
+                                   p_ins_bc_coef ? p_ins_bc_coef : p_vc_ins_bc_coef,
+                                   Pointer<VariableFillPattern<NDIM> >(nullptr));
+
+    Pointer<HierarchyGhostCellInterpolation> hier_bdry_fill = new HierarchyGhostCellInterpolation();
+    hier_bdry_fill->initializeOperatorState(transaction_comps, patch_hierarchy);
+    return hier_bdry_fill;
+} // buildGhostFill
 
 void
 IBHydrodynamicSurfaceForceEvaluator::getFromInput(Pointer<Database> input_db)
@@ -28,6 +28,7 @@
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
 #include "ibtk/CartGridFunction.h"
+#include "ibtk/DiagnosticsCollector.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/KrylovLinearSolver.h"
@@ -198,14 +199,14 @@ IBImplicitStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
 
     // Allocate Eulerian scratch and new data.
+    allocatePatchData(d_scratch_data, current_time, coarsest_ln, finest_ln);
+    allocatePatchData(d_new_data, new_time, coarsest_ln, finest_ln);
     d_num_dofs_per_proc.resize(finest_ln + 1);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         level->allocatePatchData(d_u_idx, current_time);
         level->allocatePatchData(d_f_idx, current_time);
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
         if (!d_solve_for_position && ln == finest_ln)
         {
             level->allocatePatchData(d_u_dof_index_idx, current_time);
@@ -326,16 +327,18 @@ IBImplicitStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(const doub
             cfl_max = std::max(cfl_max, u_max * dt / dx_min);
         }
     }
-    cfl_max = SAMRAI_MPI::maxReduction(cfl_max);
-    d_regrid_cfl_estimate += cfl_max;
-    if (d_enable_logging)
-    {
-        plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl_max << "\n"
-             << d_object_name
-             << "::postprocessIntegrateHierarchy(): estimated upper bound on IB "
-                "point displacement since last regrid = "
-             << d_regrid_cfl_estimate << "\n";
-    }
+    getDiagnosticsCollector().addContribution(
+        d_object_name + "::CFL", cfl_max, DiagnosticsCollector::MAX, [this](const double cfl) {
+            d_regrid_cfl_estimate += cfl;
+            if (d_enable_logging)
+            {
+                plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl << "\n"
+                     << d_object_name
+                     << "::postprocessIntegrateHierarchy(): estimated upper bound on IB "
+                        "point displacement since last regrid = "
+                     << d_regrid_cfl_estimate << "\n";
+            }
+        });
 
     // Deallocate the fluid solver.
     const int ins_num_cycles = d_ins_hier_integrator->getNumberOfCycles();
@@ -712,8 +715,10 @@ IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy_velocity(const double
     }
     else
     {
-        TBOX_ERROR("IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy_velocity()."
-                   << " Delta function " << d_jac_delta_fcn << " is not supported in creating Jacobian." << std::endl);
+        // Other kernels are assembled from the compiled LEInteractor kernel
+        // weights; LEInteractor reports an error for kernels without them.
+        d_ib_implicit_ops->constructInterpOp(
+            interp_op, d_jac_delta_fcn, d_num_dofs_per_proc[finest_ln], d_u_dof_index_idx, data_time);
     }
     stokes_fac_op->setIBInterpOp(interp_op);
     stokes_fac_pc->initializeSolverState(*eul_sol_vec, *eul_rhs_vec);
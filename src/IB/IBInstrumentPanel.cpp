@@ -27,6 +27,7 @@
 #include "ibtk/LDataManager.h"
 #include "ibtk/LMesh.h"
 #include "ibtk/LNode.h"
+#include "ibtk/LSiloDataWriter.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "BasePatchLevel.h"
@@ -823,7 +824,7 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
         init_meter_elements(d_X_web[m], d_dA_web[m], d_X_perimeter[m], d_X_centroid[m]);
     }
 
-    // Setup the mappings from cell indices to the web patch and web centroid
+    // Setup the mappings from local patches to the web patch and web centroid
     // data.
     //
     // NOTE: Each meter web patch/centroid is assigned to precisely one
@@ -833,6 +834,10 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
     // located.  Similarly, each web centroid is assigned to which ever grid
     // cell is the finest cell that contains the region of physical space in
     // which the web centroid is located.
+    //
+    // Only the web patches and centroids that lie in local patches are
+    // recorded, so that readInstrumentData() visits only the cells that are
+    // actually sampled.
     d_web_patch_map.clear();
     d_web_patch_map.resize(finest_ln + 1);
     d_web_centroid_map.clear();
@@ -862,6 +867,40 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
             finer_dx[d] = dx_coarsest[d] / static_cast<double>(finer_ratio(d));
         }
 
+        // Determine the local patch, if any, that contains a point in the
+        // finest cell of the hierarchy that contains it, along with the index
+        // and center of that cell.
+        auto find_local_cell = [&](const Point& X, hier::Index<NDIM>& i, Point& X_cell) -> int {
+            i = IndexUtilities::getCellIndex(
+                X, domainXLower, domainXUpper, dx.data(), domain_box_level_lower, domain_box_level_upper);
+            if (ln < finest_ln)
+            {
+                const hier::Index<NDIM> finer_i = IndexUtilities::getCellIndex(X,
+                                                                               domainXLower,
+                                                                               domainXUpper,
+                                                                               finer_dx.data(),
+                                                                               finer_domain_box_level_lower,
+                                                                               finer_domain_box_level_upper);
+                if (finer_level->getBoxes().contains(finer_i)) return -1;
+            }
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                if (!patch_box.contains(i)) continue;
+                const hier::Index<NDIM>& patch_lower = patch_box.lower();
+                const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+                const double* const x_lower = pgeom->getXLower();
+                const double* const patch_dx = pgeom->getDx();
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X_cell[d] = x_lower[d] + patch_dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                }
+                return p();
+            }
+            return -1;
+        };
+
         for (unsigned int l = 0; l < d_num_meters; ++l)
         {
             // Setup the web patch mapping.
@@ -869,44 +908,23 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
             {
                 for (unsigned int n = 0; n < d_X_web[l].shape()[1]; ++n)
                 {
-                    const Point& X = d_X_web[l][m][n];
-                    const hier::Index<NDIM> i = IndexUtilities::getCellIndex(
-                        X, domainXLower, domainXUpper, dx.data(), domain_box_level_lower, domain_box_level_upper);
-                    const hier::Index<NDIM> finer_i = IndexUtilities::getCellIndex(X,
-                                                                                   domainXLower,
-                                                                                   domainXUpper,
-                                                                                   finer_dx.data(),
-                                                                                   finer_domain_box_level_lower,
-                                                                                   finer_domain_box_level_upper);
-                    if (level->getBoxes().contains(i) &&
-                        (ln == finest_ln || !finer_level->getBoxes().contains(finer_i)))
-                    {
-                        WebPatch p;
-                        p.meter_num = l;
-                        p.X = &d_X_web[l][m][n];
-                        p.dA = &d_dA_web[l][m][n];
-                        d_web_patch_map[ln].insert(std::make_pair(i, p));
-                    }
+                    WebPatch p;
+                    const int patch_num = find_local_cell(d_X_web[l][m][n], p.i, p.X_cell);
+                    if (patch_num < 0) continue;
+                    p.meter_num = l;
+                    p.X = &d_X_web[l][m][n];
+                    p.dA = &d_dA_web[l][m][n];
+                    d_web_patch_map[ln][patch_num].push_back(p);
                 }
             }
 
             // Setup the web centroid mapping.
-            const Point& X = d_X_centroid[l];
-            const hier::Index<NDIM> i = IndexUtilities::getCellIndex(
-                X, domainXLower, domainXUpper, dx.data(), domain_box_level_lower, domain_box_level_upper);
-            const hier::Index<NDIM> finer_i = IndexUtilities::getCellIndex(X,
-                                                                           domainXLower,
-                                                                           domainXUpper,
-                                                                           finer_dx.data(),
-                                                                           finer_domain_box_level_lower,
-                                                                           finer_domain_box_level_upper);
-            if (level->getBoxes().contains(i) && (ln == finest_ln || !finer_level->getBoxes().contains(finer_i)))
-            {
-                WebCentroid c;
-                c.meter_num = l;
-                c.X = &d_X_centroid[l];
-                d_web_centroid_map[ln].insert(std::make_pair(i, c));
-            }
+            WebCentroid c;
+            const int patch_num = find_local_cell(d_X_centroid[l], c.i, c.X_cell);
+            if (patch_num < 0) continue;
+            c.meter_num = l;
+            c.X = &d_X_centroid[l];
+            d_web_centroid_map[ln][patch_num].push_back(c);
         }
     }
 
@@ -957,9 +975,9 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        for (const auto& patch_web_patches : d_web_patch_map[ln])
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = level->getPatch(patch_web_patches.first);
             const Box<NDIM>& patch_box = patch->getBox();
             const hier::Index<NDIM>& patch_lower = patch_box.lower();
             const hier::Index<NDIM>& patch_upper = patch_box.upper();
@@ -973,96 +991,58 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
             Pointer<SideData<NDIM, double> > U_sc_data = patch->getPatchData(U_data_idx);
             Pointer<CellData<NDIM, double> > P_cc_data = patch->getPatchData(P_data_idx);
 
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            for (const auto& web_patch : patch_web_patches.second)
             {
-                const hier::Index<NDIM>& i = b();
-                std::pair<WebPatchMap::const_iterator, WebPatchMap::const_iterator> patch_range =
-                    d_web_patch_map[ln].equal_range(i);
-                if (patch_range.first != patch_range.second)
+                const int& meter_num = web_patch.meter_num;
+                const Point& X = *web_patch.X;
+                const Vector& dA = *web_patch.dA;
+                const hier::Index<NDIM>& i = web_patch.i;
+                const Point& X_cell = web_patch.X_cell;
+                if (U_cc_data)
                 {
-                    const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                       x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
-#if (NDIM == 3)
-                                           ,
-                                       x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
-#endif
-                    );
-                    if (U_cc_data)
-                    {
-                        for (auto it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            const Vector U = linear_interp<NDIM>(
-                                X, i, X_cell, *U_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += U.dot(dA);
-                        }
-                    }
-                    if (U_sc_data)
-                    {
-                        for (auto it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            const Vector U =
-                                linear_interp(X, i, X_cell, *U_sc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += U.dot(dA);
-                        }
-                    }
-                    if (P_cc_data)
-                    {
-                        for (auto it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_mean_pres_values[meter_num] += P * dA.norm();
-                            A[meter_num] += dA.norm();
-                        }
-                    }
+                    const Vector U =
+                        linear_interp<NDIM>(X, i, X_cell, *U_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    d_flow_values[meter_num] += U.dot(dA);
                 }
-
-                std::pair<WebCentroidMap::const_iterator, WebCentroidMap::const_iterator> centroid_range =
-                    d_web_centroid_map[ln].equal_range(i);
-                if (centroid_range.first != centroid_range.second)
+                if (U_sc_data)
                 {
-                    const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                       x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
-#if (NDIM == 3)
-                                           ,
-                                       x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
-#endif
-                    );
-                    if (P_cc_data)
-                    {
-                        for (auto it = centroid_range.first; it != centroid_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_point_pres_values[meter_num] = P;
-                        }
-                    }
+                    const Vector U =
+                        linear_interp(X, i, X_cell, *U_sc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    d_flow_values[meter_num] += U.dot(dA);
+                }
+                if (P_cc_data)
+                {
+                    double P = linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    d_mean_pres_values[meter_num] += P * dA.norm();
+                    A[meter_num] += dA.norm();
                 }
             }
         }
-    }
 
-    // Synchronize the values across all processes.
-    SAMRAI_MPI::sumReduction(&d_flow_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&d_mean_pres_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&d_point_pres_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&A[0], d_num_meters);
+        for (const auto& patch_web_centroids : d_web_centroid_map[ln])
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(patch_web_centroids.first);
+            Pointer<CellData<NDIM, double> > P_cc_data = patch->getPatchData(P_data_idx);
+            if (!P_cc_data) continue;
 
-    // Normalize the mean pressure.
-    for (unsigned int m = 0; m < d_num_meters; ++m)
-    {
-        d_mean_pres_values[m] /= A[m];
+            const Box<NDIM>& patch_box = patch->getBox();
+            const hier::Index<NDIM>& patch_lower = patch_box.lower();
+            const hier::Index<NDIM>& patch_upper = patch_box.upper();
+
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const x_upper = pgeom->getXUpper();
+            const double* const dx = pgeom->getDx();
+
+            for (const auto& web_centroid : patch_web_centroids.second)
+            {
+                const int& meter_num = web_centroid.meter_num;
+                const Point& X = *web_centroid.X;
+                const double P = linear_interp(
+                    X, web_centroid.i, web_centroid.X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                d_point_pres_values[meter_num] = P;
+            }
+        }
     }
 
     // Loop over all local nodes to determine the velocities of the local
@@ -1109,26 +1089,46 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
         }
     }
 
-    // Set the velocities of all perimeter nodes on all processes.
-    std::vector<double> U_perimeter_flattened;
+    // Synchronize the meter values and the velocities of all perimeter nodes
+    // across all processes with a single reduction.
+    std::vector<double> reduction_data;
+    reduction_data.reserve(4 * d_num_meters);
+    reduction_data.insert(reduction_data.end(), d_flow_values.begin(), d_flow_values.end());
+    reduction_data.insert(reduction_data.end(), d_mean_pres_values.begin(), d_mean_pres_values.end());
+    reduction_data.insert(reduction_data.end(), d_point_pres_values.begin(), d_point_pres_values.end());
+    reduction_data.insert(reduction_data.end(), A.begin(), A.end());
     for (unsigned int m = 0; m < d_num_meters; ++m)
     {
         for (int n = 0; n < d_num_perimeter_nodes[m]; ++n)
         {
-            U_perimeter_flattened.insert(
-                U_perimeter_flattened.end(), U_perimeter[m][n].data(), U_perimeter[m][n].data() + NDIM);
+            reduction_data.insert(reduction_data.end(), U_perimeter[m][n].data(), U_perimeter[m][n].data() + NDIM);
         }
     }
-    SAMRAI_MPI::sumReduction(&U_perimeter_flattened[0], static_cast<int>(U_perimeter_flattened.size()));
-    for (unsigned int m = 0, k = 0; m < d_num_meters; ++m)
+    SAMRAI_MPI::sumReduction(&reduction_data[0], static_cast<int>(reduction_data.size()));
+    auto reduction_it = reduction_data.cbegin();
+    std::copy(reduction_it, reduction_it + d_num_meters, d_flow_values.begin());
+    reduction_it += d_num_meters;
+    std::copy(reduction_it, reduction_it + d_num_meters, d_mean_pres_values.begin());
+    reduction_it += d_num_meters;
+    std::copy(reduction_it, reduction_it + d_num_meters, d_point_pres_values.begin());
+    reduction_it += d_num_meters;
+    std::copy(reduction_it, reduction_it + d_num_meters, A.begin());
+    reduction_it += d_num_meters;
+    for (unsigned int m = 0; m < d_num_meters; ++m)
     {
-        for (int n = 0; n < d_num_perimeter_nodes[m]; ++n, ++k)
+        for (int n = 0; n < d_num_perimeter_nodes[m]; ++n)
         {
-            std::copy(
-                &U_perimeter_flattened[NDIM * k], (&U_perimeter_flattened[NDIM * k]) + NDIM, U_perimeter[m][n].data());
+            std::copy(reduction_it, reduction_it + NDIM, U_perimeter[m][n].data());
+            reduction_it += NDIM;
         }
     }
 
+    // Normalize the mean pressure.
+    for (unsigned int m = 0; m < d_num_meters; ++m)
+    {
+        d_mean_pres_values[m] /= A[m];
+    }
+
     // Determine the velocity of the centroid of each perimeter.
     std::vector<Vector> U_centroid(d_num_meters, Vector::Zero());
     for (unsigned int m = 0; m < d_num_meters; ++m)
@@ -1204,6 +1204,10 @@ IBInstrumentPanel::writePlotData(const int timestep_num, const double simulation
                                  << "  dump directory name is empty" << std::endl);
     }
 
+    // The Silo library is not thread safe, so wait for any asynchronous Silo
+    // writes to complete before using it.
+    LSiloDataWriter::waitForAllPendingWrites();
+
     char temp_buf[SILO_NAME_BUFSIZE];
     std::string current_file_name;
     DBfile* dbfile;
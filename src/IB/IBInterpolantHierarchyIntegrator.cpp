@@ -24,6 +24,7 @@
 #include "ibamr/app_namespaces.h" // IWYU pragma: keep
 
 #include "ibtk/CartGridFunction.h"
+#include "ibtk/DiagnosticsCollector.h"
 #include "ibtk/ibtk_enums.h"
 
 #include "CartesianPatchGeometry.h"
@@ -108,12 +109,8 @@ IBInterpolantHierarchyIntegrator::preprocessIntegrateHierarchy(const double curr
     const int finest_level_num = d_hierarchy->getFinestLevelNumber();
 
     // Allocate Eulerian scratch and new data.
-    for (int level_num = coarsest_level_num; level_num <= finest_level_num; ++level_num)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
-    }
+    allocatePatchData(d_scratch_data, current_time, coarsest_level_num, finest_level_num);
+    allocatePatchData(d_new_data, new_time, coarsest_level_num, finest_level_num);
 
     // Initialize IB data.
     d_ib_method_ops->preprocessIntegrateData(current_time, new_time, num_cycles);
@@ -218,16 +215,18 @@ IBInterpolantHierarchyIntegrator::postprocessIntegrateHierarchy(const double cur
             cfl_max = std::max(cfl_max, u_max * dt / dx_min);
         }
     }
-    cfl_max = SAMRAI_MPI::maxReduction(cfl_max);
-    d_regrid_cfl_estimate += cfl_max;
-    if (d_enable_logging)
-    {
-        plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl_max << "\n"
-             << d_object_name
-             << "::postprocessIntegrateHierarchy(): estimated upper bound on IB "
-                "point displacement since last regrid = "
-             << d_regrid_cfl_estimate << "\n";
-    }
+    getDiagnosticsCollector().addContribution(
+        d_object_name + "::CFL", cfl_max, DiagnosticsCollector::MAX, [this](const double cfl) {
+            d_regrid_cfl_estimate += cfl;
+            if (d_enable_logging)
+            {
+                plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl << "\n"
+                     << d_object_name
+                     << "::postprocessIntegrateHierarchy(): estimated upper bound on IB "
+                        "point displacement since last regrid = "
+                     << d_regrid_cfl_estimate << "\n";
+            }
+        });
 
     // Deallocate the fluid solver.
     d_ins_hier_integrator->postprocessIntegrateHierarchy(
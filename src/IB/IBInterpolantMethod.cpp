@@ -435,18 +435,27 @@ IBInterpolantMethod::interpolateQ(const double data_time)
     getPositionData(&X_data, data_time);
     std::vector<Pointer<LData> >* Q_data;
 
+    // Copy all of the quantities before filling ghost cells.  The ghost fill
+    // schedules are shared by all of the quantities, so that the ghost cells of
+    // all of them are filled by a single pass.
+    for (auto& Q_pair : d_Q_current_data)
+    {
+        const std::string& name = Q_pair.first;
+        copyEulerianDataFromIntegrator(name, d_q_interp_idx[name], data_time);
+    }
+    for (const auto& ghost_fill_sched : getGhostfillRefineSchedules(d_object_name + "::ghost_fill_alg"))
+    {
+        if (ghost_fill_sched) ghost_fill_sched->fillData(data_time);
+    }
+
+    const std::vector<Pointer<CoarsenSchedule<NDIM> > > no_synch(finest_ln + 1);
+    const std::vector<Pointer<RefineSchedule<NDIM> > > no_fill(finest_ln + 1);
     for (auto& Q_pair : d_Q_current_data)
     {
         const std::string& name = Q_pair.first;
         int q_data_idx = d_q_interp_idx[name];
-        copyEulerianDataFromIntegrator(name, q_data_idx, data_time);
         getQData(name, &Q_data, data_time);
-        d_l_data_manager->interp(q_data_idx,
-                                 *Q_data,
-                                 *X_data,
-                                 std::vector<Pointer<CoarsenSchedule<NDIM> > >(finest_ln + 1, NULL),
-                                 getGhostfillRefineSchedules(d_object_name + "::ghost_fill_alg"),
-                                 data_time);
+        d_l_data_manager->interp(q_data_idx, *Q_data, *X_data, no_synch, no_fill, data_time);
     }
 
     return;
@@ -598,6 +607,9 @@ IBInterpolantMethod::spreadQ(double data_time)
     getPositionData(&X_data, data_time);
     std::vector<Pointer<LData> >* Q_data;
 
+    // The ghost values of the positions are shared by all of the quantities,
+    // so they are updated only once.
+    bool X_data_ghost_node_update = true;
     for (auto& Q_pair : d_Q_current_data)
     {
         const std::string& name = Q_pair.first;
@@ -607,8 +619,16 @@ IBInterpolantMethod::spreadQ(double data_time)
         getQData(name, &Q_data, data_time);
         Vec l_data_vec = (*Q_data)[finest_ln]->getVec();
         VecScale(l_data_vec, vol);
-        d_l_data_manager->spread(q_data_idx, *Q_data, *X_data, (RobinPhysBdryPatchStrategy*)NULL);
+        d_l_data_manager->spread(q_data_idx,
+                                 *Q_data,
+                                 *X_data,
+                                 (RobinPhysBdryPatchStrategy*)NULL,
+                                 std::vector<Pointer<RefineSchedule<NDIM> > >(),
+                                 /*fill_data_time*/ 0.0,
+                                 /*F_data_ghost_node_update*/ true,
+                                 X_data_ghost_node_update);
         VecScale(l_data_vec, 1.0 / vol);
+        X_data_ghost_node_update = false;
     }
 
     return;
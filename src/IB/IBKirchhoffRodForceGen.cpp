@@ -25,6 +25,7 @@
 #include "ibtk/LDataManager.h"
 #include "ibtk/LMesh.h"
 #include "ibtk/LNode.h"
+#include "ibtk/compiler_hints.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "IntVector.h"
@@ -127,15 +128,17 @@ IBKirchhoffRodForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> >
     d_X_next_mats.resize(new_size);
     d_petsc_curr_node_idxs.resize(new_size);
     d_petsc_next_node_idxs.resize(new_size);
-    d_material_params.resize(new_size);
+    d_local_curr_node_idxs.resize(new_size);
+    d_rod_params.resize(new_size);
     d_is_initialized.resize(new_size, false);
 
     Mat& D_next_mat = d_D_next_mats[level_num];
     Mat& X_next_mat = d_X_next_mats[level_num];
     std::vector<int>& petsc_curr_node_idxs = d_petsc_curr_node_idxs[level_num];
     std::vector<int>& petsc_next_node_idxs = d_petsc_next_node_idxs[level_num];
-    std::vector<std::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> >& material_params =
-        d_material_params[level_num];
+    std::vector<int>& local_curr_node_idxs = d_local_curr_node_idxs[level_num];
+    std::vector<double>& rod_params = d_rod_params[level_num];
+    std::vector<std::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> > material_params;
 
     if (D_next_mat)
     {
@@ -149,7 +152,6 @@ IBKirchhoffRodForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> >
     }
     petsc_curr_node_idxs.clear();
     petsc_next_node_idxs.clear();
-    material_params.clear();
 
     // The LMesh object provides the set of local Lagrangian nodes.
     const Pointer<LMesh> mesh = l_data_manager->getLMesh(level_num);
@@ -194,6 +196,21 @@ IBKirchhoffRodForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> >
     // Determine the non-zero structure for the matrices.
     const int local_sz = static_cast<int>(petsc_curr_node_idxs.size());
 
+    // Store the local indices of the "current" nodes and the material
+    // parameters in structure-of-arrays form so that the force kernel can
+    // process blocks of rods with unit-stride loads.
+    local_curr_node_idxs.resize(local_sz);
+    rod_params.resize(IBRodForceSpec::NUM_MATERIAL_PARAMS * local_sz);
+    for (int k = 0; k < local_sz; ++k)
+    {
+        local_curr_node_idxs[k] = petsc_curr_node_idxs[k] - global_node_offset;
+        rod_params[k] = 1.0 / material_params[k][0];
+        for (int p = 1; p < IBRodForceSpec::NUM_MATERIAL_PARAMS; ++p)
+        {
+            rod_params[p * local_sz + k] = material_params[k][p];
+        }
+    }
+
     std::vector<int> next_d_nz(local_sz, 1), next_o_nz(local_sz, 0);
     for (int k = 0; k < local_sz; ++k)
     {
@@ -328,8 +345,6 @@ IBKirchhoffRodForceGen::computeLagrangianForceAndTorque(Pointer<LData> F_data,
     TBOX_ASSERT(d_is_initialized[level_number]);
 #endif
 
-    const int global_offset = l_data_manager->getGlobalNodeOffset(level_number);
-
     int ierr;
 
     // Create appropriately sized temporary vectors.
@@ -376,83 +391,110 @@ IBKirchhoffRodForceGen::computeLagrangianForceAndTorque(Pointer<LData> F_data,
 
     std::vector<int>& petsc_curr_node_idxs = d_petsc_curr_node_idxs[level_number];
     std::vector<int>& petsc_next_node_idxs = d_petsc_next_node_idxs[level_number];
-    const std::vector<std::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> >& material_params =
-        d_material_params[level_number];
+    const int* const local_curr_node_idxs = d_local_curr_node_idxs[level_number].data();
 
-    const size_t local_sz = petsc_curr_node_idxs.size();
+    const int local_sz = static_cast<int>(petsc_curr_node_idxs.size());
     std::vector<double> F_curr_node_vals(NDIM * local_sz, 0.0);
     std::vector<double> N_curr_node_vals(NDIM * local_sz, 0.0);
     std::vector<double> F_next_node_vals(NDIM * local_sz, 0.0);
     std::vector<double> N_next_node_vals(NDIM * local_sz, 0.0);
 
-    for (unsigned int k = 0; k < local_sz; ++k)
+    const double* const rod_params = d_rod_params[level_number].data();
+    const double* const inv_ds = rod_params + 0 * local_sz;
+    const double* const a1 = rod_params + 1 * local_sz;
+    const double* const a2 = rod_params + 2 * local_sz;
+    const double* const a3 = rod_params + 3 * local_sz;
+    const double* const b1 = rod_params + 4 * local_sz;
+    const double* const b2 = rod_params + 5 * local_sz;
+    const double* const b3 = rod_params + 6 * local_sz;
+    const double* const kappa1 = rod_params + 7 * local_sz;
+    const double* const kappa2 = rod_params + 8 * local_sz;
+    const double* const tau = rod_params + 9 * local_sz;
+
+    // The rods are processed in blocks.  For each rod in a block, we first
+    // gather the directors and positions of its endpoints and compute the
+    // directors at the rod midpoint, which requires a matrix square root.  The
+    // resulting per-rod quantities are stored in structure-of-arrays form so
+    // that the strains, forces, and torques of all rods in the block are then
+    // computed by simple unit-stride loops that the compiler can vectorize.
+    static const int BLOCKSIZE = 16; // This parameter needs to be tuned.
+    double D_half[3][3][BLOCKSIZE], dD_ds[3][3][BLOCKSIZE], dX[3][BLOCKSIZE];
+    for (int k_offset = 0; k_offset < local_sz; k_offset += BLOCKSIZE)
     {
-        // Compute the forces applied by the rod to the "current" and "next"
-        // nodes.
-        const int D1_offset = 0;
-        Eigen::Map<const Vector3d> D1(&D_vals[(petsc_curr_node_idxs[k] - global_offset) * 3 * 3 + D1_offset]);
-        Eigen::Map<const Vector3d> D1_next(&D_next_vals[k * 3 * 3 + D1_offset]);
-
-        const int D2_offset = 3;
-        Eigen::Map<const Vector3d> D2(&D_vals[(petsc_curr_node_idxs[k] - global_offset) * 3 * 3 + D2_offset]);
-        Eigen::Map<const Vector3d> D2_next(&D_next_vals[k * 3 * 3 + D2_offset]);
-
-        const int D3_offset = 6;
-        Eigen::Map<const Vector3d> D3(&D_vals[(petsc_curr_node_idxs[k] - global_offset) * 3 * 3 + D3_offset]);
-        Eigen::Map<const Vector3d> D3_next(&D_next_vals[k * 3 * 3 + D3_offset]);
-
-        Eigen::Map<const Vector3d> X(&X_vals[(petsc_curr_node_idxs[k] - global_offset) * NDIM]);
-        Eigen::Map<const Vector3d> X_next(&X_next_vals[k * NDIM]);
-
-        std::array<Eigen::Map<const Vector3d>*, 3> D = { { &D1, &D2, &D3 } };
-        std::array<Eigen::Map<const Vector3d>*, 3> D_next = { { &D1_next, &D2_next, &D3_next } };
-        Matrix3d A(Matrix3d::Zero());
-        for (int i = 0; i < 3; ++i)
+        const int block_sz = std::min(BLOCKSIZE, local_sz - k_offset);
+        if (k_offset + BLOCKSIZE < local_sz)
         {
-            A += (*D_next[i]) * (*D[i]).transpose();
+            PREFETCH_READ_NTA_BLOCK(local_curr_node_idxs + k_offset + BLOCKSIZE, BLOCKSIZE);
         }
-        Matrix3d sqrt_A = A.sqrt();
-        Vector3d D1_half, D2_half, D3_half;
-        std::array<Vector3d*, 3> D_half = { { &D1_half, &D2_half, &D3_half } };
-        for (int i = 0; i < 3; ++i)
+
+        // Gather the nodal data and compute the midpoint directors.
+        for (int kk = 0; kk < block_sz; ++kk)
         {
-            *D_half[i] = sqrt_A * (*D[i]);
+            const int k = k_offset + kk;
+            const double* const D_curr = &D_vals[local_curr_node_idxs[k] * 3 * 3];
+            const double* const D_next = &D_next_vals[k * 3 * 3];
+            const double* const X_curr = &X_vals[local_curr_node_idxs[k] * NDIM];
+            const double* const X_next = &X_next_vals[k * NDIM];
+            Matrix3d A(Matrix3d::Zero());
+            for (int i = 0; i < 3; ++i)
+            {
+                A += Eigen::Map<const Vector3d>(D_next + 3 * i) *
+                     Eigen::Map<const Vector3d>(D_curr + 3 * i).transpose();
+            }
+            const Matrix3d sqrt_A = A.sqrt();
+            for (int i = 0; i < 3; ++i)
+            {
+                const Vector3d D_half_i = sqrt_A * Eigen::Map<const Vector3d>(D_curr + 3 * i);
+                for (int d = 0; d < 3; ++d)
+                {
+                    D_half[i][d][kk] = D_half_i[d];
+                    dD_ds[i][d][kk] = (D_next[3 * i + d] - D_curr[3 * i + d]) * inv_ds[k];
+                }
+            }
+            for (int d = 0; d < 3; ++d) dX[d][kk] = X_next[d] - X_curr[d];
         }
 
-        const double ds = material_params[k][0];
-        const double a1 = material_params[k][1];
-        const double a2 = material_params[k][2];
-        const double a3 = material_params[k][3];
-        const double b1 = material_params[k][4];
-        const double b2 = material_params[k][5];
-        const double b3 = material_params[k][6];
-        const double kappa1 = material_params[k][7];
-        const double kappa2 = material_params[k][8];
-        const double tau = material_params[k][9];
-
-        const Vector3d dX_ds((X_next - X) / ds);
-        const double F1 = b1 * D1_half.dot(dX_ds);
-        const double F2 = b2 * D2_half.dot(dX_ds);
-        const double F3 = b3 * (D3_half.dot(dX_ds) - 1.0);
-        const Vector3d F_half = F1 * D1_half + F2 * D2_half + F3 * D3_half;
-
-        const Vector3d dD1_ds((D1_next - D1) / ds);
-        const Vector3d dD2_ds((D2_next - D2) / ds);
-        const Vector3d dD3_ds((D3_next - D3) / ds);
-        const double N1 = a1 * (dD2_ds.dot(D3_half) - kappa1);
-        const double N2 = a2 * (dD3_ds.dot(D1_half) - kappa2);
-        const double N3 = a3 * (dD1_ds.dot(D2_half) - tau);
-        const Vector3d N_half = N1 * D1_half + N2 * D2_half + N3 * D3_half;
-
-        Eigen::Map<Vector3d> F_curr(&F_curr_node_vals[k * NDIM]);
-        Eigen::Map<Vector3d> F_next(&F_next_node_vals[k * NDIM]);
-        F_curr = F_half;
-        F_next = -F_half;
-
-        Eigen::Map<Vector3d> N_curr(&N_curr_node_vals[k * NDIM]);
-        Eigen::Map<Vector3d> N_next(&N_next_node_vals[k * NDIM]);
-        N_curr = N_half + 0.5 * (X_next - X).cross(F_half);
-        N_next = -N_half + 0.5 * (X_next - X).cross(F_half);
+        // Compute the forces and torques applied by the rods to the "current"
+        // and "next" nodes.
+        double* const F_curr = &F_curr_node_vals[k_offset * NDIM];
+        double* const F_next = &F_next_node_vals[k_offset * NDIM];
+        double* const N_curr = &N_curr_node_vals[k_offset * NDIM];
+        double* const N_next = &N_next_node_vals[k_offset * NDIM];
+        for (int kk = 0; kk < block_sz; ++kk)
+        {
+            const int k = k_offset + kk;
+            const double dX_ds[3] = { dX[0][kk] * inv_ds[k], dX[1][kk] * inv_ds[k], dX[2][kk] * inv_ds[k] };
+            double F[3], N[3];
+            for (int i = 0; i < 3; ++i)
+            {
+                F[i] = D_half[i][0][kk] * dX_ds[0] + D_half[i][1][kk] * dX_ds[1] + D_half[i][2][kk] * dX_ds[2];
+            }
+            F[0] = b1[k] * F[0];
+            F[1] = b2[k] * F[1];
+            F[2] = b3[k] * (F[2] - 1.0);
+            N[0] = a1[k] * (dD_ds[1][0][kk] * D_half[2][0][kk] + dD_ds[1][1][kk] * D_half[2][1][kk] +
+                            dD_ds[1][2][kk] * D_half[2][2][kk] - kappa1[k]);
+            N[1] = a2[k] * (dD_ds[2][0][kk] * D_half[0][0][kk] + dD_ds[2][1][kk] * D_half[0][1][kk] +
+                            dD_ds[2][2][kk] * D_half[0][2][kk] - kappa2[k]);
+            N[2] = a3[k] * (dD_ds[0][0][kk] * D_half[1][0][kk] + dD_ds[0][1][kk] * D_half[1][1][kk] +
+                            dD_ds[0][2][kk] * D_half[1][2][kk] - tau[k]);
+            double F_half[3], N_half[3];
+            for (int d = 0; d < 3; ++d)
+            {
+                F_half[d] = F[0] * D_half[0][d][kk] + F[1] * D_half[1][d][kk] + F[2] * D_half[2][d][kk];
+                N_half[d] = N[0] * D_half[0][d][kk] + N[1] * D_half[1][d][kk] + N[2] * D_half[2][d][kk];
+            }
+            const double dX_cross_F[3] = { dX[1][kk] * F_half[2] - dX[2][kk] * F_half[1],
+                                           dX[2][kk] * F_half[0] - dX[0][kk] * F_half[2],
+                                           dX[0][kk] * F_half[1] - dX[1][kk] * F_half[0] };
+            for (int d = 0; d < 3; ++d)
+            {
+                F_curr[kk * NDIM + d] = F_half[d];
+                F_next[kk * NDIM + d] = -F_half[d];
+                N_curr[kk * NDIM + d] = N_half[d] + 0.5 * dX_cross_F[d];
+                N_next[kk * NDIM + d] = -N_half[d] + 0.5 * dX_cross_F[d];
+            }
+        }
     }
 
     ierr = VecRestoreArray(D_vec, &D_vals);
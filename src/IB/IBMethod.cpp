@@ -37,6 +37,7 @@
 #include "ibtk/LNode.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/PETScMatUtilities.h"
+#include "ibtk/PerformanceMonitor.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/private/IndexUtilities-inl.h"
 #include "ibtk/private/LData-inl.h"
@@ -175,6 +176,8 @@ IBMethod::IBMethod(std::string object_name, Pointer<Database> input_db, bool reg
                                                 d_ghosts,
                                                 d_registered_for_restart);
     d_ghosts = d_l_data_manager->getGhostCellWidth();
+    d_l_data_manager->setUseSpaceFillingCurveNodeOrdering(d_use_sfc_node_ordering);
+    d_l_data_manager->setUseBoundingBoxTagging(d_use_bounding_box_tagging);
 
     // Create the instrument panel object.
     d_instrument_panel =
@@ -275,6 +278,18 @@ IBMethod::getMinimumGhostCellWidth() const
     return d_ghosts;
 } // getMinimumGhostCellWidth
 
+IntVector<NDIM>
+IBMethod::getMinimumGhostCellWidthForInterpolation() const
+{
+    return IntVector<NDIM>(LEInteractor::getMinimumGhostWidth(d_interp_kernel_fcn));
+} // getMinimumGhostCellWidthForInterpolation
+
+IntVector<NDIM>
+IBMethod::getMinimumGhostCellWidthForSpreading() const
+{
+    return IntVector<NDIM>(LEInteractor::getMinimumGhostWidth(d_spread_kernel_fcn));
+} // getMinimumGhostCellWidthForSpreading
+
 void
 IBMethod::setupTagBuffer(Array<int>& tag_buffer, Pointer<GriddingAlgorithm<NDIM> > gridding_alg) const
 {
@@ -378,17 +393,17 @@ IBMethod::preprocessIntegrateData(double current_time, double new_time, int /*nu
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
         d_X_current_data[ln] = d_l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
-        d_X_new_data[ln] = d_l_data_manager->createLData("X_new", ln, NDIM);
-        d_X_half_data[ln] = d_l_data_manager->createLData("X_half", ln, NDIM);
+        d_X_new_data[ln] = d_l_data_manager->getScratchLData(ln, NDIM);
+        d_X_half_data[ln] = d_l_data_manager->getScratchLData(ln, NDIM);
         d_U_current_data[ln] = d_l_data_manager->getLData(LDataManager::VEL_DATA_NAME, ln);
-        d_U_new_data[ln] = d_l_data_manager->createLData("U_new", ln, NDIM);
-        d_U_half_data[ln] = d_l_data_manager->createLData("U_half", ln, NDIM);
+        d_U_new_data[ln] = d_l_data_manager->getScratchLData(ln, NDIM);
+        d_U_half_data[ln] = d_l_data_manager->getScratchLData(ln, NDIM);
         d_F_current_data[ln] = d_l_data_manager->getLData("F", ln);
-        d_F_half_data[ln] = d_l_data_manager->createLData("F_half", ln, NDIM);
+        d_F_half_data[ln] = d_l_data_manager->getScratchLData(ln, NDIM);
         if (d_use_fixed_coupling_ops)
         {
-            d_X_LE_new_data[ln] = d_l_data_manager->createLData("X_LE_new", ln, NDIM);
-            d_X_LE_half_data[ln] = d_l_data_manager->createLData("X_LE_half", ln, NDIM);
+            d_X_LE_new_data[ln] = d_l_data_manager->getScratchLData(ln, NDIM);
+            d_X_LE_half_data[ln] = d_l_data_manager->getScratchLData(ln, NDIM);
         }
 
         // Initialize X^{n+1} and X^{n+1/2} to equal X^{n}, and initialize U^{n+1}
@@ -465,7 +480,22 @@ IBMethod::postprocessIntegrateData(double current_time, double new_time, int /*n
     d_X_current_needs_ghost_fill = true;
     d_F_current_needs_ghost_fill = true;
 
-    // Deallocate Lagrangian scratch data.
+    // Return Lagrangian scratch data to the pool and deallocate the remaining
+    // data.
+    for (auto* scratch_data : { &d_X_new_data,
+                                &d_X_half_data,
+                                &d_X_LE_new_data,
+                                &d_X_LE_half_data,
+                                &d_U_new_data,
+                                &d_U_half_data,
+                                &d_F_new_data,
+                                &d_F_half_data })
+    {
+        for (unsigned int ln = 0; ln < scratch_data->size(); ++ln)
+        {
+            if ((*scratch_data)[ln]) d_l_data_manager->restoreScratchLData((*scratch_data)[ln], ln);
+        }
+    }
     d_X_current_data.clear();
     d_X_new_data.clear();
     d_X_half_data.clear();
@@ -553,6 +583,40 @@ IBMethod::setLinearizedPosition(Vec& X_vec, const double data_time)
     ierr = VecCopy(X_vec, (*X_jac_data)[level_num]->getVec());
     IBTK_CHKERRQ(ierr);
     *X_jac_needs_ghost_fill = true;
+    d_force_jac_data_time = data_time;
+
+    // The nonzero structure of the assembled Jacobian only changes when the
+    // Lagrangian data are redistributed, so an existing matrix is updated in
+    // place.  The values of the assembled Jacobian may also be lagged, i.e.,
+    // reused for several linearizations before they are recomputed.
+    if (d_force_jac && d_force_jac_structure_is_valid)
+    {
+        if (d_force_jac_mffd)
+        {
+            ierr = MatMFFDSetBase(d_force_jac, (*X_jac_data)[level_num]->getVec(), nullptr);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatAssemblyBegin(d_force_jac, MAT_FINAL_ASSEMBLY);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatAssemblyEnd(d_force_jac, MAT_FINAL_ASSEMBLY);
+            IBTK_CHKERRQ(ierr);
+            return;
+        }
+        if (++d_num_force_jac_lagged_updates < d_force_jac_lag) return;
+        d_num_force_jac_lagged_updates = 0;
+        ierr = MatZeroEntries(d_force_jac);
+        IBTK_CHKERRQ(ierr);
+        d_ib_force_fcn->computeLagrangianForceJacobian(d_force_jac,
+                                                       MAT_FINAL_ASSEMBLY,
+                                                       1.0,
+                                                       (*X_jac_data)[level_num],
+                                                       0.0,
+                                                       Pointer<IBTK::LData>(nullptr),
+                                                       d_hierarchy,
+                                                       level_num,
+                                                       data_time,
+                                                       d_l_data_manager);
+        return;
+    }
 
     if (d_force_jac)
     {
@@ -560,7 +624,8 @@ IBMethod::setLinearizedPosition(Vec& X_vec, const double data_time)
         IBTK_CHKERRQ(ierr);
         d_force_jac = nullptr;
     }
-    d_force_jac_data_time = data_time;
+    d_force_jac_structure_is_valid = true;
+    d_num_force_jac_lagged_updates = 0;
     int n_local, n_global;
     ierr = VecGetLocalSize(X_vec, &n_local);
     IBTK_CHKERRQ(ierr);
@@ -679,6 +744,7 @@ IBMethod::interpolateVelocity(const int u_data_idx,
                               const std::vector<Pointer<RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
                               const double data_time)
 {
+    PerformanceMonitor::ScopedRegion region("IBMethod::interpolateVelocity");
     std::vector<Pointer<LData> >*U_data, *X_LE_data;
     bool* X_LE_needs_ghost_fill;
     getVelocityData(&U_data, data_time);
@@ -823,6 +889,124 @@ IBMethod::trapezoidalStep(const double current_time, const double new_time)
     return;
 } // trapezoidalStep
 
+void
+IBMethod::subcycledMidpointStep(const int u_data_idx,
+                                const std::vector<Pointer<CoarsenSchedule<NDIM> > >& u_synch_scheds,
+                                const std::vector<Pointer<RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
+                                const double current_time,
+                                const double new_time,
+                                const int num_substeps)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(num_substeps >= 1);
+#endif
+    if (d_use_fixed_coupling_ops)
+    {
+        TBOX_ERROR(d_object_name << "::subcycledMidpointStep():\n"
+                                 << "  Lagrangian substepping requires coupling operators that follow the structure\n");
+    }
+
+    PerformanceMonitor::ScopedRegion region("IBMethod::subcycledMidpointStep");
+    int ierr;
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    const double dt = new_time - current_time;
+    const double substep_dt = dt / num_substeps;
+    std::vector<Pointer<LData> >*F_half_data, *X_half_data, *U_half_data;
+    bool *F_half_needs_ghost_fill, *X_half_needs_ghost_fill;
+    getForceData(&F_half_data, &F_half_needs_ghost_fill, d_half_time);
+    getPositionData(&X_half_data, &X_half_needs_ghost_fill, d_half_time);
+    getVelocityData(&U_half_data, d_half_time);
+
+    // The substep positions are accumulated in the new position data, and the
+    // midpoint position, velocity, and force data are used as work space.
+    std::vector<Pointer<LData> > F_avg_data(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        ierr = VecCopy(d_X_current_data[ln]->getVec(), d_X_new_data[ln]->getVec());
+        IBTK_CHKERRQ(ierr);
+        F_avg_data[ln] = d_l_data_manager->getScratchLData(ln, NDIM);
+        ierr = VecSet(F_avg_data[ln]->getVec(), 0.0);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    // NOTE: The Eulerian velocity does not change during the substeps, so it is
+    // synchronized and its ghost values are filled only once.
+    const std::vector<Pointer<CoarsenSchedule<NDIM> > > no_synch_scheds;
+    const std::vector<Pointer<RefineSchedule<NDIM> > > no_ghost_fill_scheds;
+    for (int k = 0; k < num_substeps; ++k)
+    {
+        // Predict the position at the midpoint of the substep.
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+            ierr = VecCopy(d_X_new_data[ln]->getVec(), (*X_half_data)[ln]->getVec());
+            IBTK_CHKERRQ(ierr);
+        }
+        *X_half_needs_ghost_fill = true;
+        interpolateVelocity(u_data_idx,
+                            k == 0 ? u_synch_scheds : no_synch_scheds,
+                            k == 0 ? u_ghost_fill_scheds : no_ghost_fill_scheds,
+                            d_half_time);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+            ierr = VecAXPY((*X_half_data)[ln]->getVec(), 0.5 * substep_dt, (*U_half_data)[ln]->getVec());
+            IBTK_CHKERRQ(ierr);
+        }
+        *X_half_needs_ghost_fill = true;
+
+        // Advance the structure with the velocity at the substep midpoint and
+        // accumulate the force evaluated there.  The force is computed through
+        // computeLagrangianForce() so that forces added by derived classes are
+        // included.
+        interpolateVelocity(u_data_idx, no_synch_scheds, no_ghost_fill_scheds, d_half_time);
+        computeLagrangianForce(d_half_time);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+            ierr = VecAXPY(d_X_new_data[ln]->getVec(), substep_dt, (*U_half_data)[ln]->getVec());
+            IBTK_CHKERRQ(ierr);
+            ierr = VecAXPY(F_avg_data[ln]->getVec(), 1.0 / num_substeps, (*F_half_data)[ln]->getVec());
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+    d_X_new_needs_ghost_fill = true;
+
+    // Store the average force and reset the midpoint data to be consistent with
+    // the full step.  Non-finite data indicate that the substeps are still too
+    // large for the structure.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        ierr = VecCopy(F_avg_data[ln]->getVec(), (*F_half_data)[ln]->getVec());
+        IBTK_CHKERRQ(ierr);
+        d_l_data_manager->restoreScratchLData(F_avg_data[ln], ln);
+        ierr = VecWAXPY(
+            (*U_half_data)[ln]->getVec(), -1.0, d_X_current_data[ln]->getVec(), d_X_new_data[ln]->getVec());
+        IBTK_CHKERRQ(ierr);
+        ierr = VecScale((*U_half_data)[ln]->getVec(), 1.0 / dt);
+        IBTK_CHKERRQ(ierr);
+        double X_max_norm, F_max_norm;
+        ierr = VecNorm(d_X_new_data[ln]->getVec(), NORM_INFINITY, &X_max_norm);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecNorm((*F_half_data)[ln]->getVec(), NORM_INFINITY, &F_max_norm);
+        IBTK_CHKERRQ(ierr);
+        if (!std::isfinite(X_max_norm) || !std::isfinite(F_max_norm))
+        {
+            TBOX_ERROR(d_object_name << "::subcycledMidpointStep():\n"
+                                     << "  non-finite Lagrangian data on level " << ln << " with " << num_substeps
+                                     << " substeps\n"
+                                     << "  reduce the time step size or increase the number of substeps\n");
+        }
+    }
+    *F_half_needs_ghost_fill = true;
+    reinitMidpointData(d_X_current_data, d_X_new_data, *X_half_data);
+    *X_half_needs_ghost_fill = true;
+    return;
+} // subcycledMidpointStep
+
 bool
 IBMethod::hasFluidSources() const
 {
@@ -832,6 +1016,7 @@ IBMethod::hasFluidSources() const
 void
 IBMethod::computeLagrangianForce(const double data_time)
 {
+    PerformanceMonitor::ScopedRegion region("IBMethod::computeLagrangianForce");
     int ierr;
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
@@ -973,6 +1158,7 @@ IBMethod::spreadForce(const int f_data_idx,
                       const std::vector<Pointer<RefineSchedule<NDIM> > >& f_prolongation_scheds,
                       const double data_time)
 {
+    PerformanceMonitor::ScopedRegion region("IBMethod::spreadForce");
     std::vector<Pointer<LData> >*F_data, *X_LE_data;
     bool *F_needs_ghost_fill, *X_LE_needs_ghost_fill;
     getForceData(&F_data, &F_needs_ghost_fill, data_time);
@@ -1049,6 +1235,33 @@ IBMethod::constructInterpOp(Mat& J,
 
 } // getInterpOperator
 
+void
+IBMethod::constructInterpOp(Mat& J,
+                            const std::string& kernel_fcn,
+                            const std::vector<int>& num_dofs_per_proc,
+                            const int dof_index_idx,
+                            const double data_time)
+{
+    if (J)
+    {
+        int ierr = MatDestroy(&J);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    // Get the "frozen" position for Lagrangian structure
+    std::vector<Pointer<LData> >* X_LE_data;
+    bool* X_LE_needs_ghost_fill;
+    getLECouplingPositionData(&X_LE_data, &X_LE_needs_ghost_fill, data_time);
+
+    // Build the Jacobian matrix using the same kernel stencils as LEInteractor.
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    Pointer<PatchLevel<NDIM> > finest_level = d_hierarchy->getPatchLevel(finest_ln);
+    Vec X_vec = (*X_LE_data)[finest_ln]->getVec();
+    PETScMatUtilities::constructPatchLevelSCInterpOp(
+        J, kernel_fcn, X_vec, num_dofs_per_proc, dof_index_idx, finest_level);
+    return;
+} // constructInterpOp
+
 void
 IBMethod::computeLagrangianFluidSource(const double data_time)
 {
@@ -1093,47 +1306,25 @@ IBMethod::spreadFluidSource(const int q_data_idx,
 #if !defined(NDEBUG)
         TBOX_ASSERT(ln == d_hierarchy->getFinestLevelNumber());
 #endif
+        computeSourceStencils(ln);
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        const IntVector<NDIM>& ratio = level->getRatio();
-        const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            const Box<NDIM>& patch_box = patch->getBox();
-            const hier::Index<NDIM>& patch_lower = patch_box.lower();
-            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-            const double* const xLower = pgeom->getXLower();
-            const double* const dx = pgeom->getDx();
             const Pointer<CellData<NDIM, double> > q_data = patch->getPatchData(q_data_idx);
-            for (int n = 0; n < d_n_src[ln]; ++n)
+            for (const SourceStencil& stencil : d_src_stencils[ln][p()])
             {
-                // The source radius must be an integer multiple of the grid
-                // spacing.
-                std::array<double, NDIM> r;
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    r[d] = std::max(std::floor(d_r_src[ln][n] / dx[d] + 0.5), 2.0) * dx[d];
-                }
-
-                // Determine the approximate source stencil box.
-                const hier::Index<NDIM> i_center = IndexUtilities::getCellIndex(d_X_src[ln][n], grid_geom, ratio);
-                Box<NDIM> stencil_box(i_center, i_center);
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    stencil_box.grow(d, static_cast<int>(r[d] / dx[d]) + 1);
-                }
-
-                // Spread the source strength onto the Cartesian grid.
-                for (Box<NDIM>::Iterator b(patch_box * stencil_box); b; b++)
+                const double Q = d_Q_src[ln][stencil.src_idx];
+                const hier::Index<NDIM>& stencil_lower = stencil.box.lower();
+                for (Box<NDIM>::Iterator b(stencil.box); b; b++)
                 {
                     const hier::Index<NDIM>& i = b();
                     double wgt = 1.0;
                     for (unsigned int d = 0; d < NDIM; ++d)
                     {
-                        const double X_center = xLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                        wgt *= cos_kernel(X_center - d_X_src[ln][n][d], r[d]);
+                        wgt *= stencil.wgt[d][i(d) - stencil_lower(d)];
                     }
-                    (*q_data)(i) += d_Q_src[ln][n] * wgt;
+                    (*q_data)(i) += Q * wgt;
                 }
             }
         }
@@ -1282,65 +1473,61 @@ IBMethod::interpolatePressure(int p_data_idx,
         p_norm /= vol;
     }
 
-    // Reset the values of P_src.
+    // Compute the mean pressure at the sources/sinks associated with each level
+    // of the Cartesian grid.  The pressures of all levels are accumulated in a
+    // single buffer so that they can be summed across processes at once.
+    std::vector<int> P_src_offset(finest_ln + 2, 0);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
-        std::fill(d_P_src[ln].begin(), d_P_src[ln].end(), 0.0);
+        P_src_offset[ln + 1] = P_src_offset[ln] + d_n_src[ln];
     }
-
-    // Compute the mean pressure at the sources/sinks associated with each level
-    // of the Cartesian grid.
+    std::vector<double> P_src(P_src_offset[finest_ln + 1], 0.0);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (d_n_src[ln] == 0) continue;
+        if (!d_src_stencils_valid[ln]) computeSourceStencils(ln);
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        const IntVector<NDIM>& ratio = level->getRatio();
-        const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
+        double* const P_src_level = &P_src[P_src_offset[ln]];
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            const Box<NDIM>& patch_box = patch->getBox();
-            const hier::Index<NDIM>& patch_lower = patch_box.lower();
             const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-            const double* const xLower = pgeom->getXLower();
             const double* const dx = pgeom->getDx();
+            double cell_vol = 1.0;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                cell_vol *= dx[d];
+            }
             const Pointer<CellData<NDIM, double> > p_data = patch->getPatchData(p_data_idx);
-            for (int n = 0; n < d_n_src[ln]; ++n)
+            for (const SourceStencil& stencil : d_src_stencils[ln][p()])
             {
-                // The source radius must be an integer multiple of the grid
-                // spacing.
-                std::array<double, NDIM> r;
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    r[d] = std::max(std::floor(d_r_src[ln][n] / dx[d] + 0.5), 2.0) * dx[d];
-                }
-
-                // Determine the approximate source stencil box.
-                const hier::Index<NDIM> i_center = IndexUtilities::getCellIndex(d_X_src[ln][n], grid_geom, ratio);
-                Box<NDIM> stencil_box(i_center, i_center);
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    stencil_box.grow(d, static_cast<int>(r[d] / dx[d]) + 1);
-                }
-
-                // Interpolate the pressure from the Cartesian grid.
-                for (Box<NDIM>::Iterator b(patch_box * stencil_box); b; b++)
+                const hier::Index<NDIM>& stencil_lower = stencil.box.lower();
+                double P = 0.0;
+                for (Box<NDIM>::Iterator b(stencil.box); b; b++)
                 {
                     const hier::Index<NDIM>& i = b();
-                    double wgt = 1.0;
+                    double wgt = cell_vol;
                     for (unsigned int d = 0; d < NDIM; ++d)
                     {
-                        const double X_center = xLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                        wgt *= cos_kernel(X_center - d_X_src[ln][n][d], r[d]) * dx[d];
+                        wgt *= stencil.wgt[d][i(d) - stencil_lower(d)];
                     }
-                    d_P_src[ln][n] += (*p_data)(i)*wgt;
+                    P += (*p_data)(i)*wgt;
                 }
+                P_src_level[stencil.src_idx] += P;
             }
         }
-        SAMRAI_MPI::sumReduction(&d_P_src[ln][0], static_cast<int>(d_P_src[ln].size()));
-        std::for_each(d_P_src[ln].begin(), d_P_src[ln].end(), [=](double& P) { P -= p_norm; });
+    }
+    if (!P_src.empty()) SAMRAI_MPI::sumReduction(&P_src[0], static_cast<int>(P_src.size()));
 
-        // Update the pressures stored by the Lagrangian source strategy.
+    // Update the pressures stored by the Lagrangian source strategy.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        std::fill(d_P_src[ln].begin(), d_P_src[ln].end(), 0.0);
+        if (d_n_src[ln] == 0) continue;
+        for (int n = 0; n < d_n_src[ln]; ++n)
+        {
+            d_P_src[ln][n] = P_src[P_src_offset[ln] + n] - p_norm;
+        }
         d_ib_source_fcn->setSourcePressures(d_P_src[ln], d_hierarchy, ln, data_time, d_l_data_manager);
     }
     return;
@@ -1464,6 +1651,7 @@ IBMethod::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy,
         ierr = MatDestroy(&d_force_jac);
         IBTK_CHKERRQ(ierr);
     }
+    d_force_jac_structure_is_valid = false;
     return;
 } // initializePatchHierarchy
 
@@ -1546,9 +1734,11 @@ IBMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
         X_data[ln]->restoreArrays();
     }
 
-    // Indicate that the force and source strategies need to be re-initialized.
+    // Indicate that the force and source strategies need to be re-initialized
+    // and that the nonzero structure of the Jacobian must be recomputed.
     d_ib_force_fcn_needs_init = true;
     d_ib_source_fcn_needs_init = true;
+    d_force_jac_structure_is_valid = false;
     return;
 } // endDataRedistribution
 
@@ -1593,6 +1783,9 @@ IBMethod::resetHierarchyConfiguration(Pointer<BasePatchHierarchy<NDIM> > hierarc
     d_P_src.resize(finest_hier_level + 1);
     d_Q_src.resize(finest_hier_level + 1);
     d_n_src.resize(finest_hier_level + 1, 0);
+    d_src_stencils.clear();
+    d_src_stencils.resize(finest_hier_level + 1);
+    d_src_stencils_valid.assign(finest_hier_level + 1, false);
     return;
 } // resetHierarchyConfiguration
 
@@ -1827,7 +2020,7 @@ IBMethod::getForceData(std::vector<Pointer<LData> >** F_data, bool** F_needs_gho
         for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
         {
             if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
-            if (!d_F_new_data[ln]) d_F_new_data[ln] = d_l_data_manager->createLData("F_new", ln, NDIM);
+            if (!d_F_new_data[ln]) d_F_new_data[ln] = d_l_data_manager->getScratchLData(ln, NDIM);
         }
         *F_data = &d_F_new_data;
         *F_needs_ghost_fill = &d_F_new_needs_ghost_fill;
@@ -1925,6 +2118,74 @@ IBMethod::resetLagrangianSourceFunction(const double init_data_time, const bool
     return;
 } // resetLagrangianSourceFunction
 
+void
+IBMethod::computeSourceStencils(const int ln)
+{
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+    std::vector<std::vector<SourceStencil> >& patch_stencils = d_src_stencils[ln];
+    patch_stencils.clear();
+    patch_stencils.resize(level->getNumberOfPatches());
+
+    // Determine the radius and the approximate stencil box of each source once
+    // for all patches.  The source radius must be an integer multiple of the
+    // grid spacing.
+    const int n_src = d_n_src[ln];
+    const IntVector<NDIM>& ratio = level->getRatio();
+    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
+    const double* const dx_coarsest = grid_geom->getDx();
+    std::array<double, NDIM> dx;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
+    }
+    std::vector<std::array<double, NDIM> > r(n_src);
+    std::vector<Box<NDIM> > stencil_boxes(n_src);
+    for (int n = 0; n < n_src; ++n)
+    {
+        const hier::Index<NDIM> i_center = IndexUtilities::getCellIndex(d_X_src[ln][n], grid_geom, ratio);
+        stencil_boxes[n] = Box<NDIM>(i_center, i_center);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            r[n][d] = std::max(std::floor(d_r_src[ln][n] / dx[d] + 0.5), 2.0) * dx[d];
+            stencil_boxes[n].grow(d, static_cast<int>(r[n][d] / dx[d]) + 1);
+        }
+    }
+
+    // Intersect the stencils with the local patches and tabulate the factors
+    // of the tensor-product kernel weights.
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        const hier::Index<NDIM>& patch_lower = patch_box.lower();
+        const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+        const double* const xLower = pgeom->getXLower();
+        const double* const patch_dx = pgeom->getDx();
+        for (int n = 0; n < n_src; ++n)
+        {
+            const Box<NDIM> box = patch_box * stencil_boxes[n];
+            if (box.empty()) continue;
+            SourceStencil stencil;
+            stencil.src_idx = n;
+            stencil.box = box;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                const int width = box.numberCells(d);
+                stencil.wgt[d].resize(width);
+                for (int j = 0; j < width; ++j)
+                {
+                    const double X_center =
+                        xLower[d] + patch_dx[d] * (static_cast<double>(box.lower(d) + j - patch_lower(d)) + 0.5);
+                    stencil.wgt[d][j] = cos_kernel(X_center - d_X_src[ln][n][d], r[n][d]);
+                }
+            }
+            patch_stencils[p()].push_back(std::move(stencil));
+        }
+    }
+    d_src_stencils_valid[ln] = true;
+    return;
+} // computeSourceStencils
+
 void
 IBMethod::updateIBInstrumentationData(const int timestep_num, const double data_time)
 {
@@ -2023,11 +2284,21 @@ IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
     }
     if (db->keyExists("error_if_points_leave_domain"))
         d_error_if_points_leave_domain = db->getBool("error_if_points_leave_domain");
+    if (db->keyExists("use_sfc_node_ordering")) d_use_sfc_node_ordering = db->getBool("use_sfc_node_ordering");
+    if (db->keyExists("use_bounding_box_tagging"))
+        d_use_bounding_box_tagging = db->getBool("use_bounding_box_tagging");
     if (db->keyExists("force_jac_mffd")) d_force_jac_mffd = db->getBool("force_jac_mffd");
+    if (db->keyExists("force_jac_lag")) d_force_jac_lag = db->getInteger("force_jac_lag");
+    if (d_force_jac_lag < 1)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  force_jac_lag must be positive\n");
+    }
     if (db->keyExists("do_log"))
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
         d_do_log = db->getBool("enable_logging");
+    if (db->isDatabase("LEInteractor")) LEInteractor::setFromDatabase(db->getDatabase("LEInteractor"));
     return;
 } // getFromInput
 
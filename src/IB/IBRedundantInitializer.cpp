@@ -41,6 +41,7 @@
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
 #include "CellIndex.h"
+#include "CellIterator.h"
 #include "IntVector.h"
 #include "Patch.h"
 #include "PatchHierarchy.h"
@@ -77,6 +78,21 @@ class LDataManager;
 
 namespace IBAMR
 {
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// The width (in cells) of the bins used to sort vertices by their locations.
+const int VERTEX_BIN_WIDTH = 8;
+
+// Determine the bin that contains the given cell index.
+inline int
+get_vertex_bin(const int i)
+{
+    return i >= 0 ? i / VERTEX_BIN_WIDTH : -((-i - 1) / VERTEX_BIN_WIDTH) - 1;
+} // get_vertex_bin
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 IBRedundantInitializer::IBRedundantInitializer(std::string object_name, Pointer<Database> input_db)
@@ -293,23 +309,22 @@ IBRedundantInitializer::initializeStructurePosition()
         TBOX_ERROR("IBRedundantInitializer::initializeStructurePosition()\n"
                    << " no function registered to initialize structure.\n");
     }
+    // Generate the structures.  In the distributed mode, each structure is
+    // generated by a single process and broadcast to all processes after all
+    // structures have been generated, so that the structures are generated
+    // concurrently.
+    const int rank = SAMRAI_MPI::getRank();
+    const int nodes = SAMRAI_MPI::getNodes();
+    int strct_counter = 0;
     for (int ln = 0; ln < d_max_levels; ++ln)
     {
         const size_t num_base_filename = d_base_filename[ln].size();
         d_num_vertex[ln].resize(num_base_filename, 0);
         d_vertex_offset[ln].resize(num_base_filename, std::numeric_limits<int>::max());
         d_vertex_posn[ln].resize(num_base_filename);
-        for (unsigned int j = 0; j < num_base_filename; ++j)
+        for (unsigned int j = 0; j < num_base_filename; ++j, ++strct_counter)
         {
-            if (j == 0)
-            {
-                d_vertex_offset[ln][j] = 0;
-            }
-            else
-            {
-                d_vertex_offset[ln][j] = d_vertex_offset[ln][j - 1] + d_num_vertex[ln][j - 1];
-            }
-
+            if (d_distribute_structure_generation && strct_counter % nodes != rank) continue;
             d_init_structure_on_level_fcn(j, ln, d_num_vertex[ln][j], d_vertex_posn[ln][j]);
 #if !defined(NDEBUG)
             if (d_vertex_posn[ln][j].size() != std::size_t(d_num_vertex[ln][j]))
@@ -319,6 +334,54 @@ IBRedundantInitializer::initializeStructurePosition()
                                          << "Expected " << d_num_vertex[ln][j] << " vertices.");
             }
 #endif
+        }
+    }
+    if (d_distribute_structure_generation)
+    {
+        strct_counter = 0;
+        for (int ln = 0; ln < d_max_levels; ++ln)
+        {
+            for (unsigned int j = 0; j < d_base_filename[ln].size(); ++j, ++strct_counter)
+            {
+                const int owner = strct_counter % nodes;
+                d_num_vertex[ln][j] = SAMRAI_MPI::bcast(d_num_vertex[ln][j], owner);
+                int num_values = NDIM * d_num_vertex[ln][j];
+                if (num_values == 0) continue;
+                std::vector<double> posn_values(num_values);
+                std::vector<Point>& vertex_posn = d_vertex_posn[ln][j];
+                if (rank == owner)
+                {
+                    for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+                    {
+                        for (unsigned int d = 0; d < NDIM; ++d) posn_values[NDIM * k + d] = vertex_posn[k][d];
+                    }
+                }
+                SAMRAI_MPI::bcast(&posn_values[0], num_values, owner);
+                if (rank != owner)
+                {
+                    vertex_posn.resize(d_num_vertex[ln][j]);
+                    for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+                    {
+                        for (unsigned int d = 0; d < NDIM; ++d) vertex_posn[k][d] = posn_values[NDIM * k + d];
+                    }
+                }
+            }
+        }
+    }
+
+    for (int ln = 0; ln < d_max_levels; ++ln)
+    {
+        const size_t num_base_filename = d_base_filename[ln].size();
+        for (unsigned int j = 0; j < num_base_filename; ++j)
+        {
+            if (j == 0)
+            {
+                d_vertex_offset[ln][j] = 0;
+            }
+            else
+            {
+                d_vertex_offset[ln][j] = d_vertex_offset[ln][j - 1] + d_num_vertex[ln][j - 1];
+            }
 
             // Shift and scale the position of structures
             for (unsigned int k = 0; k < static_cast<unsigned>(d_num_vertex[ln][j]); ++k)
@@ -1359,23 +1422,64 @@ IBRedundantInitializer::getPatchVerticesAtLevel(std::vector<std::pair<int, int>
     const IntVector<NDIM>& ratio = level->getRatio();
     const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(ratio);
 
-    // Loop over all of the vertices to determine the indices of those vertices
-    // within the present patch.
-    //
-    // NOTE: This is clearly not the best way to do this, but it will work for
-    // now.
+    // Sort the vertices by the bins of cells on this level in which they are
+    // located the first time that the vertices of a level are requested for
+    // the patches of this level.
+    const std::pair<int, int> bin_key(vertex_level_number, level_number);
+    auto binned_vertices_it = d_binned_vertices.find(bin_key);
+    if (binned_vertices_it == d_binned_vertices.end())
+    {
+        std::vector<BinnedVertex> binned_vertices;
+        for (unsigned int j = 0; j < d_num_vertex[vertex_level_number].size(); ++j)
+        {
+            for (int k = 0; k < d_num_vertex[vertex_level_number][j]; ++k)
+            {
+                BinnedVertex vertex;
+                vertex.point_index = std::make_pair(j, k);
+                const Point& X = getShiftedVertexPosn(
+                    vertex.point_index, vertex_level_number, domain_x_lower, domain_x_upper, periodic_shift);
+                const CellIndex<NDIM> idx = IndexUtilities::getCellIndex(X, grid_geom, ratio);
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    vertex.cell[d] = idx(d);
+                    vertex.bin[d] = get_vertex_bin(idx(d));
+                }
+                binned_vertices.push_back(vertex);
+            }
+        }
+        std::sort(binned_vertices.begin(),
+                  binned_vertices.end(),
+                  [](const BinnedVertex& a, const BinnedVertex& b) { return a.bin < b.bin; });
+        binned_vertices_it = d_binned_vertices.emplace(bin_key, std::move(binned_vertices)).first;
+    }
+    const std::vector<BinnedVertex>& binned_vertices = binned_vertices_it->second;
+
+    // Collect the vertices in the bins that overlap the patch that are located
+    // within the present patch, in the order of their indices.
     const Box<NDIM>& patch_box = patch->getBox();
-    for (unsigned int j = 0; j < d_num_vertex[vertex_level_number].size(); ++j)
+    hier::Index<NDIM> bin_lower, bin_upper;
+    for (unsigned int d = 0; d < NDIM; ++d)
     {
-        for (int k = 0; k < d_num_vertex[vertex_level_number][j]; ++k)
+        bin_lower(d) = get_vertex_bin(patch_box.lower()(d));
+        bin_upper(d) = get_vertex_bin(patch_box.upper()(d));
+    }
+    const std::size_t first_patch_vertex = patch_vertices.size();
+    for (CellIterator<NDIM> b(Box<NDIM>(bin_lower, bin_upper)); b; b++)
+    {
+        BinnedVertex bin_vertex;
+        for (unsigned int d = 0; d < NDIM; ++d) bin_vertex.bin[d] = b()(d);
+        const auto bin_range = std::equal_range(binned_vertices.begin(),
+                                                binned_vertices.end(),
+                                                bin_vertex,
+                                                [](const BinnedVertex& a, const BinnedVertex& b) { return a.bin < b.bin; });
+        for (auto it = bin_range.first; it != bin_range.second; ++it)
         {
-            std::pair<int, int> point_index(j, k);
-            const Point& X =
-                getShiftedVertexPosn(point_index, vertex_level_number, domain_x_lower, domain_x_upper, periodic_shift);
-            const CellIndex<NDIM> idx = IndexUtilities::getCellIndex(X, grid_geom, ratio);
-            if (patch_box.contains(idx)) patch_vertices.push_back(point_index);
+            hier::Index<NDIM> idx;
+            for (unsigned int d = 0; d < NDIM; ++d) idx(d) = it->cell[d];
+            if (patch_box.contains(idx)) patch_vertices.push_back(it->point_index);
         }
     }
+    std::sort(patch_vertices.begin() + first_patch_vertex, patch_vertices.end());
     return;
 } // getPatchVerticesAtLevel
 
@@ -1678,6 +1782,8 @@ IBRedundantInitializer::getFromInput(Pointer<Database> db)
 
     d_global_index_offset.resize(d_max_levels);
 
+    d_distribute_structure_generation = db->getBoolWithDefault("distribute_structure_generation", false);
+
     // Determine the various input file names.
     //
     // Prefer to use the new ``structure_names'' key, but revert to the
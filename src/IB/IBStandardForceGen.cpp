@@ -52,15 +52,18 @@ IBTK_DISABLE_EXTRA_WARNINGS
 IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <functional>
 #include <iterator>
 #include <limits>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <set>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -119,6 +122,88 @@ resetLocalOrNonlocalPETScIndices(std::vector<int>& inds,
     }
     return;
 } // resetLocalOrNonlocalPETScIndices
+
+// Compute the permutation which sorts the entries so that they are increasing
+// with respect to the triple (group[k], key_1[k], key_2[k]).
+std::vector<int>
+get_sorted_order(const std::vector<int>& group, const std::vector<int>& key_1, const std::vector<int>& key_2)
+{
+    std::vector<int> order(group.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](const int a, const int b) -> bool {
+        return std::make_tuple(group[a], key_1[a], key_2[a]) < std::make_tuple(group[b], key_1[b], key_2[b]);
+    });
+    return order;
+} // get_sorted_order
+
+// Reorder values so that values[k] becomes old_values[order[k]].
+template <typename T>
+void
+permute_values(std::vector<T>& values, const std::vector<int>& order)
+{
+    const std::vector<T> old_values = values;
+    for (std::size_t k = 0; k < order.size(); ++k) values[k] = old_values[order[k]];
+    return;
+} // permute_values
+
+// Determine whether the Lagrangian index lies in one of the sorted, disjoint
+// ranges [first, second).
+bool
+is_in_ranges(const int lag_idx, const std::vector<std::pair<int, int> >& ranges)
+{
+    const auto it = std::upper_bound(
+        ranges.begin(), ranges.end(), lag_idx, [](const int idx, const std::pair<int, int>& range) {
+            return idx < range.first;
+        });
+    return it != ranges.begin() && lag_idx < std::prev(it)->second;
+} // is_in_ranges
+
+// Copy the values addressed by the given pointers to a table in which each
+// distinct set of values is stored only once, and redirect the pointers to the
+// table. Pointer k addresses num_values[k] consecutive values; null pointers
+// and empty sets of values are left unchanged.
+void
+intern_values(std::vector<const double*>& values, const std::vector<int>& num_values, std::vector<double>& table)
+{
+    std::map<std::vector<double>, int> table_offsets;
+    std::vector<int> offsets(values.size(), -1);
+    table.clear();
+    for (std::size_t k = 0; k < values.size(); ++k)
+    {
+        if (!values[k] || num_values[k] == 0) continue;
+        const auto it = table_offsets.emplace(std::vector<double>(values[k], values[k] + num_values[k]),
+                                              static_cast<int>(table.size()));
+        if (it.second) table.insert(table.end(), values[k], values[k] + num_values[k]);
+        offsets[k] = it.first->second;
+    }
+    table.shrink_to_fit();
+    for (std::size_t k = 0; k < values.size(); ++k)
+    {
+        if (offsets[k] >= 0) values[k] = table.data() + offsets[k];
+    }
+    return;
+} // intern_values
+
+// Copy the vectors addressed by the given pointers to a table in which each
+// distinct vector is stored only once, and redirect the pointers to the table.
+void
+intern_vectors(std::vector<const Vector*>& vectors, EigenAlignedVector<Vector>& table)
+{
+    std::map<std::array<double, NDIM>, int> table_offsets;
+    std::vector<int> offsets(vectors.size());
+    table.clear();
+    for (std::size_t k = 0; k < vectors.size(); ++k)
+    {
+        std::array<double, NDIM> key;
+        std::copy(vectors[k]->data(), vectors[k]->data() + NDIM, key.begin());
+        const auto it = table_offsets.emplace(key, static_cast<int>(table.size()));
+        if (it.second) table.push_back(*vectors[k]);
+        offsets[k] = it.first->second;
+    }
+    table.shrink_to_fit();
+    for (std::size_t k = 0; k < vectors.size(); ++k) vectors[k] = &table[offsets[k]];
+    return;
+} // intern_vectors
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -133,6 +218,8 @@ IBStandardForceGen::IBStandardForceGen(Pointer<Database> input_db)
     {
         if (input_db->keyExists("log_target_point_displacements"))
             d_log_target_point_displacements = input_db->getBool("log_target_point_displacements");
+        if (input_db->keyExists("deduplicate_parameters"))
+            d_deduplicate_parameters = input_db->getBool("deduplicate_parameters");
     }
     return;
 } // IBStandardForceGen
@@ -170,6 +257,7 @@ IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hie
     d_F_ghost_data.resize(new_size);
     d_dX_data.resize(new_size);
     d_is_initialized.resize(new_size, false);
+    d_inactive_lag_idx_ranges.resize(new_size);
 
     // Keep track of all of the nonlocal PETSc indices required to compute the
     // forces.
@@ -201,6 +289,29 @@ IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hie
     resetLocalOrNonlocalPETScIndices(
         d_beam_data[level_number].petsc_prev_node_idxs, global_node_offset, num_local_nodes, nonlocal_petsc_idxs);
 
+    // Transform all of the cached indices to correspond to a data depth of
+    // NDIM.
+    std::vector<std::vector<int>*> idx_vecs = { &d_spring_data[level_number].petsc_mastr_node_idxs,
+                                                &d_spring_data[level_number].petsc_slave_node_idxs,
+                                                &d_spring_data[level_number].petsc_global_mastr_node_idxs,
+                                                &d_spring_data[level_number].petsc_global_slave_node_idxs,
+                                                &d_beam_data[level_number].petsc_mastr_node_idxs,
+                                                &d_beam_data[level_number].petsc_next_node_idxs,
+                                                &d_beam_data[level_number].petsc_prev_node_idxs,
+                                                &d_beam_data[level_number].petsc_global_mastr_node_idxs,
+                                                &d_beam_data[level_number].petsc_global_next_node_idxs,
+                                                &d_beam_data[level_number].petsc_global_prev_node_idxs,
+                                                &d_target_point_data[level_number].petsc_node_idxs,
+                                                &d_target_point_data[level_number].petsc_global_node_idxs };
+    for (auto v_ptr : idx_vecs)
+    {
+        std::for_each(v_ptr->begin(), v_ptr->end(), [](int& i) { i *= NDIM; });
+    }
+
+    // Sort the cached data.
+    d_inactive_lag_idx_ranges[level_number] = l_data_manager->getInactivatedLagrangianIndexRanges(level_number);
+    sortLevelData(level_number, num_local_nodes);
+
     const std::string level_number_str = std::to_string(level_number);
 
     d_X_ghost_data[level_number] =
@@ -226,25 +337,6 @@ IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hie
     }
     d_dX_data[level_number]->restoreArrays();
 
-    // Transform all of the cached indices to correspond to a data depth of
-    // NDIM.
-    std::vector<std::vector<int>*> idx_vecs = { &d_spring_data[level_number].petsc_mastr_node_idxs,
-                                                &d_spring_data[level_number].petsc_slave_node_idxs,
-                                                &d_spring_data[level_number].petsc_global_mastr_node_idxs,
-                                                &d_spring_data[level_number].petsc_global_slave_node_idxs,
-                                                &d_beam_data[level_number].petsc_mastr_node_idxs,
-                                                &d_beam_data[level_number].petsc_next_node_idxs,
-                                                &d_beam_data[level_number].petsc_prev_node_idxs,
-                                                &d_beam_data[level_number].petsc_global_mastr_node_idxs,
-                                                &d_beam_data[level_number].petsc_global_next_node_idxs,
-                                                &d_beam_data[level_number].petsc_global_prev_node_idxs,
-                                                &d_target_point_data[level_number].petsc_node_idxs,
-                                                &d_target_point_data[level_number].petsc_global_node_idxs };
-    for (auto v_ptr : idx_vecs)
-    {
-        std::for_each(v_ptr->begin(), v_ptr->end(), [](int& i) { i *= NDIM; });
-    }
-
     // Indicate that the level data has been initialized.
     d_is_initialized[level_number] = true;
     return;
@@ -263,6 +355,16 @@ IBStandardForceGen::computeLagrangianForce(Pointer<LData> F_data,
 
     int ierr;
 
+    // Re-sort the cached data if structures have been activated or inactivated
+    // since the data were last sorted.
+    std::vector<std::pair<int, int> > inactive_lag_idx_ranges =
+        l_data_manager->getInactivatedLagrangianIndexRanges(level_number);
+    if (inactive_lag_idx_ranges != d_inactive_lag_idx_ranges[level_number])
+    {
+        d_inactive_lag_idx_ranges[level_number] = std::move(inactive_lag_idx_ranges);
+        sortLevelData(level_number, l_data_manager->getNumberOfLocalNodes(level_number));
+    }
+
     // Initialize ghost data.
     Pointer<LData> F_ghost_data = d_F_ghost_data[level_number];
     Vec F_ghost_local_form_vec;
@@ -279,15 +381,25 @@ IBStandardForceGen::computeLagrangianForce(Pointer<LData> F_data,
     IBTK_CHKERRQ(ierr);
     ierr = VecGhostUpdateBegin(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
     IBTK_CHKERRQ(ierr);
-    ierr = VecGhostUpdateEnd(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
-    IBTK_CHKERRQ(ierr);
 
-    // Compute the forces.
-    computeLagrangianSpringForce(F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager);
-    computeLagrangianBeamForce(F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager);
+    // Compute the forces which only involve local nodes while the ghost node
+    // positions are being communicated.
+    computeLagrangianSpringForce(
+        F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager, /*local_springs*/ true);
+    computeLagrangianBeamForce(
+        F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager, /*local_beams*/ true);
     computeLagrangianTargetPointForce(
         F_ghost_data, X_ghost_data, U_data, hierarchy, level_number, data_time, l_data_manager);
 
+    ierr = VecGhostUpdateEnd(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+
+    // Compute the remaining forces.
+    computeLagrangianSpringForce(
+        F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager, /*local_springs*/ false);
+    computeLagrangianBeamForce(
+        F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager, /*local_beams*/ false);
+
     // Add the locally computed forces to the Lagrangian force vector.
     //
     // WARNING: The following operations may yield nondeterministic results in
@@ -710,6 +822,105 @@ IBStandardForceGen::computeLagrangianEnergy(Pointer<LData> /*X_data*/,
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+IBStandardForceGen::sortLevelData(const int level_number, const int num_local_nodes)
+{
+    // Sort the cached data by local PETSc index so that the force
+    // computations traverse the node data in (nearly) increasing order.
+    //
+    // Springs and beams which only involve local nodes are stored first so that
+    // they can be evaluated while the ghost node positions are communicated.
+    // Within each of these groups, the default linear springs are stored first.
+    // Springs, beams, and target points whose master nodes belong to
+    // inactivated structures are stored last so that they can be skipped.
+    //
+    // NOTE: The cached PETSc indices correspond to a data depth of NDIM.
+    const std::vector<std::pair<int, int> >& inactive_lag_idx_ranges = d_inactive_lag_idx_ranges[level_number];
+    const int local_idx_bound = NDIM * num_local_nodes;
+
+    SpringData& spring_data = d_spring_data[level_number];
+    const int num_springs = static_cast<int>(spring_data.petsc_mastr_node_idxs.size());
+    std::vector<int> spring_group(num_springs);
+    for (int k = 0; k < num_springs; ++k)
+    {
+        if (is_in_ranges(spring_data.lag_mastr_node_idxs[k], inactive_lag_idx_ranges))
+        {
+            spring_group[k] = 4;
+            continue;
+        }
+        const bool is_local = spring_data.petsc_mastr_node_idxs[k] < local_idx_bound &&
+                              spring_data.petsc_slave_node_idxs[k] < local_idx_bound;
+        const bool is_linear = spring_data.force_fcns[k] == &default_spring_force && spring_data.parameters[k];
+        spring_group[k] = 2 * (is_local ? 0 : 1) + (is_linear ? 0 : 1);
+    }
+    const std::vector<int> spring_order =
+        get_sorted_order(spring_group, spring_data.petsc_mastr_node_idxs, spring_data.petsc_slave_node_idxs);
+    permute_values(spring_data.lag_mastr_node_idxs, spring_order);
+    permute_values(spring_data.lag_slave_node_idxs, spring_order);
+    permute_values(spring_data.petsc_mastr_node_idxs, spring_order);
+    permute_values(spring_data.petsc_slave_node_idxs, spring_order);
+    permute_values(spring_data.petsc_global_mastr_node_idxs, spring_order);
+    permute_values(spring_data.petsc_global_slave_node_idxs, spring_order);
+    permute_values(spring_data.force_fcns, spring_order);
+    permute_values(spring_data.force_deriv_fcns, spring_order);
+    permute_values(spring_data.parameters, spring_order);
+    std::array<int, 5> spring_group_sizes = { { 0, 0, 0, 0, 0 } };
+    for (const int group : spring_group) ++spring_group_sizes[group];
+    spring_data.num_local_linear_springs = spring_group_sizes[0];
+    spring_data.num_local_springs = spring_group_sizes[0] + spring_group_sizes[1];
+    spring_data.num_nonlocal_linear_springs = spring_group_sizes[2];
+    spring_data.num_active_springs = num_springs - spring_group_sizes[4];
+
+    BeamData& beam_data = d_beam_data[level_number];
+    const int num_beams = static_cast<int>(beam_data.petsc_mastr_node_idxs.size());
+    std::vector<int> beam_group(num_beams);
+    for (int k = 0; k < num_beams; ++k)
+    {
+        if (is_in_ranges(beam_data.lag_mastr_node_idxs[k], inactive_lag_idx_ranges))
+        {
+            beam_group[k] = 2;
+            continue;
+        }
+        const bool is_local = beam_data.petsc_mastr_node_idxs[k] < local_idx_bound &&
+                              beam_data.petsc_next_node_idxs[k] < local_idx_bound &&
+                              beam_data.petsc_prev_node_idxs[k] < local_idx_bound;
+        beam_group[k] = is_local ? 0 : 1;
+    }
+    const std::vector<int> beam_order =
+        get_sorted_order(beam_group, beam_data.petsc_mastr_node_idxs, beam_data.petsc_next_node_idxs);
+    permute_values(beam_data.lag_mastr_node_idxs, beam_order);
+    permute_values(beam_data.petsc_mastr_node_idxs, beam_order);
+    permute_values(beam_data.petsc_next_node_idxs, beam_order);
+    permute_values(beam_data.petsc_prev_node_idxs, beam_order);
+    permute_values(beam_data.petsc_global_mastr_node_idxs, beam_order);
+    permute_values(beam_data.petsc_global_next_node_idxs, beam_order);
+    permute_values(beam_data.petsc_global_prev_node_idxs, beam_order);
+    permute_values(beam_data.rigidities, beam_order);
+    permute_values(beam_data.curvatures, beam_order);
+    beam_data.num_local_beams = static_cast<int>(std::count(beam_group.begin(), beam_group.end(), 0));
+    beam_data.num_active_beams = num_beams - static_cast<int>(std::count(beam_group.begin(), beam_group.end(), 2));
+
+    // NOTE: Target points are always local.
+    TargetPointData& target_point_data = d_target_point_data[level_number];
+    const int num_target_points = static_cast<int>(target_point_data.petsc_node_idxs.size());
+    std::vector<int> target_point_group(num_target_points);
+    for (int k = 0; k < num_target_points; ++k)
+    {
+        target_point_group[k] = is_in_ranges(target_point_data.lag_node_idxs[k], inactive_lag_idx_ranges) ? 1 : 0;
+    }
+    const std::vector<int> target_point_order =
+        get_sorted_order(target_point_group, target_point_data.petsc_node_idxs, target_point_data.petsc_node_idxs);
+    permute_values(target_point_data.lag_node_idxs, target_point_order);
+    permute_values(target_point_data.petsc_node_idxs, target_point_order);
+    permute_values(target_point_data.petsc_global_node_idxs, target_point_order);
+    permute_values(target_point_data.kappa, target_point_order);
+    permute_values(target_point_data.eta, target_point_order);
+    permute_values(target_point_data.X0, target_point_order);
+    target_point_data.num_active_target_points =
+        num_target_points - static_cast<int>(std::count(target_point_group.begin(), target_point_group.end(), 1));
+    return;
+} // sortLevelData
+
 void
 IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_set,
                                               const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
@@ -751,6 +962,7 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
     force_fcns.resize(total_num_springs);
     force_deriv_fcns.resize(total_num_springs);
     parameters.resize(total_num_springs);
+    std::vector<int> num_parameters(total_num_springs);
 
     // Setup the data structures used to compute spring forces.
     int current_spring = 0;
@@ -781,9 +993,14 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
             force_fcns[current_spring] = d_spring_force_fcn_map[fcn[k]];
             force_deriv_fcns[current_spring] = d_spring_force_deriv_fcn_map[fcn[k]];
             parameters[current_spring] = params.empty() ? nullptr : &params[k][0];
+            num_parameters[current_spring] = params.empty() ? 0 : static_cast<int>(params[k].size());
             ++current_spring;
         }
     }
+    if (d_deduplicate_parameters)
+    {
+        intern_values(parameters, num_parameters, d_spring_data[level_number].parameter_table);
+    }
 
     // Map the Lagrangian slave node indices to the PETSc indices corresponding
     // to the present data distribution.
@@ -815,10 +1032,19 @@ IBStandardForceGen::computeLagrangianSpringForce(Pointer<LData> F_data,
                                                  const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                                  const int level_number,
                                                  const double /*data_time*/,
-                                                 LDataManager* const /*l_data_manager*/)
+                                                 LDataManager* const /*l_data_manager*/,
+                                                 const bool local_springs)
 {
-    const int num_springs = static_cast<int>(d_spring_data[level_number].lag_mastr_node_idxs.size());
+    const SpringData& spring_data = d_spring_data[level_number];
+    const int num_springs = static_cast<int>(spring_data.lag_mastr_node_idxs.size());
     const bool uses_springs = (num_springs > 0);
+
+    // Determine the range of springs to evaluate.  The linear springs in the
+    // range are stored first.
+    const int k_begin = local_springs ? 0 : spring_data.num_local_springs;
+    const int k_end = local_springs ? spring_data.num_local_springs : spring_data.num_active_springs;
+    const int k_linear_end =
+        k_begin + (local_springs ? spring_data.num_local_linear_springs : spring_data.num_nonlocal_linear_springs);
     const int* const lag_mastr_node_idxs = uses_springs ? &d_spring_data[level_number].lag_mastr_node_idxs[0] : nullptr;
     const int* const lag_slave_node_idxs = uses_springs ? &d_spring_data[level_number].lag_slave_node_idxs[0] : nullptr;
     const int* const petsc_mastr_node_idxs =
@@ -833,19 +1059,62 @@ IBStandardForceGen::computeLagrangianSpringForce(Pointer<LData> F_data,
     static const int BLOCKSIZE = 16; // this parameter needs to be tuned
     int k, kblock, kunroll, mastr_idx, slave_idx;
     double F[NDIM], D[NDIM], R, T_over_R;
+
+    // The default linear springs are stored first and are evaluated with the
+    // force law inlined.
+    for (k = k_begin; k < k_linear_end; ++k)
+    {
+        mastr_idx = petsc_mastr_node_idxs[k];
+        slave_idx = petsc_slave_node_idxs[k];
+#if !defined(NDEBUG)
+        TBOX_ASSERT(mastr_idx != slave_idx);
+#endif
+        D[0] = X_node[slave_idx + 0] - X_node[mastr_idx + 0];
+        D[1] = X_node[slave_idx + 1] - X_node[mastr_idx + 1];
+#if (NDIM == 3)
+        D[2] = X_node[slave_idx + 2] - X_node[mastr_idx + 2];
+#endif
+#if (NDIM == 2)
+        R = std::sqrt(D[0] * D[0] + D[1] * D[1]);
+#endif
+#if (NDIM == 3)
+        R = std::sqrt(D[0] * D[0] + D[1] * D[1] + D[2] * D[2]);
+#endif
+        if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) continue;
+        const double* const params = parameters[k];
+        T_over_R = params[0] * (R - params[1]) / R;
+        F[0] = T_over_R * D[0];
+        F[1] = T_over_R * D[1];
+#if (NDIM == 3)
+        F[2] = T_over_R * D[2];
+#endif
+        F_node[mastr_idx + 0] += F[0];
+        F_node[mastr_idx + 1] += F[1];
+#if (NDIM == 3)
+        F_node[mastr_idx + 2] += F[2];
+#endif
+        F_node[slave_idx + 0] -= F[0];
+        F_node[slave_idx + 1] -= F[1];
+#if (NDIM == 3)
+        F_node[slave_idx + 2] -= F[2];
+#endif
+    }
+
+    // The remaining springs call their force functions.
+    const int k_offset = k_linear_end;
     kblock = 0;
-    for (; kblock < (num_springs - 1) / BLOCKSIZE;
+    for (; kblock < (k_end - k_offset - 1) / BLOCKSIZE;
          ++kblock) // ensure that the last block is NOT handled by this first loop
     {
-        PREFETCH_READ_NTA_BLOCK(lag_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(lag_slave_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_slave_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(force_fcns + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(parameters + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
+        PREFETCH_READ_NTA_BLOCK(lag_mastr_node_idxs + k_offset + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
+        PREFETCH_READ_NTA_BLOCK(lag_slave_node_idxs + k_offset + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
+        PREFETCH_READ_NTA_BLOCK(petsc_mastr_node_idxs + k_offset + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
+        PREFETCH_READ_NTA_BLOCK(petsc_slave_node_idxs + k_offset + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
+        PREFETCH_READ_NTA_BLOCK(force_fcns + k_offset + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
+        PREFETCH_READ_NTA_BLOCK(parameters + k_offset + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
         for (kunroll = 0; kunroll < BLOCKSIZE; ++kunroll)
         {
-            k = kblock * BLOCKSIZE + kunroll;
+            k = k_offset + kblock * BLOCKSIZE + kunroll;
             mastr_idx = petsc_mastr_node_idxs[k];
             slave_idx = petsc_slave_node_idxs[k];
 #if !defined(NDEBUG)
@@ -886,7 +1155,7 @@ IBStandardForceGen::computeLagrangianSpringForce(Pointer<LData> F_data,
 #endif
         }
     }
-    for (k = kblock * BLOCKSIZE; k < num_springs; ++k)
+    for (k = k_offset + kblock * BLOCKSIZE; k < k_end; ++k)
     {
         mastr_idx = petsc_mastr_node_idxs[k];
         slave_idx = petsc_slave_node_idxs[k];
@@ -936,6 +1205,7 @@ IBStandardForceGen::initializeBeamLevelData(std::set<int>& nonlocal_petsc_idx_se
                                             const bool /*initial_time*/,
                                             LDataManager* const l_data_manager)
 {
+    std::vector<int>& lag_mastr_node_idxs = d_beam_data[level_number].lag_mastr_node_idxs;
     std::vector<int>& petsc_mastr_node_idxs = d_beam_data[level_number].petsc_mastr_node_idxs;
     std::vector<int>& petsc_next_node_idxs = d_beam_data[level_number].petsc_next_node_idxs;
     std::vector<int>& petsc_prev_node_idxs = d_beam_data[level_number].petsc_prev_node_idxs;
@@ -957,6 +1227,7 @@ IBStandardForceGen::initializeBeamLevelData(std::set<int>& nonlocal_petsc_idx_se
         const IBBeamForceSpec* const force_spec = node_idx->getNodeDataItem<IBBeamForceSpec>();
         if (force_spec) total_num_beams += force_spec->getNumberOfBeams();
     }
+    lag_mastr_node_idxs.resize(total_num_beams);
     petsc_mastr_node_idxs.resize(total_num_beams);
     petsc_next_node_idxs.resize(total_num_beams);
     petsc_prev_node_idxs.resize(total_num_beams);
@@ -973,8 +1244,8 @@ IBStandardForceGen::initializeBeamLevelData(std::set<int>& nonlocal_petsc_idx_se
         const IBBeamForceSpec* const force_spec = node_idx->getNodeDataItem<IBBeamForceSpec>();
         if (!force_spec) continue;
 
-#if !defined(NDEBUG)
         const int lag_idx = node_idx->getLagrangianIndex();
+#if !defined(NDEBUG)
         TBOX_ASSERT(lag_idx == force_spec->getMasterNodeIndex());
 #endif
         const int petsc_idx = node_idx->getGlobalPETScIndex();
@@ -989,6 +1260,7 @@ IBStandardForceGen::initializeBeamLevelData(std::set<int>& nonlocal_petsc_idx_se
 #endif
         for (unsigned int k = 0; k < num_beams; ++k)
         {
+            lag_mastr_node_idxs[current_beam] = lag_idx;
             petsc_mastr_node_idxs[current_beam] = petsc_idx;
             petsc_next_node_idxs[current_beam] = nghbrs[k].first;
             petsc_prev_node_idxs[current_beam] = nghbrs[k].second;
@@ -997,6 +1269,11 @@ IBStandardForceGen::initializeBeamLevelData(std::set<int>& nonlocal_petsc_idx_se
             ++current_beam;
         }
     }
+    if (d_deduplicate_parameters)
+    {
+        intern_values(rigidities, std::vector<int>(total_num_beams, 1), d_beam_data[level_number].rigidity_table);
+        intern_vectors(curvatures, d_beam_data[level_number].curvature_table);
+    }
 
     // Map the Lagrangian neighbor node indices to the PETSc indices
     // corresponding to the present data distribution.
@@ -1039,10 +1316,16 @@ IBStandardForceGen::computeLagrangianBeamForce(Pointer<LData> F_data,
                                                const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                                const int level_number,
                                                const double /*data_time*/,
-                                               LDataManager* const /*l_data_manager*/)
+                                               LDataManager* const /*l_data_manager*/,
+                                               const bool local_beams)
 {
     const int num_beams = static_cast<int>(d_beam_data[level_number].petsc_mastr_node_idxs.size());
     const bool uses_beams = (num_beams > 0);
+
+    // Determine the range of beams to evaluate.
+    const int num_local_beams = d_beam_data[level_number].num_local_beams;
+    const int k_offset = local_beams ? 0 : num_local_beams;
+    const int k_end = local_beams ? num_local_beams : d_beam_data[level_number].num_active_beams;
     const int* const petsc_mastr_node_idxs = uses_beams ? &d_beam_data[level_number].petsc_mastr_node_idxs[0] : nullptr;
     const int* const petsc_next_node_idxs = uses_beams ? &d_beam_data[level_number].petsc_next_node_idxs[0] : nullptr;
     const int* const petsc_prev_node_idxs = uses_beams ? &d_beam_data[level_number].petsc_prev_node_idxs[0] : nullptr;
@@ -1057,17 +1340,17 @@ IBStandardForceGen::computeLagrangianBeamForce(Pointer<LData> F_data,
     const double* D2X0;
     double F[NDIM];
     kblock = 0;
-    for (; kblock < (num_beams - 1) / BLOCKSIZE;
+    for (; kblock < (k_end - k_offset - 1) / BLOCKSIZE;
          ++kblock) // ensure that the last block is NOT handled by this first loop
     {
-        PREFETCH_READ_NTA_BLOCK(petsc_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_next_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_prev_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(rigidities + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(curvatures + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
+        PREFETCH_READ_NTA_BLOCK(petsc_mastr_node_idxs + k_offset + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
+        PREFETCH_READ_NTA_BLOCK(petsc_next_node_idxs + k_offset + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
+        PREFETCH_READ_NTA_BLOCK(petsc_prev_node_idxs + k_offset + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
+        PREFETCH_READ_NTA_BLOCK(rigidities + k_offset + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
+        PREFETCH_READ_NTA_BLOCK(curvatures + k_offset + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
         for (kunroll = 0; kunroll < BLOCKSIZE; ++kunroll)
         {
-            k = kblock * BLOCKSIZE + kunroll;
+            k = k_offset + kblock * BLOCKSIZE + kunroll;
             mastr_idx = petsc_mastr_node_idxs[k];
             next_idx = petsc_next_node_idxs[k];
             prev_idx = petsc_prev_node_idxs[k];
@@ -1107,7 +1390,7 @@ IBStandardForceGen::computeLagrangianBeamForce(Pointer<LData> F_data,
 #endif
         }
     }
-    for (k = kblock * BLOCKSIZE; k < num_beams; ++k)
+    for (k = k_offset + kblock * BLOCKSIZE; k < k_end; ++k)
     {
         mastr_idx = petsc_mastr_node_idxs[k];
         next_idx = petsc_next_node_idxs[k];
@@ -1153,6 +1436,7 @@ IBStandardForceGen::initializeTargetPointLevelData(std::set<int>& /*nonlocal_pet
                                                    const bool /*initial_time*/,
                                                    LDataManager* const l_data_manager)
 {
+    std::vector<int>& lag_node_idxs = d_target_point_data[level_number].lag_node_idxs;
     std::vector<int>& petsc_node_idxs = d_target_point_data[level_number].petsc_node_idxs;
     std::vector<int>& petsc_global_node_idxs = d_target_point_data[level_number].petsc_global_node_idxs;
     std::vector<const double*>& kappa = d_target_point_data[level_number].kappa;
@@ -1174,6 +1458,7 @@ IBStandardForceGen::initializeTargetPointLevelData(std::set<int>& /*nonlocal_pet
 
     // Resize arrays for storing cached values used to compute target point
     // forces.
+    lag_node_idxs.resize(total_num_target_points);
     petsc_node_idxs.resize(total_num_target_points);
     petsc_global_node_idxs.resize(total_num_target_points);
     kappa.resize(total_num_target_points);
@@ -1186,6 +1471,7 @@ IBStandardForceGen::initializeTargetPointLevelData(std::set<int>& /*nonlocal_pet
     {
         const IBTargetPointForceSpec* const force_spec = node_idx->getNodeDataItem<IBTargetPointForceSpec>();
         if (!force_spec) continue;
+        lag_node_idxs[current_target_point] = node_idx->getLagrangianIndex();
         petsc_global_node_idxs[current_target_point] = petsc_node_idxs[current_target_point] =
             node_idx->getGlobalPETScIndex();
         kappa[current_target_point] = &force_spec->getStiffness();
@@ -1193,6 +1479,12 @@ IBStandardForceGen::initializeTargetPointLevelData(std::set<int>& /*nonlocal_pet
         X0[current_target_point] = &force_spec->getTargetPointPosition();
         ++current_target_point;
     }
+    if (d_deduplicate_parameters)
+    {
+        const std::vector<int> num_values(total_num_target_points, 1);
+        intern_values(kappa, num_values, d_target_point_data[level_number].kappa_table);
+        intern_values(eta, num_values, d_target_point_data[level_number].eta_table);
+    }
 
     return;
 } // initializeTargetPointLevelData
@@ -1208,7 +1500,8 @@ IBStandardForceGen::computeLagrangianTargetPointForce(Pointer<LData> F_data,
 {
     double max_displacement = 0.0;
 
-    const int num_target_points = static_cast<int>(d_target_point_data[level_number].petsc_node_idxs.size());
+    // Target points of inactivated structures are stored last and are skipped.
+    const int num_target_points = d_target_point_data[level_number].num_active_target_points;
     const bool uses_target_points = (num_target_points > 0);
     const int* const petsc_node_idxs =
         uses_target_points ? &d_target_point_data[level_number].petsc_node_idxs[0] : nullptr;
@@ -39,9 +39,14 @@
 #include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
 
+#include <sys/stat.h>
+
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 #include <ios>
 #include <iosfwd>
 #include <istream>
@@ -89,6 +94,47 @@ discard_comments(const std::string& input_string)
     string_stream.clear();
     return output_string;
 } // discard_comments
+
+// Binary structure files are named by appending this suffix to the name of the
+// corresponding ASCII file (e.g., "foo.vertex.bin").  See scripts/IB/ for a
+// converter from the ASCII formats.
+static const std::string s_binary_file_suffix = ".bin";
+
+// Binary structure files start with this tag, followed by the format version,
+// the spatial dimension, and the number of records in the file, each stored as
+// a 32-bit integer.
+static const char s_binary_file_tag[8] = { 'I', 'B', 'S', 'T', 'R', 'U', 'C', 'T' };
+static const std::int32_t s_binary_file_version = 1;
+static const std::size_t s_binary_header_size = sizeof(s_binary_file_tag) + 3 * sizeof(std::int32_t);
+
+inline bool
+file_exists(const std::string& filename)
+{
+    std::ifstream file_stream(filename);
+    return file_stream.is_open();
+} // file_exists
+
+template <typename T>
+inline bool
+read_binary_values(std::istream& stream, T* const values, const std::size_t num_values)
+{
+    stream.read(reinterpret_cast<char*>(values), num_values * sizeof(T));
+    return static_cast<bool>(stream);
+} // read_binary_values
+
+// Read the header of a binary structure file and return the number of records
+// in the file, or -1 if the header is not valid.
+inline int
+read_binary_header(std::istream& stream)
+{
+    char tag[sizeof(s_binary_file_tag)];
+    std::int32_t header[3];
+    if (!read_binary_values(stream, tag, sizeof(tag)) || std::memcmp(tag, s_binary_file_tag, sizeof(tag)) != 0)
+        return -1;
+    if (!read_binary_values(stream, header, 3)) return -1;
+    if (header[0] != s_binary_file_version || header[1] != NDIM) return -1;
+    return header[2];
+} // read_binary_header
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -184,6 +230,25 @@ IBStandardInitializer::init()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+bool
+IBStandardInitializer::useBinaryFile(const std::string& ascii_filename) const
+{
+    const std::string binary_filename = ascii_filename + s_binary_file_suffix;
+    if (!d_use_binary_structure_files || !file_exists(binary_filename)) return false;
+
+    // Warn about binary files that were not regenerated after the
+    // corresponding ASCII file was modified.
+    struct stat ascii_stat, binary_stat;
+    if (stat(ascii_filename.c_str(), &ascii_stat) == 0 && stat(binary_filename.c_str(), &binary_stat) == 0 &&
+        ascii_stat.st_mtime > binary_stat.st_mtime)
+    {
+        TBOX_WARNING(d_object_name << ":\n  Binary input file " << binary_filename
+                                   << " is older than the ASCII input file " << ascii_filename
+                                   << ".\n  The binary file is used.\n");
+    }
+    return true;
+} // useBinaryFile
+
 void
 IBStandardInitializer::readVertexFiles(const std::string& extension)
 {
@@ -201,8 +266,17 @@ IBStandardInitializer::readVertexFiles(const std::string& extension)
         d_vertex_posn[ln].resize(num_base_filename);
         for (unsigned int j = 0; j < num_base_filename; ++j)
         {
+            const std::string vertex_filename = d_base_filename[ln][j] + extension;
+            const std::string binary_vertex_filename = vertex_filename + s_binary_file_suffix;
+            const bool use_binary = useBinaryFile(vertex_filename);
+
+            // Binary vertex files may be read collectively, in which case
+            // batons are not used.
+            const bool read_collectively = d_use_collective_binary_vertex_reads && use_binary;
+            const bool use_file_batons = d_use_file_batons && !read_collectively;
+
             // Wait for the previous MPI process to finish reading the current file.
-            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+            if (use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
 
             if (j == 0)
             {
@@ -213,10 +287,104 @@ IBStandardInitializer::readVertexFiles(const std::string& extension)
                 d_vertex_offset[ln][j] = d_vertex_offset[ln][j - 1] + d_num_vertex[ln][j - 1];
             }
 
-            // Ensure that the file exists.
-            const std::string vertex_filename = d_base_filename[ln][j] + extension;
+            // Ensure that the file exists.  Binary files, if enabled, take
+            // precedence over ASCII files.
             std::ifstream file_stream(vertex_filename);
-            if (file_stream.is_open())
+            std::ifstream binary_file_stream;
+            if (use_binary) binary_file_stream.open(binary_vertex_filename, std::ios::in | std::ios::binary);
+            if (read_collectively)
+            {
+                plog << d_object_name << ":  "
+                     << "collectively processing vertex data from binary input file named "
+                     << binary_vertex_filename << std::endl
+                     << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+
+                d_num_vertex[ln][j] = read_binary_header(binary_file_stream);
+                if (d_num_vertex[ln][j] <= 0)
+                {
+                    TBOX_ERROR(d_object_name << ":\n  Invalid header in binary input file "
+                                             << binary_vertex_filename << std::endl);
+                }
+
+                // Each process reads a contiguous range of the vertex records,
+                // and the ranges are then gathered on all processes.
+                const int num_vertex = d_num_vertex[ln][j];
+                std::vector<int> counts(nodes), displs(nodes);
+                for (int r = 0; r < nodes; ++r)
+                {
+                    const int begin = static_cast<int>((static_cast<long long>(num_vertex) * r) / nodes);
+                    const int end = static_cast<int>((static_cast<long long>(num_vertex) * (r + 1)) / nodes);
+                    counts[r] = NDIM * (end - begin);
+                    displs[r] = NDIM * begin;
+                }
+                std::vector<double> X_data(NDIM * static_cast<std::size_t>(num_vertex));
+                binary_file_stream.seekg(s_binary_header_size + displs[rank] * sizeof(double));
+                if (!read_binary_values(binary_file_stream, X_data.data() + displs[rank], counts[rank]))
+                {
+                    TBOX_ERROR(d_object_name << ":\n  Premature end to binary input file "
+                                             << binary_vertex_filename << std::endl);
+                }
+                MPI_Allgatherv(MPI_IN_PLACE,
+                               0,
+                               MPI_DATATYPE_NULL,
+                               X_data.data(),
+                               counts.data(),
+                               displs.data(),
+                               MPI_DOUBLE,
+                               SAMRAI_MPI::getCommunicator());
+                d_vertex_posn[ln][j].resize(num_vertex);
+                for (int k = 0; k < num_vertex; ++k)
+                {
+                    Point& X = d_vertex_posn[ln][j][k];
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        X[d] = d_length_scale_factor * (X_data[NDIM * k + d] + d_posn_shift[d]);
+                    }
+                }
+
+                plog << d_object_name << ":  "
+                     << "read " << counts[rank] / NDIM << " of " << num_vertex
+                     << " vertices from binary input file named " << binary_vertex_filename << std::endl
+                     << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+            }
+            else if (binary_file_stream.is_open())
+            {
+                plog << d_object_name << ":  "
+                     << "processing vertex data from binary input file named " << binary_vertex_filename
+                     << std::endl
+                     << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+
+                d_num_vertex[ln][j] = read_binary_header(binary_file_stream);
+                if (d_num_vertex[ln][j] <= 0)
+                {
+                    TBOX_ERROR(d_object_name << ":\n  Invalid header in binary input file "
+                                             << binary_vertex_filename << std::endl);
+                }
+
+                // The vertex positions are stored contiguously, so they are
+                // read with a single call.
+                std::vector<double> X_data(NDIM * static_cast<std::size_t>(d_num_vertex[ln][j]));
+                if (!read_binary_values(binary_file_stream, X_data.data(), X_data.size()))
+                {
+                    TBOX_ERROR(d_object_name << ":\n  Premature end to binary input file "
+                                             << binary_vertex_filename << std::endl);
+                }
+                d_vertex_posn[ln][j].resize(d_num_vertex[ln][j]);
+                for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+                {
+                    Point& X = d_vertex_posn[ln][j][k];
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        X[d] = d_length_scale_factor * (X_data[NDIM * k + d] + d_posn_shift[d]);
+                    }
+                }
+
+                plog << d_object_name << ":  "
+                     << "read " << d_num_vertex[ln][j] << " vertices from binary input file named "
+                     << binary_vertex_filename << std::endl
+                     << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+            }
+            else if (file_stream.is_open())
             {
                 plog << d_object_name << ":  "
                      << "processing vertex data from ASCII input file named " << vertex_filename << std::endl
@@ -288,7 +456,7 @@ IBStandardInitializer::readVertexFiles(const std::string& extension)
             }
 
             // Free the next MPI process to start reading the current file.
-            if (d_use_file_batons && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
+            if (use_file_batons && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
         }
     }
 
@@ -324,19 +492,28 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
             // Wait for the previous MPI process to finish reading the current file.
             if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
 
-            // Ensure that the file exists.
-            const std::string spring_filename = d_base_filename[ln][j] + extension;
-            std::ifstream file_stream(spring_filename);
+            // Ensure that the file exists.  Binary files take precedence over
+            // ASCII files.
+            const std::string ascii_spring_filename = d_base_filename[ln][j] + extension;
+            const bool use_binary = useBinaryFile(ascii_spring_filename);
+            const std::string spring_filename = ascii_spring_filename + (use_binary ? s_binary_file_suffix : "");
+            const std::string format_name = use_binary ? "binary" : "ASCII";
+            std::ifstream file_stream(spring_filename, use_binary ? std::ios::in | std::ios::binary : std::ios::in);
             if (file_stream.is_open())
             {
                 plog << d_object_name << ":  "
-                     << "processing spring data from ASCII input file named " << spring_filename << std::endl
+                     << "processing spring data from " << format_name << " input file named " << spring_filename
+                     << std::endl
                      << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
 
                 // The first line in the file indicates the number of edges in the input
                 // file.
                 int num_edges = -1;
-                if (!std::getline(file_stream, line_string))
+                if (use_binary)
+                {
+                    num_edges = read_binary_header(file_stream);
+                }
+                else if (!std::getline(file_stream, line_string))
                 {
                     TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered "
                                                 "before line 1 of file "
@@ -367,7 +544,42 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
                     Edge e;
                     std::vector<double> parameters(2);
                     int force_fcn_idx = 0;
-                    if (!std::getline(file_stream, line_string))
+                    if (use_binary)
+                    {
+                        // Each record consists of the two vertex indices, the
+                        // force function index, and the number of parameters,
+                        // followed by the parameters themselves.
+                        std::int32_t record[4];
+                        if (!read_binary_values(file_stream, record, 4) || record[3] < 2)
+                        {
+                            TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record "
+                                                     << k << " of file " << spring_filename << std::endl);
+                        }
+                        e = std::make_pair(record[0], record[1]);
+                        force_fcn_idx = record[2];
+                        parameters.resize(record[3]);
+                        if (!read_binary_values(file_stream, parameters.data(), parameters.size()))
+                        {
+                            TBOX_ERROR(d_object_name << ":\n  Premature end to binary input file encountered in record "
+                                                     << k << " of file " << spring_filename << std::endl);
+                        }
+                        if ((e.first < min_idx) || (e.first >= max_idx) || (e.second < min_idx) ||
+                            (e.second >= max_idx))
+                        {
+                            TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record "
+                                                     << k << " of file " << spring_filename << std::endl
+                                                     << "  vertex index is out of range" << std::endl);
+                        }
+                        if (parameters[0] < 0.0 || parameters[1] < 0.0)
+                        {
+                            TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record "
+                                                     << k << " of file " << spring_filename << std::endl
+                                                     << "  spring constant or resting length is negative"
+                                                     << std::endl);
+                        }
+                        parameters[1] *= d_length_scale_factor;
+                    }
+                    else if (!std::getline(file_stream, line_string))
                     {
                         TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line " << k + 2
                                                  << " of file " << spring_filename << std::endl);
@@ -460,8 +672,9 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
                         (parameters[0] == 0.0 || MathUtilities<double>::equalEps(parameters[0], 0.0)))
                     {
                         TBOX_WARNING(d_object_name << ":\n  Spring with zero spring constant "
-                                                      "encountered in ASCII input file named "
-                                                   << spring_filename << "." << std::endl);
+                                                      "encountered in "
+                                                   << format_name << " input file named " << spring_filename << "."
+                                                   << std::endl);
                         warned = true;
                     }
 
@@ -494,7 +707,8 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
                                      << ":\n  Duplicate spring connection between nodes "
                                      << (e.first + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << " and "
                                      << (e.second + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
-                                     << " encountered in ASCII input file named " << spring_filename << ".\n"
+                                     << " encountered in " << format_name << " input file named "
+                                     << spring_filename << ".\n"
                                      << "  Skipping duplicated connection." << std::endl);
                     }
                     else
@@ -511,7 +725,8 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
                 file_stream.close();
 
                 plog << d_object_name << ":  "
-                     << "read " << num_edges << " edges from ASCII input file named " << spring_filename << std::endl
+                     << "read " << num_edges << " edges from " << format_name << " input file named "
+                     << spring_filename << std::endl
                      << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
             }
             else
@@ -792,18 +1007,27 @@ IBStandardInitializer::readBeamFiles(const std::string& extension, const bool in
             // Wait for the previous MPI process to finish reading the current file.
             if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
 
-            const std::string beam_filename = d_base_filename[ln][j] + extension;
-            std::ifstream file_stream(beam_filename);
+            // Binary files take precedence over ASCII files.
+            const std::string ascii_beam_filename = d_base_filename[ln][j] + extension;
+            const bool use_binary = useBinaryFile(ascii_beam_filename);
+            const std::string beam_filename = ascii_beam_filename + (use_binary ? s_binary_file_suffix : "");
+            const std::string format_name = use_binary ? "binary" : "ASCII";
+            std::ifstream file_stream(beam_filename, use_binary ? std::ios::in | std::ios::binary : std::ios::in);
             if (file_stream.is_open())
             {
                 plog << d_object_name << ":  "
-                     << "processing beam data from ASCII input file named " << beam_filename << std::endl
+                     << "processing beam data from " << format_name << " input file named " << beam_filename
+                     << std::endl
                      << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
 
                 // The first line in the file indicates the number of beams in
                 // the input file.
                 int num_beams = -1;
-                if (!std::getline(file_stream, line_string))
+                if (use_binary)
+                {
+                    num_beams = read_binary_header(file_stream);
+                }
+                else if (!std::getline(file_stream, line_string))
                 {
                     TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered "
                                                 "before line 1 of file "
@@ -835,7 +1059,42 @@ IBStandardInitializer::readBeamFiles(const std::string& extension, const bool in
                         next_idx = std::numeric_limits<int>::max();
                     double bend = 0.0;
                     Vector curv(Vector::Zero());
-                    if (!std::getline(file_stream, line_string))
+                    if (use_binary)
+                    {
+                        // Each record consists of the three vertex indices,
+                        // followed by the bending rigidity and the NDIM
+                        // components of the curvature.
+                        std::int32_t idxs[3];
+                        double values[1 + NDIM];
+                        if (!read_binary_values(file_stream, idxs, 3) ||
+                            !read_binary_values(file_stream, values, 1 + NDIM))
+                        {
+                            TBOX_ERROR(d_object_name << ":\n  Premature end to binary input file encountered in record "
+                                                     << k << " of file " << beam_filename << std::endl);
+                        }
+                        prev_idx = idxs[0];
+                        curr_idx = idxs[1];
+                        next_idx = idxs[2];
+                        for (const int idx : { prev_idx, curr_idx, next_idx })
+                        {
+                            if ((idx < min_idx) || (idx >= max_idx))
+                            {
+                                TBOX_ERROR(d_object_name
+                                           << ":\n  Invalid entry in binary input file encountered in record " << k
+                                           << " of file " << beam_filename << std::endl
+                                           << "  vertex index " << idx << " is out of range" << std::endl);
+                            }
+                        }
+                        bend = values[0];
+                        if (bend < 0.0)
+                        {
+                            TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record "
+                                                     << k << " of file " << beam_filename << std::endl
+                                                     << "  beam constant is negative" << std::endl);
+                        }
+                        for (unsigned int d = 0; d < NDIM; ++d) curv[d] = values[1 + d];
+                    }
+                    else if (!std::getline(file_stream, line_string))
                     {
                         TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line " << k + 2
                                                  << " of file " << beam_filename << std::endl);
@@ -934,8 +1193,9 @@ IBStandardInitializer::readBeamFiles(const std::string& extension, const bool in
                     if (!warned && d_enable_beams[ln][j] && (bend == 0.0 || MathUtilities<double>::equalEps(bend, 0.0)))
                     {
                         TBOX_WARNING(d_object_name << ":\n  Beam with zero bending rigidity "
-                                                      "encountered in ASCII input file named "
-                                                   << beam_filename << "." << std::endl);
+                                                      "encountered in "
+                                                   << format_name << " input file named " << beam_filename << "."
+                                                   << std::endl);
                         warned = true;
                     }
 
@@ -968,7 +1228,8 @@ IBStandardInitializer::readBeamFiles(const std::string& extension, const bool in
                                      << (prev_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << ",  "
                                      << (curr_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << ", and "
                                      << (next_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
-                                     << " encountered in ASCII input file named " << beam_filename << ".\n"
+                                     << " encountered in " << format_name << " input file named "
+                                     << beam_filename << ".\n"
                                      << "  Skipping duplicated connection." << std::endl);
                     }
                     else
@@ -985,7 +1246,8 @@ IBStandardInitializer::readBeamFiles(const std::string& extension, const bool in
                 file_stream.close();
 
                 plog << d_object_name << ":  "
-                     << "read " << num_beams << " beams from ASCII input file named " << beam_filename << std::endl
+                     << "read " << num_beams << " beams from " << format_name << " input file named "
+                     << beam_filename << std::endl
                      << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
             }
             else
@@ -2582,6 +2844,16 @@ IBStandardInitializer::getFromInput(Pointer<Database> db)
     // reading the same file at once.
     if (db->keyExists("use_file_batons")) d_use_file_batons = db->getBool("use_file_batons");
 
+    // Determine whether binary structure files are read in place of the ASCII
+    // files.
+    if (db->keyExists("use_binary_structure_files"))
+        d_use_binary_structure_files = db->getBool("use_binary_structure_files");
+
+    // Determine whether binary vertex files are read collectively, with each
+    // MPI process reading only a part of each file.
+    if (db->keyExists("use_collective_binary_vertex_reads"))
+        d_use_collective_binary_vertex_reads = db->getBool("use_collective_binary_vertex_reads");
+
     // Determine the (maximum) number of levels in the locally refined grid.
     // Note that each piece of the Lagrangian structure must be assigned to a
     // particular level of the grid.
@@ -2676,6 +2948,30 @@ IBStandardInitializer::getFromInput(Pointer<Database> db)
     // level-by-level ``base_filenames'' keys if necessary.
     if (db->keyExists("structure_names"))
     {
+        // Structures may specify the spacing of their Lagrangian meshes instead
+        // of a level number, in which case each is assigned to the coarsest
+        // level whose grid spacing is at most a given multiple of the
+        // Lagrangian spacing.  Doing so requires the grid spacing of the
+        // coarsest level and the refinement ratios between levels.
+        std::vector<double> level_dx;
+        if (db->keyExists("coarsest_grid_spacing"))
+        {
+            level_dx.resize(d_max_levels);
+            level_dx[0] = db->getDouble("coarsest_grid_spacing");
+            std::vector<int> ref_ratios(1, 2);
+            if (db->keyExists("refinement_ratios"))
+            {
+                ref_ratios.resize(db->getArraySize("refinement_ratios"));
+                db->getIntegerArray("refinement_ratios", &ref_ratios[0], static_cast<int>(ref_ratios.size()));
+            }
+            for (int ln = 1; ln < d_max_levels; ++ln)
+            {
+                const int ratio = ref_ratios[std::min(ln - 1, static_cast<int>(ref_ratios.size()) - 1)];
+                level_dx[ln] = level_dx[ln - 1] / static_cast<double>(ratio);
+            }
+        }
+        const double max_spacing_ratio = db->getDoubleWithDefault("max_grid_to_lagrangian_spacing_ratio", 2.0);
+
         const int num_strcts = db->getArraySize("structure_names");
         std::vector<std::string> structure_names(num_strcts);
         db->getStringArray("structure_names", &structure_names[0], num_strcts);
@@ -2703,11 +2999,40 @@ IBStandardInitializer::getFromInput(Pointer<Database> db)
                     }
                     d_base_filename[ln].push_back(strct_name);
                 }
+                else if (sub_db->keyExists("lagrangian_spacing"))
+                {
+                    if (level_dx.empty())
+                    {
+                        TBOX_ERROR(d_object_name << ":  "
+                                                 << "Key data `coarsest_grid_spacing' is required to assign structure `"
+                                                 << strct_name << "' to a level using its `lagrangian_spacing'.");
+                    }
+                    const double ds = sub_db->getDouble("lagrangian_spacing");
+                    if (ds <= 0.0)
+                    {
+                        TBOX_ERROR(d_object_name << ":  "
+                                                 << "Key data `lagrangian_spacing' associated with structure `"
+                                                 << strct_name << "' is not positive.");
+                    }
+                    int ln = 0;
+                    while (ln < d_max_levels - 1 && level_dx[ln] > max_spacing_ratio * ds) ++ln;
+                    if (level_dx[ln] > max_spacing_ratio * ds)
+                    {
+                        TBOX_WARNING(d_object_name << ":  "
+                                                   << "The grid spacing of the finest level is more than "
+                                                   << max_spacing_ratio
+                                                   << " times the Lagrangian spacing of structure `" << strct_name
+                                                   << "'.");
+                    }
+                    plog << d_object_name << ":  structure `" << strct_name << "' assigned to level " << ln << "\n";
+                    d_base_filename[ln].push_back(strct_name);
+                }
                 else
                 {
                     TBOX_ERROR(d_object_name << ":  "
-                                             << "Key data `level_number' not found in structure `" << strct_name
-                                             << "' input.");
+                                             << "Neither key data `level_number' nor `lagrangian_spacing' found in "
+                                                "structure `"
+                                             << strct_name << "' input.");
                 }
             }
             else
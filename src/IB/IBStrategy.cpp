@@ -104,6 +104,18 @@ IBStrategy::registerEulerianCommunicationAlgorithms()
     return;
 } // registerEulerianCommunicationAlgorithms
 
+IntVector<NDIM>
+IBStrategy::getMinimumGhostCellWidthForInterpolation() const
+{
+    return getMinimumGhostCellWidth();
+} // getMinimumGhostCellWidthForInterpolation
+
+IntVector<NDIM>
+IBStrategy::getMinimumGhostCellWidthForSpreading() const
+{
+    return getMinimumGhostCellWidth();
+} // getMinimumGhostCellWidthForSpreading
+
 void
 IBStrategy::setupTagBuffer(Array<int>& tag_buffer, Pointer<GriddingAlgorithm<NDIM> > gridding_alg) const
 {
@@ -175,6 +187,18 @@ IBStrategy::backwardEulerStep(double /*current_time*/, double /*new_time*/)
     return;
 } // backwardEulerStep
 
+void
+IBStrategy::subcycledMidpointStep(const int /*u_data_idx*/,
+                                  const std::vector<Pointer<CoarsenSchedule<NDIM> > >& /*u_synch_scheds*/,
+                                  const std::vector<Pointer<RefineSchedule<NDIM> > >& /*u_ghost_fill_scheds*/,
+                                  const double /*current_time*/,
+                                  const double /*new_time*/,
+                                  const int /*num_substeps*/)
+{
+    TBOX_ERROR("IBStrategy::subcycledMidpointStep(): unimplemented\n");
+    return;
+} // subcycledMidpointStep
+
 bool
 IBStrategy::hasFluidSources() const
 {
@@ -20,10 +20,12 @@
 
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
+#include "CoarsenSchedule.h"
 #include "GriddingAlgorithm.h"
 #include "IntVector.h"
 #include "LoadBalancer.h"
 #include "PatchHierarchy.h"
+#include "RefineSchedule.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
@@ -63,6 +65,13 @@ namespace IBAMR
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
+void
+IBStrategySet::setUseCoordinatedInterpolation(const bool use_coordinated_interpolation)
+{
+    d_use_coordinated_interpolation = use_coordinated_interpolation;
+    return;
+} // setUseCoordinatedInterpolation
+
 void
 IBStrategySet::registerIBHierarchyIntegrator(IBHierarchyIntegrator* ib_solver)
 {
@@ -104,6 +113,28 @@ IBStrategySet::getMinimumGhostCellWidth() const
     return ghost_cell_width;
 } // getMinimumGhostCellWidth
 
+IntVector<NDIM>
+IBStrategySet::getMinimumGhostCellWidthForInterpolation() const
+{
+    IntVector<NDIM> ghost_cell_width = 0;
+    for (const auto& strategy : d_strategy_set)
+    {
+        ghost_cell_width = IntVector<NDIM>::max(ghost_cell_width, strategy->getMinimumGhostCellWidthForInterpolation());
+    }
+    return ghost_cell_width;
+} // getMinimumGhostCellWidthForInterpolation
+
+IntVector<NDIM>
+IBStrategySet::getMinimumGhostCellWidthForSpreading() const
+{
+    IntVector<NDIM> ghost_cell_width = 0;
+    for (const auto& strategy : d_strategy_set)
+    {
+        ghost_cell_width = IntVector<NDIM>::max(ghost_cell_width, strategy->getMinimumGhostCellWidthForSpreading());
+    }
+    return ghost_cell_width;
+} // getMinimumGhostCellWidthForSpreading
+
 void
 IBStrategySet::setupTagBuffer(Array<int>& tag_buffer, Pointer<GriddingAlgorithm<NDIM> > gridding_alg) const
 {
@@ -150,9 +181,31 @@ IBStrategySet::interpolateVelocity(int u_data_idx,
                                    const std::vector<Pointer<RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
                                    double data_time)
 {
+    if (!d_use_coordinated_interpolation || d_strategy_set.size() == 1)
+    {
+        for (const auto& strategy : d_strategy_set)
+        {
+            strategy->interpolateVelocity(u_data_idx, u_synch_scheds, u_ghost_fill_scheds, data_time);
+        }
+        return;
+    }
+
+    // Synchronize the Eulerian velocity and fill its ghost cells once, and then
+    // let each strategy interpolate without any further communication of
+    // Eulerian data.
+    for (auto it = u_synch_scheds.rbegin(); it != u_synch_scheds.rend(); ++it)
+    {
+        if (*it) (*it)->coarsenData();
+    }
+    for (const auto& u_ghost_fill_sched : u_ghost_fill_scheds)
+    {
+        if (u_ghost_fill_sched) u_ghost_fill_sched->fillData(data_time);
+    }
+    const std::vector<Pointer<CoarsenSchedule<NDIM> > > no_synch(u_synch_scheds.size());
+    const std::vector<Pointer<RefineSchedule<NDIM> > > no_fill(u_ghost_fill_scheds.size());
     for (const auto& strategy : d_strategy_set)
     {
-        strategy->interpolateVelocity(u_data_idx, u_synch_scheds, u_ghost_fill_scheds, data_time);
+        strategy->interpolateVelocity(u_data_idx, no_synch, no_fill, data_time);
     }
     return;
 } // interpolateVelocity
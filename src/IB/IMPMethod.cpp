@@ -411,6 +411,7 @@ IMPMethod::interpolateVelocity(const int u_data_idx,
 
     // Interpolate data from the Eulerian grid to the Lagrangian mesh.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const int stencil_size = LEInteractor::getStencilSize(KERNEL_FCN);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
@@ -437,6 +438,16 @@ IMPMethod::interpolateVelocity(const int u_data_idx,
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(u_data->getGhostBox() * idx_data->getGhostBox(), axis);
             }
+
+            // The kernel values are stored in buffers that are reused for all
+            // of the nodes of the patch.
+            Box<NDIM> stencil_box;
+            std::array<boost::multi_array<double, 1>, NDIM> phi, dphi;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                phi[d].resize(boost::extents[stencil_size]);
+                dphi[d].resize(boost::extents[stencil_size]);
+            }
             for (LNodeSetData::CellIterator it(idx_data->getGhostBox()); it; it++)
             {
                 const hier::Index<NDIM>& i = *it;
@@ -451,14 +462,6 @@ IMPMethod::interpolateVelocity(const int u_data_idx,
 
                     // Interpolate U and Grad U using a smoothed kernel
                     // function evaluated about X.
-                    Box<NDIM> stencil_box;
-                    const int stencil_size = LEInteractor::getStencilSize(KERNEL_FCN);
-                    std::array<boost::multi_array<double, 1>, NDIM> phi, dphi;
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        phi[d].resize(boost::extents[stencil_size]);
-                        dphi[d].resize(boost::extents[stencil_size]);
-                    }
                     for (unsigned int component = 0; component < NDIM; ++component)
                     {
                         for (unsigned int d = 0; d < NDIM; ++d)
@@ -714,6 +717,11 @@ IMPMethod::computeLagrangianForce(const double data_time)
         boost::multi_array_ref<double, 2>& tau_array = *d_tau_data[ln]->getVecArray();
         TensorValue<double> FF, PP, tau;
         VectorValue<double> X, x;
+        if (d_PK1_stress_batch_fcn)
+        {
+            computeBatchedStress(local_nodes, x_array, X_array, F_array, tau_array, data_time);
+            continue;
+        }
         for (const auto& node_idx : local_nodes)
         {
             const int idx = node_idx->getGlobalPETScIndex();
@@ -949,6 +957,15 @@ IMPMethod::registerPK1StressTensorFunction(PK1StressFcnPtr PK1_stress_fcn, void*
     return;
 } // registerPK1StressTensorFunction
 
+void
+IMPMethod::registerPK1StressTensorBatchFunction(PK1StressBatchFcnPtr PK1_stress_batch_fcn,
+                                                void* PK1_stress_batch_fcn_ctx)
+{
+    d_PK1_stress_batch_fcn = PK1_stress_batch_fcn;
+    d_PK1_stress_batch_fcn_ctx = PK1_stress_batch_fcn_ctx;
+    return;
+} // registerPK1StressTensorBatchFunction
+
 void
 IMPMethod::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > load_balancer, int workload_data_idx)
 {
@@ -1198,6 +1215,89 @@ IMPMethod::reinitMidpointData(const std::vector<Pointer<LData> >& current_data,
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+IMPMethod::computeBatchedStress(const std::vector<LNode*>& local_nodes,
+                                const boost::multi_array_ref<double, 2>& x_array,
+                                const boost::multi_array_ref<double, 2>& X_array,
+                                const boost::multi_array_ref<double, 2>& F_array,
+                                boost::multi_array_ref<double, 2>& tau_array,
+                                const double data_time)
+{
+    // Gather the data of the local material points.
+    std::vector<int> batch_idxs;
+    std::vector<MaterialPointSpec*> batch_specs;
+    batch_idxs.reserve(local_nodes.size());
+    batch_specs.reserve(local_nodes.size());
+    for (const auto& node_idx : local_nodes)
+    {
+        const int idx = node_idx->getGlobalPETScIndex();
+        auto mp_spec = node_idx->getNodeDataItem<MaterialPointSpec>();
+        if (mp_spec)
+        {
+            batch_idxs.push_back(idx);
+            batch_specs.push_back(mp_spec);
+        }
+        else
+        {
+            std::fill(&tau_array[idx][0], &tau_array[idx][0] + NDIM * NDIM, 0.0);
+        }
+    }
+    MaterialPointBatch& batch = d_mp_batch;
+    batch.size = batch_idxs.size();
+    for (unsigned int c = 0; c < 9; ++c)
+    {
+        batch.FF[c].assign(batch.size, 0.0);
+        batch.PP[c].assign(batch.size, 0.0);
+    }
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        batch.x[d].resize(batch.size);
+        batch.X[d].resize(batch.size);
+    }
+    batch.subdomain_ids.resize(batch.size);
+    batch.internal_vars.resize(batch.size);
+#if (NDIM == 2)
+    std::fill(batch.FF[8].begin(), batch.FF[8].end(), 1.0);
+#endif
+    for (std::size_t k = 0; k < batch.size; ++k)
+    {
+        const int idx = batch_idxs[k];
+        for (int i = 0; i < NDIM; ++i)
+        {
+            for (int j = 0; j < NDIM; ++j)
+            {
+                batch.FF[3 * i + j][k] = F_array[idx][NDIM * i + j];
+            }
+            batch.x[i][k] = x_array[idx][i];
+            batch.X[i][k] = X_array[idx][i];
+        }
+        batch.subdomain_ids[k] = batch_specs[k]->getSubdomainId();
+        batch.internal_vars[k] = &batch_specs[k]->getInternalVariables();
+    }
+
+    // Compute the stresses of all of the points with a single call.
+    if (batch.size > 0) (*d_PK1_stress_batch_fcn)(batch, data_time, d_PK1_stress_batch_fcn_ctx);
+
+    // Compute the Kirchhoff stresses tau = PP * FF^T.
+    for (std::size_t k = 0; k < batch.size; ++k)
+    {
+        const int idx = batch_idxs[k];
+        for (int i = 0; i < NDIM; ++i)
+        {
+            for (int j = 0; j < NDIM; ++j)
+            {
+                double tau_ij = 0.0;
+                for (int l = 0; l < 3; ++l)
+                {
+                    tau_ij += batch.PP[3 * i + l][k] * batch.FF[3 * j + l][k];
+                }
+                tau_array[idx][NDIM * i + j] = tau_ij;
+            }
+        }
+    }
+    return;
+} // computeBatchedStress
+
 void
 IMPMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
 {
@@ -50,6 +50,19 @@ namespace
 static Timer* t_solve_system;
 static Timer* t_initialize_solver_state;
 static Timer* t_deallocate_solver_state;
+
+// Return whether two PETSc vectors have the same parallel layout on all
+// processes of the specified communicator.
+inline bool
+have_same_layout(Vec x, Vec y, MPI_Comm comm)
+{
+    PetscInt x_local_size, y_local_size;
+    VecGetLocalSize(x, &x_local_size);
+    VecGetLocalSize(y, &y_local_size);
+    int same_layout = (x_local_size == y_local_size) ? 1 : 0;
+    MPI_Allreduce(MPI_IN_PLACE, &same_layout, 1, MPI_INT, MPI_MIN, comm);
+    return same_layout == 1;
+} // have_same_layout
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -196,6 +209,20 @@ KrylovFreeBodyMobilitySolver::initializeSolverState(Vec /*x*/, Vec b)
 {
     IBAMR_TIMER_START(t_initialize_solver_state);
 
+    Vec* vb;
+    VecNestGetSubVecs(b, nullptr, &vb);
+
+    // The KSP object and the work vectors only depend on the parallel layout
+    // of the vectors (the operator is applied via the CIBStrategy object using
+    // the current configuration of the structures), so they are kept when the
+    // solver is reinitialized with vectors that have the same layout.
+    if (d_is_initialized && have_same_layout(vb[2], d_petsc_b, d_petsc_comm) &&
+        have_same_layout(vb[1], d_petsc_temp_f, d_petsc_comm))
+    {
+        IBAMR_TIMER_STOP(t_initialize_solver_state);
+        return;
+    }
+
     // Deallocate the solver state if the solver is already initialized.
     if (d_is_initialized)
     {
@@ -205,8 +232,6 @@ KrylovFreeBodyMobilitySolver::initializeSolverState(Vec /*x*/, Vec b)
 
     // Generate RHS and temporary vectors for storing Lagrange multiplier
     // and rigid body velocity.
-    Vec* vb;
-    VecNestGetSubVecs(b, nullptr, &vb);
     VecDuplicate(vb[2], &d_petsc_b);
     VecDuplicate(vb[1], &d_petsc_temp_f);
     VecDuplicate(vb[1], &d_petsc_temp_v);
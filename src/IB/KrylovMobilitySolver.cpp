@@ -35,6 +35,7 @@
 #include "ibtk/ibtk_utilities.h"
 
 #include "ArrayData.h"
+#include "CartesianGridGeometry.h"
 #include "CellVariable.h"
 #include "CoarsenSchedule.h"
 #include "HierarchyCellDataOpsReal.h"
@@ -105,6 +106,19 @@ static const bool CONSISTENT_TYPE_2_BDRY = false;
 static Timer* t_solve_system;
 static Timer* t_initialize_solver_state;
 static Timer* t_deallocate_solver_state;
+
+// Return whether two PETSc vectors have the same parallel layout on all
+// processes of the specified communicator.
+inline bool
+have_same_layout(Vec x, Vec y, MPI_Comm comm)
+{
+    PetscInt x_local_size, y_local_size;
+    VecGetLocalSize(x, &x_local_size);
+    VecGetLocalSize(y, &y_local_size);
+    int same_layout = (x_local_size == y_local_size) ? 1 : 0;
+    MPI_Allreduce(MPI_IN_PLACE, &same_layout, 1, MPI_INT, MPI_MIN, comm);
+    return same_layout == 1;
+} // have_same_layout
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -456,21 +470,27 @@ KrylovMobilitySolver::initializeSolverState(Vec x, Vec b)
 {
     IBTK_TIMER_START(t_initialize_solver_state);
 
-    // Deallocate the solver state if the solver is already initialized.
-    if (d_is_initialized)
-    {
-        d_reinitializing_solver = true;
-        deallocateSolverState();
-    }
-
     // Get the Eulerian and Lagrangian components.
     Vec *vx, *vb;
     VecNestGetSubVecs(x, nullptr, &vx);
     VecNestGetSubVecs(b, nullptr, &vb);
     Pointer<SAMRAIVectorReal<NDIM, double> > vx0, vb0;
 
+    // Deallocate the solver state if the solver is already initialized.  The
+    // KSP object only depends on the parallel layout of the Lagrange
+    // multiplier vector, so it is kept when the solver is reinitialized with
+    // vectors that have the same layout.
+    if (d_is_initialized)
+    {
+        d_reinitializing_solver = true;
+        d_reuse_ksp = have_same_layout(vb[1], d_petsc_b, d_petsc_comm);
+        deallocateSolverState();
+        d_reuse_ksp = false;
+    }
+
     // Create the RHS Vec to be used in the KSP object.
-    VecDuplicate(vb[1], &d_petsc_b);
+    const bool initialize_ksp = !d_petsc_b;
+    if (initialize_ksp) VecDuplicate(vb[1], &d_petsc_b);
 
     // Create the temporary storage for spreading and Stokes solve operation.
     IBTK::PETScSAMRAIVectorReal::getSAMRAIVectorRead(vx[0], &vx0);
@@ -482,7 +502,7 @@ KrylovMobilitySolver::initializeSolverState(Vec x, Vec b)
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVectorRead(vx[0], &vx0);
 
     // Initialize PETSc KSP
-    initializeKSP();
+    if (initialize_ksp) initializeKSP();
 
     // Initialize LInv (Stokes solver) required in the mobility matrix.
     IBTK::PETScSAMRAIVectorReal::getSAMRAIVector(vx[0], &vx0);
@@ -545,12 +565,15 @@ KrylovMobilitySolver::deallocateSolverState()
         d_samrai_temp[i].setNull();
     }
 
-    VecDestroy(&d_petsc_b);
     d_petsc_x = nullptr;
-    d_petsc_b = nullptr;
+    if (!d_reuse_ksp)
+    {
+        VecDestroy(&d_petsc_b);
+        d_petsc_b = nullptr;
 
-    // Destroy the KSP solver.
-    destroyKSP();
+        // Destroy the KSP solver.
+        destroyKSP();
+    }
 
     // Deallocate the interpolation operators.
     d_hier_bdry_fill->deallocateOperatorState();
@@ -579,6 +602,15 @@ KrylovMobilitySolver::getFromInput(Pointer<Database> input_db)
     if (input_db->keyExists("normalize_pressure")) d_normalize_pressure = input_db->getBool("normalize_pressure");
     if (input_db->keyExists("normalize_velocity")) d_normalize_velocity = input_db->getBool("normalize_velocity");
     if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+    if (input_db->keyExists("mobility_operator_type"))
+        d_mobility_operator_type = input_db->getString("mobility_operator_type");
+    if (input_db->keyExists("f_periodic_correction"))
+        d_f_periodic_corr = input_db->getDouble("f_periodic_correction");
+    if (!(d_mobility_operator_type == "STOKES" || d_mobility_operator_type == "RPY"))
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput()\n"
+                                 << "  valid values for mobility_operator_type are: STOKES, RPY" << std::endl);
+    }
 } // getFromInput
 
 void
@@ -933,51 +965,70 @@ KrylovMobilitySolver::MatVecMult_KMInv(Mat A, Vec x, Vec y)
     static const double delta = solver->d_reg_mob_factor;
     const double half_time = 0.5 * (solver->d_new_time + solver->d_current_time);
 
-    // Use homogeneous BCs with Stokes solver in the preconditioner.
-    dynamic_cast<IBTK::LinearSolver*>(solver->d_LInv.getPointer())->setHomogeneousBc(true);
-
-    // Set y:= [J L^-1 S + \delta]x
-    // 1) Spread force.
-    solver->d_samrai_temp[0]->setToScalar(0.0);
-    solver->d_cib_strategy->setConstraintForce(x, half_time, gamma);
-    ib_method_ops->spreadForce(solver->d_samrai_temp[0]->getComponentDescriptorIndex(0),
-                               nullptr,
-                               std::vector<Pointer<RefineSchedule<NDIM> > >(),
-                               half_time);
-    if (solver->d_normalize_spread_force)
+    if (solver->d_mobility_operator_type == "RPY")
     {
-        solver->d_cib_strategy->subtractMeanConstraintForce(
-            x, solver->d_samrai_temp[0]->getComponentDescriptorIndex(0), gamma);
+        // Set y:= [M + \delta]x, in which M is the RPY mobility matrix, without
+        // forming M.
+        Pointer<PatchLevel<NDIM> > struct_level =
+            solver->d_hierarchy->getPatchLevel(solver->d_hierarchy->getFinestLevelNumber());
+        Pointer<CartesianGridGeometry<NDIM> > grid_geom = solver->d_hierarchy->getGridGeometry();
+        const double* const dx0 = grid_geom->getDx();
+        double dx[NDIM];
+        for (int d = 0; d < NDIM; ++d) dx[d] = dx0[d] / struct_level->getRatio()(d);
+        const double mu = solver->d_ins_integrator->getStokesSpecifications()->getMu();
+        solver->d_cib_strategy->applyMobilityOperator(
+            RPY, x, y, dx, mu, solver->d_f_periodic_corr, /*managing_rank*/ 0);
+        VecScale(y, gamma * beta);
+    }
+    else
+    {
+        // Use homogeneous BCs with Stokes solver in the preconditioner.
+        dynamic_cast<IBTK::LinearSolver*>(solver->d_LInv.getPointer())->setHomogeneousBc(true);
+
+        // Set y:= [J L^-1 S + \delta]x
+        // 1) Spread force.
+        solver->d_samrai_temp[0]->setToScalar(0.0);
+        solver->d_cib_strategy->setConstraintForce(x, half_time, gamma);
+        ib_method_ops->spreadForce(solver->d_samrai_temp[0]->getComponentDescriptorIndex(0),
+                                   nullptr,
+                                   std::vector<Pointer<RefineSchedule<NDIM> > >(),
+                                   half_time);
+        if (solver->d_normalize_spread_force)
+        {
+            solver->d_cib_strategy->subtractMeanConstraintForce(
+                x, solver->d_samrai_temp[0]->getComponentDescriptorIndex(0), gamma);
+        }
+        // 2) Solve Stokes system.
+        solver->d_LInv->solveSystem(*solver->d_samrai_temp[1], *solver->d_samrai_temp[0]);
+
+        // 3a) Fill velocity ghost cells.
+        int u_data_idx = solver->d_samrai_temp[1]->getComponentDescriptorIndex(0);
+        using InterpolationTransactionComponent =
+            IBTK::HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
+        std::vector<InterpolationTransactionComponent> transaction_comps;
+        InterpolationTransactionComponent u_component(u_data_idx,
+                                                      DATA_REFINE_TYPE,
+                                                      USE_CF_INTERPOLATION,
+                                                      DATA_COARSEN_TYPE,
+                                                      BDRY_EXTRAP_TYPE,
+                                                      CONSISTENT_TYPE_2_BDRY,
+                                                      solver->d_u_bc_coefs,
+                                                      solver->d_fill_pattern);
+        transaction_comps.push_back(u_component);
+        solver->d_hier_bdry_fill->resetTransactionComponents(transaction_comps);
+        static const bool homogeneous_bc = true;
+        solver->d_hier_bdry_fill->setHomogeneousBc(homogeneous_bc);
+        solver->d_hier_bdry_fill->fillData(half_time);
+        solver->d_hier_bdry_fill->resetTransactionComponents(solver->d_transaction_comps);
+
+        // 3b) Interpolate velocity
+        solver->d_cib_strategy->setInterpolatedVelocityVector(y, half_time);
+        ib_method_ops->interpolateVelocity(u_data_idx,
+                                           std::vector<Pointer<CoarsenSchedule<NDIM> > >(),
+                                           std::vector<Pointer<RefineSchedule<NDIM> > >(),
+                                           half_time);
+        solver->d_cib_strategy->getInterpolatedVelocity(y, half_time, beta);
     }
-    // 2) Solve Stokes system.
-    solver->d_LInv->solveSystem(*solver->d_samrai_temp[1], *solver->d_samrai_temp[0]);
-
-    // 3a) Fill velocity ghost cells.
-    int u_data_idx = solver->d_samrai_temp[1]->getComponentDescriptorIndex(0);
-    using InterpolationTransactionComponent = IBTK::HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
-    std::vector<InterpolationTransactionComponent> transaction_comps;
-    InterpolationTransactionComponent u_component(u_data_idx,
-                                                  DATA_REFINE_TYPE,
-                                                  USE_CF_INTERPOLATION,
-                                                  DATA_COARSEN_TYPE,
-                                                  BDRY_EXTRAP_TYPE,
-                                                  CONSISTENT_TYPE_2_BDRY,
-                                                  solver->d_u_bc_coefs,
-                                                  solver->d_fill_pattern);
-    transaction_comps.push_back(u_component);
-    solver->d_hier_bdry_fill->resetTransactionComponents(transaction_comps);
-    static const bool homogeneous_bc = true;
-    solver->d_hier_bdry_fill->setHomogeneousBc(homogeneous_bc);
-    solver->d_hier_bdry_fill->fillData(half_time);
-    solver->d_hier_bdry_fill->resetTransactionComponents(solver->d_transaction_comps);
-
-    // 3b) Interpolate velocity
-    solver->d_cib_strategy->setInterpolatedVelocityVector(y, half_time);
-    ib_method_ops->interpolateVelocity(u_data_idx,
-                                       std::vector<Pointer<CoarsenSchedule<NDIM> > >(),
-                                       std::vector<Pointer<RefineSchedule<NDIM> > >(),
-                                       half_time);
-    solver->d_cib_strategy->getInterpolatedVelocity(y, half_time, beta);
 
     // 4) Regularize mobility.
     if (!MathUtilities<double>::equalEps(delta, 0.0))
@@ -685,6 +685,72 @@ MobilityFunctions::constructRPYMobilityMatrix(const char* IBKernelName,
     return;
 } // constructRPYMobilityMatrix
 
+void
+MobilityFunctions::applyRPYMobilityOperator(const char* IBKernelName,
+                                            const double MU,
+                                            const double DX,
+                                            const double* X,
+                                            const int N,
+                                            const double PERIODIC_CORRECTION,
+                                            const double* F,
+                                            double* U)
+{
+    HRad = getHydroRadius(IBKernelName) * DX;
+    const double mu_tt = 1. / (6.0 * M_PI * MU * HRad);
+
+    // The self-mobility blocks are diagonal.
+    for (int k = 0; k < N * NDIM; ++k)
+    {
+        U[k] = (mu_tt - PERIODIC_CORRECTION) * F[k];
+    }
+
+    // Each pair of markers is visited once.  The pair blocks have the form
+    // A*I + B*r*r^T, which is symmetric, so that each block contributes to the
+    // velocities of both markers.
+    double r_vec[NDIM];
+    for (int row = 0; row < N; ++row)
+    {
+        for (int col = 0; col < row; ++col)
+        {
+            for (int d = 0; d < NDIM; ++d)
+            {
+                r_vec[d] = X[row * NDIM + d] - X[col * NDIM + d]; // r(i) - r(j)
+            }
+            const double rsq = get_sqnorm(r_vec);
+            const double r = std::sqrt(rsq);
+            double A, B;
+            if (r <= 2.0 * HRad)
+            {
+                A = mu_tt * (1 - 9.0 / 32.0 * r / HRad) - PERIODIC_CORRECTION;
+                B = mu_tt / rsq * 3.0 * r / 32. / HRad;
+            }
+            else
+            {
+                const double cube = HRad * HRad * HRad / r / r / r;
+                A = mu_tt * (3.0 / 4.0 * HRad / r + 1.0 / 2.0 * cube) - PERIODIC_CORRECTION;
+                B = mu_tt / rsq * (3.0 / 4.0 * HRad / r - 3.0 / 2.0 * cube);
+            }
+
+            const double* const F_row = F + row * NDIM;
+            const double* const F_col = F + col * NDIM;
+            double* const U_row = U + row * NDIM;
+            double* const U_col = U + col * NDIM;
+            double r_dot_F_row = 0.0, r_dot_F_col = 0.0;
+            for (int d = 0; d < NDIM; ++d)
+            {
+                r_dot_F_row += r_vec[d] * F_row[d];
+                r_dot_F_col += r_vec[d] * F_col[d];
+            }
+            for (int d = 0; d < NDIM; ++d)
+            {
+                U_row[d] += A * F_col[d] + B * r_vec[d] * r_dot_F_col;
+                U_col[d] += A * F_row[d] + B * r_vec[d] * r_dot_F_row;
+            }
+        }
+    }
+    return;
+} // applyRPYMobilityOperator
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
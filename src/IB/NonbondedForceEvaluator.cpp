@@ -33,6 +33,7 @@
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "tbox/Database.h"
+#include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
 
 #include "petscvec.h"
@@ -42,7 +43,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <string>
+#include <vector>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -107,39 +110,41 @@ NonbondedForceEvaluator::evaluateForces(int mstr_petsc_idx,
     //
     //////////////////////////////////////////////////////////////////////////////////
 
-    // get vectors of data
-    // How costly is this?  TODO: Check, maybe just do this once in the loop.
-    PetscScalar* position;
-    VecGetArray(X_data->getVec(), &position);
-    PetscScalar* force;
-    VecGetArray(F_data->getVec(), &force);
-
     // get domain bounds
     const double* x_lower = d_grid_geometry->getXLower();
     const double* x_upper = d_grid_geometry->getXUpper();
-
-    double R = 0.0; // distance between particles
-    double D[NDIM]; // vector connecting particles.
-
+    double periodic_shift[NDIM];
     for (int k = 0; k < NDIM; ++k)
     {
-        D[k] = (position[mstr_petsc_idx * NDIM + k] - position[search_petsc_idx * NDIM + k] -
-                cell_offset[k] * (x_upper[k] - x_lower[k]));
-        R += std::pow(D[k], 2);
+        periodic_shift[k] = cell_offset[k] * (x_upper[k] - x_lower[k]);
     }
-    R = std::sqrt(R);
 
-    double nonbdd_force[NDIM];
-    (d_force_fcn_ptr)(D, d_parameters, nonbdd_force);
-    for (int k = 0; k < NDIM; ++k)
-    {
-        force[mstr_petsc_idx * NDIM + k] += nonbdd_force[k];
-        force[search_petsc_idx * NDIM + k] += -1.0 * nonbdd_force[k];
-    }
+    PetscScalar* position;
+    VecGetArray(X_data->getVec(), &position);
+    PetscScalar* force;
+    VecGetArray(F_data->getVec(), &force);
+    evaluateForces(mstr_petsc_idx, search_petsc_idx, position, periodic_shift, force);
     VecRestoreArray(F_data->getVec(), &force);
+    VecRestoreArray(X_data->getVec(), &position);
     return;
 } // evaluateForces
 
+void
+NonbondedForceEvaluator::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                             const int level_number,
+                                             const double /*init_data_time*/,
+                                             const bool /*initial_time*/,
+                                             LDataManager* const /*l_data_manager*/)
+{
+    // The nodes have (potentially) been redistributed, so the neighbor list
+    // of this level must be rebuilt.
+    if (level_number < static_cast<int>(d_neighbor_list_is_valid.size()))
+    {
+        d_neighbor_list_is_valid[level_number] = false;
+    }
+    return;
+} // initializeLevelData
+
 void
 NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
                                                 Pointer<LData> X_data,
@@ -153,7 +158,94 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
     if (!grid_geom->getDomainIsSingleBox()) TBOX_ERROR("physical domain must be a single box...\n");
 
+    if (level_number >= static_cast<int>(d_neighbor_list_is_valid.size()))
+    {
+        d_neighbor_list_is_valid.resize(level_number + 1, false);
+        d_neighbor_pairs.resize(level_number + 1);
+        d_neighbor_periodic_shifts.resize(level_number + 1);
+        d_neighbor_list_positions.resize(level_number + 1);
+    }
+
+    // Keep the position and force arrays mapped for the whole sweep.
+    PetscScalar* position;
+    VecGetArray(X_data->getVec(), &position);
+    PetscScalar* force;
+    VecGetArray(F_data->getVec(), &force);
+    int n_local_positions;
+    VecGetLocalSize(X_data->getVec(), &n_local_positions);
+
+    // Determine whether the neighbor list must be rebuilt: this is the case
+    // after regridding or once some node has moved by more than the skin
+    // distance of regrid_alpha grid cells since the list was built.
+    bool rebuild_neighbor_list = !d_neighbor_list_is_valid[level_number];
+    const std::vector<double>& X_built = d_neighbor_list_positions[level_number];
+    if (!rebuild_neighbor_list && static_cast<int>(X_built.size()) != n_local_positions)
+    {
+        rebuild_neighbor_list = true;
+    }
+    if (!rebuild_neighbor_list)
+    {
+        const double* const dx_coarsest = grid_geom->getDx();
+        const IntVector<NDIM>& ratio = hierarchy->getPatchLevel(level_number)->getRatio();
+        double dx_min = std::numeric_limits<double>::max();
+        for (int d = 0; d < NDIM; ++d)
+        {
+            dx_min = std::min(dx_min, dx_coarsest[d] / static_cast<double>(ratio(d)));
+        }
+        const double skin_sq = std::pow(d_regrid_alpha * dx_min, 2);
+        for (int k = 0; k < n_local_positions / NDIM && !rebuild_neighbor_list; ++k)
+        {
+            double displacement_sq = 0.0;
+            for (int d = 0; d < NDIM; ++d)
+            {
+                displacement_sq += std::pow(position[k * NDIM + d] - X_built[k * NDIM + d], 2);
+            }
+            rebuild_neighbor_list = displacement_sq > skin_sq;
+        }
+    }
+    rebuild_neighbor_list = SAMRAI_MPI::maxReduction(rebuild_neighbor_list ? 1 : 0) == 1;
+    if (rebuild_neighbor_list)
+    {
+        buildNeighborList(hierarchy, level_number, position, n_local_positions, l_data_manager);
+    }
+
+    // Evaluate the forces between all pairs in the neighbor list.
+    const std::vector<int>& neighbor_pairs = d_neighbor_pairs[level_number];
+    const std::vector<double>& periodic_shifts = d_neighbor_periodic_shifts[level_number];
+    const std::size_t n_pairs = neighbor_pairs.size() / 2;
+    for (std::size_t k = 0; k < n_pairs; ++k)
+    {
+        evaluateForces(neighbor_pairs[2 * k], neighbor_pairs[2 * k + 1], position, &periodic_shifts[NDIM * k], force);
+    }
+    VecRestoreArray(F_data->getVec(), &force);
+    VecRestoreArray(X_data->getVec(), &position);
+    return;
+} // computeLagrangianForce
+
+void
+NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
+{
+    // set the nonbonded force function pointer to the given force function pointer
+    d_force_fcn_ptr = force_fcn_ptr;
+    return;
+} // registerForceFcnPtr
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+NonbondedForceEvaluator::buildNeighborList(const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                           const int level_number,
+                                           const double* const position,
+                                           const int n_local_positions,
+                                           LDataManager* const l_data_manager)
+{
+    std::vector<int>& neighbor_pairs = d_neighbor_pairs[level_number];
+    std::vector<double>& periodic_shifts = d_neighbor_periodic_shifts[level_number];
+    neighbor_pairs.clear();
+    periodic_shifts.clear();
+
     // These will only work if the domain is a single box.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
     assert(grid_geom->getDomainIsSingleBox());
     const double* const x_lower = grid_geom->getXLower();
     const double* const x_upper = grid_geom->getXUpper();
@@ -172,74 +264,82 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
         const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
         const double* const patch_dx = patch_geom->getDx();
 
-        std::vector<int> cell_offset(NDIM);
+        double periodic_shift[NDIM];
         // Loop through cells in this processors patch. For each iteration, this
-        // is the "master" cell. Iterate through particles in the box, and add
-        // springs.
+        // is the "master" cell. Iterate through particles in the box, and
+        // record the interacting pairs.
         for (LNodeSetData::CellIterator cit(patch_box); cit; cit++)
         {
             // get list of particles in this cell
             const hier::Index<NDIM>& first_cell_idx = *cit;
             LNodeSet* const mstr_node_set = current_idx_data->getItem(first_cell_idx);
-            if (mstr_node_set)
+            if (!mstr_node_set) continue;
+            Box<NDIM> search_box(first_cell_idx, first_cell_idx);
+            // loop over neighboring cells, up to interaction_radius +
+            // 2*regrid_alpha away.
+            for (LNodeSetData::CellIterator scit(Box<NDIM>::grow(search_box, grow_amount)); scit; scit++)
             {
-                Box<NDIM> search_box(first_cell_idx, first_cell_idx);
-                // loop over neighboring cells, up to interaction_radius +
-                // 2*regrid_alpha away.
-                for (LNodeSetData::CellIterator scit(Box<NDIM>::grow(search_box, grow_amount)); scit; scit++)
+                const hier::Index<NDIM>& search_cell_idx = *scit;
+                LNodeSet* search_node_set = current_idx_data->getItem(search_cell_idx);
+                if (!search_node_set) continue;
+
+                // search across periodic boundaries.
+                for (int k = 0; k < NDIM; ++k)
                 {
-                    // loop over particles in the neighbor cell, adding up
-                    // forces onto the particle in the "master" cell At this
-                    // point we know both cells, need to figure out periodic
-                    // additions.
-                    const hier::Index<NDIM>& search_cell_idx = *scit;
-
-                    // search across periodic boundaries.
-                    for (int k = 0; k < NDIM; ++k)
-                    {
-                        // Difference between lower boundary and this search cell.
-                        double absolute_diff = search_cell_idx[k] * patch_dx[k];
-                        // Periodic offset of this cell.
-                        cell_offset[k] = floor(absolute_diff / (x_upper[k] - x_lower[k]));
-                    }
-                    LNodeSet* search_node_set = current_idx_data->getItem(search_cell_idx);
-                    if (search_node_set)
+                    // Difference between lower boundary and this search cell.
+                    double absolute_diff = search_cell_idx[k] * patch_dx[k];
+                    // Periodic offset of this cell.
+                    periodic_shift[k] = floor(absolute_diff / (x_upper[k] - x_lower[k])) * (x_upper[k] - x_lower[k]);
+                }
+                for (const auto& mstr_node_idx : *mstr_node_set)
+                {
+                    // master nodes
+                    const int mstr_lag_idx = mstr_node_idx->getLagrangianIndex();
+                    const int mstr_petsc_idx = mstr_node_idx->getLocalPETScIndex();
+                    for (const auto& search_node_idx : *search_node_set)
                     {
-                        // we have a set of nodes in the first cell and the search cell,
-                        // add up forces
-                        // and accumulate for the first cell.
-                        for (const auto& mstr_node_idx : *mstr_node_set)
+                        const int search_lag_idx = search_node_idx->getLagrangianIndex();
+                        const int search_petsc_idx = search_node_idx->getLocalPETScIndex();
+                        if (mstr_lag_idx < search_lag_idx)
                         {
-                            // master nodes
-                            const int mstr_lag_idx = mstr_node_idx->getLagrangianIndex();
-                            const int mstr_petsc_idx = mstr_node_idx->getLocalPETScIndex();
-
-                            for (const auto& search_node_idx : *search_node_set)
-                            {
-                                const int search_lag_idx = search_node_idx->getLagrangianIndex();
-                                const int search_petsc_idx = search_node_idx->getLocalPETScIndex();
-                                if (mstr_lag_idx < search_lag_idx)
-                                {
-                                    // apply forces with the force evaluator
-                                    evaluateForces(mstr_petsc_idx, search_petsc_idx, X_data, cell_offset, F_data);
-                                }
-                            } // search node index
-                        }     // mstr node index
-                    }         // if(search node set)
-                }             // search cell loop
-            }                 // if mastr_node_idx
-        }                     // first cell
-    }                         // patches
+                            neighbor_pairs.push_back(mstr_petsc_idx);
+                            neighbor_pairs.push_back(search_petsc_idx);
+                            periodic_shifts.insert(periodic_shifts.end(), periodic_shift, periodic_shift + NDIM);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Record the positions for which the list was built.
+    d_neighbor_list_positions[level_number].assign(position, position + n_local_positions);
+    d_neighbor_list_is_valid[level_number] = true;
     return;
-} // computeLagrangianForce
+} // buildNeighborList
 
 void
-NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
+NonbondedForceEvaluator::evaluateForces(const int mstr_petsc_idx,
+                                        const int search_petsc_idx,
+                                        const double* const position,
+                                        const double* const periodic_shift,
+                                        double* const force)
 {
-    // set the nonbonded force function pointer to the given force function pointer
-    d_force_fcn_ptr = force_fcn_ptr;
+    double D[NDIM]; // vector connecting particles.
+    for (int k = 0; k < NDIM; ++k)
+    {
+        D[k] = position[mstr_petsc_idx * NDIM + k] - position[search_petsc_idx * NDIM + k] - periodic_shift[k];
+    }
+
+    double nonbdd_force[NDIM];
+    (d_force_fcn_ptr)(D, d_parameters, nonbdd_force);
+    for (int k = 0; k < NDIM; ++k)
+    {
+        force[mstr_petsc_idx * NDIM + k] += nonbdd_force[k];
+        force[search_petsc_idx * NDIM + k] += -1.0 * nonbdd_force[k];
+    }
     return;
-} // registerForceFcnPtr
+} // evaluateForces
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -73,6 +73,13 @@ namespace
 {
 // Version of PenaltyIBMethod restart file data.
 static const int PENALTY_IB_METHOD_VERSION = 1;
+
+// Evaluate sin(theta) / theta without loss of accuracy for small theta.
+inline double
+sinc(const double theta)
+{
+    return std::abs(theta) < 1.0e-4 ? 1.0 - theta * theta / 6.0 : std::sin(theta) / theta;
+} // sinc
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -158,6 +165,11 @@ void
 PenaltyIBMethod::forwardEulerStep(const double current_time, const double new_time)
 {
     IBMethod::forwardEulerStep(current_time, new_time);
+    if (d_mass_time_stepping_type != "EXPLICIT")
+    {
+        advancePenaltyMass(current_time, new_time, /*use_half_position*/ false);
+        return;
+    }
 
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
@@ -193,6 +205,11 @@ void
 PenaltyIBMethod::midpointStep(const double current_time, const double new_time)
 {
     IBMethod::midpointStep(current_time, new_time);
+    if (d_mass_time_stepping_type != "EXPLICIT")
+    {
+        advancePenaltyMass(current_time, new_time, /*use_half_position*/ true);
+        return;
+    }
 
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
@@ -233,6 +250,11 @@ void
 PenaltyIBMethod::trapezoidalStep(const double current_time, const double new_time)
 {
     IBMethod::trapezoidalStep(current_time, new_time);
+    if (d_mass_time_stepping_type != "EXPLICIT")
+    {
+        advancePenaltyMass(current_time, new_time, /*use_half_position*/ true);
+        return;
+    }
 
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
@@ -472,6 +494,76 @@ PenaltyIBMethod::putToDatabase(Pointer<Database> db)
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+PenaltyIBMethod::advancePenaltyMass(const double current_time, const double new_time, const bool use_half_position)
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    const double dt = new_time - current_time;
+    const bool use_exponential = d_mass_time_stepping_type == "EXPONENTIAL";
+
+    // Update the values of Y^{n+1} and V^{n+1} by integrating the penalty
+    // spring-mass system with the massless structure held fixed at X^{n} or
+    // X^{n+1/2}.  Each node is an independent harmonic oscillator, so that the
+    // update of each node is of the form
+    //
+    //    Y^{n+1} = Y^{n} + c_YY (Y^{n} - X) + c_YV V^{n} + c_Yg g
+    //    V^{n+1} =         c_VY (Y^{n} - X) + c_VV V^{n} + c_Vg g
+    //
+    // Both the exponential integrator (i.e., the exact solution) and the
+    // implicit midpoint rule are stable for any penalty stiffness.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        const double* const K = d_K_data[ln]->getLocalFormArray()->data();
+        const double* const M = d_M_data[ln]->getLocalFormArray()->data();
+        const double* const X = d_X_current_data[ln]->getLocalFormVecArray()->data();
+        const double* const X_new = use_half_position ? d_X_new_data[ln]->getLocalFormVecArray()->data() : nullptr;
+        const double* const Y = d_Y_current_data[ln]->getLocalFormVecArray()->data();
+        const double* const V = d_V_current_data[ln]->getLocalFormVecArray()->data();
+        double* const Y_new = d_Y_new_data[ln]->getLocalFormVecArray()->data();
+        double* const V_new = d_V_new_data[ln]->getLocalFormVecArray()->data();
+        const unsigned int n_local = d_X_current_data[ln]->getLocalNodeCount();
+        for (unsigned int i = 0; i < n_local; ++i)
+        {
+            const double omega_sq = K[i] / M[i];
+            double c_YY, c_YV, c_Yg, c_VY, c_VV, c_Vg;
+            if (use_exponential)
+            {
+                const double theta = std::sqrt(omega_sq) * dt;
+                const double sinc_theta = sinc(theta);
+                const double sinc_half_theta = sinc(0.5 * theta);
+                c_YY = -0.5 * theta * theta * sinc_half_theta * sinc_half_theta;
+                c_YV = dt * sinc_theta;
+                c_Yg = 0.5 * dt * dt * sinc_half_theta * sinc_half_theta;
+                c_VY = -omega_sq * dt * sinc_theta;
+                c_VV = std::cos(theta);
+                c_Vg = dt * sinc_theta;
+            }
+            else
+            {
+                const double a = 0.25 * omega_sq * dt * dt;
+                c_VY = -omega_sq * dt / (1.0 + a);
+                c_VV = (1.0 - a) / (1.0 + a);
+                c_Vg = dt / (1.0 + a);
+                c_YY = 0.5 * dt * c_VY;
+                c_YV = dt / (1.0 + a);
+                c_Yg = 0.5 * dt * c_Vg;
+            }
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                const double X_fixed =
+                    use_half_position ? 0.5 * (X[NDIM * i + d] + X_new[NDIM * i + d]) : X[NDIM * i + d];
+                const double dY = Y[NDIM * i + d] - X_fixed;
+                const double g = d_gravitational_acceleration[d];
+                Y_new[NDIM * i + d] = Y[NDIM * i + d] + c_YY * dY + c_YV * V[NDIM * i + d] + c_Yg * g;
+                V_new[NDIM * i + d] = c_VY * dY + c_VV * V[NDIM * i + d] + c_Vg * g;
+            }
+        }
+    }
+    return;
+} // advancePenaltyMass
+
 void
 PenaltyIBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
 {
@@ -488,6 +580,14 @@ PenaltyIBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
                                           "`gravitational_acceleration' not found in input.");
         }
     }
+    d_mass_time_stepping_type = db->getStringWithDefault("mass_time_stepping_type", d_mass_time_stepping_type);
+    if (d_mass_time_stepping_type != "EXPLICIT" && d_mass_time_stepping_type != "SEMI_IMPLICIT" &&
+        d_mass_time_stepping_type != "EXPONENTIAL")
+    {
+        TBOX_ERROR(d_object_name << ":  "
+                                 << "unsupported mass_time_stepping_type " << d_mass_time_stepping_type << "\n"
+                                 << "valid values are EXPLICIT, SEMI_IMPLICIT, and EXPONENTIAL." << std::endl);
+    }
     return;
 } // getFromInput
 
@@ -55,6 +55,7 @@
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -398,16 +399,6 @@ AdvDiffCUIConvectiveOperator::applyConvectiveOperator(const int Q_idx, const int
     }
 #endif
 
-    // Allocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_Q_scratch_idx);
-        level->allocatePatchData(d_q_extrap_idx);
-        if (d_difference_form == CONSERVATIVE || d_difference_form == SKEW_SYMMETRIC)
-            level->allocatePatchData(d_q_flux_idx);
-    }
-
     // Setup communications algorithm.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
     Pointer<RefineAlgorithm<NDIM> > refine_alg = new RefineAlgorithm<NDIM>();
@@ -729,16 +720,6 @@ AdvDiffCUIConvectiveOperator::applyConvectiveOperator(const int Q_idx, const int
         }
     }
 
-    // Deallocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_Q_scratch_idx);
-        level->deallocatePatchData(d_q_extrap_idx);
-        if (d_difference_form == CONSERVATIVE || d_difference_form == SKEW_SYMMETRIC)
-            level->deallocatePatchData(d_q_flux_idx);
-    }
-
     IBAMR_TIMER_STOP(t_apply_convective_operator);
     return;
 } // applyConvectiveOperator
@@ -792,6 +773,18 @@ AdvDiffCUIConvectiveOperator::initializeOperatorState(const SAMRAIVectorReal<NDI
         d_ghostfill_scheds[ln] = d_ghostfill_alg->createSchedule(level, ln - 1, d_hierarchy, d_ghostfill_strategy);
     }
 
+    // Allocate scratch data.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(d_Q_scratch_idx)) level->allocatePatchData(d_Q_scratch_idx);
+        if (!level->checkAllocated(d_q_extrap_idx)) level->allocatePatchData(d_q_extrap_idx);
+        if (d_difference_form == CONSERVATIVE || d_difference_form == SKEW_SYMMETRIC)
+        {
+            if (!level->checkAllocated(d_q_flux_idx)) level->allocatePatchData(d_q_flux_idx);
+        }
+    }
+
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_operator_state);
@@ -814,6 +807,15 @@ AdvDiffCUIConvectiveOperator::deallocateOperatorState()
     }
     d_ghostfill_scheds.clear();
 
+    // Deallocate scratch data.
+    for (int ln = d_coarsest_ln; ln <= std::min(d_finest_ln, d_hierarchy->getFinestLevelNumber()); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_Q_scratch_idx)) level->deallocatePatchData(d_Q_scratch_idx);
+        if (level->checkAllocated(d_q_extrap_idx)) level->deallocatePatchData(d_q_extrap_idx);
+        if (level->checkAllocated(d_q_flux_idx)) level->deallocatePatchData(d_q_flux_idx);
+    }
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
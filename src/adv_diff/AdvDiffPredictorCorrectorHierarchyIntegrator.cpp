@@ -22,6 +22,7 @@
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
 #include "ibtk/CartGridFunction.h"
+#include "ibtk/DiagnosticsCollector.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
@@ -132,6 +133,7 @@ AdvDiffPredictorCorrectorHierarchyIntegrator::AdvDiffPredictorCorrectorHierarchy
     {
         d_hyp_patch_ops_db = new NullDatabase();
     }
+    if (input_db->keyExists("enable_subcycling")) d_enable_subcycling = input_db->getBool("enable_subcycling");
 
     // Check to make sure the time stepping types are supported.
     switch (d_default_diffusion_time_stepping_type)
@@ -198,7 +200,8 @@ AdvDiffPredictorCorrectorHierarchyIntegrator::initializeHierarchyIntegrator(
                                                                  d_hyp_level_integrator_db,
                                                                  d_hyp_patch_ops,
                                                                  d_registered_for_restart,
-                                                                 /*using_time_refinement*/ false);
+                                                                 /*using_time_refinement*/ d_enable_subcycling);
+    d_hyp_patch_ops->setAdvanceInPlace(d_enable_subcycling);
 
     // Setup variable contexts.
     d_current_context = d_hyp_level_integrator->getCurrentContext();
@@ -307,6 +310,33 @@ AdvDiffPredictorCorrectorHierarchyIntegrator::integrateHierarchy(const double cu
         });
     }
 
+    // With subcycling, the transported quantities are advanced explicitly level
+    // by level and no linear solves are required.
+    if (d_enable_subcycling)
+    {
+        if (d_current_num_cycles != 1)
+        {
+            TBOX_ERROR(d_object_name << "::integrateHierarchy():\n"
+                                     << "  subcycling requires num_cycles = 1\n");
+        }
+        for (const auto& Q_var : d_Q_var)
+        {
+            if (isDiffusionCoefficientVariable(Q_var) || d_Q_diffusion_coef[Q_var] != 0.0 ||
+                d_Q_damping_coef[Q_var] != 0.0)
+            {
+                TBOX_ERROR(d_object_name << "::integrateHierarchy():\n"
+                                         << "  subcycling is not supported for quantities with nonzero "
+                                            "diffusion or damping coefficients\n"
+                                         << "  quantity: " << Q_var->getName() << "\n");
+            }
+        }
+        advanceLevelWithSubcycling(coarsest_ln, current_time, new_time, true, true);
+
+        // Execute any registered callbacks.
+        executeIntegrateHierarchyCallbackFcns(current_time, new_time, cycle_num);
+        return;
+    }
+
     // Reset time-dependent data when necessary.
     if (cycle_num > 0)
     {
@@ -629,9 +659,11 @@ AdvDiffPredictorCorrectorHierarchyIntegrator::postprocessIntegrateHierarchy(cons
     {
         const int u_new_idx = var_db->mapVariableAndContextToIndex(u_var, getNewContext());
         PatchFaceDataOpsReal<NDIM, double> patch_fc_ops;
+        double level_dt = dt;
         for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
         {
             Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            if (d_enable_subcycling && ln > 0) level_dt /= level->getRatioToCoarserLevel().max();
             for (PatchLevel<NDIM>::Iterator p(level); p; p++)
             {
                 Pointer<Patch<NDIM> > patch = level->getPatch(p());
@@ -642,13 +674,15 @@ AdvDiffPredictorCorrectorHierarchyIntegrator::postprocessIntegrateHierarchy(cons
                 Pointer<FaceData<NDIM, double> > u_fc_new_data = patch->getPatchData(u_new_idx);
                 double u_max = 0.0;
                 u_max = patch_fc_ops.maxNorm(u_fc_new_data, patch_box);
-                cfl_max = std::max(cfl_max, u_max * dt / dx_min);
+                cfl_max = std::max(cfl_max, u_max * level_dt / dx_min);
             }
         }
     }
-    cfl_max = SAMRAI_MPI::maxReduction(cfl_max);
-    if (d_enable_logging)
-        plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl_max << "\n";
+    getDiagnosticsCollector().addContribution(
+        d_object_name + "::CFL", cfl_max, DiagnosticsCollector::MAX, [this](const double cfl) {
+            if (d_enable_logging)
+                plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl << "\n";
+        });
 
     // Execute any registered callbacks.
     executePostprocessIntegrateHierarchyCallbackFcns(
@@ -663,10 +697,15 @@ AdvDiffPredictorCorrectorHierarchyIntegrator::getMaximumTimeStepSizeSpecialized(
 {
     double dt = HierarchyIntegrator::getMaximumTimeStepSizeSpecialized();
     const bool initial_time = MathUtilities<double>::equalEps(d_integrator_time, d_start_time);
+    // With subcycling, each level takes multiple time steps per time step of
+    // the next coarser level.
+    int num_level_steps = 1;
     for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        dt = std::min(dt, d_hyp_level_integrator->getLevelDt(level, d_integrator_time, initial_time));
+        if (d_enable_subcycling && ln > 0) num_level_steps *= level->getRatioToCoarserLevel().max();
+        dt = std::min(dt,
+                      num_level_steps * d_hyp_level_integrator->getLevelDt(level, d_integrator_time, initial_time));
     }
     return dt;
 } // getMaximumTimeStepSizeSpecialized
@@ -817,6 +856,81 @@ AdvDiffPredictorCorrectorHierarchyIntegrator::applyGradientDetectorSpecialized(
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+AdvDiffPredictorCorrectorHierarchyIntegrator::advanceLevelWithSubcycling(const int ln,
+                                                                        const double current_time,
+                                                                        const double new_time,
+                                                                        const bool first_step,
+                                                                        const bool last_step)
+{
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    const double dt = new_time - current_time;
+    const double half_time = current_time + 0.5 * dt;
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+
+    // Set the source terms on this level at the midpoint of the time step. In
+    // the absence of diffusion and damping, the source terms used by the
+    // explicit predictor are the forcing terms.
+    for (const auto& F_var : d_F_var)
+    {
+        Pointer<CartGridFunction> F_fcn = d_F_fcn[F_var];
+        if (F_fcn && F_fcn->isTimeDependent())
+        {
+            const int F_current_idx = var_db->mapVariableAndContextToIndex(F_var, getCurrentContext());
+            F_fcn->setDataOnPatchLevel(F_current_idx, F_var, level, half_time);
+        }
+    }
+    HierarchyCellDataOpsReal<NDIM, double> level_cc_data_ops(d_hierarchy, ln, ln);
+    for (const auto& Q_var : d_Q_var)
+    {
+        Pointer<CellVariable<NDIM, double> > F_var = d_Q_F_map[Q_var];
+        const int Q_rhs_current_idx = var_db->mapVariableAndContextToIndex(d_Q_Q_rhs_map[Q_var], getCurrentContext());
+        if (F_var)
+        {
+            const int F_current_idx = var_db->mapVariableAndContextToIndex(F_var, getCurrentContext());
+            level_cc_data_ops.copyData(Q_rhs_current_idx, F_current_idx, false);
+        }
+        else
+        {
+            level_cc_data_ops.setToScalar(Q_rhs_current_idx, 0.0, false);
+        }
+    }
+
+    // Advance this level. Ghost values along the coarse-fine interface are
+    // interpolated in time from the next coarser level, which has already been
+    // advanced to its new time.
+    d_hyp_level_integrator->advanceLevel(level, d_hierarchy, current_time, new_time, first_step, last_step);
+    if (ln == finest_ln) return;
+
+    // Advance the next finer level (and, recursively, all finer levels) to the
+    // new time of this level. The new data of the finer levels become their
+    // current data after each but the last step; the last new data are reset
+    // along with those of this level at the end of the time step.
+    Pointer<PatchLevel<NDIM> > finer_level = d_hierarchy->getPatchLevel(ln + 1);
+    const int num_steps = finer_level->getRatioToCoarserLevel().max();
+    for (int k = 0; k < num_steps; ++k)
+    {
+        const double step_current_time = current_time + static_cast<double>(k) * dt / num_steps;
+        const double step_new_time = (k + 1 == num_steps ? new_time : current_time + (k + 1.0) * dt / num_steps);
+        advanceLevelWithSubcycling(ln + 1, step_current_time, step_new_time, k == 0, k + 1 == num_steps);
+        if (k + 1 < num_steps)
+        {
+            for (int finer_ln = ln + 1; finer_ln <= finest_ln; ++finer_ln)
+            {
+                d_hyp_level_integrator->resetTimeDependentData(d_hierarchy->getPatchLevel(finer_ln),
+                                                               step_new_time,
+                                                               d_gridding_alg->levelCanBeRefined(finer_ln));
+            }
+        }
+    }
+
+    // Reflux this level with the time integrals of the fluxes of the finer
+    // level and replace the data in covered cells by the finer level data.
+    d_hyp_level_integrator->standardLevelSynchronization(d_hierarchy, ln, ln + 1, new_time, current_time);
+    return;
+} // advanceLevelWithSubcycling
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
@@ -177,13 +177,40 @@ AdvDiffPredictorCorrectorHyperbolicPatchOps::AdvDiffPredictorCorrectorHyperbolic
     return;
 } // AdvDiffPredictorCorrectorHyperbolicPatchOps
 
+void
+AdvDiffPredictorCorrectorHyperbolicPatchOps::setAdvanceInPlace(const bool advance_in_place)
+{
+    d_advance_in_place = advance_in_place;
+    return;
+} // setAdvanceInPlace
+
 void
 AdvDiffPredictorCorrectorHyperbolicPatchOps::conservativeDifferenceOnPatch(Patch<NDIM>& patch,
-                                                                           const double /*time*/,
+                                                                           const double time,
                                                                            const double dt,
-                                                                           bool /*at_synchronization*/)
+                                                                           bool at_synchronization)
 {
     const Box<NDIM>& patch_box = patch.getBox();
+    if (d_advance_in_place)
+    {
+        // Update the transported quantities and add the source terms, which are
+        // held fixed over the time step. The source terms are read from the
+        // current context because this routine is also called to reflux the
+        // coarser level during synchronization.
+        AdvectorPredictorCorrectorHyperbolicPatchOps::conservativeDifferenceOnPatch(
+            patch, time, dt, at_synchronization);
+        PatchCellDataOpsReal<NDIM, double> patch_cc_data_ops;
+        for (const auto& Q_var : d_Q_var)
+        {
+            Pointer<CellVariable<NDIM, double> > F_var = d_Q_F_map[Q_var];
+            if (!F_var) continue;
+            Pointer<CellData<NDIM, double> > Q_data = patch.getPatchData(Q_var, getDataContext());
+            Pointer<CellData<NDIM, double> > F_data = patch.getPatchData(F_var, d_integrator->getCurrentContext());
+            patch_cc_data_ops.axpy(Q_data, dt, F_data, Q_data, patch_box);
+        }
+        return;
+    }
+
     const hier::Index<NDIM>& ilower = patch_box.lower();
     const hier::Index<NDIM>& iupper = patch_box.upper();
 
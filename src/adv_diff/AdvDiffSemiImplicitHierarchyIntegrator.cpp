@@ -22,6 +22,7 @@
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
 #include "ibtk/CartGridFunction.h"
+#include "ibtk/DiagnosticsCollector.h"
 #include "ibtk/LaplaceOperator.h"
 #include "ibtk/PoissonSolver.h"
 
@@ -476,12 +477,8 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
     }
 
     // Allocate the scratch and new data.
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
-    }
+    allocatePatchData(d_scratch_data, current_time, coarsest_ln, finest_ln);
+    allocatePatchData(d_new_data, new_time, coarsest_ln, finest_ln);
 
     // Update the advection velocity.
     for (const auto& u_var : d_u_var)
@@ -686,6 +683,24 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
         });
     }
 
+    // Update the advection velocities.  Each advection velocity is updated only
+    // once per cycle, regardless of the number of transported quantities that
+    // it advects.
+    if (cycle_num > 0)
+    {
+        for (const auto& u_var : d_u_var)
+        {
+            const int u_current_idx = var_db->mapVariableAndContextToIndex(u_var, getCurrentContext());
+            const int u_scratch_idx = var_db->mapVariableAndContextToIndex(u_var, getScratchContext());
+            const int u_new_idx = var_db->mapVariableAndContextToIndex(u_var, getNewContext());
+            if (d_u_fcn[u_var])
+            {
+                d_u_fcn[u_var]->setDataOnPatchHierarchy(u_new_idx, u_var, d_hierarchy, new_time);
+            }
+            d_hier_fc_data_ops->linearSum(u_scratch_idx, 0.5, u_current_idx, 0.5, u_new_idx);
+        }
+    }
+
     // Perform a single step of fixed point iteration.
     unsigned int l = 0;
     for (auto cit = d_Q_var.begin(); cit != d_Q_var.end(); ++cit, ++l)
@@ -701,22 +716,6 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
         const int F_new_idx = d_F_fcn[F_var] ? var_db->mapVariableAndContextToIndex(F_var, getNewContext()) : -1;
         const int Q_rhs_scratch_idx = var_db->mapVariableAndContextToIndex(Q_rhs_var, getScratchContext());
 
-        // Update the advection velocity.
-        if (cycle_num > 0)
-        {
-            for (const auto& u_var : d_u_var)
-            {
-                const int u_current_idx = var_db->mapVariableAndContextToIndex(u_var, getCurrentContext());
-                const int u_scratch_idx = var_db->mapVariableAndContextToIndex(u_var, getScratchContext());
-                const int u_new_idx = var_db->mapVariableAndContextToIndex(u_var, getNewContext());
-                if (d_u_fcn[u_var])
-                {
-                    d_u_fcn[u_var]->setDataOnPatchHierarchy(u_new_idx, u_var, d_hierarchy, new_time);
-                }
-                d_hier_fc_data_ops->linearSum(u_scratch_idx, 0.5, u_current_idx, 0.5, u_new_idx);
-            }
-        }
-
         // Account for the convective difference term.
         Pointer<FaceVariable<NDIM, double> > u_var = d_Q_u_map[Q_var];
         Pointer<CellVariable<NDIM, double> > N_var = d_Q_N_map[Q_var];
@@ -891,9 +890,11 @@ AdvDiffSemiImplicitHierarchyIntegrator::postprocessIntegrateHierarchy(const doub
             }
         }
     }
-    cfl_max = SAMRAI_MPI::maxReduction(cfl_max);
-    if (d_enable_logging)
-        plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl_max << "\n";
+    getDiagnosticsCollector().addContribution(
+        d_object_name + "::CFL", cfl_max, DiagnosticsCollector::MAX, [this](const double cfl) {
+            if (d_enable_logging)
+                plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl << "\n";
+        });
 
     // Execute any registered callbacks.
     executePostprocessIntegrateHierarchyCallbackFcns(
@@ -55,6 +55,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <ostream>
 #include <string>
@@ -70,13 +71,41 @@ namespace IBAMR
 namespace
 {
 void
-genrandn(ArrayData<NDIM, double>& data, const Box<NDIM>& box)
+genrandn(ArrayData<NDIM, double>& data,
+         const Box<NDIM>& box,
+         const std::uint32_t* const key = nullptr,
+         const std::uint32_t stream = 0)
 {
+    if (!key)
+    {
+        for (int depth = 0; depth < data.getDepth(); ++depth)
+        {
+            for (Box<NDIM>::Iterator i(box); i; i++)
+            {
+                RNG::genrandn(&data(i(), depth));
+            }
+        }
+        return;
+    }
+
+    // Each row of values in the first coordinate direction is generated by
+    // one call to the counter-based generator.  The counter is determined by
+    // the (level-global) index of the first value in the row, so that the
+    // generated values do not depend on the partitioning of the level.
+    Box<NDIM> row_box = box;
+    row_box.upper(0) = row_box.lower(0);
+    const int row_length = box.numberCells(0);
     for (int depth = 0; depth < data.getDepth(); ++depth)
     {
-        for (Box<NDIM>::Iterator i(box); i; i++)
+        for (Box<NDIM>::Iterator i(row_box); i; i++)
         {
-            RNG::genrandn(&data(i(), depth));
+            const hier::Index<NDIM>& idx = i();
+            std::uint32_t counter[4] = { static_cast<std::uint32_t>(idx(0)),
+                                         static_cast<std::uint32_t>(idx(1)),
+                                         static_cast<std::uint32_t>(NDIM > 2 ? idx(NDIM - 1) : 0),
+                                         stream * static_cast<std::uint32_t>(data.getDepth()) +
+                                             static_cast<std::uint32_t>(depth) };
+            RNG::genrandn(&data(idx, depth), row_length, counter, key);
         }
     }
     return;
@@ -111,6 +140,10 @@ AdvDiffStochasticForcing::AdvDiffStochasticForcing(std::string object_name,
             d_dirichlet_bc_scaling = input_db->getDouble("dirichlet_bc_scaling");
         if (input_db->keyExists("neumann_bc_scaling")) d_neumann_bc_scaling = input_db->getDouble("neumann_bc_scaling");
         if (input_db->keyExists("f_expression")) f_expression = input_db->getString("f_expression");
+        if (input_db->keyExists("use_counter_based_rng"))
+            d_use_counter_based_rng = input_db->getBool("use_counter_based_rng");
+        if (input_db->keyExists("counter_based_rng_seed"))
+            d_counter_based_rng_seed = input_db->getInteger("counter_based_rng_seed");
     }
     d_f_parser.SetExpr(f_expression);
 
@@ -234,10 +267,17 @@ AdvDiffStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
         // Generate random components.
         if (cycle_num == 0)
         {
+            // If the counter-based generator is used, the generated values are
+            // determined by the time step number, the level number, the index
+            // of the set of random values, the data axis, and the level-global
+            // index of each value.
+            const std::uint32_t key[2] = { static_cast<std::uint32_t>(d_adv_diff_solver->getIntegratorStep()),
+                                           static_cast<std::uint32_t>(d_counter_based_rng_seed) };
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
                 {
+                    const auto stream = static_cast<std::uint32_t>((level_num * d_num_rand_vals + k) * NDIM);
                     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_num);
                     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
                     {
@@ -245,7 +285,10 @@ AdvDiffStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                         Pointer<SideData<NDIM, double> > F_sc_data = patch->getPatchData(d_F_sc_idxs[k]);
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            genrandn(F_sc_data->getArrayData(d), SideGeometry<NDIM>::toSideBox(F_sc_data->getBox(), d));
+                            genrandn(F_sc_data->getArrayData(d),
+                                     SideGeometry<NDIM>::toSideBox(F_sc_data->getBox(), d),
+                                     d_use_counter_based_rng ? key : nullptr,
+                                     stream + d);
                         }
                     }
                 }
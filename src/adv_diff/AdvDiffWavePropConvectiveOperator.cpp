@@ -16,6 +16,7 @@
 #include "ibamr/AdvDiffPhysicalBoundaryUtilities.h"
 #include "ibamr/AdvDiffWavePropConvectiveOperator.h"
 #include "ibamr/ConvectiveOperator.h"
+#include "ibamr/WavePropConvectiveFunctions.h"
 #include "ibamr/ibamr_enums.h"
 #include "ibamr/namespaces.h"
 
@@ -47,6 +48,7 @@
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
+#include <array>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -129,6 +131,8 @@ AdvDiffWavePropConvectiveOperator::AdvDiffWavePropConvectiveOperator(
     {
         if (input_db->keyExists("outflow_bdry_extrap_type"))
             d_outflow_bdry_extrap_type = input_db->getString("outflow_bdry_extrap_type");
+        if (input_db->keyExists("use_vectorized_kernel"))
+            d_use_vectorized_kernel = input_db->getBool("use_vectorized_kernel");
         if (input_db->keyExists("bdry_extrap_type"))
         {
             TBOX_ERROR("AdvDiffWavePropConvectiveOperator::AdvDiffWavePropConvectiveOperator():\n"
@@ -212,44 +216,59 @@ AdvDiffWavePropConvectiveOperator::applyConvectiveOperator(int Q_idx, int Y_idx)
             Pointer<FaceData<NDIM, double> > U_data = patch->getPatchData(d_u_idx);
             const IntVector<NDIM> U_data_gcw = U_data->getGhostCellWidth();
             const IntVector<NDIM> Y_data_gcw = Y_data->getGhostCellWidth();
+            if (d_use_vectorized_kernel)
+            {
+                std::array<const double*, NDIM> U_ptrs;
+                for (unsigned int d = 0; d < NDIM; ++d) U_ptrs[d] = U_data->getPointer(d);
+                WavePropConvectiveFunctions::computeWavePropConvectiveDerivative(Q_data_scr->getPointer(),
+                                                                                 Q_data_scr_gcw.max(),
+                                                                                 U_ptrs,
+                                                                                 U_data_gcw.max(),
+                                                                                 Y_data->getPointer(0),
+                                                                                 Y_data_gcw.max(),
+                                                                                 Q_data_scr->getDepth(),
+                                                                                 patch_box,
+                                                                                 dx);
+            }
+            else
+            {
 #if (NDIM == 2)
-            // COMPUTE CONVECTIVE OPERATOR HERE
-            adv_diff_wp_convective_op2d_(Q_data_scr->getPointer(),
-                                         Q_data_scr_gcw.max(),
-                                         U_data->getPointer(0),
-                                         U_data->getPointer(1),
-                                         U_data_gcw.max(),
-                                         Y_data->getPointer(0),
-                                         Y_data_gcw.max(),
-                                         Q_data_scr->getDepth(),
-                                         patch_lower(0),
-                                         patch_lower(1),
-                                         patch_upper(0),
-                                         patch_upper(1),
-                                         dx,
-                                         d_k);
-
+                // COMPUTE CONVECTIVE OPERATOR HERE
+                adv_diff_wp_convective_op2d_(Q_data_scr->getPointer(),
+                                             Q_data_scr_gcw.max(),
+                                             U_data->getPointer(0),
+                                             U_data->getPointer(1),
+                                             U_data_gcw.max(),
+                                             Y_data->getPointer(0),
+                                             Y_data_gcw.max(),
+                                             Q_data_scr->getDepth(),
+                                             patch_lower(0),
+                                             patch_lower(1),
+                                             patch_upper(0),
+                                             patch_upper(1),
+                                             dx,
+                                             d_k);
 #endif
 #if (NDIM == 3)
-            adv_diff_wp_convective_op3d_(Q_data_scr->getPointer(),
-                                         Q_data_scr_gcw.max(),
-                                         U_data->getPointer(0),
-                                         U_data->getPointer(1),
-                                         U_data->getPointer(2),
-                                         U_data_gcw.max(),
-                                         Y_data->getPointer(0),
-                                         Y_data_gcw.max(),
-                                         Q_data_scr->getDepth(),
-                                         patch_lower(0),
-                                         patch_lower(1),
-                                         patch_lower(2),
-                                         patch_upper(0),
-                                         patch_upper(1),
-                                         patch_upper(2),
-                                         dx,
-                                         d_k);
-
+                adv_diff_wp_convective_op3d_(Q_data_scr->getPointer(),
+                                             Q_data_scr_gcw.max(),
+                                             U_data->getPointer(0),
+                                             U_data->getPointer(1),
+                                             U_data->getPointer(2),
+                                             U_data_gcw.max(),
+                                             Y_data->getPointer(0),
+                                             Y_data_gcw.max(),
+                                             Q_data_scr->getDepth(),
+                                             patch_lower(0),
+                                             patch_lower(1),
+                                             patch_lower(2),
+                                             patch_upper(0),
+                                             patch_upper(1),
+                                             patch_upper(2),
+                                             dx,
+                                             d_k);
 #endif
+            }
         } // end Patch loop
     }     // end Level loop
 } // end applyConvectiveOperator
@@ -32,9 +32,14 @@
 #include "tbox/RestartManager.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <limits>
+#include <memory>
 #include <ostream>
 #include <string>
+#include <vector>
 
 // FORTRAN ROUTINES
 #if (NDIM == 2)
@@ -496,6 +501,135 @@ static const int FACEG = 1;
 // Version of AdvectorExplicitPredictorPatchOps restart file data
 // TODO: get rid of this ?
 static const int GODUNOV_ADVECTOR_VERSION = 1;
+
+// Tolerance below which the advection velocity is treated as zero when
+// upwinding (see sign_eps() in fortran/advect_predictors2d.f.m4).
+static const double UPWIND_EPS = 1.0e-8;
+
+// Branch-free versions of the helper functions of the Fortran predictors.
+inline double
+sign_eps(const double x)
+{
+    return static_cast<double>(x > UPWIND_EPS) - static_cast<double>(x < -UPWIND_EPS);
+} // sign_eps
+
+inline double
+minmod2(const double a, const double b)
+{
+    return std::max(std::min(a, b), 0.0) + std::min(std::max(a, b), 0.0);
+} // minmod2
+
+inline double
+minmod3(const double a, const double b, const double c)
+{
+    return std::max(std::min(std::min(a, b), c), 0.0) + std::min(std::max(std::max(a, b), c), 0.0);
+} // minmod3
+
+inline double
+maxmod2(const double a, const double b)
+{
+    const double lo = std::min(a, b), hi = std::max(a, b);
+    return (lo >= 0.0 ? hi : 0.0) + (hi <= 0.0 ? lo : 0.0);
+} // maxmod2
+
+inline double
+muscldiff(const double* const Q)
+{
+    const double dQ_m2 = Q[-1] - Q[-2], dQ_m1 = Q[0] - Q[-1], dQ_p1 = Q[1] - Q[0], dQ_p2 = Q[2] - Q[1];
+    const double dQf_left =
+        dQ_m1 * dQ_m2 > 0.0 ?
+            std::copysign(std::min(0.5 * std::abs(Q[0] - Q[-2]), 2.0 * std::min(std::abs(dQ_m1), std::abs(dQ_m2))),
+                          Q[0] - Q[-2]) :
+            0.0;
+    const double dQf_rght =
+        dQ_p2 * dQ_p1 > 0.0 ?
+            std::copysign(std::min(0.5 * std::abs(Q[2] - Q[0]), 2.0 * std::min(std::abs(dQ_p2), std::abs(dQ_p1))),
+                          Q[2] - Q[0]) :
+            0.0;
+    const double dQ_lim = 2.0 * std::min(std::abs(dQ_p1), std::abs(dQ_m1));
+    const double dQ = std::min((2.0 / 3.0) * std::abs(Q[1] - 0.25 * dQf_rght - Q[-1] - 0.25 * dQf_left), dQ_lim);
+    return dQ_p1 * dQ_m1 > 0.0 ? std::copysign(dQ, Q[1] - Q[-1]) : 0.0;
+} // muscldiff
+
+// Compute the limited slopes of the n values starting at Q, which must be
+// preceded and followed by the values required by the stencil of the limiter.
+// The switch is outside of the loops so that each loop is free of branches.
+void
+compute_slopes(double* const dQ, const double* const Q, const int n, const LimiterType limiter)
+{
+    switch (limiter)
+    {
+    case CTU_ONLY:
+        std::fill(dQ, dQ + n, 0.0);
+        break;
+    case MINMOD_LIMITED:
+        for (int k = 0; k < n; ++k) dQ[k] = minmod2(Q[k] - Q[k - 1], Q[k + 1] - Q[k]);
+        break;
+    case MC_LIMITED:
+        for (int k = 0; k < n; ++k)
+        {
+            dQ[k] = minmod3(0.5 * (Q[k + 1] - Q[k - 1]), 2.0 * (Q[k] - Q[k - 1]), 2.0 * (Q[k + 1] - Q[k]));
+        }
+        break;
+    case SUPERBEE_LIMITED:
+        for (int k = 0; k < n; ++k)
+        {
+            dQ[k] = maxmod2(minmod2(2.0 * (Q[k] - Q[k - 1]), Q[k + 1] - Q[k]),
+                            minmod2(Q[k] - Q[k - 1], 2.0 * (Q[k + 1] - Q[k])));
+        }
+        break;
+    case MUSCL_LIMITED:
+        for (int k = 0; k < n; ++k) dQ[k] = muscldiff(Q + k);
+        break;
+    case SECOND_ORDER:
+        for (int k = 0; k < n; ++k) dQ[k] = 0.5 * (Q[k + 1] - Q[k - 1]);
+        break;
+    case FOURTH_ORDER:
+        for (int k = 0; k < n; ++k)
+        {
+            dQ[k] = (2.0 / 3.0) * (Q[k + 1] - Q[k - 1]) - (1.0 / 12.0) * (Q[k + 2] - Q[k - 2]);
+        }
+        break;
+    default:
+        TBOX_ERROR("AdvectorExplicitPredictorPatchOps::predictVectorized():\n"
+                   << "  Limiter corresponding to limiter type = " << limiter << " not supported");
+        break;
+    }
+    return;
+} // compute_slopes
+
+// The layout of the values of the ArrayData object of cell-centered data or of
+// one component of face-centered data. Face-centered values are indexed by the
+// cells whose lower faces they are located on, and their (rotated) indices are
+// computed accordingly.
+struct DataLayout
+{
+    DataLayout() = default;
+
+    DataLayout(const ArrayData<NDIM, double>& data, const unsigned int face_axis = 0)
+    {
+        const Box<NDIM>& box = data.getBox();
+        int stride = 1;
+        for (unsigned int k = 0; k < NDIM; ++k)
+        {
+            const unsigned int d = (face_axis + k) % NDIM;
+            lower[d] = box.lower(k);
+            strides[d] = stride;
+            stride *= box.numberCells(k);
+        }
+        depth_stride = stride;
+    }
+
+    int offset(const hier::Index<NDIM>& i) const
+    {
+        int idx = 0;
+        for (unsigned int d = 0; d < NDIM; ++d) idx += (i(d) - lower[d]) * strides[d];
+        return idx;
+    }
+
+    std::array<int, NDIM> lower, strides;
+    int depth_stride = 0;
+};
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -919,6 +1053,7 @@ AdvectorExplicitPredictorPatchOps::putToDatabase(Pointer<Database> db)
 #if (NDIM == 3)
     db->putBool("d_using_full_ctu", d_using_full_ctu);
 #endif
+    db->putBool("d_use_vectorized_predictor", d_use_vectorized_predictor);
     return;
 } // putToDatabase
 
@@ -940,6 +1075,12 @@ AdvectorExplicitPredictorPatchOps::predict(FaceData<NDIM, double>& q_half,
 
     TBOX_ASSERT(Q.getBox() == patch.getBox());
 #endif
+    if (d_use_vectorized_predictor && d_limiter_type != PPM && d_limiter_type != XSPPM7)
+    {
+        predictVectorized(q_half, u_ADV, Q, nullptr, patch, dt);
+        return;
+    }
+
     const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch.getPatchGeometry();
     const double* const dx = patch_geom->getDx();
 
@@ -1122,6 +1263,12 @@ AdvectorExplicitPredictorPatchOps::predictWithSourceTerm(FaceData<NDIM, double>&
 
     TBOX_ASSERT(F.getBox() == patch.getBox());
 #endif
+    if (d_use_vectorized_predictor && d_limiter_type != PPM && d_limiter_type != XSPPM7)
+    {
+        predictVectorized(q_half, u_ADV, Q, &F, patch, dt);
+        return;
+    }
+
     const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch.getPatchGeometry();
     const double* const dx = patch_geom->getDx();
 
@@ -1307,6 +1454,198 @@ AdvectorExplicitPredictorPatchOps::predictWithSourceTerm(FaceData<NDIM, double>&
     return;
 } // predictWithSourceTerm
 
+void
+AdvectorExplicitPredictorPatchOps::predictVectorized(FaceData<NDIM, double>& q_half,
+                                                     const FaceData<NDIM, double>& u_ADV,
+                                                     const CellData<NDIM, double>& Q,
+                                                     const CellData<NDIM, double>* const F,
+                                                     const Patch<NDIM>& patch,
+                                                     const double dt) const
+{
+    const Box<NDIM>& patch_box = patch.getBox();
+    const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch.getPatchGeometry();
+    const double* const dx = patch_geom->getDx();
+    const int depth = Q.getDepth();
+    const int stencil_width = (d_limiter_type == FOURTH_ORDER || d_limiter_type == MUSCL_LIMITED) ? 2 : 1;
+#if (NDIM == 3)
+    const bool using_full_ctu = d_using_full_ctu;
+#endif
+
+    const DataLayout Q_layout(Q.getArrayData());
+    const double* const Q_data = Q.getPointer();
+    std::unique_ptr<DataLayout> F_layout;
+    if (F) F_layout.reset(new DataLayout(F->getArrayData()));
+
+    // Each line of cells in the direction of the face normal is processed at
+    // once. The coefficients that depend on the advection velocity are
+    // computed once per line and are shared by all components of Q. The values
+    // of each component along the line are copied into a contiguous buffer so
+    // that the loops over the line are vectorizable.
+    const int max_n_cells = patch_box.numberCells().max() + 2;
+    std::vector<double> Q_line(max_n_cells + 2 * stencil_width), Q_base(max_n_cells), dQ(max_n_cells);
+    std::vector<double> c_L(max_n_cells), c_R(max_n_cells), upwind(max_n_cells), diff(max_n_cells);
+
+    // Compute temporary predicted values on the cell faces, including those
+    // that are one cell outside of the patch in the transverse directions.
+    // Normal derivatives are approximated by limited differences and
+    // transverse derivatives are not included.
+    FaceData<NDIM, double> q_temp(patch_box, depth, IntVector<NDIM>(1));
+    std::array<DataLayout, NDIM> u_layout, q_temp_layout;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        u_layout[axis] = DataLayout(u_ADV.getArrayData(axis), axis);
+        q_temp_layout[axis] = DataLayout(q_temp.getArrayData(axis), axis);
+    }
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        const int n_cells = patch_box.numberCells(axis) + 2;
+        const int n_faces = n_cells - 1;
+        const double dt_over_dx = dt / dx[axis];
+        const int Q_stride = Q_layout.strides[axis];
+        const int F_stride = F ? F_layout->strides[axis] : 0;
+        const double* const u_data = u_ADV.getPointer(axis);
+        double* const q_temp_data = q_temp.getPointer(axis);
+        Box<NDIM> line_starts = Box<NDIM>::grow(patch_box, IntVector<NDIM>(1));
+        line_starts.upper(axis) = line_starts.lower(axis);
+        for (Box<NDIM>::Iterator b(line_starts); b; b++)
+        {
+            const hier::Index<NDIM>& i = b();
+            const double* const u = u_data + u_layout[axis].offset(i);
+            for (int k = 0; k < n_cells; ++k)
+            {
+                const double u_norm = 0.5 * (u[k] + u[k + 1]);
+                c_L[k] = 0.5 * (1.0 - u_norm * dt_over_dx);
+                c_R[k] = -0.5 * (1.0 + u_norm * dt_over_dx);
+            }
+            for (int k = 0; k < n_faces; ++k) upwind[k] = 0.5 * sign_eps(u[k + 1]);
+            for (int d = 0; d < depth; ++d)
+            {
+                const double* const Q_ptr = Q_data + d * Q_layout.depth_stride + Q_layout.offset(i);
+                for (int k = -stencil_width; k < n_cells + stencil_width; ++k)
+                {
+                    Q_line[k + stencil_width] = Q_ptr[k * Q_stride];
+                }
+                const double* const Q_cell = Q_line.data() + stencil_width;
+                compute_slopes(dQ.data(), Q_cell, n_cells, d_limiter_type);
+                if (F)
+                {
+                    const double* const F_ptr = F->getPointer(d) + F_layout->offset(i);
+                    for (int k = 0; k < n_cells; ++k) Q_base[k] = Q_cell[k] + 0.5 * dt * F_ptr[k * F_stride];
+                }
+                else
+                {
+                    std::copy(Q_cell, Q_cell + n_cells, Q_base.begin());
+                }
+                double* const q = q_temp_data + d * q_temp_layout[axis].depth_stride + q_temp_layout[axis].offset(i);
+                for (int k = 0; k < n_faces; ++k)
+                {
+                    const double q_L = Q_base[k] + c_L[k] * dQ[k];
+                    const double q_R = Q_base[k + 1] + c_R[k + 1] * dQ[k + 1];
+                    q[k + 1] = 0.5 * (q_L + q_R) + upwind[k] * (q_L - q_R);
+                }
+            }
+        }
+    }
+
+    // Compute the transverse flux differences vtan*(q_temp(upper) -
+    // q_temp(lower)) of each direction in the cells of the patch and in the
+    // cells that are one cell outside of the patch in the other directions,
+    // along with the cell-averaged transverse velocities.
+    std::array<std::unique_ptr<CellData<NDIM, double> >, NDIM> T, V;
+    std::array<DataLayout, NDIM> T_layout, V_layout;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        T[axis].reset(new CellData<NDIM, double>(patch_box, depth, IntVector<NDIM>(1)));
+        V[axis].reset(new CellData<NDIM, double>(patch_box, 1, IntVector<NDIM>(1)));
+        T_layout[axis] = DataLayout(T[axis]->getArrayData());
+        V_layout[axis] = DataLayout(V[axis]->getArrayData());
+        const int n_cells = patch_box.numberCells(axis);
+        const int T_stride = T_layout[axis].strides[axis];
+        const double* const u_data = u_ADV.getPointer(axis);
+        const double* const q_temp_data = q_temp.getPointer(axis);
+        Box<NDIM> line_starts = Box<NDIM>::grow(patch_box, IntVector<NDIM>(1));
+        line_starts.lower(axis) = patch_box.lower(axis);
+        line_starts.upper(axis) = patch_box.lower(axis);
+        for (Box<NDIM>::Iterator b(line_starts); b; b++)
+        {
+            const hier::Index<NDIM>& i = b();
+            const double* const u = u_data + u_layout[axis].offset(i);
+            double* const v = V[axis]->getPointer() + V_layout[axis].offset(i);
+            for (int k = 0; k < n_cells; ++k) v[k * T_stride] = 0.5 * (u[k] + u[k + 1]);
+            for (int d = 0; d < depth; ++d)
+            {
+                const double* const q =
+                    q_temp_data + d * q_temp_layout[axis].depth_stride + q_temp_layout[axis].offset(i);
+                double* const t = T[axis]->getPointer(d) + T_layout[axis].offset(i);
+                for (int k = 0; k < n_cells; ++k) t[k * T_stride] = v[k * T_stride] * (q[k + 1] - q[k]);
+            }
+        }
+    }
+
+    // Compute the final predicted values on the cell faces by adding the
+    // transverse derivatives (and, in 3D, optionally the full corner transport
+    // upwinding terms) to the temporary predicted values.
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        const int n_cells = patch_box.numberCells(axis) + 2;
+        const int n_faces = n_cells - 1;
+        const DataLayout q_half_layout(q_half.getArrayData(axis), axis);
+        const double* const u_data = u_ADV.getPointer(axis);
+        Box<NDIM> line_starts = patch_box;
+        line_starts.lower(axis) = patch_box.lower(axis) - 1;
+        line_starts.upper(axis) = patch_box.lower(axis) - 1;
+        for (Box<NDIM>::Iterator b(line_starts); b; b++)
+        {
+            const hier::Index<NDIM>& i = b();
+            const double* const u = u_data + u_layout[axis].offset(i);
+            for (int k = 0; k < n_faces; ++k) upwind[k] = 0.5 * sign_eps(u[k + 1]);
+            for (int d = 0; d < depth; ++d)
+            {
+                std::fill(diff.begin(), diff.begin() + n_cells, 0.0);
+                for (unsigned int axis_t = 0; axis_t < NDIM; ++axis_t)
+                {
+                    if (axis_t == axis) continue;
+                    const double* const t = T[axis_t]->getPointer(d) + T_layout[axis_t].offset(i);
+                    const int t_stride = T_layout[axis_t].strides[axis];
+                    const double coef = -0.5 * dt / dx[axis_t];
+                    for (int k = 0; k < n_cells; ++k) diff[k] += coef * t[k * t_stride];
+                }
+#if (NDIM == 3)
+                if (using_full_ctu)
+                {
+                    const unsigned int axis_1 = (axis + 1) % NDIM, axis_2 = (axis + 2) % NDIM;
+                    const double coef = dt * dt / (6.0 * dx[axis_1] * dx[axis_2]);
+                    const double* const t_1 = T[axis_1]->getPointer(d) + T_layout[axis_1].offset(i);
+                    const double* const t_2 = T[axis_2]->getPointer(d) + T_layout[axis_2].offset(i);
+                    const double* const v_1 = V[axis_1]->getPointer() + V_layout[axis_1].offset(i);
+                    const double* const v_2 = V[axis_2]->getPointer() + V_layout[axis_2].offset(i);
+                    const int stride = T_layout[axis_1].strides[axis];
+                    const int stride_1 = T_layout[axis_1].strides[axis_1];
+                    const int stride_2 = T_layout[axis_1].strides[axis_2];
+                    for (int k = 0; k < n_cells; ++k)
+                    {
+                        const int idx = k * stride;
+                        const double v_1_k = v_1[idx], v_2_k = v_2[idx];
+                        const double v_1_D_1_t_2 =
+                            v_1_k * (v_1_k > 0.0 ? t_2[idx] - t_2[idx - stride_1] : t_2[idx + stride_1] - t_2[idx]);
+                        const double v_2_D_2_t_1 =
+                            v_2_k * (v_2_k > 0.0 ? t_1[idx] - t_1[idx - stride_2] : t_1[idx + stride_2] - t_1[idx]);
+                        diff[k] += coef * (v_2_D_2_t_1 + v_1_D_1_t_2);
+                    }
+                }
+#endif
+                const double* const q_t = q_temp.getPointer(axis, d) + q_temp_layout[axis].offset(i);
+                double* const q = q_half.getPointer(axis, d) + q_half_layout.offset(i);
+                for (int k = 0; k < n_faces; ++k)
+                {
+                    q[k + 1] = q_t[k + 1] + 0.5 * (diff[k] + diff[k + 1]) + upwind[k] * (diff[k] - diff[k + 1]);
+                }
+            }
+        }
+    }
+    return;
+} // predictVectorized
+
 void
 AdvectorExplicitPredictorPatchOps::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
 {
@@ -1321,6 +1660,7 @@ AdvectorExplicitPredictorPatchOps::getFromInput(Pointer<Database> db, bool /*is_
 #if (NDIM == 3)
     if (db->keyExists("using_full_ctu")) d_using_full_ctu = db->getBool("using_full_ctu");
 #endif
+    if (db->keyExists("use_vectorized_predictor")) d_use_vectorized_predictor = db->getBool("use_vectorized_predictor");
     return;
 } // getFromInput
 
@@ -1353,6 +1693,8 @@ AdvectorExplicitPredictorPatchOps::getFromRestart()
 #if (NDIM == 3)
     d_using_full_ctu = db->getBool("d_using_full_ctu");
 #endif
+    if (db->keyExists("d_use_vectorized_predictor"))
+        d_use_vectorized_predictor = db->getBool("d_use_vectorized_predictor");
     return;
 } // getFromRestart
 
@@ -52,7 +52,6 @@ IBTK_DISABLE_EXTRA_WARNINGS
 #include <Eigen/Cholesky>
 #include <Eigen/Core>
 #include <Eigen/Eigenvalues>
-#include <unsupported/Eigen/MatrixFunctions>
 IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <algorithm>
@@ -821,7 +820,7 @@ CFINSForcing::exponentiateMatrix(const int data_idx,
                     const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
                     tens(idx.first, idx.second) = tens(idx.second, idx.first) = (*data)(i, k);
                 }
-                tens = tens.exp();
+                tens = CFRelaxationOperator::exponentiateSymmetricMatrix(tens);
                 for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
                 {
                     const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
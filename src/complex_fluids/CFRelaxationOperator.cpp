@@ -20,7 +20,7 @@
 #include "tbox/Utilities.h"
 
 IBTK_DISABLE_EXTRA_WARNINGS
-#include <unsupported/Eigen/MatrixFunctions>
+#include <Eigen/Eigenvalues>
 IBTK_ENABLE_EXTRA_WARNINGS
 
 // Namespace
@@ -52,6 +52,15 @@ CFRelaxationOperator::isTimeDependent() const
     return true;
 } // isTimeDependent
 
+MatrixNd
+CFRelaxationOperator::exponentiateSymmetricMatrix(const MatrixNd& mat)
+{
+    Eigen::SelfAdjointEigenSolver<MatrixNd> eigs;
+    eigs.computeDirect(mat);
+    const MatrixNd& eig_vecs = eigs.eigenvectors();
+    return eig_vecs * eigs.eigenvalues().array().exp().matrix().asDiagonal() * eig_vecs.transpose();
+} // exponentiateSymmetricMatrix
+
 MatrixNd
 CFRelaxationOperator::convertToConformation(const MatrixNd& mat)
 {
@@ -60,7 +69,7 @@ CFRelaxationOperator::convertToConformation(const MatrixNd& mat)
     case SQUARE_ROOT:
         return mat * mat;
     case LOGARITHM:
-        return mat.exp();
+        return exponentiateSymmetricMatrix(mat);
     case STANDARD:
         return mat;
     case UNKNOWN_TENSOR_EVOLUTION_TYPE:
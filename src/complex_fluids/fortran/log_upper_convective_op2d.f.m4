@@ -72,8 +72,6 @@ c
       REAL vals(2)
       REAL convec_vals(2,2)
       REAL sigma(0:2)
-      REAL temp(5)
-      INTEGER info
 
       scale_vx = 1.d0/(4.d0*dx(0))
       scale_vy = 1.d0/dx(1)
@@ -96,13 +94,7 @@ c
         L(1,1) = du_dx; L(1,2) = du_dy
         L(2,1) = dv_dx; L(2,2) = dv_dy
 
-        vecs(1,1) = q00; vecs(1,2) = q01
-        vecs(2,1) = q01; vecs(2,2) = q11
-
-        call dsyev('V','U',2,vecs,2,vals,temp,5,info)
-        if (info /= 0) then
-          print *, "\nERROR IN DSYEV!!\n\n"
-        endif
+        call sym_eig_2d(q00,q01,q11,vals,vecs)
 
         call log_sum(L,vecs,vals,2,convec_vals)
 
@@ -143,6 +135,7 @@ c
       REAL to_ret(d,d)
 
       REAL exp_vals(d)
+      REAL Lt(d,d)
       INTEGER i, j, k, kk, ii, jj
 
       do i=1,d
@@ -152,33 +145,36 @@ c
         exp_vals(i) = exp(vals(i))
       enddo
 
+c
+c     The projections of L onto the eigenvectors do not depend on the
+c     entry of to_ret that is being accumulated, so they are computed
+c     once.
+c
+      do i=1,d
+        do j=1,d
+          Lt(i,j) = 0.d0
+          do ii=1,d
+            do jj=1,d
+              Lt(i,j) = Lt(i,j) + vecs(jj,i)*L(jj,ii)*vecs(ii,j)
+            enddo
+          enddo
+        enddo
+      enddo
+
       do k=1,d
         do kk=1,d
           do i=1,d
-            Lij = 0
-            do ii=1,d
-              do jj=1,d
-                Lij = Lij + vecs(jj,i)*L(jj,ii)*vecs(ii,i)
-              enddo
-            enddo
             to_ret(k,kk) = to_ret(k,kk) +
-     &        2.d0*Lij*vecs(k,i)*vecs(kk,i)
+     &        2.d0*Lt(i,i)*vecs(k,i)*vecs(kk,i)
           enddo
         enddo
       enddo
-
       do k=1,d
         do kk=1,d
           do i=1,d; do j=1,d
             if (i /= j) then
-              Lij = 0
-              Lji = 0
-              do ii=1,d
-                do jj=1,d
-                  Lij = Lij + vecs(jj,i)*L(jj,ii)*vecs(ii,j)
-                  Lji = Lji + vecs(jj,j)*L(jj,ii)*vecs(ii,i)
-                enddo
-              enddo
+              Lij = Lt(i,j)
+              Lji = Lt(j,i)
               if(abs(exp_vals(i)-exp_vals(j))<1d-12) then
                   to_ret(k,kk) = to_ret(k,kk) +
      &              (Lji+Lij)*vecs(k,i)*vecs(kk,j)
@@ -193,3 +189,30 @@ c
         enddo
       enddo
       endsubroutine
+
+      subroutine sym_eig_2d(a00,a01,a11,vals,vecs)
+c
+c     Computes the eigenvalues and eigenvectors of the symmetric 2x2
+c     matrix [a00 a01; a01 a11] by a single Jacobi rotation.  The
+c     eigenvectors are stored in the columns of vecs.
+c
+      implicit none
+      REAL a00, a01, a11
+      REAL vals(2), vecs(2,2)
+      REAL theta, t, c, s
+
+      if (a01 .eq. 0.d0) then
+        t = 0.d0
+      else
+        theta = 0.5d0*(a11-a00)/a01
+        t = sign(1.d0,theta)/(abs(theta)+sqrt(theta*theta+1.d0))
+      endif
+      c = 1.d0/sqrt(t*t+1.d0)
+      s = t*c
+      vals(1) = a00 - t*a01
+      vals(2) = a11 + t*a01
+      vecs(1,1) = c
+      vecs(2,1) = -s
+      vecs(1,2) = s
+      vecs(2,2) = c
+      end subroutine
@@ -80,9 +80,6 @@ c
       REAL vals(3)
       REAL convec_vals(3,3)
       REAL sigma(0:5)
-      REAL temp(15)
-
-      INTEGER info
 
       scale_ux = 1.d0/dx(0)
       scale_uy = 1.d0/(4.d0*dx(1))
@@ -137,10 +134,7 @@ c
             vecs(2,1) = qxy; vecs(2,2) = qyy; vecs(2,3) = qyz
             vecs(3,1) = qxz; vecs(3,2) = qyz; vecs(3,3) = qzz
 
-            call dsyev('V','U',3,vecs,3,vals,temp,15,info)
-            if (info /= 0) then
-              print *, "ERROR IN DSYEV!!"
-            endif
+            call sym_eig_3d(vecs,vals)
             call log_sum(L,vecs,vals,3,convec_vals)
 
             sigma(0) = vecs(1,1)**2*exp(-vals(1))
@@ -219,6 +213,7 @@ c
       REAL Lij, Lji
 
       REAL exp_vals(d)
+      REAL Lt(d,d)
       INTEGER i, j, k, kk, ii, jj
 
       do i=1,d
@@ -228,17 +223,27 @@ c
         exp_vals(i) = exp(vals(i))
       enddo
 
+c
+c     The projections of L onto the eigenvectors do not depend on the
+c     entry of to_ret that is being accumulated, so they are computed
+c     once.
+c
+      do i=1,d
+        do j=1,d
+          Lt(i,j) = 0.d0
+          do ii=1,d
+            do jj=1,d
+              Lt(i,j) = Lt(i,j) + vecs(jj,i)*L(jj,ii)*vecs(ii,j)
+            enddo
+          enddo
+        enddo
+      enddo
+
       do k=1,d
         do kk=1,d
           do i=1,d
-            Lij = 0
-            do ii=1,d
-              do jj=1,d
-                Lij = Lij + vecs(jj,i)*L(jj,ii)*vecs(ii,i)
-              enddo
-            enddo
             to_ret(k,kk) = to_ret(k,kk) +
-     &        2*Lij*vecs(k,i)*vecs(kk,i)
+     &        2*Lt(i,i)*vecs(k,i)*vecs(kk,i)
           enddo
         enddo
       enddo
@@ -246,13 +251,8 @@ c
         do kk=1,d
           do i=1,d; do j=1,d
             if (i /= j) then
-              Lij = 0.d0; Lji = 0.d0
-              do ii=1,d
-                do jj=1,d
-                  Lij = Lij + vecs(jj,i)*L(jj,ii)*vecs(ii,j)
-                  Lji = Lji + vecs(jj,j)*L(jj,ii)*vecs(ii,i)
-                enddo
-              enddo
+              Lij = Lt(i,j)
+              Lji = Lt(j,i)
               if(abs(vals(k)-vals(kk))<1d-10) then
                   to_ret(k,kk) = to_ret(k,kk) +
      &              (Lji+Lij)*vecs(k,i)*vecs(kk,j)
@@ -267,3 +267,65 @@ c
         enddo
       enddo
       endsubroutine
+
+      subroutine sym_eig_3d(vecs,vals)
+c
+c     Computes the eigenvalues and eigenvectors of the symmetric 3x3
+c     matrix stored in vecs by cyclic Jacobi rotations.  On return,
+c     the eigenvectors are stored in the columns of vecs.
+c
+      implicit none
+      REAL vecs(3,3), vals(3)
+      REAL a(3,3)
+      REAL off, scale, theta, t, c, s, tau, g, h
+      INTEGER p, q, r, sweep
+
+      do q = 1, 3
+        do p = 1, 3
+          a(p,q) = vecs(p,q)
+          vecs(p,q) = 0.d0
+        enddo
+        vecs(q,q) = 1.d0
+      enddo
+
+      do sweep = 1, 50
+        off = abs(a(1,2)) + abs(a(1,3)) + abs(a(2,3))
+        scale = abs(a(1,1)) + abs(a(2,2)) + abs(a(3,3))
+        if (off .le. 1.d-300 .or. off .le. 1.d-16*scale) exit
+        do p = 1, 2
+          do q = p+1, 3
+            if (a(p,q) .ne. 0.d0) then
+              theta = 0.5d0*(a(q,q)-a(p,p))/a(p,q)
+              t = sign(1.d0,theta)/(abs(theta)+sqrt(theta*theta+1.d0))
+              c = 1.d0/sqrt(t*t+1.d0)
+              s = t*c
+              tau = s/(1.d0+c)
+              a(p,p) = a(p,p) - t*a(p,q)
+              a(q,q) = a(q,q) + t*a(p,q)
+              a(p,q) = 0.d0
+              a(q,p) = 0.d0
+              do r = 1, 3
+                if (r .ne. p .and. r .ne. q) then
+                  g = a(r,p)
+                  h = a(r,q)
+                  a(r,p) = g - s*(h+g*tau)
+                  a(p,r) = a(r,p)
+                  a(r,q) = h + s*(g-h*tau)
+                  a(q,r) = a(r,q)
+                endif
+              enddo
+              do r = 1, 3
+                g = vecs(r,p)
+                h = vecs(r,q)
+                vecs(r,p) = g - s*(h+g*tau)
+                vecs(r,q) = h + s*(g-h*tau)
+              enddo
+            endif
+          enddo
+        enddo
+      enddo
+
+      do p = 1, 3
+        vals(p) = a(p,p)
+      enddo
+      end subroutine
@@ -294,6 +294,9 @@ FESurfaceDistanceEvaluator::mapIntersections()
                                    IndexUtilities::getCellIndex(large_struct_tr.data(), grid_geom, level_ratio));
 
     // Map the neighbor intersections.
+    d_patch_elem_trees.resize(d_active_neighbor_patch_bdry_elem_map.size());
+    d_patch_elem_tree_elems.resize(d_active_neighbor_patch_bdry_elem_map.size());
+    std::vector<std::size_t> candidate_elem_idxs;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
     {
         // The relevant collection of elements.
@@ -312,6 +315,40 @@ FESurfaceDistanceEvaluator::mapIntersections()
         // computations.
         if (!patch_box.intersects(struct_box)) continue;
 
+        // Update the bounding volume hierarchy of the patch elements. If the
+        // patch has the same elements as when the hierarchy was built, the
+        // surface has only moved slightly and the existing hierarchy is
+        // refit rather than rebuilt.
+        std::vector<libMeshWrappers::BoundingBox> elem_bboxes(num_active_patch_elems);
+        for (size_t e = 0; e < num_active_patch_elems; ++e)
+        {
+            const Elem* const elem = patch_elems[e];
+            for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+            {
+                elem_bboxes[e].first(d) = std::numeric_limits<double>::max();
+                elem_bboxes[e].second(d) = std::numeric_limits<double>::lowest();
+            }
+            for (unsigned int k = 0; k < elem->n_nodes(); ++k)
+            {
+                const libMesh::Point& n = elem->point(k);
+                for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+                {
+                    elem_bboxes[e].first(d) = std::min(elem_bboxes[e].first(d), n(d));
+                    elem_bboxes[e].second(d) = std::max(elem_bboxes[e].second(d), n(d));
+                }
+            }
+        }
+        std::unique_ptr<BoundingBoxTree>& elem_tree = d_patch_elem_trees[local_patch_num];
+        if (elem_tree && d_patch_elem_tree_elems[local_patch_num] == patch_elems)
+        {
+            elem_tree->refit(std::move(elem_bboxes));
+        }
+        else
+        {
+            elem_tree.reset(new BoundingBoxTree(std::move(elem_bboxes)));
+            d_patch_elem_tree_elems[local_patch_num] = patch_elems;
+        }
+
         // Loop over cells
         for (Box<NDIM>::Iterator it(patch_box); it; it++)
         {
@@ -354,9 +391,18 @@ FESurfaceDistanceEvaluator::mapIntersections()
             }
 #endif
 
-            // Loop over elements in the patch.
-            for (const auto& elem : patch_elems)
+            // Loop over the elements in the patch whose bounding boxes
+            // intersect the grown box.
+            libMeshWrappers::BoundingBox ghost_bbox;
+            for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
             {
+                ghost_bbox.first(d) = d < NDIM ? r_bl[d] : std::numeric_limits<double>::lowest();
+                ghost_bbox.second(d) = d < NDIM ? r_tr[d] : std::numeric_limits<double>::max();
+            }
+            elem_tree->findIntersectingBoxes(ghost_bbox, candidate_elem_idxs);
+            for (const std::size_t elem_idx : candidate_elem_idxs)
+            {
+                Elem* const elem = patch_elems[elem_idx];
                 // Get the coordinates of the nodes.
                 const libMesh::Point& n0 = elem->point(0);
                 const libMesh::Point& n1 = elem->point(1);
@@ -405,9 +451,55 @@ FESurfaceDistanceEvaluator::computeSignedDistance(int n_idx, int d_idx)
     TBOX_ASSERT(d_idx >= 0);
 #endif
 
-    // Loop over patches on finest level.
     const int finest_ln = d_patch_hierarchy->getFinestLevelNumber();
     Pointer<PatchLevel<NDIM> > level = d_patch_hierarchy->getPatchLevel(finest_ln);
+
+    // Previously computed values are only reused if the finest level has not
+    // changed since they were computed.
+    bool use_cached_values = d_incremental_update_threshold >= 0.0;
+    if (use_cached_values)
+    {
+        std::vector<Box<NDIM> > patch_boxes;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++) patch_boxes.push_back(level->getPatch(p())->getBox());
+        use_cached_values = finest_ln == d_incremental_finest_ln && patch_boxes == d_incremental_patch_boxes;
+        d_incremental_finest_ln = finest_ln;
+        d_incremental_patch_boxes = std::move(patch_boxes);
+    }
+    if (!use_cached_values)
+    {
+        d_cell_signed_distance_cache.clear();
+        d_elem_ref_points.clear();
+    }
+
+    // Determine whether an element has moved by more than the threshold
+    // distance from its reference position. The reference positions of
+    // elements that have moved are reset to their current positions.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
+    const double* const dx0 = grid_geom->getDx();
+    double level_dx_min = std::numeric_limits<double>::max();
+    for (int d = 0; d < NDIM; ++d) level_dx_min = std::min(level_dx_min, dx0[d] / level->getRatio()(d));
+    const double max_displacement = d_incremental_update_threshold * level_dx_min;
+    std::map<const Elem*, bool> elem_has_moved;
+    auto has_moved = [&](const Elem* const elem) {
+        const auto it = elem_has_moved.find(elem);
+        if (it != elem_has_moved.end()) return it->second;
+        std::vector<libMesh::Point>& ref_points = d_elem_ref_points[elem];
+        bool moved = ref_points.size() != elem->n_nodes();
+        for (unsigned int k = 0; k < elem->n_nodes() && !moved; ++k)
+        {
+            moved = (elem->point(k) - ref_points[k]).norm() > max_displacement;
+        }
+        if (moved)
+        {
+            ref_points.resize(elem->n_nodes());
+            for (unsigned int k = 0; k < elem->n_nodes(); ++k) ref_points[k] = elem->point(k);
+        }
+        elem_has_moved[elem] = moved;
+        return moved;
+    };
+    std::map<CellIndex<NDIM>, std::pair<std::set<Elem*>, double>, CellIndexFortranOrder> cell_signed_distance_cache;
+
+    // Loop over patches on finest level.
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = level->getPatch(p());
@@ -430,6 +522,28 @@ FESurfaceDistanceEvaluator::computeSignedDistance(int n_idx, int d_idx)
                 const int num_elements = static_cast<int>(elem_set.size());
                 (*n_data)(ci) = num_elements;
 
+                // Reuse the previously computed value if the cell is
+                // intersected by the same elements as before and none of
+                // them have moved. Note that the displacements of all of the
+                // elements are checked so that their reference positions are
+                // kept up to date.
+                if (d_incremental_update_threshold >= 0.0)
+                {
+                    const auto cache_it = d_cell_signed_distance_cache.find(ci);
+                    bool reuse_value = cache_it != d_cell_signed_distance_cache.end() &&
+                                       cache_it->second.first == elem_set;
+                    for (const auto& elem : elem_set)
+                    {
+                        reuse_value = !has_moved(elem) && reuse_value;
+                    }
+                    if (reuse_value)
+                    {
+                        (*d_data)(ci) = cache_it->second.second;
+                        cell_signed_distance_cache.insert(*cache_it);
+                        continue;
+                    }
+                }
+
                 // Loop over the cutting elements and find the minimum distance.
                 IBTK::VectorNd P;
                 for (int d = 0; d < NDIM; ++d)
@@ -544,11 +658,25 @@ FESurfaceDistanceEvaluator::computeSignedDistance(int n_idx, int d_idx)
                 // Compute the signed distance function.
                 sgn = avg_unit_normal.dot(P - avg_proj) <= 0.0 ? -1.0 : 1.0;
                 (*d_data)(ci) = sgn * min_dist;
+                if (d_incremental_update_threshold >= 0.0)
+                {
+                    cell_signed_distance_cache[ci] = std::make_pair(elem_set, sgn * min_dist);
+                }
             }
         }
     }
+    d_cell_signed_distance_cache.swap(cell_signed_distance_cache);
 } // computeSignedDistance
 
+void
+FESurfaceDistanceEvaluator::setIncrementalUpdateThreshold(const double threshold)
+{
+    d_incremental_update_threshold = threshold;
+    d_cell_signed_distance_cache.clear();
+    d_elem_ref_points.clear();
+    return;
+} // setIncrementalUpdateThreshold
+
 void
 FESurfaceDistanceEvaluator::calculateSurfaceNormals()
 {
@@ -1384,7 +1512,53 @@ FESurfaceDistanceEvaluator::collectNeighboringPatchElements(int level_number)
     d_active_neighbor_patch_bdry_elem_map.resize(num_local_patches);
     IntVector<NDIM> ghost_width = d_gcw;
 
+    // Bin the bounding boxes of the nodes of the active elements so that
+    // each patch only needs to examine the elements in nearby bins.
+    MeshBase::const_element_iterator el_it = d_mesh.active_elements_begin();
+    MeshBase::const_element_iterator el_end = d_mesh.active_elements_end();
+    if (d_use_vol_extracted_bdry_mesh)
+    {
+        el_it = d_bdry_mesh.active_elements_begin();
+        el_end = d_bdry_mesh.active_elements_end();
+    }
+    std::vector<Elem*> elems;
+    std::vector<libMeshWrappers::BoundingBox> elem_bboxes;
+    for (; el_it != el_end; ++el_it)
+    {
+        Elem* const elem = *el_it;
+
+        // Error checking for element type.
+        if (elem->type() != d_supported_elem_type)
+        {
+            TBOX_ERROR(
+                "FESurfaceDistanceEvaluator presently does not support "
+                "elements of type "
+                << Utility::enum_to_string<ElemType>(elem->type()) << " for NDIM = " << NDIM
+                << ".\nSupported type is " << Utility::enum_to_string<ElemType>(d_supported_elem_type));
+        }
+
+        libMeshWrappers::BoundingBox bbox;
+        for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+        {
+            bbox.first(d) = std::numeric_limits<double>::max();
+            bbox.second(d) = std::numeric_limits<double>::lowest();
+        }
+        for (unsigned int k = 0; k < elem->n_nodes(); ++k)
+        {
+            const libMesh::Point& n = elem->point(k);
+            for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+            {
+                bbox.first(d) = std::min(bbox.first(d), n(d));
+                bbox.second(d) = std::max(bbox.second(d), n(d));
+            }
+        }
+        elems.push_back(elem);
+        elem_bboxes.push_back(bbox);
+    }
+    const BoundingBoxGrid bbox_grid(std::move(elem_bboxes));
+
     int local_patch_num = 0;
+    std::vector<std::size_t> candidate_elem_idxs;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
     {
         d_active_neighbor_patch_bdry_elem_map[local_patch_num] = std::vector<Elem*>(0);
@@ -1401,39 +1575,30 @@ FESurfaceDistanceEvaluator::collectNeighboringPatchElements(int level_number)
             x_upper[d] += dx[d] * ghost_width[d];
         }
 
-        // Loop over the active elements and see if their centroids or nodes reside
-        // in the patch interior grown by the specified ghost cell width.
-        MeshBase::const_element_iterator el_it = d_mesh.active_elements_begin();
-        MeshBase::const_element_iterator el_end = d_mesh.active_elements_end();
-
-        if (d_use_vol_extracted_bdry_mesh)
+        // Only elements whose nodal bounding boxes intersect the patch
+        // interior grown by the specified ghost cell width can have their
+        // centroids or nodes in it.
+        libMeshWrappers::BoundingBox patch_bbox;
+        for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
         {
-            el_it = d_bdry_mesh.active_elements_begin();
-            el_end = d_bdry_mesh.active_elements_end();
+            patch_bbox.first(d) = d < NDIM ? x_lower[d] : std::numeric_limits<double>::lowest();
+            patch_bbox.second(d) = d < NDIM ? x_upper[d] : std::numeric_limits<double>::max();
         }
+        bbox_grid.findIntersectingBoxes(patch_bbox, candidate_elem_idxs);
 
-        for (; el_it != el_end; ++el_it)
+        // Loop over the candidate elements and see if their centroids or
+        // nodes reside in the patch interior grown by the specified ghost cell
+        // width.
+        for (const std::size_t elem_idx : candidate_elem_idxs)
         {
-            bool in_patch = false;
-            Elem* const elem = *el_it;
-
-            // Error checking for element type.
-            if (elem->type() != d_supported_elem_type)
-            {
-                TBOX_ERROR(
-                    "FESurfaceDistanceEvaluator presently does not support "
-                    "elements of type "
-                    << Utility::enum_to_string<ElemType>(elem->type()) << " for NDIM = " << NDIM
-                    << ".\nSupported type is " << Utility::enum_to_string<ElemType>(d_supported_elem_type));
-            }
+            Elem* const elem = elems[elem_idx];
 
             // First check the centroids.
             const libMesh::Point& c = elem->centroid();
-
-            bool centroid_in_patch = true;
+            bool in_patch = true;
             for (unsigned int d = 0; d < NDIM; ++d)
             {
-                in_patch = centroid_in_patch && (x_lower[d] <= c(d) && c(d) <= x_upper[d]);
+                in_patch = in_patch && (x_lower[d] <= c(d) && c(d) <= x_upper[d]);
             }
 
             // Next, check the nodes.
@@ -1441,12 +1606,12 @@ FESurfaceDistanceEvaluator::collectNeighboringPatchElements(int level_number)
             for (unsigned int k = 0; k < n_nodes && !in_patch; ++k)
             {
                 const libMesh::Point& n = elem->point(k);
-
                 bool node_in_patch = true;
                 for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                    in_patch = node_in_patch && (x_lower[d] <= n(d) && n(d) <= x_upper[d]);
+                    node_in_patch = node_in_patch && (x_lower[d] <= n(d) && n(d) <= x_upper[d]);
                 }
+                in_patch = node_in_patch;
             }
 
             // Add the element to the patch list if necessary.
@@ -28,6 +28,7 @@
 #include "BoxArray.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
+#include "CellIndex.h"
 #include "CellVariable.h"
 #include "HierarchyCellDataOpsReal.h"
 #include "IntVector.h"
@@ -43,6 +44,7 @@
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
+#include <cmath>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -141,10 +143,13 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
         var_db->registerVariableAndContext(D_var, var_db->getContext(d_object_name + "::SCRATCH"), cell_ghosts);
     const int D_iter_idx =
         var_db->registerVariableAndContext(D_var, var_db->getContext(d_object_name + "::ITER"), cell_ghosts);
+    const int D_prev_idx =
+        var_db->registerVariableAndContext(D_var, var_db->getContext(d_object_name + "::PREV"), cell_ghosts);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         hierarchy->getPatchLevel(ln)->allocatePatchData(D_scratch_idx, time);
         hierarchy->getPatchLevel(ln)->allocatePatchData(D_iter_idx, time);
+        hierarchy->getPatchLevel(ln)->allocatePatchData(D_prev_idx, time);
     }
 
     // First, fill cells with some large positive/negative values
@@ -162,6 +167,13 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
     fill_op->initializeOperatorState(D_transaction, hierarchy);
     HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(hierarchy, coarsest_ln, finest_ln);
 
+    // Keep track of the number of times that each patch is swept.
+    std::vector<std::vector<int> > num_patch_sweeps(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        num_patch_sweeps[ln].resize(hierarchy->getPatchLevel(ln)->getNumberOfPatches(), 0);
+    }
+
     // Carry out iterations
     double diff_L2_norm = 1.0e12;
     int outer_iter = 0;
@@ -172,7 +184,8 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
         hier_cc_data_ops.copyData(D_iter_idx, D_scratch_idx);
         fill_op->fillData(time);
 
-        fastSweep(hier_math_ops, D_scratch_idx);
+        const int num_swept_patches =
+            fastSweep(hier_math_ops, D_scratch_idx, D_prev_idx, outer_iter == 0, num_patch_sweeps);
 
         hier_cc_data_ops.axmy(D_iter_idx, 1.0, D_iter_idx, D_scratch_idx);
         diff_L2_norm = hier_cc_data_ops.L2Norm(D_iter_idx, cc_wgt_idx);
@@ -182,6 +195,8 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
         if (d_enable_logging)
         {
             plog << d_object_name << "::initializeLSData(): After iteration # " << outer_iter << std::endl;
+            plog << d_object_name << "::initializeLSData(): Number of local patches swept = " << num_swept_patches
+                 << std::endl;
             plog << d_object_name << "::initializeLSData(): L2-norm between successive iterations = " << diff_L2_norm
                  << std::endl;
         }
@@ -205,6 +220,8 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
         }
     }
 
+    if (d_enable_logging) logPatchIterationHistogram(num_patch_sweeps);
+
     // Copy signed distance into supplied patch data index
     hier_cc_data_ops.copyData(D_idx, D_scratch_idx);
 
@@ -213,9 +230,11 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
     {
         hierarchy->getPatchLevel(ln)->deallocatePatchData(D_scratch_idx);
         hierarchy->getPatchLevel(ln)->deallocatePatchData(D_iter_idx);
+        hierarchy->getPatchLevel(ln)->deallocatePatchData(D_prev_idx);
     }
     var_db->removePatchDataIndex(D_scratch_idx);
     var_db->removePatchDataIndex(D_iter_idx);
+    var_db->removePatchDataIndex(D_prev_idx);
 
     // Indicate that the LS has been initialized.
     d_reinitialize_ls = false;
@@ -225,13 +244,18 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
-void
-FastSweepingLSMethod::fastSweep(Pointer<HierarchyMathOps> hier_math_ops, int dist_idx) const
+int
+FastSweepingLSMethod::fastSweep(Pointer<HierarchyMathOps> hier_math_ops,
+                                int dist_idx,
+                                int dist_prev_idx,
+                                bool sweep_all_patches,
+                                std::vector<std::vector<int> >& num_patch_sweeps) const
 {
     Pointer<PatchHierarchy<NDIM> > hierarchy = hier_math_ops->getPatchHierarchy();
     const int coarsest_ln = 0;
     const int finest_ln = hierarchy->getFinestLevelNumber();
 
+    int num_swept_patches = 0;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
@@ -244,10 +268,31 @@ FastSweepingLSMethod::fastSweep(Pointer<HierarchyMathOps> hier_math_ops, int dis
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
+            Pointer<CellData<NDIM, double> > dist_prev_data = patch->getPatchData(dist_prev_idx);
+
+            // The sweep is a deterministic function of the interior and ghost
+            // cell values of the patch.  If neither the ghost cell values nor
+            // the result of the previous sweep of the patch differ from the
+            // values that were used as input to that sweep by more than the
+            // patch tolerance, the patch is considered to be converged and is
+            // skipped.  With the default tolerance of zero, sweeping such a
+            // patch again would leave its values unchanged.
+            const Box<NDIM>& ghost_box = dist_data->getGhostBox();
+            bool patch_is_active = sweep_all_patches;
+            for (Box<NDIM>::Iterator it(ghost_box); it && !patch_is_active; it++)
+            {
+                const CellIndex<NDIM> ci(it());
+                patch_is_active = std::abs((*dist_data)(ci) - (*dist_prev_data)(ci)) > d_patch_abs_tol;
+            }
+            if (!patch_is_active) continue;
+
+            dist_prev_data->getArrayData().copy(dist_data->getArrayData(), ghost_box);
             fastSweep(dist_data, patch, domain_boxes[0]);
+            ++num_swept_patches;
+            ++num_patch_sweeps[ln][p()];
         }
     }
-    return;
+    return num_swept_patches;
 
 } // fastSweep
 
@@ -332,6 +377,8 @@ FastSweepingLSMethod::getFromInput(Pointer<Database> input_db)
 
     d_reinit_interval = input_db->getIntegerWithDefault("reinit_interval", d_reinit_interval);
 
+    d_patch_abs_tol = input_db->getDoubleWithDefault("patch_abs_tol", d_patch_abs_tol);
+
     d_consider_phys_bdry_wall = input_db->getBoolWithDefault("physical_bdry_wall", d_consider_phys_bdry_wall);
     Array<int> wall_loc_idices;
     if (input_db->keyExists("physical_bdry_wall_loc_idx"))
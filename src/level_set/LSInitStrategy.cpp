@@ -16,9 +16,14 @@
 #include "ibamr/LSInitStrategy.h"
 #include "ibamr/namespaces.h"
 
+#include "PatchLevel.h"
+
 #include "tbox/Database.h"
+#include "tbox/PIO.h"
 #include "tbox/RestartManager.h"
 
+#include <map>
+#include <ostream>
 #include <utility>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -73,12 +78,42 @@ LSInitStrategy::setReinitializeLSData(bool reinit_ls_data)
     return;
 } // setReinitializeLSData
 
+bool
+LSInitStrategy::getNarrowBandPatches(Pointer<PatchLevel<NDIM> > /*level*/,
+                                     double /*band_dist*/,
+                                     std::vector<bool>& /*patch_in_band*/) const
+{
+    return false;
+} // getNarrowBandPatches
+
 void LSInitStrategy::putToDatabase(Pointer<Database> /*db*/)
 {
     // intentionally blank
     return;
 } // putToDatabase
 
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+void
+LSInitStrategy::logPatchIterationHistogram(const std::vector<std::vector<int> >& num_patch_iterations) const
+{
+    std::map<int, int> histogram;
+    for (const auto& level_num_patch_iterations : num_patch_iterations)
+    {
+        for (const int num_iterations : level_num_patch_iterations)
+        {
+            if (num_iterations > 0) ++histogram[num_iterations];
+        }
+    }
+    plog << d_object_name << "::initializeLSData(): Number of local patches by number of iterations:\n";
+    for (const auto& entry : histogram)
+    {
+        plog << "  " << entry.first << " iterations: " << entry.second << " patches\n";
+    }
+    plog << std::flush;
+    return;
+} // logPatchIterationHistogram
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
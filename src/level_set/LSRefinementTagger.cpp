@@ -0,0 +1,235 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibamr/LSRefinementTagger.h"
+#include "ibamr/namespaces.h"
+
+#include "BasePatchHierarchy.h"
+#include "Box.h"
+#include "CartesianPatchGeometry.h"
+#include "CellData.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "VariableDatabase.h"
+#include "tbox/Database.h"
+#include "tbox/Utilities.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <utility>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBAMR
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Position of the given index in the storage of the given (ghost) box.
+inline int
+array_offset(const Box<NDIM>& box, const hier::Index<NDIM>& i)
+{
+    int offset = 0, stride = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        offset += (i(d) - box.lower(d)) * stride;
+        stride *= box.numberCells(d);
+    }
+    return offset;
+} // array_offset
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+LSRefinementTagger::LSRefinementTagger(std::string object_name, Pointer<Database> input_db)
+    : d_object_name(std::move(object_name))
+{
+    if (input_db)
+    {
+        d_tag_value = input_db->getDoubleWithDefault("tag_value", d_tag_value);
+        d_tag_abs_thresh = input_db->getDoubleWithDefault("tag_abs_thresh", d_tag_abs_thresh);
+        d_use_bounding_box_tagging =
+            input_db->getBoolWithDefault("use_bounding_box_tagging", d_use_bounding_box_tagging);
+        d_narrow_band_margin = input_db->getIntegerWithDefault("narrow_band_margin", d_narrow_band_margin);
+    }
+    if (d_tag_abs_thresh < 0.0)
+    {
+        TBOX_ERROR(d_object_name << "::LSRefinementTagger():\n"
+                                 << "  tag_abs_thresh must be nonnegative" << std::endl);
+    }
+    if (d_narrow_band_margin < 0)
+    {
+        TBOX_ERROR(d_object_name << "::LSRefinementTagger():\n"
+                                 << "  narrow_band_margin must be nonnegative" << std::endl);
+    }
+    return;
+} // LSRefinementTagger
+
+void
+LSRefinementTagger::setLevelSetVariable(Pointer<CellVariable<NDIM, double> > ls_var,
+                                        Pointer<HierarchyIntegrator> integrator)
+{
+    d_ls_var = ls_var;
+    d_integrator = integrator;
+    return;
+} // setLevelSetVariable
+
+void
+LSRefinementTagger::setLSInitStrategy(Pointer<LSInitStrategy> ls_init_strategy)
+{
+    d_ls_init_strategy = ls_init_strategy;
+    return;
+} // setLSInitStrategy
+
+void
+LSRefinementTagger::setTagValue(const double tag_value)
+{
+    d_tag_value = tag_value;
+    return;
+} // setTagValue
+
+void
+LSRefinementTagger::setTagAbsThreshold(const double tag_abs_thresh)
+{
+    TBOX_ASSERT(tag_abs_thresh >= 0.0);
+    d_tag_abs_thresh = tag_abs_thresh;
+    return;
+} // setTagAbsThreshold
+
+void
+LSRefinementTagger::setUseBoundingBoxTagging(const bool use_bounding_box_tagging)
+{
+    d_use_bounding_box_tagging = use_bounding_box_tagging;
+    return;
+} // setUseBoundingBoxTagging
+
+void
+LSRefinementTagger::registerWithHierarchyIntegrator(Pointer<HierarchyIntegrator> integrator)
+{
+    integrator->registerApplyGradientDetectorCallback(&LSRefinementTagger::applyGradientDetectorCallback,
+                                                      static_cast<void*>(this));
+    return;
+} // registerWithHierarchyIntegrator
+
+void
+LSRefinementTagger::tagCells(Pointer<PatchHierarchy<NDIM> > hierarchy, const int level_number, const int tag_idx)
+{
+    TBOX_ASSERT(hierarchy);
+    TBOX_ASSERT((level_number >= 0) && (level_number <= hierarchy->getFinestLevelNumber()));
+    if (!d_ls_var || !d_integrator)
+    {
+        TBOX_ERROR(d_object_name << "::tagCells():\n"
+                                 << "  the level set variable has not been set" << std::endl);
+    }
+
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int ls_idx = var_db->mapVariableAndContextToIndex(d_ls_var, d_integrator->getCurrentContext());
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+
+    // Patches that do not intersect the narrow band of the level set cannot
+    // contain cells to tag, so there is no need to look at their data.
+    bool skip_patches = false;
+    if (d_ls_init_strategy && level->getNumberOfPatches() > 0)
+    {
+        Pointer<CartesianPatchGeometry<NDIM> > pgeom = level->getPatch(0)->getPatchGeometry();
+        const double* const dx = pgeom->getDx();
+        const double band_dist = std::abs(d_tag_value) + d_tag_abs_thresh +
+                                 d_narrow_band_margin * *std::max_element(dx, dx + NDIM);
+        skip_patches = d_ls_init_strategy->getNarrowBandPatches(level, band_dist, d_patch_in_band);
+    }
+
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        if (skip_patches && !d_patch_in_band[p()]) continue;
+
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<CellData<NDIM, int> > tags_data = patch->getPatchData(tag_idx);
+        Pointer<CellData<NDIM, double> > ls_data = patch->getPatchData(ls_idx);
+        const Box<NDIM>& tags_ghost_box = tags_data->getGhostBox();
+        const Box<NDIM>& ls_ghost_box = ls_data->getGhostBox();
+        int* const tags = tags_data->getPointer();
+        const double* const phi = ls_data->getPointer();
+
+        // Scan the cells of the patch one line in the first coordinate
+        // direction at a time. The cells of each line are contiguous in both
+        // arrays.
+        const int n0 = patch_box.numberCells(0);
+        Box<NDIM> line_starts = patch_box;
+        line_starts.upper(0) = line_starts.lower(0);
+        hier::Index<NDIM> band_lower = patch_box.upper(), band_upper = patch_box.lower();
+        bool found_band_cells = false;
+        for (Box<NDIM>::Iterator b(line_starts); b; b++)
+        {
+            const hier::Index<NDIM>& i = b();
+            int* const tags_line = tags + array_offset(tags_ghost_box, i);
+            const double* const phi_line = phi + array_offset(ls_ghost_box, i);
+            int line_lower = n0, line_upper = -1;
+            for (int k = 0; k < n0; ++k)
+            {
+                if (std::abs(phi_line[k] - d_tag_value) <= d_tag_abs_thresh)
+                {
+                    line_lower = std::min(line_lower, k);
+                    line_upper = k;
+                    if (!d_use_bounding_box_tagging) tags_line[k] = 1;
+                }
+            }
+            if (line_upper < 0) continue;
+            found_band_cells = true;
+            band_lower(0) = std::min(band_lower(0), i(0) + line_lower);
+            band_upper(0) = std::max(band_upper(0), i(0) + line_upper);
+            for (unsigned int d = 1; d < NDIM; ++d)
+            {
+                band_lower(d) = std::min(band_lower(d), i(d));
+                band_upper(d) = std::max(band_upper(d), i(d));
+            }
+        }
+        if (d_use_bounding_box_tagging && found_band_cells)
+        {
+            tags_data->fill(1, Box<NDIM>(band_lower, band_upper));
+        }
+    }
+    return;
+} // tagCells
+
+void
+LSRefinementTagger::applyGradientDetectorCallback(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
+                                                  const int level_number,
+                                                  const double /*error_data_time*/,
+                                                  const int tag_index,
+                                                  const bool initial_time,
+                                                  const bool /*uses_richardson_extrapolation_too*/,
+                                                  void* ctx)
+{
+    if (initial_time) return;
+    auto tagger = static_cast<LSRefinementTagger*>(ctx);
+    tagger->tagCells(hierarchy, level_number, tag_index);
+    return;
+} // applyGradientDetectorCallback
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
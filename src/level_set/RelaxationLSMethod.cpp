@@ -25,6 +25,7 @@
 
 #include "BasePatchLevel.h"
 #include "Box.h"
+#include "BoxArray.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
 #include "CellIndex.h"
@@ -310,6 +311,8 @@ RelaxationLSMethod::initializeLSData(int D_idx,
         var_db->registerVariableAndContext(D_var, var_db->getContext(d_object_name + "::H_INIT"), cell_ghosts);
     const int H_scratch_idx =
         var_db->registerVariableAndContext(D_var, var_db->getContext(d_object_name + "::H_SCRATCH"), no_ghosts);
+    const int D_prev_idx =
+        var_db->registerVariableAndContext(D_var, var_db->getContext(d_object_name + "::PREV"), cell_ghosts);
 
     // Heaviside variables
     const int HS_init_idx =
@@ -330,6 +333,18 @@ RelaxationLSMethod::initializeLSData(int D_idx,
             hierarchy->getPatchLevel(ln)->allocatePatchData(HS_init_idx, time);
             hierarchy->getPatchLevel(ln)->allocatePatchData(HS_copy_idx, time);
         }
+        if (d_patch_abs_tol >= 0.0) hierarchy->getPatchLevel(ln)->allocatePatchData(D_prev_idx, time);
+    }
+
+    // Keep track of the number of iterations carried out on each patch and of
+    // the patches that have converged.
+    d_num_patch_iterations.assign(finest_ln + 1, std::vector<int>());
+    d_patch_is_converged.assign(finest_ln + 1, std::vector<bool>());
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        const int num_patches = hierarchy->getPatchLevel(ln)->getNumberOfPatches();
+        d_num_patch_iterations[ln].resize(num_patches, 0);
+        d_patch_is_converged[ln].resize(num_patches, false);
     }
 
     // First, fill cells with some positive/negative values
@@ -362,6 +377,10 @@ RelaxationLSMethod::initializeLSData(int D_idx,
     D_fill_op->fillData(time);
     hier_cc_data_ops.copyData(D_init_idx, D_scratch_idx, /*interior_only*/ false);
 
+    // Determine the patches that intersect the narrow band around the
+    // interface of the initial level set.
+    if (d_narrow_band_width > 0) findNarrowBandPatches(hierarchy, D_init_idx);
+
     // Compute the volume of the initial level set variable
     if (d_apply_volume_shift && initial_time)
     {
@@ -385,7 +404,7 @@ RelaxationLSMethod::initializeLSData(int D_idx,
         // Refill ghost data and relax
         hier_cc_data_ops.copyData(D_iter_idx, D_scratch_idx);
         D_fill_op->fillData(time);
-        relax(hier_math_ops, D_scratch_idx, D_init_idx, outer_iter);
+        relax(hier_math_ops, D_scratch_idx, D_init_idx, D_prev_idx, outer_iter);
         hier_cc_data_ops.linearSum(D_scratch_idx, d_alpha, D_scratch_idx, 1.0 - d_alpha, D_iter_idx);
 
         if (d_apply_volume_shift)
@@ -414,6 +433,7 @@ RelaxationLSMethod::initializeLSData(int D_idx,
         hier_cc_data_ops.copyData(D_copy_idx, D_iter_idx);
         hier_cc_data_ops.axmy(D_iter_idx, 1.0, D_iter_idx, D_scratch_idx);
         diff_L2_norm = hier_cc_data_ops.L2Norm(D_iter_idx, cc_wgt_idx);
+        if (d_patch_abs_tol >= 0.0) updatePatchConvergence(hierarchy, D_iter_idx);
 
         // Compute difference between |grad phi| and 1
         D_fill_op->fillData(time);
@@ -447,6 +467,8 @@ RelaxationLSMethod::initializeLSData(int D_idx,
         }
     }
 
+    if (d_enable_logging) logPatchIterationHistogram(d_num_patch_iterations);
+
     // Copy signed distance into supplied patch data index
     hier_cc_data_ops.copyData(D_idx, D_scratch_idx);
 
@@ -465,6 +487,7 @@ RelaxationLSMethod::initializeLSData(int D_idx,
             hierarchy->getPatchLevel(ln)->deallocatePatchData(HS_init_idx);
             hierarchy->getPatchLevel(ln)->deallocatePatchData(HS_copy_idx);
         }
+        if (d_patch_abs_tol >= 0.0) hierarchy->getPatchLevel(ln)->deallocatePatchData(D_prev_idx);
     }
     var_db->removePatchDataIndex(D_scratch_idx);
     var_db->removePatchDataIndex(D_iter_idx);
@@ -472,6 +495,7 @@ RelaxationLSMethod::initializeLSData(int D_idx,
     var_db->removePatchDataIndex(D_copy_idx);
     var_db->removePatchDataIndex(H_init_idx);
     var_db->removePatchDataIndex(H_scratch_idx);
+    var_db->removePatchDataIndex(D_prev_idx);
 
     if (d_apply_volume_shift)
     {
@@ -481,6 +505,9 @@ RelaxationLSMethod::initializeLSData(int D_idx,
 
     // Indicate that the LS has been initialized.
     d_reinitialize_ls = false;
+    d_narrow_band_patch_nums.clear();
+    d_num_patch_iterations.clear();
+    d_patch_is_converged.clear();
 
     return;
 } // initializeLSData
@@ -520,13 +547,46 @@ RelaxationLSMethod::setApplyVolumeShift(bool apply_volume_shift)
     return;
 } // setApplyVolumeShift
 
+void
+RelaxationLSMethod::setNarrowBandWidth(int narrow_band_width)
+{
+    d_narrow_band_width = narrow_band_width;
+    return;
+} // setNarrowBandWidth
+
+bool
+RelaxationLSMethod::getNarrowBandPatches(Pointer<PatchLevel<NDIM> > level,
+                                         const double band_dist,
+                                         std::vector<bool>& patch_in_band) const
+{
+    const int ln = level->getLevelNumber();
+    if (d_narrow_band_width <= 0 || ln < 0 || ln >= static_cast<int>(d_patch_in_narrow_band.size())) return false;
+    if (band_dist > d_narrow_band_dist[ln]) return false;
+
+    // Patch numbers refer to the same local patches only if the boxes of the
+    // level and their owners are unchanged.
+    const BoxArray<NDIM>& boxes = level->getBoxes();
+    const BoxArray<NDIM>& band_boxes = d_narrow_band_level_boxes[ln];
+    if (boxes.getNumberOfBoxes() != band_boxes.getNumberOfBoxes()) return false;
+    for (int k = 0; k < boxes.getNumberOfBoxes(); ++k)
+    {
+        if (!(boxes[k] == band_boxes[k]) || level->getMappingForPatch(k) != d_narrow_band_patch_owners[ln][k])
+        {
+            return false;
+        }
+    }
+    patch_in_band = d_patch_in_narrow_band[ln];
+    return true;
+} // getNarrowBandPatches
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
 RelaxationLSMethod::relax(Pointer<HierarchyMathOps> hier_math_ops,
                           int dist_idx,
                           int dist_init_idx,
-                          const int iter) const
+                          int dist_prev_idx,
+                          const int iter)
 {
     Pointer<PatchHierarchy<NDIM> > hierarchy = hier_math_ops->getPatchHierarchy();
     const int coarsest_ln = 0;
@@ -535,18 +595,122 @@ RelaxationLSMethod::relax(Pointer<HierarchyMathOps> hier_math_ops,
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<int> patch_nums;
+        if (d_narrow_band_width > 0)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            // Only relax the patches that intersect the narrow band.
+            patch_nums = d_narrow_band_patch_nums[ln];
+        }
+        else
+        {
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++) patch_nums.push_back(p());
+        }
+        for (const int patch_num : patch_nums)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(patch_num);
             Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
             const Pointer<CellData<NDIM, double> > dist_init_data = patch->getPatchData(dist_init_idx);
+
+            // Skip converged patches unless the values used as input to their
+            // most recent relaxation step have changed by more than the patch
+            // tolerance.
+            if (d_patch_abs_tol >= 0.0)
+            {
+                Pointer<CellData<NDIM, double> > dist_prev_data = patch->getPatchData(dist_prev_idx);
+                const Box<NDIM>& ghost_box = dist_data->getGhostBox();
+                bool patch_is_active = !d_patch_is_converged[ln][patch_num];
+                for (Box<NDIM>::Iterator it(ghost_box); it && !patch_is_active; it++)
+                {
+                    const CellIndex<NDIM> ci(it());
+                    patch_is_active = std::abs((*dist_data)(ci) - (*dist_prev_data)(ci)) > d_patch_abs_tol;
+                }
+                if (!patch_is_active) continue;
+                dist_prev_data->getArrayData().copy(dist_data->getArrayData(), ghost_box);
+            }
+
             relax(dist_data, dist_init_data, patch, iter);
+            ++d_num_patch_iterations[ln][patch_num];
         }
     }
     return;
 
 } // relax
 
+void
+RelaxationLSMethod::updatePatchConvergence(Pointer<PatchHierarchy<NDIM> > hierarchy, int diff_idx)
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<CellData<NDIM, double> > diff_data = patch->getPatchData(diff_idx);
+            bool patch_is_converged = true;
+            for (Box<NDIM>::Iterator it(patch->getBox()); it && patch_is_converged; it++)
+            {
+                const CellIndex<NDIM> ci(it());
+                patch_is_converged = std::abs((*diff_data)(ci)) <= d_patch_abs_tol;
+            }
+            d_patch_is_converged[ln][p()] = patch_is_converged;
+        }
+    }
+    return;
+} // updatePatchConvergence
+
+void
+RelaxationLSMethod::findNarrowBandPatches(Pointer<PatchHierarchy<NDIM> > hierarchy, int dist_init_idx)
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    d_narrow_band_patch_nums.assign(finest_ln + 1, std::vector<int>());
+    d_narrow_band_level_boxes.assign(finest_ln + 1, BoxArray<NDIM>());
+    d_narrow_band_patch_owners.assign(finest_ln + 1, std::vector<int>());
+    d_narrow_band_dist.assign(finest_ln + 1, 0.0);
+    d_patch_in_narrow_band.assign(finest_ln + 1, std::vector<bool>());
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        d_narrow_band_level_boxes[ln] = level->getBoxes();
+        for (int k = 0; k < level->getNumberOfPatches(); ++k)
+        {
+            d_narrow_band_patch_owners[ln].push_back(level->getMappingForPatch(k));
+        }
+        d_patch_in_narrow_band[ln].assign(level->getNumberOfPatches(), false);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<CellData<NDIM, double> > dist_init_data = patch->getPatchData(dist_init_idx);
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const dx = pgeom->getDx();
+            const double band_dist = d_narrow_band_width * *std::max_element(dx, dx + NDIM);
+            d_narrow_band_dist[ln] = band_dist;
+
+            // Also check the ghost cells, so that patches that are adjacent to
+            // the interface are included in the band.
+            const Box<NDIM> check_box = Box<NDIM>::grow(patch->getBox(), dist_init_data->getGhostCellWidth());
+            for (Box<NDIM>::Iterator it(check_box); it; it++)
+            {
+                const CellIndex<NDIM> ci(it());
+                if (std::abs((*dist_init_data)(ci)) <= band_dist)
+                {
+                    d_narrow_band_patch_nums[ln].push_back(p());
+                    d_patch_in_narrow_band[ln][p()] = true;
+                    break;
+                }
+            }
+        }
+        if (d_enable_logging)
+        {
+            plog << d_object_name << "::findNarrowBandPatches(): " << d_narrow_band_patch_nums[ln].size()
+                 << " local patches on level " << ln << " intersect the narrow band" << std::endl;
+        }
+    }
+    return;
+} // findNarrowBandPatches
+
 void
 RelaxationLSMethod::relax(Pointer<CellData<NDIM, double> > dist_data,
                           const Pointer<CellData<NDIM, double> > dist_init_data,
@@ -1015,6 +1179,10 @@ RelaxationLSMethod::getFromInput(Pointer<Database> input_db)
 
     d_apply_volume_shift = input_db->getBoolWithDefault("apply_volume_shift", d_apply_volume_shift);
 
+    d_narrow_band_width = input_db->getIntegerWithDefault("narrow_band_width", d_narrow_band_width);
+
+    d_patch_abs_tol = input_db->getDoubleWithDefault("patch_abs_tol", d_patch_abs_tol);
+
     return;
 } // getFromInput
 
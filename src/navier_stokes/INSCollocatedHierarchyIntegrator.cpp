@@ -31,10 +31,12 @@
 #include "ibtk/CCPoissonSolverManager.h"
 #include "ibtk/CartCellRobinPhysBdryOp.h"
 #include "ibtk/CartGridFunction.h"
+#include "ibtk/DiagnosticsCollector.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/LinearSolver.h"
+#include "ibtk/PerformanceMonitor.h"
 #include "ibtk/PoissonSolver.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
@@ -53,6 +55,8 @@
 #include "CoarsenSchedule.h"
 #include "ComponentSelector.h"
 #include "FaceData.h"
+#include "FaceIndex.h"
+#include "FaceIterator.h"
 #include "FaceVariable.h"
 #include "GriddingAlgorithm.h"
 #include "HierarchyCellDataOpsReal.h"
@@ -894,12 +898,8 @@ INSCollocatedHierarchyIntegrator::preprocessIntegrateHierarchy(const double curr
     }
 
     // Allocate the scratch and new data.
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
-    }
+    allocatePatchData(d_scratch_data, current_time, coarsest_ln, finest_ln);
+    allocatePatchData(d_new_data, new_time, coarsest_ln, finest_ln);
 
     // Setup the operators and solvers.
     reinitializeOperatorsAndSolvers(current_time, new_time);
@@ -1056,6 +1056,7 @@ INSCollocatedHierarchyIntegrator::integrateHierarchy(const double current_time,
                                                      const double new_time,
                                                      const int cycle_num)
 {
+    PerformanceMonitor::ScopedRegion region("INSCollocatedHierarchyIntegrator::integrateHierarchy");
     INSHierarchyIntegrator::integrateHierarchy(current_time, new_time, cycle_num);
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
@@ -1307,17 +1308,13 @@ INSCollocatedHierarchyIntegrator::integrateHierarchy(const double current_time,
                           d_Phi_var,
                           d_Phi_bdry_bc_fill_op,
                           half_time);
-    d_hier_fc_data_ops->axpy(d_u_ADV_new_idx, -1.0 / div_fac, d_Grad_Phi_fc_idx, d_u_ADV_scratch_idx);
-    d_hier_math_ops->interp(d_Grad_Phi_cc_idx,
-                            d_Grad_Phi_cc_var,
-                            d_Grad_Phi_fc_idx,
-                            d_Grad_Phi_fc_var,
-                            d_no_fill_op,
-                            half_time,
-                            /*synch_cf_bdry*/ false);
-    d_hier_cc_data_ops->axpy(d_U_new_idx, -1.0 / div_fac, d_Grad_Phi_cc_idx, d_U_scratch_idx);
 
-    // Determine P(n+1/2).
+    // Determine U(n+1), u_ADV(n+1), and P(n+1/2). Unless the pressure update
+    // involves the Laplacian of Phi, all three are computed in a single pass
+    // over the patch hierarchy.
+    const bool fuse_pressure_update = !MathUtilities<double>::equalEps(rho, 0.0) && !d_using_2nd_order_pressure_update;
+    applyProjectionCorrection(div_fac, fuse_pressure_update);
+
     double K = 0.0;
     switch (d_viscous_time_stepping_type)
     {
@@ -1333,32 +1330,30 @@ INSCollocatedHierarchyIntegrator::integrateHierarchy(const double current_time,
     default:
         TBOX_ERROR("this statment should not be reached");
     }
-    PoissonSpecifications helmholtz_spec(d_object_name + "::helmholtz_spec");
-    if (MathUtilities<double>::equalEps(rho, 0.0))
-    {
-        helmholtz_spec.setCConstant(0.0);
-        helmholtz_spec.setDConstant(-K * mu);
-    }
-    else if (d_using_2nd_order_pressure_update)
-    {
-        helmholtz_spec.setCConstant(1.0 + K * dt * lambda / rho);
-        helmholtz_spec.setDConstant(-K * dt * mu / rho);
-    }
-    else
+    if (!fuse_pressure_update)
     {
-        helmholtz_spec.setCConstant(1.0);
-        helmholtz_spec.setDConstant(0.0);
+        PoissonSpecifications helmholtz_spec(d_object_name + "::helmholtz_spec");
+        if (MathUtilities<double>::equalEps(rho, 0.0))
+        {
+            helmholtz_spec.setCConstant(0.0);
+            helmholtz_spec.setDConstant(-K * mu);
+        }
+        else
+        {
+            helmholtz_spec.setCConstant(1.0 + K * dt * lambda / rho);
+            helmholtz_spec.setDConstant(-K * dt * mu / rho);
+        }
+        d_hier_math_ops->laplace(d_P_new_idx,
+                                 d_P_var,
+                                 helmholtz_spec,
+                                 d_Phi_idx,
+                                 d_Phi_var,
+                                 d_no_fill_op,
+                                 half_time,
+                                 1.0,
+                                 d_P_scratch_idx,
+                                 d_P_var);
     }
-    d_hier_math_ops->laplace(d_P_new_idx,
-                             d_P_var,
-                             helmholtz_spec,
-                             d_Phi_idx,
-                             d_Phi_var,
-                             d_no_fill_op,
-                             half_time,
-                             1.0,
-                             d_P_scratch_idx,
-                             d_P_var);
     if (d_normalize_pressure)
     {
         const double P_mean = (1.0 / volume) * d_hier_cc_data_ops->integral(d_P_new_idx, wgt_cc_idx);
@@ -1484,9 +1479,11 @@ INSCollocatedHierarchyIntegrator::postprocessIntegrateHierarchy(const double cur
                 cfl_max = std::max(cfl_max, u_max * dt / dx_min);
             }
         }
-        cfl_max = SAMRAI_MPI::maxReduction(cfl_max);
-        if (d_enable_logging)
-            plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl_max << "\n";
+        getDiagnosticsCollector().addContribution(
+            d_object_name + "::CFL", cfl_max, DiagnosticsCollector::MAX, [this](const double cfl) {
+                if (d_enable_logging)
+                    plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl << "\n";
+            });
     }
 
     // Compute max |Omega|_2.
@@ -1873,6 +1870,7 @@ INSCollocatedHierarchyIntegrator::setupPlotDataSpecialized()
 void
 INSCollocatedHierarchyIntegrator::regridProjection()
 {
+    PerformanceMonitor::ScopedRegion region("INSCollocatedHierarchyIntegrator::regridProjection");
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
     const int wgt_cc_idx = d_hier_math_ops->getCellWeightPatchDescriptorIndex();
@@ -2011,6 +2009,64 @@ INSCollocatedHierarchyIntegrator::regridProjection()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+INSCollocatedHierarchyIntegrator::applyProjectionCorrection(const double div_fac, const bool update_pressure)
+{
+    // NOTE: The operations are the same as those done by separate calls to
+    // HierarchyFaceDataOpsReal::axpy(), HierarchyMathOps::interp() (which
+    // averages the two face values to the cell center), and
+    // HierarchyCellDataOpsReal::axpy(), so that the results are unchanged, but
+    // the cell-centered gradient is never stored.
+    const double scale = -1.0 / div_fac;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<FaceData<NDIM, double> > Grad_Phi_fc_data = patch->getPatchData(d_Grad_Phi_fc_idx);
+            Pointer<FaceData<NDIM, double> > u_ADV_scratch_data = patch->getPatchData(d_u_ADV_scratch_idx);
+            Pointer<FaceData<NDIM, double> > u_ADV_new_data = patch->getPatchData(d_u_ADV_new_idx);
+            Pointer<CellData<NDIM, double> > U_scratch_data = patch->getPatchData(d_U_scratch_idx);
+            Pointer<CellData<NDIM, double> > U_new_data = patch->getPatchData(d_U_new_idx);
+
+            // u_ADV(n+1) := u_ADV(*) - grad Phi / div_fac.
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                for (FaceIterator<NDIM> it(patch_box, axis); it; it++)
+                {
+                    const FaceIndex<NDIM>& i_f = it();
+                    (*u_ADV_new_data)(i_f) = scale * (*Grad_Phi_fc_data)(i_f) + (*u_ADV_scratch_data)(i_f);
+                }
+            }
+
+            // U(n+1) := U(*) - grad Phi / div_fac and P(n+1/2) := P + Phi.
+            Pointer<CellData<NDIM, double> > Phi_data, P_scratch_data, P_new_data;
+            if (update_pressure)
+            {
+                Phi_data = patch->getPatchData(d_Phi_idx);
+                P_scratch_data = patch->getPatchData(d_P_scratch_idx);
+                P_new_data = patch->getPatchData(d_P_new_idx);
+            }
+            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+            {
+                const CellIndex<NDIM>& i = ic();
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    const double Grad_Phi_cc =
+                        0.5 * ((*Grad_Phi_fc_data)(FaceIndex<NDIM>(i, axis, FaceIndex<NDIM>::Lower)) +
+                               (*Grad_Phi_fc_data)(FaceIndex<NDIM>(i, axis, FaceIndex<NDIM>::Upper)));
+                    (*U_new_data)(i, axis) = scale * Grad_Phi_cc + (*U_scratch_data)(i, axis);
+                }
+                if (update_pressure) (*P_new_data)(i) = (*Phi_data)(i) + (*P_scratch_data)(i);
+            }
+        }
+    }
+    return;
+} // applyProjectionCorrection
+
 void
 INSCollocatedHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double current_time, const double new_time)
 {
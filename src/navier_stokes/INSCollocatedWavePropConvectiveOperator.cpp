@@ -15,6 +15,7 @@
 
 #include "ibamr/ConvectiveOperator.h"
 #include "ibamr/INSCollocatedWavePropConvectiveOperator.h"
+#include "ibamr/WavePropConvectiveFunctions.h"
 #include "ibamr/ibamr_enums.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
@@ -40,6 +41,7 @@
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
+#include <array>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -119,6 +121,8 @@ INSCollocatedWavePropConvectiveOperator::INSCollocatedWavePropConvectiveOperator
     if (input_db)
     {
         if (input_db->keyExists("bdry_extrap_type")) d_bdry_extrap_type = input_db->getString("bdry_extrap_type");
+        if (input_db->keyExists("use_vectorized_kernel"))
+            d_use_vectorized_kernel = input_db->getBool("use_vectorized_kernel");
     }
 
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -210,41 +214,58 @@ INSCollocatedWavePropConvectiveOperator::applyConvectiveOperator(const int U_idx
             // Do differencing
             for (int d = 0; d < NDIM; ++d)
             {
+                if (d_use_vectorized_kernel)
+                {
+                    std::array<const double*, NDIM> U_adv_ptrs;
+                    for (unsigned int k = 0; k < NDIM; ++k) U_adv_ptrs[k] = U_sp_data->getPointer(k);
+                    WavePropConvectiveFunctions::computeWavePropConvectiveDerivative(U_data->getPointer(d),
+                                                                                     U_gcw.max(),
+                                                                                     U_adv_ptrs,
+                                                                                     U_sp_gcw.max(),
+                                                                                     N_data->getPointer(d),
+                                                                                     N_gcw.max(),
+                                                                                     1,
+                                                                                     patch_box,
+                                                                                     dx);
+                }
+                else
+                {
 #if (NDIM == 2)
-                adv_diff_wp_convective_op2d_(U_data->getPointer(d),
-                                             U_gcw.max(),
-                                             U_sp_data->getPointer(0),
-                                             U_sp_data->getPointer(1),
-                                             U_sp_gcw.max(),
-                                             N_data->getPointer(d),
-                                             N_gcw.max(),
-                                             1,
-                                             patch_lower(0),
-                                             patch_lower(1),
-                                             patch_upper(0),
-                                             patch_upper(1),
-                                             dx,
-                                             d_k);
+                    adv_diff_wp_convective_op2d_(U_data->getPointer(d),
+                                                 U_gcw.max(),
+                                                 U_sp_data->getPointer(0),
+                                                 U_sp_data->getPointer(1),
+                                                 U_sp_gcw.max(),
+                                                 N_data->getPointer(d),
+                                                 N_gcw.max(),
+                                                 1,
+                                                 patch_lower(0),
+                                                 patch_lower(1),
+                                                 patch_upper(0),
+                                                 patch_upper(1),
+                                                 dx,
+                                                 d_k);
 #endif
 #if (NDIM == 3)
-                adv_diff_wp_convective_op3d_(U_data->getPointer(d),
-                                             U_gcw.max(),
-                                             U_sp_data->getPointer(0),
-                                             U_sp_data->getPointer(1),
-                                             U_sp_data->getPointer(2),
-                                             U_sp_gcw.max(),
-                                             N_data->getPointer(d),
-                                             N_gcw.max(),
-                                             1,
-                                             patch_lower(0),
-                                             patch_lower(1),
-                                             patch_lower(2),
-                                             patch_upper(0),
-                                             patch_upper(1),
-                                             patch_upper(2),
-                                             dx,
-                                             d_k);
+                    adv_diff_wp_convective_op3d_(U_data->getPointer(d),
+                                                 U_gcw.max(),
+                                                 U_sp_data->getPointer(0),
+                                                 U_sp_data->getPointer(1),
+                                                 U_sp_data->getPointer(2),
+                                                 U_sp_gcw.max(),
+                                                 N_data->getPointer(d),
+                                                 N_gcw.max(),
+                                                 1,
+                                                 patch_lower(0),
+                                                 patch_lower(1),
+                                                 patch_lower(2),
+                                                 patch_upper(0),
+                                                 patch_upper(1),
+                                                 patch_upper(2),
+                                                 dx,
+                                                 d_k);
 #endif
+                }
             }
         }
     }
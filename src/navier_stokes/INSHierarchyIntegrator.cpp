@@ -393,6 +393,24 @@ INSHierarchyIntegrator::getNumberOfCycles() const
     return num_cycles;
 } // getNumberOfCycles
 
+void
+INSHierarchyIntegrator::preprocessIntegrateHierarchy(const double current_time,
+                                                     const double new_time,
+                                                     const int num_cycles)
+{
+    HierarchyIntegrator::preprocessIntegrateHierarchy(current_time, new_time, num_cycles);
+    d_stable_dt_is_current = false;
+    return;
+} // preprocessIntegrateHierarchy
+
+void
+INSHierarchyIntegrator::regridHierarchy()
+{
+    HierarchyIntegrator::regridHierarchy();
+    d_stable_dt_is_current = false;
+    return;
+} // regridHierarchy
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 INSHierarchyIntegrator::INSHierarchyIntegrator(std::string object_name,
@@ -487,11 +505,8 @@ double
 INSHierarchyIntegrator::getMaximumTimeStepSizeSpecialized()
 {
     double dt = HierarchyIntegrator::getMaximumTimeStepSizeSpecialized();
-    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        dt = std::min(dt, d_cfl_max * getStableTimestep(level));
-    }
+    if (!d_stable_dt_is_current) updateStableTimestep();
+    dt = std::min(dt, d_cfl_max * d_stable_dt);
     return dt;
 } // getMaximumTimeStepSizeSpecialized
 
@@ -508,6 +523,24 @@ INSHierarchyIntegrator::getStableTimestep(Pointer<PatchLevel<NDIM> > level) cons
     return stable_dt;
 } // getStableTimestep
 
+void
+INSHierarchyIntegrator::updateStableTimestep()
+{
+    double stable_dt = std::numeric_limits<double>::max();
+    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            stable_dt = std::min(stable_dt, getStableTimestep(patch));
+        }
+    }
+    d_stable_dt = SAMRAI_MPI::minReduction(stable_dt);
+    d_stable_dt_is_current = true;
+    return;
+} // updateStableTimestep
+
 void
 INSHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Database> db)
 {
@@ -26,6 +26,7 @@
 #include "ibamr/INSStaggeredVelocityBcCoef.h"
 #include "ibamr/StaggeredStokesBlockPreconditioner.h"
 #include "ibamr/StaggeredStokesFACPreconditioner.h"
+#include "ibamr/StaggeredStokesFACPreconditionerStrategy.h"
 #include "ibamr/StaggeredStokesPhysicalBoundaryHelper.h"
 #include "ibamr/StaggeredStokesSolver.h"
 #include "ibamr/StaggeredStokesSolverManager.h"
@@ -41,12 +42,18 @@
 #include "ibtk/CartSideDoubleRT0Refine.h"
 #include "ibtk/CartSideDoubleSpecializedLinearRefine.h"
 #include "ibtk/CartSideRobinPhysBdryOp.h"
+#include "ibtk/DiagnosticsCollector.h"
+#include "ibtk/FACPreconditioner.h"
+#include "ibtk/FACPreconditionerStrategy.h"
+#include "ibtk/GeneralSolver.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/KrylovLinearSolver.h"
 #include "ibtk/LinearSolver.h"
 #include "ibtk/NewtonKrylovSolver.h"
+#include "ibtk/PerformanceMonitor.h"
+#include "ibtk/PoissonFACPreconditionerStrategy.h"
 #include "ibtk/PoissonSolver.h"
 #include "ibtk/SCPoissonSolverManager.h"
 #include "ibtk/SideDataSynchronization.h"
@@ -353,6 +360,32 @@ static const std::string DATA_COARSEN_TYPE = "CUBIC_COARSEN";
 // interface ghost cells.
 static const bool CONSISTENT_TYPE_2_BDRY = false;
 
+// Set the range of levels to be reset by the next initialization of the FAC
+// preconditioner employed by the given solver, if it employs one.
+void
+set_fac_reset_levels(GeneralSolver* const solver, const int coarsest_ln, const int finest_ln)
+{
+    auto p_newton_solver = dynamic_cast<NewtonKrylovSolver*>(solver);
+    LinearSolver* p_solver =
+        p_newton_solver ? p_newton_solver->getLinearSolver().getPointer() : dynamic_cast<LinearSolver*>(solver);
+    while (auto p_krylov_solver = dynamic_cast<KrylovLinearSolver*>(p_solver))
+    {
+        p_solver = p_krylov_solver->getPreconditioner().getPointer();
+    }
+    auto p_fac_pc = dynamic_cast<FACPreconditioner*>(p_solver);
+    if (!p_fac_pc) return;
+    FACPreconditionerStrategy* const fac_strategy = p_fac_pc->getFACPreconditionerStrategy().getPointer();
+    if (auto p_poisson_strategy = dynamic_cast<PoissonFACPreconditionerStrategy*>(fac_strategy))
+    {
+        p_poisson_strategy->setResetLevels(coarsest_ln, finest_ln);
+    }
+    else if (auto p_stokes_strategy = dynamic_cast<StaggeredStokesFACPreconditionerStrategy*>(fac_strategy))
+    {
+        p_stokes_strategy->setResetLevels(coarsest_ln, finest_ln);
+    }
+    return;
+} // set_fac_reset_levels
+
 // Copy data from a side-centered variable to a face-centered variable.
 void
 copy_side_to_face(const int U_fc_idx, const int U_sc_idx, Pointer<PatchHierarchy<NDIM> > hierarchy)
@@ -542,6 +575,16 @@ INSStaggeredHierarchyIntegrator::INSStaggeredHierarchyIntegrator(std::string obj
     if (input_db->keyExists("explicitly_remove_nullspace"))
         d_explicitly_remove_nullspace = input_db->getBool("explicitly_remove_nullspace");
 
+    // Flag to determine whether we extrapolate the initial guess for the Stokes
+    // solver from previous time steps.
+    if (input_db->keyExists("extrapolate_initial_guess"))
+        d_extrapolate_initial_guess = input_db->getBool("extrapolate_initial_guess");
+
+    // Flag to determine whether we only reinitialize the levels of the FAC
+    // preconditioners that were reset by regridding.
+    if (input_db->keyExists("use_partial_solver_reinitialization"))
+        d_use_partial_solver_reinitialization = input_db->getBool("use_partial_solver_reinitialization");
+
     // Setup physical boundary conditions objects.
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_U_bc_coefs.resize(NDIM);
@@ -583,6 +626,11 @@ INSStaggeredHierarchyIntegrator::INSStaggeredHierarchyIntegrator(std::string obj
     d_F_var = INSHierarchyIntegrator::d_F_var;
     d_Q_var = INSHierarchyIntegrator::d_Q_var;
     d_N_old_var = new SideVariable<NDIM, double>(d_object_name + "::N_old");
+    if (d_extrapolate_initial_guess)
+    {
+        d_U_old_var = new SideVariable<NDIM, double>(d_object_name + "::U_old");
+        d_P_old_var = new CellVariable<NDIM, double>(d_object_name + "::P_old");
+    }
 
     d_U_cc_var = new CellVariable<NDIM, double>(d_object_name + "::U_cc", NDIM);
     d_F_cc_var = new CellVariable<NDIM, double>(d_object_name + "::F_cc", NDIM);
@@ -737,6 +785,7 @@ void
 INSStaggeredHierarchyIntegrator::setStokesSolverNeedsInit()
 {
     d_stokes_solver_needs_init = true;
+    d_solver_coarsest_reset_ln = 0;
     return;
 }
 
@@ -908,6 +957,24 @@ INSStaggeredHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHier
                      d_N_coarsen_type,
                      d_N_refine_type);
 
+    if (d_extrapolate_initial_guess)
+    {
+        registerVariable(d_U_old_current_idx,
+                         d_U_old_new_idx,
+                         d_U_old_scratch_idx,
+                         d_U_old_var,
+                         side_ghosts,
+                         d_U_coarsen_type,
+                         d_U_refine_type);
+        registerVariable(d_P_old_current_idx,
+                         d_P_old_new_idx,
+                         d_P_old_scratch_idx,
+                         d_P_old_var,
+                         cell_ghosts,
+                         d_P_coarsen_type,
+                         d_P_refine_type);
+    }
+
     // Register plot variables that are maintained by the
     // INSCollocatedHierarchyIntegrator.
     registerVariable(d_U_cc_idx, d_U_cc_var, no_ghosts, getCurrentContext());
@@ -1224,12 +1291,8 @@ INSStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(const double curre
     }
 
     // Allocate the scratch and new data.
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
-    }
+    allocatePatchData(d_scratch_data, current_time, coarsest_ln, finest_ln);
+    allocatePatchData(d_new_data, new_time, coarsest_ln, finest_ln);
 
     // Setup the operators and solvers.
     reinitializeOperatorsAndSolvers(current_time, new_time);
@@ -1292,6 +1355,19 @@ INSStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(const double curre
     // Set the initial guess.
     d_hier_sc_data_ops->copyData(d_U_new_idx, d_U_current_idx);
     d_hier_cc_data_ops->copyData(d_P_new_idx, d_P_current_idx);
+    if (d_extrapolate_initial_guess)
+    {
+        // Linearly extrapolate u(n+1) and p(n+1/2) from the two most recent
+        // time steps, and store the current values for use in the next step.
+        if (getIntegratorStep() > 0 && !d_dt_previous.empty())
+        {
+            const double omega = dt / d_dt_previous[0];
+            d_hier_sc_data_ops->linearSum(d_U_new_idx, 1.0 + omega, d_U_current_idx, -omega, d_U_old_current_idx);
+            d_hier_cc_data_ops->linearSum(d_P_new_idx, 1.0 + omega, d_P_current_idx, -omega, d_P_old_current_idx);
+        }
+        d_hier_sc_data_ops->copyData(d_U_old_new_idx, d_U_current_idx);
+        d_hier_cc_data_ops->copyData(d_P_old_new_idx, d_P_current_idx);
+    }
 
     // Set up inhomogeneous BCs.
     d_stokes_solver->setHomogeneousBc(false);
@@ -1396,6 +1472,7 @@ INSStaggeredHierarchyIntegrator::integrateHierarchy(const double current_time,
                                                     const double new_time,
                                                     const int cycle_num)
 {
+    PerformanceMonitor::ScopedRegion region("INSStaggeredHierarchyIntegrator::integrateHierarchy");
     INSHierarchyIntegrator::integrateHierarchy(current_time, new_time, cycle_num);
 
     // Check to make sure that the number of cycles is what we expect it to be.
@@ -1518,9 +1595,11 @@ INSStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(const double curr
                 cfl_max = std::max(cfl_max, u_max * dt / dx_min);
             }
         }
-        cfl_max = SAMRAI_MPI::maxReduction(cfl_max);
-        if (d_enable_logging)
-            plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl_max << "\n";
+        getDiagnosticsCollector().addContribution(
+            d_object_name + "::CFL", cfl_max, DiagnosticsCollector::MAX, [this](const double cfl) {
+                if (d_enable_logging)
+                    plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl << "\n";
+            });
     }
 
     // Compute max |Omega|_2.
@@ -2233,6 +2312,10 @@ INSStaggeredHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
     // Indicate that vectors and solvers need to be re-initialized.
     d_coarsest_reset_ln = coarsest_level;
     d_finest_reset_ln = finest_level;
+    d_solver_coarsest_reset_ln = d_solver_coarsest_reset_ln == -1 ?
+                                     coarsest_level :
+                                     std::min(d_solver_coarsest_reset_ln, coarsest_level);
+    d_solver_finest_reset_ln = finest_hier_level;
     d_vectors_need_init = true;
     d_convective_op_needs_init = true;
     d_velocity_solver_needs_init = true;
@@ -2383,6 +2466,7 @@ INSStaggeredHierarchyIntegrator::setupPlotDataSpecialized()
 void
 INSStaggeredHierarchyIntegrator::regridProjection()
 {
+    PerformanceMonitor::ScopedRegion region("INSStaggeredHierarchyIntegrator::regridProjection");
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
     const int wgt_cc_idx = d_hier_math_ops->getCellWeightPatchDescriptorIndex();
@@ -2551,6 +2635,12 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
         d_stokes_solver_needs_init = true;
     }
 
+    // If only finer levels of the hierarchy have been reset since the solvers
+    // were last initialized, the FAC preconditioners only need to reset those
+    // levels and can keep their coarse level solvers.
+    const bool reset_solver_levels_only =
+        d_use_partial_solver_reinitialization && !dt_change && d_solver_coarsest_reset_ln > 0;
+
     // Setup solver vectors.
     const bool has_velocity_nullspace = d_normalize_velocity && MathUtilities<double>::equalEps(rho, 0.0);
     const bool has_pressure_nullspace = d_normalize_pressure;
@@ -2698,6 +2788,11 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
                 p_velocity_solver->setInitialGuessNonzero(false);
                 if (has_velocity_nullspace) p_velocity_solver->setNullspace(false, d_U_nul_vecs);
             }
+            if (reset_solver_levels_only)
+            {
+                set_fac_reset_levels(
+                    d_velocity_solver.getPointer(), d_solver_coarsest_reset_ln, d_solver_finest_reset_ln);
+            }
             d_velocity_solver->initializeSolverState(*d_U_scratch_vec, *d_U_rhs_vec);
             d_velocity_solver_needs_init = false;
         }
@@ -2722,6 +2817,11 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
                 p_pressure_solver->setInitialGuessNonzero(false);
                 if (has_pressure_nullspace) p_pressure_solver->setNullspace(true);
             }
+            if (reset_solver_levels_only)
+            {
+                set_fac_reset_levels(
+                    d_pressure_solver.getPointer(), d_solver_coarsest_reset_ln, d_solver_finest_reset_ln);
+            }
             d_pressure_solver->initializeSolverState(*d_P_scratch_vec, *d_P_rhs_vec);
             d_pressure_solver_needs_init = false;
         }
@@ -2796,9 +2896,15 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
             if (has_velocity_nullspace || has_pressure_nullspace)
                 p_stokes_linear_solver->setNullspace(false, d_nul_vecs);
         }
+        if (reset_solver_levels_only)
+        {
+            set_fac_reset_levels(d_stokes_solver.getPointer(), d_solver_coarsest_reset_ln, d_solver_finest_reset_ln);
+        }
         d_stokes_solver->initializeSolverState(*d_sol_vec, *d_rhs_vec);
         d_stokes_solver_needs_init = false;
     }
+    d_solver_coarsest_reset_ln = -1;
+    d_solver_finest_reset_ln = -1;
     return;
 } // reinitializeOperatorsAndSolvers
 
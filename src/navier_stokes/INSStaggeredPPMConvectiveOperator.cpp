@@ -46,6 +46,7 @@
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
 #include <array>
 #include <ostream>
 #include <string>
@@ -524,13 +525,6 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
     TBOX_ASSERT(U_idx == d_u_idx);
 #endif
 
-    // Allocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_U_scratch_idx);
-    }
-
     // Fill ghost cell values for all components.
     static const bool homogeneous_bc = false;
     using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
@@ -575,8 +569,10 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+                U_adv_data[axis] =
+                    d_scratch_data_pool.getPatchData<FaceData<NDIM, double> >(side_boxes[axis], 1, ghosts);
+                U_half_data[axis] =
+                    d_scratch_data_pool.getPatchData<FaceData<NDIM, double> >(side_boxes[axis], 1, ghosts);
             }
 #if (NDIM == 2)
             NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
@@ -654,20 +650,25 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                           U_adv_data[2]->getPointer(1),
                                           U_adv_data[2]->getPointer(2));
 #endif
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
-            {
-                Pointer<SideData<NDIM, double> > dU_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_L_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_R_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_scratch1_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+            // Scratch data used for the Godunov extrapolation.  Each axis uses
+            // only the corresponding data component.
+            const Box<NDIM>& U_box = U_data->getBox();
+            const int U_depth = U_data->getDepth();
+            const IntVector<NDIM>& U_ghosts = U_data->getGhostCellWidth();
+            Pointer<SideData<NDIM, double> > dU_data =
+                d_scratch_data_pool.getPatchData<SideData<NDIM, double> >(U_box, U_depth, U_ghosts);
+            Pointer<SideData<NDIM, double> > U_L_data =
+                d_scratch_data_pool.getPatchData<SideData<NDIM, double> >(U_box, U_depth, U_ghosts);
+            Pointer<SideData<NDIM, double> > U_R_data =
+                d_scratch_data_pool.getPatchData<SideData<NDIM, double> >(U_box, U_depth, U_ghosts);
+            Pointer<SideData<NDIM, double> > U_scratch1_data =
+                d_scratch_data_pool.getPatchData<SideData<NDIM, double> >(U_box, U_depth, U_ghosts);
 #if (NDIM == 3)
-                Pointer<SideData<NDIM, double> > U_scratch2_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+            Pointer<SideData<NDIM, double> > U_scratch2_data =
+                d_scratch_data_pool.getPatchData<SideData<NDIM, double> >(U_box, U_depth, U_ghosts);
 #endif
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
 #if (NDIM == 2)
                 GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
                                        side_boxes[axis].upper(0),
@@ -948,16 +949,10 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                   "SKEW_SYMMETRIC\n");
                 }
             }
+            d_scratch_data_pool.restorePatchData();
         }
     }
 
-    // Deallocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_U_scratch_idx);
-    }
-
     IBAMR_TIMER_STOP(t_apply_convective_operator);
     return;
 } // applyConvectiveOperator
@@ -1002,6 +997,13 @@ INSStaggeredPPMConvectiveOperator::initializeOperatorState(const SAMRAIVectorRea
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_bc_helper->cacheBcCoefData(d_bc_coefs, d_solution_time, d_hierarchy);
 
+    // Allocate scratch data.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(d_U_scratch_idx)) level->allocatePatchData(d_U_scratch_idx);
+    }
+
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_operator_state);
@@ -1019,6 +1021,16 @@ INSStaggeredPPMConvectiveOperator::deallocateOperatorState()
     d_hier_bdry_fill.setNull();
     d_bc_helper.setNull();
 
+    // Deallocate the pooled scratch data.
+    d_scratch_data_pool.clear();
+
+    // Deallocate scratch data.
+    for (int ln = d_coarsest_ln; ln <= std::min(d_finest_ln, d_hierarchy->getFinestLevelNumber()); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_U_scratch_idx)) level->deallocatePatchData(d_U_scratch_idx);
+    }
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
@@ -53,6 +53,7 @@
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <ostream>
@@ -563,13 +564,6 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
     TBOX_ASSERT(U_idx == d_u_idx);
 #endif
 
-    // Allocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_U_scratch_idx);
-    }
-
     // Fill ghost cell values for all components.
     static const bool homogeneous_bc = false;
     using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
@@ -610,8 +604,8 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
             const IntVector<NDIM>& patch_upper = patch_box.upper();
 
             Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(N_idx);
-            Pointer<SideData<NDIM, double> > N_upwind_data =
-                new SideData<NDIM, double>(N_data->getBox(), N_data->getDepth(), N_data->getGhostCellWidth());
+            Pointer<SideData<NDIM, double> > N_upwind_data = d_scratch_data_pool.getPatchData<SideData<NDIM, double> >(
+                N_data->getBox(), N_data->getDepth(), N_data->getGhostCellWidth());
             Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_U_scratch_idx);
 
             const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
@@ -622,9 +616,12 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_upwind_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+                U_adv_data[axis] =
+                    d_scratch_data_pool.getPatchData<FaceData<NDIM, double> >(side_boxes[axis], 1, ghosts);
+                U_half_data[axis] =
+                    d_scratch_data_pool.getPatchData<FaceData<NDIM, double> >(side_boxes[axis], 1, ghosts);
+                U_half_upwind_data[axis] =
+                    d_scratch_data_pool.getPatchData<FaceData<NDIM, double> >(side_boxes[axis], 1, ghosts);
             }
 
 // Interpolate the staggered-grid velocity field onto the faces of
@@ -877,20 +874,25 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
             }
 
             // Compute the xsPPM7 discretization.
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
-            {
-                Pointer<SideData<NDIM, double> > dU_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_L_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_R_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_scratch1_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+            // Each axis uses only the corresponding component of the scratch
+            // data used for the Godunov extrapolation.
+            const Box<NDIM>& U_box = U_data->getBox();
+            const int U_depth = U_data->getDepth();
+            const IntVector<NDIM>& U_ghosts = U_data->getGhostCellWidth();
+            Pointer<SideData<NDIM, double> > dU_data =
+                d_scratch_data_pool.getPatchData<SideData<NDIM, double> >(U_box, U_depth, U_ghosts);
+            Pointer<SideData<NDIM, double> > U_L_data =
+                d_scratch_data_pool.getPatchData<SideData<NDIM, double> >(U_box, U_depth, U_ghosts);
+            Pointer<SideData<NDIM, double> > U_R_data =
+                d_scratch_data_pool.getPatchData<SideData<NDIM, double> >(U_box, U_depth, U_ghosts);
+            Pointer<SideData<NDIM, double> > U_scratch1_data =
+                d_scratch_data_pool.getPatchData<SideData<NDIM, double> >(U_box, U_depth, U_ghosts);
 #if (NDIM == 3)
-                Pointer<SideData<NDIM, double> > U_scratch2_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+            Pointer<SideData<NDIM, double> > U_scratch2_data =
+                d_scratch_data_pool.getPatchData<SideData<NDIM, double> >(U_box, U_depth, U_ghosts);
 #endif
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
 #if (NDIM == 2)
                 GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
                                        side_boxes[axis].upper(0),
@@ -1196,8 +1198,8 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
             }
             if (patch_geom->getTouchesRegularBoundary())
             {
-                Pointer<SideData<NDIM, double> > N_PPM_data =
-                    new SideData<NDIM, double>(N_data->getBox(), N_data->getDepth(), N_data->getGhostCellWidth());
+                Pointer<SideData<NDIM, double> > N_PPM_data = d_scratch_data_pool.getPatchData<SideData<NDIM, double> >(
+                    N_data->getBox(), N_data->getDepth(), N_data->getGhostCellWidth());
                 N_PPM_data->copy(*N_data);
                 for (unsigned int location_index = 0; location_index < 2 * NDIM; ++location_index)
                 {
@@ -1234,16 +1236,10 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                     }
                 }
             }
+            d_scratch_data_pool.restorePatchData();
         }
     }
 
-    // Deallocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_U_scratch_idx);
-    }
-
     IBAMR_TIMER_STOP(t_apply_convective_operator);
     return;
 } // applyConvectiveOperator
@@ -1288,6 +1284,13 @@ INSStaggeredStabilizedPPMConvectiveOperator::initializeOperatorState(const SAMRA
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_bc_helper->cacheBcCoefData(d_bc_coefs, d_solution_time, d_hierarchy);
 
+    // Allocate scratch data.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(d_U_scratch_idx)) level->allocatePatchData(d_U_scratch_idx);
+    }
+
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_operator_state);
@@ -1305,6 +1308,16 @@ INSStaggeredStabilizedPPMConvectiveOperator::deallocateOperatorState()
     d_hier_bdry_fill.setNull();
     d_bc_helper.setNull();
 
+    // Deallocate the pooled scratch data.
+    d_scratch_data_pool.clear();
+
+    // Deallocate scratch data.
+    for (int ln = d_coarsest_ln; ln <= std::min(d_finest_ln, d_hierarchy->getFinestLevelNumber()); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_U_scratch_idx)) level->deallocatePatchData(d_U_scratch_idx);
+    }
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
@@ -61,6 +61,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -150,13 +151,41 @@ compute_tangential_extension(const Box<NDIM>& box, const int data_axis)
 } // compute_tangential_extension
 
 void
-genrandn(ArrayData<NDIM, double>& data, const Box<NDIM>& box)
+genrandn(ArrayData<NDIM, double>& data,
+         const Box<NDIM>& box,
+         const std::uint32_t* const key = nullptr,
+         const std::uint32_t stream = 0)
 {
+    if (!key)
+    {
+        for (int depth = 0; depth < data.getDepth(); ++depth)
+        {
+            for (Box<NDIM>::Iterator i(box); i; i++)
+            {
+                RNG::genrandn(&data(i(), depth));
+            }
+        }
+        return;
+    }
+
+    // Each row of values in the first coordinate direction is generated by
+    // one call to the counter-based generator.  The counter is determined by
+    // the (level-global) index of the first value in the row, so that the
+    // generated values do not depend on the partitioning of the level.
+    Box<NDIM> row_box = box;
+    row_box.upper(0) = row_box.lower(0);
+    const int row_length = box.numberCells(0);
     for (int depth = 0; depth < data.getDepth(); ++depth)
     {
-        for (Box<NDIM>::Iterator i(box); i; i++)
+        for (Box<NDIM>::Iterator i(row_box); i; i++)
         {
-            RNG::genrandn(&data(i(), depth));
+            const hier::Index<NDIM>& idx = i();
+            std::uint32_t counter[4] = { static_cast<std::uint32_t>(idx(0)),
+                                         static_cast<std::uint32_t>(idx(1)),
+                                         static_cast<std::uint32_t>(NDIM > 2 ? idx(NDIM - 1) : 0),
+                                         stream * static_cast<std::uint32_t>(data.getDepth()) +
+                                             static_cast<std::uint32_t>(depth) };
+            RNG::genrandn(&data(idx, depth), row_length, counter, key);
         }
     }
     return;
@@ -194,6 +223,10 @@ INSStaggeredStochasticForcing::INSStaggeredStochasticForcing(std::string object_
             d_velocity_bc_scaling = input_db->getDouble("velocity_bc_scaling");
         if (input_db->keyExists("traction_bc_scaling"))
             d_traction_bc_scaling = input_db->getDouble("traction_bc_scaling");
+        if (input_db->keyExists("use_counter_based_rng"))
+            d_use_counter_based_rng = input_db->getBool("use_counter_based_rng");
+        if (input_db->keyExists("counter_based_rng_seed"))
+            d_counter_based_rng_seed = input_db->getInteger("counter_based_rng_seed");
     }
 
     // Setup variables and variable context objects.
@@ -266,25 +299,41 @@ INSStaggeredStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
         // Generate random components.
         if (cycle_num == 0)
         {
+            // If the counter-based generator is used, the generated values are
+            // determined by the time step number, the level number, the index
+            // of the set of random values, the data component, and the level-global
+            // index of each value.
+            const std::uint32_t key[2] = { static_cast<std::uint32_t>(d_fluid_solver->getIntegratorStep()),
+                                           static_cast<std::uint32_t>(d_counter_based_rng_seed) };
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
                 {
+                    const auto stream = static_cast<std::uint32_t>((level_num * d_num_rand_vals + k) * (NDIM + 1));
                     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_num);
                     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
                     {
                         Pointer<Patch<NDIM> > patch = level->getPatch(p());
                         Pointer<CellData<NDIM, double> > W_cc_data = patch->getPatchData(d_W_cc_idxs[k]);
-                        genrandn(W_cc_data->getArrayData(), W_cc_data->getBox());
+                        genrandn(W_cc_data->getArrayData(),
+                                 W_cc_data->getBox(),
+                                 d_use_counter_based_rng ? key : nullptr,
+                                 stream);
 #if (NDIM == 2)
                         Pointer<NodeData<NDIM, double> > W_nc_data = patch->getPatchData(d_W_nc_idxs[k]);
-                        genrandn(W_nc_data->getArrayData(), NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox()));
+                        genrandn(W_nc_data->getArrayData(),
+                                 NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox()),
+                                 d_use_counter_based_rng ? key : nullptr,
+                                 stream + 1);
 #endif
 #if (NDIM == 3)
                         Pointer<EdgeData<NDIM, double> > W_ec_data = patch->getPatchData(d_W_ec_idxs[k]);
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            genrandn(W_ec_data->getArrayData(d), EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d));
+                            genrandn(W_ec_data->getArrayData(d),
+                                     EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d),
+                                     d_use_counter_based_rng ? key : nullptr,
+                                     stream + 1 + d);
                         }
 #endif
                     }
@@ -16,6 +16,7 @@
 #include "ibamr/ConvectiveOperator.h"
 #include "ibamr/INSStaggeredWavePropConvectiveOperator.h"
 #include "ibamr/StaggeredStokesPhysicalBoundaryHelper.h"
+#include "ibamr/WavePropConvectiveFunctions.h"
 #include "ibamr/ibamr_enums.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
@@ -42,6 +43,7 @@
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
 #include <array>
 #include <ostream>
 #include <string>
@@ -195,6 +197,8 @@ INSStaggeredWavePropConvectiveOperator::INSStaggeredWavePropConvectiveOperator(
     if (input_db)
     {
         if (input_db->keyExists("bdry_extrap_type")) d_bdry_extrap_type = input_db->getString("bdry_extrap_type");
+        if (input_db->keyExists("use_vectorized_kernel"))
+            d_use_vectorized_kernel = input_db->getBool("use_vectorized_kernel");
     }
 
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -237,13 +241,6 @@ INSStaggeredWavePropConvectiveOperator::applyConvectiveOperator(const int U_idx,
     TBOX_ASSERT(U_idx == d_u_idx);
 #endif
 
-    // Allocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_U_scratch_idx);
-    }
-
     // Fill ghost cell values for all components.
     HierarchyMathOps hier_math_ops("HierarchyMathOps", d_hierarchy);
     static const bool homogeneous_bc = false;
@@ -370,52 +367,63 @@ INSStaggeredWavePropConvectiveOperator::applyConvectiveOperator(const int U_idx,
             // Do differencing
             for (int axis = 0; axis < NDIM; ++axis)
             {
+                if (d_use_vectorized_kernel)
+                {
+                    std::array<const double*, NDIM> U_adv_ptrs;
+                    for (unsigned int k = 0; k < NDIM; ++k) U_adv_ptrs[k] = U_adv_data[axis]->getPointer(k);
+                    WavePropConvectiveFunctions::computeWavePropConvectiveDerivative(
+                        U_data->getPointer(axis),
+                        U_gcw.max(),
+                        U_adv_ptrs,
+                        U_adv_data[axis]->getGhostCellWidth().max(),
+                        N_data->getPointer(axis),
+                        N_gcw.max(),
+                        1,
+                        side_boxes[axis],
+                        dx);
+                }
+                else
+                {
 #if (NDIM == 2)
-                adv_diff_wp_convective_op2d_(U_data->getPointer(axis),
-                                             U_gcw.max(),
-                                             U_adv_data[axis]->getPointer(0),
-                                             U_adv_data[axis]->getPointer(1),
-                                             U_adv_data[axis]->getGhostCellWidth().max(),
-                                             N_data->getPointer(axis),
-                                             N_gcw.max(),
-                                             1,
-                                             side_boxes[axis].lower(0),
-                                             side_boxes[axis].lower(1),
-                                             side_boxes[axis].upper(0),
-                                             side_boxes[axis].upper(1),
-                                             dx,
-                                             d_k);
+                    adv_diff_wp_convective_op2d_(U_data->getPointer(axis),
+                                                 U_gcw.max(),
+                                                 U_adv_data[axis]->getPointer(0),
+                                                 U_adv_data[axis]->getPointer(1),
+                                                 U_adv_data[axis]->getGhostCellWidth().max(),
+                                                 N_data->getPointer(axis),
+                                                 N_gcw.max(),
+                                                 1,
+                                                 side_boxes[axis].lower(0),
+                                                 side_boxes[axis].lower(1),
+                                                 side_boxes[axis].upper(0),
+                                                 side_boxes[axis].upper(1),
+                                                 dx,
+                                                 d_k);
 #endif
 #if (NDIM == 3)
-                adv_diff_wp_convective_op3d_(U_data->getPointer(axis),
-                                             U_gcw.max(),
-                                             U_adv_data[axis]->getPointer(0),
-                                             U_adv_data[axis]->getPointer(1),
-                                             U_adv_data[axis]->getPointer(2),
-                                             U_adv_data[axis]->getGhostCellWidth().max(),
-                                             N_data->getPointer(axis),
-                                             N_gcw.max(),
-                                             1,
-                                             side_boxes[axis].lower(0),
-                                             side_boxes[axis].lower(1),
-                                             side_boxes[axis].lower(2),
-                                             side_boxes[axis].upper(0),
-                                             side_boxes[axis].upper(1),
-                                             side_boxes[axis].upper(2),
-                                             dx,
-                                             d_k);
+                    adv_diff_wp_convective_op3d_(U_data->getPointer(axis),
+                                                 U_gcw.max(),
+                                                 U_adv_data[axis]->getPointer(0),
+                                                 U_adv_data[axis]->getPointer(1),
+                                                 U_adv_data[axis]->getPointer(2),
+                                                 U_adv_data[axis]->getGhostCellWidth().max(),
+                                                 N_data->getPointer(axis),
+                                                 N_gcw.max(),
+                                                 1,
+                                                 side_boxes[axis].lower(0),
+                                                 side_boxes[axis].lower(1),
+                                                 side_boxes[axis].lower(2),
+                                                 side_boxes[axis].upper(0),
+                                                 side_boxes[axis].upper(1),
+                                                 side_boxes[axis].upper(2),
+                                                 dx,
+                                                 d_k);
 #endif
+                }
             }
         }
     }
 
-    // Deallocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_U_scratch_idx);
-    }
-
     return;
 } // applyConvectiveOperator
 
@@ -457,6 +465,13 @@ INSStaggeredWavePropConvectiveOperator::initializeOperatorState(const SAMRAIVect
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_bc_helper->cacheBcCoefData(d_bc_coefs, d_solution_time, d_hierarchy);
 
+    // Allocate scratch data.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(d_U_scratch_idx)) level->allocatePatchData(d_U_scratch_idx);
+    }
+
     d_is_initialized = true;
 
     return;
@@ -471,6 +486,13 @@ INSStaggeredWavePropConvectiveOperator::deallocateOperatorState()
     d_hier_bdry_fill.setNull();
     d_bc_helper.setNull();
 
+    // Deallocate scratch data.
+    for (int ln = d_coarsest_ln; ln <= std::min(d_finest_ln, d_hierarchy->getFinestLevelNumber()); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_U_scratch_idx)) level->deallocatePatchData(d_U_scratch_idx);
+    }
+
     d_is_initialized = false;
 
     return;
@@ -284,50 +284,42 @@ INSVCStaggeredConservativeHierarchyIntegrator::preprocessIntegrateHierarchy(cons
             mu_current_idx = d_mu_current_idx;
         }
 
-        d_hier_cc_data_ops->copyData(d_mu_scratch_idx,
-                                     mu_current_idx,
-                                     /*interior_only*/ true);
-        d_mu_bdry_bc_fill_op->fillData(current_time);
-
-        // Interpolate onto node or edge centers
-        if (d_mu_vc_interp_type == VC_AVERAGE_INTERP)
-        {
-            d_hier_math_ops->interp(d_mu_interp_idx,
-                                    d_mu_interp_var,
-                                    /*dst_ghost_interp*/ true,
-                                    d_mu_scratch_idx,
-                                    d_mu_var,
-                                    d_no_fill_op,
-                                    current_time);
-        }
-        else if (d_mu_vc_interp_type == VC_HARMONIC_INTERP)
-        {
-            d_hier_math_ops->harmonic_interp(d_mu_interp_idx,
-                                             d_mu_interp_var,
-                                             /*dst_ghost_interp*/ true,
-                                             d_mu_scratch_idx,
-                                             d_mu_var,
-                                             d_no_fill_op,
-                                             current_time);
-        }
-        else
+        if (!reuseStoredViscosity(mu_current_idx))
         {
-            TBOX_ERROR("this statement should not be reached");
-        }
+            d_hier_cc_data_ops->copyData(d_mu_scratch_idx,
+                                         mu_current_idx,
+                                         /*interior_only*/ true);
+            d_mu_bdry_bc_fill_op->fillData(current_time);
 
-        // Store the viscosities for later use
-        d_hier_cc_data_ops->copyData(d_mu_linear_op_idx,
-                                     d_mu_scratch_idx,
-                                     /*interior_only*/ false);
-#if (NDIM == 2)
-        d_hier_nc_data_ops->copyData(d_mu_interp_linear_op_idx,
-                                     d_mu_interp_idx,
-                                     /*interior_only*/ false);
-#elif (NDIM == 3)
-        d_hier_ec_data_ops->copyData(d_mu_interp_linear_op_idx,
-                                     d_mu_interp_idx,
-                                     /*interior_only*/ false);
-#endif
+            // Interpolate onto node or edge centers
+            if (d_mu_vc_interp_type == VC_AVERAGE_INTERP)
+            {
+                d_hier_math_ops->interp(d_mu_interp_idx,
+                                        d_mu_interp_var,
+                                        /*dst_ghost_interp*/ true,
+                                        d_mu_scratch_idx,
+                                        d_mu_var,
+                                        d_no_fill_op,
+                                        current_time);
+            }
+            else if (d_mu_vc_interp_type == VC_HARMONIC_INTERP)
+            {
+                d_hier_math_ops->harmonic_interp(d_mu_interp_idx,
+                                                 d_mu_interp_var,
+                                                 /*dst_ghost_interp*/ true,
+                                                 d_mu_scratch_idx,
+                                                 d_mu_var,
+                                                 d_no_fill_op,
+                                                 current_time);
+            }
+            else
+            {
+                TBOX_ERROR("this statement should not be reached");
+            }
+
+            // Store the viscosities for later use
+            storeViscosity();
+        }
     }
 
     // Allocate solver vectors.
@@ -440,8 +432,7 @@ INSVCStaggeredConservativeHierarchyIntegrator::preprocessIntegrateHierarchy(cons
                                  /*interior_only*/ false);
 
     // Set the initial guess.
-    d_hier_sc_data_ops->copyData(d_U_new_idx, d_U_current_idx);
-    d_hier_cc_data_ops->copyData(d_P_new_idx, d_P_current_idx);
+    setupInitialGuess(current_time, new_time);
 
     // Set up inhomogeneous BCs.
     d_stokes_solver->setHomogeneousBc(false);
@@ -578,50 +569,42 @@ INSVCStaggeredConservativeHierarchyIntegrator::integrateHierarchy(const double c
         {
             mu_new_idx = d_mu_new_idx;
         }
-        d_hier_cc_data_ops->copyData(d_mu_scratch_idx,
-                                     mu_new_idx,
-                                     /*interior_only*/ true);
-        d_mu_bdry_bc_fill_op->fillData(new_time);
-
-        // Interpolate onto node or edge centers
-        if (d_mu_vc_interp_type == VC_AVERAGE_INTERP)
-        {
-            d_hier_math_ops->interp(d_mu_interp_idx,
-                                    d_mu_interp_var,
-                                    /*dst_ghost_interp*/ true,
-                                    d_mu_scratch_idx,
-                                    d_mu_var,
-                                    d_no_fill_op,
-                                    new_time);
-        }
-        else if (d_mu_vc_interp_type == VC_HARMONIC_INTERP)
-        {
-            d_hier_math_ops->harmonic_interp(d_mu_interp_idx,
-                                             d_mu_interp_var,
-                                             /*dst_ghost_interp*/ true,
-                                             d_mu_scratch_idx,
-                                             d_mu_var,
-                                             d_no_fill_op,
-                                             new_time);
-        }
-        else
+        if (!reuseStoredViscosity(mu_new_idx))
         {
-            TBOX_ERROR("this statement should not be reached");
-        }
+            d_hier_cc_data_ops->copyData(d_mu_scratch_idx,
+                                         mu_new_idx,
+                                         /*interior_only*/ true);
+            d_mu_bdry_bc_fill_op->fillData(new_time);
 
-        // Store the viscosities for later use
-        d_hier_cc_data_ops->copyData(d_mu_linear_op_idx,
-                                     d_mu_scratch_idx,
-                                     /*interior_only*/ false);
-#if (NDIM == 2)
-        d_hier_nc_data_ops->copyData(d_mu_interp_linear_op_idx,
-                                     d_mu_interp_idx,
-                                     /*interior_only*/ false);
-#elif (NDIM == 3)
-        d_hier_ec_data_ops->copyData(d_mu_interp_linear_op_idx,
-                                     d_mu_interp_idx,
-                                     /*interior_only*/ false);
-#endif
+            // Interpolate onto node or edge centers
+            if (d_mu_vc_interp_type == VC_AVERAGE_INTERP)
+            {
+                d_hier_math_ops->interp(d_mu_interp_idx,
+                                        d_mu_interp_var,
+                                        /*dst_ghost_interp*/ true,
+                                        d_mu_scratch_idx,
+                                        d_mu_var,
+                                        d_no_fill_op,
+                                        new_time);
+            }
+            else if (d_mu_vc_interp_type == VC_HARMONIC_INTERP)
+            {
+                d_hier_math_ops->harmonic_interp(d_mu_interp_idx,
+                                                 d_mu_interp_var,
+                                                 /*dst_ghost_interp*/ true,
+                                                 d_mu_scratch_idx,
+                                                 d_mu_var,
+                                                 d_no_fill_op,
+                                                 new_time);
+            }
+            else
+            {
+                TBOX_ERROR("this statement should not be reached");
+            }
+
+            // Store the viscosities for later use
+            storeViscosity();
+        }
     }
 
     // In the special case of a conservative discretization form, the updated
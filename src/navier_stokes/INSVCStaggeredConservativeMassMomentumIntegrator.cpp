@@ -24,7 +24,9 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/PatchTileIterator.h"
 
+#include "ArrayData.h"
 #include "BasePatchHierarchy.h"
 #include "BoundaryBox.h"
 #include "Box.h"
@@ -1009,6 +1011,10 @@ INSVCStaggeredConservativeMassMomentumIntegrator::INSVCStaggeredConservativeMass
         {
             d_enable_logging = input_db->getBool("enable_logging");
         }
+        if (input_db->keyExists("use_fused_kernel"))
+        {
+            d_use_fused_kernel = input_db->getBool("use_fused_kernel");
+        }
     }
 
     switch (d_velocity_convective_limiter)
@@ -1408,10 +1414,17 @@ INSVCStaggeredConservativeMassMomentumIntegrator::integrate(double dt)
                 for (unsigned int axis = 0; axis < NDIM; ++axis)
                 {
                     side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                    V_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                    V_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                    R_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                    P_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+                    V_adv_data[axis] =
+                        d_face_scratch_data_pool.getPatchData<FaceData<NDIM, double> >(side_boxes[axis], 1, ghosts);
+                    V_half_data[axis] =
+                        d_face_scratch_data_pool.getPatchData<FaceData<NDIM, double> >(side_boxes[axis], 1, ghosts);
+                    R_half_data[axis] =
+                        d_face_scratch_data_pool.getPatchData<FaceData<NDIM, double> >(side_boxes[axis], 1, ghosts);
+                    if (!d_use_fused_kernel)
+                    {
+                        P_half_data[axis] = d_face_scratch_data_pool.getPatchData<FaceData<NDIM, double> >(
+                            side_boxes[axis], 1, ghosts);
+                    }
                 }
                 // Interpolate velocity components onto "faces" using simple averages.
                 computeAdvectionVelocity(V_adv_data, V_data, patch_lower, patch_upper, side_boxes);
@@ -1427,9 +1440,11 @@ INSVCStaggeredConservativeMassMomentumIntegrator::integrate(double dt)
 
                 // Compute the convective derivative with the penultimate density and
                 // velocity, if necessary
-                if ((d_density_time_stepping_type == FORWARD_EULER && step == 0) ||
+                const bool compute_convective_derivative =
+                    (d_density_time_stepping_type == FORWARD_EULER && step == 0) ||
                     (d_density_time_stepping_type == SSPRK2 && step == 1) ||
-                    (d_density_time_stepping_type == SSPRK3 && step == 2))
+                    (d_density_time_stepping_type == SSPRK3 && step == 2);
+                if (compute_convective_derivative)
                 {
                     interpolateSideQuantity(V_half_data,
                                             V_adv_data,
@@ -1438,7 +1453,9 @@ INSVCStaggeredConservativeMassMomentumIntegrator::integrate(double dt)
                                             patch_upper,
                                             side_boxes,
                                             d_velocity_convective_limiter);
-
+                }
+                if (compute_convective_derivative && !d_use_fused_kernel)
+                {
                     IBAMR_TIMER_START(t_apply_convective_operator);
 
                     computeConvectiveDerivative(
@@ -1479,21 +1496,50 @@ INSVCStaggeredConservativeMassMomentumIntegrator::integrate(double dt)
                 default:
                     TBOX_ERROR("This statement should not be reached");
                 }
-                computeDensityUpdate(R_new_data,
-                                     a0,
-                                     R_cur_data,
-                                     a1,
-                                     R_pre_data,
-                                     a2,
-                                     V_adv_data,
-                                     R_half_data,
-                                     R_src_data,
-                                     side_boxes,
-                                     dt,
-                                     dx);
+                if (d_use_fused_kernel)
+                {
+                    Pointer<SideData<NDIM, double> > N_fused_data;
+                    if (compute_convective_derivative)
+                    {
+                        N_fused_data = N_data;
+                        IBAMR_TIMER_START(t_apply_convective_operator);
+                    }
+                    computeConvectiveDerivativeAndDensityUpdate(N_fused_data,
+                                                                R_new_data,
+                                                                a0,
+                                                                R_cur_data,
+                                                                a1,
+                                                                R_pre_data,
+                                                                a2,
+                                                                V_adv_data,
+                                                                R_half_data,
+                                                                V_half_data,
+                                                                R_src_data,
+                                                                side_boxes,
+                                                                dt,
+                                                                dx);
+                    if (compute_convective_derivative) IBAMR_TIMER_STOP(t_apply_convective_operator);
+                }
+                else
+                {
+                    computeDensityUpdate(R_new_data,
+                                         a0,
+                                         R_cur_data,
+                                         a1,
+                                         R_pre_data,
+                                         a2,
+                                         V_adv_data,
+                                         R_half_data,
+                                         R_src_data,
+                                         side_boxes,
+                                         dt,
+                                         dx);
+                }
+                d_face_scratch_data_pool.restorePatchData();
             }
         }
     }
+    d_face_scratch_data_pool.clear();
 
     // Refill boundary values of newest density
     const double new_time = d_current_time + dt;
@@ -2639,6 +2685,148 @@ INSVCStaggeredConservativeMassMomentumIntegrator::computeDensityUpdate(
     }
 } // computeDensityUpdate
 
+void
+INSVCStaggeredConservativeMassMomentumIntegrator::computeConvectiveDerivativeAndDensityUpdate(
+    Pointer<SideData<NDIM, double> > N_data,
+    Pointer<SideData<NDIM, double> > R_data,
+    const double a0,
+    const Pointer<SideData<NDIM, double> > R0_data,
+    const double a1,
+    const Pointer<SideData<NDIM, double> > R1_data,
+    const double a2,
+    const std::array<Pointer<FaceData<NDIM, double> >, NDIM> U_adv_data,
+    const std::array<Pointer<FaceData<NDIM, double> >, NDIM> R_half_data,
+    const std::array<Pointer<FaceData<NDIM, double> >, NDIM> U_half_data,
+    const Pointer<SideData<NDIM, double> > S_data,
+    const std::array<Box<NDIM>, NDIM>& side_boxes,
+    const double dt,
+    const double* const dx)
+{
+    // Offsets of the values associated with the index i in an array are
+    // computed as offset + sum_d i(d) * stride[d].  The indices of
+    // face-centered data are permuted so that the face normal index varies
+    // most rapidly.
+    struct ArrayLayout
+    {
+        ArrayLayout() = default;
+
+        ArrayLayout(const Box<NDIM>& array_box, const unsigned int face_axis)
+        {
+            int array_stride = 1;
+            for (unsigned int k = 0; k < NDIM; ++k)
+            {
+                const unsigned int d = (face_axis + k) % NDIM;
+                stride[d] = array_stride;
+                offset -= array_box.lower(k) * array_stride;
+                array_stride *= array_box.numberCells(k);
+            }
+        }
+
+        int operator()(const hier::Index<NDIM>& i) const
+        {
+            int idx = offset;
+            for (unsigned int d = 0; d < NDIM; ++d) idx += i(d) * stride[d];
+            return idx;
+        }
+
+        int offset = 0;
+        std::array<int, NDIM> stride;
+    };
+
+    const bool compute_N = !N_data.isNull();
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        const ArrayLayout R_layout(R_data->getArrayData(axis).getBox(), 0);
+        const ArrayLayout R0_layout(R0_data->getArrayData(axis).getBox(), 0);
+        const ArrayLayout R1_layout(R1_data->getArrayData(axis).getBox(), 0);
+        const ArrayLayout S_layout(S_data->getArrayData(axis).getBox(), 0);
+        const ArrayLayout N_layout = compute_N ? ArrayLayout(N_data->getArrayData(axis).getBox(), 0) : ArrayLayout();
+        double* const R = R_data->getPointer(axis);
+        const double* const R0 = R0_data->getPointer(axis);
+        const double* const R1 = R1_data->getPointer(axis);
+        const double* const S = S_data->getPointer(axis);
+        double* const N = compute_N ? N_data->getPointer(axis) : nullptr;
+
+        std::array<ArrayLayout, NDIM> U_adv_layout, R_half_layout, U_half_layout;
+        std::array<const double*, NDIM> U_adv, R_half, U_half;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            U_adv_layout[d] = ArrayLayout(U_adv_data[axis]->getArrayData(d).getBox(), d);
+            R_half_layout[d] = ArrayLayout(R_half_data[axis]->getArrayData(d).getBox(), d);
+            U_adv[d] = U_adv_data[axis]->getPointer(d);
+            R_half[d] = R_half_data[axis]->getPointer(d);
+            if (compute_N)
+            {
+                U_half_layout[d] = ArrayLayout(U_half_data[axis]->getArrayData(d).getBox(), d);
+                U_half[d] = U_half_data[axis]->getPointer(d);
+            }
+        }
+
+        // Sweep the tiles of the side-centered index space one row at a time.
+        // The first axis has unit stride in the side-centered data.
+        for (PatchTileIterator t(side_boxes[axis], PatchTileIterator::getDefaultTileSize()); t; t++)
+        {
+            Box<NDIM> row_box = t();
+            const int n0 = row_box.numberCells(0);
+            row_box.upper(0) = row_box.lower(0);
+            for (Box<NDIM>::Iterator b(row_box); b; b++)
+            {
+                const hier::Index<NDIM>& i = b();
+                const int R_idx = R_layout(i), R0_idx = R0_layout(i), R1_idx = R1_layout(i), S_idx = S_layout(i);
+                const int N_idx = compute_N ? N_layout(i) : 0;
+                std::array<int, NDIM> U_adv_idx, R_half_idx, U_half_idx;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    U_adv_idx[d] = U_adv_layout[d](i);
+                    R_half_idx[d] = R_half_layout[d](i);
+                    U_half_idx[d] = compute_N ? U_half_layout[d](i) : 0;
+                }
+                for (int i0 = 0; i0 < n0; ++i0)
+                {
+                    double R_new = 0.0, N_new = 0.0;
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        // Index the faces on the lower and upper sides of the
+                        // control volume in direction d.
+                        const int u_l = U_adv_idx[d] + i0 * U_adv_layout[d].stride[0];
+                        const int u_u = u_l + U_adv_layout[d].stride[d];
+                        const int r_l = R_half_idx[d] + i0 * R_half_layout[d].stride[0];
+                        const int r_u = r_l + R_half_layout[d].stride[d];
+
+                        // Accumulate the density flux in the same order as
+                        // computeDensityUpdate().
+                        const double Px = (R_half[d][r_u] * U_adv[d][u_u] - R_half[d][r_l] * U_adv[d][u_l]) / dx[d];
+                        if (d == 0)
+                        {
+                            R_new = a0 * R0[R0_idx + i0] + a1 * R1[R1_idx + i0] + a2 * dt * (-Px + S[S_idx + i0]);
+                        }
+                        else
+                        {
+                            R_new = R_new - a2 * dt * Px;
+                        }
+
+                        // Accumulate the momentum flux using the upwinded
+                        // momentum P_half = R_half * U_half, as in
+                        // computeConvectiveDerivative().
+                        if (compute_N)
+                        {
+                            const int v_l = U_half_idx[d] + i0 * U_half_layout[d].stride[0];
+                            const int v_u = v_l + U_half_layout[d].stride[d];
+                            const double P_l = R_half[d][r_l] * U_half[d][v_l];
+                            const double P_u = R_half[d][r_u] * U_half[d][v_u];
+                            const double QUx = (U_adv[d][u_u] * P_u - U_adv[d][u_l] * P_l) / dx[d];
+                            N_new = (d == 0 ? QUx : N_new + QUx);
+                        }
+                    }
+                    R[R_idx + i0] = R_new;
+                    if (compute_N) N[N_idx + i0] = N_new;
+                }
+            }
+        }
+    }
+    return;
+} // computeConvectiveDerivativeAndDensityUpdate
+
 void
 INSVCStaggeredConservativeMassMomentumIntegrator::enforceDivergenceFreeConditionAtCoarseFineInterface(int U_idx)
 {
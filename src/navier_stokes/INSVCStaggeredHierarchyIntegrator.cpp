@@ -478,6 +478,16 @@ INSVCStaggeredHierarchyIntegrator::INSVCStaggeredHierarchyIntegrator(std::string
     if (input_db->keyExists("explicitly_remove_nullspace"))
         d_explicitly_remove_nullspace = input_db->getBool("explicitly_remove_nullspace");
 
+    // Flag to determine whether we extrapolate the initial guess for the Stokes
+    // solver from previous time steps.
+    if (input_db->keyExists("extrapolate_initial_guess"))
+        d_extrapolate_initial_guess = input_db->getBool("extrapolate_initial_guess");
+
+    // Flag to determine whether we skip the interpolation of the viscosity when
+    // it is unchanged.
+    if (input_db->keyExists("reuse_unchanged_viscosity"))
+        d_reuse_unchanged_viscosity = input_db->getBool("reuse_unchanged_viscosity");
+
     // Setup physical boundary conditions objects.
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_U_bc_coefs.resize(NDIM);
@@ -509,6 +519,7 @@ INSVCStaggeredHierarchyIntegrator::INSVCStaggeredHierarchyIntegrator(std::string
     d_Q_var = INSHierarchyIntegrator::d_Q_var;
     d_N_old_var = new SideVariable<NDIM, double>(d_object_name + "::N_old");
     d_U_old_var = new SideVariable<NDIM, double>(d_object_name + "::U_old");
+    if (d_extrapolate_initial_guess) d_P_old_var = new CellVariable<NDIM, double>(d_object_name + "::P_old");
 
     d_U_cc_var = new CellVariable<NDIM, double>(d_object_name + "::U_cc", NDIM);
     d_F_cc_var = new CellVariable<NDIM, double>(d_object_name + "::F_cc", NDIM);
@@ -707,7 +718,10 @@ INSVCStaggeredHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHi
         else
         {
             d_velocity_precond_type = DEFAULT_VC_VELOCITY_PRECOND;
-            d_velocity_precond_db->putString("coarse_solver_type", DEFAULT_VC_VELOCITY_LEVEL_SOLVER);
+            if (!d_velocity_precond_db->keyExists("coarse_solver_type"))
+            {
+                d_velocity_precond_db->putString("coarse_solver_type", DEFAULT_VC_VELOCITY_LEVEL_SOLVER);
+            }
         }
         d_velocity_precond_db->putInteger("max_iterations", 1);
     }
@@ -850,6 +864,17 @@ INSVCStaggeredHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHi
                      d_N_coarsen_type,
                      d_N_refine_type);
 
+    if (d_extrapolate_initial_guess)
+    {
+        registerVariable(d_P_old_current_idx,
+                         d_P_old_new_idx,
+                         d_P_old_scratch_idx,
+                         d_P_old_var,
+                         cell_ghosts,
+                         d_P_coarsen_type,
+                         d_P_refine_type);
+    }
+
     // Get the viscosity variable, which can either be an advected field
     // maintained by an appropriate advection-diffusion integrator, or a set
     // field with some functional form maintained by the INS integrator
@@ -1137,7 +1162,7 @@ INSVCStaggeredHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHi
         if (p_vc_point_fac_op)
         {
             Pointer<VCSCViscousPETScLevelSolver> p_vc_level_solver = p_vc_point_fac_op->getCoarseSolver();
-            if (p_poisson_fac_pc) p_vc_level_solver->setViscosityInterpolationType(d_mu_vc_interp_type);
+            if (p_vc_level_solver) p_vc_level_solver->setViscosityInterpolationType(d_mu_vc_interp_type);
         }
     }
 
@@ -1184,11 +1209,11 @@ INSVCStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(const double cur
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
 
     // Allocate the scratch and new data.
+    allocatePatchData(d_scratch_data, current_time, coarsest_ln, finest_ln);
+    allocatePatchData(d_new_data, new_time, coarsest_ln, finest_ln);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
         level->allocatePatchData(d_velocity_C_idx, current_time);
         level->allocatePatchData(d_velocity_L_idx, current_time);
         level->allocatePatchData(d_velocity_rhs_C_idx, current_time);
@@ -1392,6 +1417,7 @@ void
 INSVCStaggeredHierarchyIntegrator::setViscosityVCInterpolationType(const IBTK::VCInterpType vc_interp_type)
 {
     d_mu_vc_interp_type = vc_interp_type;
+    d_stored_viscosity_is_valid = false;
     return;
 } // setViscosityVCInterpolationType
 
@@ -1763,6 +1789,9 @@ INSVCStaggeredHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
 #endif
     const int finest_hier_level = hierarchy->getFinestLevelNumber();
 
+    // The stored viscosity is not meaningful on the new hierarchy configuration.
+    d_stored_viscosity_is_valid = false;
+
     // Reset the hierarchy operations objects for the new hierarchy configuration.
     d_hier_cc_data_ops->setPatchHierarchy(hierarchy);
     d_hier_cc_data_ops->resetLevels(0, finest_hier_level);
@@ -1998,6 +2027,89 @@ INSVCStaggeredHierarchyIntegrator::copySideToFace(const int U_fc_idx,
     return;
 } // copySideToFace
 
+void
+INSVCStaggeredHierarchyIntegrator::setupInitialGuess(const double current_time, const double new_time)
+{
+    d_hier_sc_data_ops->copyData(d_U_new_idx, d_U_current_idx);
+    d_hier_cc_data_ops->copyData(d_P_new_idx, d_P_current_idx);
+    if (!d_extrapolate_initial_guess) return;
+
+    // Linearly extrapolate u(n+1) and p(n+1/2) from the two most recent time
+    // steps, and store the current pressure for use in the next step.  The
+    // time-lagged velocity is maintained in preprocessIntegrateHierarchy().
+    if (getIntegratorStep() > 0 && !d_dt_previous.empty())
+    {
+        const double dt = new_time - current_time;
+        const double omega = dt / d_dt_previous[0];
+        d_hier_sc_data_ops->linearSum(d_U_new_idx, 1.0 + omega, d_U_current_idx, -omega, d_U_old_current_idx);
+        d_hier_cc_data_ops->linearSum(d_P_new_idx, 1.0 + omega, d_P_current_idx, -omega, d_P_old_current_idx);
+    }
+    d_hier_cc_data_ops->copyData(d_P_old_new_idx, d_P_current_idx);
+    return;
+} // setupInitialGuess
+
+bool
+INSVCStaggeredHierarchyIntegrator::reuseStoredViscosity(const int mu_idx)
+{
+    if (!d_reuse_unchanged_viscosity || !d_stored_viscosity_is_valid) return false;
+
+    // Compare the interior values of the viscosity with the stored values.
+    int mu_changed = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    for (int ln = 0; ln <= finest_ln && !mu_changed; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p && !mu_changed; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > mu_data = patch->getPatchData(mu_idx);
+            Pointer<CellData<NDIM, double> > mu_stored_data = patch->getPatchData(d_mu_linear_op_idx);
+            for (CellIterator<NDIM> ic(patch->getBox()); ic && !mu_changed; ic++)
+            {
+                const CellIndex<NDIM>& i = ic();
+                if ((*mu_data)(i) != (*mu_stored_data)(i)) mu_changed = 1;
+            }
+        }
+    }
+    mu_changed = SAMRAI_MPI::maxReduction(mu_changed);
+    if (mu_changed) return false;
+
+    if (d_enable_logging)
+        plog << d_object_name << "::reuseStoredViscosity(): viscosity is unchanged; reusing stored values\n";
+    d_hier_cc_data_ops->copyData(d_mu_scratch_idx,
+                                 d_mu_linear_op_idx,
+                                 /*interior_only*/ false);
+#if (NDIM == 2)
+    d_hier_nc_data_ops->copyData(d_mu_interp_idx,
+                                 d_mu_interp_linear_op_idx,
+                                 /*interior_only*/ false);
+#elif (NDIM == 3)
+    d_hier_ec_data_ops->copyData(d_mu_interp_idx,
+                                 d_mu_interp_linear_op_idx,
+                                 /*interior_only*/ false);
+#endif
+    return true;
+} // reuseStoredViscosity
+
+void
+INSVCStaggeredHierarchyIntegrator::storeViscosity()
+{
+    d_hier_cc_data_ops->copyData(d_mu_linear_op_idx,
+                                 d_mu_scratch_idx,
+                                 /*interior_only*/ false);
+#if (NDIM == 2)
+    d_hier_nc_data_ops->copyData(d_mu_interp_linear_op_idx,
+                                 d_mu_interp_idx,
+                                 /*interior_only*/ false);
+#elif (NDIM == 3)
+    d_hier_ec_data_ops->copyData(d_mu_interp_linear_op_idx,
+                                 d_mu_interp_idx,
+                                 /*interior_only*/ false);
+#endif
+    d_stored_viscosity_is_valid = true;
+    return;
+} // storeViscosity
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
@@ -336,50 +336,42 @@ INSVCStaggeredNonConservativeHierarchyIntegrator::preprocessIntegrateHierarchy(c
             mu_current_idx = d_mu_current_idx;
         }
 
-        d_hier_cc_data_ops->copyData(d_mu_scratch_idx,
-                                     mu_current_idx,
-                                     /*interior_only*/ true);
-        d_mu_bdry_bc_fill_op->fillData(current_time);
-
-        // Interpolate onto node or edge centers
-        if (d_mu_vc_interp_type == VC_AVERAGE_INTERP)
-        {
-            d_hier_math_ops->interp(d_mu_interp_idx,
-                                    d_mu_interp_var,
-                                    /*dst_ghost_interp*/ true,
-                                    d_mu_scratch_idx,
-                                    d_mu_var,
-                                    d_no_fill_op,
-                                    current_time);
-        }
-        else if (d_mu_vc_interp_type == VC_HARMONIC_INTERP)
+        if (!reuseStoredViscosity(mu_current_idx))
         {
-            d_hier_math_ops->harmonic_interp(d_mu_interp_idx,
-                                             d_mu_interp_var,
-                                             /*dst_ghost_interp*/ true,
-                                             d_mu_scratch_idx,
-                                             d_mu_var,
-                                             d_no_fill_op,
-                                             current_time);
-        }
-        else
-        {
-            TBOX_ERROR("this statement should not be reached");
-        }
+            d_hier_cc_data_ops->copyData(d_mu_scratch_idx,
+                                         mu_current_idx,
+                                         /*interior_only*/ true);
+            d_mu_bdry_bc_fill_op->fillData(current_time);
 
-        // Store the viscosities for later use
-        d_hier_cc_data_ops->copyData(d_mu_linear_op_idx,
-                                     d_mu_scratch_idx,
-                                     /*interior_only*/ false);
-#if (NDIM == 2)
-        d_hier_nc_data_ops->copyData(d_mu_interp_linear_op_idx,
-                                     d_mu_interp_idx,
-                                     /*interior_only*/ false);
-#elif (NDIM == 3)
-        d_hier_ec_data_ops->copyData(d_mu_interp_linear_op_idx,
-                                     d_mu_interp_idx,
-                                     /*interior_only*/ false);
-#endif
+            // Interpolate onto node or edge centers
+            if (d_mu_vc_interp_type == VC_AVERAGE_INTERP)
+            {
+                d_hier_math_ops->interp(d_mu_interp_idx,
+                                        d_mu_interp_var,
+                                        /*dst_ghost_interp*/ true,
+                                        d_mu_scratch_idx,
+                                        d_mu_var,
+                                        d_no_fill_op,
+                                        current_time);
+            }
+            else if (d_mu_vc_interp_type == VC_HARMONIC_INTERP)
+            {
+                d_hier_math_ops->harmonic_interp(d_mu_interp_idx,
+                                                 d_mu_interp_var,
+                                                 /*dst_ghost_interp*/ true,
+                                                 d_mu_scratch_idx,
+                                                 d_mu_var,
+                                                 d_no_fill_op,
+                                                 current_time);
+            }
+            else
+            {
+                TBOX_ERROR("this statement should not be reached");
+            }
+
+            // Store the viscosities for later use
+            storeViscosity();
+        }
     }
 
     // Allocate solver vectors.
@@ -484,8 +476,7 @@ INSVCStaggeredNonConservativeHierarchyIntegrator::preprocessIntegrateHierarchy(c
                                  /*interior_only*/ false);
 
     // Set the initial guess.
-    d_hier_sc_data_ops->copyData(d_U_new_idx, d_U_current_idx);
-    d_hier_cc_data_ops->copyData(d_P_new_idx, d_P_current_idx);
+    setupInitialGuess(current_time, new_time);
 
     // Set up inhomogeneous BCs.
     d_stokes_solver->setHomogeneousBc(false);
@@ -637,7 +628,27 @@ INSVCStaggeredNonConservativeHierarchyIntegrator::integrateHierarchy(const doubl
         d_hier_cc_data_ops->copyData(d_rho_scratch_idx,
                                      rho_new_idx,
                                      /*interior_only*/ true);
-        d_rho_bdry_bc_fill_op->fillData(new_time);
+        if (d_mu_is_const)
+        {
+            d_rho_bdry_bc_fill_op->fillData(new_time);
+        }
+        else
+        {
+            int mu_new_idx;
+            if (d_adv_diff_hier_integrator && d_mu_adv_diff_var)
+            {
+                mu_new_idx = var_db->mapVariableAndContextToIndex(d_mu_adv_diff_var,
+                                                                  d_adv_diff_hier_integrator->getNewContext());
+            }
+            else
+            {
+                mu_new_idx = d_mu_new_idx;
+            }
+            d_hier_cc_data_ops->copyData(d_mu_scratch_idx,
+                                         mu_new_idx,
+                                         /*interior_only*/ true);
+            d_rho_mu_bdry_bc_fill_op->fillData(new_time);
+        }
 
         for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
         {
@@ -681,61 +692,61 @@ INSVCStaggeredNonConservativeHierarchyIntegrator::integrateHierarchy(const doubl
     }
     if (!d_mu_is_const)
     {
-        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
-        int mu_new_idx;
-        if (d_adv_diff_hier_integrator && d_mu_adv_diff_var)
+        // NOTE: If the density is also variable, the ghost cells of the
+        // viscosity have already been filled along with those of the density.
+        int mu_new_idx = d_mu_scratch_idx;
+        if (d_rho_is_const)
         {
-            mu_new_idx =
-                var_db->mapVariableAndContextToIndex(d_mu_adv_diff_var, d_adv_diff_hier_integrator->getNewContext());
+            VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+            if (d_adv_diff_hier_integrator && d_mu_adv_diff_var)
+            {
+                mu_new_idx = var_db->mapVariableAndContextToIndex(d_mu_adv_diff_var,
+                                                                  d_adv_diff_hier_integrator->getNewContext());
+            }
+            else
+            {
+                mu_new_idx = d_mu_new_idx;
+            }
         }
-        else
+        if (!reuseStoredViscosity(mu_new_idx))
         {
-            mu_new_idx = d_mu_new_idx;
-        }
-        d_hier_cc_data_ops->copyData(d_mu_scratch_idx,
-                                     mu_new_idx,
-                                     /*interior_only*/ true);
-        d_mu_bdry_bc_fill_op->fillData(new_time);
+            if (d_rho_is_const)
+            {
+                d_hier_cc_data_ops->copyData(d_mu_scratch_idx,
+                                             mu_new_idx,
+                                             /*interior_only*/ true);
+                d_mu_bdry_bc_fill_op->fillData(new_time);
+            }
 
-        // Interpolate onto node or edge centers
-        if (d_mu_vc_interp_type == VC_AVERAGE_INTERP)
-        {
-            d_hier_math_ops->interp(d_mu_interp_idx,
-                                    d_mu_interp_var,
-                                    /*dst_ghost_interp*/ true,
-                                    d_mu_scratch_idx,
-                                    d_mu_var,
-                                    d_no_fill_op,
-                                    new_time);
-        }
-        else if (d_mu_vc_interp_type == VC_HARMONIC_INTERP)
-        {
-            d_hier_math_ops->harmonic_interp(d_mu_interp_idx,
-                                             d_mu_interp_var,
-                                             /*dst_ghost_interp*/ true,
-                                             d_mu_scratch_idx,
-                                             d_mu_var,
-                                             d_no_fill_op,
-                                             new_time);
-        }
-        else
-        {
-            TBOX_ERROR("this statement should not be reached");
-        }
+            // Interpolate onto node or edge centers
+            if (d_mu_vc_interp_type == VC_AVERAGE_INTERP)
+            {
+                d_hier_math_ops->interp(d_mu_interp_idx,
+                                        d_mu_interp_var,
+                                        /*dst_ghost_interp*/ true,
+                                        d_mu_scratch_idx,
+                                        d_mu_var,
+                                        d_no_fill_op,
+                                        new_time);
+            }
+            else if (d_mu_vc_interp_type == VC_HARMONIC_INTERP)
+            {
+                d_hier_math_ops->harmonic_interp(d_mu_interp_idx,
+                                                 d_mu_interp_var,
+                                                 /*dst_ghost_interp*/ true,
+                                                 d_mu_scratch_idx,
+                                                 d_mu_var,
+                                                 d_no_fill_op,
+                                                 new_time);
+            }
+            else
+            {
+                TBOX_ERROR("this statement should not be reached");
+            }
 
-        // Store the viscosities for later use
-        d_hier_cc_data_ops->copyData(d_mu_linear_op_idx,
-                                     d_mu_scratch_idx,
-                                     /*interior_only*/ false);
-#if (NDIM == 2)
-        d_hier_nc_data_ops->copyData(d_mu_interp_linear_op_idx,
-                                     d_mu_interp_idx,
-                                     /*interior_only*/ false);
-#elif (NDIM == 3)
-        d_hier_ec_data_ops->copyData(d_mu_interp_linear_op_idx,
-                                     d_mu_interp_idx,
-                                     /*interior_only*/ false);
-#endif
+            // Store the viscosities for later use
+            storeViscosity();
+        }
     }
 
     // Update the solvers and operators to take into account new state variables
@@ -959,6 +970,23 @@ INSVCStaggeredNonConservativeHierarchyIntegrator::resetHierarchyConfigurationSpe
                                                            d_rho_bc_coef);
         d_rho_bdry_bc_fill_op = new HierarchyGhostCellInterpolation();
         d_rho_bdry_bc_fill_op->initializeOperatorState(rho_bc_component, d_hierarchy);
+
+        // When both the density and viscosity are variable, they are updated
+        // at the same time during each cycle, so we fill their ghost cells
+        // together to avoid a second round of communication.
+        if (!d_mu_is_const)
+        {
+            InterpolationTransactionComponent mu_bc_component(d_mu_scratch_idx,
+                                                              d_mu_refine_type,
+                                                              false,
+                                                              d_mu_coarsen_type,
+                                                              d_mu_bdry_extrap_type,
+                                                              false,
+                                                              d_mu_bc_coef);
+            std::vector<InterpolationTransactionComponent> rho_mu_bc_components = { rho_bc_component, mu_bc_component };
+            d_rho_mu_bdry_bc_fill_op = new HierarchyGhostCellInterpolation();
+            d_rho_mu_bdry_bc_fill_op->initializeOperatorState(rho_mu_bc_components, d_hierarchy);
+        }
     }
     return;
 } // resetHierarchyConfigurationSpecialized
@@ -30,6 +30,7 @@
 #include "IntVector.h"
 #include "Patch.h"
 #include "PatchData.h"
+#include "PatchLevel.h"
 #include "SideData.h"
 #include "SideGeometry.h"
 #include "SideIndex.h"
@@ -39,17 +40,12 @@
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <map>
 #include <string>
-
-namespace SAMRAI
-{
-namespace hier
-{
-template <int DIM>
-class PatchLevel;
-} // namespace hier
-} // namespace SAMRAI
+#include <vector>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -124,6 +120,163 @@ SpongeLayerForceFunction::setDataOnPatch(const int data_idx,
     if (f_cc_data) f_cc_data->fillAll(0.0);
     if (f_sc_data) f_sc_data->fillAll(0.0);
     if (initial_time) return;
+    const std::array<Box<NDIM>, 2 * NDIM> layer_boxes = getLayerBoxes(patch);
+    if (std::all_of(layer_boxes.begin(), layer_boxes.end(), [](const Box<NDIM>& box) { return box.empty(); }))
+    {
+        return;
+    }
+    addDataOnPatchLayers(f_data, patch, layer_boxes);
+    return;
+} // setDataOnPatch
+
+bool
+SpongeLayerForceFunction::supportsAddDataOnPatch() const
+{
+    return true;
+} // supportsAddDataOnPatch
+
+void
+SpongeLayerForceFunction::addDataOnPatch(const int data_idx,
+                                         Pointer<Variable<NDIM> > /*var*/,
+                                         Pointer<Patch<NDIM> > patch,
+                                         const double /*data_time*/,
+                                         const bool initial_time,
+                                         Pointer<PatchLevel<NDIM> > /*level*/)
+{
+    if (initial_time) return;
+    const std::array<Box<NDIM>, 2 * NDIM> layer_boxes = getLayerBoxes(patch);
+    if (std::all_of(layer_boxes.begin(), layer_boxes.end(), [](const Box<NDIM>& box) { return box.empty(); }))
+    {
+        return;
+    }
+    addDataOnPatchLayers(patch->getPatchData(data_idx), patch, layer_boxes);
+    return;
+} // addDataOnPatch
+
+void
+SpongeLayerForceFunction::setDataOnPatchLevel(const int data_idx,
+                                              Pointer<Variable<NDIM> > /*var*/,
+                                              Pointer<PatchLevel<NDIM> > level,
+                                              const double /*data_time*/,
+                                              const bool initial_time)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(level);
+#endif
+    // Redetermine the layer boxes if the level has been regridded or load
+    // balanced since they were last determined.
+    const int ln = level->getLevelNumber();
+    if (ln >= static_cast<int>(d_level_boxes.size()))
+    {
+        d_level_boxes.resize(ln + 1);
+        d_level_patch_owners.resize(ln + 1);
+        d_layer_boxes.resize(ln + 1);
+    }
+    const BoxArray<NDIM>& boxes = level->getBoxes();
+    bool level_changed = boxes.getNumberOfBoxes() != d_level_boxes[ln].getNumberOfBoxes();
+    for (int k = 0; !level_changed && k < boxes.getNumberOfBoxes(); ++k)
+    {
+        level_changed =
+            !(boxes[k] == d_level_boxes[ln][k]) || level->getMappingForPatch(k) != d_level_patch_owners[ln][k];
+    }
+    if (level_changed)
+    {
+        d_level_boxes[ln] = boxes;
+        d_level_patch_owners[ln].resize(boxes.getNumberOfBoxes());
+        for (int k = 0; k < boxes.getNumberOfBoxes(); ++k) d_level_patch_owners[ln][k] = level->getMappingForPatch(k);
+        d_layer_boxes[ln].clear();
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const std::array<Box<NDIM>, 2 * NDIM> layer_boxes = getLayerBoxes(level->getPatch(p()));
+            if (std::any_of(
+                    layer_boxes.begin(), layer_boxes.end(), [](const Box<NDIM>& box) { return !box.empty(); }))
+            {
+                d_layer_boxes[ln][p()] = layer_boxes;
+            }
+        }
+    }
+
+    // Zero out the forcing everywhere and then set it only on the parts of the
+    // patches that intersect the boundary layers.
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<PatchData<NDIM> > f_data = level->getPatch(p())->getPatchData(data_idx);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(f_data);
+#endif
+        Pointer<CellData<NDIM, double> > f_cc_data = f_data;
+        Pointer<SideData<NDIM, double> > f_sc_data = f_data;
+#if !defined(NDEBUG)
+        TBOX_ASSERT(f_cc_data || f_sc_data);
+#endif
+        if (f_cc_data) f_cc_data->fillAll(0.0);
+        if (f_sc_data) f_sc_data->fillAll(0.0);
+    }
+    if (initial_time) return;
+    for (const auto& patch_layer_boxes : d_layer_boxes[ln])
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(patch_layer_boxes.first);
+        addDataOnPatchLayers(patch->getPatchData(data_idx), patch, patch_layer_boxes.second);
+    }
+    return;
+} // setDataOnPatchLevel
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+std::array<Box<NDIM>, 2 * NDIM>
+SpongeLayerForceFunction::getLayerBoxes(Pointer<Patch<NDIM> > patch) const
+{
+    std::array<Box<NDIM>, 2 * NDIM> layer_boxes;
+    const Box<NDIM>& patch_box = patch->getBox();
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    const IntVector<NDIM>& ratio = pgeom->getRatio();
+    const Box<NDIM> domain_box = Box<NDIM>::refine(d_grid_geometry->getPhysicalDomain()[0], ratio);
+    for (unsigned int location_index = 0; location_index < 2 * NDIM; ++location_index)
+    {
+        bool forcing_enabled = false;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            forcing_enabled = forcing_enabled || d_forcing_enabled[location_index][d];
+        }
+        if (!forcing_enabled) continue;
+        const unsigned int axis = location_index / 2;
+        const bool is_lower = location_index % 2 == 0;
+        Box<NDIM> bdry_box = domain_box;
+        const int offset = static_cast<int>(d_width[location_index] / dx[axis]);
+        if (is_lower)
+        {
+            bdry_box.upper(axis) = domain_box.lower(axis) + offset;
+        }
+        else
+        {
+            bdry_box.lower(axis) = domain_box.upper(axis) - offset;
+        }
+        layer_boxes[location_index] = bdry_box * patch_box;
+    }
+    return layer_boxes;
+} // getLayerBoxes
+
+bool
+SpongeLayerForceFunction::inLaterLayer(const std::array<Box<NDIM>, 2 * NDIM>& layer_boxes,
+                                       const unsigned int location_index,
+                                       const unsigned int d,
+                                       const hier::Index<NDIM>& i) const
+{
+    for (unsigned int k = location_index + 1; k < 2 * NDIM; ++k)
+    {
+        if (d_forcing_enabled[k][d] && layer_boxes[k].contains(i)) return true;
+    }
+    return false;
+} // inLaterLayer
+
+void
+SpongeLayerForceFunction::addDataOnPatchLayers(Pointer<PatchData<NDIM> > f_data,
+                                               Pointer<Patch<NDIM> > patch,
+                                               const std::array<Box<NDIM>, 2 * NDIM>& layer_boxes)
+{
     const int cycle_num = d_fluid_solver->getCurrentCycleNumber();
     const double dt = d_fluid_solver->getCurrentTimeStepSize();
     const double rho = d_fluid_solver->getStokesSpecifications()->getRho();
@@ -135,21 +288,20 @@ SpongeLayerForceFunction::setDataOnPatch(const int data_idx,
 #if !defined(NDEBUG)
     TBOX_ASSERT(u_current_data);
 #endif
-    if (f_cc_data) setDataOnPatchCell(f_data, u_current_data, u_new_data, kappa, patch);
-    if (f_sc_data) setDataOnPatchSide(f_data, u_current_data, u_new_data, kappa, patch);
+    Pointer<CellData<NDIM, double> > f_cc_data = f_data;
+    Pointer<SideData<NDIM, double> > f_sc_data = f_data;
+    if (f_cc_data) addDataOnPatchCell(f_data, u_current_data, u_new_data, kappa, patch, layer_boxes);
+    if (f_sc_data) addDataOnPatchSide(f_data, u_current_data, u_new_data, kappa, patch, layer_boxes);
     return;
-} // setDataOnPatch
-
-/////////////////////////////// PROTECTED ////////////////////////////////////
-
-/////////////////////////////// PRIVATE //////////////////////////////////////
+} // addDataOnPatchLayers
 
 void
-SpongeLayerForceFunction::setDataOnPatchCell(Pointer<CellData<NDIM, double> > F_data,
+SpongeLayerForceFunction::addDataOnPatchCell(Pointer<CellData<NDIM, double> > F_data,
                                              Pointer<CellData<NDIM, double> > U_current_data,
                                              Pointer<CellData<NDIM, double> > U_new_data,
                                              const double kappa,
-                                             Pointer<Patch<NDIM> > patch)
+                                             Pointer<Patch<NDIM> > patch,
+                                             const std::array<Box<NDIM>, 2 * NDIM>& layer_boxes)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(F_data && U_current_data);
@@ -159,51 +311,40 @@ SpongeLayerForceFunction::setDataOnPatchCell(Pointer<CellData<NDIM, double> > F_
     Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
     const double* const x_lower = pgeom->getXLower();
-    const double* const x_upper = pgeom->getXUpper();
-    const IntVector<NDIM>& ratio = pgeom->getRatio();
-    const Box<NDIM> domain_box = Box<NDIM>::refine(d_grid_geometry->getPhysicalDomain()[0], ratio);
+    const double* const domain_x_lower = d_grid_geometry->getXLower();
+    const double* const domain_x_upper = d_grid_geometry->getXUpper();
     for (unsigned int location_index = 0; location_index < 2 * NDIM; ++location_index)
     {
+        if (layer_boxes[location_index].empty()) continue;
         const unsigned int axis = location_index / 2;
-        const unsigned int side = location_index % 2;
-        const bool is_lower = side == 0;
+        const bool is_lower = location_index % 2 == 0;
+        const double x_bdry = (is_lower ? domain_x_lower[axis] : domain_x_upper[axis]);
         for (unsigned int d = 0; d < NDIM; ++d)
         {
-            if (d_forcing_enabled[location_index][d] && pgeom->getTouchesRegularBoundary(axis, side))
+            if (!d_forcing_enabled[location_index][d]) continue;
+            for (Box<NDIM>::Iterator b(layer_boxes[location_index]); b; b++)
             {
-                Box<NDIM> bdry_box = domain_box;
-                const int offset = static_cast<int>(d_width[location_index] / dx[axis]);
-                if (is_lower)
-                {
-                    bdry_box.upper(axis) = domain_box.lower(axis) + offset;
-                }
-                else
-                {
-                    bdry_box.lower(axis) = domain_box.upper(axis) - offset;
-                }
-                for (Box<NDIM>::Iterator b(bdry_box * patch_box); b; b++)
-                {
-                    const hier::Index<NDIM>& i = b();
-                    const double U_current = U_current_data ? (*U_current_data)(i, d) : 0.0;
-                    const double U_new = U_new_data ? (*U_new_data)(i, d) : 0.0;
-                    const double U = (cycle_num > 0) ? 0.5 * (U_new + U_current) : U_current;
-                    const double x =
-                        x_lower[axis] + dx[axis] * (static_cast<double>(i(axis) - patch_box.lower(axis)) + 0.5);
-                    const double x_bdry = (is_lower ? x_lower[axis] : x_upper[axis]);
-                    (*F_data)(i, d) = smooth_kernel((x - x_bdry) / d_width[location_index]) * kappa * (0.0 - U);
-                }
+                const hier::Index<NDIM>& i = b();
+                if (inLaterLayer(layer_boxes, location_index, d, i)) continue;
+                const double U_current = U_current_data ? (*U_current_data)(i, d) : 0.0;
+                const double U_new = U_new_data ? (*U_new_data)(i, d) : 0.0;
+                const double U = (cycle_num > 0) ? 0.5 * (U_new + U_current) : U_current;
+                const double x =
+                    x_lower[axis] + dx[axis] * (static_cast<double>(i(axis) - patch_box.lower(axis)) + 0.5);
+                (*F_data)(i, d) += smooth_kernel((x - x_bdry) / d_width[location_index]) * kappa * (0.0 - U);
             }
         }
     }
     return;
-} // setDataOnPatchCell
+} // addDataOnPatchCell
 
 void
-SpongeLayerForceFunction::setDataOnPatchSide(Pointer<SideData<NDIM, double> > F_data,
+SpongeLayerForceFunction::addDataOnPatchSide(Pointer<SideData<NDIM, double> > F_data,
                                              Pointer<SideData<NDIM, double> > U_current_data,
                                              Pointer<SideData<NDIM, double> > U_new_data,
                                              const double kappa,
-                                             Pointer<Patch<NDIM> > patch)
+                                             Pointer<Patch<NDIM> > patch,
+                                             const std::array<Box<NDIM>, 2 * NDIM>& layer_boxes)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(F_data && U_current_data);
@@ -213,44 +354,37 @@ SpongeLayerForceFunction::setDataOnPatchSide(Pointer<SideData<NDIM, double> > F_
     Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
     const double* const x_lower = pgeom->getXLower();
-    const double* const x_upper = pgeom->getXUpper();
-    const IntVector<NDIM>& ratio = pgeom->getRatio();
-    const Box<NDIM> domain_box = Box<NDIM>::refine(d_grid_geometry->getPhysicalDomain()[0], ratio);
+    const double* const domain_x_lower = d_grid_geometry->getXLower();
+    const double* const domain_x_upper = d_grid_geometry->getXUpper();
     for (unsigned int location_index = 0; location_index < 2 * NDIM; ++location_index)
     {
+        if (layer_boxes[location_index].empty()) continue;
         const unsigned int axis = location_index / 2;
-        const unsigned int side = location_index % 2;
-        const bool is_lower = side == 0;
+        const bool is_lower = location_index % 2 == 0;
+        const double x_bdry = (is_lower ? domain_x_lower[axis] : domain_x_upper[axis]);
         for (unsigned int d = 0; d < NDIM; ++d)
         {
-            if (d_forcing_enabled[location_index][d] && pgeom->getTouchesRegularBoundary(axis, side))
+            if (!d_forcing_enabled[location_index][d]) continue;
+            std::array<Box<NDIM>, 2 * NDIM> side_layer_boxes;
+            for (unsigned int k = 0; k < 2 * NDIM; ++k)
+            {
+                if (!layer_boxes[k].empty()) side_layer_boxes[k] = SideGeometry<NDIM>::toSideBox(layer_boxes[k], d);
+            }
+            for (Box<NDIM>::Iterator b(side_layer_boxes[location_index]); b; b++)
             {
-                Box<NDIM> bdry_box = domain_box;
-                const int offset = static_cast<int>(d_width[location_index] / dx[axis]);
-                if (is_lower)
-                {
-                    bdry_box.upper(axis) = domain_box.lower(axis) + offset;
-                }
-                else
-                {
-                    bdry_box.lower(axis) = domain_box.upper(axis) - offset;
-                }
-                for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(bdry_box * patch_box, d)); b; b++)
-                {
-                    const hier::Index<NDIM>& i = b();
-                    const SideIndex<NDIM> i_s(i, d, SideIndex<NDIM>::Lower);
-                    const double U_current = U_current_data ? (*U_current_data)(i_s) : 0.0;
-                    const double U_new = U_new_data ? (*U_new_data)(i_s) : 0.0;
-                    const double U = (cycle_num > 0) ? 0.5 * (U_new + U_current) : U_current;
-                    const double x = x_lower[axis] + dx[axis] * static_cast<double>(i(axis) - patch_box.lower(axis));
-                    const double x_bdry = (is_lower ? x_lower[axis] : x_upper[axis]);
-                    (*F_data)(i_s) = smooth_kernel((x - x_bdry) / d_width[location_index]) * kappa * (0.0 - U);
-                }
+                const hier::Index<NDIM>& i = b();
+                if (inLaterLayer(side_layer_boxes, location_index, d, i)) continue;
+                const SideIndex<NDIM> i_s(i, d, SideIndex<NDIM>::Lower);
+                const double U_current = U_current_data ? (*U_current_data)(i_s) : 0.0;
+                const double U_new = U_new_data ? (*U_new_data)(i_s) : 0.0;
+                const double U = (cycle_num > 0) ? 0.5 * (U_new + U_current) : U_current;
+                const double x = x_lower[axis] + dx[axis] * static_cast<double>(i(axis) - patch_box.lower(axis));
+                (*F_data)(i_s) += smooth_kernel((x - x_bdry) / d_width[location_index]) * kappa * (0.0 - U);
             }
         }
     }
     return;
-} // setDataOnPatchSide
+} // addDataOnPatchSide
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
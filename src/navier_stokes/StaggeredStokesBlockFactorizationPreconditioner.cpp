@@ -22,7 +22,6 @@
 #include "ibtk/GeneralSolver.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
-#include "ibtk/LinearSolver.h"
 #include "ibtk/PoissonSolver.h"
 
 #include "CellVariable.h"
@@ -45,6 +44,7 @@
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
 #include <ostream>
 #include <string>
 
@@ -121,6 +121,10 @@ StaggeredStokesBlockFactorizationPreconditioner::StaggeredStokesBlockFactorizati
         }
     }
 
+    // Determine whether to apply the subdomain solvers inexactly.
+    if (input_db->keyExists("inexact_subdomain_solves"))
+        d_inexact_subdomain_solves = input_db->getBool("inexact_subdomain_solves");
+
     // Setup variables.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     Pointer<VariableContext> context = var_db->getContext(d_object_name + "::CONTEXT");
@@ -259,15 +263,6 @@ StaggeredStokesBlockFactorizationPreconditioner::solveSystem(SAMRAIVectorReal<ND
                                                                  d_P_bc_coef,
                                                                  fill_pattern);
 
-    // Allocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_F_U_mod_idx);
-        level->allocatePatchData(d_P_scratch_idx);
-        level->allocatePatchData(d_F_P_mod_idx);
-    }
-
     // Apply one of the approximate block-factorization preconditioners.
     switch (d_factorization_type)
     {
@@ -355,15 +350,6 @@ StaggeredStokesBlockFactorizationPreconditioner::solveSystem(SAMRAIVectorReal<ND
     // Account for nullspace vectors.
     correctNullspace(U_vec, P_vec);
 
-    // Deallocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_F_U_mod_idx);
-        level->deallocatePatchData(d_P_scratch_idx);
-        level->deallocatePatchData(d_F_P_mod_idx);
-    }
-
     // Deallocate the solver (if necessary).
     if (deallocate_at_completion) deallocateSolverState();
 
@@ -397,6 +383,17 @@ StaggeredStokesBlockFactorizationPreconditioner::initializeSolverState(const SAM
     d_P_bdry_fill_op->setHomogeneousBc(true);
     d_P_bdry_fill_op->initializeOperatorState(P_scratch_component, d_hierarchy);
 
+    // Allocate scratch data.  The scratch data are kept for the lifetime of
+    // the solver state so that repeated applications of the preconditioner do
+    // not reallocate them.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(d_F_U_mod_idx)) level->allocatePatchData(d_F_U_mod_idx);
+        if (!level->checkAllocated(d_P_scratch_idx)) level->allocatePatchData(d_P_scratch_idx);
+        if (!level->checkAllocated(d_F_P_mod_idx)) level->allocatePatchData(d_F_P_mod_idx);
+    }
+
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_solver_state);
@@ -410,6 +407,15 @@ StaggeredStokesBlockFactorizationPreconditioner::deallocateSolverState()
 
     IBAMR_TIMER_START(t_deallocate_solver_state);
 
+    // Deallocate scratch data.
+    for (int ln = d_coarsest_ln; ln <= std::min(d_finest_ln, d_hierarchy->getFinestLevelNumber()); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_F_U_mod_idx)) level->deallocatePatchData(d_F_U_mod_idx);
+        if (level->checkAllocated(d_P_scratch_idx)) level->deallocatePatchData(d_P_scratch_idx);
+        if (level->checkAllocated(d_F_P_mod_idx)) level->deallocatePatchData(d_F_P_mod_idx);
+    }
+
     // Parent class deallocation.
     StaggeredStokesBlockPreconditioner::deallocateSolverState();
 
@@ -521,9 +527,7 @@ StaggeredStokesBlockFactorizationPreconditioner::solvePressureSubsystem(SAMRAIVe
     }
     else
     {
-        d_pressure_solver->setHomogeneousBc(true);
-        auto p_pressure_solver = dynamic_cast<LinearSolver*>(d_pressure_solver.getPointer());
-        if (p_pressure_solver) p_pressure_solver->setInitialGuessNonzero(initial_guess_nonzero);
+        setupSubdomainSolver(*d_pressure_solver, initial_guess_nonzero);
         d_pressure_solver->solveSystem(*P_scratch_vec,
                                        F_P_vec); // P_scratch_idx := -inv(L_rho)*F_P
         d_pressure_data_ops->linearSum(
@@ -542,9 +546,7 @@ StaggeredStokesBlockFactorizationPreconditioner::solveVelocitySubsystem(SAMRAIVe
     //    U := inv(rho/dt - K*mu*L) * F_U
     //
     // No special treatment is needed for the steady-state case.
-    d_velocity_solver->setHomogeneousBc(true);
-    auto p_velocity_solver = dynamic_cast<LinearSolver*>(d_velocity_solver.getPointer());
-    if (p_velocity_solver) p_velocity_solver->setInitialGuessNonzero(initial_guess_nonzero);
+    setupSubdomainSolver(*d_velocity_solver, initial_guess_nonzero);
     d_velocity_solver->solveSystem(U_vec, F_U_vec);
     return;
 }
@@ -129,6 +129,13 @@ StaggeredStokesBlockPreconditioner::setPhysicalBcCoefs(const std::vector<RobinBc
     return;
 } // setPhysicalBcCoefs
 
+void
+StaggeredStokesBlockPreconditioner::setInexactSubdomainSolves(const bool inexact_subdomain_solves)
+{
+    d_inexact_subdomain_solves = inexact_subdomain_solves;
+    return;
+} // setInexactSubdomainSolves
+
 void
 StaggeredStokesBlockPreconditioner::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
                                                           const SAMRAIVectorReal<NDIM, double>& b)
@@ -215,6 +222,19 @@ StaggeredStokesBlockPreconditioner::correctNullspace(Pointer<SAMRAIVectorReal<ND
     return;
 } // correctNullspace
 
+void
+StaggeredStokesBlockPreconditioner::setupSubdomainSolver(PoissonSolver& solver, const bool initial_guess_nonzero)
+{
+    solver.setHomogeneousBc(true);
+    auto p_solver = dynamic_cast<LinearSolver*>(&solver);
+    if (p_solver)
+    {
+        p_solver->setInitialGuessNonzero(initial_guess_nonzero);
+        if (d_inexact_subdomain_solves) p_solver->setMaxIterations(1);
+    }
+    return;
+} // setupSubdomainSolver
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////
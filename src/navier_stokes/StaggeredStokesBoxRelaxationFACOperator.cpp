@@ -69,6 +69,9 @@ namespace
 // Number of ghosts cells used for each variable quantity.
 static const int GHOSTS = 1;
 
+// Number of unknowns in the single-cell box system.
+static const int BOX_SIZE = 2 * NDIM + 1;
+
 inline int
 compute_side_index(const hier::Index<NDIM>& i, const Box<NDIM>& box, const unsigned int axis)
 {
@@ -283,149 +286,142 @@ buildBoxOperator(Mat& A,
 } // buildBoxOperator
 
 void
-modifyRhsForBcs(Vec& v,
-                const SideData<NDIM, double>& U_data,
-                const CellData<NDIM, double>& P_data,
-                const PoissonSpecifications& U_problem_coefs,
-                const Box<NDIM>& box,
-                const Box<NDIM>& ghost_box,
-                const double* const dx)
+computeBoxInverse(std::vector<double>& A_inv, Mat& A)
 {
     int ierr;
 
-    const double D = U_problem_coefs.getDConstant();
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
-        {
-            hier::Index<NDIM> i = b();
-            const int idx = compute_side_index(i, ghost_box, axis);
-
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                hier::Index<NDIM> shift = 0;
-                shift(d) = 1;
-                const hier::Index<NDIM> u_left = i - shift;
-                const hier::Index<NDIM> u_rght = i + shift;
-                if (!side_box.contains(u_left))
-                {
-                    ierr = VecSetValue(v,
-                                       idx,
-                                       +D * U_data(SideIndex<NDIM>(u_left, axis, SideIndex<NDIM>::Lower)) /
-                                           (dx[d] * dx[d]),
-                                       ADD_VALUES);
-                    IBTK_CHKERRQ(ierr);
-                }
-                if (!side_box.contains(u_rght))
-                {
-                    ierr = VecSetValue(v,
-                                       idx,
-                                       +D * U_data(SideIndex<NDIM>(u_rght, axis, SideIndex<NDIM>::Lower)) /
-                                           (dx[d] * dx[d]),
-                                       ADD_VALUES);
-                    IBTK_CHKERRQ(ierr);
-                }
-            }
+    // Factor the box operator once and recover its (dense) inverse column by
+    // column.
+    int size;
+    ierr = MatGetSize(A, &size, nullptr);
+    IBTK_CHKERRQ(ierr);
+    Vec e, r;
+    ierr = MatCreateVecs(A, &e, &r);
+    IBTK_CHKERRQ(ierr);
+    KSP ksp;
+    ierr = KSPCreate(PETSC_COMM_SELF, &ksp);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetOperators(ksp, A, A);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetType(ksp, KSPPREONLY);
+    IBTK_CHKERRQ(ierr);
+    PC pc;
+    ierr = KSPGetPC(ksp, &pc);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCSetType(pc, PCLU);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCFactorReorderForNonzeroDiagonal(pc, std::numeric_limits<double>::epsilon());
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetUp(ksp);
+    IBTK_CHKERRQ(ierr);
 
-            hier::Index<NDIM> shift = 0;
-            shift(axis) = 1;
-            const hier::Index<NDIM> p_left = i - shift;
-            const hier::Index<NDIM> p_rght = i;
-            if (!box.contains(p_left))
-            {
-                ierr = VecSetValue(v, idx, +P_data(p_left) / dx[axis], ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
-            }
-            if (!box.contains(p_rght))
-            {
-                ierr = VecSetValue(v, idx, -P_data(p_rght) / dx[axis], ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
-            }
-        }
+    A_inv.resize(size * size);
+    for (int j = 0; j < size; ++j)
+    {
+        ierr = VecSet(r, 0.0);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecSetValue(r, j, 1.0, INSERT_VALUES);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecAssemblyBegin(r);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecAssemblyEnd(r);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSolve(ksp, r, e);
+        IBTK_CHKERRQ(ierr);
+        const double* e_arr;
+        ierr = VecGetArrayRead(e, &e_arr);
+        IBTK_CHKERRQ(ierr);
+        for (int i = 0; i < size; ++i) A_inv[i * size + j] = e_arr[i];
+        ierr = VecRestoreArrayRead(e, &e_arr);
+        IBTK_CHKERRQ(ierr);
     }
 
-    ierr = VecAssemblyBegin(v);
+    ierr = KSPDestroy(&ksp);
     IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(v);
+    ierr = VecDestroy(&e);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&r);
     IBTK_CHKERRQ(ierr);
     return;
-} // modifyRhsForBcs
+} // computeBoxInverse
 
+// Compute the right-hand side of the single-cell box system centered on cell
+// i.  The unknowns are ordered as in buildBoxOperator(): the lower and upper
+// faces of the cell in each direction, followed by the cell itself.  Values
+// outside of the box are taken from the current error and moved to the
+// right-hand side.
 inline void
-copyToVec(Vec& v,
-          const SideData<NDIM, double>& U_data,
-          const CellData<NDIM, double>& P_data,
-          const Box<NDIM>& box,
-          const Box<NDIM>& ghost_box)
+computeBoxRhs(double* const r,
+              const hier::Index<NDIM>& i,
+              const SideData<NDIM, double>& U_error_data,
+              const CellData<NDIM, double>& P_error_data,
+              const SideData<NDIM, double>& U_residual_data,
+              const CellData<NDIM, double>& P_residual_data,
+              const double D,
+              const double* const dx)
 {
-    int ierr;
-
     for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
+        hier::Index<NDIM> shift_axis = 0;
+        shift_axis(axis) = 1;
+        for (int s = 0; s < 2; ++s)
         {
-            const hier::Index<NDIM>& i = b();
-            const SideIndex<NDIM> s_i(i, axis, 0);
-            const int idx = compute_side_index(i, ghost_box, axis);
-            ierr = VecSetValue(v, idx, U_data(s_i), INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
+            const hier::Index<NDIM> f = s == 0 ? i : i + shift_axis;
+            double rhs = U_residual_data(SideIndex<NDIM>(f, axis, SideIndex<NDIM>::Lower));
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                hier::Index<NDIM> shift = 0;
+                shift(d) = 1;
+                const double fac = D / (dx[d] * dx[d]);
+                if (d != axis || s == 0)
+                    rhs += fac * U_error_data(SideIndex<NDIM>(f - shift, axis, SideIndex<NDIM>::Lower));
+                if (d != axis || s == 1)
+                    rhs += fac * U_error_data(SideIndex<NDIM>(f + shift, axis, SideIndex<NDIM>::Lower));
+            }
+            if (s == 0)
+                rhs += P_error_data(i - shift_axis) / dx[axis];
+            else
+                rhs -= P_error_data(i + shift_axis) / dx[axis];
+            r[2 * axis + s] = rhs;
         }
     }
-
-    for (Box<NDIM>::Iterator b(box); b; b++)
-    {
-        const hier::Index<NDIM>& i = b();
-        const int idx = compute_cell_index(i, ghost_box);
-        ierr = VecSetValue(v, idx, P_data(i), INSERT_VALUES);
-        IBTK_CHKERRQ(ierr);
-    }
-
-    ierr = VecAssemblyBegin(v);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(v);
-    IBTK_CHKERRQ(ierr);
+    r[2 * NDIM] = P_residual_data(i);
     return;
-} // copyToVec
+} // computeBoxRhs
 
+// Solve the single-cell box system centered on cell i using the precomputed
+// inverse of the box operator and apply the update, damped by omega, to the
+// error.
 inline void
-copyFromVec(Vec& v,
-            SideData<NDIM, double>& U_data,
-            CellData<NDIM, double>& P_data,
-            const Box<NDIM>& box,
-            const Box<NDIM>& ghost_box)
+applyBoxInverse(const std::vector<double>& A_inv,
+                const double* const r,
+                const double omega,
+                const hier::Index<NDIM>& i,
+                SideData<NDIM, double>& U_error_data,
+                CellData<NDIM, double>& P_error_data)
 {
-    int ierr;
-
-    const double omega = 0.65;
+    std::array<double, BOX_SIZE> e;
+    for (int k = 0; k < BOX_SIZE; ++k)
+    {
+        const double* const A_inv_row = &A_inv[k * BOX_SIZE];
+        double sum = 0.0;
+        for (int l = 0; l < BOX_SIZE; ++l) sum += A_inv_row[l] * r[l];
+        e[k] = sum;
+    }
 
-    double U;
     for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
+        hier::Index<NDIM> shift_axis = 0;
+        shift_axis(axis) = 1;
+        for (int s = 0; s < 2; ++s)
         {
-            const hier::Index<NDIM>& i = b();
-            const SideIndex<NDIM> s_i(i, axis, SideIndex<NDIM>::Lower);
-            const int idx = compute_side_index(i, ghost_box, axis);
-            ierr = VecGetValues(v, 1, &idx, &U);
-            IBTK_CHKERRQ(ierr);
-            U_data(s_i) = (1.0 - omega) * U_data(s_i) + omega * U;
+            const SideIndex<NDIM> s_i(s == 0 ? i : i + shift_axis, axis, SideIndex<NDIM>::Lower);
+            U_error_data(s_i) = (1.0 - omega) * U_error_data(s_i) + omega * e[2 * axis + s];
         }
     }
-
-    double P;
-    for (Box<NDIM>::Iterator b(box); b; b++)
-    {
-        const hier::Index<NDIM>& i = b();
-        const int idx = compute_cell_index(i, ghost_box);
-        ierr = VecGetValues(v, 1, &idx, &P);
-        IBTK_CHKERRQ(ierr);
-        P_data(i) = (1.0 - omega) * P_data(i) + omega * P;
-    }
+    P_error_data(i) = (1.0 - omega) * P_error_data(i) + omega * e[2 * NDIM];
     return;
-} // copyFromVec
+} // applyBoxInverse
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -436,7 +432,15 @@ StaggeredStokesBoxRelaxationFACOperator::StaggeredStokesBoxRelaxationFACOperator
     const std::string& default_options_prefix)
     : StaggeredStokesFACPreconditionerStrategy(object_name, GHOSTS, input_db, default_options_prefix)
 {
-    // intentionally blank
+    if (input_db)
+    {
+        if (input_db->keyExists("relaxation_weight")) d_relaxation_weight = input_db->getDouble("relaxation_weight");
+    }
+    if (d_relaxation_weight <= 0.0 || d_relaxation_weight > 1.0)
+    {
+        TBOX_ERROR(d_object_name << "::StaggeredStokesBoxRelaxationFACOperator():\n"
+                                 << "  relaxation_weight must be in (0, 1]" << std::endl);
+    }
     return;
 } // StaggeredStokesBoxRelaxationFACOperator
 
@@ -456,7 +460,6 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
 {
     if (num_sweeps == 0) return;
 
-    int ierr;
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
     const int U_error_idx = error.getComponentDescriptorIndex(0);
     const int P_error_idx = error.getComponentDescriptorIndex(1);
@@ -568,10 +571,10 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
             xeqScheduleGhostFillNoCoarse(error_idxs, level_num);
         }
 
-        // Smooth the error on the patches.
-        Vec& e = d_box_e[level_num];
-        Vec& r = d_box_r[level_num];
-        KSP& ksp = d_box_ksp[level_num];
+        // Smooth the error on the patches.  The cells are visited in order so
+        // that each box solve sees the updates of the preceding ones.
+        const std::vector<double>& A_inv = d_box_inv[level_num];
+        const double D = d_U_problem_coefs.getDConstant();
         int patch_counter = 0;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
         {
@@ -596,16 +599,13 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
             const Box<NDIM>& patch_box = patch->getBox();
             const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
             const double* const dx = pgeom->getDx();
+            std::array<double, BOX_SIZE> r;
             for (Box<NDIM>::Iterator b(patch_box); b; b++)
             {
                 const hier::Index<NDIM>& i = b();
-                const Box<NDIM> box(i, i);
-                copyToVec(e, *U_error_data, *P_error_data, box, box);
-                copyToVec(r, *U_residual_data, *P_residual_data, box, box);
-                modifyRhsForBcs(r, *U_error_data, *P_error_data, d_U_problem_coefs, box, box, dx);
-                ierr = KSPSolve(ksp, r, e);
-                IBTK_CHKERRQ(ierr);
-                copyFromVec(e, *U_error_data, *P_error_data, box, box);
+                computeBoxRhs(
+                    r.data(), i, *U_error_data, *P_error_data, *U_residual_data, *P_residual_data, D, dx);
+                applyBoxInverse(A_inv, r.data(), d_relaxation_weight, i, *U_error_data, *P_error_data);
             }
         }
     }
@@ -626,10 +626,7 @@ StaggeredStokesBoxRelaxationFACOperator::initializeOperatorStateSpecialized(cons
                                                                             const int finest_reset_ln)
 {
     // Initialize the box relaxation data on each level of the patch hierarchy.
-    d_box_op.resize(d_finest_ln + 1);
-    d_box_e.resize(d_finest_ln + 1);
-    d_box_r.resize(d_finest_ln + 1);
-    d_box_ksp.resize(d_finest_ln + 1);
+    d_box_inv.resize(d_finest_ln + 1);
     const Box<NDIM> box(hier::Index<NDIM>(0), hier::Index<NDIM>(0));
     Pointer<CartesianGridGeometry<NDIM> > geometry = d_hierarchy->getGridGeometry();
     const double* const dx_coarsest = geometry->getDx();
@@ -641,26 +638,10 @@ StaggeredStokesBoxRelaxationFACOperator::initializeOperatorStateSpecialized(cons
         {
             dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
         }
-        buildBoxOperator(d_box_op[ln], d_U_problem_coefs, box, box, dx);
-        int ierr;
-        ierr = MatCreateVecs(d_box_op[ln], &d_box_e[ln], &d_box_r[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPCreate(PETSC_COMM_SELF, &d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetOperators(d_box_ksp[ln], d_box_op[ln], d_box_op[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetReusePreconditioner(d_box_ksp[ln], PETSC_TRUE);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetType(d_box_ksp[ln], KSPPREONLY);
-        IBTK_CHKERRQ(ierr);
-        PC box_pc;
-        ierr = KSPGetPC(d_box_ksp[ln], &box_pc);
-        IBTK_CHKERRQ(ierr);
-        ierr = PCSetType(box_pc, PCLU);
-        IBTK_CHKERRQ(ierr);
-        ierr = PCFactorReorderForNonzeroDiagonal(box_pc, std::numeric_limits<double>::epsilon());
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetUp(d_box_ksp[ln]);
+        Mat box_op;
+        buildBoxOperator(box_op, d_U_problem_coefs, box, box, dx);
+        computeBoxInverse(d_box_inv[ln], box_op);
+        int ierr = MatDestroy(&box_op);
         IBTK_CHKERRQ(ierr);
     }
 
@@ -715,15 +696,7 @@ StaggeredStokesBoxRelaxationFACOperator::deallocateOperatorStateSpecialized(cons
     if (!d_is_initialized) return;
     for (int ln = coarsest_reset_ln; ln <= std::min(d_finest_ln, finest_reset_ln); ++ln)
     {
-        int ierr;
-        ierr = MatDestroy(&d_box_op[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecDestroy(&d_box_e[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecDestroy(&d_box_r[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPDestroy(&d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
+        d_box_inv[ln].clear();
         d_patch_side_bc_box_overlap[ln].resize(0);
         d_patch_cell_bc_box_overlap[ln].resize(0);
     }
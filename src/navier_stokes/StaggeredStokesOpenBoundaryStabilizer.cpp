@@ -28,6 +28,7 @@
 #include "Index.h"
 #include "IntVector.h"
 #include "Patch.h"
+#include "PatchLevel.h"
 #include "SideData.h"
 #include "SideGeometry.h"
 #include "SideIndex.h"
@@ -37,18 +38,13 @@
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <map>
 #include <ostream>
 #include <string>
-
-namespace SAMRAI
-{
-namespace hier
-{
-template <int DIM>
-class PatchLevel;
-} // namespace hier
-} // namespace SAMRAI
+#include <vector>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -140,6 +136,139 @@ StaggeredStokesOpenBoundaryStabilizer::setDataOnPatch(const int data_idx,
 #endif
     F_data->fillAll(0.0);
     if (initial_time) return;
+    const std::array<Box<NDIM>, 2 * NDIM> layer_boxes = getLayerBoxes(patch);
+    if (std::all_of(layer_boxes.begin(), layer_boxes.end(), [](const Box<NDIM>& box) { return box.empty(); }))
+    {
+        return;
+    }
+    addDataOnPatchLayers(F_data, patch, layer_boxes);
+    return;
+} // setDataOnPatch
+
+bool
+StaggeredStokesOpenBoundaryStabilizer::supportsAddDataOnPatch() const
+{
+    return true;
+} // supportsAddDataOnPatch
+
+void
+StaggeredStokesOpenBoundaryStabilizer::addDataOnPatch(const int data_idx,
+                                                      Pointer<Variable<NDIM> > /*var*/,
+                                                      Pointer<Patch<NDIM> > patch,
+                                                      const double /*data_time*/,
+                                                      const bool initial_time,
+                                                      Pointer<PatchLevel<NDIM> > /*level*/)
+{
+    if (initial_time) return;
+    const std::array<Box<NDIM>, 2 * NDIM> layer_boxes = getLayerBoxes(patch);
+    if (std::all_of(layer_boxes.begin(), layer_boxes.end(), [](const Box<NDIM>& box) { return box.empty(); }))
+    {
+        return;
+    }
+    addDataOnPatchLayers(patch->getPatchData(data_idx), patch, layer_boxes);
+    return;
+} // addDataOnPatch
+
+void
+StaggeredStokesOpenBoundaryStabilizer::setDataOnPatchLevel(const int data_idx,
+                                                           Pointer<Variable<NDIM> > /*var*/,
+                                                           Pointer<PatchLevel<NDIM> > level,
+                                                           const double /*data_time*/,
+                                                           const bool initial_time)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(level);
+#endif
+    // Redetermine the layer boxes if the level has been regridded or load
+    // balanced since they were last determined.
+    const int ln = level->getLevelNumber();
+    if (ln >= static_cast<int>(d_level_boxes.size()))
+    {
+        d_level_boxes.resize(ln + 1);
+        d_level_patch_owners.resize(ln + 1);
+        d_layer_boxes.resize(ln + 1);
+    }
+    const BoxArray<NDIM>& boxes = level->getBoxes();
+    bool level_changed = boxes.getNumberOfBoxes() != d_level_boxes[ln].getNumberOfBoxes();
+    for (int k = 0; !level_changed && k < boxes.getNumberOfBoxes(); ++k)
+    {
+        level_changed =
+            !(boxes[k] == d_level_boxes[ln][k]) || level->getMappingForPatch(k) != d_level_patch_owners[ln][k];
+    }
+    if (level_changed)
+    {
+        d_level_boxes[ln] = boxes;
+        d_level_patch_owners[ln].resize(boxes.getNumberOfBoxes());
+        for (int k = 0; k < boxes.getNumberOfBoxes(); ++k) d_level_patch_owners[ln][k] = level->getMappingForPatch(k);
+        d_layer_boxes[ln].clear();
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const std::array<Box<NDIM>, 2 * NDIM> layer_boxes = getLayerBoxes(level->getPatch(p()));
+            if (std::any_of(
+                    layer_boxes.begin(), layer_boxes.end(), [](const Box<NDIM>& box) { return !box.empty(); }))
+            {
+                d_layer_boxes[ln][p()] = layer_boxes;
+            }
+        }
+    }
+
+    // Zero out the forcing everywhere and then set it only on the parts of the
+    // patches that intersect the boundary layers.
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<SideData<NDIM, double> > F_data = level->getPatch(p())->getPatchData(data_idx);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(F_data);
+#endif
+        F_data->fillAll(0.0);
+    }
+    if (initial_time) return;
+    for (const auto& patch_layer_boxes : d_layer_boxes[ln])
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(patch_layer_boxes.first);
+        addDataOnPatchLayers(patch->getPatchData(data_idx), patch, patch_layer_boxes.second);
+    }
+    return;
+} // setDataOnPatchLevel
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+std::array<Box<NDIM>, 2 * NDIM>
+StaggeredStokesOpenBoundaryStabilizer::getLayerBoxes(Pointer<Patch<NDIM> > patch) const
+{
+    std::array<Box<NDIM>, 2 * NDIM> layer_boxes;
+    const Box<NDIM>& patch_box = patch->getBox();
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    const IntVector<NDIM>& ratio = pgeom->getRatio();
+    const Box<NDIM> domain_box = Box<NDIM>::refine(d_grid_geometry->getPhysicalDomain()[0], ratio);
+    for (unsigned int location_index = 0; location_index < 2 * NDIM; ++location_index)
+    {
+        if (!d_open_bdry[location_index]) continue;
+        const unsigned int axis = location_index / 2;
+        const bool is_lower = location_index % 2 == 0;
+        Box<NDIM> bdry_box = domain_box;
+        const int offset = static_cast<int>(d_width[location_index] / dx[axis]);
+        if (is_lower)
+        {
+            bdry_box.upper(axis) = domain_box.lower(axis) + offset;
+        }
+        else
+        {
+            bdry_box.lower(axis) = domain_box.upper(axis) - offset;
+        }
+        layer_boxes[location_index] = bdry_box * patch_box;
+    }
+    return layer_boxes;
+} // getLayerBoxes
+
+void
+StaggeredStokesOpenBoundaryStabilizer::addDataOnPatchLayers(Pointer<SideData<NDIM, double> > F_data,
+                                                            Pointer<Patch<NDIM> > patch,
+                                                            const std::array<Box<NDIM>, 2 * NDIM>& layer_boxes)
+{
     const int cycle_num = d_fluid_solver->getCurrentCycleNumber();
     const double dt = d_fluid_solver->getCurrentTimeStepSize();
     const double rho = d_fluid_solver->getStokesSpecifications()->getRho();
@@ -155,53 +284,31 @@ StaggeredStokesOpenBoundaryStabilizer::setDataOnPatch(const int data_idx,
     Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
     const double* const x_lower = pgeom->getXLower();
-    const double* const x_upper = pgeom->getXUpper();
-    const IntVector<NDIM>& ratio = pgeom->getRatio();
-    const Box<NDIM> domain_box = Box<NDIM>::refine(d_grid_geometry->getPhysicalDomain()[0], ratio);
+    const double* const domain_x_lower = d_grid_geometry->getXLower();
+    const double* const domain_x_upper = d_grid_geometry->getXUpper();
     for (unsigned int location_index = 0; location_index < 2 * NDIM; ++location_index)
     {
+        if (layer_boxes[location_index].empty()) continue;
         const unsigned int axis = location_index / 2;
-        const unsigned int side = location_index % 2;
-        const bool is_lower = side == 0;
-        if (d_open_bdry[location_index] && pgeom->getTouchesRegularBoundary(axis, side))
+        const bool is_lower = location_index % 2 == 0;
+        const double x_bdry = (is_lower ? domain_x_lower[axis] : domain_x_upper[axis]);
+        const double n = is_lower ? -1.0 : +1.0;
+        for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(layer_boxes[location_index], axis)); b; b++)
         {
-            Box<NDIM> bdry_box = domain_box;
-            const int offset = static_cast<int>(d_width[location_index] / dx[axis]);
-            if (is_lower)
+            const hier::Index<NDIM>& i = b();
+            const SideIndex<NDIM> i_s(i, axis, SideIndex<NDIM>::Lower);
+            const double U_current = U_current_data ? (*U_current_data)(i_s) : 0.0;
+            const double U_new = U_new_data ? (*U_new_data)(i_s) : 0.0;
+            const double U = (cycle_num > 0) ? 0.5 * (U_new + U_current) : U_current;
+            if ((d_inflow_bdry[location_index] && U * n > 0.0) || (d_outflow_bdry[location_index] && U * n < 0.0))
             {
-                bdry_box.upper(axis) = domain_box.lower(axis) + offset;
-            }
-            else
-            {
-                bdry_box.lower(axis) = domain_box.upper(axis) - offset;
-            }
-            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(bdry_box * patch_box, axis)); b; b++)
-            {
-                const hier::Index<NDIM>& i = b();
-                const SideIndex<NDIM> i_s(i, axis, SideIndex<NDIM>::Lower);
-                const double U_current = U_current_data ? (*U_current_data)(i_s) : 0.0;
-                const double U_new = U_new_data ? (*U_new_data)(i_s) : 0.0;
-                const double U = (cycle_num > 0) ? 0.5 * (U_new + U_current) : U_current;
-                const double n = is_lower ? -1.0 : +1.0;
-                if ((d_inflow_bdry[location_index] && U * n > 0.0) || (d_outflow_bdry[location_index] && U * n < 0.0))
-                {
-                    const double x = x_lower[axis] + dx[axis] * static_cast<double>(i(axis) - patch_box.lower(axis));
-                    const double x_bdry = (is_lower ? x_lower[axis] : x_upper[axis]);
-                    (*F_data)(i_s) = smooth_kernel((x - x_bdry) / d_width[location_index]) * kappa * (0.0 - U);
-                }
+                const double x = x_lower[axis] + dx[axis] * static_cast<double>(i(axis) - patch_box.lower(axis));
+                (*F_data)(i_s) += smooth_kernel((x - x_bdry) / d_width[location_index]) * kappa * (0.0 - U);
             }
         }
     }
     return;
-} // setDataOnPatch
-
-/////////////////////////////// PROTECTED ////////////////////////////////////
-
-/////////////////////////////// PRIVATE //////////////////////////////////////
-
-/////////////////////////////// PROTECTED ////////////////////////////////////
-
-/////////////////////////////// PRIVATE //////////////////////////////////////
+} // addDataOnPatchLayers
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -22,7 +22,6 @@
 #include "ibtk/GeneralSolver.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
-#include "ibtk/LinearSolver.h"
 #include "ibtk/PoissonSolver.h"
 
 #include "CellVariable.h"
@@ -45,6 +44,7 @@
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
 #include <ostream>
 #include <string>
 
@@ -82,7 +82,7 @@ static Timer* t_deallocate_solver_state;
 
 StaggeredStokesProjectionPreconditioner::StaggeredStokesProjectionPreconditioner(
     const std::string& object_name,
-    Pointer<Database> /*input_db*/,
+    Pointer<Database> input_db,
     const std::string& /*default_options_prefix*/)
     : StaggeredStokesBlockPreconditioner(/*needs_velocity_solver*/ true,
                                          /*needs_pressure_solver*/ true)
@@ -94,6 +94,10 @@ StaggeredStokesProjectionPreconditioner::StaggeredStokesProjectionPreconditioner
     d_initial_guess_nonzero = false;
     d_max_iterations = 1;
 
+    // Determine whether to apply the subdomain solvers inexactly.
+    if (input_db && input_db->keyExists("inexact_subdomain_solves"))
+        d_inexact_subdomain_solves = input_db->getBool("inexact_subdomain_solves");
+
     // Setup variables.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     Pointer<VariableContext> context = var_db->getContext(d_object_name + "::CONTEXT");
@@ -201,22 +205,12 @@ StaggeredStokesProjectionPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, doub
     P_vec = new SAMRAIVectorReal<NDIM, double>(d_object_name + "::P", d_hierarchy, d_coarsest_ln, d_finest_ln);
     P_vec->addComponent(P_cc_var, P_idx, d_pressure_wgt_idx, d_pressure_data_ops);
 
-    // Allocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_Phi_scratch_idx);
-        level->allocatePatchData(d_F_Phi_idx);
-    }
-
     // (1) Solve the velocity sub-problem for an initial approximation to U.
     //
     // U^* := inv(rho/dt - K*mu*L) F_U
     //
     // An approximate Helmholtz solver is used.
-    d_velocity_solver->setHomogeneousBc(true);
-    auto p_velocity_solver = dynamic_cast<LinearSolver*>(d_velocity_solver.getPointer());
-    if (p_velocity_solver) p_velocity_solver->setInitialGuessNonzero(false);
+    setupSubdomainSolver(*d_velocity_solver, /*initial_guess_nonzero*/ false);
     d_velocity_solver->solveSystem(*U_vec, *F_U_vec);
 
     // (2) Solve the pressure sub-problem.
@@ -263,9 +257,7 @@ StaggeredStokesProjectionPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, doub
                          -1.0,
                          F_P_idx,
                          F_P_cc_var);
-    d_pressure_solver->setHomogeneousBc(true);
-    auto p_pressure_solver = dynamic_cast<LinearSolver*>(d_pressure_solver.getPointer());
-    p_pressure_solver->setInitialGuessNonzero(false);
+    setupSubdomainSolver(*d_pressure_solver, /*initial_guess_nonzero*/ false);
     d_pressure_solver->solveSystem(*Phi_scratch_vec, *F_Phi_vec);
     if (steady_state)
     {
@@ -312,14 +304,6 @@ StaggeredStokesProjectionPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, doub
     // Account for nullspace vectors.
     correctNullspace(U_vec, P_vec);
 
-    // Deallocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_Phi_scratch_idx);
-        level->deallocatePatchData(d_F_Phi_idx);
-    }
-
     // Deallocate the solver (if necessary).
     if (deallocate_at_completion) deallocateSolverState();
 
@@ -353,6 +337,16 @@ StaggeredStokesProjectionPreconditioner::initializeSolverState(const SAMRAIVecto
     d_Phi_bdry_fill_op->setHomogeneousBc(true);
     d_Phi_bdry_fill_op->initializeOperatorState(P_scratch_component, d_hierarchy);
 
+    // Allocate scratch data.  The scratch data are kept for the lifetime of
+    // the solver state so that repeated applications of the preconditioner do
+    // not reallocate them.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(d_Phi_scratch_idx)) level->allocatePatchData(d_Phi_scratch_idx);
+        if (!level->checkAllocated(d_F_Phi_idx)) level->allocatePatchData(d_F_Phi_idx);
+    }
+
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_solver_state);
@@ -366,6 +360,14 @@ StaggeredStokesProjectionPreconditioner::deallocateSolverState()
 
     IBAMR_TIMER_START(t_deallocate_solver_state);
 
+    // Deallocate scratch data.
+    for (int ln = d_coarsest_ln; ln <= std::min(d_finest_ln, d_hierarchy->getFinestLevelNumber()); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_Phi_scratch_idx)) level->deallocatePatchData(d_Phi_scratch_idx);
+        if (level->checkAllocated(d_F_Phi_idx)) level->deallocatePatchData(d_F_Phi_idx);
+    }
+
     // Parent class deallocation.
     StaggeredStokesBlockPreconditioner::deallocateSolverState();
 
@@ -27,7 +27,6 @@
 #include "Box.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
-#include "CellIndex.h"
 #include "CellVariable.h"
 #include "HierarchyCellDataOpsReal.h"
 #include "IntVector.h"
@@ -260,8 +259,11 @@ SurfaceTensionForceFunction::setDataOnPatchHierarchy(const int data_idx,
     TBOX_ASSERT(phi_adv_diff_current_idx >= 0);
 #endif
 
+    // The smoothed indicator function, its gradient, and the curvature are
+    // all computed patch by patch from the level set, so a single ghost cell
+    // fill of the level set that is wide enough for the entire stencil
+    // suffices.
     IntVector<NDIM> cell_ghosts = getMinimumGhostWidth(d_kernel_fcn);
-    d_C_idx = var_db->registerVariableAndContext(phi_cc_var, var_db->getContext(d_object_name + "::C"), cell_ghosts);
     d_phi_idx =
         var_db->registerVariableAndContext(phi_cc_var, var_db->getContext(d_object_name + "::Phi"), cell_ghosts);
 
@@ -269,11 +271,10 @@ SurfaceTensionForceFunction::setDataOnPatchHierarchy(const int data_idx,
     const int finest_ln = (finest_ln_in == -1 ? hierarchy->getFinestLevelNumber() : finest_ln_in);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
-        hierarchy->getPatchLevel(ln)->allocatePatchData(d_C_idx, data_time);
         hierarchy->getPatchLevel(ln)->allocatePatchData(d_phi_idx, data_time);
     }
 
-    // Copy level set into phi and C.
+    // Copy level set into phi.
     HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(hierarchy, coarsest_ln, finest_ln);
     if (d_ts_type == MIDPOINT_RULE)
     {
@@ -303,42 +304,26 @@ SurfaceTensionForceFunction::setDataOnPatchHierarchy(const int data_idx,
                       "MIDPOINT_RULE"
                    << std::endl);
     }
-    hier_cc_data_ops.copyData(d_C_idx, d_phi_idx, /*interior_only*/ true);
-
-    // Convert C to a smoothed heaviside to ensure that the force is only
-    // applied near the interface
-    convertToHeaviside(d_C_idx, coarsest_ln, finest_ln, hierarchy);
 
     // Fill ghost cells
     RobinBcCoefStrategy<NDIM>* phi_bc_coef = (d_adv_diff_solver->getPhysicalBcCoefs(phi_cc_var)).front();
     using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
-    InterpolationTransactionComponent C_transaction(
-        d_C_idx, "CONSERVATIVE_LINEAR_REFINE", true, "CONSERVATIVE_COARSEN", "LINEAR", false, phi_bc_coef);
     InterpolationTransactionComponent phi_transaction(
         d_phi_idx, "CONSERVATIVE_LINEAR_REFINE", true, "CONSERVATIVE_COARSEN", "LINEAR", false, phi_bc_coef);
-    Pointer<HierarchyGhostCellInterpolation> C_fill_op = new HierarchyGhostCellInterpolation();
     Pointer<HierarchyGhostCellInterpolation> phi_fill_op = new HierarchyGhostCellInterpolation();
-    C_fill_op->initializeOperatorState(C_transaction, hierarchy, coarsest_ln, finest_ln);
     phi_fill_op->initializeOperatorState(phi_transaction, hierarchy, coarsest_ln, finest_ln);
-
-    C_fill_op->fillData(data_time);
     phi_fill_op->fillData(data_time);
 
-    // Mollify C.
-    mollifyData(d_C_idx, coarsest_ln, finest_ln, data_time, hierarchy, C_fill_op);
-
     // Fill data on each patch level
     CartGridFunction::setDataOnPatchHierarchy(
         data_idx, var, hierarchy, data_time, initial_time, coarsest_ln_in, finest_ln_in);
 
-    // Deallocate and remove scratch/smooth phi.
+    // Deallocate and remove scratch phi.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         hierarchy->getPatchLevel(ln)->deallocatePatchData(d_phi_idx);
-        hierarchy->getPatchLevel(ln)->deallocatePatchData(d_C_idx);
     }
     var_db->removePatchDataIndex(d_phi_idx);
-    var_db->removePatchDataIndex(d_C_idx);
 
     return;
 } // setDataOnPatchHierarchy
@@ -374,104 +359,87 @@ SurfaceTensionForceFunction::setDataOnPatch(const int data_idx,
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
-void
-SurfaceTensionForceFunction::convertToHeaviside(int phi_idx,
-                                                int coarsest_ln,
-                                                int finest_ln,
-                                                Pointer<PatchHierarchy<NDIM> > patch_hierarchy)
+bool
+SurfaceTensionForceFunction::computeIndicatorOnPatch(CellData<NDIM, double>& C_data,
+                                                     const CellData<NDIM, double>& phi_data,
+                                                     Pointer<Patch<NDIM> > patch)
 {
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+    const double* const patch_dx = patch_geom->getDx();
+    double vol_cell = 1.0;
+    for (int d = 0; d < NDIM; ++d) vol_cell *= patch_dx[d];
+    const double eps = d_num_interface_cells * std::pow(vol_cell, 1.0 / static_cast<double>(NDIM));
+
+    // The smoothed Heaviside function is constant away from the interface, in
+    // which case its gradient, and hence the force, vanishes on the patch.
+    const double* const phi = phi_data.getPointer();
+    const int num_phi = phi_data.getGhostBox().size();
+    bool all_inside = true, all_outside = true;
+    for (int k = 0; k < num_phi && (all_inside || all_outside); ++k)
     {
-        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-            const double* const patch_dx = patch_geom->getDx();
-            double vol_cell = 1.0;
-            for (int d = 0; d < NDIM; ++d) vol_cell *= patch_dx[d];
-            double eps = d_num_interface_cells * std::pow(vol_cell, 1.0 / static_cast<double>(NDIM));
-
-            const Box<NDIM>& patch_box = patch->getBox();
-            Pointer<CellData<NDIM, double> > phi_data = patch->getPatchData(phi_idx);
-            for (Box<NDIM>::Iterator it(patch_box); it; it++)
-            {
-                CellIndex<NDIM> ci(it());
-                const double phi = (*phi_data)(ci);
-                if (phi <= -eps)
-                {
-                    (*phi_data)(ci) = 0.0;
-                }
-                else if (phi >= eps)
-                {
-                    (*phi_data)(ci) = 1.0;
-                }
-                else
-                {
-                    (*phi_data)(ci) = 0.5 + 0.5 * phi / eps + 1.0 / (2.0 * M_PI) * std::sin(M_PI * phi / eps);
-                }
-            }
-        }
+        all_inside = all_inside && phi[k] <= -eps;
+        all_outside = all_outside && phi[k] >= eps;
     }
-    return;
-} // convertToHeaviside
+    if (all_inside || all_outside) return false;
 
-void
-SurfaceTensionForceFunction::mollifyData(int smooth_C_idx,
-                                         int coarsest_ln,
-                                         int finest_ln,
-                                         double data_time,
-                                         Pointer<PatchHierarchy<NDIM> > hierarchy,
-                                         Pointer<HierarchyGhostCellInterpolation> fill_op)
-{
-    if (d_kernel_fcn == "none") return;
-
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    // Convert phi to a smoothed Heaviside function, including all of its ghost
+    // cells.
+    CellData<NDIM, double> H_data(patch->getBox(), /*depth*/ 1, phi_data.getGhostCellWidth());
+    double* const H = H_data.getPointer();
+    for (int k = 0; k < num_phi; ++k)
     {
-        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        if (phi[k] <= -eps)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            const Box<NDIM>& patch_box = patch->getBox();
-
-            Pointer<CellData<NDIM, double> > smooth_C_data = patch->getPatchData(smooth_C_idx);
-            CellData<NDIM, double> C_data(patch_box, /*depth*/ 1, smooth_C_data->getGhostCellWidth());
-
-            C_data.copy(*smooth_C_data);
-
-            double* const V = smooth_C_data->getPointer(0);
-            const double* const U = C_data.getPointer(0);
-            const int V_gcw = (smooth_C_data->getGhostCellWidth()).max();
-            const int U_gcw = (C_data.getGhostCellWidth()).max();
+            H[k] = 0.0;
+        }
+        else if (phi[k] >= eps)
+        {
+            H[k] = 1.0;
+        }
+        else
+        {
+            H[k] = 0.5 + 0.5 * phi[k] / eps + 1.0 / (2.0 * M_PI) * std::sin(M_PI * phi[k] / eps);
+        }
+    }
 
-            if (d_kernel_fcn == "IB_4")
-            {
-                MOLLIFY_IB_4_FC(V,
-                                V_gcw,
-                                U,
-                                U_gcw,
-                                patch_box.lower(0),
-                                patch_box.upper(0),
-                                patch_box.lower(1),
-                                patch_box.upper(1)
+    // Mollify H into C on the patch and on as many ghost cells as the stencil
+    // of the kernel allows.
+    const IntVector<NDIM>& C_gcw = C_data.getGhostCellWidth();
+    if (d_kernel_fcn == "none")
+    {
+        C_data.copy(H_data);
+        return true;
+    }
+    Box<NDIM> mollify_box = patch->getBox();
+    mollify_box.grow(C_gcw);
+    const int V_gcw = 0;
+    const int U_gcw = H_data.getGhostCellWidth().max() - C_gcw.max();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(U_gcw >= getStencilSize(d_kernel_fcn) / 2 - 1);
+#endif
+    if (d_kernel_fcn == "IB_4")
+    {
+        MOLLIFY_IB_4_FC(C_data.getPointer(),
+                        V_gcw,
+                        H,
+                        U_gcw,
+                        mollify_box.lower(0),
+                        mollify_box.upper(0),
+                        mollify_box.lower(1),
+                        mollify_box.upper(1)
 #if (NDIM == 3)
-                                    ,
-                                patch_box.lower(2),
-                                patch_box.upper(2)
+                            ,
+                        mollify_box.lower(2),
+                        mollify_box.upper(2)
 #endif
-                );
-            }
-            else
-            {
-                TBOX_ERROR("this statement should not be reached");
-            }
-        }
+        );
     }
-
-    if (fill_op) fill_op->fillData(data_time);
-
-    return;
-} // mollifyData
+    else
+    {
+        TBOX_ERROR("this statement should not be reached");
+    }
+    return true;
+} // computeIndicatorOnPatch
 
 void
 SurfaceTensionForceFunction::setDataOnPatchCell(Pointer<CellData<NDIM, double> > /*F_data*/,
@@ -499,12 +467,17 @@ SurfaceTensionForceFunction::setDataOnPatchSide(Pointer<SideData<NDIM, double> >
     Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
 
+    // Compute the smoothed indicator C from phi. Patches away from the
+    // interface are skipped; F_data has already been zeroed.
+    Pointer<CellData<NDIM, double> > Phi = patch->getPatchData(d_phi_idx);
+    CellData<NDIM, double> C(patch_box, /*depth*/ 1, /*gcw*/ IntVector<NDIM>(2));
+    if (!computeIndicatorOnPatch(C, *Phi, patch)) return;
+
     // First find normal in terms of gradient of phi.
     // N = grad(phi)
     SideData<NDIM, double> N(patch_box,
                              /*depth*/ NDIM,
                              /*gcw*/ IntVector<NDIM>(2));
-    Pointer<CellData<NDIM, double> > Phi = patch->getPatchData(d_phi_idx);
 
     SC_NORMAL_FC(N.getPointer(0, 0),
                  N.getPointer(0, 1),
@@ -562,7 +535,6 @@ SurfaceTensionForceFunction::setDataOnPatchSide(Pointer<SideData<NDIM, double> >
                     dx);
 
     // Compute N = grad(C)
-    Pointer<CellData<NDIM, double> > C = patch->getPatchData(d_C_idx);
 
     SC_NORMAL_FC(N.getPointer(0, 0),
                  N.getPointer(0, 1),
@@ -578,8 +550,8 @@ SurfaceTensionForceFunction::setDataOnPatchSide(Pointer<SideData<NDIM, double> >
                  N.getPointer(2, 2),
 #endif
                  N.getGhostCellWidth().max(),
-                 C->getPointer(),
-                 C->getGhostCellWidth().max(),
+                 C.getPointer(),
+                 C.getGhostCellWidth().max(),
                  patch_box.lower(0),
                  patch_box.upper(0),
                  patch_box.lower(1),
@@ -250,6 +250,50 @@ RNG::genrandn(double* result)
     return;
 } // genrandn
 
+namespace
+{
+// Compute one Philox4x32-10 block (J. K. Salmon et al., "Parallel random
+// numbers: as easy as 1, 2, 3", SC11).
+inline void
+philox4x32_10(std::uint32_t ctr[4], std::uint32_t k0, std::uint32_t k1)
+{
+    static const std::uint32_t PHILOX_M0 = 0xD2511F53, PHILOX_M1 = 0xCD9E8D57;
+    static const std::uint32_t PHILOX_W0 = 0x9E3779B9, PHILOX_W1 = 0xBB67AE85;
+    for (int round = 0; round < 10; ++round)
+    {
+        const std::uint64_t p0 = static_cast<std::uint64_t>(PHILOX_M0) * ctr[0];
+        const std::uint64_t p1 = static_cast<std::uint64_t>(PHILOX_M1) * ctr[2];
+        const auto hi0 = static_cast<std::uint32_t>(p0 >> 32), lo0 = static_cast<std::uint32_t>(p0);
+        const auto hi1 = static_cast<std::uint32_t>(p1 >> 32), lo1 = static_cast<std::uint32_t>(p1);
+        ctr[0] = hi1 ^ ctr[1] ^ k0;
+        ctr[1] = lo1;
+        ctr[2] = hi0 ^ ctr[3] ^ k1;
+        ctr[3] = lo0;
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+    return;
+} // philox4x32_10
+} // namespace
+
+void
+RNG::genrandn(double* result, const int n, const std::uint32_t counter[4], const std::uint32_t key[2])
+{
+    // Generate all of the uniformly distributed values in (0,1) before they
+    // are transformed, so that the integer arithmetic may be vectorized.
+    for (int m = 0; m < n; ++m)
+    {
+        std::uint32_t ctr[4] = { counter[0] + static_cast<std::uint32_t>(m), counter[1], counter[2], counter[3] };
+        philox4x32_10(ctr, key[0], key[1]);
+        result[m] = (static_cast<double>(ctr[0]) + 0.5) * 2.3283064365386963e-10;
+    }
+    for (int m = 0; m < n; ++m)
+    {
+        result[m] = InvNormDist(result[m]);
+    }
+    return;
+} // genrandn
+
 void
 RNG::parallel_seed(int global_seed)
 {
@@ -71,6 +71,10 @@ IrregularWaveBcCoef::IrregularWaveBcCoef(std::string object_name,
     d_wave_number.resize(d_num_waves);
     d_omega.resize(d_num_waves);
     d_phase.resize(d_num_waves);
+    d_velocity_factor.resize(d_num_waves);
+    d_time_phase.resize(d_num_waves);
+    d_cos_phase.resize(d_num_waves);
+    d_sin_phase.resize(d_num_waves);
 
     double delta_omega = std::abs(d_omega_end - d_omega_begin) / (d_num_waves - 1);
     double omega_s = 2 * M_PI / d_Ts;
@@ -128,6 +132,7 @@ IrregularWaveBcCoef::IrregularWaveBcCoef(std::string object_name,
             }
 
             d_amplitude[i] = std::sqrt(2.0 * spectral_density * delta_omega);
+            d_velocity_factor[i] = d_amplitude[i] * d_omega[i] / sinh(d_wave_number[i] * d_depth);
         }
     }
 
@@ -269,11 +274,11 @@ IrregularWaveBcCoef::getFromInput(Pointer<Database> input_db)
 double
 IrregularWaveBcCoef::getSurfaceElevation(double x, double time) const
 {
+    const std::vector<double>& cos_phase = getCosPhaseTable(x, time);
     double eta = 0;
     for (int i = 0; i < d_num_waves; i++)
     {
-        const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-        eta += d_amplitude[i] * cos(theta);
+        eta += d_amplitude[i] * cos_phase[i];
     }
 
     return eta;
@@ -284,24 +289,22 @@ IrregularWaveBcCoef::getVelocity(double x, double z_plus_d, double time) const
 {
     if (d_comp_idx == 0)
     {
+        const std::vector<double>& cos_phase = getCosPhaseTable(x, time);
         double velocity_component = 0.0;
         for (int i = 0; i < d_num_waves; i++)
         {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * cosh(d_wave_number[i] * z_plus_d) * cos(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
+            velocity_component += d_velocity_factor[i] * cosh(d_wave_number[i] * z_plus_d) * cos_phase[i];
         }
         return velocity_component;
     }
     if (d_comp_idx == 1)
     {
 #if (NDIM == 2)
+        const std::vector<double>& sin_phase = getSinPhaseTable(x, time);
         double velocity_component = 0.0;
         for (int i = 0; i < d_num_waves; i++)
         {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * sinh(d_wave_number[i] * z_plus_d) * sin(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
+            velocity_component += d_velocity_factor[i] * sinh(d_wave_number[i] * z_plus_d) * sin_phase[i];
         }
         return velocity_component;
 
@@ -312,21 +315,73 @@ IrregularWaveBcCoef::getVelocity(double x, double z_plus_d, double time) const
 #if (NDIM == 3)
     if (d_comp_idx == 2)
     {
+        const std::vector<double>& sin_phase = getSinPhaseTable(x, time);
         double velocity_component = 0.0;
         for (int i = 0; i < d_num_waves; i++)
         {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * sinh(d_wave_number[i] * z_plus_d) * sin(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
+            velocity_component += d_velocity_factor[i] * sinh(d_wave_number[i] * z_plus_d) * sin_phase[i];
         }
         return velocity_component;
     }
 #endif
 
     return std::numeric_limits<double>::signaling_NaN();
-    ;
 } // getVelocity
 
+const std::vector<double>&
+IrregularWaveBcCoef::getCosPhaseTable(double x, double time) const
+{
+    setPhaseTablePosition(x, time);
+    if (!d_cos_phase_valid)
+    {
+        for (int i = 0; i < d_num_waves; i++)
+        {
+            d_cos_phase[i] = cos(d_wave_number[i] * x + d_time_phase[i]);
+        }
+        d_cos_phase_valid = true;
+    }
+    return d_cos_phase;
+} // getCosPhaseTable
+
+const std::vector<double>&
+IrregularWaveBcCoef::getSinPhaseTable(double x, double time) const
+{
+    setPhaseTablePosition(x, time);
+    if (!d_sin_phase_valid)
+    {
+        for (int i = 0; i < d_num_waves; i++)
+        {
+            d_sin_phase[i] = sin(d_wave_number[i] * x + d_time_phase[i]);
+        }
+        d_sin_phase_valid = true;
+    }
+    return d_sin_phase;
+} // getSinPhaseTable
+
+void
+IrregularWaveBcCoef::setPhaseTablePosition(double x, double time) const
+{
+    // NOTE: The tables are initially evaluated at NaN, which never compares
+    // equal to a requested position or time.
+    if (time != d_table_time)
+    {
+        for (int i = 0; i < d_num_waves; i++)
+        {
+            d_time_phase[i] = d_phase[i] - d_omega[i] * time;
+        }
+        d_table_time = time;
+        d_cos_phase_valid = false;
+        d_sin_phase_valid = false;
+    }
+    if (x != d_table_x)
+    {
+        d_table_x = x;
+        d_cos_phase_valid = false;
+        d_sin_phase_valid = false;
+    }
+    return;
+} // setPhaseTablePosition
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
@@ -44,6 +44,10 @@ IrregularWaveGenerator::IrregularWaveGenerator(const std::string& object_name, P
     d_wave_number.resize(d_num_waves);
     d_omega.resize(d_num_waves);
     d_phase.resize(d_num_waves);
+    d_velocity_factor.resize(d_num_waves);
+    d_time_phase.resize(d_num_waves);
+    d_cos_phase.resize(d_num_waves);
+    d_sin_phase.resize(d_num_waves);
 
     double delta_omega = std::abs(d_omega_end - d_omega_begin) / (d_num_waves - 1);
     double omega_s = 2 * M_PI / d_Ts;
@@ -90,6 +94,7 @@ IrregularWaveGenerator::IrregularWaveGenerator(const std::string& object_name, P
                        << d_wave_spectrum << " .This class supports only JONSWAP and BRETSCHNEIDER wave spectra.");
         }
         d_amplitude[i] = std::sqrt(2.0 * spectral_density * delta_omega);
+        d_velocity_factor[i] = d_amplitude[i] * d_omega[i] / sinh(d_wave_number[i] * d_depth);
     }
 
     return;
@@ -98,11 +103,11 @@ IrregularWaveGenerator::IrregularWaveGenerator(const std::string& object_name, P
 double
 IrregularWaveGenerator::getSurfaceElevation(const double x, const double time) const
 {
+    const std::vector<double>& cos_phase = getCosPhaseTable(x, time);
     double eta = 0;
     for (int i = 0; i < d_num_waves; i++)
     {
-        const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-        eta += d_amplitude[i] * cos(theta);
+        eta += d_amplitude[i] * cos_phase[i];
     }
 
     return eta;
@@ -113,24 +118,22 @@ IrregularWaveGenerator::getVelocity(const double x, const double z_plus_d, const
 {
     if (comp_idx == 0)
     {
+        const std::vector<double>& cos_phase = getCosPhaseTable(x, time);
         double velocity_component = 0.0;
         for (int i = 0; i < d_num_waves; i++)
         {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * cosh(d_wave_number[i] * z_plus_d) * cos(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
+            velocity_component += d_velocity_factor[i] * cosh(d_wave_number[i] * z_plus_d) * cos_phase[i];
         }
         return velocity_component;
     }
     if (comp_idx == 1)
     {
 #if (NDIM == 2)
+        const std::vector<double>& sin_phase = getSinPhaseTable(x, time);
         double velocity_component = 0.0;
         for (int i = 0; i < d_num_waves; i++)
         {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * sinh(d_wave_number[i] * z_plus_d) * sin(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
+            velocity_component += d_velocity_factor[i] * sinh(d_wave_number[i] * z_plus_d) * sin_phase[i];
         }
         return velocity_component;
 
@@ -141,12 +144,11 @@ IrregularWaveGenerator::getVelocity(const double x, const double z_plus_d, const
 #if (NDIM == 3)
     if (comp_idx == 2)
     {
+        const std::vector<double>& sin_phase = getSinPhaseTable(x, time);
         double velocity_component = 0.0;
         for (int i = 0; i < d_num_waves; i++)
         {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * sinh(d_wave_number[i] * z_plus_d) * sin(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
+            velocity_component += d_velocity_factor[i] * sinh(d_wave_number[i] * z_plus_d) * sin_phase[i];
         }
         return velocity_component;
     }
@@ -192,4 +194,58 @@ IrregularWaveGenerator::getFromInput(Pointer<Database> input_db)
     return;
 } // getFromInput
 
+const std::vector<double>&
+IrregularWaveGenerator::getCosPhaseTable(const double x, const double time) const
+{
+    setPhaseTablePosition(x, time);
+    if (!d_cos_phase_valid)
+    {
+        for (int i = 0; i < d_num_waves; i++)
+        {
+            d_cos_phase[i] = cos(d_wave_number[i] * x + d_time_phase[i]);
+        }
+        d_cos_phase_valid = true;
+    }
+    return d_cos_phase;
+} // getCosPhaseTable
+
+const std::vector<double>&
+IrregularWaveGenerator::getSinPhaseTable(const double x, const double time) const
+{
+    setPhaseTablePosition(x, time);
+    if (!d_sin_phase_valid)
+    {
+        for (int i = 0; i < d_num_waves; i++)
+        {
+            d_sin_phase[i] = sin(d_wave_number[i] * x + d_time_phase[i]);
+        }
+        d_sin_phase_valid = true;
+    }
+    return d_sin_phase;
+} // getSinPhaseTable
+
+void
+IrregularWaveGenerator::setPhaseTablePosition(const double x, const double time) const
+{
+    // NOTE: The tables are initially evaluated at NaN, which never compares
+    // equal to a requested position or time.
+    if (time != d_table_time)
+    {
+        for (int i = 0; i < d_num_waves; i++)
+        {
+            d_time_phase[i] = d_phase[i] - d_omega[i] * time;
+        }
+        d_table_time = time;
+        d_cos_phase_valid = false;
+        d_sin_phase_valid = false;
+    }
+    if (x != d_table_x)
+    {
+        d_table_x = x;
+        d_cos_phase_valid = false;
+        d_sin_phase_valid = false;
+    }
+    return;
+} // setPhaseTablePosition
+
 } // namespace IBAMR
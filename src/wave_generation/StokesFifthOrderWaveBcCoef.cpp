@@ -40,7 +40,19 @@ namespace IBAMR
 namespace
 {
 static const int EXTENSIONS_FILLABLE = 128;
-}
+
+// Evaluate f(n * theta) for n = 1, ..., 5 via the recurrence f((n + 1) * theta)
+// = 2 c f(n * theta) - f((n - 1) * theta), which is satisfied by cos and sin
+// with c = cos(theta) and by cosh and sinh with c = cosh(theta).
+inline void
+evaluate_harmonics(const double c, const double f0, const double f1, double* const f)
+{
+    f[0] = f1;
+    f[1] = 2.0 * c * f1 - f0;
+    for (int n = 2; n < 5; ++n) f[n] = 2.0 * c * f[n - 1] - f[n - 2];
+    return;
+} // evaluate_harmonics
+} // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
@@ -284,6 +296,9 @@ StokesFifthOrderWaveBcCoef::initStokesCoefficients()
     d_eta[3] = ka4 * d_B[4][4];
     d_eta[4] = ka5 * d_B[5][5];
 
+    // Angular frequency from the wave dispersion relation.
+    d_omega = sqrt(d_gravity * d_wave_number) * (d_C[0] + ka2 * d_C[2] + ka4 * d_C[4]);
+
     return;
 
 } // initStokesCoefficients
@@ -293,12 +308,13 @@ StokesFifthOrderWaveBcCoef::getSurfaceElevation(double x, double time) const
 {
     // This computes eta for both shallow and deep water.
     const double& k = d_wave_number;
-    const double ka = k * d_amplitude;
-    const double omega = sqrt(d_gravity * k) * (d_C[0] + ka * ka * d_C[2] + ka * ka * ka * ka * d_C[4]);
-    const double phase = k * x - omega * time;
+    const double phase = k * x - d_omega * time;
+    const double cos_phase = cos(phase);
+    double cos_n_phase[5];
+    evaluate_harmonics(cos_phase, 1.0, cos_phase, cos_n_phase);
 
-    return (d_eta[0] * cos(phase) + d_eta[1] * cos(2 * phase) + d_eta[2] * cos(3 * phase) + d_eta[3] * cos(4 * phase) +
-            d_eta[4] * cos(5 * phase)) /
+    return (d_eta[0] * cos_n_phase[0] + d_eta[1] * cos_n_phase[1] + d_eta[2] * cos_n_phase[2] +
+            d_eta[3] * cos_n_phase[3] + d_eta[4] * cos_n_phase[4]) /
            k;
 
 } // getSurfaceElevation
@@ -306,70 +322,43 @@ StokesFifthOrderWaveBcCoef::getSurfaceElevation(double x, double time) const
 double
 StokesFifthOrderWaveBcCoef::getVelocity(double x, double z_plus_d, double time) const
 {
+#if (NDIM == 3)
+    if (d_comp_idx == 1) return 0;
+#endif
+    if (d_comp_idx < 0 || d_comp_idx >= NDIM) return std::numeric_limits<double>::signaling_NaN();
+
     const double& k = d_wave_number;
-    const double ka = k * d_amplitude;
-    const double omega = sqrt(d_gravity * k) * (d_C[0] + ka * ka * d_C[2] + ka * ka * ka * ka * d_C[4]);
-    const double phase = k * x - omega * time;
+    const double phase = k * x - d_omega * time;
+    const double cos_phase = cos(phase);
+
+    // The horizontal component varies with the cosines of the harmonics of the
+    // phase, and the vertical component varies with their sines.
+    double trig_n_phase[5];
+    if (d_comp_idx == 0)
+        evaluate_harmonics(cos_phase, 1.0, cos_phase, trig_n_phase);
+    else
+        evaluate_harmonics(cos_phase, 0.0, sin(phase), trig_n_phase);
 
     if (!d_deep_water_limit)
     {
         double kzd = k * z_plus_d;
+        const double cosh_kzd = cosh(kzd);
+        double hyp_n_kzd[5];
         if (d_comp_idx == 0)
-        {
-            return d_p[0] * cosh(kzd) * cos(phase) * k + d_p[1] * cosh(2 * kzd) * cos(2 * phase) * k * 2 +
-                   d_p[2] * cosh(3 * kzd) * cos(3 * phase) * k * 3 + d_p[3] * cosh(4 * kzd) * cos(4 * phase) * k * 4 +
-                   d_p[4] * cosh(5 * kzd) * cos(5 * phase) * k * 5;
-        }
-
-        if (d_comp_idx == 1)
-        {
-#if (NDIM == 2)
-            return d_p[0] * sinh(kzd) * sin(phase) * k + d_p[1] * sinh(2 * kzd) * sin(2 * phase) * k * 2 +
-                   d_p[2] * sinh(3 * kzd) * sin(3 * phase) * k * 3 + d_p[3] * sinh(4 * kzd) * sin(4 * phase) * k * 4 +
-                   d_p[4] * sinh(5 * kzd) * sin(5 * phase) * k * 5;
-#elif (NDIM == 3)
-            return 0;
-#endif
-        }
-#if (NDIM == 3)
-        if (d_comp_idx == 2)
-        {
-            return d_p[0] * sinh(kzd) * sin(phase) * k + d_p[1] * sinh(2 * kzd) * sin(2 * phase) * k * 2 +
-                   d_p[2] * sinh(3 * kzd) * sin(3 * phase) * k * 3 + d_p[3] * sinh(4 * kzd) * sin(4 * phase) * k * 4 +
-                   d_p[4] * sinh(5 * kzd) * sin(5 * phase) * k * 5;
-        }
-#endif
+            evaluate_harmonics(cosh_kzd, 1.0, cosh_kzd, hyp_n_kzd);
+        else
+            evaluate_harmonics(cosh_kzd, 0.0, sinh(kzd), hyp_n_kzd);
+        return d_p[0] * hyp_n_kzd[0] * trig_n_phase[0] * k + d_p[1] * hyp_n_kzd[1] * trig_n_phase[1] * k * 2 +
+               d_p[2] * hyp_n_kzd[2] * trig_n_phase[2] * k * 3 + d_p[3] * hyp_n_kzd[3] * trig_n_phase[3] * k * 4 +
+               d_p[4] * hyp_n_kzd[4] * trig_n_phase[4] * k * 5;
     }
     else
     {
         double kz = k * (z_plus_d - d_depth);
-        if (d_comp_idx == 0)
-        {
-            return d_p[0] * exp(kz) * cos(phase) * k + d_p[1] * exp(2 * kz) * cos(2 * phase) * k * 2 +
-                   d_p[2] * exp(3 * kz) * cos(3 * phase) * k * 3;
-        }
-
-        if (d_comp_idx == 1)
-        {
-#if (NDIM == 2)
-            return d_p[0] * exp(kz) * sin(phase) * k + d_p[1] * exp(2 * kz) * sin(2 * phase) * k * 2 +
-                   d_p[2] * exp(3 * kz) * sin(3 * phase) * k * 3;
-#elif (NDIM == 3)
-
-            return 0;
-#endif
-        }
-
-#if (NDIM == 3)
-        if (d_comp_idx == 2)
-        {
-            return d_p[0] * exp(kz) * sin(phase) * k + d_p[1] * exp(2 * kz) * sin(2 * phase) * k * 2 +
-                   d_p[2] * exp(3 * kz) * sin(3 * phase) * k * 3;
-        }
-#endif
+        const double exp_kz = exp(kz);
+        return d_p[0] * exp_kz * trig_n_phase[0] * k + d_p[1] * exp_kz * exp_kz * trig_n_phase[1] * k * 2 +
+               d_p[2] * exp_kz * exp_kz * exp_kz * trig_n_phase[2] * k * 3;
     }
-
-    return std::numeric_limits<double>::signaling_NaN();
 } // getVelocity
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
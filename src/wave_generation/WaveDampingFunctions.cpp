@@ -71,6 +71,55 @@ namespace IBAMR
 
 namespace
 {
+/*!
+ * Determine whether the patch intersects the zone x_zone_start <= x <= x_zone_end.
+ */
+inline bool
+patch_intersects_zone(const Patch<NDIM>& patch, const double x_zone_start, const double x_zone_end)
+{
+    Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch.getPatchGeometry();
+    return patch_geom->getXUpper()[0] >= x_zone_start && patch_geom->getXLower()[0] <= x_zone_end;
+} // patch_intersects_zone
+
+/*!
+ * Restrict the box to the indices whose horizontal positions x = x_lower + dx *
+ * (i(0) - patch_lower + shift) lie within the zone x_zone_start <= x <= x_zone_end
+ * and compute the relaxation weights ramp(xtilde) at those positions, in which
+ * xtilde = (x - x_zone_start) / (x_zone_end - x_zone_start).
+ *
+ * The weights only depend on the horizontal position, so they are computed once
+ * per column of the box.  The weight for index i is gamma[i(0) -
+ * zone_box.lower(0)], in which zone_box is the returned box.
+ */
+template <class RampFcn>
+Box<NDIM>
+compute_zone_ramp_weights(std::vector<double>& gamma,
+                          const Box<NDIM>& box,
+                          const int patch_lower,
+                          const double x_lower,
+                          const double dx,
+                          const double shift,
+                          const double x_zone_start,
+                          const double x_zone_end,
+                          const RampFcn& ramp)
+{
+    Box<NDIM> zone_box = box;
+    zone_box.lower(0) = box.upper(0) + 1;
+    zone_box.upper(0) = box.upper(0);
+    gamma.clear();
+    for (int i0 = box.lower(0); i0 <= box.upper(0); ++i0)
+    {
+        const double x_posn = x_lower + dx * (static_cast<double>(i0 - patch_lower) + shift);
+        if (x_posn >= x_zone_start && x_posn <= x_zone_end)
+        {
+            if (gamma.empty()) zone_box.lower(0) = i0;
+            zone_box.upper(0) = i0;
+            gamma.push_back(ramp((x_posn - x_zone_start) / (x_zone_end - x_zone_start)));
+        }
+    }
+    return zone_box;
+} // compute_zone_ramp_weights
+
 /*!
  * A struct holding the required information used by the variable alpha damping
  * method
@@ -86,6 +135,8 @@ struct MassConservationFunctor
     int d_I_idx;
     int d_dI_idx;
     WaveDampingData* d_ptr_wave_damper;
+    SAMRAI::tbox::Pointer<HierarchyMathOps> d_hier_math_ops;
+    SAMRAI::tbox::Pointer<HierarchyCellDataOpsReal<NDIM, double> > d_hier_cc_data_ops;
     static double s_newton_guess, s_newton_min, s_newton_max;
 };
 
@@ -115,6 +166,15 @@ MassConservationFunctor::operator()(const double& alpha)
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > I_data = patch->getPatchData(d_I_idx);
+            Pointer<CellData<NDIM, double> > dI_data = patch->getPatchData(d_dI_idx);
+            if (!patch_intersects_zone(*patch, x_zone_start, x_zone_end))
+            {
+                I_data->fillAll(0.0);
+                dI_data->fillAll(0.0);
+                continue;
+            }
+
             Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
             const double* const patch_dx = patch_geom->getDx();
             const double* const patch_x_lower = patch_geom->getXLower();
@@ -124,8 +184,6 @@ MassConservationFunctor::operator()(const double& alpha)
             Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(d_u_idx);
             Pointer<CellData<NDIM, double> > phi_new_data = patch->getPatchData(d_phi_new_idx);
             Pointer<CellData<NDIM, double> > phi_current_data = patch->getPatchData(d_phi_current_idx);
-            Pointer<CellData<NDIM, double> > I_data = patch->getPatchData(d_I_idx);
-            Pointer<CellData<NDIM, double> > dI_data = patch->getPatchData(d_dI_idx);
 
             for (Box<NDIM>::Iterator it(patch_box); it; it++)
             {
@@ -213,13 +271,9 @@ MassConservationFunctor::operator()(const double& alpha)
             }
         }
     }
-    HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(d_patch_hierarchy, coarsest_ln, finest_ln);
-    HierarchyMathOps hier_math_ops("HierarchyMathOps", d_patch_hierarchy);
-    hier_math_ops.setPatchHierarchy(d_patch_hierarchy);
-    hier_math_ops.resetLevels(coarsest_ln, finest_ln);
-    const int wgt_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
-    const double val = hier_cc_data_ops.integral(d_I_idx, wgt_cc_idx);
-    const double dval = hier_cc_data_ops.integral(d_dI_idx, wgt_cc_idx);
+    const int wgt_cc_idx = d_hier_math_ops->getCellWeightPatchDescriptorIndex();
+    const double val = d_hier_cc_data_ops->integral(d_I_idx, wgt_cc_idx);
+    const double dval = d_hier_cc_data_ops->integral(d_dI_idx, wgt_cc_idx);
     TBOX_ASSERT(!std::isnan(val));
     TBOX_ASSERT(!std::isnan(dval));
     return std::make_pair(val, dval);
@@ -262,12 +316,16 @@ callRelaxationZoneCallbackFunction(double /*current_time*/,
     const int coarsest_ln = 0;
     const int finest_ln = patch_hierarchy->getFinestLevelNumber();
 
+    // Only the patches that intersect the relaxation zone are modified.
+    auto ramp = [alpha](const double xtilde) { return 1.0 - std::expm1(std::pow(xtilde, alpha)) / std::expm1(1.0); };
+    std::vector<double> gamma;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            if (!patch_intersects_zone(*patch, x_zone_start, x_zone_end)) continue;
             Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
             const double* const patch_dx = patch_geom->getDx();
             const double* const patch_x_lower = patch_geom->getXLower();
@@ -278,25 +336,23 @@ callRelaxationZoneCallbackFunction(double /*current_time*/,
 
             for (int axis = 0; axis < NDIM; ++axis)
             {
-                for (Box<NDIM>::Iterator it(SideGeometry<NDIM>::toSideBox(patch_box, axis)); it; it++)
+                if (axis != 0 && axis != dir) continue;
+                const double shift_x = (axis == 0 ? 0.0 : 0.5);
+                const Box<NDIM> zone_box = compute_zone_ramp_weights(gamma,
+                                                                     SideGeometry<NDIM>::toSideBox(patch_box, axis),
+                                                                     patch_lower(0),
+                                                                     patch_x_lower[0],
+                                                                     patch_dx[0],
+                                                                     shift_x,
+                                                                     x_zone_start,
+                                                                     x_zone_end,
+                                                                     ramp);
+                const double target = 0.0;
+                for (Box<NDIM>::Iterator it(zone_box); it; it++)
                 {
-                    SAMRAI::hier::Index<NDIM> i = it();
-                    SideIndex<NDIM> i_side(i, axis, SideIndex<NDIM>::Lower);
-                    double x_posn = patch_x_lower[0] + patch_dx[0] * (static_cast<double>(i(0) - patch_lower(0)));
-                    const double shift_x = (axis == 0 ? 0.0 : 0.5);
-                    x_posn += patch_dx[0] * shift_x;
-
-                    if (x_posn >= x_zone_start && x_posn <= x_zone_end)
-                    {
-                        const double xtilde = (x_posn - x_zone_start) / (x_zone_end - x_zone_start);
-                        const double gamma = 1.0 - std::expm1(std::pow(xtilde, alpha)) / std::expm1(1.0);
-                        const double target = 0.0;
-
-                        if (axis == 0 || axis == dir)
-                        {
-                            (*u_data)(i_side, 0) = gamma * (*u_data)(i_side, 0) + (1.0 - gamma) * target;
-                        }
-                    }
+                    SideIndex<NDIM> i_side(it(), axis, SideIndex<NDIM>::Lower);
+                    const double gamma_i = gamma[i_side(0) - zone_box.lower(0)];
+                    (*u_data)(i_side, 0) = gamma_i * (*u_data)(i_side, 0) + (1.0 - gamma_i) * target;
                 }
             }
         }
@@ -309,6 +365,7 @@ callRelaxationZoneCallbackFunction(double /*current_time*/,
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            if (!patch_intersects_zone(*patch, x_zone_start, x_zone_end)) continue;
             Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
             const double* const patch_dx = patch_geom->getDx();
             const double* const patch_x_lower = patch_geom->getXLower();
@@ -316,25 +373,27 @@ callRelaxationZoneCallbackFunction(double /*current_time*/,
             const IntVector<NDIM>& patch_lower = patch_box.lower();
 
             Pointer<CellData<NDIM, double> > phi_data = patch->getPatchData(phi_new_idx);
-            for (Box<NDIM>::Iterator it(patch_box); it; it++)
+            const Box<NDIM> zone_box = compute_zone_ramp_weights(gamma,
+                                                                 patch_box,
+                                                                 patch_lower(0),
+                                                                 patch_x_lower[0],
+                                                                 patch_dx[0],
+                                                                 0.5,
+                                                                 x_zone_start,
+                                                                 x_zone_end,
+                                                                 ramp);
+            for (Box<NDIM>::Iterator it(zone_box); it; it++)
             {
                 SAMRAI::hier::Index<NDIM> i = it();
 
-                const auto x_posn = patch_x_lower[0] + patch_dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5);
-
                 const auto dir_posn =
                     patch_x_lower[dir] + patch_dx[dir] * (static_cast<double>(i(dir) - patch_lower(dir)) + 0.5);
-
                 const double dir_surface = sign_gas * (dir_posn - depth);
 
-                if (x_posn >= x_zone_start && x_posn <= x_zone_end)
-                {
-                    const double xtilde = (x_posn - x_zone_start) / (x_zone_end - x_zone_start);
-                    const double gamma = 1.0 - std::expm1(std::pow(xtilde, alpha)) / std::expm1(1.0);
-                    const double target = dir_surface;
+                const double gamma_i = gamma[i(0) - zone_box.lower(0)];
+                const double target = dir_surface;
 
-                    (*phi_data)(i, 0) = gamma * (*phi_data)(i, 0) + (1.0 - gamma) * target;
-                }
+                (*phi_data)(i, 0) = gamma_i * (*phi_data)(i, 0) + (1.0 - gamma_i) * target;
             }
         }
     }
@@ -434,6 +493,14 @@ callConservedWaveAbsorbingCallbackFunction(double current_time,
     mass_eval_functor.d_dI_idx = dI_idx;
     mass_eval_functor.d_ptr_wave_damper = ptr_wave_damper;
 
+    // The cell weights and data operations do not change during the Newton
+    // iteration, so they are set up only once.
+    mass_eval_functor.d_hier_math_ops = new HierarchyMathOps("HierarchyMathOps", patch_hierarchy);
+    mass_eval_functor.d_hier_math_ops->setPatchHierarchy(patch_hierarchy);
+    mass_eval_functor.d_hier_math_ops->resetLevels(coarsest_ln, finest_ln);
+    mass_eval_functor.d_hier_cc_data_ops =
+        new HierarchyCellDataOpsReal<NDIM, double>(patch_hierarchy, coarsest_ln, finest_ln);
+
     // Set up Newton itertion
     const double guess = MassConservationFunctor::s_newton_guess;
     const double min = MassConservationFunctor::s_newton_min;
@@ -449,14 +516,17 @@ callConservedWaveAbsorbingCallbackFunction(double current_time,
     if (alpha > max - 0.1 || alpha < 0.0) alpha = 0.0;
     plog << "alpha relaxation dynamic = " << alpha << std::endl;
 
-    // Carry out the damping
+    // Carry out the damping on the patches that intersect the damping zone.
     static const int dir = NDIM == 2 ? 1 : 2;
+    auto ramp = [alpha](const double xtilde) { return 1.0 - exp(-5.0 * std::pow(1.0 - xtilde, alpha)); };
+    std::vector<double> gamma;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            if (!patch_intersects_zone(*patch, x_zone_start, x_zone_end)) continue;
             Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
             const double* const patch_dx = patch_geom->getDx();
             const double* const patch_x_lower = patch_geom->getXLower();
@@ -467,24 +537,23 @@ callConservedWaveAbsorbingCallbackFunction(double current_time,
 
             for (int axis = 0; axis < NDIM; ++axis)
             {
-                for (Box<NDIM>::Iterator it(SideGeometry<NDIM>::toSideBox(patch_box, axis)); it; it++)
+                if (axis != 0 && axis != dir) continue;
+                const double shift_x = (axis == 0 ? 0.0 : 0.5);
+                const Box<NDIM> zone_box = compute_zone_ramp_weights(gamma,
+                                                                     SideGeometry<NDIM>::toSideBox(patch_box, axis),
+                                                                     patch_lower(0),
+                                                                     patch_x_lower[0],
+                                                                     patch_dx[0],
+                                                                     shift_x,
+                                                                     x_zone_start,
+                                                                     x_zone_end,
+                                                                     ramp);
+                const double target = 0.0;
+                for (Box<NDIM>::Iterator it(zone_box); it; it++)
                 {
-                    SAMRAI::hier::Index<NDIM> i = it();
-                    SideIndex<NDIM> i_side(i, axis, SideIndex<NDIM>::Lower);
-                    double x_posn = patch_x_lower[0] + patch_dx[0] * (static_cast<double>(i(0) - patch_lower(0)));
-                    const double shift_x = (axis == 0 ? 0.0 : 0.5);
-                    x_posn += patch_dx[0] * shift_x;
-                    if (x_posn >= x_zone_start && x_posn <= x_zone_end)
-                    {
-                        double xtilde = (x_posn - x_zone_start) / (x_zone_end - x_zone_start);
-                        double gamma = 1.0 - exp(-5.0 * std::pow(1.0 - xtilde, alpha));
-                        const double target = 0.0;
-
-                        if (axis == 0 || axis == dir)
-                        {
-                            (*u_data)(i_side, 0) = gamma * (*u_data)(i_side, 0) + (1.0 - gamma) * target;
-                        }
-                    }
+                    SideIndex<NDIM> i_side(it(), axis, SideIndex<NDIM>::Lower);
+                    const double gamma_i = gamma[i_side(0) - zone_box.lower(0)];
+                    (*u_data)(i_side, 0) = gamma_i * (*u_data)(i_side, 0) + (1.0 - gamma_i) * target;
                 }
             }
         }
@@ -497,6 +566,7 @@ callConservedWaveAbsorbingCallbackFunction(double current_time,
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            if (!patch_intersects_zone(*patch, x_zone_start, x_zone_end)) continue;
             Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
             const double* const patch_dx = patch_geom->getDx();
             const double* const patch_x_lower = patch_geom->getXLower();
@@ -504,24 +574,27 @@ callConservedWaveAbsorbingCallbackFunction(double current_time,
             const IntVector<NDIM>& patch_lower = patch_box.lower();
 
             Pointer<CellData<NDIM, double> > phi_data = patch->getPatchData(phi_new_idx);
-            for (Box<NDIM>::Iterator it(patch_box); it; it++)
+            const Box<NDIM> zone_box = compute_zone_ramp_weights(gamma,
+                                                                 patch_box,
+                                                                 patch_lower(0),
+                                                                 patch_x_lower[0],
+                                                                 patch_dx[0],
+                                                                 0.5,
+                                                                 x_zone_start,
+                                                                 x_zone_end,
+                                                                 ramp);
+            for (Box<NDIM>::Iterator it(zone_box); it; it++)
             {
                 SAMRAI::hier::Index<NDIM> i = it();
 
-                const auto x_posn = patch_x_lower[0] + patch_dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5);
-
                 const auto dir_posn =
                     patch_x_lower[dir] + patch_dx[dir] * (static_cast<double>(i(dir) - patch_lower(dir)) + 0.5);
                 const double dir_surface = sign_gas * (dir_posn - depth);
 
-                if (x_posn >= x_zone_start && x_posn <= x_zone_end)
-                {
-                    double xtilde = (x_posn - x_zone_start) / (x_zone_end - x_zone_start);
-                    double gamma = 1.0 - exp(-5.0 * std::pow(1.0 - xtilde, alpha));
-                    double target = dir_surface;
+                const double gamma_i = gamma[i(0) - zone_box.lower(0)];
+                const double target = dir_surface;
 
-                    (*phi_data)(i, 0) = gamma * (*phi_data)(i, 0) + (1.0 - gamma) * target;
-                }
+                (*phi_data)(i, 0) = gamma_i * (*phi_data)(i, 0) + (1.0 - gamma_i) * target;
             }
         }
     }
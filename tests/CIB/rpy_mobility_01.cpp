@@ -0,0 +1,96 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#include <ibamr/MobilityFunctions.h>
+
+#include <tbox/SAMRAIManager.h>
+#include <tbox/SAMRAI_MPI.h>
+
+#include <petscsys.h>
+
+#include <SAMRAI_config.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+using namespace SAMRAI;
+
+// Verify that MobilityFunctions::applyRPYMobilityOperator() computes the same
+// product as the matrix assembled by
+// MobilityFunctions::constructRPYMobilityMatrix(). The markers are placed so
+// that both the overlapping (r <= 2a) and the far-field branches of the RPY
+// tensor are exercised.
+int
+main(int argc, char** argv)
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    tbox::SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    tbox::SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    tbox::SAMRAIManager::startup();
+
+    std::ofstream out("output");
+
+    const int num_nodes = 37;
+    const int size = num_nodes * NDIM;
+    const double mu = 0.7, dx = 0.05;
+
+    // Fill the positions and forces with a simple deterministic pseudo-random
+    // sequence.
+    unsigned int seed = 12345u;
+    auto next_value = [&seed]() {
+        seed = 1103515245u * seed + 12345u;
+        return static_cast<double>((seed >> 8) % 100000u) / 100000.0;
+    };
+    std::vector<double> X(size), F(size);
+    for (int k = 0; k < size; ++k) X[k] = 0.6 * next_value();
+    for (int k = 0; k < size; ++k) F[k] = 2.0 * next_value() - 1.0;
+
+    for (const char* kernel : { "IB_3", "IB_4", "IB_6" })
+    {
+        for (const double periodic_correction : { 0.0, 0.25 })
+        {
+            // Multiply by the dense matrix, which is stored in column-major
+            // order.
+            std::vector<double> mm(size * size), U_ref(size, 0.0), U(size);
+            IBAMR::MobilityFunctions::constructRPYMobilityMatrix(
+                kernel, mu, dx, X.data(), num_nodes, periodic_correction, mm.data());
+            for (int col = 0; col < size; ++col)
+            {
+                for (int row = 0; row < size; ++row)
+                {
+                    U_ref[row] += mm[col * size + row] * F[col];
+                }
+            }
+
+            IBAMR::MobilityFunctions::applyRPYMobilityOperator(
+                kernel, mu, dx, X.data(), num_nodes, periodic_correction, F.data(), U.data());
+
+            double max_diff = 0.0, max_val = 0.0;
+            for (int k = 0; k < size; ++k)
+            {
+                max_diff = std::max(max_diff, std::abs(U[k] - U_ref[k]));
+                max_val = std::max(max_val, std::abs(U_ref[k]));
+            }
+            const double rel_diff = max_diff / max_val;
+            out << "kernel: " << kernel << ", periodic correction: " << periodic_correction
+                << ", relative max norm of matrix product - operator product: " << (rel_diff < 1.0e-12 ? 0.0 : rel_diff)
+                << '\n';
+        }
+    }
+
+    tbox::SAMRAIManager::shutdown();
+    PetscFinalize();
+}
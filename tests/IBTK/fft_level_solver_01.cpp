@@ -0,0 +1,208 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SAMRAIVectorReal.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCLaplaceOperator.h>
+#include <ibtk/CCPoissonSolverManager.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/SCLaplaceOperator.h>
+#include <ibtk/SCPoissonSolverManager.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Verify that the cell-centered and side-centered FFT_LEVEL_SOLVERs reproduce
+// a manufactured periodic solution. The right-hand side is computed by
+// applying the discrete operator to the exact solution, so the solvers must
+// recover it to round-off. The grid sizes are not powers of two (and some
+// are prime) so that all branches of the mixed-radix transform are exercised.
+
+namespace
+{
+double
+solve_manufactured_problem(const PoissonSpecifications& poisson_spec,
+                           LaplaceOperator& laplace_op,
+                           PoissonSolver& poisson_solver,
+                           SAMRAIVectorReal<NDIM, double>& u_vec,
+                           SAMRAIVectorReal<NDIM, double>& f_vec,
+                           SAMRAIVectorReal<NDIM, double>& e_vec)
+{
+    // Compute f = (C I + D L) u_exact.
+    laplace_op.setPoissonSpecifications(poisson_spec);
+    laplace_op.initializeOperatorState(e_vec, f_vec);
+    laplace_op.apply(e_vec, f_vec);
+    laplace_op.deallocateOperatorState();
+
+    // Solve (C I + D L) u = f.
+    poisson_solver.setPoissonSpecifications(poisson_spec);
+    poisson_solver.initializeSolverState(u_vec, f_vec);
+    u_vec.setToScalar(0.0);
+    poisson_solver.solveSystem(u_vec, f_vec);
+    poisson_solver.deallocateSolverState();
+
+    // Compare u with u_exact, reusing f as scratch space.
+    f_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&u_vec, false),
+                   Pointer<SAMRAIVectorReal<NDIM, double> >(&e_vec, false));
+    return f_vec.maxNorm() / e_vec.maxNorm();
+}
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "fft_level_solver.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_cc");
+        Pointer<CellVariable<NDIM, double> > f_cc_var = new CellVariable<NDIM, double>("f_cc");
+        Pointer<CellVariable<NDIM, double> > e_cc_var = new CellVariable<NDIM, double>("e_cc");
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, ctx, IntVector<NDIM>(1));
+        const int f_cc_idx = var_db->registerVariableAndContext(f_cc_var, ctx, IntVector<NDIM>(1));
+        const int e_cc_idx = var_db->registerVariableAndContext(e_cc_var, ctx, IntVector<NDIM>(1));
+
+        Pointer<SideVariable<NDIM, double> > u_sc_var = new SideVariable<NDIM, double>("u_sc");
+        Pointer<SideVariable<NDIM, double> > f_sc_var = new SideVariable<NDIM, double>("f_sc");
+        Pointer<SideVariable<NDIM, double> > e_sc_var = new SideVariable<NDIM, double>("e_sc");
+        const int u_sc_idx = var_db->registerVariableAndContext(u_sc_var, ctx, IntVector<NDIM>(1));
+        const int f_sc_idx = var_db->registerVariableAndContext(f_sc_var, ctx, IntVector<NDIM>(1));
+        const int e_sc_idx = var_db->registerVariableAndContext(e_sc_var, ctx, IntVector<NDIM>(1));
+
+        // The FFT solvers only work on a single patch level.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        TBOX_ASSERT(patch_hierarchy->getFinestLevelNumber() == 0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        level->allocatePatchData(u_cc_idx, 0.0);
+        level->allocatePatchData(f_cc_idx, 0.0);
+        level->allocatePatchData(e_cc_idx, 0.0);
+        level->allocatePatchData(u_sc_idx, 0.0);
+        level->allocatePatchData(f_sc_idx, 0.0);
+        level->allocatePatchData(e_sc_idx, 0.0);
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        const int h_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> u_cc_vec("u_cc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> f_cc_vec("f_cc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> e_cc_vec("e_cc", patch_hierarchy, 0, 0);
+        u_cc_vec.addComponent(u_cc_var, u_cc_idx, h_cc_idx);
+        f_cc_vec.addComponent(f_cc_var, f_cc_idx, h_cc_idx);
+        e_cc_vec.addComponent(e_cc_var, e_cc_idx, h_cc_idx);
+
+        SAMRAIVectorReal<NDIM, double> u_sc_vec("u_sc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> f_sc_vec("f_sc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> e_sc_vec("e_sc", patch_hierarchy, 0, 0);
+        u_sc_vec.addComponent(u_sc_var, u_sc_idx, h_sc_idx);
+        f_sc_vec.addComponent(f_sc_var, f_sc_idx, h_sc_idx);
+        e_sc_vec.addComponent(e_sc_var, e_sc_idx, h_sc_idx);
+
+        // Setup the exact solutions. Every component has zero mean so that
+        // the solutions are also the zero-mean solutions when C = 0.
+        muParserCartGridFunction u_fcn("u", app_initializer->getComponentDatabase("u"), grid_geometry);
+        muParserCartGridFunction u_sc_fcn("u_sc", app_initializer->getComponentDatabase("u_sc"), grid_geometry);
+        u_fcn.setDataOnPatchHierarchy(e_cc_idx, e_cc_var, patch_hierarchy, 0.0);
+        u_sc_fcn.setDataOnPatchHierarchy(e_sc_idx, e_sc_var, patch_hierarchy, 0.0);
+
+        // Setup the operators and the solvers.
+        CCLaplaceOperator cc_laplace_op("cc_laplace_op");
+        cc_laplace_op.setPhysicalBcCoef(nullptr);
+        SCLaplaceOperator sc_laplace_op("sc_laplace_op");
+        sc_laplace_op.setPhysicalBcCoefs(std::vector<RobinBcCoefStrategy<NDIM>*>(NDIM, nullptr));
+        Pointer<Database> solver_db = input_db->getDatabase("solver_db");
+        Pointer<PoissonSolver> cc_poisson_solver =
+            CCPoissonSolverManager::getManager()->allocateSolver("FFT_LEVEL_SOLVER", "cc_solver", solver_db, "cc_");
+        Pointer<PoissonSolver> sc_poisson_solver =
+            SCPoissonSolverManager::getManager()->allocateSolver("FFT_LEVEL_SOLVER", "sc_solver", solver_db, "sc_");
+
+        // Test both the Poisson problem, whose operator has a nullspace, and a
+        // Helmholtz problem.
+        const std::vector<std::pair<double, double> > coefs = { { 0.0, -1.0 }, { 2.5, -0.75 } };
+        for (const std::pair<double, double>& coef : coefs)
+        {
+            PoissonSpecifications poisson_spec("poisson_spec");
+            if (coef.first == 0.0)
+                poisson_spec.setCZero();
+            else
+                poisson_spec.setCConstant(coef.first);
+            poisson_spec.setDConstant(coef.second);
+
+            const double cc_err = solve_manufactured_problem(
+                poisson_spec, cc_laplace_op, *cc_poisson_solver, u_cc_vec, f_cc_vec, e_cc_vec);
+            const double sc_err = solve_manufactured_problem(
+                poisson_spec, sc_laplace_op, *sc_poisson_solver, u_sc_vec, f_sc_vec, e_sc_vec);
+            pout << "C = " << coef.first << ", D = " << coef.second << '\n';
+            pout << "  cell-centered relative max norm of u - u_exact: " << (cc_err < 1.0e-10 ? 0.0 : cc_err) << '\n';
+            pout << "  side-centered relative max norm of u - u_exact: " << (sc_err < 1.0e-10 ? 0.0 : sc_err) << '\n';
+        }
+    }
+
+    // At this point all SAMRAI, PETSc, and IBAMR objects have been cleaned
+    // up, so we shut things down in the opposite order of initialization:
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,207 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellIterator.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/PatchMathOps.h>
+#include <ibtk/PatchTileIterator.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Verify that PatchTileIterator partitions boxes into disjoint tiles that
+// cover every cell exactly once, and that the tiled Laplacian kernel of
+// PatchMathOps agrees with a direct (untiled) evaluation of the stencil on
+// patches that are larger than the default tile in every direction.
+
+namespace
+{
+// Return whether the tiles of box cover each of its cells exactly once and
+// are no larger than the tile size.
+bool
+check_partition(const Box<NDIM>& box, const IntVector<NDIM>& tile_size, int& num_tiles)
+{
+    std::vector<int> counts(box.empty() ? 0 : box.size(), 0);
+    bool valid = true;
+    num_tiles = 0;
+    for (PatchTileIterator t(box, tile_size); t; t++)
+    {
+        const Box<NDIM>& tile_box = t();
+        valid = valid && box.contains(tile_box) && !tile_box.empty();
+        for (unsigned int d = 0; d < NDIM; ++d) valid = valid && tile_box.numberCells(d) <= tile_size(d);
+        for (Box<NDIM>::Iterator b(tile_box); b; b++)
+        {
+            const hier::Index<NDIM>& i = b();
+            int offset = 0;
+            for (int d = NDIM - 1; d >= 0; --d) offset = offset * box.numberCells(d) + (i(d) - box.lower(d));
+            ++counts[offset];
+        }
+        ++num_tiles;
+    }
+    valid = valid && num_tiles == PatchTileIterator(box, tile_size).getNumberOfTiles();
+    return valid && std::all_of(counts.begin(), counts.end(), [](const int count) { return count == 1; });
+}
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "patch_tile_iterator.log");
+
+        // Check the partitions of boxes with extents that are and are not
+        // multiples of the tile sizes, including an empty box.
+        const IntVector<NDIM> default_tile_size = PatchTileIterator::getDefaultTileSize();
+        IntVector<NDIM> odd_tile_size(3);
+        odd_tile_size(0) = 5;
+        const std::vector<IntVector<NDIM> > tile_sizes = { default_tile_size, odd_tile_size, IntVector<NDIM>(1) };
+        hier::Index<NDIM> lower(-3), upper(4);
+        upper(0) = 140;
+        const std::vector<Box<NDIM> > boxes = { Box<NDIM>(lower, upper),
+                                                Box<NDIM>(hier::Index<NDIM>(0), default_tile_size - 1),
+                                                Box<NDIM>(hier::Index<NDIM>(2), hier::Index<NDIM>(1)) };
+        pout << "default tile size:";
+        for (unsigned int d = 0; d < NDIM; ++d) pout << ' ' << default_tile_size(d);
+        pout << '\n';
+        for (unsigned int k = 0; k < boxes.size(); ++k)
+        {
+            for (unsigned int l = 0; l < tile_sizes.size(); ++l)
+            {
+                int num_tiles = 0;
+                const bool valid = check_partition(boxes[k], tile_sizes[l], num_tiles);
+                pout << "box " << k << ", tile size " << l << ": " << num_tiles
+                     << " tiles, valid partition: " << (valid ? "true" : "false") << '\n';
+            }
+        }
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<CellVariable<NDIM, double> > u_var = new CellVariable<NDIM, double>("u");
+        Pointer<CellVariable<NDIM, double> > v_var = new CellVariable<NDIM, double>("v");
+        Pointer<CellVariable<NDIM, double> > f_var = new CellVariable<NDIM, double>("f");
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+        const int v_idx = var_db->registerVariableAndContext(v_var, ctx, IntVector<NDIM>(2));
+        const int f_idx = var_db->registerVariableAndContext(f_var, ctx, IntVector<NDIM>(0));
+
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        level->allocatePatchData(u_idx, 0.0);
+        level->allocatePatchData(v_idx, 0.0);
+        level->allocatePatchData(f_idx, 0.0);
+
+        // Compare F = alpha L U + beta U + gamma V computed by the tiled
+        // kernel with a direct evaluation of the stencil.
+        const double alpha = 0.75, beta = -1.25, gamma = 2.0;
+        PatchMathOps patch_math_ops;
+        double max_diff = 0.0, max_val = 0.0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const dx = pgeom->getDx();
+            Pointer<CellData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+            Pointer<CellData<NDIM, double> > v_data = patch->getPatchData(v_idx);
+            Pointer<CellData<NDIM, double> > f_data = patch->getPatchData(f_idx);
+            for (CellIterator<NDIM> it(u_data->getGhostBox()); it; it++)
+            {
+                const CellIndex<NDIM>& i = it();
+                double arg_u = 0.0;
+                for (unsigned int d = 0; d < NDIM; ++d) arg_u += (0.3 + 0.2 * d) * i(d);
+                (*u_data)(i) = std::sin(arg_u);
+            }
+            for (CellIterator<NDIM> it(v_data->getGhostBox()); it; it++)
+            {
+                const CellIndex<NDIM>& i = it();
+                double arg_v = 0.0;
+                for (unsigned int d = 0; d < NDIM; ++d) arg_v += (0.5 - 0.1 * d) * i(d);
+                (*v_data)(i) = std::cos(arg_v);
+            }
+
+            patch_math_ops.laplace(f_data, alpha, beta, u_data, gamma, v_data, patch);
+
+            for (CellIterator<NDIM> it(patch_box); it; it++)
+            {
+                const CellIndex<NDIM>& i = it();
+                double ref_val = beta * (*u_data)(i) + gamma * (*v_data)(i);
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    CellIndex<NDIM> i_lower = i, i_upper = i;
+                    i_lower(d) -= 1;
+                    i_upper(d) += 1;
+                    ref_val += alpha * ((*u_data)(i_upper) - 2.0 * (*u_data)(i) + (*u_data)(i_lower)) / (dx[d] * dx[d]);
+                }
+                max_diff = std::max(max_diff, std::abs((*f_data)(i) - ref_val));
+                max_val = std::max(max_val, std::abs(ref_val));
+            }
+        }
+        max_diff = SAMRAI_MPI::maxReduction(max_diff);
+        max_val = SAMRAI_MPI::maxReduction(max_val);
+        const double rel_diff = max_diff / max_val;
+        pout << "relative max norm of tiled - untiled Laplacian: " << (rel_diff < 1.0e-12 ? 0.0 : rel_diff) << '\n';
+    }
+
+    // At this point all SAMRAI, PETSc, and IBAMR objects have been cleaned
+    // up, so we shut things down in the opposite order of initialization:
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
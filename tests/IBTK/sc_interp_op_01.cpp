@@ -0,0 +1,296 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscmat.h>
+#include <petscsys.h>
+#include <petscvec.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SideData.h>
+#include <SideIndex.h>
+#include <SideIterator.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IndexUtilities.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/PETScMatUtilities.h>
+#include <ibtk/PETScVecUtilities.h>
+#include <ibtk/SAMRAIGhostDataAccumulator.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Verify that the side-centered interpolation operator J assembled by
+// PETScMatUtilities::constructPatchLevelSCInterpOp() for a named kernel agrees
+// with LEInteractor::interpolate(), and that the spreading operator
+// J^T / (cell volume) agrees with LEInteractor::spread() followed by ghost data
+// accumulation. The points are distributed over several patches (and several
+// processors when run in parallel), so that stencils cross patch boundaries.
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "sc_interp_op.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // The ghost width must accommodate the widest kernel.
+        const std::vector<std::string> kernel_fcns = { "PIECEWISE_LINEAR", "IB_3", "IB_4", "IB_6", "BSPLINE_3" };
+        int ghost_width = 0;
+        for (const std::string& kernel_fcn : kernel_fcns)
+        {
+            ghost_width = std::max(ghost_width, LEInteractor::getMinimumGhostWidth(kernel_fcn));
+        }
+        const IntVector<NDIM> gcw(ghost_width);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u");
+        Pointer<SideVariable<NDIM, double> > f_var = new SideVariable<NDIM, double>("f");
+        Pointer<SideVariable<NDIM, double> > f_ref_var = new SideVariable<NDIM, double>("f_ref");
+        Pointer<SideVariable<NDIM, int> > dof_index_var = new SideVariable<NDIM, int>("dof_index");
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, gcw);
+        const int f_idx = var_db->registerVariableAndContext(f_var, ctx, gcw);
+        const int f_ref_idx = var_db->registerVariableAndContext(f_ref_var, ctx, gcw);
+        const int dof_index_idx = var_db->registerVariableAndContext(dof_index_var, ctx, gcw);
+
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        TBOX_ASSERT(patch_hierarchy->getFinestLevelNumber() == 0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        level->allocatePatchData(u_idx, 0.0);
+        level->allocatePatchData(f_idx, 0.0);
+        level->allocatePatchData(f_ref_idx, 0.0);
+        level->allocatePatchData(dof_index_idx, 0.0);
+
+        // Set u, including its ghost values, to a smooth function so that no
+        // ghost cell filling is needed.
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+            const double* const x_lower = patch_geom->getXLower();
+            const double* const dx = patch_geom->getDx();
+            Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                for (SideIterator<NDIM> it(u_data->getGhostBox(), axis); it; it++)
+                {
+                    const SideIndex<NDIM>& i = it();
+                    double val = 1.0 + axis;
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        const double x =
+                            x_lower[d] + dx[d] * (i(d) - patch_box.lower(d) + (d == axis ? 0.0 : 0.5));
+                        val *= std::cos((2.0 + d + axis) * x);
+                    }
+                    (*u_data)(i) = val;
+                }
+            }
+        }
+
+        // Generate the same points and forces on every processor and keep
+        // the ones that lie in local patches. The points are far enough from
+        // the physical boundary that no stencil reaches it.
+        const int n_points = input_db->getIntegerWithDefault("n_points", 100);
+        std::mt19937 std_seq(42u);
+        std::uniform_real_distribution<double> X_distribution(0.25, 0.75);
+        std::uniform_real_distribution<double> F_distribution(-1.0, 1.0);
+        std::vector<double> X_all(NDIM * n_points), F_all(NDIM * n_points);
+        for (double& X : X_all) X = X_distribution(std_seq);
+        for (double& F : F_all) F = F_distribution(std_seq);
+
+        const IntVector<NDIM>& ratio = level->getRatio();
+        std::vector<std::vector<double> > X_patch(level->getNumberOfPatches()), F_patch(level->getNumberOfPatches());
+        for (int k = 0; k < n_points; ++k)
+        {
+            const double* const X = &X_all[NDIM * k];
+            const hier::Index<NDIM> X_idx = IndexUtilities::getCellIndex(X, grid_geometry, ratio);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                if (!level->getPatch(p())->getBox().contains(X_idx)) continue;
+                X_patch[p()].insert(X_patch[p()].end(), X, X + NDIM);
+                F_patch[p()].insert(F_patch[p()].end(), &F_all[NDIM * k], &F_all[NDIM * (k + 1)]);
+            }
+        }
+        std::vector<double> X_local, F_local;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            X_local.insert(X_local.end(), X_patch[p()].begin(), X_patch[p()].end());
+            F_local.insert(F_local.end(), F_patch[p()].begin(), F_patch[p()].end());
+        }
+        const int m_local = static_cast<int>(X_local.size());
+        const int n_total_points = SAMRAI_MPI::sumReduction(m_local / NDIM);
+
+        // Set up the PETSc representations of the Lagrangian and Eulerian data.
+        std::vector<int> num_dofs_per_proc;
+        PETScVecUtilities::constructPatchLevelDOFIndices(num_dofs_per_proc, dof_index_idx, level);
+        const int n_local = num_dofs_per_proc[SAMRAI_MPI::getRank()];
+        Vec X_vec, F_vec, Q_vec, u_vec, f_vec;
+        VecCreateMPI(PETSC_COMM_WORLD, m_local, PETSC_DETERMINE, &X_vec);
+        VecDuplicate(X_vec, &F_vec);
+        VecDuplicate(X_vec, &Q_vec);
+        VecCreateMPI(PETSC_COMM_WORLD, n_local, PETSC_DETERMINE, &u_vec);
+        VecDuplicate(u_vec, &f_vec);
+        double* arr;
+        VecGetArray(X_vec, &arr);
+        std::copy(X_local.begin(), X_local.end(), arr);
+        VecRestoreArray(X_vec, &arr);
+        VecGetArray(F_vec, &arr);
+        std::copy(F_local.begin(), F_local.end(), arr);
+        VecRestoreArray(F_vec, &arr);
+        PETScVecUtilities::copyToPatchLevelVec(u_vec, u_idx, dof_index_idx, level);
+        Pointer<RefineSchedule<NDIM> > data_synch_sched =
+            PETScVecUtilities::constructDataSynchSchedule(f_idx, level);
+
+        const double* const dx0 = grid_geometry->getDx();
+        double cell_volume = 1.0;
+        for (unsigned int d = 0; d < NDIM; ++d) cell_volume *= dx0[d] / static_cast<double>(ratio(d));
+
+        pout << "number of points: " << n_total_points << '\n';
+        Mat J_mat = nullptr;
+        for (const std::string& kernel_fcn : kernel_fcns)
+        {
+            PETScMatUtilities::constructPatchLevelSCInterpOp(
+                J_mat, kernel_fcn, X_vec, num_dofs_per_proc, dof_index_idx, level);
+
+            // Interpolate with J and with LEInteractor.
+            MatMult(J_mat, u_vec, Q_vec);
+            std::vector<double> Q_ref;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+                std::vector<double> Q(X_patch[p()].size(), 0.0);
+                LEInteractor::interpolate(Q, NDIM, X_patch[p()], NDIM, u_data, patch, patch->getBox(), kernel_fcn);
+                Q_ref.insert(Q_ref.end(), Q.begin(), Q.end());
+            }
+            double interp_diff = 0.0, interp_norm = 0.0;
+            VecGetArray(Q_vec, &arr);
+            for (int i = 0; i < m_local; ++i)
+            {
+                interp_diff = std::max(interp_diff, std::abs(arr[i] - Q_ref[i]));
+                interp_norm = std::max(interp_norm, std::abs(Q_ref[i]));
+            }
+            VecRestoreArray(Q_vec, &arr);
+            interp_diff = SAMRAI_MPI::maxReduction(interp_diff);
+            interp_norm = SAMRAI_MPI::maxReduction(interp_norm);
+
+            // Spread with S = J^T / (cell volume) and with LEInteractor.
+            MatMultTranspose(J_mat, F_vec, f_vec);
+            VecScale(f_vec, 1.0 / cell_volume);
+            PETScVecUtilities::copyFromPatchLevelVec(
+                f_vec, f_idx, dof_index_idx, level, data_synch_sched, Pointer<RefineSchedule<NDIM> >(nullptr));
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<SideData<NDIM, double> > f_ref_data = patch->getPatchData(f_ref_idx);
+                f_ref_data->fillAll(0.0);
+                LEInteractor::spread(
+                    f_ref_data, F_patch[p()], NDIM, X_patch[p()], NDIM, patch, patch->getBox(), kernel_fcn);
+            }
+            SAMRAIGhostDataAccumulator accumulator(patch_hierarchy, f_ref_var, gcw, 0, 0);
+            accumulator.accumulateGhostData(f_ref_idx);
+
+            // Values on faces shared by two patches are split between the
+            // patches by LEInteractor::spread(), so only compare the values
+            // in the patch interiors.
+            double spread_diff = 0.0, spread_norm = 0.0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                Pointer<SideData<NDIM, double> > f_data = patch->getPatchData(f_idx);
+                Pointer<SideData<NDIM, double> > f_ref_data = patch->getPatchData(f_ref_idx);
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    for (SideIterator<NDIM> it(patch_box, axis); it; it++)
+                    {
+                        const SideIndex<NDIM>& i = it();
+                        if (i(axis) == patch_box.lower(axis) || i(axis) == patch_box.upper(axis) + 1) continue;
+                        spread_diff = std::max(spread_diff, std::abs((*f_data)(i) - (*f_ref_data)(i)));
+                        spread_norm = std::max(spread_norm, std::abs((*f_ref_data)(i)));
+                    }
+                }
+            }
+            spread_diff = SAMRAI_MPI::maxReduction(spread_diff);
+            spread_norm = SAMRAI_MPI::maxReduction(spread_norm);
+
+            const double interp_err = interp_diff / interp_norm;
+            const double spread_err = spread_diff / spread_norm;
+            pout << kernel_fcn << ":\n";
+            pout << "  relative max norm of J u - interpolate(u): " << (interp_err < 1.0e-12 ? 0.0 : interp_err)
+                 << '\n';
+            pout << "  relative max norm of J^T F / h^" << NDIM
+                 << " - spread(F): " << (spread_err < 1.0e-12 ? 0.0 : spread_err) << '\n';
+        }
+
+        MatDestroy(&J_mat);
+        VecDestroy(&X_vec);
+        VecDestroy(&F_vec);
+        VecDestroy(&Q_vec);
+        VecDestroy(&u_vec);
+        VecDestroy(&f_vec);
+    }
+
+    // At this point all SAMRAI, PETSc, and IBAMR objects have been cleaned
+    // up, so we shut things down in the opposite order of initialization:
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
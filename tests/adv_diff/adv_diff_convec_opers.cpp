@@ -42,6 +42,7 @@
 #include "ibtk/muParserRobinBcCoefs.h"
 
 #include <SAMRAIVectorReal.h>
+#include <tbox/MemoryDatabase.h>
 
 /*******************************************************************************
  * For each run, the input filename and restart information (if needed) must   *
@@ -105,6 +106,8 @@ main(int argc, char* argv[])
         const int convec_idx = var_db->registerVariableAndContext(convec_var, var_ctx);
         const int exact_idx = var_db->registerVariableAndContext(exact_var, var_ctx);
         const int u_idx = var_db->registerVariableAndContext(u_var, var_ctx);
+        Pointer<CellVariable<NDIM, double> > vectorized_var = new CellVariable<NDIM, double>("Vectorized var");
+        const int vectorized_idx = var_db->registerVariableAndContext(vectorized_var, var_ctx);
 //#define OUTPUT_VIZ_FILES // Comment out if you want to draw things
 #ifdef OUTPUT_VIZ_FILES
         visit_writer->registerPlotQuantity("Q", "SCALAR", q_idx);
@@ -143,6 +146,22 @@ main(int argc, char* argv[])
                                                                q_bc_coefs);
         }
 
+        // The vectorized implementation of the wave propagation convective
+        // operator is compared directly against the Fortran implementation.
+        Pointer<ConvectiveOperator> vectorized_convec_oper;
+        {
+            Pointer<Database> convec_oper_db = app_initializer->getComponentDatabase("ConvecOper");
+            Pointer<Database> vectorized_db = new MemoryDatabase("ConvecOperVectorized");
+            if (convec_oper_db->keyExists("outflow_bdry_extrap_type"))
+                vectorized_db->putString("outflow_bdry_extrap_type",
+                                         convec_oper_db->getString("outflow_bdry_extrap_type"));
+            vectorized_db->putBool("use_vectorized_kernel", true);
+            auto differencing_type =
+                IBAMR::string_to_enum<ConvectiveDifferencingType>(input_db->getString("CONVECTIVE_DIFFERENCING_TYPE"));
+            vectorized_convec_oper = oper_manager->allocateOperator(
+                "WAVE_PROP", "WAVE_PROP_VECTORIZED", q_var, vectorized_db, differencing_type, q_bc_coefs);
+        }
+
         gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
         const int tag_buffer = std::numeric_limits<int>::max();
         int level_number = 0;
@@ -160,6 +179,7 @@ main(int argc, char* argv[])
             level->allocatePatchData(convec_idx, 0.0);
             level->allocatePatchData(exact_idx, 0.0);
             level->allocatePatchData(u_idx, 0.0);
+            level->allocatePatchData(vectorized_idx, 0.0);
         }
 
         solv::SAMRAIVectorReal<NDIM, double> q_vec("Q_vec", patch_hierarchy, 0, finest_level);
@@ -195,6 +215,23 @@ main(int argc, char* argv[])
 
         for (const auto& convec_oper : convec_opers) do_test(convec_oper);
 
+        // The two implementations of the wave propagation convective operator
+        // should agree to roundoff.
+        {
+            Pointer<ConvectiveOperator> wave_prop_convec_oper = convec_opers.back();
+            wave_prop_convec_oper->applyConvectiveOperator(q_idx, convec_idx);
+            vectorized_convec_oper->initializeOperatorState(q_vec, q_vec);
+            vectorized_convec_oper->setAdvectionVelocity(u_idx);
+            vectorized_convec_oper->applyConvectiveOperator(q_idx, vectorized_idx);
+
+            HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(patch_hierarchy, 0, finest_level);
+            const double convec_norm = hier_cc_data_ops.maxNorm(convec_idx);
+            hier_cc_data_ops.subtract(vectorized_idx, vectorized_idx, convec_idx);
+            const double rel_diff = hier_cc_data_ops.maxNorm(vectorized_idx) / convec_norm;
+            pout << "Relative max-norm of the difference between " << wave_prop_convec_oper->getName() << " and "
+                 << vectorized_convec_oper->getName() << ": " << (rel_diff < 1.0e-12 ? 0.0 : rel_diff) << "\n";
+        }
+
         for (int ln = 0; ln <= finest_level; ++ln)
         {
             Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
@@ -202,6 +239,7 @@ main(int argc, char* argv[])
             level->deallocatePatchData(convec_idx);
             level->deallocatePatchData(exact_idx);
             level->deallocatePatchData(u_idx);
+            level->deallocatePatchData(vectorized_idx);
         }
     } // cleanup dynamically allocated objects prior to shutdown
 
@@ -0,0 +1,136 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/AdvDiffSemiImplicitHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+
+#include <LocationIndexRobinBcCoefs.h>
+
+#include <cmath>
+#include <limits>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+#include "QInit.h"
+#include "UFunction.h"
+
+// Verify that error-controlled time step size selection never changes the
+// size of a time step after it has been requested: the integrator time must
+// always equal the sum of the time step sizes passed to advanceHierarchy(),
+// while a tight tolerance must still reduce the time step size below dt_max
+// through getMaximumTimeStepSize().
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "adv_diff.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<AdvDiffHierarchyIntegrator> time_integrator = new AdvDiffSemiImplicitHierarchyIntegrator(
+            "AdvDiffSemiImplicitHierarchyIntegrator",
+            app_initializer->getComponentDatabase("AdvDiffSemiImplicitHierarchyIntegrator"));
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Setup the advection velocity.
+        Pointer<FaceVariable<NDIM, double> > u_var = new FaceVariable<NDIM, double>("u");
+        UFunction u_fcn("UFunction", grid_geometry, app_initializer->getComponentDatabase("UFunction"));
+        time_integrator->registerAdvectionVelocity(u_var);
+        time_integrator->setAdvectionVelocityIsDivergenceFree(u_var, true);
+        time_integrator->setAdvectionVelocityFunction(u_var, Pointer<CartGridFunction>(&u_fcn, false));
+
+        // Setup the advected and diffused quantity.
+        Pointer<CellVariable<NDIM, double> > Q_var = new CellVariable<NDIM, double>("Q");
+        QInit Q_init("QInit", grid_geometry, app_initializer->getComponentDatabase("QInit"));
+        LocationIndexRobinBcCoefs<NDIM> physical_bc_coef(
+            "physical_bc_coef", app_initializer->getComponentDatabase("LocationIndexRobinBcCoefs"));
+        const double kappa = app_initializer->getComponentDatabase("QInit")->getDouble("kappa");
+        time_integrator->registerTransportedQuantity(Q_var);
+        time_integrator->setAdvectionVelocity(Q_var, u_var);
+        time_integrator->setDiffusionCoefficient(Q_var, kappa);
+        time_integrator->setInitialConditions(Q_var, Pointer<CartGridFunction>(&Q_init, false));
+        time_integrator->setPhysicalBcCoef(Q_var, &physical_bc_coef);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Main time step loop.
+        const double dt_max = app_initializer->getComponentDatabase("AdvDiffSemiImplicitHierarchyIntegrator")
+                                  ->getDouble("dt_max");
+        const double loop_time_end = time_integrator->getEndTime();
+        double loop_time = time_integrator->getIntegratorTime();
+        double dt_min_taken = std::numeric_limits<double>::max();
+        bool times_match = true;
+        while (!MathUtilities<double>::equalEps(loop_time, loop_time_end) && time_integrator->stepsRemaining())
+        {
+            const double dt = time_integrator->getMaximumTimeStepSize();
+            time_integrator->advanceHierarchy(dt);
+            loop_time += dt;
+            times_match = times_match && std::abs(loop_time - time_integrator->getIntegratorTime()) <=
+                                             1.0e-12 * std::max(1.0, std::abs(loop_time));
+            if (!MathUtilities<double>::equalEps(loop_time, loop_time_end)) dt_min_taken = std::min(dt_min_taken, dt);
+        }
+
+        pout << "loop time matches integrator time: " << (times_match ? "true" : "false") << "\n";
+        pout << "reached end time: "
+             << (MathUtilities<double>::equalEps(time_integrator->getIntegratorTime(), loop_time_end) ? "true" :
+                                                                                                     "false")
+             << "\n";
+        pout << "error control reduced the time step size: " << (dt_min_taken < dt_max ? "true" : "false")
+             << "\n";
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,230 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <HierarchyCellDataOpsReal.h>
+#include <HierarchyDataOpsManager.h>
+#include <HierarchySideDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <SAMRAIVectorReal.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/StaggeredStokesOperator.h>
+#include <ibamr/StaggeredStokesPhysicalBoundaryHelper.h>
+#include <ibamr/StaggeredStokesSolver.h>
+#include <ibamr/StaggeredStokesSolverManager.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/LinearSolver.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <limits>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify that a Krylov solver preconditioned with
+// BOX_RELAXATION_FAC_PRECONDITIONER converges for the staggered-grid Stokes
+// equations on a locally refined, periodic grid. The right-hand side is
+// computed by applying the discrete Stokes operator to a manufactured
+// solution, which the solver must then recover (up to a constant pressure).
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "stokes_box_relaxation.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u");
+        Pointer<SideVariable<NDIM, double> > f_var = new SideVariable<NDIM, double>("f");
+        Pointer<SideVariable<NDIM, double> > u_exact_var = new SideVariable<NDIM, double>("u_exact");
+        Pointer<CellVariable<NDIM, double> > p_var = new CellVariable<NDIM, double>("p");
+        Pointer<CellVariable<NDIM, double> > g_var = new CellVariable<NDIM, double>("g");
+        Pointer<CellVariable<NDIM, double> > p_exact_var = new CellVariable<NDIM, double>("p_exact");
+        const IntVector<NDIM> gcw(1);
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, gcw);
+        const int f_idx = var_db->registerVariableAndContext(f_var, ctx, gcw);
+        const int u_exact_idx = var_db->registerVariableAndContext(u_exact_var, ctx, gcw);
+        const int p_idx = var_db->registerVariableAndContext(p_var, ctx, gcw);
+        const int g_idx = var_db->registerVariableAndContext(g_var, ctx, gcw);
+        const int p_exact_idx = var_db->registerVariableAndContext(p_exact_var, ctx, gcw);
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int level_number = 0;
+        while (gridding_algorithm->levelCanBeRefined(level_number))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, std::numeric_limits<int>::max());
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_idx, 0.0);
+            level->allocatePatchData(f_idx, 0.0);
+            level->allocatePatchData(u_exact_idx, 0.0);
+            level->allocatePatchData(p_idx, 0.0);
+            level->allocatePatchData(g_idx, 0.0);
+            level->allocatePatchData(p_exact_idx, 0.0);
+        }
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int wgt_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+        const int wgt_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        SAMRAIVectorReal<NDIM, double> x_vec("x", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> b_vec("b", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> e_vec("e", patch_hierarchy, 0, finest_ln);
+        x_vec.addComponent(u_var, u_idx, wgt_sc_idx);
+        x_vec.addComponent(p_var, p_idx, wgt_cc_idx);
+        b_vec.addComponent(f_var, f_idx, wgt_sc_idx);
+        b_vec.addComponent(g_var, g_idx, wgt_cc_idx);
+        e_vec.addComponent(u_exact_var, u_exact_idx, wgt_sc_idx);
+        e_vec.addComponent(p_exact_var, p_exact_idx, wgt_cc_idx);
+
+        // Setup the manufactured solution.
+        muParserCartGridFunction u_fcn("u", app_initializer->getComponentDatabase("u"), grid_geometry);
+        muParserCartGridFunction p_fcn("p", app_initializer->getComponentDatabase("p"), grid_geometry);
+        u_fcn.setDataOnPatchHierarchy(u_exact_idx, u_exact_var, patch_hierarchy, 0.0);
+        p_fcn.setDataOnPatchHierarchy(p_exact_idx, p_exact_var, patch_hierarchy, 0.0);
+
+        // The domain is periodic, so the boundary condition objects are never
+        // used.
+        PoissonSpecifications U_problem_coefs("U_problem_coefs");
+        U_problem_coefs.setCConstant(input_db->getDoubleWithDefault("C", 1.0));
+        U_problem_coefs.setDConstant(input_db->getDoubleWithDefault("D", -1.0));
+        const std::vector<RobinBcCoefStrategy<NDIM>*> U_bc_coefs(NDIM, nullptr);
+        Pointer<StaggeredStokesPhysicalBoundaryHelper> bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
+        bc_helper->cacheBcCoefData(U_bc_coefs, 0.0, patch_hierarchy);
+
+        // Compute the right-hand side b = A e.
+        StaggeredStokesOperator stokes_op("stokes_op", false);
+        stokes_op.setVelocityPoissonSpecifications(U_problem_coefs);
+        stokes_op.setPhysicalBcCoefs(U_bc_coefs, nullptr);
+        stokes_op.setPhysicalBoundaryHelper(bc_helper);
+        stokes_op.setSolutionTime(0.0);
+        stokes_op.setTimeInterval(0.0, 0.0);
+        stokes_op.initializeOperatorState(e_vec, b_vec);
+        stokes_op.apply(e_vec, b_vec);
+        stokes_op.deallocateOperatorState();
+
+        // Setup the solver. The constant pressure is in the nullspace of the
+        // operator.
+        Pointer<StaggeredStokesSolver> stokes_solver =
+            StaggeredStokesSolverManager::getManager()->allocateSolver("PETSC_KRYLOV_SOLVER",
+                                                                       "stokes_solver",
+                                                                       input_db->getDatabase("stokes_solver_db"),
+                                                                       "stokes_",
+                                                                       "BOX_RELAXATION_FAC_PRECONDITIONER",
+                                                                       "stokes_precond",
+                                                                       input_db->getDatabase("stokes_precond_db"),
+                                                                       "stokes_pc_");
+        stokes_solver->setVelocityPoissonSpecifications(U_problem_coefs);
+        stokes_solver->setPhysicalBcCoefs(U_bc_coefs, nullptr);
+        stokes_solver->setPhysicalBoundaryHelper(bc_helper);
+        stokes_solver->setSolutionTime(0.0);
+        stokes_solver->setTimeInterval(0.0, 0.0);
+        stokes_solver->setComponentsHaveNullspace(false, true);
+        Pointer<SAMRAIVectorReal<NDIM, double> > nul_vec = x_vec.cloneVector("nul_vec");
+        nul_vec->allocateVectorData(0.0);
+        HierarchyDataOpsManager<NDIM>* hier_ops_manager = HierarchyDataOpsManager<NDIM>::getManager();
+        Pointer<HierarchySideDataOpsReal<NDIM, double> > hier_sc_data_ops =
+            hier_ops_manager->getOperationsDouble(u_var, patch_hierarchy, true);
+        Pointer<HierarchyCellDataOpsReal<NDIM, double> > hier_cc_data_ops =
+            hier_ops_manager->getOperationsDouble(p_var, patch_hierarchy, true);
+        hier_sc_data_ops->setToScalar(nul_vec->getComponentDescriptorIndex(0), 0.0);
+        hier_cc_data_ops->setToScalar(nul_vec->getComponentDescriptorIndex(1), 1.0);
+        Pointer<LinearSolver> p_stokes_linear_solver = stokes_solver;
+        TBOX_ASSERT(p_stokes_linear_solver);
+        p_stokes_linear_solver->setNullspace(false, std::vector<Pointer<SAMRAIVectorReal<NDIM, double> > >(1, nul_vec));
+        stokes_solver->initializeSolverState(x_vec, b_vec);
+
+        // Solve A x = b.
+        x_vec.setToScalar(0.0);
+        const bool converged = stokes_solver->solveSystem(x_vec, b_vec);
+
+        // Compute the errors, removing the mean of the pressure error.
+        x_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&x_vec, false),
+                       Pointer<SAMRAIVectorReal<NDIM, double> >(&e_vec, false));
+        const double p_err_mean =
+            hier_cc_data_ops->integral(p_idx, wgt_cc_idx) / hier_math_ops.getVolumeOfPhysicalDomain();
+        hier_cc_data_ops->addScalar(p_idx, p_idx, -p_err_mean);
+        const double u_rel_err =
+            hier_sc_data_ops->maxNorm(u_idx, wgt_sc_idx) / hier_sc_data_ops->maxNorm(u_exact_idx, wgt_sc_idx);
+        const double p_rel_err =
+            hier_cc_data_ops->maxNorm(p_idx, wgt_cc_idx) / hier_cc_data_ops->maxNorm(p_exact_idx, wgt_cc_idx);
+
+        const double tol = input_db->getDoubleWithDefault("error_tol", 1.0e-6);
+        pout << "number of levels: " << finest_ln + 1 << '\n';
+        pout << "solver converged: " << (converged ? "true" : "false") << '\n';
+        pout << "relative velocity error below " << tol << ": " << (u_rel_err < tol ? "true" : "false") << '\n';
+        pout << "relative pressure error below " << tol << ": " << (p_rel_err < tol ? "true" : "false") << '\n';
+        plog << "relative velocity error: " << u_rel_err << '\n';
+        plog << "relative pressure error: " << p_rel_err << '\n';
+
+        stokes_solver->deallocateSolverState();
+        nul_vec->freeVectorComponents();
+    }
+
+    // At this point all SAMRAI, PETSc, and IBAMR objects have been cleaned
+    // up, so we shut things down in the opposite order of initialization:
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,203 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SideData.h>
+#include <SideIndex.h>
+#include <SideIterator.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CartSideDoubleSpecializedLinearRefine.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Verify that CartSideDoubleSpecializedLinearRefine agrees with a direct
+// implementation of MC-limited linear interpolation in the tangential
+// directions and linear interpolation in the normal direction. Ratios 2 and 4
+// exercise the C++ kernels and other ratios exercise the Fortran routines. The
+// coarse domain includes negative indices and every side of the fine patch,
+// including the upper face in the normal direction, is checked.
+
+namespace
+{
+// Coarsen a fine index, rounding towards negative infinity.
+int
+coarsen_index(const int i, const int ratio)
+{
+    return (i < 0 ? (i + 1) / ratio - 1 : i / ratio);
+}
+
+double
+mc_slope(const double u_lower, const double u, const double u_upper)
+{
+    const double a = 0.5 * (u_upper - u_lower);
+    const double b = 2.0 * (u - u_lower);
+    const double c = 2.0 * (u_upper - u);
+    if (a >= 0.0 && b >= 0.0 && c >= 0.0) return std::min(a, std::min(b, c));
+    if (a <= 0.0 && b <= 0.0 && c <= 0.0) return std::max(a, std::max(b, c));
+    return 0.0;
+}
+
+double
+reference_value(const SideData<NDIM, double>& u_c,
+                const SideIndex<NDIM>& i_f,
+                const unsigned int axis,
+                const IntVector<NDIM>& ratio)
+{
+    Index<NDIM> i_c;
+    double w[NDIM];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        i_c(d) = coarsen_index(i_f(d), ratio(d));
+        const int k = i_f(d) - i_c(d) * ratio(d);
+        w[d] = d == axis ? 1.0 - static_cast<double>(k) / ratio(d) : static_cast<double>(k) + 0.5 - 0.5 * ratio(d);
+    }
+
+    double val = 0.0;
+    for (int shift = 0; shift <= 1; ++shift)
+    {
+        SideIndex<NDIM> i(i_c, axis, SideIndex<NDIM>::Lower);
+        i(axis) += shift;
+        double u = u_c(i);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            if (d == axis) continue;
+            SideIndex<NDIM> i_lower = i, i_upper = i;
+            i_lower(d) -= 1;
+            i_upper(d) += 1;
+            u += w[d] * (mc_slope(u_c(i_lower), u_c(i), u_c(i_upper)) / ratio(d));
+        }
+        val += (shift == 0 ? w[axis] : 1.0 - w[axis]) * u;
+    }
+    return val;
+}
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    // this test only works in serial
+    TBOX_ASSERT(SAMRAI_MPI::getNodes() == 1);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "refine.log");
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database. The
+        // refinement stencil requires one layer of coarse ghost cells.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<SideVariable<NDIM, double> > u_sc_var = new SideVariable<NDIM, double>("u_sc");
+        const int u_sc_idx = var_db->registerVariableAndContext(u_sc_var, ctx, IntVector<NDIM>(1));
+
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, std::numeric_limits<int>::max());
+        TBOX_ASSERT(patch_hierarchy->getFinestLevelNumber() == 1);
+        for (int ln = 0; ln <= 1; ++ln)
+        {
+            patch_hierarchy->getPatchLevel(ln)->allocatePatchData(u_sc_idx, 0.0);
+        }
+
+        // there should only be one patch on each patch level
+        Pointer<PatchLevel<NDIM> > level_0 = patch_hierarchy->getPatchLevel(0);
+        Pointer<PatchLevel<NDIM> > level_1 = patch_hierarchy->getPatchLevel(1);
+        Pointer<Patch<NDIM> > patch_0 = level_0->getPatch(0);
+        Pointer<Patch<NDIM> > patch_1 = level_1->getPatch(0);
+        Pointer<SideData<NDIM, double> > u_sc_0_data = patch_0->getPatchData(u_sc_idx);
+        Pointer<SideData<NDIM, double> > u_sc_1_data = patch_1->getPatchData(u_sc_idx);
+
+        // Fill the coarse data, including ghost values, with an oscillatory
+        // function so that every branch of the limiter is exercised.
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            for (SideIterator<NDIM> it(u_sc_0_data->getGhostBox(), axis); it; it++)
+            {
+                const SideIndex<NDIM>& i = it();
+                double arg = 1.0 + axis;
+                for (unsigned int d = 0; d < NDIM; ++d) arg += (0.7 + 0.6 * d) * i(d);
+                (*u_sc_0_data)(i) = std::sin(arg);
+            }
+        }
+
+        const IntVector<NDIM> ratio = level_1->getRatioToCoarserLevel();
+        const Box<NDIM>& patch_box_1 = patch_1->getBox();
+        CartSideDoubleSpecializedLinearRefine refine_op;
+        refine_op.refine(*patch_1, *patch_0, u_sc_idx, u_sc_idx, patch_box_1, ratio);
+
+        int num_values = 0;
+        double max_diff = 0.0;
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            for (SideIterator<NDIM> it(patch_box_1, axis); it; it++)
+            {
+                const SideIndex<NDIM>& i = it();
+                const double ref_val = reference_value(*u_sc_0_data, i, axis, ratio);
+                max_diff = std::max(max_diff, std::abs((*u_sc_1_data)(i) - ref_val));
+                ++num_values;
+            }
+        }
+
+        pout << "refinement ratio: " << ratio(0) << '\n';
+        pout << "number of fine values checked: " << num_values << '\n';
+        pout << "max norm of reference - refined: " << (max_diff < 1.0e-12 ? 0.0 : max_diff) << '\n';
+    }
+
+    // At this point all SAMRAI, PETSc, and IBAMR objects have been cleaned
+    // up, so we shut things down in the opposite order of initialization:
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+}